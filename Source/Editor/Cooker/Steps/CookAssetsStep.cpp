@@ -16,9 +16,11 @@
 #include "Engine/Content/Assets/Texture.h"
 #include "Engine/Content/Assets/CubeTexture.h"
 #include "Engine/Render2D/SpriteAtlas.h"
+#include "Engine/Level/Prefabs/Prefab.h"
 #include "Engine/Content/Storage/FlaxFile.h"
 #include "Engine/Particles/ParticleEmitter.h"
 #include "Engine/Utilities/Encryption.h"
+#include "Engine/Serialization/BinaryJson.h"
 #include "Engine/Serialization/JsonWriters.h"
 #include "Engine/Serialization/FileWriteStream.h"
 #include "Engine/Serialization/MemoryWriteStream.h"
@@ -334,7 +336,20 @@ bool CookAssetsStep::ProcessDefaultAsset(AssetCookData& options)
         // Store json data in the first chunk
         auto chunk = New<FlaxChunk>();
         chunk->Flags = FlaxChunkFlags::CompressedLZ4; // Compress json data (internal storage layer will handle it)
-        chunk->Data.Copy((byte*)buffer.GetString(), (int32)buffer.GetSize());
+
+        // Cook the json document into the binary form so the game loads it without text parsing
+        ISerializable::SerializeDocument document;
+        document.Parse(buffer.GetString(), buffer.GetSize());
+        if (!document.HasParseError())
+        {
+            MemoryWriteStream stream((uint32)buffer.GetSize());
+            BinaryJson::Serialize(stream, document);
+            chunk->Data.Copy(stream.GetHandle(), (int32)stream.GetPosition());
+        }
+        else
+        {
+            chunk->Data.Copy((byte*)buffer.GetString(), (int32)buffer.GetSize());
+        }
         options.InitData.Header.Chunks[0] = chunk;
 
         return false;
@@ -738,6 +753,35 @@ bool ProcessTextureBase(CookAssetsStep::AssetCookData& data)
     return false;
 }
 
+bool ProcessPrefab(CookAssetsStep::AssetCookData& options)
+{
+    // Bake the nested prefabs hierarchy into a flattened objects list so the runtime spawning never walks the nesting chain
+    const auto prefab = (Prefab*)options.Asset;
+    ISerializable::SerializeDocument document;
+    if (!prefab->BakeNestedPrefabs(document))
+    {
+        // Track the nested prefabs so the cooked data gets refreshed when any of them changes
+        for (const Guid& nestedPrefabId : prefab->NestedPrefabs)
+        {
+            AssetInfo info;
+            if (Content::GetAssetInfo(nestedPrefabId, info))
+                options.FileDependencies.Add(ToPair(info.Path, FileSystem::GetFileLastEditTime(info.Path)));
+        }
+
+        // Cook the flattened json document into the binary form (same format as the default json assets cooking)
+        auto chunk = New<FlaxChunk>();
+        chunk->Flags = FlaxChunkFlags::CompressedLZ4;
+        MemoryWriteStream stream(16384);
+        BinaryJson::Serialize(stream, document);
+        chunk->Data.Copy(stream.GetHandle(), (int32)stream.GetPosition());
+        options.InitData.Header.Chunks[0] = chunk;
+        return false;
+    }
+
+    // Cook with the original data (eg. no nesting or data that cannot be flattened statically)
+    return CookAssetsStep::ProcessDefaultAsset(options);
+}
+
 CookAssetsStep::CookAssetsStep()
     : AssetsRegistry(1024)
     , AssetPathsMapping(256)
@@ -748,6 +792,7 @@ CookAssetsStep::CookAssetsStep()
     AssetProcessors.Add(Texture::TypeName, ProcessTextureBase);
     AssetProcessors.Add(CubeTexture::TypeName, ProcessTextureBase);
     AssetProcessors.Add(SpriteAtlas::TypeName, ProcessTextureBase);
+    AssetProcessors.Add(Prefab::TypeName, ProcessPrefab);
 }
 
 bool CookAssetsStep::Process(CookingData& data, CacheData& cache, BinaryAsset* asset)
@@ -770,6 +815,7 @@ bool CookAssetsStep::Process(CookingData& data, CacheData& cache, BinaryAsset* a
         }
     }
     initData.Dependencies.Resize(0);
+    asset->GetReferences(initData.References); // Cook the references manifest so the game can prefetch the dependent assets I/O on loading
 
     // Lock source asset chunks so they can be reused
     auto chunksLock = asset->Storage->LockSafe();
@@ -8,6 +8,7 @@
 #include "Engine/Core/Math/Vector3.h"
 #include "Engine/Core/Math/Quaternion.h"
 #include "Engine/Core/Math/Transform.h"
+#include "Engine/Core/SIMD.h"
 
 namespace AnimationUtils
 {
@@ -275,4 +276,44 @@ namespace AnimationUtils
         BezierFirstDerivative<Quaternion>(p0.Orientation, p1.Orientation, p2.Orientation, p3.Orientation, t, result.Orientation);
         BezierFirstDerivative<Float3>(p0.Scale, p1.Scale, p2.Scale, p3.Scale, t, result.Scale);
     }
+
+    /// <summary>
+    /// Blends two skeleton poses into the result pose (array-wise Transform::Lerp over whole node transformations arrays). Uses SIMD to interpolate the translation and scale lanes in bulk while rotations use Quaternion::Slerp to match the per-node blending path. The result array can alias one of the input arrays.
+    /// </summary>
+    /// <param name="a">The first pose nodes array.</param>
+    /// <param name="b">The second pose nodes array.</param>
+    /// <param name="result">The output pose nodes array.</param>
+    /// <param name="count">The amount of nodes in the pose arrays.</param>
+    /// <param name="alpha">The blending alpha (0 gives the first pose, 1 gives the second pose).</param>
+    static void BlendPoses(const Transform* a, const Transform* b, Transform* result, int32 count, float alpha)
+    {
+#if !USE_LARGE_WORLDS
+        static_assert(sizeof(Transform) == 10 * sizeof(float), "Update the SIMD pose blending for the changed Transform data layout.");
+        const SimdVector4 alphaV = SIMD::Splat(alpha);
+        for (int32 i = 0; i < count; i++)
+        {
+            const float* pa = (const float*)&a[i];
+            const float* pb = (const float*)&b[i];
+            float* pr = (float*)&result[i];
+            const Quaternion qa = a[i].Orientation;
+            const Quaternion qb = b[i].Orientation;
+
+            // Lerp the whole transform lanes in bulk (the rotation lanes get overwritten by the slerp below)
+            const SimdVector4 a0 = SIMD::LoadUnaligned(pa);
+            const SimdVector4 b0 = SIMD::LoadUnaligned(pb);
+            SIMD::StoreUnaligned(pr, SIMD::Add(a0, SIMD::Mul(SIMD::Sub(b0, a0), alphaV)));
+            const SimdVector4 a1 = SIMD::LoadUnaligned(pa + 4);
+            const SimdVector4 b1 = SIMD::LoadUnaligned(pb + 4);
+            SIMD::StoreUnaligned(pr + 4, SIMD::Add(a1, SIMD::Mul(SIMD::Sub(b1, a1), alphaV)));
+            pr[8] = pa[8] + (pb[8] - pa[8]) * alpha;
+            pr[9] = pa[9] + (pb[9] - pa[9]) * alpha;
+
+            Quaternion::Slerp(qa, qb, alpha, result[i].Orientation);
+        }
+#else
+        // Large worlds use 64-bit translation so keep the scalar per-node path
+        for (int32 i = 0; i < count; i++)
+            Transform::Lerp(a[i], b[i], alpha, result[i]);
+#endif
+    }
 }
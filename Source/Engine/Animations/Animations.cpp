@@ -6,6 +6,7 @@
 #include "Engine/Level/Actors/AnimatedModel.h"
 #include "Engine/Engine/Time.h"
 #include "Engine/Engine/EngineService.h"
+#include "Engine/Core/Collections/Sorting.h"
 #include "Engine/Threading/TaskGraph.h"
 
 class AnimationsService : public EngineService
@@ -31,6 +32,11 @@ public:
 
 AnimationsService AnimationManagerInstance;
 Array<AnimatedModel*> UpdateList;
+
+bool SortAnimatedModels(AnimatedModel* const& a, AnimatedModel* const& b)
+{
+    return a->AnimationGraph.Get() < b->AnimationGraph.Get();
+}
 TaskGraphSystem* Animations::System = nullptr;
 #if USE_EDITOR
 Delegate<Asset*, ScriptingObject*, uint32, uint32> Animations::DebugFlow;
@@ -106,6 +112,9 @@ void AnimationsSystem::Execute(TaskGraph* graph)
         Animations::DebugFlow(nullptr, nullptr, 0, 0);
 #endif
 
+    // Batch instances that share the same graph next to each other so workers keep the graph structure and skeleton data hot in caches (eg. crowds of characters using a single graph)
+    Sorting::QuickSort(UpdateList.Get(), UpdateList.Count(), &SortAnimatedModels);
+
     // Schedule work to update all animated models in async
     Function<void(int32)> job;
     job.Bind<AnimationsSystem, &AnimationsSystem::Job>(this);
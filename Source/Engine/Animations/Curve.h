@@ -376,6 +376,59 @@ public:
         KeyFrame::Interpolate(leftKey, rightKey, t, length, result);
     }
 
+    /// <summary>
+    /// Evaluates the animation curve values at the specified batch of times. Amortizes the keyframes lookup over the whole batch: samples that advance monotonically (typical for dense spline sampling during geometry generation) march a segment cursor forward instead of performing a search per-sample, falling back to the search only when the time jumps backwards.
+    /// </summary>
+    /// <param name="data">The keyframes data container.</param>
+    /// <param name="times">The times to evaluate the curve at.</param>
+    /// <param name="results">The output values buffer to fill (has to fit at least times length elements).</param>
+    /// <param name="loop">If true the curve will loop when it goes past the end or beginning. Otherwise the curve value will be clamped.</param>
+    void EvaluateBatch(const KeyFrameData& data, const Span<float>& times, T* results, bool loop = true) const
+    {
+        const int32 count = data.Length();
+        const int32 samples = times.Length();
+        if (count == 0)
+        {
+            for (int32 i = 0; i < samples; i++)
+                results[i] = _default;
+            return;
+        }
+
+        const float start = Math::Min(data[0].Time, 0.0f);
+        const float end = data[count - 1].Time;
+        int32 leftKeyIdx = 0;
+        int32 rightKeyIdx = 0;
+        for (int32 i = 0; i < samples; i++)
+        {
+            float time = times.Get()[i];
+            AnimationUtils::WrapTime(time, start, end, loop);
+
+            // March the segment cursor forward, search only when the time went backwards (eg. loop wrap)
+            if (time < data[leftKeyIdx].Time)
+            {
+                FindKeys(data, time, leftKeyIdx, rightKeyIdx);
+            }
+            else
+            {
+                while (rightKeyIdx < count - 1 && data[rightKeyIdx].Time <= time)
+                    rightKeyIdx++;
+                leftKeyIdx = data[rightKeyIdx].Time > time ? Math::Max(rightKeyIdx - 1, 0) : rightKeyIdx;
+            }
+
+            const KeyFrame& leftKey = data[leftKeyIdx];
+            const KeyFrame& rightKey = data[rightKeyIdx];
+            if (leftKeyIdx == rightKeyIdx)
+            {
+                results[i] = leftKey.Value;
+                continue;
+            }
+
+            const float length = rightKey.Time - leftKey.Time;
+            const float t = Math::NearEqual(length, 0.0f) ? 0.0f : (time - leftKey.Time) / length;
+            KeyFrame::Interpolate(leftKey, rightKey, t, length, results[i]);
+        }
+    }
+
     /// <summary>
     /// Evaluates the first derivative of the animation curve at the specified time (aka velocity).
     /// </summary>
@@ -470,8 +523,47 @@ protected:
     /// <param name="rightKey">The index of the key to interpolate to.</param>
     void FindKeys(const KeyFrameData& data, float time, int32& leftKey, int32& rightKey) const
     {
+        const int32 count = data.Length();
         int32 start = 0;
-        int32 searchLength = data.Length();
+        int32 searchLength = count;
+
+        // Seed the search with a guess assuming uniform keyframes spacing (typical for baked animation tracks), then gallop around it to bracket the time.
+        // This makes sampling long tracks O(1) when the keys are evenly spaced and falls back to the binary search over the bracketed range otherwise.
+        if (count > 8)
+        {
+            const float first = data[0].Time;
+            const float last = data[count - 1].Time;
+            if (last > first && time >= first && time <= last)
+            {
+                const int32 guess = Math::Clamp((int32)((time - first) / (last - first) * (float)(count - 1)), 0, count - 1);
+                int32 lo, hi, step = 1;
+                if (time < data[guess].Time)
+                {
+                    hi = guess;
+                    lo = hi - step;
+                    while (lo > 0 && time < data[lo].Time)
+                    {
+                        hi = lo;
+                        step <<= 1;
+                        lo = hi - step;
+                    }
+                    lo = Math::Max(lo, 0);
+                }
+                else
+                {
+                    lo = guess;
+                    hi = lo + step;
+                    while (hi < count && time >= data[hi].Time)
+                    {
+                        lo = hi;
+                        step <<= 1;
+                        hi = lo + step;
+                    }
+                }
+                start = lo;
+                searchLength = Math::Min(hi + 1, count) - lo;
+            }
+        }
 
         while (searchLength > 0)
         {
@@ -629,6 +721,18 @@ public:
         Base::Evaluate(data, result, time, loop);
     }
 
+    /// <summary>
+    /// Evaluates the animation curve values at the specified batch of times (amortizes the keyframes lookup over the whole batch).
+    /// </summary>
+    /// <param name="times">The times to evaluate the curve at.</param>
+    /// <param name="results">The output values buffer to fill (has to fit at least times length elements).</param>
+    /// <param name="loop">If true the curve will loop when it goes past the end or beginning. Otherwise the curve value will be clamped.</param>
+    void EvaluateBatch(const Span<float>& times, T* results, bool loop = true) const
+    {
+        typename Base::KeyFrameData data(_keyframes.Get(), _keyframes.Count());
+        Base::EvaluateBatch(data, times, results, loop);
+    }
+
     /// <summary>
     /// Evaluates the first derivative of the animation curve at the specified time (aka velocity).
     /// </summary>
@@ -4,6 +4,7 @@
 #include "Engine/Animations/Animations.h"
 #include "Engine/Animations/AnimEvent.h"
 #include "Engine/Content/Assets/SkinnedModel.h"
+#include "Engine/Engine/Time.h"
 #include "Engine/Graphics/Models/SkeletonData.h"
 #include "Engine/Scripting/Scripting.h"
 
@@ -256,15 +257,20 @@ void AnimGraphExecutor::Update(AnimGraphInstanceData& data, float dt)
         for (auto& e : data.Events)
             e.Hit = false;
 
-        // Init empty nodes data
-        context.EmptyNodes.RootMotion = RootMotionData::Identity;
-        context.EmptyNodes.Position = 0.0f;
-        context.EmptyNodes.Length = 0.0f;
-        context.EmptyNodes.Nodes.Resize(_skeletonNodesCount, false);
-        for (int32 i = 0; i < _skeletonNodesCount; i++)
+        // Init empty nodes data with the skeleton bind pose (reused by the following instances that share the same skeleton within the current frame)
+        if (context.EmptyNodesSkeleton != (void*)skeleton.Nodes.Get() || context.EmptyNodesFrame != Time::Update.TicksCount || context.EmptyNodes.Nodes.Count() != _skeletonNodesCount)
         {
-            auto& node = skeleton.Nodes[i];
-            context.EmptyNodes.Nodes[i] = node.LocalTransform;
+            context.EmptyNodes.RootMotion = RootMotionData::Identity;
+            context.EmptyNodes.Position = 0.0f;
+            context.EmptyNodes.Length = 0.0f;
+            context.EmptyNodes.Nodes.Resize(_skeletonNodesCount, false);
+            for (int32 i = 0; i < _skeletonNodesCount; i++)
+            {
+                auto& node = skeleton.Nodes[i];
+                context.EmptyNodes.Nodes[i] = node.LocalTransform;
+            }
+            context.EmptyNodesSkeleton = (void*)skeleton.Nodes.Get();
+            context.EmptyNodesFrame = Time::Update.TicksCount;
         }
     }
 
@@ -329,6 +335,8 @@ void AnimGraphExecutor::Update(AnimGraphInstanceData& data, float dt)
     }
 
     // Cleanup
+    if (animResult == &context.EmptyNodes)
+        context.EmptyNodesSkeleton = nullptr; // Global pose calculation transformed the bind pose in-place so rebuild it on the next update
     context.Data = nullptr;
 }
 
@@ -382,6 +390,10 @@ VisjectExecutor::Value AnimGraphExecutor::eatBox(Node* caller, Box* box)
     }
 #endif
 
+    // Reuse the constant value folded during graph loading (skips the constant subtree execution)
+    if (box->FoldedValue != INVALID_INDEX)
+        return GetCurrentGraph()->FoldedConstants[box->FoldedValue];
+
     // Add to the calling stack
     context.CallStack.Add(caller);
 
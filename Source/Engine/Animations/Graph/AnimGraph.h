@@ -795,6 +795,9 @@ struct AnimGraphContext
     uint64 CurrentFrameIndex;
     AnimGraphInstanceData* Data;
     AnimGraphImpulse EmptyNodes;
+    // The skeleton nodes data and frame the EmptyNodes bind pose was built from (reused across instances sharing the same skeleton within a frame; null if the pose got modified in-place)
+    void* EmptyNodesSkeleton = nullptr;
+    uint64 EmptyNodesFrame = 0;
     AnimGraphTransitionData TransitionData;
     Array<VisjectExecutor::Node*, FixedAllocation<ANIM_GRAPH_MAX_CALL_STACK>> CallStack;
     Array<VisjectExecutor::Graph*, FixedAllocation<32>> GraphStack;
@@ -82,14 +82,10 @@ void InverseKinematics::SolveTwoBoneIK(Transform& rootNode, Transform& jointNode
     else
     {
         const Real twoAb = 2.0f * upperLimbLength * desiredLength;
-        const Real cosAngle = twoAb > ZeroTolerance ? (upperLimbLength * upperLimbLength + desiredLength * desiredLength - lowerLimbLength * lowerLimbLength) / twoAb : 0.0f;
-        const bool reverseUpperBone = cosAngle < 0.0f;
-        const Real angle = Math::Acos(cosAngle);
-        const Real jointLineDist = upperLimbLength * Math::Sin(angle);
-        const Real projJointDistSqr = upperLimbLength * upperLimbLength - jointLineDist * jointLineDist;
-        Real projJointDist = projJointDistSqr > 0.0f ? Math::Sqrt(projJointDistSqr) : 0.0f;
-        if (reverseUpperBone)
-            projJointDist *= -1.0f;
+        const Real cosAngle = twoAb > ZeroTolerance ? Math::Clamp((upperLimbLength * upperLimbLength + desiredLength * desiredLength - lowerLimbLength * lowerLimbLength) / twoAb, (Real)-1, (Real)1) : (Real)0;
+        const Real sinAngle = Math::Sqrt((Real)1 - cosAngle * cosAngle);
+        const Real jointLineDist = upperLimbLength * sinAngle;
+        const Real projJointDist = upperLimbLength * cosAngle;
         resultJointPos = rootNode.Translation + projJointDist * desiredDir + jointLineDist * jointBendDir;
     }
 
@@ -2,7 +2,9 @@
 
 #include "Audio.h"
 #include "AudioBackend.h"
+#include "AudioClip.h"
 #include "AudioSettings.h"
+#include "AudioSource.h"
 #include "FlaxEngine.Gen.h"
 #include "Engine/Scripting/ScriptingType.h"
 #include "Engine/Scripting/BinaryModule.h"
@@ -10,6 +12,7 @@
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Engine/Engine.h"
 #include "Engine/Engine/CommandLine.h"
+#include "Engine/Engine/Time.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Engine/EngineService.h"
 #if AUDIO_API_NONE
@@ -50,6 +53,7 @@ namespace
     int32 ActiveDeviceIndex = -1;
     bool MuteOnFocusLoss = true;
     bool EnableHRTF = true;
+    Array<Vector3> VelocitiesScratch;
 }
 
 class AudioService : public EngineService
@@ -262,6 +266,41 @@ void AudioService::Update()
         AudioBackend::SetVolume(masterVolume);
     }
 
+    // Batch per-source velocity computation (doppler effect input) in a single pass over all voices instead of scattered per-actor updates
+    {
+        PROFILE_CPU_NAMED("Audio.UpdateVelocities");
+        auto& sources = Audio::Sources;
+        const int32 count = sources.Count();
+        VelocitiesScratch.Resize(count);
+        const float dt = Math::Max(Time::Update.UnscaledDeltaTime.GetTotalSeconds(), ZeroTolerance);
+        const float invDt = 1.0f / dt;
+        for (int32 i = 0; i < count; i++)
+        {
+            AudioSource* source = sources[i];
+            const Vector3 pos = source->GetPosition();
+            VelocitiesScratch[i] = (pos - source->_prevPos) * invDt;
+            source->_prevPos = pos;
+        }
+
+        // Hand off the changed velocities to the backend
+        for (int32 i = 0; i < count; i++)
+        {
+            AudioSource* source = sources[i];
+            const Vector3& velocity = VelocitiesScratch[i];
+            if (velocity != source->_velocity)
+            {
+                source->_velocity = velocity;
+                if (source->SourceIDs.HasItems())
+                    AudioBackend::Source::VelocityChanged(source);
+            }
+        }
+    }
+
+    // Apply the audio clips memory budget (evicts the least-recently-played clips)
+    const int32 memoryBudgetMB = AudioSettings::Get()->AudioMemoryBudget;
+    if (memoryBudgetMB > 0)
+        AudioClip::ApplyMemoryBudget((uint64)memoryBudgetMB * 1024 * 1024);
+
     AudioBackend::Update();
 }
 
@@ -270,6 +309,7 @@ void AudioService::Dispose()
     ASSERT(Audio::Sources.IsEmpty() && Audio::Listeners.IsEmpty());
 
     // Cleanup
+    VelocitiesScratch.Resize(0);
     Audio::Devices.Resize(0);
     if (AudioBackend::Instance)
     {
@@ -13,9 +13,16 @@
 #include "Engine/Tools/AudioTool/OggVorbisDecoder.h"
 #include "Engine/Tools/AudioTool/AudioTool.h"
 #include "Engine/Threading/Threading.h"
+#include "Engine/Threading/JobSystem.h"
 
 REGISTER_BINARY_ASSET_WITH_UPGRADER(AudioClip, "FlaxEngine.AudioClip", AudioClipUpgrader, false);
 
+namespace
+{
+    CriticalSection ClipsLocker;
+    Array<AudioClip*> Clips;
+}
+
 bool AudioClip::StreamingTask::Run()
 {
     AssetReference<AudioClip> ref = _asset.Get();
@@ -44,13 +51,27 @@ bool AudioClip::StreamingTask::Run()
         }
     }
 
-    // Load missing buffers data (from asset chunks)
+    // Decode missing buffers data (from asset chunks) on the Job System workers so large queues don't serialize on a single thread
+    Array<Array<byte>, FixedAllocation<ASSET_FILE_DATA_CHUNKS>> buffersData;
+    Array<AudioDataInfo, FixedAllocation<ASSET_FILE_DATA_CHUNKS>> buffersInfo;
+    buffersData.Resize(queue.Count());
+    buffersInfo.Resize(queue.Count());
+    volatile int64 decodeFailed = 0;
+    JobSystem::Execute([&](int32 i)
+    {
+        const auto idx = queue[i];
+        if (clip->Buffers[idx] != AUDIO_BUFFER_ID_INVALID && clip->DecodeBuffer(idx, buffersData[i], buffersInfo[i]))
+            Platform::InterlockedIncrement(&decodeFailed);
+    }, queue.Count());
+    if (Platform::AtomicRead(&decodeFailed) != 0)
+        return true;
+
+    // Submit the decoded samples to the audio backend (buffer writes are kept on a single thread)
     for (int32 i = 0; i < queue.Count(); i++)
     {
-        if (clip->WriteBuffer(queue[i]))
-        {
-            return true;
-        }
+        const auto idx = queue[i];
+        if (clip->Buffers[idx] != AUDIO_BUFFER_ID_INVALID)
+            AudioBackend::Buffer::Write(clip->Buffers[idx], buffersData[i].Get(), buffersInfo[i]);
     }
 
     // Update the sources
@@ -91,11 +112,17 @@ AudioClip::AudioClip(const SpawnParams& params, const AssetInfo* info)
 {
     Platform::MemoryClear(&AudioHeader, sizeof(AudioHeader));
     Platform::MemoryClear(&_buffersStartTimes, sizeof(_buffersStartTimes));
+    ClipsLocker.Lock();
+    Clips.Add(this);
+    ClipsLocker.Unlock();
 }
 
 AudioClip::~AudioClip()
 {
     ASSERT(_streamingTask == nullptr);
+    ClipsLocker.Lock();
+    Clips.Remove(this);
+    ClipsLocker.Unlock();
 }
 
 float AudioClip::GetBufferStartTime(int32 bufferIndex) const
@@ -143,6 +170,78 @@ int32 AudioClip::GetFirstBufferIndex(float time, float& offset) const
     return 0;
 }
 
+uint64 AudioClip::GetBufferMemorySize() const
+{
+    // Estimate the decoded PCM data size (mono-converted 3D clips use less but it's a budget heuristic, not an exact allocation size)
+    const AudioDataInfo& info = AudioHeader.Info;
+    return (uint64)info.NumSamples * (info.BitDepth / 8);
+}
+
+bool AudioClip::EnsureBufferResident()
+{
+    if (IsStreamable() || !IsLoaded())
+        return false;
+    ScopeLock lock(Locker);
+    LastPlayTime = Platform::GetTimeSeconds();
+    if (Buffers.Count() == 0 || Buffers[0] != AUDIO_BUFFER_ID_INVALID)
+        return false;
+    if (AudioBackend::Instance == nullptr)
+        return true;
+
+    // Buffer was evicted by the memory budget so re-decode the audio data from the compressed source
+    if (LoadChunk(0))
+        return true;
+    Buffers[0] = AudioBackend::Buffer::Create();
+    return WriteBuffer(0);
+}
+
+void AudioClip::ApplyMemoryBudget(uint64 budget)
+{
+    if (budget == 0 || AudioBackend::Instance == nullptr)
+        return;
+    ScopeLock lock(ClipsLocker);
+
+    // Sum the resident memory used by the non-streamable clips
+    uint64 totalMemory = 0;
+    for (AudioClip* clip : Clips)
+    {
+        if (!clip->IsStreamable() && clip->IsLoaded() && clip->Buffers.Count() != 0 && clip->Buffers[0] != AUDIO_BUFFER_ID_INVALID)
+            totalMemory += clip->GetBufferMemorySize();
+    }
+
+    while (totalMemory > budget)
+    {
+        // Pick the least-recently-played clip that is safe to evict (not referenced by any audio source)
+        AudioClip* lru = nullptr;
+        for (AudioClip* clip : Clips)
+        {
+            if (clip->IsStreamable() || !clip->IsLoaded() || clip->Buffers.Count() == 0 || clip->Buffers[0] == AUDIO_BUFFER_ID_INVALID)
+                continue;
+            bool isUsed = false;
+            for (int32 sourceIndex = 0; sourceIndex < Audio::Sources.Count(); sourceIndex++)
+            {
+                if (Audio::Sources[sourceIndex]->Clip == clip)
+                {
+                    isUsed = true;
+                    break;
+                }
+            }
+            if (isUsed)
+                continue;
+            if (lru == nullptr || clip->LastPlayTime < lru->LastPlayTime)
+                lru = clip;
+        }
+        if (lru == nullptr)
+            break;
+
+        // Release the backend buffer (clip stays loaded and will be re-decoded on the next playback)
+        ScopeLock clipLock(lru->Locker);
+        AudioBackend::Buffer::Delete(lru->Buffers[0]);
+        lru->Buffers[0] = AUDIO_BUFFER_ID_INVALID;
+        totalMemory -= lru->GetBufferMemorySize();
+    }
+}
+
 bool AudioClip::ExtractData(Array<byte>& resultData, AudioDataInfo& resultDataInfo)
 {
     ASSERT(!IsVirtual());
@@ -376,6 +475,9 @@ Asset::LoadResult AudioClip::load()
     if (WriteBuffer(0))
         return LoadResult::Failed;
 
+    // Mark as recently used so the memory budget won't evict the clip right after loading
+    LastPlayTime = Platform::GetTimeSeconds();
+
     return LoadResult::Ok;
 }
 
@@ -409,27 +511,16 @@ void AudioClip::unload(bool isReloading)
     Platform::MemoryClear(&AudioHeader, sizeof(AudioHeader));
 }
 
-bool AudioClip::WriteBuffer(int32 chunkIndex)
+bool AudioClip::DecodeBuffer(int32 chunkIndex, Array<byte>& resultData, AudioDataInfo& resultInfo)
 {
-    // Ignore if buffer is not created
-    const uint32 bufferId = Buffers[chunkIndex];
-    if (bufferId == AUDIO_BUFFER_ID_INVALID)
-        return false;
-
-    // Ensure audio backend exists
-    if (AudioBackend::Instance == nullptr)
-        return true;
-
     const auto chunk = GetChunk(chunkIndex);
     if (chunk == nullptr || chunk->IsMissing())
     {
         LOG(Warning, "Missing audio data.");
         return true;
     }
-    Span<byte> data;
-    Array<byte> tmp1, tmp2;
-    AudioDataInfo info = AudioHeader.Info;
-    const uint32 bytesPerSample = info.BitDepth / 8;
+    resultInfo = AudioHeader.Info;
+    const uint32 bytesPerSample = resultInfo.BitDepth / 8;
 
     // Get raw data or decompress it
     switch (Format())
@@ -440,13 +531,12 @@ bool AudioClip::WriteBuffer(int32 chunkIndex)
         OggVorbisDecoder decoder;
         MemoryReadStream stream(chunk->Get(), chunk->Size());
         AudioDataInfo tmpInfo;
-        if (decoder.Convert(&stream, tmpInfo, tmp1))
+        if (decoder.Convert(&stream, tmpInfo, resultData))
         {
             LOG(Warning, "Audio data decode failed (OggVorbisDecoder).");
             return true;
         }
         // TODO: validate decompressed data header info?
-        data = Span<byte>(tmp1.Get(), tmp1.Count());
 #else
 		LOG(Warning, "OggVorbisDecoder is disabled.");
 		return true;
@@ -455,27 +545,47 @@ bool AudioClip::WriteBuffer(int32 chunkIndex)
     break;
     case AudioFormat::Raw:
     {
-        data = Span<byte>(chunk->Get(), chunk->Size());
+        resultData.Resize(chunk->Size());
+        Platform::MemoryCopy(resultData.Get(), chunk->Get(), chunk->Size());
     }
     break;
     default:
         return true;
     }
-    info.NumSamples = data.Length() / bytesPerSample;
+    resultInfo.NumSamples = resultData.Count() / bytesPerSample;
 
     // Convert to Mono if used as 3D source and backend doesn't support it
-    if (Is3D() && info.NumChannels > 1 && EnumHasNoneFlags(AudioBackend::Features(), AudioBackend::FeatureFlags::SpatialMultiChannel))
+    if (Is3D() && resultInfo.NumChannels > 1 && EnumHasNoneFlags(AudioBackend::Features(), AudioBackend::FeatureFlags::SpatialMultiChannel))
     {
-        const uint32 samplesPerChannel = info.NumSamples / info.NumChannels;
+        const uint32 samplesPerChannel = resultInfo.NumSamples / resultInfo.NumChannels;
         const uint32 monoBufferSize = samplesPerChannel * bytesPerSample;
-        tmp2.Resize(monoBufferSize);
-        AudioTool::ConvertToMono(data.Get(), tmp2.Get(), info.BitDepth, samplesPerChannel, info.NumChannels);
-        info.NumChannels = 1;
-        info.NumSamples = samplesPerChannel;
-        data = Span<byte>(tmp2.Get(), tmp2.Count());
+        Array<byte> monoData;
+        monoData.Resize(monoBufferSize);
+        AudioTool::ConvertToMono(resultData.Get(), monoData.Get(), resultInfo.BitDepth, samplesPerChannel, resultInfo.NumChannels);
+        resultInfo.NumChannels = 1;
+        resultInfo.NumSamples = samplesPerChannel;
+        resultData = MoveTemp(monoData);
     }
 
-    // Write samples to the audio buffer
+    return false;
+}
+
+bool AudioClip::WriteBuffer(int32 chunkIndex)
+{
+    // Ignore if buffer is not created
+    const uint32 bufferId = Buffers[chunkIndex];
+    if (bufferId == AUDIO_BUFFER_ID_INVALID)
+        return false;
+
+    // Ensure audio backend exists
+    if (AudioBackend::Instance == nullptr)
+        return true;
+
+    // Decode audio samples and write them to the audio buffer
+    Array<byte> data;
+    AudioDataInfo info;
+    if (DecodeBuffer(chunkIndex, data, info))
+        return true;
     AudioBackend::Buffer::Write(bufferId, data.Get(), info);
     return false;
 }
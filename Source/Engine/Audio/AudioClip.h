@@ -95,6 +95,11 @@ public:
     /// </summary>
     Array<int32, FixedAllocation<ASSET_FILE_DATA_CHUNKS>> StreamingQueue;
 
+    /// <summary>
+    /// The last playback start time (in seconds, via Platform::GetTimeSeconds). Used by the audio memory budget to evict the least-recently-played clips.
+    /// </summary>
+    double LastPlayTime = 0.0;
+
 public:
     /// <summary>
     /// Gets the audio data format.
@@ -160,6 +165,23 @@ public:
     /// <returns>The buffer index.</returns>
     int32 GetFirstBufferIndex(float time, float& offset) const;
 
+    /// <summary>
+    /// Gets the estimated size (in bytes) of the decoded audio data kept in the audio backend memory when the clip buffer is resident.
+    /// </summary>
+    uint64 GetBufferMemorySize() const;
+
+    /// <summary>
+    /// Ensures that the non-streamable clip buffer is resident in the audio backend memory. Re-decodes the audio data from the compressed source if the buffer was evicted by the memory budget. Updates the last playback time used by the eviction policy.
+    /// </summary>
+    /// <returns>True if failed, otherwise false.</returns>
+    bool EnsureBufferResident();
+
+    /// <summary>
+    /// Applies the audio clips memory budget (see AudioSettings). Evicts backend buffers of the least-recently-played non-streamable clips that are not referenced by any audio source until the total resident memory fits the budget.
+    /// </summary>
+    /// <param name="budget">The memory budget (in bytes).</param>
+    static void ApplyMemoryBudget(uint64 budget);
+
 public:
     /// <summary>
     /// Extracts the source audio data from the asset storage. Loads the whole asset. The result data is in an asset format.
@@ -205,6 +227,9 @@ protected:
     void unload(bool isReloading) override;
 
 private:
+    // Decodes audio samples from the asset chunk and handles automatic decompression or format conversion for runtime playback. Safe to run in parallel for different chunks.
+    bool DecodeBuffer(int32 chunkIndex, Array<byte>& resultData, AudioDataInfo& resultInfo);
+
     // Writes audio samples into Audio Backend buffer and handles automatic decompression or format conversion for runtime playback.
     bool WriteBuffer(int32 chunkIndex);
 };
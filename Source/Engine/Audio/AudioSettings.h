@@ -38,6 +38,12 @@ public:
     API_FIELD(Attributes="EditorOrder(300), DefaultValue(true), EditorDisplay(\"Spatial Audio\")")
     bool EnableHRTF = true;
 
+    /// <summary>
+    /// The memory budget for the loaded audio clips data (in megabytes). When the resident buffers of non-streamable clips exceed the limit, the least-recently-played clips that are not in use get evicted and re-decoded from the source data on the next playback. Use 0 for unlimited.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(400), DefaultValue(0), EditorDisplay(\"General\")")
+    int32 AudioMemoryBudget = 0;
+
 public:
     /// <summary>
     /// Gets the instance of the settings asset (default value if missing). Object returned by this method is always loaded with valid data to use.
@@ -53,5 +59,6 @@ public:
         DESERIALIZE(DopplerFactor);
         DESERIALIZE(MuteOnFocusLoss);
         DESERIALIZE(EnableHRTF);
+        DESERIALIZE(AudioMemoryBudget);
     }
 };
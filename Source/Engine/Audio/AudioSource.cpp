@@ -313,6 +313,9 @@ void AudioSource::SetNonStreamingBuffer()
 {
     ASSERT(Clip && !Clip->IsStreamable());
 
+    // Restore the clip buffer if it was evicted by the audio memory budget (also marks the clip as recently played)
+    Clip->EnsureBufferResident();
+
     AudioBackend::Source::SetNonStreamingBuffer(this);
 }
 
@@ -389,16 +392,7 @@ void AudioSource::Update()
 {
     PROFILE_CPU();
 
-    // Update the velocity
-    const Vector3 pos = GetPosition();
-    const float dt = Math::Max(Time::Update.UnscaledDeltaTime.GetTotalSeconds(), ZeroTolerance);
-    const auto prevVelocity = _velocity;
-    _velocity = (pos - _prevPos) / dt;
-    _prevPos = pos;
-    if (_velocity != prevVelocity)
-    {
-        AudioBackend::Source::VelocityChanged(this);
-    }
+    // Velocity is updated in a single batched pass for all sources (see AudioService::Update)
 
     // Skip other update logic if it's not valid streamable source
     if (!UseStreaming() || SourceIDs.IsEmpty())
@@ -470,6 +464,15 @@ void AudioSource::Update()
             }
             ASSERT(_streamingFirstChunk < clip->Buffers.Count());
 
+            // Detect the streaming underrun (playback consumed all the queued buffers before the streaming delivered the next chunk which makes an audible gap)
+            if (_isActuallyPlayingSth)
+            {
+                int32 numQueuedBuffers = 0;
+                AudioBackend::Source::GetQueuedBuffersCount(this, numQueuedBuffers);
+                if (numQueuedBuffers == 0)
+                    _streamingUnderruns++;
+            }
+
             // Update clip data streaming
             clip->RequestStreamingUpdate();
         }
@@ -19,6 +19,7 @@ class FLAXENGINE_API AudioSource : public Actor
     DECLARE_SCENE_OBJECT(AudioSource);
     friend class AudioStreamingHandler;
     friend class AudioClip;
+    friend class AudioService;
 public:
     /// <summary>
     /// Valid states in which AudioSource can be in.
@@ -61,6 +62,7 @@ private:
     States _savedState = States::Stopped;
     float _savedTime = 0;
     int32 _streamingFirstChunk = 0;
+    int32 _streamingUnderruns = 0;
 
 public:
     /// <summary>
@@ -267,6 +269,14 @@ public:
         return _isActuallyPlayingSth;
     }
 
+    /// <summary>
+    /// Gets the amount of the audio streaming underruns that occurred on this source (playback consumed all the queued buffers before the streaming could deliver the next chunk). Can be used to diagnose the audio streaming performance.
+    /// </summary>
+    API_PROPERTY() FORCE_INLINE int32 GetStreamingUnderruns() const
+    {
+        return _streamingUnderruns;
+    }
+
     /// <summary>
     /// Requests the audio streaming buffers update. Rises tha flag to synchronize audio backend buffers of the emitter during next game logic update.
     /// </summary>
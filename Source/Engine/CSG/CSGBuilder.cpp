@@ -35,6 +35,17 @@ namespace CSGBuilderImpl
 {
     Array<Scene*> ScenesToRebuild;
 
+    // Cached per-brush meshes reused between builds when the brush data did not change (so editing a single brush skips rebuilding meshes of all the others)
+    struct CachedBrushMesh
+    {
+        Scene* Scene;
+        uint64 Hash;
+        CSG::Mesh Mesh;
+        bool Used;
+    };
+
+    Dictionary<Guid, CachedBrushMesh> BrushMeshesCache;
+
     void onSceneUnloading(Scene* scene, const Guid& sceneId);
     bool buildInner(Scene* scene, BuildData& data);
     void build(Scene* scene);
@@ -63,6 +74,13 @@ void CSGBuilderImpl::onSceneUnloading(Scene* scene, const Guid& sceneId)
 {
     // Ensure to remove scene (prevent crashes)
     ScenesToRebuild.Remove(scene);
+
+    // Drop cached meshes of that scene brushes
+    for (auto i = BrushMeshesCache.Begin(); i.IsNotEnd(); ++i)
+    {
+        if (i->Value.Scene == scene)
+            BrushMeshesCache.Remove(i);
+    }
 }
 
 bool CSGBuilderService::Init()
@@ -120,6 +138,32 @@ namespace CSG
 {
     typedef Dictionary<Actor*, Mesh*> MeshesLookup;
 
+    FORCE_INLINE void hashBrushData(uint64& hash, const void* data, int32 size)
+    {
+        const byte* bytes = (const byte*)data;
+        for (int32 i = 0; i < size; i++)
+            hash = hash * 31 + bytes[i];
+    }
+
+    uint64 hashBrush(Brush* brush)
+    {
+        // Hash the brush content that affects the built mesh (field by field to skip any structure padding)
+        Array<Surface, HeapAllocation> surfaces;
+        brush->GetSurfaces(surfaces);
+        uint64 hash = (uint64)brush->GetBrushMode() + 1;
+        for (const Surface& s : surfaces)
+        {
+            hashBrushData(hash, &s.Normal, sizeof(s.Normal));
+            hashBrushData(hash, &s.D, sizeof(s.D));
+            hashBrushData(hash, &s.Material, sizeof(s.Material));
+            hashBrushData(hash, &s.TexCoordScale, sizeof(s.TexCoordScale));
+            hashBrushData(hash, &s.TexCoordOffset, sizeof(s.TexCoordOffset));
+            hashBrushData(hash, &s.TexCoordRotation, sizeof(s.TexCoordRotation));
+            hashBrushData(hash, &s.ScaleInLightmap, sizeof(s.ScaleInLightmap));
+        }
+        return hash;
+    }
+
     bool walkTree(Actor* actor, MeshesArray& meshes, MeshesLookup& cache)
     {
         // Check if actor is a brush
@@ -132,9 +176,26 @@ namespace CSG
                 // Skip subtract/common meshes from the beginning (they have no effect)
                 if (meshes.Count() > 0 || brush->GetBrushMode() == Mode::Additive)
                 {
-                    // Create new mesh and build for given brush
-                    auto mesh = New<CSG::Mesh>();
-                    mesh->Build(brush);
+                    // Reuse the mesh built during the previous build if the brush data did not change (combining mutates meshes so hand out a copy)
+                    Mesh* mesh;
+                    const Guid brushId = brush->GetBrushID();
+                    const uint64 hash = hashBrush(brush);
+                    CachedBrushMesh* cached = BrushMeshesCache.TryGet(brushId);
+                    if (cached && cached->Hash == hash)
+                    {
+                        mesh = New<CSG::Mesh>(cached->Mesh);
+                        cached->Used = true;
+                    }
+                    else
+                    {
+                        mesh = New<CSG::Mesh>();
+                        mesh->Build(brush);
+                        auto& entry = BrushMeshesCache[brushId];
+                        entry.Scene = brush->GetBrushScene();
+                        entry.Hash = hash;
+                        entry.Mesh = *mesh;
+                        entry.Used = true;
+                    }
 
                     // Save results
                     meshes.Add(mesh);
@@ -252,11 +313,21 @@ struct BuildData
 
 bool CSGBuilderImpl::buildInner(Scene* scene, BuildData& data)
 {
-    // Setup CSG meshes list and build them
+    // Setup CSG meshes list and build them (unchanged brushes reuse cached meshes)
+    for (auto& e : BrushMeshesCache)
+    {
+        if (e.Value.Scene == scene)
+            e.Value.Used = false;
+    }
     {
         Function<bool(Actor*, MeshesArray&, MeshesLookup&)> treeWalkFunction(walkTree);
         SceneQuery::TreeExecute<Array<CSG::Mesh*>&, MeshesLookup&>(treeWalkFunction, data.meshes, data.cache);
     }
+    for (auto i = BrushMeshesCache.Begin(); i.IsNotEnd(); ++i)
+    {
+        if (i->Value.Scene == scene && !i->Value.Used)
+            BrushMeshesCache.Remove(i);
+    }
     if (data.meshes.IsEmpty())
         return false;
 
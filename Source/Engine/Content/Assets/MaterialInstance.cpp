@@ -170,6 +170,21 @@ bool MaterialInstance::CanUseInstancing(InstancingHandler& handler) const
     return _baseMaterial && _baseMaterial->CanUseInstancing(handler);
 }
 
+IMaterial* MaterialInstance::GetBatchingRoot()
+{
+    // Instances that don't override any parameter render exactly like the base material so batch draw calls with it (and with the sibling instances)
+    if (_baseMaterial)
+    {
+        for (const MaterialParameter& param : Params)
+        {
+            if (param.IsOverride())
+                return this;
+        }
+        return _baseMaterial->GetBatchingRoot();
+    }
+    return this;
+}
+
 void MaterialInstance::Bind(BindParameters& params)
 {
     //ASSERT(IsReady());
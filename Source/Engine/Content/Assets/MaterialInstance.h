@@ -60,6 +60,7 @@ public:
     DrawPass GetDrawModes() const override;
     bool CanUseLightmap() const override;
     bool CanUseInstancing(InstancingHandler& handler) const override;
+    IMaterial* GetBatchingRoot() override;
     void Bind(BindParameters& params) override;
 
 protected:
@@ -139,6 +139,14 @@ VisjectExecutor::Value VisualScriptExecutor::eatBox(Node* caller, Box* box)
         return Value::Zero;
     }
 #endif
+    // Reuse the constant value folded during graph loading (skips the constant subtree execution)
+    if (box->FoldedValue != INVALID_INDEX)
+    {
+        const Graph* graph = GetCurrentGraph();
+        if (graph)
+            return graph->FoldedConstants[box->FoldedValue];
+    }
+
     const auto parentNode = box->GetParent<Node>();
 
     // Add to the calling stack
@@ -86,6 +86,13 @@ bool BinaryAsset::Init(AssetInitData& initData)
     }
 #endif
 
+    // Start loading the referenced assets early so their I/O runs in parallel instead of serially when references resolve during load
+    for (const Guid& reference : initData.References)
+    {
+        if (reference.IsValid() && reference != _header.ID)
+            Content::LoadAsync<Asset>(reference);
+    }
+
     return init(initData);
 }
 
@@ -287,7 +294,9 @@ bool BinaryAsset::LoadChunks(AssetChunksFlag chunks)
     if (chunks == 0)
         return false;
 
-    // Load all missing marked chunks
+    // Load all missing marked chunks in a single batch (reads get merged to reduce disk seeking)
+    FlaxChunk* toLoad[ASSET_FILE_DATA_CHUNKS];
+    int32 toLoadCount = 0;
     for (int32 i = 0; i < ASSET_FILE_DATA_CHUNKS; i++)
     {
         auto chunk = _header.Chunks[i];
@@ -296,10 +305,11 @@ bool BinaryAsset::LoadChunks(AssetChunksFlag chunks)
             && chunk->IsMissing()
             && chunk->ExistsInFile())
         {
-            if (Storage->LoadAssetChunk(chunk))
-                return true;
+            toLoad[toLoadCount++] = chunk;
         }
     }
+    if (toLoadCount != 0 && Storage->LoadAssetChunks(toLoad, toLoadCount))
+        return true;
 
     return false;
 }
@@ -316,6 +326,7 @@ bool BinaryAsset::SaveAsset(const StringView& path, AssetInitData& data, bool si
     data.Header = _header;
     data.Metadata.Link(Metadata);
     data.Dependencies = Dependencies;
+    GetReferences(data.References); // Cook the references manifest so loading can prefetch the dependent assets
     return SaveToAsset(path, data, silentMode);
 }
 
@@ -3,7 +3,9 @@
 #include "AssetsCache.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/DeleteMe.h"
+#include "Engine/Core/Math/Math.h"
 #include "Engine/Core/Types/TimeSpan.h"
+#include "Engine/Platform/File.h"
 #include "Engine/Platform/FileSystem.h"
 #include "Engine/Serialization/FileWriteStream.h"
 #include "Engine/Serialization/FileReadStream.h"
@@ -44,6 +46,17 @@ void AssetsCache::Init()
         return;
     }
 
+#if USE_EDITOR
+    // Try the persisted GUID index first (loads in a single pass without per-entry file validation)
+    _indexPath = Globals::ProjectCacheFolder / TEXT("AssetsCache.idx");
+    if (!LoadIndex())
+    {
+        const int32 indexLoadTimeInMs = static_cast<int32>((DateTime::Now() - loadStartTime).GetTotalMilliseconds());
+        LOG(Info, "Asset Cache loaded {0} entries from index in {1} ms", _registry.Count(), indexLoadTimeInMs);
+        return;
+    }
+#endif
+
     // Open file
     FileReadStream* stream = FileReadStream::Open(_path);
     DeleteMe<FileReadStream> deleteStream(stream);
@@ -167,6 +180,9 @@ bool AssetsCache::Save()
     if (Save(_path, _registry, _pathsMapping))
         return true;
 
+    // Refresh the GUID index (kept in sync with the registry which the file watcher patches incrementally)
+    SaveIndex();
+
     _isDirty = false;
 
 #endif
@@ -233,6 +249,149 @@ bool AssetsCache::Save(const StringView& path, const Registry& entries, const Pa
     return false;
 }
 
+#if USE_EDITOR
+
+namespace
+{
+    // Persisted asset GUID index file layout: header, open-addressing slots table (linear probing, power of two capacity), strings pool
+    struct AssetsIndexHeader
+    {
+        int32 MagicCode;
+        int32 Version;
+        int32 Capacity;
+        int32 Count;
+        uint64 CacheSize;
+        int64 CacheModified;
+        int32 StringPoolSize;
+        int32 NotUsed;
+    };
+
+    struct AssetsIndexSlot
+    {
+        Guid Key;
+        int32 TypeNameOffset;
+        int32 PathOffset;
+        int64 FileModified;
+    };
+
+    const int32 AssetsIndexMagicCode = 1481460294;
+
+    int32 WriteIndexString(Array<byte>& pool, const String& str)
+    {
+        const int32 offset = pool.Count();
+        const int32 length = str.Length();
+        pool.Add((const byte*)&length, sizeof(int32));
+        pool.Add((const byte*)str.Get(), length * sizeof(Char));
+        while (pool.Count() & 3)
+            pool.Add((byte)0);
+        return offset;
+    }
+}
+
+bool AssetsCache::LoadIndex()
+{
+    PROFILE_CPU();
+    if (!FileSystem::FileExists(_indexPath))
+        return true;
+
+    // Map the whole index file (single sequential read instead of per-entry file checks)
+    auto file = File::Open(_indexPath, FileMode::OpenExisting, FileAccess::Read, FileShare::Read);
+    if (file == nullptr)
+        return true;
+    DeleteMe<File> deleteFile(file);
+    const uint32 fileSize = file->GetSize();
+    const byte* view = (const byte*)file->Map();
+    if (view == nullptr || fileSize < sizeof(AssetsIndexHeader))
+        return true;
+    bool failed = true;
+    const auto& header = *(const AssetsIndexHeader*)view;
+    if (header.MagicCode == AssetsIndexMagicCode &&
+        header.Version == FLAXENGINE_VERSION_BUILD &&
+        header.Capacity > 0 &&
+        header.Count >= 0 &&
+        header.StringPoolSize >= 0 &&
+        fileSize == (uint32)(sizeof(AssetsIndexHeader) + header.Capacity * sizeof(AssetsIndexSlot) + header.StringPoolSize) &&
+        header.CacheSize == FileSystem::GetFileSize(_path) &&
+        header.CacheModified == FileSystem::GetFileLastEditTime(_path).Ticks)
+    {
+        const auto* slots = (const AssetsIndexSlot*)(view + sizeof(AssetsIndexHeader));
+        const byte* pool = (const byte*)(slots + header.Capacity);
+
+        ScopeLock lock(_locker);
+        _registry.Clear();
+        _registry.EnsureCapacity(header.Count);
+        _pathsMapping.Clear();
+        Entry e;
+        for (int32 i = 0; i < header.Capacity; i++)
+        {
+            const auto& slot = slots[i];
+            if (!slot.Key.IsValid())
+                continue;
+            e.Info.ID = slot.Key;
+            e.Info.TypeName = String((const Char*)(pool + slot.TypeNameOffset + sizeof(int32)), *(const int32*)(pool + slot.TypeNameOffset));
+            e.Info.Path = String((const Char*)(pool + slot.PathOffset + sizeof(int32)), *(const int32*)(pool + slot.PathOffset));
+            e.FileModified = DateTime(slot.FileModified);
+
+            // Entries are not validated here to keep the warmup free from per-asset I/O; FindAsset validates lazily and the content discovery scan covers anything stale
+            _registry.Add(e.Info.ID, e);
+        }
+        _isDirty = false;
+        failed = false;
+    }
+    file->Unmap((void*)view);
+    return failed;
+}
+
+void AssetsCache::SaveIndex()
+{
+    PROFILE_CPU();
+    ScopeLock lock(_locker);
+
+    // Build open-addressing table keyed by asset ID
+    const int32 count = _registry.Count();
+    const int32 capacity = Math::Max(Math::RoundUpToPowerOf2(count * 2), 64);
+    Array<AssetsIndexSlot> slots;
+    slots.Resize(capacity);
+    Platform::MemoryClear(slots.Get(), capacity * sizeof(AssetsIndexSlot));
+    Array<byte> pool;
+    for (auto i = _registry.Begin(); i.IsNotEnd(); ++i)
+    {
+        const auto& e = i->Value;
+        int32 slot = (int32)(GetHash(e.Info.ID) & (capacity - 1));
+        while (slots[slot].Key.IsValid())
+            slot = (slot + 1) & (capacity - 1);
+        auto& s = slots[slot];
+        s.Key = e.Info.ID;
+        s.TypeNameOffset = WriteIndexString(pool, e.Info.TypeName);
+        s.PathOffset = WriteIndexString(pool, e.Info.Path);
+        s.FileModified = e.FileModified.Ticks;
+    }
+
+    // Write index file (stamped with the source cache file state to detect staleness)
+    auto stream = FileWriteStream::Open(_indexPath);
+    if (stream == nullptr)
+    {
+        LOG(Warning, "Failed to save assets cache index to \'{0}\'.", _indexPath);
+        return;
+    }
+    AssetsIndexHeader header;
+    header.MagicCode = AssetsIndexMagicCode;
+    header.Version = FLAXENGINE_VERSION_BUILD;
+    header.Capacity = capacity;
+    header.Count = count;
+    header.CacheSize = FileSystem::GetFileSize(_path);
+    header.CacheModified = FileSystem::GetFileLastEditTime(_path).Ticks;
+    header.StringPoolSize = pool.Count();
+    header.NotUsed = 0;
+    stream->WriteBytes(&header, sizeof(header));
+    stream->WriteBytes(slots.Get(), capacity * sizeof(AssetsIndexSlot));
+    stream->WriteBytes(pool.Get(), pool.Count());
+    stream->Flush();
+    Delete(stream);
+}
+
+#endif
+
 const String& AssetsCache::GetEditorAssetPath(const Guid& id) const
 {
     ScopeLock lock(_locker);
@@ -79,6 +79,9 @@ private:
     Registry _registry;
     PathsMapping _pathsMapping;
     String _path;
+#if USE_EDITOR
+    String _indexPath;
+#endif
 
 public:
     /// <summary>
@@ -237,4 +240,10 @@ public:
     /// <param name="e">The asset entry.</param>
     /// <returns>True if is valid, otherwise false.</returns>
     bool IsEntryValid(Entry& e);
+
+#if USE_EDITOR
+private:
+    bool LoadIndex();
+    void SaveIndex();
+#endif
 };
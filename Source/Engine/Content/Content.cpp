@@ -55,7 +55,7 @@ namespace
 {
     // Assets
     CriticalSection AssetsLocker;
-    Dictionary<Guid, Asset*> Assets(2048);
+    FlatDictionary<Guid, Asset*> Assets(2048);
     CriticalSection LoadCallAssetsLocker;
     Array<Guid> LoadCallAssets(64);
     CriticalSection LoadedAssetsToInvokeLocker;
@@ -203,6 +203,16 @@ void ContentService::Dispose()
     Graphics::DisposeDevice();
 }
 
+ContentLoadTask::Priority Content::GetLoadPriority()
+{
+    return ContentLoadTask::ThreadPriority;
+}
+
+void Content::SetLoadPriority(ContentLoadTask::Priority priority)
+{
+    ContentLoadTask::ThreadPriority = priority;
+}
+
 AssetsCache* Content::GetRegistry()
 {
     return &Cache;
@@ -491,7 +501,7 @@ Array<Asset*> Content::GetAssets()
     return assets;
 }
 
-const Dictionary<Guid, Asset*>& Content::GetAssetsRaw()
+const FlatDictionary<Guid, Asset*>& Content::GetAssetsRaw()
 {
     AssetsLocker.Lock();
     AssetsLocker.Unlock();
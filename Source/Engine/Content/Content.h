@@ -3,9 +3,11 @@
 #pragma once
 
 #include "Engine/Scripting/ScriptingType.h"
+#include "Engine/Core/Collections/FlatDictionary.h"
 #include "AssetInfo.h"
 #include "Asset.h"
 #include "Config.h"
+#include "Loading/ContentLoadTask.h"
 
 class Engine;
 class FlaxFile;
@@ -46,6 +48,19 @@ public:
     /// </summary>
     static TimeSpan AssetsUnloadInterval;
 
+public:
+    /// <summary>
+    /// Gets the loading tasks priority class applied to the asset load requests started on the calling thread.
+    /// </summary>
+    /// <returns>The priority class.</returns>
+    static ContentLoadTask::Priority GetLoadPriority();
+
+    /// <summary>
+    /// Sets the loading tasks priority class applied to the asset load requests started on the calling thread (thread-local). Use Blocking for urgent requests (eg. on-screen texture data), Prefetch for speculative background loads (eg. distant world chunks) so they don't starve urgent work.
+    /// </summary>
+    /// <param name="priority">The priority class.</param>
+    static void SetLoadPriority(ContentLoadTask::Priority priority);
+
 public:
     /// <summary>
     /// Gets the assets registry.
@@ -128,7 +143,7 @@ public:
     /// Gets the raw dictionary of assets (loaded or during load).
     /// </summary>
     /// <returns>The collection of assets.</returns>
-    static const Dictionary<Guid, Asset*, HeapAllocation>& GetAssetsRaw();
+    static const FlatDictionary<Guid, Asset*>& GetAssetsRaw();
 
     /// <summary>
     /// Loads asset and holds it until it won't be referenced by any object. Returns null if asset is missing. Actual asset data loading is performed on a other thread in async.
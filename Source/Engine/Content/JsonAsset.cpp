@@ -12,8 +12,10 @@
 #include "FlaxEngine.Gen.h"
 #include "Cache/AssetsCache.h"
 #include "Engine/Core/Log.h"
+#include "Engine/Serialization/BinaryJson.h"
 #include "Engine/Serialization/JsonTools.h"
 #include "Engine/Serialization/JsonWriters.h"
+#include "Engine/Serialization/MemoryReadStream.h"
 #include "Engine/Content/Factories/JsonAssetFactory.h"
 #include "Engine/Core/Cache.h"
 #include "Engine/Debug/Exceptions/JsonParseException.h"
@@ -102,6 +104,7 @@ uint64 JsonAssetBase::GetMemoryUsage() const
     result += sizeof(JsonAssetBase) - sizeof(Asset);
     if (Data)
         result += Document.GetAllocator().Capacity();
+    result += _dataBuffer.Length();
     Locker.Unlock();
     return result;
 }
@@ -261,15 +264,32 @@ Asset::LoadResult JsonAssetBase::loadAsset()
     auto& data = chunk->Data;
 #endif
 
-    // Parse json document
+    // Parse json document (cooked content uses the binary document form that skips text parsing)
+    if (BinaryJson::IsBinaryJson(data.Get(), data.Length()))
     {
-        PROFILE_CPU_NAMED("Json.Parse");
-        Document.Parse(data.Get<char>(), data.Length());
+        PROFILE_CPU_NAMED("Json.ParseBinary");
+        MemoryReadStream stream(data.Get(), data.Length());
+        if (BinaryJson::Deserialize(stream, Document))
+        {
+            LOG(Warning, "Failed to load the binary json document. {0}", ToString());
+            return LoadResult::CannotLoadData;
+        }
     }
-    if (Document.HasParseError())
+    else
     {
-        Log::JsonParseException(Document.GetParseError(), Document.GetErrorOffset());
-        return LoadResult::CannotLoadData;
+        // Keep the data buffer alive and parse in-situ so the document strings reference it directly instead of allocating a copy of every string
+        _dataBuffer.Allocate(data.Length() + 1);
+        Platform::MemoryCopy(_dataBuffer.Get(), data.Get(), data.Length());
+        _dataBuffer.Get()[data.Length()] = 0;
+        {
+            PROFILE_CPU_NAMED("Json.Parse");
+            Document.ParseInsitu(_dataBuffer.Get<char>());
+        }
+        if (Document.HasParseError())
+        {
+            Log::JsonParseException(Document.GetParseError(), Document.GetErrorOffset());
+            return LoadResult::CannotLoadData;
+        }
     }
 
     // Gather information from the header
@@ -296,6 +316,7 @@ void JsonAssetBase::unload(bool isReloading)
 {
     ISerializable::SerializeDocument tmp;
     Document.Swap(tmp);
+    _dataBuffer.Release();
     Data = nullptr;
     DataTypeName.Clear();
     DataEngineBuild = 0;
@@ -4,6 +4,7 @@
 
 #include "Asset.h"
 #include "Engine/Core/ISerializable.h"
+#include "Engine/Core/Types/DataContainer.h"
 #include "Engine/Serialization/Json.h"
 
 /// <summary>
@@ -17,6 +18,9 @@ protected:
     String _path;
     bool _isVirtualDocument = false;
 
+    // The json data backing buffer kept alive for the in-situ parsed documents (strings reference it directly instead of allocating copies).
+    BytesContainer _dataBuffer;
+
 protected:
     /// <summary>
     /// Initializes a new instance of the <see cref="JsonAssetBase"/> class.
@@ -25,12 +25,27 @@ public:
     /// </summary>
     DECLARE_ENUM_5(Result, Ok, AssetLoadError, MissingReferences, LoadDataError, TaskFailed);
 
+    /// <summary>
+    /// Describes the task scheduling priority class. Lower classes are always serviced before higher ones.
+    /// </summary>
+    DECLARE_ENUM_3(Priority, Blocking, Visible, Prefetch);
+
+    /// <summary>
+    /// The priority class assigned to the tasks created on the current thread (see Content::SetLoadPriority).
+    /// </summary>
+    static THREADLOCAL Priority ThreadPriority;
+
 private:
     /// <summary>
     /// Task type
     /// </summary>
     Type _type;
 
+    /// <summary>
+    /// Task scheduling priority class
+    /// </summary>
+    Priority _priority;
+
 protected:
     /// <summary>
     /// Initializes a new instance of the <see cref="ContentLoadTask"/> class.
@@ -38,6 +53,7 @@ protected:
     /// <param name="type">The task type.</param>
     ContentLoadTask(const Type type)
         : _type(type)
+        , _priority(ThreadPriority)
     {
     }
 
@@ -50,6 +66,22 @@ public:
         return _type;
     }
 
+    /// <summary>
+    /// Gets a task scheduling priority class.
+    /// </summary>
+    FORCE_INLINE Priority GetPriority() const
+    {
+        return _priority;
+    }
+
+    /// <summary>
+    /// Sets a task scheduling priority class (before the task gets enqueued).
+    /// </summary>
+    FORCE_INLINE void SetPriority(const Priority priority)
+    {
+        _priority = priority;
+    }
+
 public:
     /// <summary>
     /// Checks if async task is loading given asset resource
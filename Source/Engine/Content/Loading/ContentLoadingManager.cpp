@@ -9,6 +9,7 @@
 #include "Engine/Platform/ConditionVariable.h"
 #include "Engine/Content/Config.h"
 #include "Engine/Engine/EngineService.h"
+#include "Engine/Profiler/ProfilerMemory.h"
 #include "Engine/Threading/Threading.h"
 #include "Engine/Threading/ConcurrentTaskQueue.h"
 #if USE_EDITOR && PLATFORM_WINDOWS
@@ -21,13 +22,17 @@ namespace ContentLoadingManagerImpl
     THREADLOCAL LoadingThread* ThisThread = nullptr;
     LoadingThread* MainThread = nullptr;
     Array<LoadingThread*> Threads;
-    ConcurrentTaskQueue<ContentLoadTask> Tasks;
+    ConcurrentTaskQueue<ContentLoadTask> Tasks[3]; // One queue per ContentLoadTask::Priority class
     ConditionVariable TasksSignal;
     CriticalSection TasksMutex;
+    volatile int64 PrefetchWorkers = 0;
+    int32 PrefetchWorkersLimit = 1;
 };
 
 using namespace ContentLoadingManagerImpl;
 
+THREADLOCAL ContentLoadTask::Priority ContentLoadTask::ThreadPriority = ContentLoadTask::Priority::Visible;
+
 class ContentLoadingManagerService : public EngineService
 {
 public:
@@ -124,9 +129,19 @@ int32 LoadingThread::Run()
 
     while (HasExitFlagClear())
     {
-        if (Tasks.try_dequeue(task))
+        // Service queues in the priority classes order (blocking and visible tasks first)
+        if (Tasks[0].try_dequeue(task) || Tasks[1].try_dequeue(task))
+        {
+            Run(task);
+        }
+        else if (Platform::AtomicRead(&PrefetchWorkers) < PrefetchWorkersLimit && Tasks[2].try_dequeue(task))
         {
+            // Limit the amount of threads doing prefetch so urgent requests always find a free worker quickly
+            Platform::InterlockedIncrement(&PrefetchWorkers);
             Run(task);
+            Platform::InterlockedDecrement(&PrefetchWorkers);
+            if (Tasks[2].Count() != 0)
+                TasksSignal.NotifyOne();
         }
         else
         {
@@ -154,7 +169,7 @@ LoadingThread* ContentLoadingManager::GetCurrentLoadThread()
 
 int32 ContentLoadingManager::GetTasksCount()
 {
-    return Tasks.Count();
+    return Tasks[0].Count() + Tasks[1].Count() + Tasks[2].Count();
 }
 
 bool ContentLoadingManagerService::Init()
@@ -166,6 +181,9 @@ bool ContentLoadingManagerService::Init()
     const int32 count = Math::Clamp(static_cast<int32>(LOADING_THREAD_PER_LOGICAL_CORE * (float)cpuInfo.LogicalProcessorCount), 1, 12);
     LOG(Info, "Creating {0} content loading threads...", count);
 
+    // Reserve a part of the pool for urgent requests (prefetch tasks can use up to half of the threads)
+    PrefetchWorkersLimit = Math::Max(1, count / 2);
+
     // Create loading threads
     MainThread = New<LoadingThread>();
     ThisThread = MainThread;
@@ -207,7 +225,8 @@ void ContentLoadingManagerService::Dispose()
     ThisThread = nullptr;
 
     // Cancel all remaining tasks (no chance to execute them)
-    Tasks.CancelAll();
+    for (auto& queue : Tasks)
+        queue.CancelAll();
 }
 
 String ContentLoadTask::ToString() const
@@ -217,12 +236,14 @@ String ContentLoadTask::ToString() const
 
 void ContentLoadTask::Enqueue()
 {
-    Tasks.Add(this);
+    Tasks[(int32)_priority].Add(this);
     TasksSignal.NotifyOne();
 }
 
 bool ContentLoadTask::Run()
 {
+    PROFILE_MEM_TAG("Content");
+
     // Perform an operation
     const auto result = run();
 
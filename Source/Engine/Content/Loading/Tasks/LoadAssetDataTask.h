@@ -57,29 +57,30 @@ protected:
         const StringView name(ref->GetPath());
 #endif
 
-        // Load chunks
+        // Collect chunks to load
+        FlaxChunk* chunks[ASSET_FILE_DATA_CHUNKS];
+        int32 chunksCount = 0;
         for (int32 i = 0; i < ASSET_FILE_DATA_CHUNKS; i++)
         {
             if (GET_CHUNK_FLAG(i) & _chunks)
             {
                 const auto chunk = ref->GetChunk(i);
-                if (chunk != nullptr)
-                {
-                    if (IsCancelRequested())
-                        return Result::Ok;
+                if (chunk != nullptr && !chunk->IsLoaded())
+                    chunks[chunksCount++] = chunk;
+            }
+        }
+        if (IsCancelRequested())
+            return Result::Ok;
 
-                    // Load it
+        // Load chunks (reads get sorted by the file offset and merged into large requests, decompression of separate chunks runs in parallel on job workers)
 #if TRACY_ENABLE
-                    ZoneScoped;
-                    ZoneName(*name, name.Length());
+        ZoneScoped;
+        ZoneName(*name, name.Length());
 #endif
-                    if (ref->Storage->LoadAssetChunk(chunk))
-                    {
-                        LOG(Warning, "Cannot load asset \'{0}\' chunk {1}.", ref->ToString(), i);
-                        return Result::LoadDataError;
-                    }
-                }
-            }
+        if (ref->Storage->LoadAssetChunks(chunks, chunksCount))
+        {
+            LOG(Warning, "Cannot load asset \'{0}\' chunks.", ref->ToString());
+            return Result::LoadDataError;
         }
 
         return Result::Ok;
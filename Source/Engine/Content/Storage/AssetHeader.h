@@ -5,9 +5,7 @@
 #include "Engine/Core/Types/Guid.h"
 #include "Engine/Core/Types/Pair.h"
 #include "Engine/Core/Types/String.h"
-#if USE_EDITOR
 #include "Engine/Core/Collections/Array.h"
-#endif
 #include "FlaxChunk.h"
 
 /// <summary>
@@ -139,6 +137,11 @@ struct FLAXENGINE_API AssetInitData
     /// </summary>
     BytesContainer CustomData;
 
+    /// <summary>
+    /// The identifiers of the assets referenced by this asset, cooked into the storage header on save. Used by the loading system to issue the dependent assets I/O in parallel instead of waiting for the references to resolve during load.
+    /// </summary>
+    Array<Guid> References;
+
 #if USE_EDITOR
     /// <summary>
     /// The asset metadata information. Stored in a Json format.
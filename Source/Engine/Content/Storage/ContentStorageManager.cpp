@@ -6,6 +6,7 @@
 #include "Engine/Core/Log.h"
 #include "Engine/Engine/Engine.h"
 #include "Engine/Engine/EngineService.h"
+#include "Engine/Platform/File.h"
 #include "Engine/Platform/FileSystem.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Threading/TaskGraph.h"
@@ -51,6 +52,23 @@ namespace
 ContentStorageService ContentStorageServiceInstance;
 
 TimeSpan ContentStorageManager::UnusedDataChunksLifetime = TimeSpan::FromSeconds(10);
+Array<byte> ContentStorageManager::CompressionDictionary;
+int32 ContentStorageManager::CompressionDictionaryMaxChunkSize = 64 * 1024;
+int32 ContentStorageManager::ReadMergeMaxGap = 64 * 1024;
+int32 ContentStorageManager::ReadAheadSize = 512 * 1024;
+
+bool ContentStorageManager::LoadCompressionDictionary(const StringView& path)
+{
+    Array<byte> data;
+    if (File::ReadAllBytes(path, data))
+    {
+        LOG(Error, "Failed to load compression dictionary from {0}.", path);
+        return true;
+    }
+    CompressionDictionary = MoveTemp(data);
+    LOG(Info, "Loaded compression dictionary from {0} ({1} bytes)", path, CompressionDictionary.Count());
+    return false;
+}
 
 FlaxStorageReference ContentStorageManager::GetStorage(const StringView& path, bool loadIt)
 {
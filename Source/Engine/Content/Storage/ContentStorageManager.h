@@ -19,6 +19,33 @@ public:
     /// </summary>
     static TimeSpan UnusedDataChunksLifetime;
 
+    /// <summary>
+    /// Optional pre-trained LZ4 compression dictionary shared by all storage containers. Improves compression ratio of small chunks (eg. tiny json/metadata chunks) that compress poorly alone. Empty to disable.
+    /// </summary>
+    static Array<byte> CompressionDictionary;
+
+    /// <summary>
+    /// The maximum size (in bytes) of a chunk to compress with the shared dictionary. Larger chunks compress well on their own.
+    /// </summary>
+    static int32 CompressionDictionaryMaxChunkSize;
+
+    /// <summary>
+    /// The maximum gap (in bytes) between two pending chunk reads that still gets merged into a single continuous read. On HDDs reading a small amount of waste between chunks is far cheaper than an extra seek.
+    /// </summary>
+    static int32 ReadMergeMaxGap;
+
+    /// <summary>
+    /// The read-ahead window size (in bytes) for batched chunk reads. Unloaded chunks located up to this distance past the requested data get loaded too so sequential asset streams hit memory instead of seeking back to the file. Prefetched chunks that stay unused get released after UnusedDataChunksLifetime. Use 0 to disable.
+    /// </summary>
+    static int32 ReadAheadSize;
+
+    /// <summary>
+    /// Loads the shared LZ4 compression dictionary from a file (replaces the current one).
+    /// </summary>
+    /// <param name="path">The dictionary file path.</param>
+    /// <returns>True if cannot load it, otherwise false.</returns>
+    static bool LoadCompressionDictionary(const StringView& path);
+
 public:
     /// <summary>
     /// Gets the assets data storage container.
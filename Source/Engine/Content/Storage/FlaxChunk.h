@@ -19,6 +19,11 @@ enum class FlaxChunkFlags
     /// Compress chunk data using LZ4 algorithm.
     /// </summary>
     CompressedLZ4 = 1,
+
+    /// <summary>
+    /// Chunk data was compressed with the shared compression dictionary (see ContentStorageManager::CompressionDictionary). Used together with CompressedLZ4.
+    /// </summary>
+    CompressedDict = 2,
 };
 
 DECLARE_ENUM_OPERATORS(FlaxChunkFlags);
@@ -5,13 +5,17 @@
 #include "FlaxPackage.h"
 #include "ContentStorageManager.h"
 #include "Engine/Core/Log.h"
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Core/Collections/Sorting.h"
 #include "Engine/Core/Types/TimeSpan.h"
 #include "Engine/Platform/File.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Serialization/FileWriteStream.h"
+#include "Engine/Serialization/MemoryWriteStream.h"
 #include "Engine/Content/Asset.h"
 #include "Engine/Content/Content.h"
 #include "Engine/Threading/Threading.h"
+#include "Engine/Threading/JobSystem.h"
 #if USE_EDITOR
 #include "Engine/Serialization/JsonWriter.h"
 #include "Engine/Serialization/JsonWriters.h"
@@ -274,6 +278,7 @@ bool FlaxStorage::Load()
     stream->ReadUint32(&version);
     switch (version)
     {
+    case 10:
     case 9:
     {
         // Custom storage data
@@ -660,7 +665,22 @@ bool FlaxStorage::LoadAssetChunk(FlaxChunk* chunk)
             // Decompress data
             PROFILE_CPU_NAMED("DecompressLZ4");
             chunk->Data.Allocate(originalSize);
-            const int32 res = LZ4_decompress_safe((const char*)tmpBuf.Get(), chunk->Data.Get<char>(), size, originalSize);
+            int32 res;
+            if (EnumHasAnyFlags(chunk->Flags, FlaxChunkFlags::CompressedDict))
+            {
+                const auto& dict = ContentStorageManager::CompressionDictionary;
+                if (dict.IsEmpty())
+                {
+                    UnlockChunks();
+                    LOG(Warning, "Cannot load chunk from {0}. It was compressed with a dictionary but none is loaded.", ToString());
+                    return true;
+                }
+                res = LZ4_decompress_safe_usingDict((const char*)tmpBuf.Get(), chunk->Data.Get<char>(), size, originalSize, (const char*)dict.Get(), dict.Count());
+            }
+            else
+            {
+                res = LZ4_decompress_safe((const char*)tmpBuf.Get(), chunk->Data.Get<char>(), size, originalSize);
+            }
             if (res <= 0)
             {
                 UnlockChunks();
@@ -672,7 +692,16 @@ bool FlaxStorage::LoadAssetChunk(FlaxChunk* chunk)
         else
         {
             // Raw data
-            chunk->Data.Read(stream, size);
+            const byte* view = MapFileView();
+            if (view)
+            {
+                // Alias the file mapping to skip the copy (chunk data is released before the view gets unmapped in CloseFileHandles)
+                chunk->Data.Link(view + chunk->LocationInFile.Address, size);
+            }
+            else
+            {
+                chunk->Data.Read(stream, size);
+            }
         }
         ASSERT(chunk->IsLoaded());
         chunk->RegisterUsage();
@@ -683,6 +712,188 @@ bool FlaxStorage::LoadAssetChunk(FlaxChunk* chunk)
     return failed;
 }
 
+static bool DecompressChunkData(FlaxChunk* chunk, const byte* data, uint32 size)
+{
+    PROFILE_CPU_NAMED("DecompressLZ4");
+
+    // Data layout: original size int32 followed by the LZ4 stream
+    const int32 originalSize = *(const int32*)data;
+    data += sizeof(int32);
+    size -= sizeof(int32);
+
+    // Decompress data
+    chunk->Data.Allocate(originalSize);
+    int32 res;
+    if (EnumHasAnyFlags(chunk->Flags, FlaxChunkFlags::CompressedDict))
+    {
+        const auto& dict = ContentStorageManager::CompressionDictionary;
+        if (dict.IsEmpty())
+            return true;
+        res = LZ4_decompress_safe_usingDict((const char*)data, chunk->Data.Get<char>(), size, originalSize, (const char*)dict.Get(), dict.Count());
+    }
+    else
+    {
+        res = LZ4_decompress_safe((const char*)data, chunk->Data.Get<char>(), size, originalSize);
+    }
+    if (res <= 0)
+        return true;
+    chunk->Data.SetLength(res);
+    return false;
+}
+
+bool FlaxStorage::LoadAssetChunks(FlaxChunk* const* chunks, int32 count)
+{
+    ASSERT(IsLoaded());
+
+    // Collect the pending reads (skip chunks already in memory)
+    Array<FlaxChunk*, InlinedAllocation<ASSET_FILE_DATA_CHUNKS>> pending;
+    for (int32 i = 0; i < count; i++)
+    {
+        FlaxChunk* chunk = chunks[i];
+        ASSERT(chunk != nullptr && _chunks.Contains(chunk));
+        if (chunk->IsLoaded())
+            continue;
+        if (chunk->ExistsInFile() == false)
+        {
+            LOG(Warning, "Cannot load chunk from {0}. It doesn't exist in storage.", ToString());
+            return true;
+        }
+        pending.Add(chunk);
+    }
+    if (pending.IsEmpty())
+        return false;
+    const uint32 readAhead = (uint32)Math::Max(ContentStorageManager::ReadAheadSize, 0);
+    if (pending.Count() == 1 && readAhead == 0)
+        return LoadAssetChunk(pending[0]);
+
+    LockChunks();
+
+    // When the file mapping is available there is no seeking nor read calls worth batching
+    if (MapFileView())
+    {
+        bool failed = false;
+        for (int32 i = 0; i < pending.Count(); i++)
+            failed |= LoadAssetChunk(pending[i]);
+        UnlockChunks();
+        return failed;
+    }
+
+    // Read-ahead: pull in other unloaded chunks of this container located just past the requested data, so sequential asset streams hit memory on the next request instead of seeking back here
+    const int32 requestedCount = pending.Count();
+    if (readAhead > 0)
+    {
+        for (int32 i = 0; i < _chunks.Count(); i++)
+        {
+            FlaxChunk* chunk = _chunks[i];
+            if (chunk->IsLoaded() || !chunk->ExistsInFile() || pending.Contains(chunk))
+                continue;
+            for (int32 j = 0; j < requestedCount; j++)
+            {
+                const auto& loc = pending[j]->LocationInFile;
+                if (chunk->LocationInFile.Address >= loc.Address && chunk->LocationInFile.Address + chunk->LocationInFile.Size <= loc.Address + loc.Size + readAhead)
+                {
+                    pending.Add(chunk);
+                    break;
+                }
+            }
+        }
+    }
+
+    // Sort the pending reads by the file offset so the disk head moves in a single direction
+    Sorting::QuickSort(pending.Get(), pending.Count(), +[](FlaxChunk* const& a, FlaxChunk* const& b)
+    {
+        return a->LocationInFile.Address < b->LocationInFile.Address;
+    });
+
+    // Open file
+    auto stream = OpenFile();
+    bool failed = stream == nullptr;
+    const uint32 maxGap = (uint32)Math::Max(ContentStorageManager::ReadMergeMaxGap, 0);
+    Array<byte> buffer;
+    volatile int64 anyFailed = 0;
+    for (int32 first = 0; first < pending.Count() && !failed;)
+    {
+        // Merge adjacent ranges into a single continuous read (reading a small gap through is cheaper than seeking over it)
+        const uint32 rangeStart = pending[first]->LocationInFile.Address;
+        uint32 rangeEnd = rangeStart + pending[first]->LocationInFile.Size;
+        int32 last = first;
+        while (last + 1 < pending.Count() && pending[last + 1]->LocationInFile.Address <= rangeEnd + maxGap)
+        {
+            last++;
+            rangeEnd = Math::Max(rangeEnd, pending[last]->LocationInFile.Address + pending[last]->LocationInFile.Size);
+        }
+
+        // Read the whole range with a single call
+        stream->SetPosition(rangeStart);
+        if (stream->HasError())
+        {
+            // Retry on stale file handles (see the matching workaround in LoadAssetChunk)
+            for (int retry = 0; retry < 5; retry++)
+            {
+                Platform::Sleep(50);
+                stream = OpenFile();
+                if (stream)
+                    stream->SetPosition(rangeStart);
+                if (stream && !stream->HasError())
+                    break;
+            }
+        }
+        if (stream == nullptr || stream->HasError())
+        {
+            failed = true;
+            break;
+        }
+        buffer.Resize((int32)(rangeEnd - rangeStart), false);
+        stream->ReadBytes(buffer.Get(), buffer.Count());
+        if (stream->HasError())
+        {
+            failed = true;
+            break;
+        }
+
+        // Slice the chunks data out of the merged read (decompression of separate chunks can run in parallel on job workers)
+        JobSystem::ParallelFor(first, last + 1, 1, [&](int32 begin, int32 end)
+        {
+            for (int32 i = begin; i < end; i++)
+            {
+                FlaxChunk* chunk = pending[i];
+                if (chunk->IsLoaded())
+                    continue;
+                const byte* data = buffer.Get() + (chunk->LocationInFile.Address - rangeStart);
+                const uint32 size = chunk->LocationInFile.Size;
+                if (EnumHasAnyFlags(chunk->Flags, FlaxChunkFlags::CompressedLZ4))
+                {
+                    if (DecompressChunkData(chunk, data, size))
+                    {
+                        LOG(Warning, "Cannot load chunk from {0}. Failed to decompress it data.", ToString());
+
+                        // Failure of a read-ahead chunk doesn't fail the actual request
+                        for (int32 j = 0; j < count; j++)
+                        {
+                            if (chunks[j] == chunk)
+                            {
+                                Platform::InterlockedIncrement(&anyFailed);
+                                break;
+                            }
+                        }
+                        continue;
+                    }
+                }
+                else
+                {
+                    chunk->Data.Copy(data, size);
+                }
+                chunk->RegisterUsage();
+            }
+        });
+        first = last + 1;
+    }
+
+    UnlockChunks();
+
+    return failed || Platform::AtomicRead(&anyFailed) != 0;
+}
+
 #if USE_EDITOR
 
 bool FlaxStorage::ChangeAssetID(Entry& e, const Guid& newId)
@@ -781,16 +992,11 @@ bool FlaxStorage::Create(const StringView& path, const AssetInitData* data, int3
     // Prepare to have access to the file
     auto storage = ContentStorageManager::EnsureAccess(path);
 
-    // Open file
-    auto stream = FileWriteStream::Open(path);
-    if (stream == nullptr)
-        return true;
-
-    // Create package
-    bool result = Create(stream, data, dataCount, customData);
-
-    // Close file
-    Delete(stream);
+    // Stage the whole package in memory, then flush it to disk with a single large write (building the package issues many small writes that perform poorly against the file directly)
+    MemoryWriteStream stream(1024 * 1024);
+    bool result = Create(&stream, data, dataCount, customData);
+    if (!result)
+        result = stream.SaveToFile(path);
 
     // Reload storage container (only if not in silent mode)
     if (storage && !silentMode)
@@ -848,31 +1054,56 @@ bool FlaxStorage::Create(WriteStream* stream, const AssetInitData* data, int32 d
                 + sizeof(int32)
                 + sizeof(int32)
 #endif
+                + sizeof(int32) + asset.References.Count() * sizeof(Guid) // References
                 + sizeof(int32); // Header Hash Code
     }
 
-    // Compress chunks
+    // Compress chunks in parallel over the Job System workers (package cooking compresses many chunks at once)
     Array<Array<byte>> compressedChunks;
     compressedChunks.Resize(chunksCount);
-    for (int32 i = 0; i < chunksCount; i++)
+    volatile int64 compressionFailed = 0;
+    JobSystem::ParallelFor(0, chunksCount, 1, [&chunks, &compressedChunks, &compressionFailed](int32 begin, int32 end)
     {
-        const FlaxChunk* chunk = chunks[i];
-        if (EnumHasAnyFlags(chunk->Flags, FlaxChunkFlags::CompressedLZ4))
+        for (int32 i = begin; i < end; i++)
         {
-            PROFILE_CPU_NAMED("CompressLZ4");
-            const int32 srcSize = chunk->Data.Length();
-            const int32 maxSize = LZ4_compressBound(srcSize);
-            auto& chunkCompressed = compressedChunks[i];
-            chunkCompressed.Resize(maxSize);
-            const int32 dstSize = LZ4_compress_default(chunk->Data.Get<char>(), (char*)chunkCompressed.Get(), srcSize, maxSize);
-            if (dstSize <= 0)
+            FlaxChunk* chunk = chunks[i];
+            if (EnumHasAnyFlags(chunk->Flags, FlaxChunkFlags::CompressedLZ4))
             {
-                chunkCompressed.Resize(0);
-                LOG(Warning, "Chunk data LZ4 compression failed.");
-                return true;
+                PROFILE_CPU_NAMED("CompressLZ4");
+                const int32 srcSize = chunk->Data.Length();
+                const int32 maxSize = LZ4_compressBound(srcSize);
+                auto& chunkCompressed = compressedChunks[i];
+                chunkCompressed.Resize(maxSize);
+                int32 dstSize;
+                const auto& dict = ContentStorageManager::CompressionDictionary;
+                if (dict.HasItems() && srcSize <= ContentStorageManager::CompressionDictionaryMaxChunkSize)
+                {
+                    // Small chunks compress poorly alone so use the shared dictionary
+                    LZ4_stream_t* lz4Stream = LZ4_createStream();
+                    LZ4_loadDict(lz4Stream, (const char*)dict.Get(), dict.Count());
+                    dstSize = LZ4_compress_fast_continue(lz4Stream, chunk->Data.Get<char>(), (char*)chunkCompressed.Get(), srcSize, maxSize, 1);
+                    LZ4_freeStream(lz4Stream);
+                    chunk->Flags |= FlaxChunkFlags::CompressedDict;
+                }
+                else
+                {
+                    dstSize = LZ4_compress_default(chunk->Data.Get<char>(), (char*)chunkCompressed.Get(), srcSize, maxSize);
+                    chunk->Flags &= ~FlaxChunkFlags::CompressedDict;
+                }
+                if (dstSize <= 0)
+                {
+                    chunkCompressed.Resize(0);
+                    Platform::InterlockedIncrement(&compressionFailed);
+                    continue;
+                }
+                chunkCompressed.Resize(dstSize);
             }
-            chunkCompressed.Resize(dstSize);
         }
+    });
+    if (Platform::AtomicRead(&compressionFailed) != 0)
+    {
+        LOG(Warning, "Chunk data LZ4 compression failed.");
+        return true;
     }
 
     // Initialize chunks locations in file
@@ -889,7 +1120,7 @@ bool FlaxStorage::Create(WriteStream* stream, const AssetInitData* data, int32 d
     // Write header
     Header mainHeader;
     mainHeader.MagicCode = MagicCode;
-    mainHeader.Version = 9;
+    mainHeader.Version = 10;
     if (customData)
         mainHeader.CustomData = *customData;
     else
@@ -956,6 +1187,10 @@ bool FlaxStorage::Create(WriteStream* stream, const AssetInitData* data, int32 d
         // Asset Dependencies
         stream->WriteInt32(header.Dependencies.Count());
         stream->WriteBytes(header.Dependencies.Get(), header.Dependencies.Count() * sizeof(Pair<Guid, DateTime>));
+
+        // Asset References
+        stream->WriteInt32(header.References.Count());
+        stream->WriteBytes(header.References.Get(), header.References.Count() * sizeof(Guid));
     }
 
 #if ASSETS_LOADING_EXTRA_VERIFICATION
@@ -1026,6 +1261,7 @@ bool FlaxStorage::LoadAssetHeader(const Entry& e, AssetInitData& data)
     // Switch version
     switch (_version)
     {
+    case 10:
     case 9:
     {
         // ID
@@ -1083,6 +1319,24 @@ bool FlaxStorage::LoadAssetHeader(const Entry& e, AssetInitData& data)
         data.Dependencies.Resize(dependencies);
         stream->ReadBytes(data.Dependencies.Get(), dependencies * sizeof(Pair<Guid, DateTime>));
 #endif
+
+        // Asset References
+        if (_version >= 10)
+        {
+#if !USE_EDITOR
+            // Skip the editor-only metadata and dependencies
+            int32 metadataSize;
+            stream->ReadInt32(&metadataSize);
+            stream->SetPosition(stream->GetPosition() + metadataSize);
+            int32 dependencies;
+            stream->ReadInt32(&dependencies);
+            stream->SetPosition(stream->GetPosition() + dependencies * sizeof(Pair<Guid, DateTime>));
+#endif
+            int32 references;
+            stream->ReadInt32(&references);
+            data.References.Resize(references);
+            stream->ReadBytes(data.References.Get(), references * sizeof(Guid));
+        }
         break;
     }
     case 8:
@@ -1296,6 +1550,33 @@ FileReadStream* FlaxStorage::OpenFile()
     return stream;
 }
 
+const byte* FlaxStorage::MapFileView()
+{
+    // Map only read-only containers so file modifications (eg. Save or ChangeAssetID) never race with an active view
+    if (_mapView)
+        return (const byte*)_mapView;
+    if (_mapFailed || AllowDataModifications())
+        return nullptr;
+    ScopeLock lock(_loadLocker);
+    if (_mapView)
+        return (const byte*)_mapView;
+    auto file = File::Open(_path, FileMode::OpenExisting, FileAccess::Read, FileShare::Read);
+    if (file)
+    {
+        _mapView = file->Map();
+        if (_mapView)
+        {
+            _mapFile = file;
+            return (const byte*)_mapView;
+        }
+        Delete(file);
+    }
+
+    // Mapping is unsupported or failed so fallback to stream reads (don't retry every chunk load)
+    _mapFailed = true;
+    return nullptr;
+}
+
 void FlaxStorage::CloseFileHandles()
 {
     // Note: this is usually called by the content manager when this file is not used or on exit
@@ -1323,6 +1604,21 @@ void FlaxStorage::CloseFileHandles()
     ASSERT(_chunksLock == 0);
 
     _file.DeleteAll();
+
+    // Release the file mapping (unload any chunks that alias the mapped view first)
+    if (_mapView)
+    {
+        for (FlaxChunk* chunk : _chunks)
+        {
+            if (chunk->IsLoaded() && !chunk->Data.IsAllocated())
+                chunk->Unload();
+        }
+        _mapFile->Unmap(_mapView);
+        _mapView = nullptr;
+        Delete(_mapFile);
+        _mapFile = nullptr;
+        _mapFailed = false;
+    }
 }
 
 void FlaxStorage::Dispose()
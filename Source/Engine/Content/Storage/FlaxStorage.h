@@ -15,6 +15,7 @@
 #include "../AssetInfo.h"
 
 class ContentStorageManager;
+class FileBase;
 struct FlaxStorageReference;
 
 /// <summary>
@@ -96,6 +97,9 @@ protected:
     // Storage
     ThreadLocalObject<FileReadStream> _file;
     Array<FlaxChunk*> _chunks;
+    FileBase* _mapFile = nullptr;
+    void* _mapView = nullptr;
+    bool _mapFailed = false;
 
     // Metadata
     uint32 _version;
@@ -384,6 +388,14 @@ public:
     /// <returns>True if cannot load data, otherwise false</returns>
     bool LoadAssetChunk(FlaxChunk* chunk);
 
+    /// <summary>
+    /// Loads a set of asset chunks in a single pass. Pending reads get sorted by the file offset and nearby ranges are merged into single continuous reads to minimize disk seeking, with optional read-ahead over other unloaded chunks of this container (see ContentStorageManager::ReadMergeMaxGap and ContentStorageManager::ReadAheadSize). Chunks decompression runs in parallel on the job system workers.
+    /// </summary>
+    /// <param name="chunks">The chunks to load.</param>
+    /// <param name="count">The amount of chunks to load.</param>
+    /// <returns>True if cannot load data, otherwise false</returns>
+    bool LoadAssetChunks(FlaxChunk* const* chunks, int32 count);
+
 #if USE_EDITOR
 
     /// <summary>
@@ -487,5 +499,6 @@ protected:
     void AddChunk(FlaxChunk* chunk);
     virtual void AddEntry(Entry& e) = 0;
     FileReadStream* OpenFile();
+    const byte* MapFileView();
     virtual bool GetEntry(const Guid& id, Entry& e) = 0;
 };
@@ -5,12 +5,25 @@
 #if COMPILE_WITH_ASSETS_EXPORTER
 
 #include "Engine/Core/Log.h"
+#include "Engine/Core/Formatting.h"
 #include "Engine/Content/Assets/Model.h"
 #include "Engine/Content/Assets/SkinnedModel.h"
 #include "Engine/Serialization/FileWriteStream.h"
 #include "Engine/Serialization/MemoryReadStream.h"
 #include "Engine/Core/DeleteMe.h"
 
+namespace
+{
+    // Formats a single line into the reused buffer and streams it to the output file. Skips the temporary heap string per vertex/face which dominates the exporter working-set on huge models (the file stream itself writes through a small fixed buffer).
+    template<typename... Args>
+    FORCE_INLINE void WriteLine(FileWriteStream* output, fmt_flax::memory_buffer_ansi& buffer, const char* format, const Args&... args)
+    {
+        buffer.clear();
+        fmt_flax::format(buffer, format, args...);
+        output->WriteText(buffer.data(), (int32)buffer.size());
+    }
+}
+
 ExportAssetResult AssetExporters::ExportModel(ExportAssetContext& context)
 {
     // Prepare
@@ -35,6 +48,7 @@ ExportAssetResult AssetExporters::ExportModel(ExportAssetContext& context)
 
     const auto name = StringUtils::GetFileNameWithoutExtension(asset->GetPath()).ToStringAnsi();
     output->WriteText(StringAnsi::Format("# Exported model {0}\n", name.Get()));
+    fmt_flax::memory_buffer_ansi lineBuffer;
 
     // Extract all meshes
     const auto& lod = asset->LODs[lodIndex];
@@ -68,7 +82,7 @@ ExportAssetResult AssetExporters::ExportModel(ExportAssetContext& context)
         for (uint32 i = 0; i < vertices; i++)
         {
             auto v = vb0[i].Position;
-            output->WriteText(StringAnsi::Format("v {0} {1} {2}\n", v.X, v.Y, v.Z));
+            WriteLine(output, lineBuffer, "v {0} {1} {2}\n", v.X, v.Y, v.Z);
         }
 
         output->WriteChar('\n');
@@ -76,7 +90,7 @@ ExportAssetResult AssetExporters::ExportModel(ExportAssetContext& context)
         for (uint32 i = 0; i < vertices; i++)
         {
             auto v = vb1[i].TexCoord.ToFloat2();
-            output->WriteText(StringAnsi::Format("vt {0} {1}\n", v.X, v.Y));
+            WriteLine(output, lineBuffer, "vt {0} {1}\n", v.X, v.Y);
         }
 
         output->WriteChar('\n');
@@ -84,7 +98,7 @@ ExportAssetResult AssetExporters::ExportModel(ExportAssetContext& context)
         for (uint32 i = 0; i < vertices; i++)
         {
             auto v = vb1[i].Normal.ToFloat3() * 2.0f - 1.0f;
-            output->WriteText(StringAnsi::Format("vn {0} {1} {2}\n", v.X, v.Y, v.Z));
+            WriteLine(output, lineBuffer, "vn {0} {1} {2}\n", v.X, v.Y, v.Z);
         }
 
         output->WriteChar('\n');
@@ -97,7 +111,7 @@ ExportAssetResult AssetExporters::ExportModel(ExportAssetContext& context)
                 auto i0 = vertexStart + *t++;
                 auto i1 = vertexStart + *t++;
                 auto i2 = vertexStart + *t++;
-                output->WriteText(StringAnsi::Format("f {0}/{0}/{0} {1}/{1}/{1} {2}/{2}/{2}\n", i0, i1, i2));
+                WriteLine(output, lineBuffer, "f {0}/{0}/{0} {1}/{1}/{1} {2}/{2}/{2}\n", i0, i1, i2);
             }
         }
         else
@@ -108,7 +122,7 @@ ExportAssetResult AssetExporters::ExportModel(ExportAssetContext& context)
                 auto i0 = vertexStart + *t++;
                 auto i1 = vertexStart + *t++;
                 auto i2 = vertexStart + *t++;
-                output->WriteText(StringAnsi::Format("f {0}/{0}/{0} {1}/{1}/{1} {2}/{2}/{2}\n", i0, i1, i2));
+                WriteLine(output, lineBuffer, "f {0}/{0}/{0} {1}/{1}/{1} {2}/{2}/{2}\n", i0, i1, i2);
             }
         }
 
@@ -147,6 +161,7 @@ ExportAssetResult AssetExporters::ExportSkinnedModel(ExportAssetContext& context
 
     const auto name = StringUtils::GetFileNameWithoutExtension(asset->GetPath()).ToStringAnsi();
     output->WriteText(StringAnsi::Format("# Exported model {0}\n", name.Get()));
+    fmt_flax::memory_buffer_ansi lineBuffer;
 
     // Extract all meshes
     const auto& lod = asset->LODs[lodIndex];
@@ -173,7 +188,7 @@ ExportAssetResult AssetExporters::ExportSkinnedModel(ExportAssetContext& context
         for (uint32 i = 0; i < vertices; i++)
         {
             auto v = vb0[i].Position;
-            output->WriteText(StringAnsi::Format("v {0} {1} {2}\n", v.X, v.Y, v.Z));
+            WriteLine(output, lineBuffer, "v {0} {1} {2}\n", v.X, v.Y, v.Z);
         }
 
         output->WriteChar('\n');
@@ -181,7 +196,7 @@ ExportAssetResult AssetExporters::ExportSkinnedModel(ExportAssetContext& context
         for (uint32 i = 0; i < vertices; i++)
         {
             auto v = vb0[i].TexCoord.ToFloat2();
-            output->WriteText(StringAnsi::Format("vt {0} {1}\n", v.X, v.Y));
+            WriteLine(output, lineBuffer, "vt {0} {1}\n", v.X, v.Y);
         }
 
         output->WriteChar('\n');
@@ -189,7 +204,7 @@ ExportAssetResult AssetExporters::ExportSkinnedModel(ExportAssetContext& context
         for (uint32 i = 0; i < vertices; i++)
         {
             auto v = vb0[i].Normal.ToFloat3() * 2.0f - 1.0f;
-            output->WriteText(StringAnsi::Format("vn {0} {1} {2}\n", v.X, v.Y, v.Z));
+            WriteLine(output, lineBuffer, "vn {0} {1} {2}\n", v.X, v.Y, v.Z);
         }
 
         output->WriteChar('\n');
@@ -202,7 +217,7 @@ ExportAssetResult AssetExporters::ExportSkinnedModel(ExportAssetContext& context
                 auto i0 = vertexStart + *t++;
                 auto i1 = vertexStart + *t++;
                 auto i2 = vertexStart + *t++;
-                output->WriteText(StringAnsi::Format("f {0}/{0}/{0} {1}/{1}/{1} {2}/{2}/{2}\n", i0, i1, i2));
+                WriteLine(output, lineBuffer, "f {0}/{0}/{0} {1}/{1}/{1} {2}/{2}/{2}\n", i0, i1, i2);
             }
         }
         else
@@ -213,7 +228,7 @@ ExportAssetResult AssetExporters::ExportSkinnedModel(ExportAssetContext& context
                 auto i0 = vertexStart + *t++;
                 auto i1 = vertexStart + *t++;
                 auto i2 = vertexStart + *t++;
-                output->WriteText(StringAnsi::Format("f {0}/{0}/{0} {1}/{1}/{1} {2}/{2}/{2}\n", i0, i1, i2));
+                WriteLine(output, lineBuffer, "f {0}/{0}/{0} {1}/{1}/{1} {2}/{2}/{2}\n", i0, i1, i2);
             }
         }
 
@@ -5,6 +5,9 @@
 #include "Engine/Platform/Platform.h"
 #include "Engine/Core/Memory/Allocation.h"
 #include "Engine/Core/Math/Math.h"
+#if _MSC_VER
+#include <intrin.h>
+#endif
 
 /// <summary>
 /// Template for dynamic array with variable capacity that stores the bit values.
@@ -17,11 +20,48 @@ public:
     typedef uint64 ItemType;
     typedef typename AllocationType::template Data<ItemType> AllocationData;
 
+    // The amount of bits packed into a single storage item (word).
+    static const int32 BitsPerItem = sizeof(ItemType) * 8;
+
 private:
     int32 _count;
     int32 _capacity;
     AllocationData _allocation;
 
+    FORCE_INLINE static int32 ToItemCount(int32 bitsCount)
+    {
+        return (bitsCount + BitsPerItem - 1) / BitsPerItem;
+    }
+
+    // Returns the amount of set bits in the storage word (population count).
+    static int32 CountItemBits(ItemType x)
+    {
+#ifdef __GNUC__
+        return __builtin_popcountll(x);
+#elif _MSC_VER && PLATFORM_SIMD_SSE4_2 && PLATFORM_64BITS
+        return (int32)__popcnt64(x);
+#else
+        x = x - ((x >> 1) & 0x5555555555555555ull);
+        x = (x & 0x3333333333333333ull) + ((x >> 2) & 0x3333333333333333ull);
+        x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+        return (int32)((x * 0x0101010101010101ull) >> 56);
+#endif
+    }
+
+    // Returns the index of the lowest set bit in the storage word. Input value cannot be zero.
+    static int32 CountItemTrailingZeros(ItemType x)
+    {
+#ifdef __GNUC__
+        return __builtin_ctzll(x);
+#elif _MSC_VER && PLATFORM_64BITS
+        unsigned long index;
+        _BitScanForward64(&index, x);
+        return (int32)index;
+#else
+        return CountItemBits((x & (~x + 1)) - 1);
+#endif
+    }
+
 public:
     /// <summary>
     /// Initializes a new instance of the <see cref="BitArray"/> class.
@@ -41,7 +81,7 @@ public:
         , _capacity(capacity)
     {
         if (capacity > 0)
-            _allocation.Allocate(Math::Max<ItemType>(capacity / sizeof(ItemType), 1));
+            _allocation.Allocate(Math::Max(ToItemCount(capacity), 1));
     }
 
     /// <summary>
@@ -53,7 +93,7 @@ public:
         _count = _capacity = other.Count();
         if (_capacity > 0)
         {
-            const uint64 itemsCapacity = Math::Max<ItemType>(_capacity / sizeof(ItemType), 1);
+            const int32 itemsCapacity = Math::Max(ToItemCount(_capacity), 1);
             _allocation.Allocate(itemsCapacity);
             Platform::MemoryCopy(Get(), other.Get(), itemsCapacity * sizeof(ItemType));
         }
@@ -69,7 +109,7 @@ public:
         _count = _capacity = other.Count();
         if (_capacity > 0)
         {
-            const uint64 itemsCapacity = Math::Max<ItemType>(_capacity / sizeof(ItemType), 1);
+            const int32 itemsCapacity = Math::Max(ToItemCount(_capacity), 1);
             _allocation.Allocate(itemsCapacity);
             Platform::MemoryCopy(Get(), other.Get(), itemsCapacity * sizeof(ItemType));
         }
@@ -101,11 +141,11 @@ public:
             {
                 _allocation.Free();
                 _capacity = other._count;
-                const uint64 itemsCapacity = Math::Max<ItemType>(_capacity / sizeof(ItemType), 1);
-                _allocation.Allocate(itemsCapacity);
-                Platform::MemoryCopy(Get(), other.Get(), itemsCapacity * sizeof(ItemType));
+                _allocation.Allocate(Math::Max(ToItemCount(_capacity), 1));
             }
             _count = other._count;
+            if (_count > 0)
+                Platform::MemoryCopy(Get(), other.Get(), ToItemCount(_count) * sizeof(ItemType));
         }
         return *this;
     }
@@ -203,8 +243,8 @@ public:
     bool Get(int32 index) const
     {
         ASSERT(index >= 0 && index < _count);
-        const ItemType offset = index / sizeof(ItemType);
-        const ItemType bitMask = (ItemType)(int32)(1 << (index & ((int32)sizeof(ItemType) - 1)));
+        const int32 offset = index / BitsPerItem;
+        const ItemType bitMask = (ItemType)1 << (index & (BitsPerItem - 1));
         const ItemType item = ((ItemType*)_allocation.Get())[offset];
         return (item & bitMask) != 0;
     }
@@ -217,8 +257,8 @@ public:
     void Set(int32 index, bool value) const
     {
         ASSERT(index >= 0 && index < _count);
-        const ItemType offset = index / sizeof(ItemType);
-        const ItemType bitMask = (ItemType)(int32)(1 << (index & ((int32)sizeof(ItemType) - 1)));
+        const int32 offset = index / BitsPerItem;
+        const ItemType bitMask = (ItemType)1 << (index & (BitsPerItem - 1));
         ItemType& item = ((ItemType*)_allocation.Get())[offset];
         if (value)
             item |= bitMask;
@@ -246,7 +286,7 @@ public:
             return;
         ASSERT(capacity >= 0);
         const int32 count = preserveContents ? (_count < capacity ? _count : capacity) : 0;
-        _allocation.Relocate(Math::Max<ItemType>(capacity / sizeof(ItemType), 1), _count / sizeof(ItemType), count / sizeof(ItemType));
+        _allocation.Relocate(Math::Max(ToItemCount(capacity), 1), ToItemCount(_count), ToItemCount(count));
         _capacity = capacity;
         _count = count;
     }
@@ -272,7 +312,7 @@ public:
     {
         if (_capacity < minCapacity)
         {
-            const int32 capacity = _allocation.CalculateCapacityGrow(Math::Max<int32>(_capacity / sizeof(ItemType), 1), minCapacity);
+            const int32 capacity = _allocation.CalculateCapacityGrow(_capacity, minCapacity);
             SetCapacity(capacity, preserveContents);
         }
     }
@@ -284,7 +324,7 @@ public:
     void SetAll(const bool value)
     {
         if (_count != 0)
-            Platform::MemorySet(_allocation.Get(), Math::Max<ItemType>(_count / sizeof(ItemType), 1), value ? MAX_int32 : 0);
+            Platform::MemorySet(_allocation.Get(), ToItemCount(_count) * sizeof(ItemType), value ? MAX_int32 : 0);
     }
 
     /// <summary>
@@ -316,7 +356,7 @@ public:
     /// <param name="other">The other collection to add.</param>
     void Add(const BitArray& other)
     {
-        EnsureCapacity(_count, other.Count());
+        EnsureCapacity(_count + other.Count());
         for (int32 i = 0; i < other.Count(); i++)
             Add(other[i]);
     }
@@ -333,19 +373,192 @@ public:
     }
 
 public:
+    /// <summary>
+    /// Performs the bitwise AND operation with the other collection (word-level) and stores the result in this collection. Both collections must have the same size.
+    /// </summary>
+    /// <param name="other">The other collection.</param>
     template<typename OtherAllocationType = AllocationType>
-    bool operator==(const BitArray<OtherAllocationType>& other) const
+    void And(const BitArray<OtherAllocationType>& other)
+    {
+        ASSERT(_count == other.Count());
+        ItemType* data = Get();
+        const ItemType* otherData = other.Get();
+        const int32 itemsCount = ToItemCount(_count);
+        for (int32 i = 0; i < itemsCount; i++)
+            data[i] &= otherData[i];
+    }
+
+    /// <summary>
+    /// Performs the bitwise OR operation with the other collection (word-level) and stores the result in this collection. Both collections must have the same size.
+    /// </summary>
+    /// <param name="other">The other collection.</param>
+    template<typename OtherAllocationType = AllocationType>
+    void Or(const BitArray<OtherAllocationType>& other)
+    {
+        ASSERT(_count == other.Count());
+        ItemType* data = Get();
+        const ItemType* otherData = other.Get();
+        const int32 itemsCount = ToItemCount(_count);
+        for (int32 i = 0; i < itemsCount; i++)
+            data[i] |= otherData[i];
+    }
+
+    /// <summary>
+    /// Performs the bitwise AND NOT operation with the other collection (word-level) and stores the result in this collection (clears the bits that are set in the other collection). Both collections must have the same size.
+    /// </summary>
+    /// <param name="other">The other collection.</param>
+    template<typename OtherAllocationType = AllocationType>
+    void AndNot(const BitArray<OtherAllocationType>& other)
+    {
+        ASSERT(_count == other.Count());
+        ItemType* data = Get();
+        const ItemType* otherData = other.Get();
+        const int32 itemsCount = ToItemCount(_count);
+        for (int32 i = 0; i < itemsCount; i++)
+            data[i] &= ~otherData[i];
+    }
+
+    /// <summary>
+    /// Counts the amount of the bits set to one in the collection (population count).
+    /// </summary>
+    /// <returns>The amount of the set bits.</returns>
+    int32 CountBits() const
+    {
+        const ItemType* data = Get();
+        const int32 fullItems = _count / BitsPerItem;
+        int32 result = 0;
+        for (int32 i = 0; i < fullItems; i++)
+            result += CountItemBits(data[i]);
+        const int32 remaining = _count & (BitsPerItem - 1);
+        if (remaining != 0)
+            result += CountItemBits(data[fullItems] & (((ItemType)1 << remaining) - 1));
+        return result;
+    }
+
+    /// <summary>
+    /// Finds the index of the first bit set to zero in the collection.
+    /// </summary>
+    /// <returns>The index of the first zero bit, or -1 if all bits are set.</returns>
+    int32 FindFirstZero() const
+    {
+        const ItemType* data = Get();
+        const int32 itemsCount = ToItemCount(_count);
+        for (int32 i = 0; i < itemsCount; i++)
+        {
+            const ItemType inverted = ~data[i];
+            if (inverted != 0)
+            {
+                const int32 index = i * BitsPerItem + CountItemTrailingZeros(inverted);
+                return index < _count ? index : -1;
+            }
+        }
+        return -1;
+    }
+
+    /// <summary>
+    /// Finds the index of the first bit set to one at or after the given index.
+    /// </summary>
+    /// <param name="startIndex">The index to start the search at.</param>
+    /// <returns>The index of the set bit, or the collection size if there is no set bit remaining.</returns>
+    int32 FindNextSetBit(int32 startIndex) const
     {
-        if (_count == other.Count())
+        if (startIndex >= _count)
+            return _count;
+        const ItemType* data = Get();
+        const int32 itemsCount = ToItemCount(_count);
+        int32 itemIndex = startIndex / BitsPerItem;
+        ItemType item = data[itemIndex] & ~((((ItemType)1) << (startIndex & (BitsPerItem - 1))) - 1);
+        while (true)
         {
-            for (int32 i = 0; i < _count; i++)
+            if (item != 0)
             {
-                if (!(Get(i) == other.Get(i)))
-                    return false;
+                const int32 index = itemIndex * BitsPerItem + CountItemTrailingZeros(item);
+                return index < _count ? index : _count;
             }
-            return true;
+            if (++itemIndex >= itemsCount)
+                return _count;
+            item = data[itemIndex];
+        }
+    }
+
+public:
+    /// <summary>
+    /// Iterator over the bits set to one in the bit array. Dereferences to the bit index.
+    /// </summary>
+    struct SetBitsIterator
+    {
+        friend BitArray;
+    private:
+        const BitArray* _collection;
+        int32 _index;
+
+        SetBitsIterator(const BitArray* collection, int32 index)
+            : _collection(collection)
+            , _index(index)
+        {
+        }
+
+    public:
+        FORCE_INLINE int32 operator*() const
+        {
+            return _index;
+        }
+
+        FORCE_INLINE bool operator==(const SetBitsIterator& v) const
+        {
+            return _index == v._index && _collection == v._collection;
+        }
+
+        FORCE_INLINE bool operator!=(const SetBitsIterator& v) const
+        {
+            return _index != v._index || _collection != v._collection;
+        }
+
+        SetBitsIterator& operator++()
+        {
+            _index = _collection->FindNextSetBit(_index + 1);
+            return *this;
+        }
+    };
+
+    /// <summary>
+    /// Gets the iterator pointing at the first bit set to one in the collection (or the end if none is set).
+    /// </summary>
+    SetBitsIterator SetBitsBegin() const
+    {
+        return SetBitsIterator(this, FindNextSetBit(0));
+    }
+
+    /// <summary>
+    /// Gets the iterator pointing at the end of the set bits sequence.
+    /// </summary>
+    SetBitsIterator SetBitsEnd() const
+    {
+        return SetBitsIterator(this, _count);
+    }
+
+public:
+    template<typename OtherAllocationType = AllocationType>
+    bool operator==(const BitArray<OtherAllocationType>& other) const
+    {
+        if (_count != other.Count())
+            return false;
+        const ItemType* data = Get();
+        const ItemType* otherData = other.Get();
+        const int32 fullItems = _count / BitsPerItem;
+        for (int32 i = 0; i < fullItems; i++)
+        {
+            if (data[i] != otherData[i])
+                return false;
+        }
+        const int32 remaining = _count & (BitsPerItem - 1);
+        if (remaining != 0)
+        {
+            const ItemType mask = (((ItemType)1) << remaining) - 1;
+            if ((data[fullItems] & mask) != (otherData[fullItems] & mask))
+                return false;
         }
-        return false;
+        return true;
     }
 
     template<typename OtherAllocationType = AllocationType>
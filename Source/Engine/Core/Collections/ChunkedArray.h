@@ -4,6 +4,8 @@
 
 #include "../Collections/Array.h"
 #include "Engine/Core/Math/Math.h"
+#include "Engine/Core/Types/Span.h"
+#include "Engine/Threading/JobSystem.h"
 
 /// <summary>
 /// Template for dynamic array with variable capacity that uses fixed size memory chunks for data storage rather than linear allocation.
@@ -468,6 +470,56 @@ public:
         return INVALID_INDEX;
     }
 
+public:
+    /// <summary>
+    /// Gets the amount of the memory chunks allocated by the collection.
+    /// </summary>
+    FORCE_INLINE int32 ChunksCount() const
+    {
+        return _chunks.Count();
+    }
+
+    /// <summary>
+    /// Gets the span of the contiguous elements stored in the given memory chunk.
+    /// </summary>
+    /// <param name="chunkIndex">The zero-based index of the memory chunk.</param>
+    /// <returns>The span of the elements within that chunk.</returns>
+    Span<T> GetChunk(int32 chunkIndex) const
+    {
+        Chunk* chunk = _chunks[chunkIndex];
+        return Span<T>(chunk->Get(), chunk->Count());
+    }
+
+    /// <summary>
+    /// Visits all the elements in the collection chunk-by-chunk. The function gets a span of contiguous elements which avoids the per-element chunk indirection cost of the iterators.
+    /// </summary>
+    /// <param name="fn">The function to call for every non-empty chunk. Argument is the span of the elements to process.</param>
+    template<typename Fn>
+    void Visit(Fn fn) const
+    {
+        for (int32 chunkIndex = 0; chunkIndex < _chunks.Count(); chunkIndex++)
+        {
+            Chunk* chunk = _chunks[chunkIndex];
+            if (chunk->HasItems())
+                fn(Span<T>(chunk->Get(), chunk->Count()));
+        }
+    }
+
+    /// <summary>
+    /// Visits all the elements in the collection in parallel by handing whole chunks to the Job System workers. Blocks until the whole collection is processed.
+    /// </summary>
+    /// <param name="fn">The function to call for every non-empty chunk. Argument is the span of the elements to process. Must be thread-safe.</param>
+    template<typename Fn>
+    void VisitParallel(Fn fn) const
+    {
+        JobSystem::Execute([this, &fn](int32 chunkIndex)
+        {
+            Chunk* chunk = _chunks[chunkIndex];
+            if (chunk->HasItems())
+                fn(Span<T>(chunk->Get(), chunk->Count()));
+        }, _chunks.Count());
+    }
+
 public:
     Iterator Begin() const
     {
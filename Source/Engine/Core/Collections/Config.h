@@ -12,3 +12,8 @@
 /// </summary>
 #define DICTIONARY_PROB_FUNC(size, numChecks) (numChecks)
 //#define DICTIONARY_PROB_FUNC(size, numChecks) (1)
+
+/// <summary>
+/// Minimum amount of elements in the dictionary to hash the keys in parallel over the Job System workers when growing via the DictionaryBulk helper
+/// </summary>
+#define DICTIONARY_PARALLEL_REHASH_MIN_COUNT (64 * 1024)
@@ -17,6 +17,7 @@ template<typename KeyType, typename ValueType, typename AllocationType = HeapAll
 API_CLASS(InBuild) class Dictionary
 {
     friend Dictionary;
+    friend class DictionaryBulk;
 public:
     /// <summary>
     /// Describes single portion of space for the key and value pair in a hash map.
@@ -24,6 +25,7 @@ public:
     struct Bucket
     {
         friend Dictionary;
+        friend class DictionaryBulk;
 
         enum State : byte
         {
@@ -0,0 +1,106 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Dictionary.h"
+#include "Engine/Threading/JobSystem.h"
+
+/// <summary>
+/// Bulk-load utilities for Dictionary that spread the rehashing work over the Job System workers.
+/// Dictionary itself never schedules jobs: waiting on the Job System while the caller holds a lock that the workers can also take (eg. growing a table inside a memory profiler callback) can deadlock, so the parallel path is an explicit opt-in for call sites that know blocking on the workers is safe.
+/// </summary>
+class DictionaryBulk
+{
+public:
+    /// <summary>
+    /// Changes the capacity of the collection preserving its contents. For tables with at least DICTIONARY_PARALLEL_REHASH_MIN_COUNT elements the keys are hashed upfront in parallel over the Job System workers (the dominant rehash cost for big tables), then the buckets are scattered serially so the resulting table layout matches Dictionary::SetCapacity. Don't call while holding a lock that the Job System workers can take.
+    /// </summary>
+    /// <param name="dictionary">The dictionary to resize.</param>
+    /// <param name="capacity">The new capacity.</param>
+    template<typename KeyType, typename ValueType, typename AllocationType>
+    static void SetCapacity(Dictionary<KeyType, ValueType, AllocationType>& dictionary, int32 capacity)
+    {
+        typedef Dictionary<KeyType, ValueType, AllocationType> DictionaryType;
+        typedef typename DictionaryType::Bucket Bucket;
+        if (dictionary._elementsCount < DICTIONARY_PARALLEL_REHASH_MIN_COUNT)
+        {
+            // Small tables gain nothing from the workers
+            dictionary.SetCapacity(capacity);
+            return;
+        }
+        if (capacity == dictionary.Capacity())
+            return;
+        ASSERT(capacity >= 0);
+        typename DictionaryType::AllocationData oldAllocation;
+        oldAllocation.Swap(dictionary._allocation);
+        const int32 oldSize = dictionary._size;
+        dictionary._deletedCount = dictionary._elementsCount = 0;
+        if (capacity != 0 && (capacity & (capacity - 1)) != 0)
+        {
+            // Align capacity value to the next power of two (http://graphics.stanford.edu/~seander/bithacks.html#RoundUpPowerOf2)
+            capacity--;
+            capacity |= capacity >> 1;
+            capacity |= capacity >> 2;
+            capacity |= capacity >> 4;
+            capacity |= capacity >> 8;
+            capacity |= capacity >> 16;
+            capacity++;
+        }
+        if (capacity)
+        {
+            dictionary._allocation.Allocate(capacity);
+            Bucket* data = dictionary._allocation.Get();
+            for (int32 i = 0; i < capacity; i++)
+                data[i]._state = Bucket::Empty;
+        }
+        dictionary._size = capacity;
+        Bucket* oldData = oldAllocation.Get();
+
+        // Hash all the keys upfront in parallel, then scatter the buckets serially so the table layout stays identical to the single-threaded rehash
+        HeapAllocation::Data<uint32> hashes;
+        hashes.Allocate(oldSize);
+        uint32* hashesData = hashes.Get();
+        JobSystem::ParallelFor(0, oldSize, 0, [hashesData, oldData](int32 begin, int32 end)
+        {
+            for (int32 i = begin; i < end; i++)
+            {
+                if (oldData[i].IsOccupied())
+                    hashesData[i] = GetHash(oldData[i].Key);
+            }
+        });
+        const int32 tableSizeMinusOne = dictionary._size - 1;
+        Bucket* data = dictionary._allocation.Get();
+        for (int32 i = 0; i < oldSize; i++)
+        {
+            if (!oldData[i].IsOccupied())
+                continue;
+            int32 bucketIndex = hashesData[i] & tableSizeMinusOne;
+            int32 checksCount = 0;
+            while (!data[bucketIndex].IsEmpty())
+            {
+                checksCount++;
+                bucketIndex = (bucketIndex + DICTIONARY_PROB_FUNC(dictionary._size, checksCount)) & tableSizeMinusOne;
+            }
+            data[bucketIndex].Occupy(oldData[i].Key, MoveTemp(oldData[i].Value));
+            dictionary._elementsCount++;
+        }
+        for (int32 i = 0; i < oldSize; i++)
+            oldData[i].Free();
+    }
+
+    /// <summary>
+    /// Ensures that collection has given capacity (preserving its contents) using the parallel rehash for big tables. Don't call while holding a lock that the Job System workers can take.
+    /// </summary>
+    /// <param name="dictionary">The dictionary to resize.</param>
+    /// <param name="minCapacity">The minimum required capacity.</param>
+    template<typename KeyType, typename ValueType, typename AllocationType>
+    static void EnsureCapacity(Dictionary<KeyType, ValueType, AllocationType>& dictionary, int32 minCapacity)
+    {
+        if (dictionary._size >= minCapacity)
+            return;
+        if (minCapacity < DICTIONARY_DEFAULT_CAPACITY)
+            minCapacity = DICTIONARY_DEFAULT_CAPACITY;
+        const int32 capacity = dictionary._allocation.CalculateCapacityGrow(dictionary._size, minCapacity);
+        SetCapacity(dictionary, capacity);
+    }
+};
@@ -0,0 +1,495 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Memory/Memory.h"
+#include "Engine/Core/Memory/Allocation.h"
+#include "Engine/Core/Collections/HashFunctions.h"
+#include "Engine/Core/Collections/Config.h"
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Platform/Platform.h"
+#if PLATFORM_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+
+/// <summary>
+/// Template for unordered dictionary that uses flat open-addressing storage with group probing (Swiss-table style).
+/// Keys and values are stored densely in a single slots array with a separate control-byte array holding 7-bit hash tags,
+/// so probing touches a single cache line of tags before any key comparison happens. Probing scans 16 tags at once (SIMD when available).
+/// Prefer it over Dictionary for hot lookup paths with small keys (eg. GUID or pointer keys).
+/// </summary>
+/// <typeparam name="KeyType">The type of the keys in the dictionary.</typeparam>
+/// <typeparam name="ValueType">The type of the values in the dictionary.</typeparam>
+template<typename KeyType, typename ValueType>
+class FlatDictionary
+{
+public:
+    struct Slot
+    {
+        KeyType Key;
+        ValueType Value;
+    };
+
+private:
+    enum ControlTag : uint8
+    {
+        CtrlEmpty = 0x80,
+        CtrlDeleted = 0xFE,
+        // Values 0x00..0x7F are 7-bit tags of occupied slots
+    };
+
+    enum
+    {
+        GroupWidth = 16,
+    };
+
+    uint8* _control = nullptr;
+    Slot* _slots = nullptr;
+    int32 _count = 0;
+    int32 _deleted = 0;
+    int32 _capacity = 0; // Power of two, multiple of GroupWidth (or 0)
+
+    FORCE_INLINE static uint32 HashTag(uint32 hash)
+    {
+        return (hash >> 25) & 0x7F;
+    }
+
+    // Returns bitmask of tag matches within the 16-slot group starting at groupStart
+    FORCE_INLINE uint32 MatchGroup(int32 groupStart, uint8 tag) const
+    {
+#if PLATFORM_SIMD_SSE2
+        const __m128i group = _mm_loadu_si128((const __m128i*)(_control + groupStart));
+        return (uint32)_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8((char)tag)));
+#else
+        uint32 mask = 0;
+        for (int32 i = 0; i < GroupWidth; i++)
+            mask |= (uint32)(_control[groupStart + i] == tag) << i;
+        return mask;
+#endif
+    }
+
+    // Returns bitmask of empty or deleted slots within the 16-slot group starting at groupStart
+    FORCE_INLINE uint32 MatchFreeGroup(int32 groupStart) const
+    {
+#if PLATFORM_SIMD_SSE2
+        const __m128i group = _mm_loadu_si128((const __m128i*)(_control + groupStart));
+        return (uint32)_mm_movemask_epi8(group);
+#else
+        uint32 mask = 0;
+        for (int32 i = 0; i < GroupWidth; i++)
+            mask |= (uint32)((_control[groupStart + i] & 0x80) != 0) << i;
+        return mask;
+#endif
+    }
+
+    template<typename KeyComparableType>
+    int32 FindSlot(const KeyComparableType& key) const
+    {
+        if (_capacity == 0)
+            return -1;
+        const uint32 hash = GetHash(key);
+        const uint8 tag = (uint8)HashTag(hash);
+        const int32 numGroups = _capacity / GroupWidth;
+        int32 group = (int32)(hash & (uint32)(numGroups - 1));
+        for (int32 probe = 0; probe < numGroups; probe++)
+        {
+            const int32 groupStart = group * GroupWidth;
+            uint32 matches = MatchGroup(groupStart, tag);
+            while (matches)
+            {
+                const int32 i = groupStart + Math::FloorLog2(matches & ~(matches - 1));
+                if (_slots[i].Key == key)
+                    return i;
+                matches &= matches - 1;
+            }
+            if (MatchGroup(groupStart, CtrlEmpty))
+                return -1;
+            group = (group + 1) & (numGroups - 1);
+        }
+        return -1;
+    }
+
+    void Rehash(int32 capacity)
+    {
+        uint8* oldControl = _control;
+        Slot* oldSlots = _slots;
+        const int32 oldCapacity = _capacity;
+
+        _capacity = capacity;
+        _control = (uint8*)Allocator::Allocate(capacity, GroupWidth);
+        _slots = (Slot*)Allocator::Allocate(capacity * sizeof(Slot), alignof(Slot) > 16 ? alignof(Slot) : 16);
+        if (!_control || !_slots)
+            OUT_OF_MEMORY;
+        Platform::MemorySet(_control, capacity, CtrlEmpty);
+        _count = 0;
+        _deleted = 0;
+
+        for (int32 i = 0; i < oldCapacity; i++)
+        {
+            if ((oldControl[i] & 0x80) == 0)
+            {
+                Slot& slot = oldSlots[i];
+                Slot* newSlot = InsertSlot(slot.Key);
+                Memory::MoveItems(&newSlot->Value, &slot.Value, 1);
+                Memory::DestructItem(&slot.Key);
+                Memory::DestructItem(&slot.Value);
+            }
+        }
+        Allocator::Free(oldControl);
+        Allocator::Free(oldSlots);
+    }
+
+    void EnsureSpace()
+    {
+        // Keep the load factor (including tombstones) below 7/8
+        if (_capacity == 0)
+            Rehash(GroupWidth * 4);
+        else if ((_count + _deleted + 1) * 8 > _capacity * 7)
+            Rehash(_count * 2 > _capacity ? _capacity * 2 : _capacity);
+    }
+
+    // Claims a free slot for the given key (key gets move/copy-constructed, value construction is up to the caller)
+    template<typename KeyComparableType>
+    Slot* InsertSlot(const KeyComparableType& key)
+    {
+        const uint32 hash = GetHash(key);
+        const uint8 tag = (uint8)HashTag(hash);
+        const int32 numGroups = _capacity / GroupWidth;
+        int32 group = (int32)(hash & (uint32)(numGroups - 1));
+        for (;;)
+        {
+            const int32 groupStart = group * GroupWidth;
+            const uint32 free = MatchFreeGroup(groupStart);
+            if (free)
+            {
+                const int32 i = groupStart + Math::FloorLog2(free & ~(free - 1));
+                if (_control[i] == CtrlDeleted)
+                    _deleted--;
+                _control[i] = tag;
+                _count++;
+                Memory::ConstructItems(&_slots[i].Key, &key, 1);
+                return &_slots[i];
+            }
+            group = (group + 1) & (numGroups - 1);
+        }
+    }
+
+public:
+    FlatDictionary()
+    {
+    }
+
+    FlatDictionary(int32 capacity)
+    {
+        EnsureCapacity(capacity);
+    }
+
+    FlatDictionary(const FlatDictionary& other)
+    {
+        EnsureCapacity(other._count * 2);
+        for (int32 i = 0; i < other._capacity; i++)
+        {
+            if ((other._control[i] & 0x80) == 0)
+                Add(other._slots[i].Key, other._slots[i].Value);
+        }
+    }
+
+    FlatDictionary(FlatDictionary&& other) noexcept
+    {
+        ::Swap(_control, other._control);
+        ::Swap(_slots, other._slots);
+        ::Swap(_count, other._count);
+        ::Swap(_deleted, other._deleted);
+        ::Swap(_capacity, other._capacity);
+    }
+
+    FlatDictionary& operator=(const FlatDictionary& other)
+    {
+        if (this != &other)
+        {
+            Clear();
+            EnsureCapacity(other._count * 2);
+            for (int32 i = 0; i < other._capacity; i++)
+            {
+                if ((other._control[i] & 0x80) == 0)
+                    Add(other._slots[i].Key, other._slots[i].Value);
+            }
+        }
+        return *this;
+    }
+
+    FlatDictionary& operator=(FlatDictionary&& other) noexcept
+    {
+        if (this != &other)
+        {
+            ::Swap(_control, other._control);
+            ::Swap(_slots, other._slots);
+            ::Swap(_count, other._count);
+            ::Swap(_deleted, other._deleted);
+            ::Swap(_capacity, other._capacity);
+        }
+        return *this;
+    }
+
+    ~FlatDictionary()
+    {
+        Clear();
+        Allocator::Free(_control);
+        Allocator::Free(_slots);
+    }
+
+public:
+    /// <summary>
+    /// Gets the amount of the elements in the collection.
+    /// </summary>
+    FORCE_INLINE int32 Count() const
+    {
+        return _count;
+    }
+
+    /// <summary>
+    /// Gets the amount of the slots in the collection storage.
+    /// </summary>
+    FORCE_INLINE int32 Capacity() const
+    {
+        return _capacity;
+    }
+
+    /// <summary>
+    /// Returns true if collection is empty.
+    /// </summary>
+    FORCE_INLINE bool IsEmpty() const
+    {
+        return _count == 0;
+    }
+
+    /// <summary>
+    /// Returns true if collection has one or more elements.
+    /// </summary>
+    FORCE_INLINE bool HasItems() const
+    {
+        return _count != 0;
+    }
+
+public:
+    /// <summary>
+    /// The collection iterator (walks occupied slots only).
+    /// </summary>
+    struct Iterator
+    {
+    private:
+        friend FlatDictionary;
+        const FlatDictionary* _collection;
+        int32 _index;
+
+        void SkipFree()
+        {
+            while (_index < _collection->_capacity && (_collection->_control[_index] & 0x80) != 0)
+                _index++;
+        }
+
+        Iterator(const FlatDictionary* collection, int32 index)
+            : _collection(collection)
+            , _index(index)
+        {
+            SkipFree();
+        }
+
+    public:
+        FORCE_INLINE Slot& operator*() const
+        {
+            return _collection->_slots[_index];
+        }
+
+        FORCE_INLINE Slot* operator->() const
+        {
+            return &_collection->_slots[_index];
+        }
+
+        FORCE_INLINE bool operator==(const Iterator& v) const
+        {
+            return _index == v._index && _collection == v._collection;
+        }
+
+        FORCE_INLINE bool operator!=(const Iterator& v) const
+        {
+            return _index != v._index || _collection != v._collection;
+        }
+
+        FORCE_INLINE bool IsEnd() const
+        {
+            return _index == _collection->_capacity;
+        }
+
+        FORCE_INLINE bool IsNotEnd() const
+        {
+            return _index != _collection->_capacity;
+        }
+
+        Iterator& operator++()
+        {
+            _index++;
+            SkipFree();
+            return *this;
+        }
+    };
+
+    FORCE_INLINE Iterator Begin() const
+    {
+        return Iterator(this, 0);
+    }
+
+    FORCE_INLINE Iterator End() const
+    {
+        return Iterator(this, _capacity);
+    }
+
+    FORCE_INLINE Iterator begin() const
+    {
+        return Iterator(this, 0);
+    }
+
+    FORCE_INLINE Iterator end() const
+    {
+        return Iterator(this, _capacity);
+    }
+
+public:
+    /// <summary>
+    /// Gets or sets the element by the key (adds the default value if key is missing).
+    /// </summary>
+    template<typename KeyComparableType>
+    ValueType& operator[](const KeyComparableType& key)
+    {
+        int32 i = FindSlot(key);
+        if (i != -1)
+            return _slots[i].Value;
+        EnsureSpace();
+        Slot* slot = InsertSlot(key);
+        Memory::ConstructItem(&slot->Value);
+        return slot->Value;
+    }
+
+    /// <summary>
+    /// Adds the key and value pair to the collection. The key must not exist yet.
+    /// </summary>
+    template<typename KeyComparableType>
+    ValueType& Add(const KeyComparableType& key, const ValueType& value)
+    {
+        ASSERT(FindSlot(key) == -1);
+        EnsureSpace();
+        Slot* slot = InsertSlot(key);
+        Memory::ConstructItems(&slot->Value, &value, 1);
+        return slot->Value;
+    }
+
+    /// <summary>
+    /// Determines whether the collection contains an element with the specified key.
+    /// </summary>
+    template<typename KeyComparableType>
+    FORCE_INLINE bool ContainsKey(const KeyComparableType& key) const
+    {
+        return FindSlot(key) != -1;
+    }
+
+    /// <summary>
+    /// Tries to get the element with the given key.
+    /// </summary>
+    /// <param name="key">The key of the element.</param>
+    /// <param name="result">The result value.</param>
+    /// <returns>True if element with that key has been found, otherwise false.</returns>
+    template<typename KeyComparableType>
+    bool TryGet(const KeyComparableType& key, ValueType& result) const
+    {
+        const int32 i = FindSlot(key);
+        if (i == -1)
+            return false;
+        result = _slots[i].Value;
+        return true;
+    }
+
+    /// <summary>
+    /// Tries to get the pointer to the element with the given key.
+    /// </summary>
+    /// <param name="key">The key of the element.</param>
+    /// <returns>The value of the element or null if missing.</returns>
+    template<typename KeyComparableType>
+    ValueType* TryGet(const KeyComparableType& key) const
+    {
+        const int32 i = FindSlot(key);
+        return i != -1 ? &_slots[i].Value : nullptr;
+    }
+
+    /// <summary>
+    /// Removes the element with the specified key.
+    /// </summary>
+    /// <param name="key">The key of the element.</param>
+    /// <returns>True if element has been removed, otherwise false.</returns>
+    template<typename KeyComparableType>
+    bool Remove(const KeyComparableType& key)
+    {
+        const int32 i = FindSlot(key);
+        if (i == -1)
+            return false;
+        Memory::DestructItem(&_slots[i].Key);
+        Memory::DestructItem(&_slots[i].Value);
+        _control[i] = CtrlDeleted;
+        _count--;
+        _deleted++;
+        return true;
+    }
+
+    /// <summary>
+    /// Gets all the keys in the collection.
+    /// </summary>
+    /// <param name="result">The result list of the keys.</param>
+    template<typename ArrayAllocation>
+    void GetKeys(Array<KeyType, ArrayAllocation>& result) const
+    {
+        for (Iterator i = Begin(); i.IsNotEnd(); ++i)
+            result.Add(i->Key);
+    }
+
+    /// <summary>
+    /// Gets all the values in the collection.
+    /// </summary>
+    /// <param name="result">The result list of the values.</param>
+    template<typename ArrayAllocation>
+    void GetValues(Array<ValueType, ArrayAllocation>& result) const
+    {
+        for (Iterator i = Begin(); i.IsNotEnd(); ++i)
+            result.Add(i->Value);
+    }
+
+    /// <summary>
+    /// Removes all elements from the collection (keeps the allocated storage).
+    /// </summary>
+    void Clear()
+    {
+        if (_capacity == 0)
+            return;
+        for (int32 i = 0; i < _capacity; i++)
+        {
+            if ((_control[i] & 0x80) == 0)
+            {
+                Memory::DestructItem(&_slots[i].Key);
+                Memory::DestructItem(&_slots[i].Value);
+            }
+        }
+        Platform::MemorySet(_control, _capacity, CtrlEmpty);
+        _count = 0;
+        _deleted = 0;
+    }
+
+    /// <summary>
+    /// Ensures the collection has a storage for at least the given amount of elements without exceeding the target load factor.
+    /// </summary>
+    void EnsureCapacity(int32 minCapacity)
+    {
+        int32 capacity = GroupWidth * 4;
+        while (capacity * 7 < minCapacity * 8)
+            capacity *= 2;
+        if (capacity > _capacity)
+            Rehash(capacity);
+    }
+};
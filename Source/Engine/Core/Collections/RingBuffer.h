@@ -86,6 +86,16 @@ public:
         return _allocation.Get()[(_front + index) % _capacity];
     }
 
+    FORCE_INLINE T& PeekBack()
+    {
+        return _allocation.Get()[(_back - 1 + _capacity) % _capacity];
+    }
+
+    FORCE_INLINE const T& PeekBack() const
+    {
+        return _allocation.Get()[(_back - 1 + _capacity) % _capacity];
+    }
+
     void PopFront()
     {
         Memory::DestructItems(_allocation.Get() + _front, 1);
@@ -93,6 +103,13 @@ public:
         _count--;
     }
 
+    void PopBack()
+    {
+        _back = (_back - 1 + _capacity) % _capacity;
+        Memory::DestructItems(_allocation.Get() + _back, 1);
+        _count--;
+    }
+
     void Clear()
     {
         Memory::DestructItems(Get() + Math::Min(_front, _back), _count);
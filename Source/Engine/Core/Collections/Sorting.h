@@ -339,4 +339,139 @@ public:
             inputValues = tmpValues;
         }
     }
+
+    /// <summary>
+    /// Sorts the linear data array using Radix Sort algorithm with histogram and scatter phases parallelized over the Job System workers (uses temporary keys collection).
+    /// Falls back to the single-threaded RadixSort for small arrays. Intended for large per-frame workloads like draw call sort keys.
+    /// </summary>
+    /// <param name="inputKeys">The data pointer to the input sorting keys array. When this method completes it contains a pointer to the original data or the temporary depending on the algorithm passes count. Use it as a results container.</param>
+    /// <param name="inputValues">The data pointer to the input values array. When this method completes it contains a pointer to the original data or the temporary depending on the algorithm passes count. Use it as a results container.</param>
+    /// <param name="tmpKeys">The data pointer to the temporary sorting keys array.</param>
+    /// <param name="tmpValues">The data pointer to the temporary values array.</param>
+    /// <param name="count">The elements count.</param>
+    template<typename T, typename U>
+    static void RadixSortParallel(T*& inputKeys, U*& inputValues, T* tmpKeys, U* tmpValues, int32 count);
 };
+
+#include "Engine/Threading/JobSystem.h"
+#include "Engine/Core/Collections/Array.h"
+
+template<typename T, typename U>
+void Sorting::RadixSortParallel(T*& inputKeys, U*& inputValues, T* tmpKeys, U* tmpValues, int32 count)
+{
+    enum
+    {
+        RADIXSORT_BITS = 11,
+        RADIXSORT_HISTOGRAM_SIZE = 1 << RADIXSORT_BITS,
+        RADIXSORT_BIT_MASK = RADIXSORT_HISTOGRAM_SIZE - 1,
+        RADIXSORT_PARALLEL_MIN_COUNT = 4096,
+    };
+    const int32 numChunks = Math::Min(JobSystem::GetThreadsCount(), 16);
+    if (count < RADIXSORT_PARALLEL_MIN_COUNT || numChunks < 2)
+    {
+        RadixSort(inputKeys, inputValues, tmpKeys, tmpValues, count);
+        return;
+    }
+
+    T* keys = inputKeys;
+    T* tempKeys = tmpKeys;
+    U* values = inputValues;
+    U* tempValues = tmpValues;
+    const int32 chunkSize = (count + numChunks - 1) / numChunks;
+
+    // Per-chunk histograms and sorted flags (written by the jobs)
+    Array<uint32> histograms;
+    histograms.Resize(numChunks * RADIXSORT_HISTOGRAM_SIZE);
+    Array<byte> chunkSorted;
+    chunkSorted.Resize(numChunks);
+
+    uint16 shift = 0;
+    int32 pass = 0;
+    for (; pass < 6; pass++)
+    {
+        // Build the histograms chunk-wise in parallel (each chunk also checks if its keys are already sorted)
+        uint32* histogramsData = histograms.Get();
+        byte* chunkSortedData = chunkSorted.Get();
+        JobSystem::Execute([=](int32 chunk)
+        {
+            const int32 begin = chunk * chunkSize;
+            const int32 end = Math::Min(begin + chunkSize, count);
+            uint32* histogram = histogramsData + chunk * RADIXSORT_HISTOGRAM_SIZE;
+            Platform::MemoryClear(histogram, sizeof(uint32) * RADIXSORT_HISTOGRAM_SIZE);
+            bool sorted = true;
+            T prevKey = begin < end ? keys[begin] : T(0);
+            for (int32 i = begin; i < end; i++)
+            {
+                const T key = keys[i];
+                ++histogram[(key >> shift) & RADIXSORT_BIT_MASK];
+                sorted &= prevKey <= key;
+                prevKey = key;
+            }
+            chunkSortedData[chunk] = sorted ? 1 : 0;
+        }, numChunks);
+
+        // Skip the pass if the whole array is already sorted (happens often with frame-to-frame coherent keys)
+        bool sorted = true;
+        for (int32 chunk = 0; chunk < numChunks; chunk++)
+            sorted &= chunkSortedData[chunk] != 0;
+        if (sorted)
+        {
+            sorted = true;
+            for (int32 chunk = 1; chunk < numChunks && sorted; chunk++)
+            {
+                const int32 begin = chunk * chunkSize;
+                sorted &= begin >= count || keys[begin - 1] <= keys[begin];
+            }
+            if (sorted)
+                goto end;
+        }
+
+        // Exclusive prefix sum over all chunk histograms (digit-major so chunks scatter to disjoint ranges)
+        {
+            uint32 offset = 0;
+            for (int32 i = 0; i < RADIXSORT_HISTOGRAM_SIZE; i++)
+            {
+                for (int32 chunk = 0; chunk < numChunks; chunk++)
+                {
+                    uint32& slot = histogramsData[chunk * RADIXSORT_HISTOGRAM_SIZE + i];
+                    const uint32 cnt = slot;
+                    slot = offset;
+                    offset += cnt;
+                }
+            }
+        }
+
+        // Scatter chunk-wise in parallel
+        JobSystem::Execute([=](int32 chunk)
+        {
+            const int32 begin = chunk * chunkSize;
+            const int32 end = Math::Min(begin + chunkSize, count);
+            uint32* histogram = histogramsData + chunk * RADIXSORT_HISTOGRAM_SIZE;
+            for (int32 i = begin; i < end; i++)
+            {
+                const T k = keys[i];
+                const uint32 dest = histogram[(k >> shift) & RADIXSORT_BIT_MASK]++;
+                tempKeys[dest] = k;
+                tempValues[dest] = values[i];
+            }
+        }, numChunks);
+
+        T* const swapKeys = tempKeys;
+        tempKeys = keys;
+        keys = swapKeys;
+
+        U* const swapValues = tempValues;
+        tempValues = values;
+        values = swapValues;
+
+        shift += RADIXSORT_BITS;
+    }
+
+end:
+    if (pass & 1)
+    {
+        // Use temporary keys and values as a result
+        inputKeys = tmpKeys;
+        inputValues = tmpValues;
+    }
+}
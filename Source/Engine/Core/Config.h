@@ -22,6 +22,9 @@
 #ifndef USE_EDITOR
 #define USE_EDITOR 0
 #endif
+#ifndef USE_HEADLESS
+#define USE_HEADLESS 0
+#endif
 #ifndef OFFICIAL_BUILD
 #define OFFICIAL_BUILD 0
 #endif
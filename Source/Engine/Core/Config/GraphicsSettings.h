@@ -62,6 +62,18 @@ public:
     API_FIELD(Attributes="EditorOrder(1320), DefaultValue(false), EditorDisplay(\"Quality\", \"Allow CSM Blending\")")
     bool AllowCSMBlending = false;
 
+    /// <summary>
+    /// If checked, transparent materials are rendered into a half-resolution buffer and composited with a depth-aware upsample to reduce the fill-rate cost of heavy particle effects. Materials can opt-out via the Full Resolution Transparency feature flag.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(1330), DefaultValue(false), EditorDisplay(\"Quality\", \"Half-Resolution Transparency\")")
+    bool HalfResTransparency = false;
+
+    /// <summary>
+    /// If checked, transparent draw calls are sorted into 16 depth buckets instead of the exact back-to-front order which cuts the sorting cost of heavy particle scenes. Draws within a bucket keep a stable order so minor artifacts can occur where transparency self-overlaps.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(1340), DefaultValue(false), EditorDisplay(\"Quality\", \"Approximate Transparent Sort\")")
+    bool ApproximateTransparentSort = false;
+
     /// <summary>
     /// Default probes cubemap resolution (use for Environment Probes, can be overriden per-actor).
     /// </summary>
@@ -106,6 +118,12 @@ public:
     API_FIELD(Attributes="EditorOrder(2120), Limit(50, 1000), EditorDisplay(\"Global Illumination\")")
     float GIProbesSpacing = 100;
 
+    /// <summary>
+    /// The Global Illumination probe rays budget per-frame (in thousands of rays). Limits the amount of probe rays traced every frame by throttling the update rate of the further probe cascades. Use 0 for unlimited budget.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(2125), Limit(0, 100000), EditorDisplay(\"Global Illumination\", \"GI Probe Rays Budget\")")
+    int32 GIProbeRaysBudget = 0;
+
     /// <summary>
     /// The Global Surface Atlas resolution. Adjust it if atlas `flickers` due to overflow (eg. to 4096).
     /// </summary>
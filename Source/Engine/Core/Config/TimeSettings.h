@@ -42,6 +42,12 @@ public:
     API_FIELD(Attributes="EditorOrder(20), Limit(0.1f, 1000.0f, 0.01f), EditorDisplay(\"General\")")
     float MaxUpdateDeltaTime = 0.1f;
 
+    /// <summary>
+    /// If checked, the game logic and rendering steps are paced to the target rate: the delta time is smoothed over the last few frames and snapped to the fixed step when running close to the target, which removes judder caused by small frame time oscillations.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(30), EditorDisplay(\"General\")")
+    bool FramePacing = true;
+
 public:
 
     /// <summary>
@@ -134,6 +134,29 @@ void BoundingBox::Transform(const BoundingBox& box, const Matrix& matrix, Boundi
     result = BoundingBox(min, max);
 }
 
+void BoundingBox::TransformArray(const BoundingBox* boxes, const Matrix& matrix, BoundingBox* results, int32 count)
+{
+    // Reference: http://dev.theomader.com/transform-bounding-boxes/
+
+    const auto right = matrix.GetRight();
+    const auto up = matrix.GetUp();
+    const auto backward = matrix.GetBackward();
+    const auto translation = matrix.GetTranslation();
+    for (int32 i = 0; i < count; i++)
+    {
+        const BoundingBox& box = boxes[i];
+        const auto xa = right * box.Minimum.X;
+        const auto xb = right * box.Maximum.X;
+        const auto ya = up * box.Minimum.Y;
+        const auto yb = up * box.Maximum.Y;
+        const auto za = backward * box.Minimum.Z;
+        const auto zb = backward * box.Maximum.Z;
+        const auto min = Vector3::Min(xa, xb) + Vector3::Min(ya, yb) + Vector3::Min(za, zb) + translation;
+        const auto max = Vector3::Max(xa, xb) + Vector3::Max(ya, yb) + Vector3::Max(za, zb) + translation;
+        results[i] = BoundingBox(min, max);
+    }
+}
+
 void BoundingBox::Transform(const BoundingBox& box, const ::Transform& transform, BoundingBox& result)
 {
     // Reference: http://dev.theomader.com/transform-bounding-boxes/
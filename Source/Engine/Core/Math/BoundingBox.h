@@ -304,6 +304,15 @@ public:
     /// <param name="result">The result transformed box.</param>
     static void Transform(const BoundingBox& box, const ::Transform& transform, BoundingBox& result);
 
+    /// <summary>
+    /// Transforms an array of bounding boxes using the specified matrix. Matrix axes get extracted once for the whole batch which makes it faster than transforming boxes one by one.
+    /// </summary>
+    /// <param name="boxes">The array of the source boxes.</param>
+    /// <param name="matrix">The matrix.</param>
+    /// <param name="results">The array of the result transformed boxes (can alias the source array).</param>
+    /// <param name="count">The amount of the boxes to process.</param>
+    static void TransformArray(const BoundingBox* boxes, const Matrix& matrix, BoundingBox* results, int32 count);
+
 public:
     /// <summary>
     /// Determines if there is an intersection between the current object and a Ray.
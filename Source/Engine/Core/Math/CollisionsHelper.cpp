@@ -1,6 +1,7 @@
 // Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
 
 #include "CollisionsHelper.h"
+#include "Engine/Core/SIMD.h"
 #include "Vector2.h"
 #include "Vector3.h"
 #include "Ray.h"
@@ -1298,6 +1299,52 @@ ContainmentType CollisionsHelper::FrustumContainsBox(const BoundingFrustum& frus
     return result;
 }
 
+uint32 CollisionsHelper::FrustumIntersectsSpheres(const BoundingFrustum& frustum, const BoundingSphere* spheres, int32 count)
+{
+    ASSERT_LOW_LAYER(count >= 0 && count <= 32);
+    uint32 result = 0;
+    int32 i = 0;
+#if !USE_LARGE_WORLDS
+    // Test 4 spheres per step against all 6 planes (a sphere is outside when distance + radius is negative so the sign bits accumulate the outside state)
+    Plane planes[6];
+    for (int32 p = 0; p < 6; p++)
+        planes[p] = frustum.GetPlane(p);
+    for (; i + 4 <= count; i += 4)
+    {
+        float soa[4][4]; // centers x, y, z and radius of 4 spheres
+        for (int32 j = 0; j < 4; j++)
+        {
+            const BoundingSphere& sphere = spheres[i + j];
+            soa[0][j] = sphere.Center.X;
+            soa[1][j] = sphere.Center.Y;
+            soa[2][j] = sphere.Center.Z;
+            soa[3][j] = sphere.Radius;
+        }
+        const SimdVector4 cx = SIMD::LoadUnaligned(soa[0]);
+        const SimdVector4 cy = SIMD::LoadUnaligned(soa[1]);
+        const SimdVector4 cz = SIMD::LoadUnaligned(soa[2]);
+        const SimdVector4 r = SIMD::LoadUnaligned(soa[3]);
+        SimdVector4 outside = SIMD::Splat(0.0f);
+        for (int32 p = 0; p < 6; p++)
+        {
+            const Plane& plane = planes[p];
+            SimdVector4 distance = SIMD::Mul(cx, SIMD::Splat(plane.Normal.X));
+            distance = SIMD::Add(distance, SIMD::Mul(cy, SIMD::Splat(plane.Normal.Y)));
+            distance = SIMD::Add(distance, SIMD::Mul(cz, SIMD::Splat(plane.Normal.Z)));
+            distance = SIMD::Add(distance, SIMD::Splat(plane.D));
+            outside = SIMD::Or(outside, SIMD::Add(distance, r));
+        }
+        result |= (uint32)(~SIMD::MoveMask(outside) & 0xf) << i;
+    }
+#endif
+    for (; i < count; i++)
+    {
+        if (frustum.Intersects(spheres[i]))
+            result |= 1u << i;
+    }
+    return result;
+}
+
 bool CollisionsHelper::LineIntersectsLine(const Float2& l1p1, const Float2& l1p2, const Float2& l2p1, const Float2& l2p2)
 {
     float q = (l1p1.Y - l2p1.Y) * (l2p2.X - l2p1.X) - (l1p1.X - l2p1.X) * (l2p2.Y - l2p1.Y);
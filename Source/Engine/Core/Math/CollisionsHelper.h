@@ -541,6 +541,15 @@ public:
 
     static ContainmentType FrustumContainsBox(const BoundingFrustum& frustum, const BoundingBox& box);
 
+    /// <summary>
+    /// Determines whether a <see cref="BoundingFrustum" /> intersects a batch of bounding spheres. Uses SIMD to test 4 spheres against all 6 planes per step.
+    /// </summary>
+    /// <param name="frustum">The frustum to test.</param>
+    /// <param name="spheres">The array of the spheres to test.</param>
+    /// <param name="count">The amount of the spheres to test (up to 32).</param>
+    /// <returns>The mask with a bit set for every sphere that intersects the frustum (bit 0 for the first sphere).</returns>
+    static uint32 FrustumIntersectsSpheres(const BoundingFrustum& frustum, const BoundingSphere* spheres, int32 count);
+
     /// <summary>
     /// Determines whether a line intersects with the other line.
     /// </summary>
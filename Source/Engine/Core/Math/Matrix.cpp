@@ -6,6 +6,7 @@
 #include "Quaternion.h"
 #include "Transform.h"
 #include "../Types/String.h"
+#include "Engine/Core/SIMD.h"
 
 static_assert(sizeof(Matrix) == 4 * 4 * 4, "Invalid Matrix type size.");
 
@@ -699,3 +700,57 @@ Float4 Matrix::TransformPosition(const Matrix& m, const Float4& v)
         m.Values[0][3] * v.Raw[0] + m.Values[1][3] * v.Raw[1] + m.Values[2][3] * v.Raw[2] + m.Values[3][3] * v.Raw[3]
     );
 }
+
+// Multiplies a single matrix by the right matrix loaded into 4 row registers
+FORCE_INLINE static void MultiplyRows(const Matrix& left, const SimdVector4& r0, const SimdVector4& r1, const SimdVector4& r2, const SimdVector4& r3, Matrix& result)
+{
+    for (int32 row = 0; row < 4; row++)
+    {
+        const float* l = left.Values[row];
+        SimdVector4 v = SIMD::Mul(SIMD::Splat(l[0]), r0);
+        v = SIMD::Add(v, SIMD::Mul(SIMD::Splat(l[1]), r1));
+        v = SIMD::Add(v, SIMD::Mul(SIMD::Splat(l[2]), r2));
+        v = SIMD::Add(v, SIMD::Mul(SIMD::Splat(l[3]), r3));
+        SIMD::StoreUnaligned(result.Values[row], v);
+    }
+}
+
+void Matrix::MultiplyArray(const Matrix* left, const Matrix* right, Matrix* result, int32 count)
+{
+    for (int32 i = 0; i < count; i++)
+    {
+        const SimdVector4 r0 = SIMD::LoadUnaligned(right[i].Values[0]);
+        const SimdVector4 r1 = SIMD::LoadUnaligned(right[i].Values[1]);
+        const SimdVector4 r2 = SIMD::LoadUnaligned(right[i].Values[2]);
+        const SimdVector4 r3 = SIMD::LoadUnaligned(right[i].Values[3]);
+        MultiplyRows(left[i], r0, r1, r2, r3, result[i]);
+    }
+}
+
+void Matrix::MultiplyArray(const Matrix* left, const Matrix& right, Matrix* result, int32 count)
+{
+    const SimdVector4 r0 = SIMD::LoadUnaligned(right.Values[0]);
+    const SimdVector4 r1 = SIMD::LoadUnaligned(right.Values[1]);
+    const SimdVector4 r2 = SIMD::LoadUnaligned(right.Values[2]);
+    const SimdVector4 r3 = SIMD::LoadUnaligned(right.Values[3]);
+    for (int32 i = 0; i < count; i++)
+        MultiplyRows(left[i], r0, r1, r2, r3, result[i]);
+}
+
+void Matrix::TransformPositionArray(const Float3* vectors, const Matrix& transform, Float3* results, int32 count)
+{
+    const SimdVector4 r0 = SIMD::LoadUnaligned(transform.Values[0]);
+    const SimdVector4 r1 = SIMD::LoadUnaligned(transform.Values[1]);
+    const SimdVector4 r2 = SIMD::LoadUnaligned(transform.Values[2]);
+    const SimdVector4 r3 = SIMD::LoadUnaligned(transform.Values[3]);
+    for (int32 i = 0; i < count; i++)
+    {
+        const Float3 v = vectors[i];
+        SimdVector4 p = SIMD::Add(SIMD::Mul(SIMD::Splat(v.X), r0), r3);
+        p = SIMD::Add(p, SIMD::Mul(SIMD::Splat(v.Y), r1));
+        p = SIMD::Add(p, SIMD::Mul(SIMD::Splat(v.Z), r2));
+        alignas(16) float tmp[4];
+        SIMD::Store(tmp, p);
+        results[i] = Float3(tmp[0], tmp[1], tmp[2]);
+    }
+}
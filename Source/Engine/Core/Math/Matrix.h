@@ -652,6 +652,27 @@ public:
         result.M44 = left.M41 * right.M14 + left.M42 * right.M24 + left.M43 * right.M34 + left.M44 * right.M44;
     }
 
+    // Calculates the products of the matrix pairs from two arrays (vectorized when SIMD is available).
+    // @param left The array of the first matrices to multiply.
+    // @param right The array of the second matrices to multiply.
+    // @param result The array of the products (can alias the left array).
+    // @param count The amount of the matrices to process.
+    static FLAXENGINE_API void MultiplyArray(const Matrix* left, const Matrix* right, Matrix* result, int32 count);
+
+    // Calculates the products of an array of matrices and a single shared matrix (eg. skeleton bones palette and world matrix; vectorized when SIMD is available).
+    // @param left The array of the first matrices to multiply.
+    // @param right The second matrix to multiply.
+    // @param result The array of the products (can alias the left array).
+    // @param count The amount of the matrices to process.
+    static FLAXENGINE_API void MultiplyArray(const Matrix* left, const Matrix& right, Matrix* result, int32 count);
+
+    // Transforms an array of 3D positions by the given matrix (vectorized when SIMD is available).
+    // @param vectors The array of the source positions.
+    // @param transform The transformation matrix.
+    // @param results The array of the transformed positions (can alias the source array).
+    // @param count The amount of the positions to process.
+    static FLAXENGINE_API void TransformPositionArray(const Float3* vectors, const Matrix& transform, Float3* results, int32 count);
+
     // Scales a matrix by the given value.
     // @param left The matrix to scale.
     // @param right The amount by which to scale.
@@ -276,4 +276,103 @@ public:
     };
 };
 
+/// <summary>
+/// The memory allocation policy that uses per-thread linear arenas which get reset at the end of every frame. Dedicated for transient containers that live within a single frame only (eg. draw lists or visibility results built during update). Does not free memory on release - the whole arena is recycled by the engine once per frame.
+/// </summary>
+class FLAXENGINE_API FrameAllocation
+{
+public:
+    /// <summary>
+    /// Allocates a block of memory from the calling thread frame arena. The block stays valid until the end of the current frame.
+    /// </summary>
+    /// <param name="size">The size of the allocation (in bytes).</param>
+    /// <returns>The allocated memory (16-bytes aligned).</returns>
+    static void* Allocate(uint64 size);
+
+    /// <summary>
+    /// Resets all per-thread frame arenas. Called by the engine at the end of the frame. Any data allocated from the arenas becomes invalid.
+    /// </summary>
+    static void EndFrame();
+
+public:
+    template<typename T>
+    class Data
+    {
+    private:
+        T* _data = nullptr;
+
+    public:
+        FORCE_INLINE Data()
+        {
+        }
+
+        FORCE_INLINE ~Data()
+        {
+        }
+
+        FORCE_INLINE T* Get()
+        {
+            return _data;
+        }
+
+        FORCE_INLINE const T* Get() const
+        {
+            return _data;
+        }
+
+        FORCE_INLINE int32 CalculateCapacityGrow(int32 capacity, int32 minCapacity) const
+        {
+            if (capacity < minCapacity)
+                capacity = minCapacity;
+            if (capacity < 8)
+            {
+                capacity = 8;
+            }
+            else
+            {
+                // Round up to the next power of 2 and multiply by 2 (http://graphics.stanford.edu/~seander/bithacks.html#RoundUpPowerOf2)
+                capacity--;
+                capacity |= capacity >> 1;
+                capacity |= capacity >> 2;
+                capacity |= capacity >> 4;
+                capacity |= capacity >> 8;
+                capacity |= capacity >> 16;
+                capacity = (capacity + 1) * 2;
+            }
+            return capacity;
+        }
+
+        FORCE_INLINE void Allocate(uint64 capacity)
+        {
+#if ENABLE_ASSERTION_LOW_LAYERS
+            ASSERT(!_data);
+#endif
+            _data = (T*)FrameAllocation::Allocate(capacity * sizeof(T));
+        }
+
+        FORCE_INLINE void Relocate(uint64 capacity, int32 oldCount, int32 newCount)
+        {
+            // Old block is abandoned in the arena (it gets recycled at the end of the frame)
+            T* newData = capacity != 0 ? (T*)FrameAllocation::Allocate(capacity * sizeof(T)) : nullptr;
+            if (oldCount)
+            {
+                if (newCount > 0)
+                    Memory::MoveItems(newData, _data, newCount);
+                Memory::DestructItems(_data, oldCount);
+            }
+            _data = newData;
+        }
+
+        FORCE_INLINE void Free()
+        {
+            _data = nullptr;
+        }
+
+        FORCE_INLINE void Swap(Data& other)
+        {
+            ::Swap(_data, other._data);
+        }
+    };
+};
+
 typedef HeapAllocation DefaultAllocation;
@@ -0,0 +1,77 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "Allocation.h"
+#include "Engine/Platform/CriticalSection.h"
+#include "Engine/Core/Math/Math.h"
+
+namespace
+{
+    // Per-thread linear arena made of a chain of chunks (chunks are kept across frames to amortize heap traffic)
+    struct FrameArena
+    {
+        struct Chunk
+        {
+            Chunk* Next;
+            uint64 Size;
+            uint64 Offset;
+        };
+
+        Chunk* Chunks = nullptr;
+        FrameArena* NextArena = nullptr;
+
+        void* Allocate(uint64 size)
+        {
+            size = Math::AlignUp<uint64>(size, 16);
+            Chunk* chunk = Chunks;
+            if (!chunk || chunk->Offset + size > chunk->Size)
+            {
+                const uint64 chunkSize = Math::Max<uint64>(size, 1024 * 1024);
+                chunk = (Chunk*)Allocator::Allocate(sizeof(Chunk) + chunkSize, 16);
+                if (!chunk)
+                    OUT_OF_MEMORY;
+                chunk->Next = Chunks;
+                chunk->Size = chunkSize;
+                chunk->Offset = 0;
+                Chunks = chunk;
+            }
+            void* result = (byte*)(chunk + 1) + chunk->Offset;
+            chunk->Offset += size;
+            return result;
+        }
+
+        void Reset()
+        {
+            for (Chunk* chunk = Chunks; chunk; chunk = chunk->Next)
+                chunk->Offset = 0;
+        }
+    };
+
+    CriticalSection ArenasLocker;
+    FrameArena* Arenas = nullptr;
+    THREADLOCAL FrameArena* ThreadArena = nullptr;
+}
+
+void* FrameAllocation::Allocate(uint64 size)
+{
+    FrameArena* arena = ThreadArena;
+    if (!arena)
+    {
+        // Lazy-init arena for this thread and register it for the end-of-frame reset
+        arena = New<FrameArena>();
+        ArenasLocker.Lock();
+        arena->NextArena = Arenas;
+        Arenas = arena;
+        ArenasLocker.Unlock();
+        ThreadArena = arena;
+    }
+    return arena->Allocate(size);
+}
+
+void FrameAllocation::EndFrame()
+{
+    // Assumes no thread allocates frame memory while the frame ends
+    ArenasLocker.Lock();
+    for (FrameArena* arena = Arenas; arena; arena = arena->NextArena)
+        arena->Reset();
+    ArenasLocker.Unlock();
+}
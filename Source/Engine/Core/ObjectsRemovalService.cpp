@@ -1,6 +1,7 @@
 // Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
 
 #include "ObjectsRemovalService.h"
+#include "Collections/Array.h"
 #include "Collections/Dictionary.h"
 #include "Engine/Engine/Time.h"
 #include "Engine/Engine/EngineService.h"
@@ -65,13 +66,12 @@ void ObjectsRemovalService::Flush(float dt, float gameDelta)
 {
     PROFILE_CPU();
 
+    // Collect the timed out objects into a batch and destroy them with the pool unlocked (destructors often delete sub-objects which touch the pool too, so keeping the lock would serialize the whole teardown)
+    Array<Object*, InlinedAllocation<64>> batch;
     PoolLocker.Lock();
-
-    int32 itemsLeft;
-    do
+    while (true)
     {
-        // Update timeouts and delete objects that timed out
-        itemsLeft = Pool.Count();
+        // Update timeouts and extract objects that timed out
         for (auto i = Pool.Begin(); i.IsNotEnd(); ++i)
         {
             Object* obj = i->Key;
@@ -79,17 +79,23 @@ void ObjectsRemovalService::Flush(float dt, float gameDelta)
             if (ttl <= 0.0f)
             {
                 Pool.Remove(i);
-                obj->OnDeleteObject();
-                itemsLeft--;
+                batch.Add(obj);
             }
             else
             {
                 i->Value = ttl;
             }
         }
-    }
-    while (itemsLeft != Pool.Count()); // Continue removing if any new item was added during removing (eg. sub-object delete with 0 timeout)
+        if (batch.IsEmpty())
+            break;
 
+        // Delete the batch (keep rescanning afterwards - eg. sub-object delete with 0 timeout scheduled during the batch needs to go this frame too)
+        PoolLocker.Unlock();
+        for (Object* obj : batch)
+            obj->OnDeleteObject();
+        batch.Clear();
+        PoolLocker.Lock();
+    }
     PoolLocker.Unlock();
 }
 
@@ -120,15 +126,19 @@ void ObjectsRemoval::Dispose()
     ObjectsRemovalService::Flush();
 
     // Delete all remaining objects
+    while (true)
     {
-        ScopeLock lock(PoolLocker);
-        for (auto i = Pool.Begin(); i.IsNotEnd(); ++i)
+        Array<Object*> batch;
         {
-            Object* obj = i->Key;
-            Pool.Remove(i);
-            obj->OnDeleteObject();
+            ScopeLock lock(PoolLocker);
+            if (Pool.IsEmpty())
+                break;
+            batch.EnsureCapacity(Pool.Count());
+            Pool.GetKeys(batch);
+            Pool.Clear();
         }
-        Pool.Clear();
+        for (Object* obj : batch)
+            obj->OnDeleteObject();
     }
 }
 
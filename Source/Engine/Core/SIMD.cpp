@@ -0,0 +1,104 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "SIMD.h"
+#include "Engine/Core/Log.h"
+
+#if PLATFORM_SIMD_SSE2
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace
+{
+#if PLATFORM_SIMD_SSE2
+
+    void CpuId(int32 leaf, int32 subLeaf, int32 regs[4])
+    {
+#ifdef _MSC_VER
+        __cpuidex((int*)regs, leaf, subLeaf);
+#else
+        unsigned int a, b, c, d;
+        if (!__get_cpuid_count((unsigned int)leaf, (unsigned int)subLeaf, &a, &b, &c, &d))
+            a = b = c = d = 0;
+        regs[0] = (int32)a;
+        regs[1] = (int32)b;
+        regs[2] = (int32)c;
+        regs[3] = (int32)d;
+#endif
+    }
+
+    uint64 XGetBV()
+    {
+#ifdef _MSC_VER
+        return _xgetbv(0);
+#else
+        unsigned int eax, edx;
+        __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+        return ((uint64)edx << 32) | eax;
+#endif
+    }
+
+#endif
+
+    SimdISA DetectISA()
+    {
+#if PLATFORM_SIMD_SSE2
+        int32 regs[4];
+        CpuId(0, 0, regs);
+        const int32 maxLeaf = regs[0];
+        CpuId(1, 0, regs);
+        const bool sse42 = (regs[2] & (1 << 20)) != 0;
+        const bool osxsave = (regs[2] & (1 << 27)) != 0;
+        const bool avx = (regs[2] & (1 << 28)) != 0;
+        SimdISA result = sse42 ? SimdISA::SSE42 : SimdISA::SSE2;
+        if (osxsave && avx && maxLeaf >= 7)
+        {
+            // The OS has to save the wider registers on the context switches (XCR0: bits 1-2 for YMM, bits 5-7 for ZMM and the opmasks)
+            const uint64 xcr0 = XGetBV();
+            const bool ymm = (xcr0 & 0x6) == 0x6;
+            const bool zmm = (xcr0 & 0xE6) == 0xE6;
+            CpuId(7, 0, regs);
+            const bool avx2 = (regs[1] & (1 << 5)) != 0;
+            const bool avx512 = (regs[1] & (1 << 16)) != 0 && (regs[1] & (1 << 17)) != 0 && (regs[1] & (1 << 30)) != 0 && (regs[1] & (1 << 31)) != 0; // F + DQ + BW + VL
+            if (avx2 && ymm)
+                result = SimdISA::AVX2;
+            if (avx512 && zmm)
+                result = SimdISA::AVX512;
+        }
+#elif PLATFORM_SIMD_NEON || PLATFORM_ARCH_ARM || PLATFORM_ARCH_ARM64
+        const SimdISA result = SimdISA::NEON;
+#else
+        const SimdISA result = SimdISA::Scalar;
+#endif
+        LOG(Info, "CPU SIMD instruction set: {0}", SIMD::ToString(result));
+        return result;
+    }
+}
+
+SimdISA SIMD::GetISALevel()
+{
+    static SimdISA isa = DetectISA();
+    return isa;
+}
+
+const Char* SIMD::ToString(SimdISA isa)
+{
+    switch (isa)
+    {
+    case SimdISA::NEON:
+        return TEXT("NEON");
+    case SimdISA::SSE2:
+        return TEXT("SSE2");
+    case SimdISA::SSE42:
+        return TEXT("SSE4.2");
+    case SimdISA::AVX2:
+        return TEXT("AVX2");
+    case SimdISA::AVX512:
+        return TEXT("AVX-512");
+    default:
+        return TEXT("Scalar");
+    }
+}
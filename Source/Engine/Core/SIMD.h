@@ -33,6 +33,11 @@ namespace SIMD
         return _mm_load_ps((const float*)(src));
     }
 
+    FORCE_INLINE SimdVector4 LoadUnaligned(const void* src)
+    {
+        return _mm_loadu_ps((const float*)(src));
+    }
+
     FORCE_INLINE SimdVector4 Splat(float value)
     {
         return _mm_set_ps1(value);
@@ -43,6 +48,11 @@ namespace SIMD
         _mm_store_ps((float*)dst, src);
     }
 
+    FORCE_INLINE void StoreUnaligned(void* dst, SimdVector4 src)
+    {
+        _mm_storeu_ps((float*)dst, src);
+    }
+
     FORCE_INLINE int MoveMask(SimdVector4 a)
     {
         return _mm_movemask_ps(a);
@@ -92,6 +102,11 @@ namespace SIMD
     {
         return _mm_max_ps(a, b);
     }
+
+    FORCE_INLINE SimdVector4 Or(SimdVector4 a, SimdVector4 b)
+    {
+        return _mm_or_ps(a, b);
+    }
 }
 
 #else
@@ -118,6 +133,13 @@ namespace SIMD
 		return *(const SimdVector4*)src;
 	}
 
+	FORCE_INLINE SimdVector4 LoadUnaligned(const void* src)
+	{
+		SimdVector4 result;
+		Platform::MemoryCopy(&result, src, sizeof(SimdVector4));
+		return result;
+	}
+
 	FORCE_INLINE SimdVector4 Splat(float value)
 	{
 		return { value, value, value, value };
@@ -128,6 +150,11 @@ namespace SIMD
 		(*(SimdVector4*)dst) = src;
 	}
 
+	FORCE_INLINE void StoreUnaligned(void* dst, SimdVector4 src)
+	{
+		Platform::MemoryCopy(dst, &src, sizeof(SimdVector4));
+	}
+
 	FORCE_INLINE int MoveMask(SimdVector4 a)
 	{
 		return (a.W < 0 ? (1 << 3) : 0) |
@@ -234,6 +261,70 @@ namespace SIMD
 			a.W > b.W ? a.W : b.W
 		};
 	}
+
+	FORCE_INLINE SimdVector4 Or(SimdVector4 a, SimdVector4 b)
+	{
+		const uint32* ua = (const uint32*)&a;
+		const uint32* ub = (const uint32*)&b;
+		SimdVector4 result;
+		uint32* ur = (uint32*)&result;
+		ur[0] = ua[0] | ub[0];
+		ur[1] = ua[1] | ub[1];
+		ur[2] = ua[2] | ub[2];
+		ur[3] = ua[3] | ub[3];
+		return result;
+	}
+}
+
+#endif
+
+// The SIMD instruction sets the runtime kernel dispatch can target (ordered by the capability within an architecture).
+enum class SimdISA
+{
+    Scalar = 0,
+    NEON = 1,
+    SSE2 = 2,
+    SSE42 = 3,
+    AVX2 = 4,
+    AVX512 = 5,
+};
+
+namespace SIMD
+{
+    // Gets the best SIMD instruction set supported by this CPU. Detected once at the first call (via CPUID on x86).
+    SimdISA GetISALevel();
+
+    // Gets the name of the instruction set (for logging).
+    const Char* ToString(SimdISA isa);
+
+    // Picks the best kernel variant for the runtime-detected instruction set. Null variants fall back to the closest lower level one. The result is stable so the call sites cache it (see SIMD_KERNEL_DISPATCH).
+    template<typename KernelType>
+    KernelType SelectKernel(KernelType baseline, KernelType avx2, KernelType avx512 = nullptr)
+    {
+        const SimdISA isa = GetISALevel();
+        if (isa >= SimdISA::AVX512 && avx512)
+            return avx512;
+        if (isa >= SimdISA::AVX2 && avx2)
+            return avx2;
+        return baseline;
+    }
 }
 
+// Resolves the kernel function pointer to the best variant once (thread-safe static initialization). Usage: SIMD_KERNEL_DISPATCH(kernel, KernelType, Baseline, VariantAVX2, VariantAVX512); kernel();
+#define SIMD_KERNEL_DISPATCH(name, type, ...) static const type name = SIMD::SelectKernel<type>(__VA_ARGS__)
+
+// Marks the wider kernel variants so the compiler emits the matching instruction set for just that function while the module itself stays at the baseline target. Guard the variants (and their dispatch call sites) with SIMD_HAS_AVX_KERNELS.
+#if PLATFORM_SIMD_SSE2 && (defined(__clang__) || defined(__GNUC__))
+#define SIMD_HAS_AVX_KERNELS 1
+#define SIMD_KERNEL_AVX2 __attribute__((target("avx2,fma")))
+#define SIMD_KERNEL_AVX512 __attribute__((target("avx512f,avx512bw,avx512dq,avx512vl")))
+#elif PLATFORM_SIMD_SSE2 && defined(_MSC_VER)
+// MSVC compiles AVX intrinsics regardless of the module-wide /arch setting
+#define SIMD_HAS_AVX_KERNELS 1
+#define SIMD_KERNEL_AVX2
+#define SIMD_KERNEL_AVX512
+#else
+#define SIMD_HAS_AVX_KERNELS 0
+#define SIMD_KERNEL_AVX2
+#define SIMD_KERNEL_AVX512
 #endif
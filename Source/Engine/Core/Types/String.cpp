@@ -17,7 +17,7 @@ String::String(const StringView& str)
     if (_length != 0)
     {
         ASSERT(_length > 0);
-        _data = (Char*)Platform::Allocate((_length + 1) * sizeof(Char), 16);
+        _data = AllocateBuffer(_length);
         _data[_length] = 0;
         Platform::MemoryCopy(_data, str.Get(), _length * sizeof(Char));
     }
@@ -37,10 +37,10 @@ void String::Set(const Char* chars, int32 length)
     if (length != _length)
     {
         ASSERT(length >= 0);
-        Platform::Free(_data);
+        FreeBuffer(_data);
         if (length != 0)
         {
-            _data = (Char*)Platform::Allocate((length + 1) * sizeof(Char), 16);
+            _data = AllocateBuffer(length);
             _data[length] = 0;
         }
         else
@@ -56,10 +56,10 @@ void String::Set(const char* chars, int32 length)
 {
     if (length != _length)
     {
-        Platform::Free(_data);
+        FreeBuffer(_data);
         if (length != 0)
         {
-            _data = (Char*)Platform::Allocate((length + 1) * sizeof(Char), 16);
+            _data = AllocateBuffer(length);
             _data[length] = 0;
         }
         else
@@ -74,7 +74,8 @@ void String::Set(const char* chars, int32 length)
 
 void String::SetUTF8(const char* chars, int32 length)
 {
-    Platform::Free(_data);
+    FreeBuffer(_data);
+    // Conversion allocates the buffer so short strings end up on the heap here
     _data = StringUtils::ConvertUTF82UTF16(chars, length, _length);
 }
 
@@ -87,13 +88,20 @@ void String::Append(const Char* chars, int32 count)
     const auto oldLength = _length;
 
     _length = oldLength + count;
-    _data = (Char*)Platform::Allocate((_length + 1) * sizeof(Char), 16);
+    if (IsInlined() && _length <= InlineCapacity)
+    {
+        // Contents stay within the inline storage
+        Platform::MemoryCopy(_data + oldLength, chars, count * sizeof(Char));
+        _data[_length] = 0;
+        return;
+    }
+    _data = AllocateBuffer(_length);
 
     Platform::MemoryCopy(_data, oldData, oldLength * sizeof(Char));
     Platform::MemoryCopy(_data + oldLength, chars, count * sizeof(Char));
     _data[_length] = 0;
 
-    Platform::Free(oldData);
+    FreeBuffer(oldData);
 }
 
 void String::Append(const char* chars, int32 count)
@@ -105,13 +113,20 @@ void String::Append(const char* chars, int32 count)
     const auto oldLength = _length;
 
     _length = oldLength + count;
-    _data = (Char*)Platform::Allocate((_length + 1) * sizeof(Char), 16);
+    if (IsInlined() && _length <= InlineCapacity)
+    {
+        // Contents stay within the inline storage
+        StringUtils::ConvertANSI2UTF16(chars, _data + oldLength, count * sizeof(Char));
+        _data[_length] = 0;
+        return;
+    }
+    _data = AllocateBuffer(_length);
 
     Platform::MemoryCopy(_data, oldData, oldLength * sizeof(Char));
     StringUtils::ConvertANSI2UTF16(chars, _data + oldLength, count * sizeof(Char));
     _data[_length] = 0;
 
-    Platform::Free(oldData);
+    FreeBuffer(oldData);
 }
 
 String& String::operator+=(const StringView& str)
@@ -142,23 +157,31 @@ void String::Insert(int32 startIndex, const String& other)
         return;
     }
 
-    const auto oldData = _data;
+    auto oldData = _data;
     const auto oldLength = _length;
 
     _length = oldLength + otherLength;
-    _data = (Char*)Platform::Allocate((_length + 1) * sizeof(Char), 16);
+    Char inlineCopy[InlineCapacity + 1];
+    if (IsInlined() && _length <= InlineCapacity)
+    {
+        // Copy the contents aside when both the old and the new text fit into the inline storage
+        Platform::MemoryCopy(inlineCopy, oldData, (oldLength + 1) * sizeof(Char));
+        oldData = inlineCopy;
+    }
+    _data = AllocateBuffer(_length);
 
     Platform::MemoryCopy(_data, oldData, startIndex * sizeof(Char));
     Platform::MemoryCopy(_data + startIndex, other.Get(), otherLength * sizeof(Char));
     Platform::MemoryCopy(_data + startIndex + otherLength, oldData + startIndex, (oldLength - startIndex) * sizeof(Char));
     _data[_length] = 0;
 
-    Platform::Free(oldData);
+    if (oldData != inlineCopy)
+        FreeBuffer(oldData);
 }
 
 void String::Remove(int32 startIndex, int32 length)
 {
-    const auto oldData = _data;
+    auto oldData = _data;
     const auto oldLength = _length;
     ASSERT(startIndex >= 0 && startIndex + length <= oldLength);
 
@@ -169,13 +192,21 @@ void String::Remove(int32 startIndex, int32 length)
     }
 
     _length = oldLength - length;
-    _data = (Char*)Platform::Allocate((_length + 1) * sizeof(Char), 16);
+    Char inlineCopy[InlineCapacity + 1];
+    if (IsInlined())
+    {
+        // Copy the contents aside to avoid overlapping the inline storage during the rebuild
+        Platform::MemoryCopy(inlineCopy, oldData, (oldLength + 1) * sizeof(Char));
+        oldData = inlineCopy;
+    }
+    _data = AllocateBuffer(_length);
 
     Platform::MemoryCopy(_data, oldData, startIndex * sizeof(Char));
     Platform::MemoryCopy(_data + startIndex, oldData + startIndex + length, (_length - startIndex) * sizeof(Char));
     _data[_length] = 0;
 
-    Platform::Free(oldData);
+    if (oldData != inlineCopy)
+        FreeBuffer(oldData);
 }
 
 void String::Split(Char c, Array<String>& results) const
@@ -362,10 +393,10 @@ void StringAnsi::Set(const char* chars, int32 length)
     if (length != _length)
     {
         ASSERT(length >= 0);
-        Platform::Free(_data);
+        FreeBuffer(_data);
         if (length != 0)
         {
-            _data = (char*)Platform::Allocate((length + 1) * sizeof(char), 16);
+            _data = AllocateBuffer(length);
             _data[length] = 0;
         }
         else
@@ -382,10 +413,10 @@ void StringAnsi::Set(const Char* chars, int32 length)
 {
     if (length != _length)
     {
-        Platform::Free(_data);
+        FreeBuffer(_data);
         if (length != 0)
         {
-            _data = (char*)Platform::Allocate((length + 1) * sizeof(char), 16);
+            _data = AllocateBuffer(length);
             _data[length] = 0;
         }
         else
@@ -408,13 +439,20 @@ void StringAnsi::Append(const char* chars, int32 count)
     const auto oldLength = _length;
 
     _length = oldLength + count;
-    _data = (char*)Platform::Allocate((_length + 1) * sizeof(char), 16);
+    if (IsInlined() && _length <= InlineCapacity)
+    {
+        // Contents stay within the inline storage
+        Platform::MemoryCopy(_data + oldLength, chars, count * sizeof(char));
+        _data[_length] = 0;
+        return;
+    }
+    _data = AllocateBuffer(_length);
 
     Platform::MemoryCopy(_data, oldData, oldLength * sizeof(char));
     Platform::MemoryCopy(_data + oldLength, chars, count * sizeof(char));
     _data[_length] = 0;
 
-    Platform::Free(oldData);
+    FreeBuffer(oldData);
 }
 
 void StringAnsi::Append(const Char* chars, int32 count)
@@ -426,13 +464,20 @@ void StringAnsi::Append(const Char* chars, int32 count)
     const auto oldLength = _length;
 
     _length = oldLength + count;
-    _data = (char*)Platform::Allocate((_length + 1) * sizeof(char), 16);
+    if (IsInlined() && _length <= InlineCapacity)
+    {
+        // Contents stay within the inline storage
+        StringUtils::ConvertUTF162ANSI(chars, _data + oldLength, count * sizeof(char));
+        _data[_length] = 0;
+        return;
+    }
+    _data = AllocateBuffer(_length);
 
     Platform::MemoryCopy(_data, oldData, oldLength * sizeof(char));
     StringUtils::ConvertUTF162ANSI(chars, _data + oldLength, count * sizeof(char));
     _data[_length] = 0;
 
-    Platform::Free(oldData);
+    FreeBuffer(oldData);
 }
 
 StringAnsi& StringAnsi::operator+=(const StringAnsiView& str)
@@ -497,23 +542,31 @@ void StringAnsi::Insert(int32 startIndex, const StringAnsi& other)
         return;
     }
 
-    const auto oldData = _data;
+    auto oldData = _data;
     const auto oldLength = _length;
 
     _length = oldLength + otherLength;
-    _data = (char*)Platform::Allocate((_length + 1) * sizeof(char), 16);
+    char inlineCopy[InlineCapacity + 1];
+    if (IsInlined() && _length <= InlineCapacity)
+    {
+        // Copy the contents aside when both the old and the new text fit into the inline storage
+        Platform::MemoryCopy(inlineCopy, oldData, (oldLength + 1) * sizeof(char));
+        oldData = inlineCopy;
+    }
+    _data = AllocateBuffer(_length);
 
     Platform::MemoryCopy(_data, oldData, startIndex * sizeof(char));
     Platform::MemoryCopy(_data + startIndex, other.Get(), otherLength * sizeof(char));
     Platform::MemoryCopy(_data + startIndex + otherLength, oldData + startIndex, (oldLength - startIndex) * sizeof(char));
     _data[_length] = 0;
 
-    Platform::Free(oldData);
+    if (oldData != inlineCopy)
+        FreeBuffer(oldData);
 }
 
 void StringAnsi::Remove(int32 startIndex, int32 length)
 {
-    const auto oldData = _data;
+    auto oldData = _data;
     const auto oldLength = _length;
     ASSERT(startIndex >= 0 && startIndex + length <= oldLength);
 
@@ -524,13 +577,21 @@ void StringAnsi::Remove(int32 startIndex, int32 length)
     }
 
     _length = oldLength - length;
-    _data = (char*)Platform::Allocate((_length + 1) * sizeof(char), 16);
+    char inlineCopy[InlineCapacity + 1];
+    if (IsInlined())
+    {
+        // Copy the contents aside to avoid overlapping the inline storage during the rebuild
+        Platform::MemoryCopy(inlineCopy, oldData, (oldLength + 1) * sizeof(char));
+        oldData = inlineCopy;
+    }
+    _data = AllocateBuffer(_length);
 
     Platform::MemoryCopy(_data, oldData, startIndex * sizeof(char));
     Platform::MemoryCopy(_data + startIndex, oldData + startIndex + length, length * sizeof(char));
     _data[_length] = 0;
 
-    Platform::Free(oldData);
+    if (oldData != inlineCopy)
+        FreeBuffer(oldData);
 }
 
 void StringAnsi::Split(char c, Array<StringAnsi>& results) const
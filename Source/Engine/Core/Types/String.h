@@ -7,14 +7,38 @@
 #include "Engine/Core/Formatting.h"
 
 /// <summary>
-/// Represents text as a sequence of characters. Container uses a single dynamic memory allocation to store the characters data. Characters sequence is always null-terminated.
+/// Represents text as a sequence of characters. Small texts are stored inline within the string object itself (Small String Optimization), longer ones use a single dynamic memory allocation. Characters sequence is always null-terminated.
 /// </summary>
 template<typename T>
 class StringBase
 {
+public:
+    // The amount of characters that can be stored inline within the string object itself, without a heap allocation (Small String Optimization).
+    static const int32 InlineCapacity = 14;
+
 protected:
     T* _data = nullptr;
     int32 _length = 0;
+    T _inlineData[InlineCapacity + 1];
+
+    // Returns true if the string characters are stored in the inline storage (no heap allocation).
+    FORCE_INLINE bool IsInlined() const
+    {
+        return _data == _inlineData;
+    }
+
+    // Gets the buffer for the given amount of characters (excluding null-terminator char), using the inline storage when contents fit.
+    FORCE_INLINE T* AllocateBuffer(int32 length)
+    {
+        return length <= InlineCapacity ? _inlineData : (T*)Platform::Allocate((length + 1) * sizeof(T), 16);
+    }
+
+    // Frees the characters buffer (unless it's the inline storage).
+    FORCE_INLINE void FreeBuffer(T* data)
+    {
+        if (data != _inlineData)
+            Platform::Free(data);
+    }
 
 public:
     /// <summary>
@@ -22,7 +46,7 @@ public:
     /// </summary>
     ~StringBase()
     {
-        Platform::Free(_data);
+        FreeBuffer(_data);
     }
 
 public:
@@ -31,7 +55,7 @@ public:
     /// </summary>
     void Clear()
     {
-        Platform::Free(_data);
+        FreeBuffer(_data);
         _data = nullptr;
         _length = 0;
     }
@@ -332,10 +356,10 @@ public:
         ASSERT(length >= 0);
         if (length == _length)
             return;
-        Platform::Free(_data);
+        FreeBuffer(_data);
         if (length != 0)
         {
-            _data = (T*)Platform::Allocate((length + 1) * sizeof(T), 16);
+            _data = AllocateBuffer(length);
             _data[length] = 0;
         }
         else
@@ -470,9 +494,16 @@ public:
             }
 
             const auto oldLength = _length;
-            const auto oldData = _data;
+            auto oldData = _data;
             _length += replacedCount * (replacementTextLength - searchTextLength);
-            _data = (T*)Platform::Allocate((_length + 1) * sizeof(T), 16);
+            T inlineCopy[InlineCapacity + 1];
+            if (IsInlined() && _length <= InlineCapacity)
+            {
+                // Copy the contents aside when both the old and the new text fit into the inline storage
+                Platform::MemoryCopy(inlineCopy, oldData, (oldLength + 1) * sizeof(T));
+                oldData = inlineCopy;
+            }
+            _data = AllocateBuffer(_length);
 
             T* writePosition = _data;
             readPosition = oldData;
@@ -495,7 +526,8 @@ public:
             Platform::MemoryCopy(writePosition, readPosition, writeOffset * sizeof(T));
 
             _data[_length] = 0;
-            Platform::Free(oldData);
+            if (oldData != inlineCopy)
+                FreeBuffer(oldData);
         }
 
         return replacedCount;
@@ -529,10 +561,16 @@ public:
             const auto oldData = _data;
             const auto minLength = _length < length ? _length : length;
             _length = length;
-            _data = (T*)Platform::Allocate((length + 1) * sizeof(T), 16);
+            if (IsInlined() && length <= InlineCapacity)
+            {
+                // Contents stay within the inline storage
+                _data[length] = 0;
+                return;
+            }
+            _data = AllocateBuffer(length);
             Platform::MemoryCopy(_data, oldData, minLength * sizeof(T));
             _data[length] = 0;
-            Platform::Free(oldData);
+            FreeBuffer(oldData);
         }
     }
 };
@@ -570,8 +608,17 @@ public:
     /// <param name="str">The double reference to the string.</param>
     String(String&& str) noexcept
     {
-        _data = str._data;
         _length = str._length;
+        if (str.IsInlined())
+        {
+            // Inline contents cannot be stolen so copy them over
+            _data = _inlineData;
+            Platform::MemoryCopy(_inlineData, str._inlineData, (_length + 1) * sizeof(Char));
+        }
+        else
+        {
+            _data = str._data;
+        }
         str._data = nullptr;
         str._length = 0;
     }
@@ -756,7 +803,7 @@ public:
     {
         String result;
         result._length = a.Length() + 1;
-        result._data = (Char*)Platform::Allocate((result._length + 1) * sizeof(Char), 16);
+        result._data = result.AllocateBuffer(result._length);
         Platform::MemoryCopy(result._data, a.Get(), a.Length() * sizeof(Char));
         result._data[a.Length()] = b;
         result._data[result._length] = 0;
@@ -773,9 +820,17 @@ public:
     {
         if (this != &s)
         {
-            Platform::Free(_data);
-            _data = s._data;
+            FreeBuffer(_data);
             _length = s._length;
+            if (s.IsInlined())
+            {
+                _data = _inlineData;
+                Platform::MemoryCopy(_inlineData, s._inlineData, (_length + 1) * sizeof(Char));
+            }
+            else
+            {
+                _data = s._data;
+            }
             s._data = nullptr;
             s._length = 0;
         }
@@ -1274,8 +1329,17 @@ public:
     /// <param name="str">The double reference to the string.</param>
     StringAnsi(StringAnsi&& str) noexcept
     {
-        _data = str._data;
         _length = str._length;
+        if (str.IsInlined())
+        {
+            // Inline contents cannot be stolen so copy them over
+            _data = _inlineData;
+            Platform::MemoryCopy(_inlineData, str._inlineData, (_length + 1) * sizeof(char));
+        }
+        else
+        {
+            _data = str._data;
+        }
         str._data = nullptr;
         str._length = 0;
     }
@@ -1453,7 +1517,7 @@ public:
     {
         StringAnsi result;
         result._length = a.Length() + 1;
-        result._data = (char*)Platform::Allocate((result._length + 1) * sizeof(char), 16);
+        result._data = result.AllocateBuffer(result._length);
         Platform::MemoryCopy(result._data, a.Get(), a.Length() * sizeof(char));
         result._data[a.Length()] = b;
         result._data[result._length] = 0;
@@ -1470,9 +1534,17 @@ public:
     {
         if (this != &s)
         {
-            Platform::Free(_data);
-            _data = s._data;
+            FreeBuffer(_data);
             _length = s._length;
+            if (s.IsInlined())
+            {
+                _data = _inlineData;
+                Platform::MemoryCopy(_inlineData, s._inlineData, (_length + 1) * sizeof(char));
+            }
+            else
+            {
+                _data = s._data;
+            }
             s._data = nullptr;
             s._length = 0;
         }
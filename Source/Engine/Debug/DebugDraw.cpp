@@ -22,6 +22,7 @@
 #include "Engine/Graphics/Shaders/GPUShader.h"
 #include "Engine/Animations/AnimationUtils.h"
 #include "Engine/Profiler/Profiler.h"
+#include "Engine/Threading/JobSystem.h"
 #include "Engine/Debug/DebugLog.h"
 #include "Engine/Render2D/Render2D.h"
 #include "Engine/Render2D/FontAsset.h"
@@ -178,8 +179,9 @@ struct PsData
 };
 
 template<typename T>
-void UpdateList(float dt, Array<T>& list)
+bool UpdateList(float dt, Array<T>& list)
 {
+    bool removed = false;
     for (int32 i = 0; i < list.Count() && list.HasItems(); i++)
     {
         list[i].TimeLeft -= dt;
@@ -187,8 +189,10 @@ void UpdateList(float dt, Array<T>& list)
         {
             list.RemoveAt(i);
             i--;
+            removed = true;
         }
     }
+    return removed;
 }
 
 void TeleportList(const Float3& delta, Array<DebugLine>& list)
@@ -239,6 +243,11 @@ struct DebugDrawData
     Array<DebugText3D> DefaultText3D;
     Array<DebugText3D> OneFrameText3D;
 
+    // Baked vertices for the persistent lists (shapes alive over multiple frames stay baked; new shapes append, any expiration triggers a rebake)
+    Array<Vertex> DefaultLinesVB;
+    Array<Vertex> DefaultTrianglesVB;
+    Array<Vertex> DefaultWireTrianglesVB;
+
     inline int32 Count() const
     {
         return LinesCount() + TrianglesCount() + TextCount();
@@ -277,9 +286,12 @@ struct DebugDrawData
 
     inline void Update(float deltaTime)
     {
-        UpdateList(deltaTime, DefaultLines);
-        UpdateList(deltaTime, DefaultTriangles);
-        UpdateList(deltaTime, DefaultWireTriangles);
+        if (UpdateList(deltaTime, DefaultLines))
+            DefaultLinesVB.Clear();
+        if (UpdateList(deltaTime, DefaultTriangles))
+            DefaultTrianglesVB.Clear();
+        if (UpdateList(deltaTime, DefaultWireTriangles))
+            DefaultWireTrianglesVB.Clear();
         UpdateList(deltaTime, DefaultText2D);
         UpdateList(deltaTime, DefaultText3D);
 
@@ -293,6 +305,9 @@ struct DebugDrawData
     void Teleport(const Float3& delta)
     {
         TeleportList(delta, DefaultLines);
+        TeleportList(delta, DefaultLinesVB);
+        TeleportList(delta, DefaultTrianglesVB);
+        TeleportList(delta, DefaultWireTrianglesVB);
         TeleportList(delta, OneFrameLines);
         TeleportList(delta, DefaultTriangles);
         TeleportList(delta, OneFrameTriangles);
@@ -314,6 +329,9 @@ struct DebugDrawData
         OneFrameText2D.Clear();
         DefaultText3D.Clear();
         OneFrameText3D.Clear();
+        DefaultLinesVB.Clear();
+        DefaultTrianglesVB.Clear();
+        DefaultWireTrianglesVB.Clear();
     }
 
     inline void Release()
@@ -328,6 +346,9 @@ struct DebugDrawData
         OneFrameText2D.Resize(0);
         DefaultText3D.Resize(0);
         OneFrameText3D.Resize(0);
+        DefaultLinesVB.Resize(0);
+        DefaultTrianglesVB.Resize(0);
+        DefaultWireTrianglesVB.Resize(0);
     }
 };
 
@@ -427,6 +448,59 @@ DebugDrawCall WriteList(int32& vertexCounter, const Array<DebugTriangle>& list)
     return drawCall;
 }
 
+// Bakes the persistent lines vertices into the retained cache (only the newly added tail gets generated, in parallel when large)
+void BakeList(const Array<DebugLine>& list, Array<Vertex>& cache)
+{
+    int32 baked = cache.Count() / 2;
+    const int32 count = list.Count();
+    if (baked > count)
+    {
+        cache.Clear();
+        baked = 0;
+    }
+    if (baked == count)
+        return;
+    cache.Resize(count * 2);
+    Vertex* dst = cache.Get();
+    const DebugLine* src = list.Get();
+    JobSystem::ParallelFor(baked, count, 16 * 1024, [dst, src](int32 begin, int32 end)
+    {
+        for (int32 i = begin; i < end; i++)
+        {
+            const DebugLine& l = src[i];
+            dst[i * 2 + 0] = { l.Start, l.Color };
+            dst[i * 2 + 1] = { l.End, l.Color };
+        }
+    });
+}
+
+// Bakes the persistent triangles vertices into the retained cache (only the newly added tail gets generated, in parallel when large)
+void BakeList(const Array<DebugTriangle>& list, Array<Vertex>& cache)
+{
+    int32 baked = cache.Count() / 3;
+    const int32 count = list.Count();
+    if (baked > count)
+    {
+        cache.Clear();
+        baked = 0;
+    }
+    if (baked == count)
+        return;
+    cache.Resize(count * 3);
+    Vertex* dst = cache.Get();
+    const DebugTriangle* src = list.Get();
+    JobSystem::ParallelFor(baked, count, 16 * 1024, [dst, src](int32 begin, int32 end)
+    {
+        for (int32 i = begin; i < end; i++)
+        {
+            const DebugTriangle& t = src[i];
+            dst[i * 3 + 0] = { t.V0, t.Color };
+            dst[i * 3 + 1] = { t.V1, t.Color };
+            dst[i * 3 + 2] = { t.V2, t.Color };
+        }
+    });
+}
+
 template<typename T, typename U>
 DebugDrawCall WriteLists(int32& vertexCounter, const Array<T>& listA, const Array<U>& listB)
 {
@@ -740,14 +814,23 @@ void DebugDraw::Draw(RenderContext& renderContext, GPUTextureView* target, GPUTe
     DebugDrawCall depthTestLines, defaultLines, depthTestTriangles, defaultTriangles, depthTestWireTriangles, defaultWireTriangles;
     {
         PROFILE_CPU_NAMED("Update Buffer");
+
+        // Refresh the retained vertices of the persistent shapes (no-op if nothing was added nor expired since the last bake)
+        BakeList(Context->DebugDrawDepthTest.DefaultLines, Context->DebugDrawDepthTest.DefaultLinesVB);
+        BakeList(Context->DebugDrawDefault.DefaultLines, Context->DebugDrawDefault.DefaultLinesVB);
+        BakeList(Context->DebugDrawDepthTest.DefaultTriangles, Context->DebugDrawDepthTest.DefaultTrianglesVB);
+        BakeList(Context->DebugDrawDefault.DefaultTriangles, Context->DebugDrawDefault.DefaultTrianglesVB);
+        BakeList(Context->DebugDrawDepthTest.DefaultWireTriangles, Context->DebugDrawDepthTest.DefaultWireTrianglesVB);
+        BakeList(Context->DebugDrawDefault.DefaultWireTriangles, Context->DebugDrawDefault.DefaultWireTrianglesVB);
+
         DebugDrawVB->Clear();
         int32 vertexCounter = 0;
-        depthTestLines = WriteLists(vertexCounter, Context->DebugDrawDepthTest.DefaultLines, Context->DebugDrawDepthTest.OneFrameLines);
-        defaultLines = WriteLists(vertexCounter, Context->DebugDrawDefault.DefaultLines, Context->DebugDrawDefault.OneFrameLines);
-        depthTestTriangles = WriteLists(vertexCounter, Context->DebugDrawDepthTest.DefaultTriangles, Context->DebugDrawDepthTest.OneFrameTriangles);
-        defaultTriangles = WriteLists(vertexCounter, Context->DebugDrawDefault.DefaultTriangles, Context->DebugDrawDefault.OneFrameTriangles);
-        depthTestWireTriangles = WriteLists(vertexCounter, Context->DebugDrawDepthTest.DefaultWireTriangles, Context->DebugDrawDepthTest.OneFrameWireTriangles);
-        defaultWireTriangles = WriteLists(vertexCounter, Context->DebugDrawDefault.DefaultWireTriangles, Context->DebugDrawDefault.OneFrameWireTriangles);
+        depthTestLines = WriteLists(vertexCounter, Context->DebugDrawDepthTest.DefaultLinesVB, Context->DebugDrawDepthTest.OneFrameLines);
+        defaultLines = WriteLists(vertexCounter, Context->DebugDrawDefault.DefaultLinesVB, Context->DebugDrawDefault.OneFrameLines);
+        depthTestTriangles = WriteLists(vertexCounter, Context->DebugDrawDepthTest.DefaultTrianglesVB, Context->DebugDrawDepthTest.OneFrameTriangles);
+        defaultTriangles = WriteLists(vertexCounter, Context->DebugDrawDefault.DefaultTrianglesVB, Context->DebugDrawDefault.OneFrameTriangles);
+        depthTestWireTriangles = WriteLists(vertexCounter, Context->DebugDrawDepthTest.DefaultWireTrianglesVB, Context->DebugDrawDepthTest.OneFrameWireTriangles);
+        defaultWireTriangles = WriteLists(vertexCounter, Context->DebugDrawDefault.DefaultWireTrianglesVB, Context->DebugDrawDefault.OneFrameWireTriangles);
         {
             PROFILE_CPU_NAMED("Flush");
             DebugDrawVB->Flush(context);
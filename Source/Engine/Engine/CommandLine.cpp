@@ -144,6 +144,8 @@ bool CommandLine::Parse(const Char* cmdLine)
     PARSE_BOOL_SWITCH("-monolog ", MonoLog);
     PARSE_BOOL_SWITCH("-mute ", Mute);
     PARSE_BOOL_SWITCH("-lowdpi ", LowDPI);
+    PARSE_ARG_SWITCH("-replayrecord ", ReplayRecord);
+    PARSE_ARG_SWITCH("-replayplay ", ReplayPlay);
 
 #if USE_EDITOR
 
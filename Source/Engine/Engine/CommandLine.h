@@ -127,6 +127,16 @@ public:
         /// </summary>
         Nullable<bool> LowDPI;
 
+        /// <summary>
+        /// -replayrecord !path! (captures the session time deltas and input into a deterministic replay file)
+        /// </summary>
+        Nullable<String> ReplayRecord;
+
+        /// <summary>
+        /// -replayplay !path! (feeds the captured deterministic replay file back to re-execute the session)
+        /// </summary>
+        Nullable<String> ReplayPlay;
+
 #if USE_EDITOR
 
         /// <summary>
@@ -11,6 +11,7 @@
 #include "Engine/Core/Core.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/ObjectsRemovalService.h"
+#include "Engine/Core/Memory/Allocation.h"
 #include "Engine/Core/Types/String.h"
 #include "Engine/Platform/Platform.h"
 #include "Engine/Platform/Window.h"
@@ -91,6 +92,11 @@ int32 Engine::Main(const Char* cmdLine)
     CommandLine::Options.Mute = true;
     CommandLine::Options.Std = true;
 #endif
+#if USE_HEADLESS
+    // Headless server profile always runs without a window on the null device (the only backend compiled into the build)
+    CommandLine::Options.Headless = true;
+    CommandLine::Options.Null = true;
+#endif
 
     if (Platform::Init())
     {
@@ -211,6 +217,9 @@ int32 Engine::Main(const Char* cmdLine)
 
         // Collect physics simulation results (does nothing if Simulate hasn't been called in the previous loop step)
         Physics::CollectResults();
+
+        // Recycle the per-thread frame arenas (any transient frame-allocated data becomes invalid)
+        FrameAllocation::EndFrame();
     }
 
     // Call on exit event
@@ -329,6 +338,7 @@ void Engine::OnDraw()
     // Begin frame rendering
     FrameCount++;
     const double time = Platform::GetTimeSeconds();
+#if !USE_HEADLESS
     auto device = GPUDevice::Instance;
     device->Locker.Lock();
 #if COMPILE_WITH_PROFILER
@@ -342,6 +352,7 @@ void Engine::OnDraw()
     ProfilerGPU::EndFrame();
 #endif
     device->Locker.Unlock();
+#endif
 
     // Calculate FPS
     EngineImpl::FpsAccumulatedFrames++;
@@ -363,7 +374,9 @@ void Engine::OnDraw()
 
 bool Engine::IsHeadless()
 {
-#if PLATFORM_HAS_HEADLESS_MODE
+#if USE_HEADLESS
+    return true;
+#elif PLATFORM_HAS_HEADLESS_MODE
     return CommandLine::Options.Headless.IsTrue();
 #else
     return false;
@@ -478,6 +491,7 @@ void Engine::OnExit()
 #if COMPILE_WITH_PROFILER
     ProfilerCPU::Dispose();
     ProfilerGPU::Dispose();
+    ProfilerMemory::Dispose();
 #endif
 
     // Close logging service
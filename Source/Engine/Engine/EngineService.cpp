@@ -4,6 +4,7 @@
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Collections/Array.h"
 #include "Engine/Core/Collections/Sorting.h"
+#include "Engine/Threading/JobSystem.h"
 #include <ThirdParty/tracy/tracy/Tracy.hpp>
 
 static bool CompareEngineServices(EngineService* const& a, EngineService* const& b)
@@ -69,13 +70,43 @@ void EngineService::OnInit()
     ZoneScoped;
     Sort();
 
-    // Init services from front to back
+    // Init services from front to back. The order value declares the dependencies: a service can depend only on services with a lower order,
+    // so services sharing the same order have no ordering guarantees between each other and can initialize in parallel once the job system is running.
     auto& services = GetServices();
 #if TRACY_ENABLE
     Char nameBuffer[100];
 #endif
     for (int32 i = 0; i < services.Count(); i++)
     {
+        // Collect the run of services that share the order value
+        int32 batchEnd = i;
+        while (batchEnd + 1 < services.Count() && services[batchEnd + 1]->Order == services[i]->Order)
+            batchEnd++;
+
+        if (batchEnd != i && JobSystem::GetThreadsCount() != 0)
+        {
+            // Initialize the whole batch in parallel on the job system
+            const int32 batchStart = i;
+            volatile int64 failed = -1;
+            for (int32 j = batchStart; j <= batchEnd; j++)
+            {
+                LOG(Info, "Initialize {0}...", StringView(services[j]->Name));
+                services[j]->IsInitialized = true;
+            }
+            JobSystem::Execute([&services, batchStart, &failed](int32 index)
+            {
+                if (services[batchStart + index]->Init())
+                    Platform::AtomicStore(&failed, batchStart + index);
+            }, batchEnd - batchStart + 1);
+            const int64 failedIndex = Platform::AtomicRead(&failed);
+            if (failedIndex != -1)
+            {
+                Platform::Fatal(String::Format(TEXT("Failed to initialize {0}."), StringView(services[(int32)failedIndex]->Name)));
+            }
+            i = batchEnd;
+            continue;
+        }
+
         const auto service = services[i];
         const StringView name(service->Name);
 #if TRACY_ENABLE
@@ -0,0 +1,359 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "Replay.h"
+#include "CommandLine.h"
+#include "EngineService.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Input/Input.h"
+#include "Engine/Input/Mouse.h"
+#include "Engine/Input/Keyboard.h"
+#include "Engine/Platform/Platform.h"
+#include "Engine/Serialization/FileReadStream.h"
+#include "Engine/Serialization/FileWriteStream.h"
+
+// Replay stream format version (bump when changing the records layout)
+#define REPLAY_VERSION 1
+
+// Replay stream records (ticks are encoded as tag pairs: tick with a delta time, or a skipped tick)
+#define REPLAY_RECORD_TICK(type) (1 + (byte)(type) * 2)
+#define REPLAY_RECORD_TICK_SKIP(type) (2 + (byte)(type) * 2)
+#define REPLAY_RECORD_INPUT 5
+
+namespace ReplayImpl
+{
+    const int32 MagicCode = 1498173522;
+    Replay::Modes Mode = Replay::Modes::None;
+    FileWriteStream* OutputStream = nullptr;
+    FileReadStream* InputStream = nullptr;
+    uint64 FramesCount = 0;
+
+    void OnDesync()
+    {
+        LOG(Warning, "Replay stream desynchronized after {0} frames. Stopping playback.", FramesCount);
+        Replay::Stop();
+    }
+}
+
+using namespace ReplayImpl;
+
+class ReplayService : public EngineService
+{
+public:
+    ReplayService()
+        : EngineService(TEXT("Replay"), -70)
+    {
+    }
+
+    bool Init() override;
+    void Dispose() override;
+};
+
+ReplayService ReplayServiceInstance;
+
+bool ReplayService::Init()
+{
+    // Start the session capture or playback if requested from the command line
+    if (CommandLine::Options.ReplayPlay.HasValue())
+        Replay::StartPlayback(CommandLine::Options.ReplayPlay.GetValue());
+    else if (CommandLine::Options.ReplayRecord.HasValue())
+        Replay::StartRecord(CommandLine::Options.ReplayRecord.GetValue());
+    return false;
+}
+
+void ReplayService::Dispose()
+{
+    Replay::Stop();
+}
+
+Replay::Modes Replay::GetMode()
+{
+    return Mode;
+}
+
+bool Replay::IsPlayback()
+{
+    return Mode == Modes::Play;
+}
+
+bool Replay::IsRecording()
+{
+    return Mode == Modes::Record;
+}
+
+bool Replay::StartRecord(const StringView& path)
+{
+    Stop();
+    auto stream = FileWriteStream::Open(path);
+    if (stream == nullptr)
+    {
+        LOG(Warning, "Failed to open replay output file \'{0}\'", String(path));
+        return true;
+    }
+    stream->WriteInt32(MagicCode);
+    stream->WriteInt32(REPLAY_VERSION);
+    OutputStream = stream;
+    FramesCount = 0;
+    Mode = Modes::Record;
+    LOG(Info, "Replay recording started (output: \'{0}\')", String(path));
+    return false;
+}
+
+bool Replay::StartPlayback(const StringView& path)
+{
+    Stop();
+    auto stream = FileReadStream::Open(path);
+    if (stream == nullptr)
+    {
+        LOG(Warning, "Failed to open replay input file \'{0}\'", String(path));
+        return true;
+    }
+    int32 magicCode, version;
+    stream->ReadInt32(&magicCode);
+    stream->ReadInt32(&version);
+    if (magicCode != MagicCode || version != REPLAY_VERSION)
+    {
+        LOG(Warning, "Invalid replay file \'{0}\'", String(path));
+        Delete(stream);
+        return true;
+    }
+    InputStream = stream;
+    FramesCount = 0;
+    Mode = Modes::Play;
+    LOG(Info, "Replay playback started (input: \'{0}\')", String(path));
+    return false;
+}
+
+void Replay::Stop()
+{
+    if (Mode == Modes::None)
+        return;
+    if (OutputStream)
+    {
+        OutputStream->Flush();
+        Delete(OutputStream);
+        OutputStream = nullptr;
+        LOG(Info, "Replay recording stopped ({0} frames captured)", FramesCount);
+    }
+    if (InputStream)
+    {
+        Delete(InputStream);
+        InputStream = nullptr;
+        LOG(Info, "Replay playback stopped ({0} frames replayed)", FramesCount);
+    }
+    Mode = Modes::None;
+}
+
+bool Replay::OnTickBegin(Time::TickData& data, TickTypes type, bool& ticked)
+{
+    if (Mode != Modes::Play)
+        return false;
+    if (InputStream->GetPosition() >= InputStream->GetLength())
+    {
+        // End of the captured session
+        LOG(Info, "Replay playback finished");
+        Stop();
+        return false;
+    }
+    const byte tag = InputStream->ReadByte();
+    if (tag == REPLAY_RECORD_TICK(type))
+    {
+        // Drive the game clock with the captured step
+        double deltaTime;
+        InputStream->ReadDouble(&deltaTime);
+        data.Advance(Platform::GetTimeSeconds(), deltaTime);
+        ticked = true;
+        if (type == TickTypes::Update)
+            FramesCount++;
+    }
+    else if (tag == REPLAY_RECORD_TICK_SKIP(type))
+    {
+        ticked = false;
+    }
+    else
+    {
+        OnDesync();
+        return false;
+    }
+    return true;
+}
+
+void Replay::OnTickRecord(TickTypes type, bool ticked, double deltaTime)
+{
+    if (Mode != Modes::Record)
+        return;
+    if (ticked)
+    {
+        OutputStream->WriteByte(REPLAY_RECORD_TICK(type));
+        OutputStream->WriteDouble(deltaTime);
+        if (type == TickTypes::Update)
+            FramesCount++;
+    }
+    else
+    {
+        OutputStream->WriteByte(REPLAY_RECORD_TICK_SKIP(type));
+    }
+}
+
+void Replay::OnInputPlayback()
+{
+    if (Mode != Modes::Play)
+        return;
+    if (InputStream->GetPosition() >= InputStream->GetLength())
+    {
+        LOG(Info, "Replay playback finished");
+        Stop();
+        return;
+    }
+    const byte tag = InputStream->ReadByte();
+    if (tag != REPLAY_RECORD_INPUT)
+    {
+        OnDesync();
+        return;
+    }
+
+    // Drop the local hardware input queued since the last frame so only the captured events get processed
+    if (Input::Mouse)
+        Input::Mouse->ClearQueue();
+    if (Input::Keyboard)
+        Input::Keyboard->ClearQueue();
+
+    // Feed the captured events back through the devices so both the events and the polled states match the recorded session
+    int32 count;
+    InputStream->ReadInt32(&count);
+    for (int32 i = 0; i < count; i++)
+    {
+        const auto type = (InputDevice::EventType)InputStream->ReadByte();
+        switch (type)
+        {
+        case InputDevice::EventType::Char:
+        {
+            uint16 c;
+            InputStream->ReadUint16(&c);
+            if (Input::Keyboard)
+                Input::Keyboard->OnCharInput((Char)c);
+            break;
+        }
+        case InputDevice::EventType::KeyDown:
+        case InputDevice::EventType::KeyUp:
+        {
+            uint16 key;
+            InputStream->ReadUint16(&key);
+            if (Input::Keyboard)
+            {
+                if (type == InputDevice::EventType::KeyDown)
+                    Input::Keyboard->OnKeyDown((KeyboardKeys)key);
+                else
+                    Input::Keyboard->OnKeyUp((KeyboardKeys)key);
+            }
+            break;
+        }
+        case InputDevice::EventType::MouseDown:
+        case InputDevice::EventType::MouseUp:
+        case InputDevice::EventType::MouseDoubleClick:
+        {
+            const byte button = InputStream->ReadByte();
+            Float2 position;
+            InputStream->ReadFloat(&position.X);
+            InputStream->ReadFloat(&position.Y);
+            if (Input::Mouse)
+            {
+                if (type == InputDevice::EventType::MouseDown)
+                    Input::Mouse->OnMouseDown(position, (MouseButton)button);
+                else if (type == InputDevice::EventType::MouseUp)
+                    Input::Mouse->OnMouseUp(position, (MouseButton)button);
+                else
+                    Input::Mouse->OnMouseDoubleClick(position, (MouseButton)button);
+            }
+            break;
+        }
+        case InputDevice::EventType::MouseWheel:
+        {
+            float delta;
+            Float2 position;
+            InputStream->ReadFloat(&delta);
+            InputStream->ReadFloat(&position.X);
+            InputStream->ReadFloat(&position.Y);
+            if (Input::Mouse)
+                Input::Mouse->OnMouseWheel(position, delta);
+            break;
+        }
+        case InputDevice::EventType::MouseMove:
+        {
+            Float2 position;
+            InputStream->ReadFloat(&position.X);
+            InputStream->ReadFloat(&position.Y);
+            if (Input::Mouse)
+                Input::Mouse->OnMouseMove(position);
+            break;
+        }
+        case InputDevice::EventType::MouseLeave:
+        {
+            if (Input::Mouse)
+                Input::Mouse->OnMouseLeave();
+            break;
+        }
+        case InputDevice::EventType::TouchDown:
+        case InputDevice::EventType::TouchMove:
+        case InputDevice::EventType::TouchUp:
+        {
+            // Touch events are captured but have no injection path (skip the payload)
+            Float2 position;
+            int32 pointerId;
+            InputStream->ReadFloat(&position.X);
+            InputStream->ReadFloat(&position.Y);
+            InputStream->ReadInt32(&pointerId);
+            break;
+        }
+        default:
+            OnDesync();
+            return;
+        }
+    }
+}
+
+void Replay::OnInputRecord(const InputDevice::EventQueue& events)
+{
+    if (Mode != Modes::Record)
+        return;
+    OutputStream->WriteByte(REPLAY_RECORD_INPUT);
+    OutputStream->WriteInt32(events.Count());
+    for (const InputDevice::Event& e : events)
+    {
+        OutputStream->WriteByte((byte)e.Type);
+        switch (e.Type)
+        {
+        case InputDevice::EventType::Char:
+            OutputStream->WriteUint16((uint16)e.CharData.Char);
+            break;
+        case InputDevice::EventType::KeyDown:
+        case InputDevice::EventType::KeyUp:
+            OutputStream->WriteUint16((uint16)e.KeyData.Key);
+            break;
+        case InputDevice::EventType::MouseDown:
+        case InputDevice::EventType::MouseUp:
+        case InputDevice::EventType::MouseDoubleClick:
+            OutputStream->WriteByte((byte)e.MouseData.Button);
+            OutputStream->WriteFloat(e.MouseData.Position.X);
+            OutputStream->WriteFloat(e.MouseData.Position.Y);
+            break;
+        case InputDevice::EventType::MouseWheel:
+            OutputStream->WriteFloat(e.MouseWheelData.WheelDelta);
+            OutputStream->WriteFloat(e.MouseWheelData.Position.X);
+            OutputStream->WriteFloat(e.MouseWheelData.Position.Y);
+            break;
+        case InputDevice::EventType::MouseMove:
+            OutputStream->WriteFloat(e.MouseData.Position.X);
+            OutputStream->WriteFloat(e.MouseData.Position.Y);
+            break;
+        case InputDevice::EventType::MouseLeave:
+            break;
+        case InputDevice::EventType::TouchDown:
+        case InputDevice::EventType::TouchMove:
+        case InputDevice::EventType::TouchUp:
+            OutputStream->WriteFloat(e.TouchData.Position.X);
+            OutputStream->WriteFloat(e.TouchData.Position.Y);
+            OutputStream->WriteInt32(e.TouchData.PointerId);
+            break;
+        }
+    }
+}
@@ -0,0 +1,85 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Time.h"
+#include "Engine/Input/InputDevice.h"
+
+/// <summary>
+/// Deterministic replay tool that captures the game loop time deltas and the input events into a compact stream and feeds them back so a captured session re-executes identically (eg. to reproduce performance bugs from QA sessions). Use the -replayrecord !file! and -replayplay !file! command line switches or the manual Start/Stop API.
+/// </summary>
+class FLAXENGINE_API Replay
+{
+public:
+    /// <summary>
+    /// The replay modes.
+    /// </summary>
+    enum class Modes
+    {
+        /// <summary>
+        /// The replay system is inactive.
+        /// </summary>
+        None,
+
+        /// <summary>
+        /// The session is captured into the output stream.
+        /// </summary>
+        Record,
+
+        /// <summary>
+        /// The captured session is fed back from the input stream.
+        /// </summary>
+        Play,
+    };
+
+    /// <summary>
+    /// The game loop tick types captured in the replay stream.
+    /// </summary>
+    enum class TickTypes : byte
+    {
+        Update = 0,
+        Physics = 1,
+    };
+
+public:
+    /// <summary>
+    /// Gets the current replay mode.
+    /// </summary>
+    static Modes GetMode();
+
+    /// <summary>
+    /// Returns true if the captured session playback is active.
+    /// </summary>
+    static bool IsPlayback();
+
+    /// <summary>
+    /// Returns true if the session capture is active.
+    /// </summary>
+    static bool IsRecording();
+
+    /// <summary>
+    /// Starts the session capture into the given file.
+    /// </summary>
+    /// <param name="path">The output replay file path.</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    static bool StartRecord(const StringView& path);
+
+    /// <summary>
+    /// Starts the captured session playback from the given file.
+    /// </summary>
+    /// <param name="path">The input replay file path.</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    static bool StartPlayback(const StringView& path);
+
+    /// <summary>
+    /// Stops the active capture or playback (flushes and closes the stream).
+    /// </summary>
+    static void Stop();
+
+public:
+    // Internal game loop hooks (see Time and InputService)
+    static bool OnTickBegin(Time::TickData& data, TickTypes type, bool& ticked);
+    static void OnTickRecord(TickTypes type, bool ticked, double deltaTime);
+    static void OnInputPlayback();
+    static void OnInputRecord(const InputDevice::EventQueue& events);
+};
@@ -2,6 +2,7 @@
 
 #include "Time.h"
 #include "EngineService.h"
+#include "Replay.h"
 #include "Engine/Core/Math/Math.h"
 #include "Engine/Platform/Platform.h"
 #include "Engine/Core/Config/TimeSettings.h"
@@ -12,6 +13,7 @@ namespace
     bool FixedDeltaTimeEnable;
     float FixedDeltaTimeValue;
     float MaxUpdateDeltaTime = 0.1f;
+    bool FramePacingEnable = true;
 }
 
 bool Time::_gamePaused = false;
@@ -52,6 +54,7 @@ void TimeSettings::Apply()
     Time::DrawFPS = DrawFPS;
     Time::TimeScale = TimeScale;
     ::MaxUpdateDeltaTime = MaxUpdateDeltaTime;
+    ::FramePacingEnable = FramePacing;
 }
 
 void TimeSettings::Deserialize(DeserializeStream& stream, ISerializeModifier* modifier)
@@ -61,6 +64,7 @@ void TimeSettings::Deserialize(DeserializeStream& stream, ISerializeModifier* mo
     DESERIALIZE(DrawFPS);
     DESERIALIZE(TimeScale);
     DESERIALIZE(MaxUpdateDeltaTime);
+    DESERIALIZE(FramePacing);
 }
 
 void Time::TickData::OnBeforeRun(float targetFps, double currentTime)
@@ -71,6 +75,7 @@ void Time::TickData::OnBeforeRun(float targetFps, double currentTime)
     LastBegin = currentTime - LastLength;
     LastEnd = currentTime;
     NextBegin = targetFps > ZeroTolerance ? LastBegin + (1.0f / targetFps) : 0.0;
+    DeltaSamples.Clear();
 }
 
 void Time::TickData::OnReset(float targetFps, double currentTime)
@@ -79,12 +84,13 @@ void Time::TickData::OnReset(float targetFps, double currentTime)
     LastLength = static_cast<double>(DeltaTime.Ticks) / Constants::TicksPerSecond;
     LastBegin = currentTime - LastLength;
     LastEnd = currentTime;
+    DeltaSamples.Clear();
 }
 
 bool Time::TickData::OnTickBegin(float targetFps, float maxDeltaTime)
 {
     // Check if can perform a tick
-    const double time = Platform::GetTimeSeconds();
+    double time = Platform::GetTimeSeconds();
     double deltaTime;
     if (FixedDeltaTimeEnable)
     {
@@ -98,9 +104,33 @@ bool Time::TickData::OnTickBegin(float targetFps, float maxDeltaTime)
         deltaTime = Math::Max((time - LastBegin), 0.0);
         if (deltaTime > maxDeltaTime)
         {
+            // Running over the update budget: drop the backlog and catch-up from now
             deltaTime = (double)maxDeltaTime;
             NextBegin = time;
         }
+        else if (FramePacingEnable && targetFps > ZeroTolerance)
+        {
+            // Pace the stepping when running near the target rate so small frame time oscillations don't cause judder
+            DeltaSamples.Add(deltaTime);
+            const double targetDeltaTime = 1.0 / (double)targetFps;
+            const double smoothedDeltaTime = DeltaSamples.Average();
+            const double smoothedError = smoothedDeltaTime - targetDeltaTime;
+            double pacedDeltaTime;
+            if (smoothedError < 0.2 * targetDeltaTime && smoothedError > -0.2 * targetDeltaTime)
+            {
+                // Close to the target rate so snap to the fixed step
+                pacedDeltaTime = targetDeltaTime;
+            }
+            else
+            {
+                // Off the target rate so clamp the step around the smoothed value to spread single spikes over the next few ticks
+                pacedDeltaTime = Math::Clamp(deltaTime, smoothedDeltaTime * 0.8, smoothedDeltaTime * 1.25);
+            }
+
+            // Carry the pacing error into the tick start time so the game clock won't drift away from the wall clock
+            time -= deltaTime - pacedDeltaTime;
+            deltaTime = pacedDeltaTime;
+        }
 
         if (targetFps > ZeroTolerance)
         {
@@ -260,7 +290,13 @@ void Time::OnBeforeRun()
 
 bool Time::OnBeginUpdate()
 {
-    if (Update.OnTickBegin(UpdateFPS, MaxUpdateDeltaTime))
+    bool ticked;
+    if (!Replay::OnTickBegin(Update, Replay::TickTypes::Update, ticked))
+    {
+        ticked = Update.OnTickBegin(UpdateFPS, MaxUpdateDeltaTime);
+        Replay::OnTickRecord(Replay::TickTypes::Update, ticked, static_cast<double>(Update.UnscaledDeltaTime.Ticks) / Constants::TicksPerSecond);
+    }
+    if (ticked)
     {
         Current = &Update;
         return true;
@@ -270,7 +306,13 @@ bool Time::OnBeginUpdate()
 
 bool Time::OnBeginPhysics()
 {
-    if (Physics.OnTickBegin(PhysicsFPS, _physicsMaxDeltaTime))
+    bool ticked;
+    if (!Replay::OnTickBegin(Physics, Replay::TickTypes::Physics, ticked))
+    {
+        ticked = Physics.OnTickBegin(PhysicsFPS, _physicsMaxDeltaTime);
+        Replay::OnTickRecord(Replay::TickTypes::Physics, ticked, static_cast<double>(Physics.UnscaledDeltaTime.Ticks) / Constants::TicksPerSecond);
+    }
+    if (ticked)
     {
         Current = &Physics;
         return true;
@@ -24,6 +24,7 @@ public:
     /// </summary>
     class FLAXENGINE_API TickData
     {
+        friend class Replay;
     public:
 
         virtual ~TickData() = default;
@@ -74,6 +75,11 @@ public:
         /// </summary>
         TimeSpan UnscaledTime;
 
+        /// <summary>
+        /// The last few raw ticks delta times. Used by the frame pacing to smooth the stepping when frame times oscillate around the target rate.
+        /// </summary>
+        SamplesBuffer<double, 8> DeltaSamples;
+
     public:
 
         virtual void OnBeforeRun(float targetFps, double currentTime);
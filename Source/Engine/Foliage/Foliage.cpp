@@ -11,6 +11,7 @@
 #include "Engine/Threading/JobSystem.h"
 #if FOLIAGE_USE_DRAW_CALLS_BATCHING
 #include "Engine/Graphics/RenderTools.h"
+#include "Engine/Graphics/Graphics.h"
 #include "Engine/Graphics/GPUDevice.h"
 #include "Engine/Renderer/RenderList.h"
 #endif
@@ -94,6 +95,18 @@ void Foliage::AddToCluster(ChunkedArray<FoliageCluster, FOLIAGE_CLUSTER_CHUNKS_S
     }
 }
 
+void Foliage::UpdateInstanceRenderData(FoliageInstance& instance)
+{
+    // Cache the world-space transformation used when building draw calls so drawing doesn't recompute it every frame
+    const Transform transform = _transform.LocalToWorld(instance.Transform);
+    Matrix world;
+    Matrix::Transformation(transform.Scale, transform.Orientation, Float3::Zero, world);
+    instance.RenderTransform1 = Float3(world.M11, world.M12, world.M13);
+    instance.RenderTransform2 = Float3(world.M21, world.M22, world.M23);
+    instance.RenderTransform3 = Float3(world.M31, world.M32, world.M33);
+    instance.RenderOrigin = transform.Translation;
+}
+
 #if !FOLIAGE_USE_SINGLE_QUAD_TREE && FOLIAGE_USE_DRAW_CALLS_BATCHING
 
 void Foliage::DrawInstance(RenderContext& renderContext, FoliageInstance& instance, const FoliageType& type, Model* model, int32 lod, float lodDitherFactor, DrawCallsList* drawCallsLists, BatchedDrawCalls& result) const
@@ -118,23 +131,19 @@ void Foliage::DrawInstance(RenderContext& renderContext, FoliageInstance& instan
             e->DrawCall.Surface.Lightmap = EnumHasAnyFlags(_staticFlags, StaticFlags::Lightmap) ? _scene->LightmapsData.GetReadyLightmap(key.Lightmap) : nullptr;
         }
 
-        // Add instance to the draw batch
+        // Add instance to the draw batch (transformation comes from the per-instance cache, see UpdateInstanceRenderData)
         auto& instanceData = e->Instances.AddOne();
-        Matrix world;
-        const Transform transform = _transform.LocalToWorld(instance.Transform);
-        const Float3 translation = transform.Translation - renderContext.View.Origin;
-        Matrix::Transformation(transform.Scale, transform.Orientation, translation, world);
-        instanceData.InstanceOrigin = Float3(world.M41, world.M42, world.M43);
+        instanceData.InstanceOrigin = Float3(instance.RenderOrigin - renderContext.View.Origin);
         instanceData.PerInstanceRandom = instance.Random;
-        instanceData.InstanceTransform1 = Float3(world.M11, world.M12, world.M13);
+        instanceData.InstanceTransform1 = instance.RenderTransform1;
         instanceData.LODDitherFactor = lodDitherFactor;
-        instanceData.InstanceTransform2 = Float3(world.M21, world.M22, world.M23);
-        instanceData.InstanceTransform3 = Float3(world.M31, world.M32, world.M33);
+        instanceData.InstanceTransform2 = instance.RenderTransform2;
+        instanceData.InstanceTransform3 = instance.RenderTransform3;
         instanceData.InstanceLightmapArea = Half4(instance.Lightmap.UVsArea);
     }
 }
 
-void Foliage::DrawCluster(RenderContext& renderContext, FoliageCluster* cluster, const FoliageType& type, DrawCallsList* drawCallsLists, BatchedDrawCalls& result) const
+void Foliage::DrawCluster(RenderContext& renderContext, FoliageCluster* cluster, const FoliageType& type, DrawCallsList* drawCallsLists, BatchedDrawCalls& result, bool fullyInsideView) const
 {
     // Skip clusters that around too far from view
     const Vector3 viewOrigin = renderContext.View.Origin;
@@ -149,13 +158,16 @@ void Foliage::DrawCluster(RenderContext& renderContext, FoliageCluster* cluster,
         // Don't store instances in non-leaf nodes
         ASSERT_LOW_LAYER(cluster->Instances.IsEmpty());
 
+        // Skip per-child and per-instance frustum tests once the cluster is fully inside the view
         BoundingBox box;
+        ContainmentType containment;
 #define DRAW_CLUSTER(idx) \
         box = cluster->Children[idx]->TotalBounds; \
         box.Minimum -= viewOrigin; \
         box.Maximum -= viewOrigin; \
-		if (renderContext.View.CullingFrustum.Intersects(box)) \
-			DrawCluster(renderContext, cluster->Children[idx], type, drawCallsLists, result)
+        containment = fullyInsideView ? ContainmentType::Contains : renderContext.View.CullingFrustum.Contains(box); \
+		if (containment != ContainmentType::Disjoint) \
+			DrawCluster(renderContext, cluster->Children[idx], type, drawCallsLists, result, containment == ContainmentType::Contains)
         DRAW_CLUSTER(0);
         DRAW_CLUSTER(1);
         DRAW_CLUSTER(2);
@@ -173,7 +185,7 @@ void Foliage::DrawCluster(RenderContext& renderContext, FoliageCluster* cluster,
             BoundingSphere sphere = instance.Bounds;
             sphere.Center -= viewOrigin;
             if (Float3::Distance(renderContext.View.Position, sphere.Center) - (float)sphere.Radius < instance.CullDistance &&
-                renderContext.View.CullingFrustum.Intersects(sphere))
+                (fullyInsideView || renderContext.View.CullingFrustum.Intersects(sphere)))
             {
                 const auto modelFrame = instance.DrawState.PrevFrame + 1;
 
@@ -263,7 +275,7 @@ void Foliage::DrawCluster(RenderContext& renderContext, FoliageCluster* cluster,
 
 #else
 
-void Foliage::DrawCluster(RenderContext& renderContext, FoliageCluster* cluster, Mesh::DrawInfo& draw)
+void Foliage::DrawCluster(RenderContext& renderContext, FoliageCluster* cluster, Mesh::DrawInfo& draw, bool fullyInsideView)
 {
     // Skip clusters that around too far from view
     const Vector3 viewOrigin = renderContext.View.Origin;
@@ -278,13 +290,16 @@ void Foliage::DrawCluster(RenderContext& renderContext, FoliageCluster* cluster,
         // Don't store instances in non-leaf nodes
         ASSERT_LOW_LAYER(cluster->Instances.IsEmpty());
 
+        // Skip per-child and per-instance frustum tests once the cluster is fully inside the view
         BoundingBox box;
+        ContainmentType containment;
 #define DRAW_CLUSTER(idx) \
         box = cluster->Children[idx]->TotalBounds; \
         box.Minimum -= viewOrigin; \
         box.Maximum -= viewOrigin; \
-		if (renderContext.View.CullingFrustum.Intersects(box)) \
-			DrawCluster(renderContext, cluster->Children[idx], draw)
+        containment = fullyInsideView ? ContainmentType::Contains : renderContext.View.CullingFrustum.Contains(box); \
+		if (containment != ContainmentType::Disjoint) \
+			DrawCluster(renderContext, cluster->Children[idx], draw, containment == ContainmentType::Contains)
         DRAW_CLUSTER(0);
         DRAW_CLUSTER(1);
         DRAW_CLUSTER(2);
@@ -305,12 +320,13 @@ void Foliage::DrawCluster(RenderContext& renderContext, FoliageCluster* cluster,
             // Check if can draw this instance
             if (type._canDraw &&
                 Float3::Distance(renderContext.View.Position, sphere.Center) - (float)sphere.Radius < instance.CullDistance &&
-                renderContext.View.CullingFrustum.Intersects(sphere))
+                (fullyInsideView || renderContext.View.CullingFrustum.Intersects(sphere)))
             {
                 Matrix world;
-                const Transform transform = _transform.LocalToWorld(instance.Transform);
-                const Float3 translation = transform.Translation - renderContext.View.Origin;
-                Matrix::Transformation(transform.Scale, transform.Orientation, translation, world);
+                world.SetRow1(Float4(instance.RenderTransform1, 0.0f));
+                world.SetRow2(Float4(instance.RenderTransform2, 0.0f));
+                world.SetRow3(Float4(instance.RenderTransform3, 0.0f));
+                world.SetRow4(Float4(Float3(instance.RenderOrigin - renderContext.View.Origin), 1.0f));
 
                 // Disable motion blur
                 instance.DrawState.PrevWorld = world;
@@ -461,7 +477,7 @@ void Foliage::DrawType(RenderContext& renderContext, const FoliageType& type, Dr
 
     // Draw instances of the foliage type
     BatchedDrawCalls result;
-    DrawCluster(renderContext, type.Root, type, drawCallsLists, result);
+    DrawCluster(renderContext, type.Root, type, drawCallsLists, result, false);
 
     // Submit draw calls with valid instances added
     for (auto& e : result)
@@ -496,6 +512,7 @@ void Foliage::DrawType(RenderContext& renderContext, const FoliageType& type, Dr
         if (EnumHasAnyFlags(drawModes, DrawPass::Forward))
         {
             // Transparency requires sorting by depth so convert back the batched draw call into normal draw calls (RenderList impl will handle this)
+            const DrawCallsListType forwardListType = Graphics::HalfResTransparency && EnumHasNoneFlags(batch.DrawCall.Material->GetInfo().FeaturesFlags, MaterialFeaturesFlags::FullResolutionTransparency) ? DrawCallsListType::ForwardHalfRes : DrawCallsListType::Forward;
             DrawCall drawCall = batch.DrawCall;
             for (int32 j = 0; j < batch.Instances.Count(); j++)
             {
@@ -510,7 +527,7 @@ void Foliage::DrawType(RenderContext& renderContext, const FoliageType& type, Dr
                 drawCall.World.SetRow3(Float4(instance.InstanceTransform3, 0.0f));
                 drawCall.World.SetRow4(Float4(instance.InstanceOrigin, 1.0f));
                 const int32 drawCallIndex = renderContext.List->DrawCalls.Add(drawCall);
-                renderContext.List->DrawCallsLists[(int32)DrawCallsListType::Forward].Indices.Add(drawCallIndex);
+                renderContext.List->DrawCallsLists[(int32)forwardListType].Indices.Add(drawCallIndex);
             }
         }
 
@@ -539,7 +556,7 @@ void Foliage::DrawType(RenderContext& renderContext, const FoliageType& type, Dr
         }
     }
 #else
-    DrawCluster(renderContext, type.Root, draw);
+    DrawCluster(renderContext, type.Root, draw, false);
 #endif
 }
 
@@ -1200,7 +1217,7 @@ void Foliage::Draw(RenderContext& renderContext)
 #endif
 #if FOLIAGE_USE_SINGLE_QUAD_TREE
     if (Root)
-        DrawCluster(renderContext, Root, draw);
+        DrawCluster(renderContext, Root, draw, false);
 #else
     for (auto& type : FoliageTypes)
     {
@@ -1447,12 +1464,13 @@ void Foliage::Deserialize(DeserializeStream& stream, ISerializeModifier* modifie
         }
 #endif
 
-        // Update cull distance
+        // Update cull distance and cached render data
         for (auto i = Instances.Begin(); i.IsNotEnd(); ++i)
         {
             auto& instance = *i;
             auto& type = FoliageTypes[instance.Type];
             instance.CullDistance = type.CullDistance + type.CullDistanceRandomRange * instance.Random;
+            UpdateInstanceRenderData(instance);
         }
     }
 }
@@ -1494,6 +1512,7 @@ void Foliage::OnTransformChanged()
     {
         auto& instance = *i;
         auto type = &FoliageTypes[instance.Type];
+        UpdateInstanceRenderData(instance);
 
         // Update bounds
         instance.Bounds = BoundingSphere::Empty;
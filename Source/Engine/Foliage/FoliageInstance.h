@@ -49,6 +49,16 @@ API_STRUCT(NoPod) struct FLAXENGINE_API FoliageInstance
     /// </summary>
     LightmapEntry Lightmap;
 
+    /// <summary>
+    /// The cached world-space rotation and scale rows of the instance transformation matrix used during drawing. Rebuilt when the instance or the foliage actor moves.
+    /// </summary>
+    Float3 RenderTransform1, RenderTransform2, RenderTransform3;
+
+    /// <summary>
+    /// The cached world-space origin of the instance transformation used during drawing (the view origin gets subtracted when building draw calls).
+    /// </summary>
+    Vector3 RenderOrigin;
+
 public:
     bool operator==(const FoliageInstance& v) const
     {
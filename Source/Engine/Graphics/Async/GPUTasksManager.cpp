@@ -6,6 +6,13 @@
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Types/String.h"
 #include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Threading/Threading.h"
+
+// Size of the persistent staging ring buffer used to hold uploads data for async GPU tasks (in bytes)
+#define GPU_TASKS_UPLOADS_RING_SIZE (16 * 1024 * 1024)
+
+// Maximum size of a single block allocated from the uploads ring buffer (larger uploads fallback to heap memory to prevent a single task from blocking the whole ring)
+#define GPU_TASKS_UPLOADS_RING_MAX_ALLOC (GPU_TASKS_UPLOADS_RING_SIZE / 4)
 
 void GPUTask::Execute(GPUTasksContext* context)
 {
@@ -63,6 +70,66 @@ void GPUTasksManager::SetExecutor(GPUTasksExecutor* value)
     }
 }
 
+byte* GPUTasksManager::AllocateUploadData(int32 size)
+{
+    ASSERT(size > 0);
+    if (size > GPU_TASKS_UPLOADS_RING_MAX_ALLOC)
+        return nullptr;
+    ScopeLock lock(_uploadsLocker);
+
+    // Lazy-init the ring buffer memory on the first upload
+    if (_uploadsBuffer == nullptr)
+        _uploadsBuffer = (byte*)Platform::Allocate(GPU_TASKS_UPLOADS_RING_SIZE, 16);
+
+    // Keep blocks aligned so the returned pointers can be used for any data type
+    size = Math::AlignUp<int32>(size, 16);
+
+    // Pad up to the end of the buffer if the block would wrap around (blocks are always contiguous)
+    int32 padding = 0;
+    int32 offset = _uploadsHead;
+    if (offset + size > GPU_TASKS_UPLOADS_RING_SIZE)
+    {
+        padding = GPU_TASKS_UPLOADS_RING_SIZE - offset;
+        offset = 0;
+    }
+    if (_uploadsUsed + size + padding > GPU_TASKS_UPLOADS_RING_SIZE)
+        return nullptr;
+
+    // Commit the block (reclaimed in FreeUploadData once all older blocks are released too)
+    _uploadsBlocks.PushBack({ offset, size, padding, false });
+    _uploadsHead = (offset + size) % GPU_TASKS_UPLOADS_RING_SIZE;
+    _uploadsUsed += size + padding;
+    return _uploadsBuffer + offset;
+}
+
+void GPUTasksManager::FreeUploadData(byte* data)
+{
+    ScopeLock lock(_uploadsLocker);
+    if (_uploadsBuffer == nullptr)
+        return;
+
+    // Mark the block as released (tasks may end out-of-order so only tag it here)
+    const int32 offset = (int32)(data - _uploadsBuffer);
+    ASSERT(offset >= 0 && offset < GPU_TASKS_UPLOADS_RING_SIZE);
+    for (int32 i = 0; i < _uploadsBlocks.Count(); i++)
+    {
+        auto& block = _uploadsBlocks[i];
+        if (block.Offset == offset && !block.Released)
+        {
+            block.Released = true;
+            break;
+        }
+    }
+
+    // Reclaim the contiguous run of released blocks from the front (FIFO order matches the allocation order)
+    while (_uploadsBlocks.Count() != 0 && _uploadsBlocks.PeekFront().Released)
+    {
+        const auto& block = _uploadsBlocks.PeekFront();
+        _uploadsUsed -= block.Size + block.Padding;
+        _uploadsBlocks.PopFront();
+    }
+}
+
 void GPUTasksManager::Dispose()
 {
     // Cancel all performed tasks (that are waiting for sync)
@@ -73,6 +140,15 @@ void GPUTasksManager::Dispose()
     Task::CancelAll(_buffers[1]);
     _bufferIndex = 0;
     _tasks.CancelAll();
+
+    // Release the uploads staging memory (all tasks are done now)
+    _uploadsLocker.Lock();
+    ASSERT(_uploadsBlocks.Count() == 0);
+    Platform::Free(_uploadsBuffer);
+    _uploadsBuffer = nullptr;
+    _uploadsHead = 0;
+    _uploadsUsed = 0;
+    _uploadsLocker.Unlock();
 }
 
 void GPUTasksManager::FrameBegin()
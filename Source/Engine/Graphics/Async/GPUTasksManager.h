@@ -5,6 +5,8 @@
 #include "Engine/Core/Object.h"
 #include "Engine/Core/NonCopyable.h"
 #include "Engine/Core/Types/String.h"
+#include "Engine/Core/Collections/RingBuffer.h"
+#include "Engine/Platform/CriticalSection.h"
 #include "Engine/Threading/ConcurrentTaskQueue.h"
 #include "GPUTask.h"
 
@@ -22,10 +24,23 @@ class GPUTasksManager : public Object, public NonCopyable
     friend GPUTask;
 
 private:
+    struct UploadsRingBlock
+    {
+        int32 Offset;
+        int32 Size;
+        int32 Padding;
+        bool Released;
+    };
+
     GPUTasksExecutor* _executor = nullptr;
     ConcurrentTaskQueue<GPUTask> _tasks;
     Array<GPUTask*> _buffers[2];
     int32 _bufferIndex = 0;
+    CriticalSection _uploadsLocker;
+    byte* _uploadsBuffer = nullptr;
+    int32 _uploadsHead = 0;
+    int32 _uploadsUsed = 0;
+    RingBuffer<UploadsRingBlock> _uploadsBlocks;
 
 public:
     GPUTasksManager();
@@ -52,6 +67,20 @@ public:
         return _tasks.Count();
     }
 
+public:
+    /// <summary>
+    /// Allocates a block of memory from the persistent uploads staging ring buffer (used to hold a CPU-side copy of the data for async GPU uploads without per-task heap allocations).
+    /// </summary>
+    /// <param name="size">The block size (in bytes).</param>
+    /// <returns>The allocated memory or null if the ring buffer is full or the requested size is too large (the caller should fallback to a heap allocation).</returns>
+    byte* AllocateUploadData(int32 size);
+
+    /// <summary>
+    /// Frees a block of memory allocated from the uploads staging ring buffer.
+    /// </summary>
+    /// <param name="data">The block allocated with AllocateUploadData.</param>
+    void FreeUploadData(byte* data);
+
 public:
     /// <summary>
     /// Clears asynchronous resources loading queue and cancels all tasks.
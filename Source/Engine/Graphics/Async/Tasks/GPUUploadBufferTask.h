@@ -4,6 +4,8 @@
 
 #include "../GPUTask.h"
 #include "../GPUTasksContext.h"
+#include "../GPUTasksManager.h"
+#include "Engine/Graphics/GPUDevice.h"
 #include "Engine/Graphics/GPUBuffer.h"
 #include "Engine/Graphics/GPUResourceProperty.h"
 #include "Engine/Core/Types/DataContainer.h"
@@ -17,6 +19,7 @@ protected:
     BufferReference _buffer;
     int32 _offset;
     BytesContainer _data;
+    byte* _dataRing = nullptr;
 
 public:
     /// <summary>
@@ -34,7 +37,17 @@ public:
         _buffer.OnUnload.Bind<GPUUploadBufferTask, &GPUUploadBufferTask::OnResourceUnload>(this);
 
         if (copyData)
-            _data.Copy(data);
+        {
+            // Stage the data copy in the uploads ring buffer to avoid per-task heap allocations (with heap fallback if it's full)
+            _dataRing = GPUDevice::Instance->GetTasksManager()->AllocateUploadData(data.Length());
+            if (_dataRing)
+            {
+                Platform::MemoryCopy(_dataRing, data.Get(), data.Length());
+                _data.Link(_dataRing, data.Length());
+            }
+            else
+                _data.Copy(data);
+        }
         else
             _data.Link(data);
     }
@@ -67,6 +80,12 @@ protected:
     void OnEnd() override
     {
         _buffer.Unlink();
+        if (_dataRing)
+        {
+            GPUDevice::Instance->GetTasksManager()->FreeUploadData(_dataRing);
+            _dataRing = nullptr;
+            _data.Release();
+        }
 
         // Base
         GPUTask::OnEnd();
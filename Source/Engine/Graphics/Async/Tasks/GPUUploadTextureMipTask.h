@@ -4,6 +4,8 @@
 
 #include "../GPUTask.h"
 #include "../GPUTasksContext.h"
+#include "../GPUTasksManager.h"
+#include "Engine/Graphics/GPUDevice.h"
 #include "Engine/Graphics/Textures/GPUTexture.h"
 #include "Engine/Graphics/GPUResourceProperty.h"
 #include "Engine/Core/Types/DataContainer.h"
@@ -17,6 +19,7 @@ protected:
     GPUTextureReference _texture;
     int32 _mipIndex, _rowPitch, _slicePitch;
     BytesContainer _data;
+    byte* _dataRing = nullptr;
 
 public:
     /// <summary>
@@ -38,7 +41,17 @@ public:
         _texture.OnUnload.Bind<GPUUploadTextureMipTask, &GPUUploadTextureMipTask::OnResourceUnload>(this);
 
         if (copyData)
-            _data.Copy(data);
+        {
+            // Stage the data copy in the uploads ring buffer to avoid per-task heap allocations (with heap fallback if it's full)
+            _dataRing = GPUDevice::Instance->GetTasksManager()->AllocateUploadData(data.Length());
+            if (_dataRing)
+            {
+                Platform::MemoryCopy(_dataRing, data.Get(), data.Length());
+                _data.Link(_dataRing, data.Length());
+            }
+            else
+                _data.Copy(data);
+        }
         else
             _data.Link(data);
     }
@@ -98,6 +111,12 @@ protected:
     void OnEnd() override
     {
         _texture.Unlink();
+        if (_dataRing)
+        {
+            GPUDevice::Instance->GetTasksManager()->FreeUploadData(_dataRing);
+            _dataRing = nullptr;
+            _data.Release();
+        }
 
         // Base
         GPUTask::OnEnd();
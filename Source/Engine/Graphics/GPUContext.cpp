@@ -68,6 +68,10 @@ void GPUContext::SetResourceState(GPUResource* resource, uint64 state, int32 sub
 {
 }
 
+void GPUContext::PreTransitionSR(GPUResource* resource)
+{
+}
+
 void GPUContext::ForceRebindDescriptors()
 {
 }
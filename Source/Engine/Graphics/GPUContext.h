@@ -608,6 +608,12 @@ public:
     /// </summary>
     virtual void SetResourceState(GPUResource* resource, uint64 state, int32 subresource = -1);
 
+    /// <summary>
+    /// Hints the context to begin transitioning the resource into the shader resource state. Backends with split-barriers support (eg. D3D12) can overlap the transition with other GPU work until the resource gets sampled by one of the following passes. It's only a hint so the call can be safely ignored by the backend.
+    /// </summary>
+    /// <param name="resource">The resource to pre-transition (usually a render target that has just been written by a pass and will be sampled later).</param>
+    virtual void PreTransitionSR(GPUResource* resource);
+
     /// <summary>
     /// Forces graphics backend to rebind descriptors after command list was used by external graphics library.
     /// </summary>
@@ -8,6 +8,7 @@
 #include "RenderTools.h"
 #include "Graphics.h"
 #include "Shaders/GPUShader.h"
+#include "Models/MeshBufferPool.h"
 #include "Async/DefaultGPUTasksExecutor.h"
 #include "Async/GPUTasksManager.h"
 #include "Engine/Core/Log.h"
@@ -507,9 +508,9 @@ void GPUDevice::DrawEnd()
 
     // Find index of the last rendered window task (use vsync only on the last window)
     int32 lastWindowIndex = -1;
-    for (int32 i = RenderTask::Tasks.Count() - 1; i >= 0; i--)
+    for (int32 i = RenderTask::DrawTasks.Count() - 1; i >= 0; i--)
     {
-        const auto task = RenderTask::Tasks[i];
+        const auto task = RenderTask::DrawTasks[i];
         if (task && task->LastUsedFrame == Engine::FrameCount && task->SwapChain && task->SwapChain->IsReady())
         {
             lastWindowIndex = i;
@@ -520,9 +521,9 @@ void GPUDevice::DrawEnd()
     // Call present on all used tasks
     int32 presentCount = 0;
     bool anyVSync = false;
-    for (int32 i = 0; i < RenderTask::Tasks.Count(); i++)
+    for (int32 i = 0; i < RenderTask::DrawTasks.Count(); i++)
     {
-        const auto task = RenderTask::Tasks[i];
+        const auto task = RenderTask::DrawTasks[i];
         if (task && task->LastUsedFrame == Engine::FrameCount && task->SwapChain && task->SwapChain->IsReady())
         {
             bool vsync = useVSync;
@@ -609,6 +610,8 @@ void GPUDevice::Draw()
     context->FrameEnd();
 
     DrawEnd();
+
+    RenderList::TrimCache();
 }
 
 void GPUDevice::Dispose()
@@ -627,6 +630,21 @@ uint64 GPUDevice::GetMemoryUsage() const
     return result;
 }
 
+uint64 GPUDevice::DefragMemory()
+{
+    PROFILE_CPU();
+    const uint64 before = GetMemoryUsage();
+
+    // Release the cached temporary render targets right away
+    RenderTargetPool::Flush(true);
+
+    // Compact the pooled mesh buffers to release the sparsely used pages
+    MeshBufferPool::Defrag();
+
+    const uint64 after = GetMemoryUsage();
+    return before > after ? before - after : 0;
+}
+
 Array<GPUResource*> GPUDevice::GetResources() const
 {
     _resourcesLock.Lock();
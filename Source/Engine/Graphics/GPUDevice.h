@@ -230,6 +230,12 @@ public:
     /// </summary>
     API_PROPERTY() Array<GPUResource*> GetResources() const;
 
+    /// <summary>
+    /// Defragments and trims the GPU memory: force-flushes the pooled render targets, compacts the mesh buffer pool pages and releases the unused backend allocations so long play sessions don't run out of VRAM due to fragmentation. Intended to be called during loading screens or other rendering pauses since it performs GPU copies and synchronization.
+    /// </summary>
+    /// <returns>The amount of GPU memory released (in bytes).</returns>
+    API_FUNCTION() virtual uint64 DefragMemory();
+
     /// <summary>
     /// Gets the GPU asynchronous work manager.
     /// </summary>
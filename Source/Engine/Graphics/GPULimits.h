@@ -274,6 +274,11 @@ API_STRUCT() struct GPULimits
     /// </summary>
     API_FIELD() bool HasTypedUAVLoad;
 
+    /// <summary>
+    /// True if constant buffers keep their contents in GPU-resident memory between updates so a buffer can be rebound without re-uploading the data. False on backends that service updates from a per-frame transient upload ring (the cached allocation expires with the frame).
+    /// </summary>
+    API_FIELD() bool HasPersistentConstantBuffers;
+
     /// <summary>
     /// The maximum amount of texture mip levels.
     /// </summary>
@@ -39,55 +39,63 @@ public class Graphics : EngineModule
     {
         base.Setup(options);
 
-        switch (options.Platform.Target)
+        if (options.Target.IsHeadless)
         {
-        case TargetPlatform.Windows:
+            // Headless server profile uses only the null device (no rendering backends compiled into the build)
             options.PrivateDependencies.Add("GraphicsDeviceNull");
-            options.PrivateDependencies.Add("GraphicsDeviceDX11");
-            if (VulkanSdk.Instance.IsValid)
-                options.PrivateDependencies.Add("GraphicsDeviceVulkan");
-            else
-                Log.WarningOnce(string.Format("Building for {0} without Vulkan rendering backend (Vulkan SDK is missing)", options.Platform.Target), ref _logMissingVulkanSDK);
-            var windowsToolchain = options.Toolchain as Flax.Build.Platforms.WindowsToolchain;
-            if (windowsToolchain != null && windowsToolchain.SDK != Flax.Build.Platforms.WindowsPlatformSDK.v8_1)
+        }
+        else
+        {
+            switch (options.Platform.Target)
+            {
+            case TargetPlatform.Windows:
+                options.PrivateDependencies.Add("GraphicsDeviceNull");
+                options.PrivateDependencies.Add("GraphicsDeviceDX11");
+                if (VulkanSdk.Instance.IsValid)
+                    options.PrivateDependencies.Add("GraphicsDeviceVulkan");
+                else
+                    Log.WarningOnce(string.Format("Building for {0} without Vulkan rendering backend (Vulkan SDK is missing)", options.Platform.Target), ref _logMissingVulkanSDK);
+                var windowsToolchain = options.Toolchain as Flax.Build.Platforms.WindowsToolchain;
+                if (windowsToolchain != null && windowsToolchain.SDK != Flax.Build.Platforms.WindowsPlatformSDK.v8_1)
+                    options.PrivateDependencies.Add("GraphicsDeviceDX12");
+                else
+                    Log.WarningOnce(string.Format("Building for {0} without Vulkan rendering backend (Vulkan SDK is missing)", options.Platform.Target), ref _logMissingVulkanSDK);
+                break;
+            case TargetPlatform.UWP:
+                options.PrivateDependencies.Add("GraphicsDeviceDX11");
+                break;
+            case TargetPlatform.XboxOne:
+            case TargetPlatform.XboxScarlett:
                 options.PrivateDependencies.Add("GraphicsDeviceDX12");
-            else
-                Log.WarningOnce(string.Format("Building for {0} without Vulkan rendering backend (Vulkan SDK is missing)", options.Platform.Target), ref _logMissingVulkanSDK);
-            break;
-        case TargetPlatform.UWP:
-            options.PrivateDependencies.Add("GraphicsDeviceDX11");
-            break;
-        case TargetPlatform.XboxOne:
-        case TargetPlatform.XboxScarlett:
-            options.PrivateDependencies.Add("GraphicsDeviceDX12");
-            break;
-        case TargetPlatform.Linux:
-            options.PrivateDependencies.Add("GraphicsDeviceNull");
-            if (VulkanSdk.Instance.IsValid)
+                break;
+            case TargetPlatform.Linux:
+                options.PrivateDependencies.Add("GraphicsDeviceNull");
+                if (VulkanSdk.Instance.IsValid)
+                    options.PrivateDependencies.Add("GraphicsDeviceVulkan");
+                else
+                    Log.WarningOnce(string.Format("Building for {0} without Vulkan rendering backend (Vulkan SDK is missing)", options.Platform.Target), ref _logMissingVulkanSDK);
+                break;
+            case TargetPlatform.PS4:
+                options.PrivateDependencies.Add("GraphicsDevicePS4");
+                break;
+            case TargetPlatform.PS5:
+                options.PrivateDependencies.Add("GraphicsDevicePS5");
+                break;
+            case TargetPlatform.Android:
                 options.PrivateDependencies.Add("GraphicsDeviceVulkan");
-            else
-                Log.WarningOnce(string.Format("Building for {0} without Vulkan rendering backend (Vulkan SDK is missing)", options.Platform.Target), ref _logMissingVulkanSDK);
-            break;
-        case TargetPlatform.PS4:
-            options.PrivateDependencies.Add("GraphicsDevicePS4");
-            break;
-        case TargetPlatform.PS5:
-            options.PrivateDependencies.Add("GraphicsDevicePS5");
-            break;
-        case TargetPlatform.Android:
-            options.PrivateDependencies.Add("GraphicsDeviceVulkan");
-            break;
-        case TargetPlatform.Switch:
-            options.PrivateDependencies.Add("GraphicsDeviceVulkan");
-            break;
-        case TargetPlatform.Mac:
-            options.PrivateDependencies.Add("GraphicsDeviceNull");
-            if (VulkanSdk.Instance.IsValid)
+                break;
+            case TargetPlatform.Switch:
                 options.PrivateDependencies.Add("GraphicsDeviceVulkan");
-            else
-                Log.WarningOnce(string.Format("Building for {0} without Vulkan rendering backend (Vulkan SDK is missing)", options.Platform.Target), ref _logMissingVulkanSDK);
-            break;
-        default: throw new InvalidPlatformException(options.Platform.Target);
+                break;
+            case TargetPlatform.Mac:
+                options.PrivateDependencies.Add("GraphicsDeviceNull");
+                if (VulkanSdk.Instance.IsValid)
+                    options.PrivateDependencies.Add("GraphicsDeviceVulkan");
+                else
+                    Log.WarningOnce(string.Format("Building for {0} without Vulkan rendering backend (Vulkan SDK is missing)", options.Platform.Target), ref _logMissingVulkanSDK);
+                break;
+            default: throw new InvalidPlatformException(options.Platform.Target);
+            }
         }
 
         options.PrivateDependencies.Add("TextureTool");
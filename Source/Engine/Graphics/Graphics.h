@@ -53,6 +53,16 @@ public:
     /// </summary>
     API_FIELD() static bool AllowCSMBlending;
 
+    /// <summary>
+    /// If checked, transparent materials are rendered into a half-resolution buffer and composited with a depth-aware upsample.
+    /// </summary>
+    API_FIELD() static bool HalfResTransparency;
+
+    /// <summary>
+    /// If checked, transparent draw calls are sorted into 16 depth buckets instead of the exact back-to-front order which cuts the sorting cost of heavy particle scenes. Draws within a bucket keep a stable order so minor artifacts can occur where transparency self-overlaps.
+    /// </summary>
+    API_FIELD() static bool ApproximateTransparentSort;
+
     /// <summary>
     /// The Global SDF quality. Controls the volume texture resolution and amount of cascades to use.
     /// </summary>
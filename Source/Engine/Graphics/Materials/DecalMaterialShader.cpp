@@ -70,11 +70,7 @@ void DecalMaterialShader::Bind(BindParameters& params)
     }
 
     // Bind constants
-    if (_cb)
-    {
-        context->UpdateCB(_cb, _cbData.Get());
-        context->BindCB(0, _cb);
-    }
+    BindConstants(context);
 
     // Bind pipeline
     context->SetState(isCameraInside ? _cache.Inside : _cache.Outside);
@@ -75,11 +75,7 @@ void DeformableMaterialShader::Bind(BindParameters& params)
     context->BindSR(0, drawCall.Deformable.SplineDeformation->View());
 
     // Bind constants
-    if (_cb)
-    {
-        context->UpdateCB(_cb, _cbData.Get());
-        context->BindCB(0, _cb);
-    }
+    BindConstants(context);
 
     // Select pipeline state based on current pass and render mode
     const bool wireframe = (_info.FeaturesFlags & MaterialFeaturesFlags::Wireframe) != MaterialFeaturesFlags::None || view.Mode == ViewMode::Wireframe;
@@ -63,11 +63,7 @@ void GUIMaterialShader::Bind(BindParameters& params)
     }
 
     // Bind constants
-    if (_cb)
-    {
-        context->UpdateCB(_cb, _cbData.Get());
-        context->BindCB(0, _cb);
-    }
+    BindConstants(context);
 
     // Bind pipeline
     context->SetState(ps);
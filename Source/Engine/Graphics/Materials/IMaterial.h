@@ -136,6 +136,15 @@ public:
         return false;
     }
 
+    /// <summary>
+    /// Gets the material object used as the identity for draw calls batching. Material instances that don't override any parameter return the base material so draw calls using them can be merged with it (and with the sibling instances).
+    /// </summary>
+    /// <returns>The material to use for draw calls batching.</returns>
+    virtual IMaterial* GetBatchingRoot()
+    {
+        return this;
+    }
+
 public:
     /// <summary>
     /// Settings for the material binding to the graphics pipeline.
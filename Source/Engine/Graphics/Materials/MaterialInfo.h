@@ -282,6 +282,11 @@ API_ENUM(Attributes="Flags") enum class MaterialFeaturesFlags : uint32
     /// The flag used to enable sampling Global Illumination in material (eg. light probes or volumetric lightmap). The Forward Pass materials option.
     /// </summary>
     GlobalIllumination = 1 << 11,
+
+    /// <summary>
+    /// The flag used to force rendering material at full resolution when the half-resolution transparency mode is enabled (eg. for UI-critical surfaces). The Forward Pass materials option.
+    /// </summary>
+    FullResolutionTransparency = 1 << 12,
 };
 
 DECLARE_ENUM_OPERATORS(MaterialFeaturesFlags);
@@ -244,10 +244,37 @@ bool MaterialShader::Load(MemoryReadStream& shaderCacheStream, const MaterialInf
     return false;
 }
 
+void MaterialShader::BindConstants(GPUContext* context)
+{
+    if (!_cb)
+        return;
+
+    const byte* data = _cbData.Get();
+    if (context->GetDevice()->Limits.HasPersistentConstantBuffers)
+    {
+        // Skip the upload when the constants match the GPU-resident data from the previous bind (FNV-1a over the whole block). Only valid when the backend keeps the buffer contents between updates - transient upload ring backends (DX12, Vulkan) recycle the memory behind the cached allocation every frame.
+        uint64 hash = 14695981039346656037ull;
+        const int32 size = _cbData.Count();
+        for (int32 i = 0; i < size; i++)
+            hash = (hash ^ data[i]) * 1099511628211ull;
+        if (hash != _cbHash)
+        {
+            _cbHash = hash;
+            context->UpdateCB(_cb, data);
+        }
+    }
+    else
+    {
+        context->UpdateCB(_cb, data);
+    }
+    context->BindCB(0, _cb);
+}
+
 void MaterialShader::Unload()
 {
     _isLoaded = false;
     _cb = nullptr;
     _cbData.Resize(0, false);
+    _cbHash = 0;
     _shader->ReleaseGPU();
 }
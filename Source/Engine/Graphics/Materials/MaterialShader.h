@@ -60,6 +60,7 @@ protected:
     GPUShader* _shader;
     GPUConstantBuffer* _cb;
     Array<byte> _cbData;
+    uint64 _cbHash = 0;
     MaterialInfo _info;
 
 protected:
@@ -102,6 +103,12 @@ protected:
     bool Load(MemoryReadStream& shaderCacheStream, const MaterialInfo& info);
     virtual bool Load() = 0;
 
+    /// <summary>
+    /// Binds the material constant buffer at slot 0. Uploads the constants only when they differ from the GPU-resident data from the previous bind (hash-based change tracking) so redrawing materials with unchanged parameters skips the upload.
+    /// </summary>
+    /// <param name="context">The GPU context to use.</param>
+    void BindConstants(GPUContext* context);
+
 public:
     // [IMaterial]
     const MaterialInfo& GetInfo() const override;
@@ -141,9 +141,10 @@ bool LightmapFeature::Bind(MaterialShader::BindParameters& params, Span<byte>& c
         params.GPUContext->BindSR(srv + 1, lightmap1);
         params.GPUContext->BindSR(srv + 2, lightmap2);
 
-        // Set lightmap data
+        // Set lightmap data (quantized to half-precision so it matches the per-instance data used when the draw gets batched - otherwise sampling flickers when batch composition changes between frames)
         auto& data = *(Data*)cb.Get();
-        data.LightmapArea = drawCall.Features.LightmapUVsArea;
+        const Float4 lightmapArea = Half4(drawCall.Features.LightmapUVsArea).ToFloat4();
+        data.LightmapArea = *(Rectangle*)&lightmapArea;
     }
 
     cb = Span<byte>(cb.Get() + sizeof(Data), cb.Length() - sizeof(Data));
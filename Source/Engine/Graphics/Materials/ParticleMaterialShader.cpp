@@ -161,11 +161,7 @@ void ParticleMaterialShader::Bind(BindParameters& params)
     GPUPipelineState* state = psCache->GetPS(cullMode, wireframe);
 
     // Bind constants
-    if (_cb)
-    {
-        context->UpdateCB(_cb, _cbData.Get());
-        context->BindCB(0, _cb);
-    }
+    BindConstants(context);
 
     // Bind pipeline
     context->SetState(state);
@@ -58,11 +58,7 @@ void PostFxMaterialShader::Bind(BindParameters& params)
     }
 
     // Bind constants
-    if (_cb)
-    {
-        context->UpdateCB(_cb, _cbData.Get());
-        context->BindCB(0, _cb);
-    }
+    BindConstants(context);
 
     // Bind pipeline
     context->SetState(_cache.Default);
@@ -93,11 +93,7 @@ void TerrainMaterialShader::Bind(BindParameters& params)
     context->BindSR(2, splatmap1);
 
     // Bind constants
-    if (_cb)
-    {
-        context->UpdateCB(_cb, _cbData.Get());
-        context->BindCB(0, _cb);
-    }
+    BindConstants(context);
 
     // Select pipeline state based on current pass and render mode
     const bool wireframe = EnumHasAnyFlags(_info.FeaturesFlags, MaterialFeaturesFlags::Wireframe) || view.Mode == ViewMode::Wireframe;
@@ -86,11 +86,7 @@ void VolumeParticleMaterialShader::Bind(BindParameters& params)
     }
 
     // Bind constants
-    if (_cb)
-    {
-        context->UpdateCB(_cb, _cbData.Get());
-        context->BindCB(0, _cb);
-    }
+    BindConstants(context);
 
     // Bind pipeline
     if (_psVolumetricFog == nullptr)
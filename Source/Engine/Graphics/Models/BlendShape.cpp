@@ -4,6 +4,7 @@
 #include "Engine/Content/Assets/SkinnedModel.h"
 #include "Engine/Graphics/GPUDevice.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Renderer/SkinningCachePass.h"
 
 BlendShapesInstance::MeshInstance::MeshInstance()
     : IsUsed(false)
@@ -11,6 +12,10 @@ BlendShapesInstance::MeshInstance::MeshInstance()
     , DirtyMinVertexIndex(0)
     , DirtyMaxVertexIndex(MAX_uint32 - 1)
     , VertexBuffer(0, sizeof(VB0SkinnedElementType), TEXT("Skinned Mesh Blend Shape"))
+    , UseGPU(false)
+    , UseNormals(false)
+    , BlendMinVertexIndex(0)
+    , BlendMaxVertexIndex(0)
 {
 }
 
@@ -79,16 +84,6 @@ void BlendShapesInstance::Update(SkinnedModel* skinnedModel)
             continue;
         const SkinnedMesh* mesh = e.Key;
 
-        // Get skinned mesh vertex buffer data (original, cached on CPU)
-        BytesContainer vertexBuffer;
-        int32 vertexCount;
-        if (mesh->DownloadDataCPU(MeshBufferType::Vertex0, vertexBuffer, vertexCount))
-        {
-            // Don't use this mesh if failed to get it's vertices data
-            instance.IsUsed = false;
-            continue;
-        }
-
         // Estimate the range of the vertices to modify by the currently active blend shapes
         uint32 minVertexIndex = MAX_uint32, maxVertexIndex = 0;
         bool useNormals = false;
@@ -109,6 +104,35 @@ void BlendShapesInstance::Update(SkinnedModel* skinnedModel)
             }
         }
 
+        // Evaluate the blend shapes on the GPU if supported (the skin cache compute pass combines the deltas without any CPU vertices processing or re-uploads)
+        if (SkinningCachePass::Instance()->SupportsBlendShapes())
+        {
+            instance.UseGPU = true;
+            instance.UseNormals = useNormals;
+            instance.BlendMinVertexIndex = minVertexIndex;
+            instance.BlendMaxVertexIndex = maxVertexIndex;
+            instance.GPUBlendShapes.Clear();
+            for (const auto& q : blendShapes)
+                instance.GPUBlendShapes.Add(Pair<const BlendShape*, float>(&q.First, q.Second));
+            instance.IsDirty = true;
+
+            // Mark the whole CPU buffer as dirty so a fallback to the CPU blending restores all of the vertices
+            instance.DirtyMinVertexIndex = 0;
+            instance.DirtyMaxVertexIndex = MAX_uint32 - 1;
+            continue;
+        }
+        instance.UseGPU = false;
+
+        // Get skinned mesh vertex buffer data (original, cached on CPU)
+        BytesContainer vertexBuffer;
+        int32 vertexCount;
+        if (mesh->DownloadDataCPU(MeshBufferType::Vertex0, vertexBuffer, vertexCount))
+        {
+            // Don't use this mesh if failed to get it's vertices data
+            instance.IsUsed = false;
+            continue;
+        }
+
         // Initialize the dynamic vertex buffer data (use the dirty range from the previous update to be cleared with initial data)
         instance.VertexBuffer.Data.Resize(vertexBuffer.Length());
         const uint32 dirtyVertexDataStart = instance.DirtyMinVertexIndex * sizeof(VB0SkinnedElementType);
@@ -95,6 +95,13 @@ public:
         uint32 DirtyMaxVertexIndex;
         DynamicVertexBuffer VertexBuffer;
 
+        // GPU blend shapes evaluation (used instead of the CPU vertices blending when the skin cache compute pass is supported)
+        bool UseGPU;
+        bool UseNormals;
+        uint32 BlendMinVertexIndex;
+        uint32 BlendMaxVertexIndex;
+        Array<Pair<const BlendShape*, float>> GPUBlendShapes;
+
         MeshInstance();
         ~MeshInstance();
     };
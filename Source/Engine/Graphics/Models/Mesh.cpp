@@ -1,6 +1,7 @@
 // Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
 
 #include "Mesh.h"
+#include "MeshBufferPool.h"
 #include "ModelInstanceEntry.h"
 #include "Engine/Content/Assets/Material.h"
 #include "Engine/Content/Assets/Model.h"
@@ -23,6 +24,20 @@
 
 namespace
 {
+    void ReleaseMeshBuffer(GPUBuffer*& buffer, MeshBufferAllocation& allocation)
+    {
+        if (allocation.IsValid())
+        {
+            // Pooled meshes return their range to the pool (page buffer is owned by the pool)
+            MeshBufferPool::Free(allocation);
+            buffer = nullptr;
+        }
+        else
+        {
+            SAFE_DELETE_GPU_RESOURCE(buffer);
+        }
+    }
+
     template<typename IndexType>
     bool UpdateMesh(Mesh* mesh, uint32 vertexCount, uint32 triangleCount, Float3* vertices, IndexType* triangles, Float3* normals, Float3* tangents, Float2* uvs, Color32* colors)
     {
@@ -203,7 +218,7 @@ bool Mesh::UpdateTriangles(uint32 triangleCount, void* ib, bool use16BitIndices)
     // TODO: update collision proxy
 
     // Initialize
-    SAFE_DELETE_GPU_RESOURCE(_indexBuffer);
+    ReleaseMeshBuffer(_indexBuffer, _indexBufferAlloc);
     _indexBuffer = indexBuffer;
     _triangles = triangleCount;
     _use16BitIndexBuffer = use16BitIndices;
@@ -227,15 +242,19 @@ void Mesh::Init(Model* model, int32 lodIndex, int32 index, int32 materialSlotInd
     _vertexBuffers[1] = nullptr;
     _vertexBuffers[2] = nullptr;
     _indexBuffer = nullptr;
+    _vertexBuffersAlloc[0] = MeshBufferAllocation();
+    _vertexBuffersAlloc[1] = MeshBufferAllocation();
+    _vertexBuffersAlloc[2] = MeshBufferAllocation();
+    _indexBufferAlloc = MeshBufferAllocation();
 }
 
 Mesh::~Mesh()
 {
     // Release buffers
-    SAFE_DELETE_GPU_RESOURCE(_vertexBuffers[0]);
-    SAFE_DELETE_GPU_RESOURCE(_vertexBuffers[1]);
-    SAFE_DELETE_GPU_RESOURCE(_vertexBuffers[2]);
-    SAFE_DELETE_GPU_RESOURCE(_indexBuffer);
+    ReleaseMeshBuffer(_vertexBuffers[0], _vertexBuffersAlloc[0]);
+    ReleaseMeshBuffer(_vertexBuffers[1], _vertexBuffersAlloc[1]);
+    ReleaseMeshBuffer(_vertexBuffers[2], _vertexBuffersAlloc[2]);
+    ReleaseMeshBuffer(_indexBuffer, _indexBufferAlloc);
 }
 
 bool Mesh::Load(uint32 vertices, uint32 triangles, void* vb0, void* vb1, void* vb2, void* ib, bool use16BitIndexBuffer)
@@ -248,28 +267,41 @@ bool Mesh::Load(uint32 vertices, uint32 triangles, void* vb0, void* vb1, void* v
     GPUBuffer* vertexBuffer1 = nullptr;
     GPUBuffer* vertexBuffer2 = nullptr;
     GPUBuffer* indexBuffer = nullptr;
+    MeshBufferAllocation vertexAlloc0, vertexAlloc1, vertexAlloc2, indexAlloc;
 
-    // Create GPU buffers
+    // Create GPU buffers (small meshes are placed inside the shared pool pages, large ones get dedicated buffers)
 #if GPU_ENABLE_RESOURCE_NAMING
 #define MESH_BUFFER_NAME(postfix) GetModel()->GetPath() + TEXT(postfix)
 #else
 #define MESH_BUFFER_NAME(postfix) String::Empty
 #endif
-    vertexBuffer0 = GPUDevice::Instance->CreateBuffer(MESH_BUFFER_NAME(".VB0"));
-    if (vertexBuffer0->Init(GPUBufferDescription::Vertex(sizeof(VB0ElementType), vertices, vb0)))
-        goto ERROR_LOAD_END;
-    vertexBuffer1 = GPUDevice::Instance->CreateBuffer(MESH_BUFFER_NAME(".VB1"));
-    if (vertexBuffer1->Init(GPUBufferDescription::Vertex(sizeof(VB1ElementType), vertices, vb1)))
-        goto ERROR_LOAD_END;
+    if (MeshBufferPool::Allocate(vertices * sizeof(VB0ElementType), sizeof(VB0ElementType), false, vb0, vertexAlloc0))
+    {
+        vertexBuffer0 = GPUDevice::Instance->CreateBuffer(MESH_BUFFER_NAME(".VB0"));
+        if (vertexBuffer0->Init(GPUBufferDescription::Vertex(sizeof(VB0ElementType), vertices, vb0)))
+            goto ERROR_LOAD_END;
+    }
+    if (MeshBufferPool::Allocate(vertices * sizeof(VB1ElementType), sizeof(VB1ElementType), false, vb1, vertexAlloc1))
+    {
+        vertexBuffer1 = GPUDevice::Instance->CreateBuffer(MESH_BUFFER_NAME(".VB1"));
+        if (vertexBuffer1->Init(GPUBufferDescription::Vertex(sizeof(VB1ElementType), vertices, vb1)))
+            goto ERROR_LOAD_END;
+    }
     if (vb2)
     {
-        vertexBuffer2 = GPUDevice::Instance->CreateBuffer(MESH_BUFFER_NAME(".VB2"));
-        if (vertexBuffer2->Init(GPUBufferDescription::Vertex(sizeof(VB2ElementType), vertices, vb2)))
+        if (MeshBufferPool::Allocate(vertices * sizeof(VB2ElementType), sizeof(VB2ElementType), false, vb2, vertexAlloc2))
+        {
+            vertexBuffer2 = GPUDevice::Instance->CreateBuffer(MESH_BUFFER_NAME(".VB2"));
+            if (vertexBuffer2->Init(GPUBufferDescription::Vertex(sizeof(VB2ElementType), vertices, vb2)))
+                goto ERROR_LOAD_END;
+        }
+    }
+    if (MeshBufferPool::Allocate(indicesCount * ibStride, ibStride, true, ib, indexAlloc))
+    {
+        indexBuffer = GPUDevice::Instance->CreateBuffer(MESH_BUFFER_NAME(".IB"));
+        if (indexBuffer->Init(GPUBufferDescription::Index(ibStride, indicesCount, ib)))
             goto ERROR_LOAD_END;
     }
-    indexBuffer = GPUDevice::Instance->CreateBuffer(MESH_BUFFER_NAME(".IB"));
-    if (indexBuffer->Init(GPUBufferDescription::Index(ibStride, indicesCount, ib)))
-        goto ERROR_LOAD_END;
 
     // Init collision proxy
 #if USE_PRECISE_MESH_INTERSECTS
@@ -283,10 +315,21 @@ bool Mesh::Load(uint32 vertices, uint32 triangles, void* vb0, void* vb1, void* v
 #endif
 
     // Initialize
-    _vertexBuffers[0] = vertexBuffer0;
-    _vertexBuffers[1] = vertexBuffer1;
-    _vertexBuffers[2] = vertexBuffer2;
-    _indexBuffer = indexBuffer;
+    _vertexBuffers[0] = vertexAlloc0.IsValid() ? vertexAlloc0.Buffer : vertexBuffer0;
+    _vertexBuffers[1] = vertexAlloc1.IsValid() ? vertexAlloc1.Buffer : vertexBuffer1;
+    _vertexBuffers[2] = vertexAlloc2.IsValid() ? vertexAlloc2.Buffer : vertexBuffer2;
+    _indexBuffer = indexAlloc.IsValid() ? indexAlloc.Buffer : indexBuffer;
+    _vertexBuffersAlloc[0] = vertexAlloc0;
+    _vertexBuffersAlloc[1] = vertexAlloc1;
+    _vertexBuffersAlloc[2] = vertexAlloc2;
+    _indexBufferAlloc = indexAlloc;
+    for (int32 i = 0; i < 3; i++)
+    {
+        if (_vertexBuffersAlloc[i].IsValid())
+            MeshBufferPool::Track(_vertexBuffersAlloc[i], _vertexBuffers[i]);
+    }
+    if (_indexBufferAlloc.IsValid())
+        MeshBufferPool::Track(_indexBufferAlloc, _indexBuffer);
     _triangles = triangles;
     _vertices = vertices;
     _use16BitIndexBuffer = use16BitIndexBuffer;
@@ -299,6 +342,10 @@ bool Mesh::Load(uint32 vertices, uint32 triangles, void* vb0, void* vb1, void* v
 #undef MESH_BUFFER_NAME
 ERROR_LOAD_END:
 
+    MeshBufferPool::Free(vertexAlloc0);
+    MeshBufferPool::Free(vertexAlloc1);
+    MeshBufferPool::Free(vertexAlloc2);
+    MeshBufferPool::Free(indexAlloc);
     SAFE_DELETE_GPU_RESOURCE(vertexBuffer0);
     SAFE_DELETE_GPU_RESOURCE(vertexBuffer1);
     SAFE_DELETE_GPU_RESOURCE(vertexBuffer2);
@@ -308,10 +355,10 @@ ERROR_LOAD_END:
 
 void Mesh::Unload()
 {
-    SAFE_DELETE_GPU_RESOURCE(_vertexBuffers[0]);
-    SAFE_DELETE_GPU_RESOURCE(_vertexBuffers[1]);
-    SAFE_DELETE_GPU_RESOURCE(_vertexBuffers[2]);
-    SAFE_DELETE_GPU_RESOURCE(_indexBuffer);
+    ReleaseMeshBuffer(_vertexBuffers[0], _vertexBuffersAlloc[0]);
+    ReleaseMeshBuffer(_vertexBuffers[1], _vertexBuffersAlloc[1]);
+    ReleaseMeshBuffer(_vertexBuffers[2], _vertexBuffersAlloc[2]);
+    ReleaseMeshBuffer(_indexBuffer, _indexBufferAlloc);
     _triangles = 0;
     _vertices = 0;
     _use16BitIndexBuffer = false;
@@ -391,10 +438,10 @@ void Mesh::GetDrawCallGeometry(DrawCall& drawCall) const
     drawCall.Geometry.VertexBuffers[0] = _vertexBuffers[0];
     drawCall.Geometry.VertexBuffers[1] = _vertexBuffers[1];
     drawCall.Geometry.VertexBuffers[2] = _vertexBuffers[2];
-    drawCall.Geometry.VertexBuffersOffsets[0] = 0;
-    drawCall.Geometry.VertexBuffersOffsets[1] = 0;
-    drawCall.Geometry.VertexBuffersOffsets[2] = 0;
-    drawCall.Draw.StartIndex = 0;
+    drawCall.Geometry.VertexBuffersOffsets[0] = _vertexBuffersAlloc[0].Offset;
+    drawCall.Geometry.VertexBuffersOffsets[1] = _vertexBuffersAlloc[1].Offset;
+    drawCall.Geometry.VertexBuffersOffsets[2] = _vertexBuffersAlloc[2].Offset;
+    drawCall.Draw.StartIndex = _indexBufferAlloc.Offset / (_use16BitIndexBuffer ? sizeof(uint16) : sizeof(uint32));
     drawCall.Draw.IndicesCount = _triangles * 3;
 }
 
@@ -403,9 +450,11 @@ void Mesh::Render(GPUContext* context) const
     if (!IsInitialized())
         return;
 
-    context->BindVB(ToSpan((GPUBuffer**)_vertexBuffers, 3));
+    const uint32 vbOffsets[3] = { _vertexBuffersAlloc[0].Offset, _vertexBuffersAlloc[1].Offset, _vertexBuffersAlloc[2].Offset };
+    const int32 startIndex = _indexBufferAlloc.Offset / (_use16BitIndexBuffer ? sizeof(uint16) : sizeof(uint32));
+    context->BindVB(ToSpan((GPUBuffer**)_vertexBuffers, 3), vbOffsets);
     context->BindIB(_indexBuffer);
-    context->DrawIndexedInstanced(_triangles * 3, 1, 0, 0, 0);
+    context->DrawIndexedInstanced(_triangles * 3, 1, 0, 0, startIndex);
 }
 
 void Mesh::Draw(const RenderContext& renderContext, MaterialBase* material, const Matrix& world, StaticFlags flags, bool receiveDecals, DrawPass drawModes, float perInstanceRandom, int16 sortOrder) const
@@ -422,10 +471,10 @@ void Mesh::Draw(const RenderContext& renderContext, MaterialBase* material, cons
     drawCall.Geometry.VertexBuffers[0] = _vertexBuffers[0];
     drawCall.Geometry.VertexBuffers[1] = _vertexBuffers[1];
     drawCall.Geometry.VertexBuffers[2] = _vertexBuffers[2];
-    drawCall.Geometry.VertexBuffersOffsets[0] = 0;
-    drawCall.Geometry.VertexBuffersOffsets[1] = 0;
-    drawCall.Geometry.VertexBuffersOffsets[2] = 0;
-    drawCall.Draw.StartIndex = 0;
+    drawCall.Geometry.VertexBuffersOffsets[0] = _vertexBuffersAlloc[0].Offset;
+    drawCall.Geometry.VertexBuffersOffsets[1] = _vertexBuffersAlloc[1].Offset;
+    drawCall.Geometry.VertexBuffersOffsets[2] = _vertexBuffersAlloc[2].Offset;
+    drawCall.Draw.StartIndex = _indexBufferAlloc.Offset / (_use16BitIndexBuffer ? sizeof(uint16) : sizeof(uint32));
     drawCall.Draw.IndicesCount = _triangles * 3;
     drawCall.InstanceCount = 1;
     drawCall.Material = material;
@@ -479,9 +528,9 @@ void Mesh::Draw(const RenderContext& renderContext, const DrawInfo& info, float
     drawCall.Geometry.VertexBuffers[0] = _vertexBuffers[0];
     drawCall.Geometry.VertexBuffers[1] = _vertexBuffers[1];
     drawCall.Geometry.VertexBuffers[2] = _vertexBuffers[2];
-    drawCall.Geometry.VertexBuffersOffsets[0] = 0;
-    drawCall.Geometry.VertexBuffersOffsets[1] = 0;
-    drawCall.Geometry.VertexBuffersOffsets[2] = 0;
+    drawCall.Geometry.VertexBuffersOffsets[0] = _vertexBuffersAlloc[0].Offset;
+    drawCall.Geometry.VertexBuffersOffsets[1] = _vertexBuffersAlloc[1].Offset;
+    drawCall.Geometry.VertexBuffersOffsets[2] = _vertexBuffersAlloc[2].Offset;
     if (info.VertexColors && info.VertexColors[_lodIndex])
     {
         // TODO: cache vertexOffset within the model LOD per-mesh
@@ -491,7 +540,7 @@ void Mesh::Draw(const RenderContext& renderContext, const DrawInfo& info, float
         drawCall.Geometry.VertexBuffers[2] = info.VertexColors[_lodIndex];
         drawCall.Geometry.VertexBuffersOffsets[2] = vertexOffset * sizeof(VB2ElementType);
     }
-    drawCall.Draw.StartIndex = 0;
+    drawCall.Draw.StartIndex = _indexBufferAlloc.Offset / (_use16BitIndexBuffer ? sizeof(uint16) : sizeof(uint32));
     drawCall.Draw.IndicesCount = _triangles * 3;
     drawCall.InstanceCount = 1;
     drawCall.Material = material;
@@ -539,9 +588,9 @@ void Mesh::Draw(const RenderContextBatch& renderContextBatch, const DrawInfo& in
     drawCall.Geometry.VertexBuffers[0] = _vertexBuffers[0];
     drawCall.Geometry.VertexBuffers[1] = _vertexBuffers[1];
     drawCall.Geometry.VertexBuffers[2] = _vertexBuffers[2];
-    drawCall.Geometry.VertexBuffersOffsets[0] = 0;
-    drawCall.Geometry.VertexBuffersOffsets[1] = 0;
-    drawCall.Geometry.VertexBuffersOffsets[2] = 0;
+    drawCall.Geometry.VertexBuffersOffsets[0] = _vertexBuffersAlloc[0].Offset;
+    drawCall.Geometry.VertexBuffersOffsets[1] = _vertexBuffersAlloc[1].Offset;
+    drawCall.Geometry.VertexBuffersOffsets[2] = _vertexBuffersAlloc[2].Offset;
     if (info.VertexColors && info.VertexColors[_lodIndex])
     {
         // TODO: cache vertexOffset within the model LOD per-mesh
@@ -551,7 +600,7 @@ void Mesh::Draw(const RenderContextBatch& renderContextBatch, const DrawInfo& in
         drawCall.Geometry.VertexBuffers[2] = info.VertexColors[_lodIndex];
         drawCall.Geometry.VertexBuffersOffsets[2] = vertexOffset * sizeof(VB2ElementType);
     }
-    drawCall.Draw.StartIndex = 0;
+    drawCall.Draw.StartIndex = _indexBufferAlloc.Offset / (_use16BitIndexBuffer ? sizeof(uint16) : sizeof(uint32));
     drawCall.Draw.IndicesCount = _triangles * 3;
     drawCall.InstanceCount = 1;
     drawCall.Material = material;
@@ -581,43 +630,76 @@ void Mesh::Draw(const RenderContextBatch& renderContextBatch, const DrawInfo& in
 bool Mesh::DownloadDataGPU(MeshBufferType type, BytesContainer& result) const
 {
     GPUBuffer* buffer = nullptr;
+    MeshBufferAllocation allocation;
     switch (type)
     {
     case MeshBufferType::Index:
         buffer = _indexBuffer;
+        allocation = _indexBufferAlloc;
         break;
     case MeshBufferType::Vertex0:
         buffer = _vertexBuffers[0];
+        allocation = _vertexBuffersAlloc[0];
         break;
     case MeshBufferType::Vertex1:
         buffer = _vertexBuffers[1];
+        allocation = _vertexBuffersAlloc[1];
         break;
     case MeshBufferType::Vertex2:
         buffer = _vertexBuffers[2];
+        allocation = _vertexBuffersAlloc[2];
         break;
     }
-    return buffer && buffer->DownloadData(result);
+    const bool failed = buffer && buffer->DownloadData(result);
+    if (!failed && allocation.IsValid() && result.Length() >= (int32)(allocation.Offset + allocation.Size))
+    {
+        // Pooled meshes download the whole page so slice out the mesh range
+        BytesContainer range;
+        range.Copy(result.Get() + allocation.Offset, allocation.Size);
+        result.Swap(range);
+    }
+    return failed;
 }
 
 Task* Mesh::DownloadDataGPUAsync(MeshBufferType type, BytesContainer& result) const
 {
     GPUBuffer* buffer = nullptr;
+    MeshBufferAllocation allocation;
     switch (type)
     {
     case MeshBufferType::Index:
         buffer = _indexBuffer;
+        allocation = _indexBufferAlloc;
         break;
     case MeshBufferType::Vertex0:
         buffer = _vertexBuffers[0];
+        allocation = _vertexBuffersAlloc[0];
         break;
     case MeshBufferType::Vertex1:
         buffer = _vertexBuffers[1];
+        allocation = _vertexBuffersAlloc[1];
         break;
     case MeshBufferType::Vertex2:
         buffer = _vertexBuffers[2];
+        allocation = _vertexBuffersAlloc[2];
         break;
     }
-    return buffer ? buffer->DownloadDataAsync(result) : nullptr;
+    Task* task = buffer ? buffer->DownloadDataAsync(result) : nullptr;
+    if (task && allocation.IsValid())
+    {
+        // Pooled meshes download the whole page so slice out the mesh range when the data arrives
+        BytesContainer* resultPtr = &result;
+        task->ContinueWith(Function<void()>([resultPtr, allocation]()
+        {
+            if (resultPtr->Length() >= (int32)(allocation.Offset + allocation.Size))
+            {
+                BytesContainer range;
+                range.Copy(resultPtr->Get() + allocation.Offset, allocation.Size);
+                resultPtr->Swap(range);
+            }
+        }));
+    }
+    return task;
 }
 
 bool Mesh::DownloadDataCPU(MeshBufferType type, BytesContainer& result, int32& count) const
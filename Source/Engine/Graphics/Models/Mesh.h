@@ -3,6 +3,7 @@
 #pragma once
 
 #include "MeshBase.h"
+#include "MeshBufferPool.h"
 #include "ModelInstanceEntry.h"
 #include "Config.h"
 #include "Types.h"
@@ -22,6 +23,8 @@ protected:
     bool _hasLightmapUVs;
     GPUBuffer* _vertexBuffers[3] = {};
     GPUBuffer* _indexBuffer = nullptr;
+    MeshBufferAllocation _vertexBuffersAlloc[3];
+    MeshBufferAllocation _indexBufferAlloc;
 #if USE_PRECISE_MESH_INTERSECTS
     CollisionProxy _collisionProxy;
 #endif
@@ -0,0 +1,285 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "MeshBufferPool.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Graphics/GPUBuffer.h"
+#include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/Async/Tasks/GPUUploadBufferTask.h"
+#include "Engine/Platform/CriticalSection.h"
+#include "Engine/Threading/Threading.h"
+
+namespace
+{
+    struct PoolFreeRange
+    {
+        uint32 Offset;
+        uint32 Size;
+    };
+
+    struct PoolPage
+    {
+        GPUBuffer* Buffer;
+        uint32 Stride;
+        bool IsIndexBuffer;
+        uint32 UsedSize;
+        Array<PoolFreeRange> FreeList; // Sorted by offset so adjacent ranges can be merged on free
+    };
+
+    struct TrackedAllocation
+    {
+        MeshBufferAllocation* Allocation;
+        GPUBuffer** BufferRef;
+    };
+
+    CriticalSection PoolLocker;
+    Array<PoolPage*> Pages;
+    Array<TrackedAllocation> TrackedAllocations;
+    uint64 PoolUsedMemory = 0;
+    uint64 PoolAllocatedMemory = 0;
+    uint32 PoolGeneration = 0;
+
+    bool PageAllocate(PoolPage* page, uint32 size, uint32& offset)
+    {
+        // First-fit scan over the sorted free-list
+        for (int32 i = 0; i < page->FreeList.Count(); i++)
+        {
+            auto& range = page->FreeList[i];
+            if (range.Size >= size)
+            {
+                offset = range.Offset;
+                range.Offset += size;
+                range.Size -= size;
+                if (range.Size == 0)
+                    page->FreeList.RemoveAtKeepOrder(i);
+                page->UsedSize += size;
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void PageFree(PoolPage* page, uint32 offset, uint32 size)
+    {
+        // Insert the range into the sorted free-list and merge it with the adjacent ranges (compaction)
+        page->UsedSize -= size;
+        int32 index = 0;
+        while (index < page->FreeList.Count() && page->FreeList[index].Offset < offset)
+            index++;
+        page->FreeList.Insert(index, { offset, size });
+        if (index + 1 < page->FreeList.Count() && page->FreeList[index].Offset + page->FreeList[index].Size == page->FreeList[index + 1].Offset)
+        {
+            page->FreeList[index].Size += page->FreeList[index + 1].Size;
+            page->FreeList.RemoveAtKeepOrder(index + 1);
+        }
+        if (index > 0 && page->FreeList[index - 1].Offset + page->FreeList[index - 1].Size == page->FreeList[index].Offset)
+        {
+            page->FreeList[index - 1].Size += page->FreeList[index].Size;
+            page->FreeList.RemoveAtKeepOrder(index);
+        }
+    }
+
+    void UploadData(GPUBuffer* buffer, uint32 offset, uint32 size, const void* initData)
+    {
+        const auto device = GPUDevice::Instance;
+        if (device->IsRendering() && IsInMainThread())
+        {
+            // Upload resource data now
+            device->GetMainContext()->UpdateBuffer(buffer, initData, size, offset);
+        }
+        else
+        {
+            // Create async resource copy task
+            auto copyTask = ::New<GPUUploadBufferTask>(buffer, offset, Span<byte>((byte*)initData, size), true);
+            ASSERT(copyTask->HasReference(buffer));
+            copyTask->Start();
+        }
+    }
+}
+
+bool MeshBufferPool::Allocate(uint32 size, uint32 stride, bool isIndexBuffer, const void* initData, MeshBufferAllocation& result)
+{
+    ASSERT(size != 0 && stride != 0 && size % stride == 0);
+    if (size > MaxPooledAllocationSize)
+        return true;
+    ScopeLock lock(PoolLocker);
+
+    // Try to place the data inside one of the existing pages
+    PoolPage* page = nullptr;
+    uint32 offset = 0;
+    for (int32 i = 0; i < Pages.Count(); i++)
+    {
+        auto e = Pages[i];
+        if (e->Stride == stride && e->IsIndexBuffer == isIndexBuffer && !PageAllocate(e, size, offset))
+        {
+            page = e;
+            break;
+        }
+    }
+
+    // Create a new page if none has enough free space
+    if (!page)
+    {
+        const uint32 pageElements = (uint32)PageSize / stride;
+        const uint32 pageSize = pageElements * stride;
+        auto pageBuffer = GPUDevice::Instance->CreateBuffer(TEXT("MeshBufferPool.Page"));
+        const GPUBufferDescription desc = isIndexBuffer ? GPUBufferDescription::Index(stride, pageElements) : GPUBufferDescription::Vertex(stride, pageElements);
+        if (pageBuffer->Init(desc))
+        {
+            SAFE_DELETE_GPU_RESOURCE(pageBuffer);
+            return true;
+        }
+        page = ::New<PoolPage>();
+        page->Buffer = pageBuffer;
+        page->Stride = stride;
+        page->IsIndexBuffer = isIndexBuffer;
+        page->UsedSize = size;
+        page->FreeList.Add({ size, pageSize - size });
+        Pages.Add(page);
+        PoolAllocatedMemory += pageSize;
+        offset = 0;
+    }
+    PoolUsedMemory += size;
+
+    // Upload the initial data to the allocated range
+    if (initData)
+        UploadData(page->Buffer, offset, size, initData);
+
+    result.Buffer = page->Buffer;
+    result.Offset = offset;
+    result.Size = size;
+    result.Page = page;
+    return false;
+}
+
+void MeshBufferPool::Free(MeshBufferAllocation& allocation)
+{
+    if (!allocation.IsValid())
+        return;
+    ScopeLock lock(PoolLocker);
+    const auto page = (PoolPage*)allocation.Page;
+    ASSERT(page && page->UsedSize >= allocation.Size);
+    PoolUsedMemory -= allocation.Size;
+
+    // Untrack the allocation if it was registered as movable
+    for (int32 i = 0; i < TrackedAllocations.Count(); i++)
+    {
+        if (TrackedAllocations[i].Allocation == &allocation)
+        {
+            TrackedAllocations.RemoveAt(i);
+            break;
+        }
+    }
+
+    // Release the whole page when the last allocation gets freed
+    if (page->UsedSize == allocation.Size)
+    {
+        PoolAllocatedMemory -= page->Buffer->GetSize();
+        SAFE_DELETE_GPU_RESOURCE(page->Buffer);
+        Pages.Remove(page);
+        ::Delete(page);
+    }
+    else
+    {
+        PageFree(page, allocation.Offset, allocation.Size);
+    }
+
+    allocation = MeshBufferAllocation();
+}
+
+void MeshBufferPool::Track(MeshBufferAllocation& allocation, GPUBuffer*& bufferRef)
+{
+    if (!allocation.IsValid())
+        return;
+    ScopeLock lock(PoolLocker);
+    TrackedAllocations.Add({ &allocation, &bufferRef });
+}
+
+uint64 MeshBufferPool::Defrag(uint64 maxBytesToMove)
+{
+    // Relocations use GPU copies on the main context so in-flight frames still see the old data
+    const auto device = GPUDevice::Instance;
+    if (!device || !device->IsRendering() || !IsInMainThread())
+        return 0;
+    const auto context = device->GetMainContext();
+    ScopeLock lock(PoolLocker);
+    uint64 movedBytes = 0;
+    uint64 releasedBytes = 0;
+    Array<TrackedAllocation*> pageAllocations;
+    for (int32 pageIndex = 0; pageIndex < Pages.Count(); pageIndex++)
+    {
+        const auto page = Pages[pageIndex];
+
+        // Pick only sparsely used pages where every live range is registered as movable
+        const uint32 pageSize = (uint32)page->Buffer->GetSize();
+        if (page->UsedSize == 0 || page->UsedSize * 2 > pageSize)
+            continue;
+        pageAllocations.Clear();
+        uint32 trackedSize = 0;
+        for (auto& e : TrackedAllocations)
+        {
+            if (e.Allocation->Page == page)
+            {
+                pageAllocations.Add(&e);
+                trackedSize += e.Allocation->Size;
+            }
+        }
+        if (trackedSize != page->UsedSize || movedBytes + page->UsedSize > maxBytesToMove)
+            continue;
+
+        // Relocate the ranges into the free space of the other compatible pages
+        for (TrackedAllocation* e : pageAllocations)
+        {
+            PoolPage* host = nullptr;
+            uint32 newOffset = 0;
+            for (int32 i = 0; i < Pages.Count(); i++)
+            {
+                const auto other = Pages[i];
+                if (other != page && other->Stride == page->Stride && other->IsIndexBuffer == page->IsIndexBuffer && !PageAllocate(other, e->Allocation->Size, newOffset))
+                {
+                    host = other;
+                    break;
+                }
+            }
+            if (!host)
+                break;
+            context->CopyBuffer(host->Buffer, page->Buffer, e->Allocation->Size, newOffset, e->Allocation->Offset);
+            PageFree(page, e->Allocation->Offset, e->Allocation->Size);
+            e->Allocation->Buffer = host->Buffer;
+            e->Allocation->Offset = newOffset;
+            e->Allocation->Page = host;
+            *e->BufferRef = host->Buffer;
+            movedBytes += e->Allocation->Size;
+            PoolGeneration++;
+        }
+
+        // Release the page when all of its ranges got moved out
+        if (page->UsedSize == 0)
+        {
+            releasedBytes += pageSize;
+            PoolAllocatedMemory -= pageSize;
+            SAFE_DELETE_GPU_RESOURCE(page->Buffer);
+            Pages.RemoveAtKeepOrder(pageIndex--);
+            ::Delete(page);
+        }
+    }
+    return releasedBytes;
+}
+
+uint32 MeshBufferPool::GetGeneration()
+{
+    ScopeLock lock(PoolLocker);
+    return PoolGeneration;
+}
+
+uint64 MeshBufferPool::GetUsedMemory()
+{
+    ScopeLock lock(PoolLocker);
+    return PoolUsedMemory;
+}
+
+uint64 MeshBufferPool::GetAllocatedMemory()
+{
+    ScopeLock lock(PoolLocker);
+    return PoolAllocatedMemory;
+}
@@ -0,0 +1,106 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Types/BaseTypes.h"
+
+class GPUBuffer;
+
+/// <summary>
+/// Describes a single range suballocated from one of the mesh buffer pool pages.
+/// </summary>
+struct FLAXENGINE_API MeshBufferAllocation
+{
+    /// <summary>
+    /// The pool page buffer that contains the allocated range (owned by the pool, not by the allocation).
+    /// </summary>
+    GPUBuffer* Buffer = nullptr;
+
+    /// <summary>
+    /// The offset of the allocated range from the page start (in bytes).
+    /// </summary>
+    uint32 Offset = 0;
+
+    /// <summary>
+    /// The size of the allocated range (in bytes).
+    /// </summary>
+    uint32 Size = 0;
+
+    /// <summary>
+    /// The internal pool page handle.
+    /// </summary>
+    void* Page = nullptr;
+
+    /// <summary>
+    /// Determines whether this allocation points to a valid pooled range.
+    /// </summary>
+    FORCE_INLINE bool IsValid() const
+    {
+        return Buffer != nullptr;
+    }
+};
+
+/// <summary>
+/// Suballocating memory pool for static mesh geometry. Packs many small vertex and index buffers into large shared
+/// pages (offset-based placement with free-list compaction) to reduce the VRAM overhead caused by the per-buffer
+/// allocation granularity and to allow draws from pooled meshes to share buffer binds.
+/// </summary>
+class FLAXENGINE_API MeshBufferPool
+{
+public:
+    /// <summary>
+    /// The size of a single pool page (in bytes).
+    /// </summary>
+    enum { PageSize = 8 * 1024 * 1024 };
+
+    /// <summary>
+    /// Allocations above this size use a dedicated buffer instead of a pooled range (in bytes).
+    /// </summary>
+    enum { MaxPooledAllocationSize = PageSize / 4 };
+
+    /// <summary>
+    /// Allocates a range inside one of the pool pages (creates a new page if none has enough free space) and uploads the initial data to it.
+    /// </summary>
+    /// <param name="size">The size of the range to allocate (in bytes).</param>
+    /// <param name="stride">The buffer element stride (in bytes). Pages are shared only between buffers of the same stride so allocation offsets stay element-aligned.</param>
+    /// <param name="isIndexBuffer">True if allocating an index buffer range, otherwise a vertex buffer range.</param>
+    /// <param name="initData">The initial data to upload to the allocated range (can be null). Has to be valid for the next few frames if called during async loading.</param>
+    /// <param name="result">The output allocation.</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    static bool Allocate(uint32 size, uint32 stride, bool isIndexBuffer, const void* initData, MeshBufferAllocation& result);
+
+    /// <summary>
+    /// Frees the allocated range and returns it to the page free-list (merging it with the adjacent free ranges). Releases the page when it becomes empty.
+    /// </summary>
+    /// <param name="allocation">The allocation to free (cleared on return).</param>
+    static void Free(MeshBufferAllocation& allocation);
+
+    /// <summary>
+    /// Registers the allocation as movable so Defrag can relocate it to another page. Both references have to stay valid until the allocation gets freed (use the final storage location, not a temporary copy).
+    /// </summary>
+    /// <param name="allocation">The allocation to track (updated in-place when relocated).</param>
+    /// <param name="bufferRef">The cached page buffer pointer of the allocation owner (updated in-place when relocated).</param>
+    static void Track(MeshBufferAllocation& allocation, GPUBuffer*& bufferRef);
+
+    /// <summary>
+    /// Defragments the pool by relocating the tracked allocations out of sparsely used pages into the free space of other pages (via GPU buffer copies), releasing the emptied pages. Has to be called on the main thread outside of the scene rendering (eg. during a loading screen) since in-flight draws still reference the old locations for the current frame.
+    /// </summary>
+    /// <param name="maxBytesToMove">The maximum amount of data to copy in a single call (in bytes). Use a smaller limit to amortize the defragmentation cost over several frames.</param>
+    /// <returns>The amount of pages memory released back to the GPU (in bytes).</returns>
+    static uint64 Defrag(uint64 maxBytesToMove = MAX_uint64);
+
+    /// <summary>
+    /// Gets the pool generation number, incremented every time any allocation gets relocated by Defrag. Can be used to detect moves when caching allocation offsets externally.
+    /// </summary>
+    static uint32 GetGeneration();
+
+    /// <summary>
+    /// Gets the total amount of memory used by the pooled allocations (in bytes).
+    /// </summary>
+    static uint64 GetUsedMemory();
+
+    /// <summary>
+    /// Gets the total amount of memory allocated for the pool pages (in bytes).
+    /// </summary>
+    static uint64 GetAllocatedMemory();
+};
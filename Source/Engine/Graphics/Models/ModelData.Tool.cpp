@@ -8,6 +8,7 @@
 #include "Engine/Core/Types/DateTime.h"
 #include "Engine/Core/Types/TimeSpan.h"
 #include "Engine/Core/Collections/BitArray.h"
+#include "Engine/Core/Collections/Dictionary.h"
 #include "Engine/Tools/ModelTool/ModelTool.h"
 #include "Engine/Tools/ModelTool/VertexTriangleAdjacency.h"
 #include "Engine/Platform/Platform.h"
@@ -884,3 +885,92 @@ float MeshData::CalculateTrianglesArea() const
 }
 
 #endif
+
+bool MeshData::BuildMeshlets(int32 maxVertices, int32 maxTriangles, Array<Meshlet>& meshlets, Array<uint32>& meshletVertices, Array<byte>& meshletTriangles) const
+{
+    if (Positions.IsEmpty() || Indices.IsEmpty() || maxVertices < 3 || maxVertices > 255 || maxTriangles < 1)
+        return true;
+    const int32 triangleCount = Indices.Count() / 3;
+    meshlets.Clear();
+    meshletVertices.Clear();
+    meshletTriangles.Clear();
+    meshlets.EnsureCapacity(triangleCount / maxTriangles + 1);
+    meshletVertices.EnsureCapacity(Positions.Count());
+    meshletTriangles.EnsureCapacity(Indices.Count());
+
+    // Greedy scan over the (cache-optimized) index buffer: pack consecutive triangles until the vertex or triangle limit is hit
+    Dictionary<uint32, byte> vertexRemap;
+    vertexRemap.EnsureCapacity(maxVertices * 4);
+    int32 triangle = 0;
+    while (triangle < triangleCount)
+    {
+        Meshlet meshlet;
+        meshlet.VertexOffset = (uint32)meshletVertices.Count();
+        meshlet.TriangleOffset = (uint32)meshletTriangles.Count();
+        vertexRemap.Clear();
+        int32 triangles = 0;
+        Float3 normalSum = Float3::Zero;
+        while (triangle < triangleCount && triangles < maxTriangles)
+        {
+            const uint32 i0 = Indices[triangle * 3 + 0];
+            const uint32 i1 = Indices[triangle * 3 + 1];
+            const uint32 i2 = Indices[triangle * 3 + 2];
+
+            // Count how many new unique vertices this triangle adds
+            const int32 newVertices = (vertexRemap.ContainsKey(i0) ? 0 : 1) + (vertexRemap.ContainsKey(i1) ? 0 : 1) + (vertexRemap.ContainsKey(i2) ? 0 : 1);
+            if (vertexRemap.Count() + newVertices > maxVertices)
+                break;
+
+            byte local[3];
+            const uint32 indices[3] = { i0, i1, i2 };
+            for (int32 c = 0; c < 3; c++)
+            {
+                byte remapped;
+                if (!vertexRemap.TryGet(indices[c], remapped))
+                {
+                    remapped = (byte)vertexRemap.Count();
+                    vertexRemap.Add(indices[c], remapped);
+                    meshletVertices.Add(indices[c]);
+                }
+                local[c] = remapped;
+            }
+            meshletTriangles.Add(local[0]);
+            meshletTriangles.Add(local[1]);
+            meshletTriangles.Add(local[2]);
+            normalSum += Float3::Cross(Positions[i1] - Positions[i0], Positions[i2] - Positions[i0]);
+            triangles++;
+            triangle++;
+        }
+        meshlet.VertexCount = (uint16)vertexRemap.Count();
+        meshlet.TriangleCount = (uint16)triangles;
+
+        // Bounding sphere over the meshlet vertices
+        Float3 center = Float3::Zero;
+        for (uint32 v = 0; v < meshlet.VertexCount; v++)
+            center += Positions[meshletVertices[meshlet.VertexOffset + v]];
+        center /= (float)meshlet.VertexCount;
+        float radiusSqr = 0.0f;
+        for (uint32 v = 0; v < meshlet.VertexCount; v++)
+            radiusSqr = Math::Max(radiusSqr, Float3::DistanceSquared(center, Positions[meshletVertices[meshlet.VertexOffset + v]]));
+        meshlet.BoundsCenter = center;
+        meshlet.BoundsRadius = Math::Sqrt(radiusSqr);
+
+        // Normal cone from the triangle normals spread around the average direction
+        const Float3 coneAxis = Float3::Normalize(normalSum);
+        float minDot = 1.0f;
+        for (int32 t = 0; t < triangles; t++)
+        {
+            const uint32 t0 = meshletVertices[meshlet.VertexOffset + meshletTriangles[meshlet.TriangleOffset + t * 3 + 0]];
+            const uint32 t1 = meshletVertices[meshlet.VertexOffset + meshletTriangles[meshlet.TriangleOffset + t * 3 + 1]];
+            const uint32 t2 = meshletVertices[meshlet.VertexOffset + meshletTriangles[meshlet.TriangleOffset + t * 3 + 2]];
+            const Float3 normal = Float3::Normalize(Float3::Cross(Positions[t1] - Positions[t0], Positions[t2] - Positions[t0]));
+            minDot = Math::Min(minDot, Float3::Dot(coneAxis, normal));
+        }
+        meshlet.ConeAxis = coneAxis;
+        // Cutoff for backface culling test dot(viewDir, axis) >= cutoff; degenerate cones (spread >= 90 degrees) never cull
+        meshlet.ConeCutoff = minDot <= 0.0f ? 1.0f : Math::Sqrt(1.0f - minDot * minDot);
+
+        meshlets.Add(meshlet);
+    }
+    return false;
+}
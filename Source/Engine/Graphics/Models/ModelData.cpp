@@ -4,6 +4,7 @@
 #include "Engine/Core/Log.h"
 #include "Engine/Animations/CurveSerialization.h"
 #include "Engine/Serialization/WriteStream.h"
+#include "Engine/Threading/JobSystem.h"
 #include "Engine/Debug/Exceptions/ArgumentNullException.h"
 #include "Engine/Debug/Exceptions/ArgumentOutOfRangeException.h"
 #include "Engine/Debug/Exceptions/InvalidOperationException.h"
@@ -320,55 +321,49 @@ bool MeshData::Pack2Model(WriteStream* stream) const
     // Vertex Buffer 0
     stream->WriteBytes(Positions.Get(), sizeof(Float3) * verticiecCount);
 
-    // Vertex Buffer 1
-    VB1ElementType vb1;
-    for (uint32 i = 0; i < verticiecCount; i++)
-    {
-        // Get vertex components
-        Float2 uv = hasUVs ? UVs[i] : Float2::Zero;
-        Float3 normal = hasNormals ? Normals[i] : Float3::UnitZ;
-        Float3 tangent = hasTangents ? Tangents[i] : Float3::UnitX;
-        Float2 lightmapUV = hasLightmapUVs ? LightmapUVs[i] : Float2::Zero;
-        Float3 bitangentSign = hasBitangentSigns ? BitangentSigns[i] : Float3::Dot(Float3::Cross(Float3::Normalize(Float3::Cross(normal, tangent)), normal), tangent);
-
-        // Write vertex
-        vb1.TexCoord = Half2(uv);
-        vb1.Normal = Float1010102(normal * 0.5f + 0.5f, 0);
-        vb1.Tangent = Float1010102(tangent * 0.5f + 0.5f, static_cast<byte>(bitangentSign < 0 ? 1 : 0));
-        vb1.LightmapUVs = Half2(lightmapUV);
-        stream->WriteBytes(&vb1, sizeof(vb1));
-
-        // Pack TBN matrix into a quaternion
-        /*Quaternion quaternionTBN;
-        bool invertedHandednessTBN;
-        CalculateQuaternionFromTBN(tangent, bitangent, normal, &quaternionTBN, &invertedHandednessTBN);
-        quaternionTBN.Normalize();
-        uint32 packedQuaternionTBN = QuantizeNormalizedQuaternionWithHandedness(quaternionTBN, invertedHandednessTBN);
-
-        Float4 unpackedQuaternionTBN = Float4(quaternionTBN.X, quaternionTBN.Y, quaternionTBN.Z, ((invertedHandednessTBN ? 0.0f : 128.0f) + (127.0f * (quaternionTBN.W * 0.5f + 0.5f))) / 255.0f);
-        
-        //lods.WriteUint32(packedQuaternionTBN);
-        //lods.WriteFloat4(unpackedQuaternionTBN);
-        */
-    }
+    // Vertex Buffer 1 (quantize straight into the cooked layout in parallel, then write in a single call instead of streaming per-vertex)
+    Array<VB1ElementType> vb1Data;
+    vb1Data.Resize((int32)verticiecCount);
+    JobSystem::ParallelFor(0, (int32)verticiecCount, 16 * 1024, [&](int32 begin, int32 end)
+    {
+        for (int32 i = begin; i < end; i++)
+        {
+            // Get vertex components
+            Float2 uv = hasUVs ? UVs[i] : Float2::Zero;
+            Float3 normal = hasNormals ? Normals[i] : Float3::UnitZ;
+            Float3 tangent = hasTangents ? Tangents[i] : Float3::UnitX;
+            Float2 lightmapUV = hasLightmapUVs ? LightmapUVs[i] : Float2::Zero;
+            Float3 bitangentSign = hasBitangentSigns ? BitangentSigns[i] : Float3::Dot(Float3::Cross(Float3::Normalize(Float3::Cross(normal, tangent)), normal), tangent);
+
+            // Pack vertex
+            auto& vb1 = vb1Data[i];
+            vb1.TexCoord = Half2(uv);
+            vb1.Normal = Float1010102(normal * 0.5f + 0.5f, 0);
+            vb1.Tangent = Float1010102(tangent * 0.5f + 0.5f, static_cast<byte>(bitangentSign < 0 ? 1 : 0));
+            vb1.LightmapUVs = Half2(lightmapUV);
+        }
+    });
+    stream->WriteBytes(vb1Data.Get(), sizeof(VB1ElementType) * verticiecCount);
 
     // Vertex Buffer 2
     stream->WriteBool(hasVertexColors);
     if (hasVertexColors)
     {
-        VB2ElementType vb2;
+        Array<VB2ElementType> vb2Data;
+        vb2Data.Resize((int32)verticiecCount);
         for (uint32 i = 0; i < verticiecCount; i++)
-        {
-            vb2.Color = Color32(Colors[i]);
-            stream->WriteBytes(&vb2, sizeof(vb2));
-        }
+            vb2Data[i].Color = Color32(Colors[i]);
+        stream->WriteBytes(vb2Data.Get(), sizeof(VB2ElementType) * verticiecCount);
     }
 
     // Index Buffer
     if (use16Bit)
     {
+        Array<uint16> ibData;
+        ibData.Resize((int32)indicesCount);
         for (uint32 i = 0; i < indicesCount; i++)
-            stream->WriteUint16(Indices[i]);
+            ibData[i] = (uint16)Indices[i];
+        stream->WriteBytes(ibData.Get(), sizeof(uint16) * indicesCount);
     }
     else
     {
@@ -451,33 +446,41 @@ bool MeshData::Pack2SkinnedModel(WriteStream* stream) const
         stream->WriteBytes(blendShape.Vertices.Get(), blendShape.Vertices.Count() * sizeof(BlendShapeVertex));
     }
 
-    // Vertex Buffer
-    VB0SkinnedElementType vb;
-    for (uint32 i = 0; i < verticiecCount; i++)
+    // Vertex Buffer (quantize straight into the cooked layout in parallel, then write in a single call instead of streaming per-vertex)
+    Array<VB0SkinnedElementType> vbData;
+    vbData.Resize((int32)verticiecCount);
+    JobSystem::ParallelFor(0, (int32)verticiecCount, 16 * 1024, [&](int32 begin, int32 end)
     {
-        // Get vertex components
-        Float2 uv = hasUVs ? UVs[i] : Float2::Zero;
-        Float3 normal = hasNormals ? Normals[i] : Float3::UnitZ;
-        Float3 tangent = hasTangents ? Tangents[i] : Float3::UnitX;
-        Float3 bitangentSign = hasBitangentSigns ? BitangentSigns[i] : Float3::Dot(Float3::Cross(Float3::Normalize(Float3::Cross(normal, tangent)), normal), tangent);
-        Int4 blendIndices = BlendIndices[i];
-        Float4 blendWeights = BlendWeights[i];
-
-        // Write vertex
-        vb.Position = Positions[i];
-        vb.TexCoord = Half2(uv);
-        vb.Normal = Float1010102(normal * 0.5f + 0.5f, 0);
-        vb.Tangent = Float1010102(tangent * 0.5f + 0.5f, static_cast<byte>(bitangentSign < 0 ? 1 : 0));
-        vb.BlendIndices = Color32(blendIndices.X, blendIndices.Y, blendIndices.Z, blendIndices.W);
-        vb.BlendWeights = Half4(blendWeights);
-        stream->WriteBytes(&vb, sizeof(vb));
-    }
+        for (int32 i = begin; i < end; i++)
+        {
+            // Get vertex components
+            Float2 uv = hasUVs ? UVs[i] : Float2::Zero;
+            Float3 normal = hasNormals ? Normals[i] : Float3::UnitZ;
+            Float3 tangent = hasTangents ? Tangents[i] : Float3::UnitX;
+            Float3 bitangentSign = hasBitangentSigns ? BitangentSigns[i] : Float3::Dot(Float3::Cross(Float3::Normalize(Float3::Cross(normal, tangent)), normal), tangent);
+            Int4 blendIndices = BlendIndices[i];
+            Float4 blendWeights = BlendWeights[i];
+
+            // Pack vertex
+            auto& vb = vbData[i];
+            vb.Position = Positions[i];
+            vb.TexCoord = Half2(uv);
+            vb.Normal = Float1010102(normal * 0.5f + 0.5f, 0);
+            vb.Tangent = Float1010102(tangent * 0.5f + 0.5f, static_cast<byte>(bitangentSign < 0 ? 1 : 0));
+            vb.BlendIndices = Color32(blendIndices.X, blendIndices.Y, blendIndices.Z, blendIndices.W);
+            vb.BlendWeights = Half4(blendWeights);
+        }
+    });
+    stream->WriteBytes(vbData.Get(), sizeof(VB0SkinnedElementType) * verticiecCount);
 
     // Index Buffer
     if (use16Bit)
     {
+        Array<uint16> ibData;
+        ibData.Resize((int32)indicesCount);
         for (uint32 i = 0; i < indicesCount; i++)
-            stream->WriteUint16(Indices[i]);
+            ibData[i] = (uint16)Indices[i];
+        stream->WriteBytes(ibData.Get(), sizeof(uint16) * indicesCount);
     }
     else
     {
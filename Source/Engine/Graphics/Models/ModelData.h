@@ -12,6 +12,29 @@
 #include "BlendShape.h"
 #include "Engine/Animations/AnimationData.h"
 
+/// <summary>
+/// Single meshlet (cluster) of a mesh: a small group of triangles sharing a bounded set of vertices, with bounds and a normal cone for per-cluster culling.
+/// </summary>
+struct FLAXENGINE_API Meshlet
+{
+    /// <summary>The offset of the first entry of this meshlet in the meshlet vertices array.</summary>
+    uint32 VertexOffset;
+    /// <summary>The offset of the first entry of this meshlet in the meshlet triangles array (3 indices per triangle).</summary>
+    uint32 TriangleOffset;
+    /// <summary>The amount of the unique vertices used by this meshlet.</summary>
+    uint16 VertexCount;
+    /// <summary>The amount of the triangles in this meshlet.</summary>
+    uint16 TriangleCount;
+    /// <summary>The center of the meshlet bounding sphere (mesh local-space).</summary>
+    Float3 BoundsCenter;
+    /// <summary>The radius of the meshlet bounding sphere.</summary>
+    float BoundsRadius;
+    /// <summary>The average normal direction of the meshlet triangles (normal cone axis).</summary>
+    Float3 ConeAxis;
+    /// <summary>The normal cone cutoff: the meshlet is backfacing when dot(viewDir, ConeAxis) >= ConeCutoff.</summary>
+    float ConeCutoff;
+};
+
 /// <summary>
 /// Data container for the common model meshes data. Supports holding all types of data related to the models pipeline.
 /// </summary>
@@ -248,6 +271,17 @@ public:
     /// </summary>
     void ImproveCacheLocality();
 
+    /// <summary>
+    /// Partitions the mesh triangles into meshlets (clusters) with a bounded amount of vertices and triangles each, computing per-cluster bounds and normal cones for culling. Intended to run at import/cook time.
+    /// </summary>
+    /// <param name="maxVertices">The maximum amount of the unique vertices per meshlet (up to 255).</param>
+    /// <param name="maxTriangles">The maximum amount of the triangles per meshlet.</param>
+    /// <param name="meshlets">The output meshlets descriptors.</param>
+    /// <param name="meshletVertices">The output meshlet vertices array (indices into the mesh vertex buffer).</param>
+    /// <param name="meshletTriangles">The output meshlet triangles array (local indices into the meshlet vertices, 3 per triangle).</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    bool BuildMeshlets(int32 maxVertices, int32 maxTriangles, Array<Meshlet>& meshlets, Array<uint32>& meshletVertices, Array<byte>& meshletTriangles) const;
+
     /// <summary>
     /// Sums the area of all triangles in the mesh.
     /// </summary>
@@ -10,6 +10,7 @@
 #include "Engine/Graphics/RenderTask.h"
 #include "Engine/Level/Scene/Scene.h"
 #include "Engine/Renderer/RenderList.h"
+#include "Engine/Renderer/SkinningCachePass.h"
 #include "Engine/Serialization/MemoryReadStream.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Threading/Task.h"
@@ -57,8 +58,17 @@ bool SkinnedMesh::Load(uint32 vertices, uint32 triangles, void* vb0, void* ib, b
 #else
 	vertexBuffer = GPUDevice::Instance->CreateBuffer(String::Empty);
 #endif
-    if (vertexBuffer->Init(GPUBufferDescription::Vertex(sizeof(VB0SkinnedElementType), vertices, vb0)))
-        goto ERROR_LOAD_END;
+    {
+        GPUBufferDescription desc = GPUBufferDescription::Vertex(sizeof(VB0SkinnedElementType), vertices, vb0);
+        if (GPUDevice::Instance->Limits.HasCompute)
+        {
+            // Allow the skin cache to read the source vertices in the pre-skinning compute shader
+            desc.Flags |= GPUBufferFlags::ShaderResource | GPUBufferFlags::RawBuffer;
+            desc.Format = PixelFormat::R32_Typeless;
+        }
+        if (vertexBuffer->Init(desc))
+            goto ERROR_LOAD_END;
+    }
 
     // Create index buffer
 #if GPU_ENABLE_RESOURCE_NAMING
@@ -174,20 +184,42 @@ void SkinnedMesh::Draw(const RenderContext& renderContext, const DrawInfo& info,
     // Setup draw call
     DrawCall drawCall;
     drawCall.Geometry.IndexBuffer = _indexBuffer;
+    SkinnedMeshDrawData* skinning = info.Skinning;
     BlendShapesInstance::MeshInstance* blendShapeMeshInstance;
     if (info.BlendShapes && info.BlendShapes->Meshes.TryGet(this, blendShapeMeshInstance) && blendShapeMeshInstance->IsUsed)
     {
         // Use modified vertex buffer from the blend shapes
-        if (blendShapeMeshInstance->IsDirty)
+        if (blendShapeMeshInstance->UseGPU)
         {
-            blendShapeMeshInstance->VertexBuffer.Flush();
-            blendShapeMeshInstance->IsDirty = false;
+            // Evaluated by the skin cache compute pass
+            GPUBuffer* blendedVB = SkinningCachePass::Instance()->GetBlendedVertexBuffer(this, blendShapeMeshInstance, _vertexBuffer, _vertices);
+            drawCall.Geometry.VertexBuffers[0] = blendedVB ? blendedVB : _vertexBuffer;
+        }
+        else
+        {
+            if (blendShapeMeshInstance->IsDirty)
+            {
+                blendShapeMeshInstance->VertexBuffer.Flush();
+                blendShapeMeshInstance->IsDirty = false;
+            }
+            drawCall.Geometry.VertexBuffers[0] = blendShapeMeshInstance->VertexBuffer.GetBuffer();
         }
-        drawCall.Geometry.VertexBuffers[0] = blendShapeMeshInstance->VertexBuffer.GetBuffer();
     }
     else
     {
         drawCall.Geometry.VertexBuffers[0] = _vertexBuffer;
+
+        // Use the skin cache to pre-skin the vertices with a compute shader once and share them across all of the passes this frame
+        // (per-bone motion blur samples the previous pose bones in the vertex shader so it keeps the regular skinning path)
+        if (skinning->PrevBoneMatrices == nullptr)
+        {
+            GPUBuffer* preSkinnedVB = SkinningCachePass::Instance()->GetSkinnedVertexBuffer(this, skinning, _vertexBuffer, _vertices);
+            if (preSkinnedVB)
+            {
+                drawCall.Geometry.VertexBuffers[0] = preSkinnedVB;
+                skinning = SkinningCachePass::Instance()->GetIdentitySkinning();
+            }
+        }
     }
     drawCall.Geometry.VertexBuffers[1] = nullptr;
     drawCall.Geometry.VertexBuffers[2] = nullptr;
@@ -204,7 +236,7 @@ void SkinnedMesh::Draw(const RenderContext& renderContext, const DrawInfo& info,
     drawCall.Surface.PrevWorld = info.DrawState->PrevWorld;
     drawCall.Surface.Lightmap = nullptr;
     drawCall.Surface.LightmapUVsArea = Rectangle::Empty;
-    drawCall.Surface.Skinning = info.Skinning;
+    drawCall.Surface.Skinning = skinning;
     drawCall.Surface.LODDitherFactor = lodDitherFactor;
     drawCall.WorldDeterminantSign = Math::FloatSelect(drawCall.World.RotDeterminant(), 1, -1);
     drawCall.PerInstanceRandom = info.PerInstanceRandom;
@@ -234,20 +266,42 @@ void SkinnedMesh::Draw(const RenderContextBatch& renderContextBatch, const DrawI
     // Setup draw call
     DrawCall drawCall;
     drawCall.Geometry.IndexBuffer = _indexBuffer;
+    SkinnedMeshDrawData* skinning = info.Skinning;
     BlendShapesInstance::MeshInstance* blendShapeMeshInstance;
     if (info.BlendShapes && info.BlendShapes->Meshes.TryGet(this, blendShapeMeshInstance) && blendShapeMeshInstance->IsUsed)
     {
         // Use modified vertex buffer from the blend shapes
-        if (blendShapeMeshInstance->IsDirty)
+        if (blendShapeMeshInstance->UseGPU)
+        {
+            // Evaluated by the skin cache compute pass
+            GPUBuffer* blendedVB = SkinningCachePass::Instance()->GetBlendedVertexBuffer(this, blendShapeMeshInstance, _vertexBuffer, _vertices);
+            drawCall.Geometry.VertexBuffers[0] = blendedVB ? blendedVB : _vertexBuffer;
+        }
+        else
         {
-            blendShapeMeshInstance->VertexBuffer.Flush();
-            blendShapeMeshInstance->IsDirty = false;
+            if (blendShapeMeshInstance->IsDirty)
+            {
+                blendShapeMeshInstance->VertexBuffer.Flush();
+                blendShapeMeshInstance->IsDirty = false;
+            }
+            drawCall.Geometry.VertexBuffers[0] = blendShapeMeshInstance->VertexBuffer.GetBuffer();
         }
-        drawCall.Geometry.VertexBuffers[0] = blendShapeMeshInstance->VertexBuffer.GetBuffer();
     }
     else
     {
         drawCall.Geometry.VertexBuffers[0] = _vertexBuffer;
+
+        // Use the skin cache to pre-skin the vertices with a compute shader once and share them across all of the passes this frame
+        // (per-bone motion blur samples the previous pose bones in the vertex shader so it keeps the regular skinning path)
+        if (skinning->PrevBoneMatrices == nullptr)
+        {
+            GPUBuffer* preSkinnedVB = SkinningCachePass::Instance()->GetSkinnedVertexBuffer(this, skinning, _vertexBuffer, _vertices);
+            if (preSkinnedVB)
+            {
+                drawCall.Geometry.VertexBuffers[0] = preSkinnedVB;
+                skinning = SkinningCachePass::Instance()->GetIdentitySkinning();
+            }
+        }
     }
     drawCall.Geometry.VertexBuffers[1] = nullptr;
     drawCall.Geometry.VertexBuffers[2] = nullptr;
@@ -264,7 +318,7 @@ void SkinnedMesh::Draw(const RenderContextBatch& renderContextBatch, const DrawI
     drawCall.Surface.PrevWorld = info.DrawState->PrevWorld;
     drawCall.Surface.Lightmap = nullptr;
     drawCall.Surface.LightmapUVsArea = Rectangle::Empty;
-    drawCall.Surface.Skinning = info.Skinning;
+    drawCall.Surface.Skinning = skinning;
     drawCall.Surface.LODDitherFactor = lodDitherFactor;
     drawCall.WorldDeterminantSign = Math::FloatSelect(drawCall.World.RotDeterminant(), 1, -1);
     drawCall.PerInstanceRandom = info.PerInstanceRandom;
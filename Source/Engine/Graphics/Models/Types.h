@@ -100,7 +100,11 @@ struct RawModelVertex
     Color Color;
 };
 
-// For vertex data we use three buffers: one with positions, one with other attributes, and one with colors
+// For vertex data we use three buffers: one with positions, one with other attributes, and one with colors.
+// Attributes are already quantized at cook-time (half UVs and lightmap UVs, 10-bit normals/tangents with sign bit);
+// positions stay full-precision floats because the layouts below are versioned and baked into the shaders input
+// layouts - 16-bit normalized positions with a per-mesh dequantization transform would need a new model file
+// version plus dequant support across all of the vertex-consuming passes (materials, depth, SDF, skin cache).
 PACK_STRUCT(struct VB0ElementType15
     {
     Float3 Position;
@@ -89,6 +89,11 @@ public:
     GPUTexture* TemporalAA = nullptr;
     uint64 LastFrameTemporalAA = 0;
 
+    // Helper target with the hierarchical depth pyramid (max-downsampled from the previous frame's depth). Used by the GPU occlusion culling.
+    // Should be released if not used for a few frames.
+    GPUTexture* HiZDepth = nullptr;
+    uint64 LastFrameHiZDepth = 0;
+
     // Maps the custom buffer type into the object that holds the state.
     Array<CustomBuffer*, HeapAllocation> CustomBuffers;
 
@@ -4,6 +4,7 @@
 #include "GPUDevice.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Engine/Engine.h"
+#include "Engine/Threading/Threading.h"
 
 struct Entry
 {
@@ -17,11 +18,16 @@ struct Entry
 namespace
 {
     Array<Entry> TemporaryRTs(64);
+
+    // Staging readback textures are acquired/released by async download tasks running on worker threads so guard the pool access
+    CriticalSection TemporaryStagingLocker;
+    Array<Entry> TemporaryStaging;
 }
 
 void RenderTargetPool::Flush(bool force)
 {
-    const uint64 framesOffset = 3 * 60;
+    // Flush unused targets quickly so their transient heap memory returns to the pool for aliasing by other targets
+    const uint64 framesOffset = 60;
     const uint64 maxReleaseFrame = Engine::FrameCount - framesOffset;
     force |= Engine::ShouldExit();
 
@@ -40,12 +46,31 @@ void RenderTargetPool::Flush(bool force)
                 break;
         }
     }
+
+    TemporaryStagingLocker.Lock();
+    for (int32 i = 0; i < TemporaryStaging.Count(); i++)
+    {
+        auto& tmp = TemporaryStaging[i];
+
+        if (!tmp.IsOccupied && (force || (tmp.LastFrameReleased < maxReleaseFrame)))
+        {
+            // Release
+            tmp.RT->DeleteObjectNow();
+            TemporaryStaging.RemoveAt(i);
+            i--;
+        }
+    }
+    TemporaryStagingLocker.Unlock();
 }
 
 GPUTexture* RenderTargetPool::Get(const GPUTextureDescription& desc)
 {
+    // Mark temporary targets as transient so backends can alias targets with disjoint lifetimes onto the same heap memory
+    GPUTextureDescription tempDesc = desc;
+    tempDesc.Flags |= GPUTextureFlags::Aliasing;
+
     // Find free render target with the same properties
-    const uint32 descHash = GetHash(desc);
+    const uint32 descHash = GetHash(tempDesc);
     for (int32 i = 0; i < TemporaryRTs.Count(); i++)
     {
         auto& tmp = TemporaryRTs[i];
@@ -72,7 +97,7 @@ GPUTexture* RenderTargetPool::Get(const GPUTextureDescription& desc)
     // Create new rt
     const String name = TEXT("TemporaryRT_") + StringUtils::ToString(TemporaryRTs.Count());
     auto newRenderTarget = GPUDevice::Instance->CreateTexture(name);
-    if (newRenderTarget->Init(desc))
+    if (newRenderTarget->Init(tempDesc))
     {
         Delete(newRenderTarget);
         LOG(Error, "Cannot create temporary render target. Description: {0}", desc.ToString());
@@ -112,3 +137,74 @@ void RenderTargetPool::Release(GPUTexture* rt)
 
     LOG(Error, "Trying to release temporary render target which has not been registered in service!");
 }
+
+GPUTexture* RenderTargetPool::GetStaging(const GPUTextureDescription& desc)
+{
+    // Find free staging texture with the same properties
+    const uint32 descHash = GetHash(desc);
+    TemporaryStagingLocker.Lock();
+    for (int32 i = 0; i < TemporaryStaging.Count(); i++)
+    {
+        auto& tmp = TemporaryStaging[i];
+
+        if (!tmp.IsOccupied && tmp.DescriptionHash == descHash)
+        {
+            ASSERT(tmp.RT);
+
+            // Mark as used
+            tmp.IsOccupied = true;
+            tmp.LastFrameTaken = Engine::FrameCount;
+            TemporaryStagingLocker.Unlock();
+            return tmp.RT;
+        }
+    }
+    TemporaryStagingLocker.Unlock();
+
+    // Create new staging texture (outside the pool lock because Flush can run with the device locked)
+    auto newStaging = GPUDevice::Instance->CreateTexture(TEXT("TemporaryStaging"));
+    {
+        ScopeLock gpuLock(GPUDevice::Instance->Locker);
+        if (newStaging->Init(desc))
+        {
+            Delete(newStaging);
+            LOG(Error, "Cannot create temporary staging texture. Description: {0}", desc.ToString());
+            return nullptr;
+        }
+    }
+
+    // Create temporary staging texture entry
+    Entry entry;
+    entry.IsOccupied = true;
+    entry.LastFrameReleased = 0;
+    entry.LastFrameTaken = Engine::FrameCount;
+    entry.RT = newStaging;
+    entry.DescriptionHash = descHash;
+    TemporaryStagingLocker.Lock();
+    TemporaryStaging.Add(entry);
+    TemporaryStagingLocker.Unlock();
+
+    return newStaging;
+}
+
+void RenderTargetPool::ReleaseStaging(GPUTexture* texture)
+{
+    if (!texture)
+        return;
+
+    ScopeLock lock(TemporaryStagingLocker);
+    for (int32 i = 0; i < TemporaryStaging.Count(); i++)
+    {
+        auto& tmp = TemporaryStaging[i];
+
+        if (tmp.RT == texture)
+        {
+            // Mark as free
+            ASSERT(tmp.IsOccupied);
+            tmp.IsOccupied = false;
+            tmp.LastFrameReleased = Engine::FrameCount;
+            return;
+        }
+    }
+
+    LOG(Error, "Trying to release temporary staging texture which has not been registered in service!");
+}
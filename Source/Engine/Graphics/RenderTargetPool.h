@@ -29,6 +29,19 @@ public:
     /// </summary>
     /// <param name="rt">The reference to temporary target to release.</param>
     API_FUNCTION() static void Release(GPUTexture* rt);
+
+    /// <summary>
+    /// Gets a temporary staging readback texture (used by asynchronous GPU data downloads). Can be called from any thread.
+    /// </summary>
+    /// <param name="desc">The staging texture description.</param>
+    /// <returns>The allocated staging texture or reused one.</returns>
+    static GPUTexture* GetStaging(const GPUTextureDescription& desc);
+
+    /// <summary>
+    /// Releases a temporary staging readback texture back to the pool. Can be called from any thread.
+    /// </summary>
+    /// <param name="texture">The reference to temporary staging texture to release.</param>
+    static void ReleaseStaging(GPUTexture* texture);
 };
 
 // Utility to set name to the pooled render target (compiled-put in Release builds)
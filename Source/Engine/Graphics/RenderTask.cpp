@@ -23,6 +23,7 @@
 #endif
 
 Array<RenderTask*> RenderTask::Tasks;
+Array<RenderTask*> RenderTask::DrawTasks;
 CriticalSection RenderTask::TasksLocker;
 int32 RenderTask::TasksDoneLastFrame;
 Array<PostProcessEffect*> SceneRenderTask::GlobalCustomPostFx;
@@ -36,13 +37,17 @@ PostProcessEffect::PostProcessEffect(const SpawnParams& params)
 
 void RenderTask::DrawAll()
 {
-    ScopeLock lock(TasksLocker);
+    // Publish the tasks list snapshot for this frame (the lock is held for a short copy only so tasks registration never blocks on the in-flight frame)
+    TasksLocker.Lock();
+    DrawTasks.Clear();
+    DrawTasks.Add(Tasks);
+    TasksLocker.Unlock();
 
     // Sort tasks (by Order property)
-    Sorting::QuickSortObj(Tasks.Get(), Tasks.Count());
+    Sorting::QuickSortObj(DrawTasks.Get(), DrawTasks.Count());
 
     // Render all that shit
-    for (auto task : Tasks)
+    for (auto task : DrawTasks)
     {
         if (task->CanDraw())
         {
@@ -34,6 +34,11 @@ API_CLASS() class FLAXENGINE_API RenderTask : public ScriptingObject
     /// </summary>
     static Array<RenderTask*> Tasks;
 
+    /// <summary>
+    /// The tasks list snapshot published at the start of the frame drawing (sorted by Order). Rendering iterates it without taking TasksLocker so registering or removing tasks never contends with the in-flight frame. Stable until the next frame snapshot (removed tasks stay valid as scripting objects deletion is deferred).
+    /// </summary>
+    static Array<RenderTask*> DrawTasks;
+
     /// <summary>
     /// Static locker for render tasks list
     /// </summary>
@@ -0,0 +1,221 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "ShaderArchive.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Engine/EngineService.h"
+#include "Engine/Engine/Globals.h"
+#include "Engine/Platform/File.h"
+#include "Engine/Platform/FileSystem.h"
+#include "Engine/Serialization/MemoryWriteStream.h"
+#include "Engine/Threading/Threading.h"
+#include "Engine/Graphics/Shaders/GPUShader.h"
+#if COMPILE_WITH_SHADER_CACHE_MANAGER
+#include "ShaderCacheManager.h"
+#endif
+
+const int32 ShaderArchive::MagicCode = 1397835081;
+
+namespace
+{
+    CriticalSection ArchiveLocker;
+    bool ArchiveTried = false;
+    File* ArchiveFile = nullptr;
+    void* ArchiveView = nullptr;
+    uint32 ArchiveSize = 0;
+    Array<byte> ArchiveData; // Fallback storage when the file mapping is not supported on this platform
+}
+
+class ShaderArchiveService : public EngineService
+{
+public:
+    ShaderArchiveService()
+        : EngineService(TEXT("Shader Archive"), -200)
+    {
+    }
+
+    void Dispose() override
+    {
+        ShaderArchive::Unload();
+    }
+};
+
+ShaderArchiveService ShaderArchiveServiceInstance;
+
+String ShaderArchive::GetDefaultPath(ShaderProfile profile)
+{
+    return Globals::ProjectContentFolder / String::Format(TEXT("Shaders_{0}.bin"), ::ToString(profile));
+}
+
+static bool IsValidArchive(const void* view, uint32 size, ShaderProfile profile)
+{
+    if (view == nullptr || size < sizeof(ShaderArchive::Header))
+        return false;
+    const auto header = (const ShaderArchive::Header*)view;
+    return header->Magic == ShaderArchive::MagicCode
+            && header->ArchiveVersion == ShaderArchive::Header::Version
+            && header->CacheVersion == GPU_SHADER_CACHE_VERSION
+            && header->Profile == (int32)profile
+            && header->BucketCount > 0
+            && Math::IsPowerOfTwo(header->BucketCount)
+            && sizeof(ShaderArchive::Header) + header->BucketCount * sizeof(ShaderArchive::Bucket) <= size;
+}
+
+bool ShaderArchive::TryGetCache(ShaderProfile profile, const Guid& id, BytesContainer& outputShaderCache)
+{
+    ScopeLock lock(ArchiveLocker);
+
+    // Open and map the archive file on the first query
+    if (!ArchiveTried)
+    {
+        ArchiveTried = true;
+        const String path = GetDefaultPath(profile);
+        if (FileSystem::FileExists(path))
+        {
+            ArchiveFile = File::Open(path, FileMode::OpenExisting, FileAccess::Read, FileShare::Read);
+            if (ArchiveFile)
+            {
+                ArchiveSize = ArchiveFile->GetSize();
+                ArchiveView = ArchiveFile->Map();
+                if (!ArchiveView)
+                {
+                    // Mapping not supported on this platform so keep the whole archive in memory
+                    if (!File::ReadAllBytes(path, ArchiveData))
+                        ArchiveView = ArchiveData.Get();
+                }
+            }
+            if (!IsValidArchive(ArchiveView, ArchiveSize, profile))
+            {
+                LOG(Warning, "Invalid shaders archive file \'{0}\'.", path);
+                Unload();
+                ArchiveTried = true;
+            }
+            else
+            {
+                LOG(Info, "Loaded shaders archive \'{0}\' ({1} shaders)", path, ((const Header*)ArchiveView)->ShadersCount);
+            }
+        }
+    }
+    if (!ArchiveView)
+        return false;
+
+    // Probe the hash-indexed lookup table (open addressing so a miss ends on the first empty bucket)
+    const auto header = (const Header*)ArchiveView;
+    const auto buckets = (const Bucket*)((const byte*)ArchiveView + sizeof(Header));
+    const uint32 mask = (uint32)header->BucketCount - 1;
+    uint32 index = GetHash(id) & mask;
+    for (int32 probe = 0; probe < header->BucketCount; probe++)
+    {
+        const Bucket& bucket = buckets[index];
+        if (bucket.ID == id)
+        {
+            if (bucket.Offset + bucket.Size > ArchiveSize)
+                break;
+            outputShaderCache.Link((const byte*)ArchiveView + bucket.Offset, bucket.Size);
+            return true;
+        }
+        if (!bucket.ID.IsValid())
+            break;
+        index = (index + 1) & mask;
+    }
+    return false;
+}
+
+void ShaderArchive::Unload()
+{
+    ScopeLock lock(ArchiveLocker);
+    if (ArchiveFile)
+    {
+        if (ArchiveView && ArchiveData.IsEmpty())
+            ArchiveFile->Unmap(ArchiveView);
+        Delete(ArchiveFile);
+        ArchiveFile = nullptr;
+    }
+    ArchiveView = nullptr;
+    ArchiveSize = 0;
+    ArchiveData.Resize(0);
+    ArchiveTried = false;
+}
+
+bool ShaderArchive::Build(const StringView& outputPath, ShaderProfile profile, const Array<Guid>& ids, const Array<BytesContainer>& caches)
+{
+    ASSERT(ids.Count() == caches.Count());
+
+    // Size the hash table for a load factor below 3/4 (power of two so lookups use masking)
+    int32 bucketCount = 16;
+    while (bucketCount * 3 < ids.Count() * 4)
+        bucketCount <<= 1;
+
+    // Place the blobs after the lookup table
+    Header header;
+    header.Magic = MagicCode;
+    header.ArchiveVersion = Header::Version;
+    header.CacheVersion = GPU_SHADER_CACHE_VERSION;
+    header.Profile = (int32)profile;
+    header.BucketCount = bucketCount;
+    header.ShadersCount = ids.Count();
+    Array<Bucket> buckets;
+    buckets.Resize(bucketCount);
+    Platform::MemoryClear(buckets.Get(), bucketCount * sizeof(Bucket));
+    const uint32 mask = (uint32)bucketCount - 1;
+    uint32 offset = sizeof(Header) + bucketCount * sizeof(Bucket);
+    for (int32 i = 0; i < ids.Count(); i++)
+    {
+        const Guid& id = ids[i];
+        if (!id.IsValid())
+        {
+            LOG(Warning, "Cannot pack shader with invalid ID into the archive.");
+            return true;
+        }
+        uint32 index = GetHash(id) & mask;
+        while (buckets[index].ID.IsValid())
+        {
+            if (buckets[index].ID == id)
+            {
+                LOG(Warning, "Cannot pack duplicated shader {0} into the archive.", id);
+                return true;
+            }
+            index = (index + 1) & mask;
+        }
+        buckets[index].ID = id;
+        buckets[index].Offset = offset;
+        buckets[index].Size = caches[i].Length();
+        offset += caches[i].Length();
+    }
+
+    // Write the whole archive with a single file write
+    MemoryWriteStream stream((int32)offset);
+    stream.WriteBytes(&header, sizeof(header));
+    stream.WriteBytes(buckets.Get(), bucketCount * sizeof(Bucket));
+    for (int32 i = 0; i < ids.Count(); i++)
+        stream.WriteBytes(caches[i].Get(), caches[i].Length());
+    if (stream.SaveToFile(outputPath))
+    {
+        LOG(Warning, "Cannot save shaders archive to \'{0}\'.", outputPath);
+        return true;
+    }
+    LOG(Info, "Saved shaders archive \'{0}\' ({1} shaders, {2} bytes)", String(outputPath), ids.Count(), offset);
+    return false;
+}
+
+#if COMPILE_WITH_SHADER_CACHE_MANAGER
+
+bool ShaderArchive::Build(const StringView& outputPath, ShaderProfile profile, const Array<Guid>& shaders)
+{
+    // Gather the blobs from the per-file shaders cache
+    Array<BytesContainer> caches;
+    caches.Resize(shaders.Count());
+    for (int32 i = 0; i < shaders.Count(); i++)
+    {
+        ShaderCacheManager::CachedEntryHandle cachedEntry;
+        if (!ShaderCacheManager::TryGetEntry(profile, shaders[i], cachedEntry)
+            || ShaderCacheManager::GetCache(profile, cachedEntry, caches[i]))
+        {
+            LOG(Warning, "Missing cached shader {0} (profile: {1}) for the archive.", shaders[i], ::ToString(profile));
+            return true;
+        }
+    }
+    return Build(outputPath, profile, shaders, caches);
+}
+
+#endif
@@ -0,0 +1,90 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "../Config.h"
+#include "Engine/Core/Types/Guid.h"
+#include "Engine/Core/Types/String.h"
+#include "Engine/Core/Types/DataContainer.h"
+#include "Engine/Core/Collections/Array.h"
+
+/// <summary>
+/// Packed archive with precompiled shader blobs. Single binary file that gets memory-mapped at runtime with a hash-indexed lookup table, so loading a shader permutation is a pointer lookup into the mapped view (no file seeking, no decompression, no compiler invocation in shipped builds).
+/// </summary>
+class FLAXENGINE_API ShaderArchive
+{
+public:
+    /// <summary>
+    /// Magic code stored in the archive header to identify contents.
+    /// </summary>
+    static const int32 MagicCode;
+
+    /// <summary>
+    /// Archive file header.
+    /// </summary>
+    struct Header
+    {
+        static const int32 Version = 1;
+
+        int32 Magic;
+        int32 ArchiveVersion;
+        int32 CacheVersion;
+        int32 Profile;
+        int32 BucketCount;
+        int32 ShadersCount;
+    };
+
+    /// <summary>
+    /// Lookup table bucket (open-addressed hash table with linear probing, empty ID marks a free slot).
+    /// </summary>
+    struct Bucket
+    {
+        Guid ID;
+        uint32 Offset;
+        uint32 Size;
+    };
+
+public:
+    /// <summary>
+    /// Gets the default archive file location for the given shader profile.
+    /// </summary>
+    /// <param name="profile">The shader profile.</param>
+    /// <returns>The archive file path.</returns>
+    static String GetDefaultPath(ShaderProfile profile);
+
+    /// <summary>
+    /// Tries to get the precompiled shader cache from the archive. Opens and maps the archive file on the first query. The output data links directly into the mapped view (valid until engine exit, don't free it).
+    /// </summary>
+    /// <param name="profile">The shader profile.</param>
+    /// <param name="id">The shader asset identifier.</param>
+    /// <param name="outputShaderCache">The output cache data (linked, not copied).</param>
+    /// <returns>True if the archive contains the shader, otherwise false.</returns>
+    static bool TryGetCache(ShaderProfile profile, const Guid& id, BytesContainer& outputShaderCache);
+
+    /// <summary>
+    /// Unloads the mapped archive (if loaded).
+    /// </summary>
+    static void Unload();
+
+public:
+    /// <summary>
+    /// Builds the packed archive file from the given set of compiled shader blobs.
+    /// </summary>
+    /// <param name="outputPath">The output archive file path.</param>
+    /// <param name="profile">The shader profile of the blobs.</param>
+    /// <param name="ids">The shader asset identifiers.</param>
+    /// <param name="caches">The compiled shader cache blobs (one per identifier).</param>
+    /// <returns>True if cannot build the archive, otherwise false.</returns>
+    static bool Build(const StringView& outputPath, ShaderProfile profile, const Array<Guid>& ids, const Array<BytesContainer>& caches);
+
+#if COMPILE_WITH_SHADER_CACHE_MANAGER
+    /// <summary>
+    /// Builds the packed archive file from the existing per-file shaders cache (see ShaderCacheManager).
+    /// </summary>
+    /// <param name="outputPath">The output archive file path.</param>
+    /// <param name="profile">The shader profile of the blobs.</param>
+    /// <param name="shaders">The shader asset identifiers to pack.</param>
+    /// <returns>True if cannot build the archive, otherwise false.</returns>
+    static bool Build(const StringView& outputPath, ShaderProfile profile, const Array<Guid>& shaders);
+#endif
+};
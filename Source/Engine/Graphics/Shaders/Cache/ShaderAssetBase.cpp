@@ -2,6 +2,7 @@
 
 #include "ShaderAssetBase.h"
 #include "ShaderStorage.h"
+#include "ShaderArchive.h"
 #include "ShaderCacheManager.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Engine/CommandLine.h"
@@ -345,6 +346,16 @@ bool ShaderAssetBase::LoadShaderCache(ShaderCacheResult& result)
 
 #endif
 
+    // Check the packed shaders archive (shipped builds load precompiled blobs from a memory-mapped file so it's a pointer lookup)
+    if (ShaderArchive::TryGetCache(shaderProfile, parent->GetID(), result.Data))
+    {
+#if COMPILE_WITH_SHADER_COMPILER
+        // Read includes from cache
+        IsValidShaderCache(result.Data, result.Includes);
+#endif
+        return false;
+    }
+
     // Check if has internal shader cache
     if (parent->HasChunkLoaded(cacheChunkIndex))
     {
@@ -13,6 +13,7 @@
 #include "Engine/Graphics/RenderTools.h"
 #include "Engine/Graphics/PixelFormatExtensions.h"
 #include "Engine/Graphics/GPULimits.h"
+#include "Engine/Graphics/RenderTargetPool.h"
 #include "Engine/Threading/ThreadPoolTask.h"
 #include "Engine/Graphics/GPUDevice.h"
 #include "Engine/Scripting/Enums.h"
@@ -178,6 +179,7 @@ String GPUTextureDescription::ToString() const
         CONVERT_FLAGS_FLAGS_2_STR(PerSliceViews);
         CONVERT_FLAGS_FLAGS_2_STR(ReadOnlyDepthView);
         CONVERT_FLAGS_FLAGS_2_STR(BackBuffer);
+        CONVERT_FLAGS_FLAGS_2_STR(Aliasing);
 #undef CONVERT_FLAGS_FLAGS_2_STR
     }
 
@@ -631,7 +633,7 @@ private:
     GPUTextureReference _texture;
     GPUTexture* _staging;
     TextureData* _data;
-    bool _deleteStaging;
+    bool _releaseStaging;
 
 public:
     TextureDownloadDataTask(GPUTexture* texture, GPUTexture* staging, TextureData& data)
@@ -639,13 +641,14 @@ public:
         , _staging(staging)
         , _data(&data)
     {
-        _deleteStaging = texture != staging;
+        _releaseStaging = texture != staging;
     }
 
     ~TextureDownloadDataTask()
     {
-        if (_deleteStaging && _staging)
-            _staging->DeleteObjectNow();
+        // Return the pooled staging texture so the next readback can reuse it (instead of paying the resource allocation per-download)
+        if (_releaseStaging && _staging)
+            RenderTargetPool::ReleaseStaging(_staging);
     }
 
 public:
@@ -780,8 +783,8 @@ Task* GPUTexture::DownloadDataAsync(TextureData& result)
         return getDataTask;
     }
 
-    // Create the staging resource
-    const auto staging = ToStagingReadback();
+    // Get the staging resource (pooled so periodic readbacks reuse the same resource)
+    const auto staging = RenderTargetPool::GetStaging(_desc.ToStagingReadback());
     if (staging == nullptr)
     {
         LOG(Error, "Cannot create staging resource from {0}.", ToString());
@@ -55,6 +55,11 @@ API_ENUM(Attributes="Flags") enum class GPUTextureFlags
     /// Create a texture that can be used as a native window swap chain backbuffer surface.
     /// </summary>
     BackBuffer = 0x0080,
+
+    /// <summary>
+    /// Create a transient texture that can alias physical memory with other transient textures that have disjoint lifetimes (used by the temporary render targets pooling). Texture contents are valid only between the acquire and release from the pool.
+    /// </summary>
+    Aliasing = 0x0100,
 };
 
 DECLARE_ENUM_OPERATORS(GPUTextureFlags);
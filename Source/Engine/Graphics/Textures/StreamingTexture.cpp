@@ -268,6 +268,10 @@ Task* StreamingTexture::UpdateAllocation(int32 residency)
         // Release texture memory
         _texture->ReleaseGPU();
     }
+    else if (residency < allocatedResidency)
+    {
+        // Keep the current allocation and let the residency drop in-place (no reallocation and no copy; memory gets trimmed once the residency is stable - see TrimAllocation)
+    }
     else
     {
         // Use new texture object for resizing task
@@ -411,6 +415,51 @@ protected:
     }
 };
 
+class StreamTextureResidencyDropTask : public GPUTask
+{
+private:
+    StreamingTexture* _streamingTexture;
+    int32 _residency;
+
+public:
+    StreamTextureResidencyDropTask(StreamingTexture* texture, int32 residency)
+        : GPUTask(Type::CopyResource)
+        , _streamingTexture(texture)
+        , _residency(residency)
+    {
+        _streamingTexture->_streamingTasks.Add(this);
+    }
+
+protected:
+    // [GPUTask]
+    Result run(GPUTasksContext* context) override
+    {
+        return _streamingTexture ? Result::Ok : Result::MissingResources;
+    }
+
+    void OnEnd() override
+    {
+        if (_streamingTexture)
+        {
+            ScopeLock lock(_streamingTexture->GetOwner()->GetOwnerLocker());
+            _streamingTexture->_streamingTasks.Remove(this);
+        }
+
+        // Base
+        GPUTask::OnEnd();
+    }
+
+    void OnSync() override
+    {
+        // Drop the resident mips count in-place (texture views get clamped to the remaining resident mips)
+        _streamingTexture->GetTexture()->SetResidentMipLevels(_residency);
+        _streamingTexture->ResidencyChanged();
+
+        // Base
+        GPUTask::OnSync();
+    }
+};
+
 Task* StreamingTexture::CreateStreamingTask(int32 residency)
 {
     ScopeLock lock(_owner->GetOwnerLocker());
@@ -461,8 +510,8 @@ Task* StreamingTexture::CreateStreamingTask(int32 residency)
         }
         else
         {
-            // TODO: create task for reducing texture quality, or update SRV now
-            MISSING_CODE("add support for streaming quality down");
+            // Reduce the resident mips count without touching the allocation (synced with GPU to not race with rendering)
+            result = New<StreamTextureResidencyDropTask>(this, residency);
         }
     }
 
@@ -476,3 +525,40 @@ void StreamingTexture::CancelStreamingTasks()
     for (auto task : tasks)
         task->Cancel();
 }
+
+void StreamingTexture::TrimAllocation()
+{
+    ScopeLock lock(_owner->GetOwnerLocker());
+
+    const int32 residency = GetCurrentResidency();
+    if (!IsInitialized() || residency == 0 || GetAllocatedResidency() <= residency || _streamingTasks.HasItems())
+        return;
+
+    // Allocate a smaller texture and copy the resident mips into it
+#if GPU_ENABLE_RESOURCE_NAMING
+    GPUTexture* texture = GPUDevice::Instance->CreateTexture(_texture->GetName());
+#else
+    GPUTexture* texture = GPUDevice::Instance->CreateTexture();
+#endif
+    const int32 mip = TotalMipLevels() - residency;
+    const int32 width = Math::Max(TotalWidth() >> mip, 1);
+    const int32 height = Math::Max(TotalHeight() >> mip, 1);
+    GPUTextureDescription desc;
+    if (IsCubeMap())
+    {
+        ASSERT(width == height);
+        desc = GPUTextureDescription::NewCube(width, residency, _header.Format, GPUTextureFlags::ShaderResource);
+    }
+    else
+    {
+        desc = GPUTextureDescription::New2D(width, height, residency, _header.Format, GPUTextureFlags::ShaderResource);
+    }
+    if (texture->Init(desc))
+    {
+        LOG(Error, "Cannot allocate texture {0}.", ToString());
+        SAFE_DELETE_GPU_RESOURCE(texture);
+        return;
+    }
+    const auto task = New<StreamTextureResizeTask>(this, texture);
+    task->Start();
+}
@@ -15,6 +15,7 @@ class FLAXENGINE_API StreamingTexture : public Object, public StreamableResource
     friend class TexturesStreamingHandler;
     friend class StreamTextureMipTask;
     friend class StreamTextureResizeTask;
+    friend class StreamTextureResidencyDropTask;
 protected:
     ITextureOwner* _owner;
     GPUTexture* _texture;
@@ -28,6 +29,11 @@ public:
     ~StreamingTexture();
 
 public:
+    /// <summary>
+    /// The maximum amount of the mip levels that can be streamed-in for this texture. Used to limit the quality and the memory usage of the texture at runtime (eg. heightmaps of the distant terrain patches). Default is MAX_int32 (no limit).
+    /// </summary>
+    int32 MipLevelsMax = MAX_int32;
+
     /// <summary>
     /// Gets the owner.
     /// </summary>
@@ -174,4 +180,5 @@ public:
     Task* UpdateAllocation(int32 residency) override;
     Task* CreateStreamingTask(int32 residency) override;
     void CancelStreamingTasks() override;
+    void TrimAllocation() override;
 };
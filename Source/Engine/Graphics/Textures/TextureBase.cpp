@@ -223,6 +223,15 @@ void TextureBase::SetTextureGroup(int32 textureGroup)
     }
 }
 
+void TextureBase::SetMipLevelsMax(int32 value)
+{
+    if (_texture.MipLevelsMax != value)
+    {
+        _texture.MipLevelsMax = value;
+        _texture.RequestStreamingUpdate();
+    }
+}
+
 BytesContainer TextureBase::GetMipData(int32 mipIndex, int32& rowPitch, int32& slicePitch)
 {
     BytesContainer result;
@@ -115,6 +115,12 @@ public:
     /// </summary>
     API_PROPERTY() int32 GetResidentMipLevels() const;
 
+    /// <summary>
+    /// Sets the maximum amount of the mip levels that can be streamed-in for this texture. Lower values reduce the texture quality and the memory usage. Use MAX_int32 to disable the limit.
+    /// </summary>
+    /// <param name="value">The mip levels count limit.</param>
+    void SetMipLevelsMax(int32 value);
+
     /// <summary>
     /// Gets the amount of the memory used by this resource. Exact value may differ due to memory alignment and resource allocation policy.
     /// </summary>
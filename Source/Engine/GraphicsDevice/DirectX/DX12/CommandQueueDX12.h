@@ -158,6 +158,11 @@ public:
         return SyncPointDX12(&_fence, _fence.GetCurrentValue());
     }
 
+    FORCE_INLINE FenceDX12& GetFence()
+    {
+        return _fence;
+    }
+
 public:
 
     /// <summary>
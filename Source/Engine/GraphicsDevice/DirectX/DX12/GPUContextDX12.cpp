@@ -69,6 +69,7 @@ GPUContextDX12::GPUContextDX12(GPUDeviceDX12* device, D3D12_COMMAND_LIST_TYPE ty
     , _vbCount(0)
     , _rtCount(0)
     , _rbBufferSize(0)
+    , _splitBarriersCount(0)
     , _srMaskDirtyGraphics(0)
     , _srMaskDirtyCompute(0)
     , _isCompute(0)
@@ -96,6 +97,29 @@ GPUContextDX12::~GPUContextDX12()
 
 void GPUContextDX12::AddTransitionBarrier(ResourceOwnerDX12* resource, const D3D12_RESOURCE_STATES before, const D3D12_RESOURCE_STATES after, const int32 subresourceIndex)
 {
+#if DX12_ENABLE_RESOURCE_BARRIERS_BATCHING
+    // Try to merge with a pending transition of the same resource to eliminate redundant chained transitions before they hit the command list
+    for (int32 i = 0; i < _rbBufferSize; i++)
+    {
+        auto& pending = _rbBuffer[i];
+        if (pending.Type == D3D12_RESOURCE_BARRIER_TYPE_TRANSITION &&
+            pending.Flags == D3D12_RESOURCE_BARRIER_FLAG_NONE &&
+            pending.Transition.pResource == resource->GetResource() &&
+            pending.Transition.Subresource == (UINT)subresourceIndex)
+        {
+            pending.Transition.StateAfter = after;
+            if (pending.Transition.StateBefore == pending.Transition.StateAfter)
+            {
+                // Transition chain went back to the original state so the barrier is no longer needed
+                _rbBufferSize--;
+                for (int32 j = i; j < _rbBufferSize; j++)
+                    _rbBuffer[j] = _rbBuffer[j + 1];
+            }
+            return;
+        }
+    }
+#endif
+
     if (_rbBufferSize == DX12_RB_BUFFER_SIZE)
         flushRBs();
 
@@ -145,11 +169,114 @@ void GPUContextDX12::AddUAVBarrier()
 #endif
 }
 
+void GPUContextDX12::AddAliasingBarrier(ID3D12Resource* resource)
+{
+    if (_rbBufferSize == DX12_RB_BUFFER_SIZE)
+        flushRBs();
+
+#if DX12_ENABLE_RESOURCE_BARRIERS_DEBUGGING
+    const auto info = String::Format(TEXT("[DX12 Resource Barrier]: Aliasing"));
+    Log::Logger::Write(LogType::Info, info);
+#endif
+
+    D3D12_RESOURCE_BARRIER barrier;
+    barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_ALIASING;
+    barrier.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE;
+    barrier.Aliasing.pResourceBefore = nullptr;
+    barrier.Aliasing.pResourceAfter = resource;
+#if DX12_ENABLE_RESOURCE_BARRIERS_BATCHING
+    _rbBuffer[_rbBufferSize++] = barrier;
+#else
+    _commandList->ResourceBarrier(1, &barrier);
+#endif
+}
+
+void GPUContextDX12::PreTransitionResource(ResourceOwnerDX12* resource, D3D12_RESOURCE_STATES after)
+{
+#if DX12_ENABLE_RESOURCE_BARRIERS_BATCHING
+    if (!resource || resource->GetResource() == nullptr || !resource->State.AreAllSubresourcesSame() || _splitBarriersCount == DX12_RB_BUFFER_SIZE)
+        return;
+    const D3D12_RESOURCE_STATES before = resource->State.GetSubresourceState(-1);
+    if (!ResourceStateDX12::IsTransitionNeeded(before, after))
+        return;
+    for (int32 i = 0; i < _splitBarriersCount; i++)
+    {
+        if (_splitBarriers[i].Resource == resource)
+            return;
+    }
+
+#if DX12_ENABLE_RESOURCE_BARRIERS_DEBUGGING
+    const auto info = String::Format(TEXT("[DX12 Resource Barrier]: Split begin 0x{0:x} -> 0x{1:x}"), before, after);
+    Log::Logger::Write(LogType::Info, info);
+#endif
+
+    // Begin the split transition and submit it now so the driver can overlap it with other work until the resource gets used
+    if (_rbBufferSize == DX12_RB_BUFFER_SIZE)
+        flushRBs();
+    D3D12_RESOURCE_BARRIER barrier;
+    barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
+    barrier.Flags = D3D12_RESOURCE_BARRIER_FLAG_BEGIN_ONLY;
+    barrier.Transition.pResource = resource->GetResource();
+    barrier.Transition.StateBefore = before;
+    barrier.Transition.StateAfter = after;
+    barrier.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
+    _rbBuffer[_rbBufferSize++] = barrier;
+    flushRBs();
+
+    // Register the pending split so the end barrier gets issued before the next resource use
+    auto& split = _splitBarriers[_splitBarriersCount++];
+    split.Resource = resource;
+    split.Before = before;
+    split.After = after;
+    resource->OnRelease.Bind<GPUContextDX12, &GPUContextDX12::onSplitBarrierResourceRelease>(this);
+#endif
+}
+
+void GPUContextDX12::endSplitBarrier(ResourceOwnerDX12* resource)
+{
+    for (int32 i = 0; i < _splitBarriersCount; i++)
+    {
+        auto& split = _splitBarriers[i];
+        if (split.Resource != resource)
+            continue;
+
+        // End the split transition and update the tracked resource state
+        if (_rbBufferSize == DX12_RB_BUFFER_SIZE)
+            flushRBs();
+        D3D12_RESOURCE_BARRIER barrier;
+        barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
+        barrier.Flags = D3D12_RESOURCE_BARRIER_FLAG_END_ONLY;
+        barrier.Transition.pResource = resource->GetResource();
+        barrier.Transition.StateBefore = split.Before;
+        barrier.Transition.StateAfter = split.After;
+        barrier.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
+        _rbBuffer[_rbBufferSize++] = barrier;
+        resource->State.SetResourceState(split.After);
+        resource->OnRelease.Unbind<GPUContextDX12, &GPUContextDX12::onSplitBarrierResourceRelease>(this);
+        _splitBarriers[i] = _splitBarriers[--_splitBarriersCount];
+        return;
+    }
+}
+
+void GPUContextDX12::completeSplitBarriers()
+{
+    while (_splitBarriersCount != 0)
+        endSplitBarrier(_splitBarriers[0].Resource);
+}
+
+void GPUContextDX12::onSplitBarrierResourceRelease(ResourceOwnerDX12* resource)
+{
+    // Resource gets released with a pending split transition so end it now (the native resource stays alive for the next few frames)
+    endSplitBarrier(resource);
+}
+
 void GPUContextDX12::SetResourceState(ResourceOwnerDX12* resource, D3D12_RESOURCE_STATES after, int32 subresourceIndex)
 {
     auto nativeResource = resource->GetResource();
     if (nativeResource == nullptr)
         return;
+    if (_splitBarriersCount != 0)
+        endSplitBarrier(resource);
     auto& state = resource->State;
     if (subresourceIndex == -1)
     {
@@ -244,7 +371,8 @@ uint64 GPUContextDX12::Execute(bool waitForCompletion)
     ASSERT(_currentAllocator != nullptr);
     auto queue = _device->GetCommandQueue();
 
-    // Flush remaining and buffered commands
+    // Flush remaining and buffered commands (split barriers cannot cross the command list execution)
+    completeSplitBarriers();
     FlushState();
     _currentState = nullptr;
 
@@ -1435,6 +1563,12 @@ void GPUContextDX12::SetResourceState(GPUResource* resource, uint64 state, int32
     SetResourceState(resourceDX12, (D3D12_RESOURCE_STATES)state, subresource);
 }
 
+void GPUContextDX12::PreTransitionSR(GPUResource* resource)
+{
+    const auto resourceDX12 = dynamic_cast<ResourceOwnerDX12*>(resource);
+    PreTransitionResource(resourceDX12, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE);
+}
+
 void GPUContextDX12::ForceRebindDescriptors()
 {
     // Bind Root Signature
@@ -64,6 +64,14 @@ private:
     D3D12_INDEX_BUFFER_VIEW _ibView;
     D3D12_VERTEX_BUFFER_VIEW _vbViews[GPU_MAX_VB_BINDED];
     D3D12_RESOURCE_BARRIER _rbBuffer[DX12_RB_BUFFER_SIZE];
+    struct SplitBarrier
+    {
+        ResourceOwnerDX12* Resource;
+        D3D12_RESOURCE_STATES Before;
+        D3D12_RESOURCE_STATES After;
+    };
+    SplitBarrier _splitBarriers[DX12_RB_BUFFER_SIZE];
+    int32 _splitBarriersCount;
     GPUConstantBufferDX12* _cbHandles[GPU_MAX_CB_BINDED];
     GPUSamplerDX12* _samplers[GPU_MAX_SAMPLER_BINDED - GPU_STATIC_SAMPLERS_COUNT];
 
@@ -97,6 +105,19 @@ public:
     /// </summary>
     void AddUAVBarrier();
 
+    /// <summary>
+    /// Adds the aliasing barrier for the placed resource that reuses transient heap memory. Supports batching barriers.
+    /// </summary>
+    /// <param name="resource">The placed resource that gets activated.</param>
+    void AddAliasingBarrier(ID3D12Resource* resource);
+
+    /// <summary>
+    /// Begins the split transition of the resource into the given state so the driver can overlap it with other GPU work. The end barrier is issued automatically when the resource state gets changed (or before the command list execution).
+    /// </summary>
+    /// <param name="resource">The resource to pre-transition.</param>
+    /// <param name="after">The target resource state.</param>
+    void PreTransitionResource(ResourceOwnerDX12* resource, D3D12_RESOURCE_STATES after);
+
     /// <summary>
     /// Set DirectX 12 resource state using resource barrier
     /// </summary>
@@ -143,6 +164,9 @@ private:
     void flushSamplers();
     void flushRBs();
     void flushPS();
+    void endSplitBarrier(ResourceOwnerDX12* resource);
+    void completeSplitBarriers();
+    void onSplitBarrierResourceRelease(ResourceOwnerDX12* resource);
     void OnDrawCall();
 
 public:
@@ -200,6 +224,7 @@ public:
     void CopyResource(GPUResource* dstResource, GPUResource* srcResource) override;
     void CopySubresource(GPUResource* dstResource, uint32 dstSubresource, GPUResource* srcResource, uint32 srcSubresource) override;
     void SetResourceState(GPUResource* resource, uint64 state, int32 subresource) override;
+    void PreTransitionSR(GPUResource* resource) override;
     void ForceRebindDescriptors() override;
 };
 
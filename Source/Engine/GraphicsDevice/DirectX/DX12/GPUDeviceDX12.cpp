@@ -18,6 +18,9 @@
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Config/PlatformSettings.h"
+#include "Engine/Engine/Globals.h"
+#include "Engine/Platform/File.h"
+#include "Engine/Platform/FileSystem.h"
 #include "UploadBufferDX12.h"
 #include "CommandQueueDX12.h"
 #include "Engine/Core/Utilities.h"
@@ -344,6 +347,7 @@ bool GPUDeviceDX12::Init()
         limits.HasReadOnlyDepth = true;
         limits.HasMultisampleDepthAsSRV = true;
         limits.HasTypedUAVLoad = options.TypedUAVLoadAdditionalFormats != 0;
+        limits.HasPersistentConstantBuffers = false; // UpdateCB allocates from the per-frame transient upload ring
         limits.MaximumMipLevelsCount = D3D12_REQ_MIP_LEVELS;
         limits.MaximumTexture1DSize = D3D12_REQ_TEXTURE1D_U_DIMENSION;
         limits.MaximumTexture1DArraySize = D3D12_REQ_TEXTURE1D_ARRAY_AXIS_DIMENSION;
@@ -383,6 +387,7 @@ bool GPUDeviceDX12::Init()
         return true;
     if (RingHeap_Sampler.Init())
         return true;
+    TransientHeaps.Init(this);
 
     // Create empty views
     D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc;
@@ -651,10 +656,110 @@ bool GPUDeviceDX12::Init()
         DispatchIndirectCommandSignature->Finalize();
     }
 
+#if PLATFORM_WINDOWS
+    // Pipelines library (warms the pipeline states cache with the driver blobs from the previous run)
+    loadPipelineLibrary();
+#endif
+
     _state = DeviceState::Ready;
     return GPUDeviceDX::Init();
 }
 
+#if PLATFORM_WINDOWS
+
+void GetPipelineLibraryPath(String& path)
+{
+#if USE_EDITOR
+    path = Globals::ProjectCacheFolder / TEXT("D3D12Pipelines.cache");
+#else
+    path = Globals::ProductLocalFolder / TEXT("D3D12Pipelines.cache");
+#endif
+}
+
+void GPUDeviceDX12::loadPipelineLibrary()
+{
+    // Pipelines library requires ID3D12Device1 and the driver support
+    ComPtr<ID3D12Device1> device1;
+    _device->QueryInterface(IID_PPV_ARGS(&device1));
+    if (!device1)
+        return;
+    D3D12_FEATURE_DATA_SHADER_CACHE shaderCache = {};
+    if (FAILED(_device->CheckFeatureSupport(D3D12_FEATURE_SHADER_CACHE, &shaderCache, sizeof(shaderCache))) || !(shaderCache.SupportFlags & D3D12_SHADER_CACHE_SUPPORT_LIBRARY))
+        return;
+
+    // Initialize the library with the data from the previous run (note: the library references that memory so keep it alive)
+    String path;
+    GetPipelineLibraryPath(path);
+    if (FileSystem::FileExists(path))
+    {
+        LOG(Info, "Trying to load D3D12 pipelines library file {0}", path);
+        File::ReadAllBytes(path, _pipelineLibraryData);
+    }
+    HRESULT result = device1->CreatePipelineLibrary(_pipelineLibraryData.Get(), _pipelineLibraryData.Count(), IID_PPV_ARGS(&_pipelineLibrary));
+    if (FAILED(result) && _pipelineLibraryData.HasItems())
+    {
+        // Cached data got stale (eg. driver or adapter has been changed) so start with an empty library
+        _pipelineLibraryData.Resize(0);
+        result = device1->CreatePipelineLibrary(nullptr, 0, IID_PPV_ARGS(&_pipelineLibrary));
+    }
+    LOG_DIRECTX_RESULT(result);
+}
+
+void GPUDeviceDX12::savePipelineLibrary()
+{
+    if (!_pipelineLibrary || !_pipelineLibraryDirty)
+        return;
+
+    // Serialize the library
+    Array<byte> data;
+    data.Resize((int32)_pipelineLibrary->GetSerializedSize());
+    const HRESULT result = _pipelineLibrary->Serialize(data.Get(), data.Count());
+    LOG_DIRECTX_RESULT(result);
+    if (FAILED(result))
+        return;
+
+    // Save data
+    String path;
+    GetPipelineLibraryPath(path);
+    if (File::WriteAllBytes(path, data))
+    {
+        LOG(Warning, "Failed to save D3D12 pipelines library file {0}", path);
+    }
+}
+
+#endif
+
+ID3D12PipelineState* GPUDeviceDX12::CreateCachedPipelineState(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc, uint32 hash)
+{
+    ID3D12PipelineState* state = nullptr;
+
+#if PLATFORM_WINDOWS
+    // Library entries are named with a hex-formatted hash of the state description
+    Char name[9];
+    for (int32 i = 0; i < 8; i++)
+        name[i] = TEXT("0123456789abcdef")[(hash >> (i * 4)) & 15];
+    name[8] = 0;
+
+    // Try to reuse the driver blob cached in the previous runs
+    if (_pipelineLibrary && SUCCEEDED(_pipelineLibrary->LoadGraphicsPipeline(name, &desc, IID_PPV_ARGS(&state))))
+        return state;
+#endif
+
+    // Compile the state from scratch
+    const HRESULT result = _device->CreateGraphicsPipelineState(&desc, IID_PPV_ARGS(&state));
+    LOG_DIRECTX_RESULT(result);
+    if (FAILED(result))
+        return nullptr;
+
+#if PLATFORM_WINDOWS
+    // Store the driver blob for the next runs (ignore failures eg. on a name collision)
+    if (_pipelineLibrary && SUCCEEDED(_pipelineLibrary->StorePipeline(name, state)))
+        _pipelineLibraryDirty = true;
+#endif
+
+    return state;
+}
+
 void GPUDeviceDX12::DrawBegin()
 {
     {
@@ -730,6 +835,7 @@ void GPUDeviceDX12::Dispose()
         srv.Release();
     _nullUav.Release();
     TimestampQueryHeap.Destroy();
+    TransientHeaps.ReleaseGPU();
     DX_SAFE_RELEASE_CHECK(_rootSignature, 0);
     Heap_CBV_SRV_UAV.ReleaseGPU();
     Heap_RTV.ReleaseGPU();
@@ -742,6 +848,13 @@ void GPUDeviceDX12::Dispose()
     SAFE_DELETE(_mainContext);
     SAFE_DELETE(_commandQueue);
 
+#if PLATFORM_WINDOWS
+    // Save and release the pipelines library
+    savePipelineLibrary();
+    SAFE_RELEASE(_pipelineLibrary);
+    _pipelineLibraryData.Resize(0);
+#endif
+
     // Clear DirectX stuff
     SAFE_DELETE(_adapter);
     SAFE_RELEASE(_device);
@@ -810,6 +923,7 @@ void GPUDeviceDX12::AddResourceToLateRelease(IGraphicsUnknown* resource, uint32
     DisposeResourceEntry entry;
     entry.Resource = resource;
     entry.TargetFrame = Engine::FrameCount + safeFrameCount;
+    entry.FenceValue = 0;
     _res2Dispose.Add(entry);
 }
 
@@ -821,11 +935,24 @@ void GPUDeviceDX12::updateRes2Dispose()
         // During device disposing we want to remove all resources
         currentFrame = MAX_uint32;
     }
+    // Fence value signaled after the last fully executed frame (covers all the commands that could reference the pending resources)
+    const uint64 lastFrameFenceValue = _mainContext ? _mainContext->FrameFenceValues[0] : 0;
+    FenceDX12* fence = _commandQueue ? &_commandQueue->GetFence() : nullptr;
 
     _res2DisposeLock.Lock();
     for (int32 i = _res2Dispose.Count() - 1; i >= 0 && i < _res2Dispose.Count(); i--)
     {
-        const DisposeResourceEntry& entry = _res2Dispose[i];
+        DisposeResourceEntry& entry = _res2Dispose[i];
+        if (entry.FenceValue == 0)
+        {
+            // Stamp the entry with the fence of the frame it was released in (the next updateRes2Dispose call runs in a new frame)
+            entry.FenceValue = lastFrameFenceValue;
+        }
+        else if (fence && fence->IsFenceComplete(entry.FenceValue))
+        {
+            // The GPU has passed all the work that could use this resource so don't wait for the conservative frames count timeout
+            entry.TargetFrame = 0;
+        }
         if (entry.TargetFrame <= currentFrame)
         {
             auto refs = entry.Resource->Release();
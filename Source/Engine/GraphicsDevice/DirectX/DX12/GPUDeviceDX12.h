@@ -10,6 +10,7 @@
 #include "ResourceOwnerDX12.h"
 #include "QueryHeapDX12.h"
 #include "DescriptorHeapDX12.h"
+#include "TransientHeapDX12.h"
 
 #if PLATFORM_WINDOWS
 #define DX12_BACK_BUFFER_COUNT 3
@@ -44,6 +45,7 @@ private:
     {
         IGraphicsUnknown* Resource;
         uint64 TargetFrame;
+        uint64 FenceValue; // 0 until stamped with the fence value signaled after the last frame that could reference the resource
     };
 
 private:
@@ -58,6 +60,11 @@ private:
     ID3D12RootSignature* _rootSignature;
     CommandQueueDX12* _commandQueue;
     GPUContextDX12* _mainContext;
+#if PLATFORM_WINDOWS
+    ID3D12PipelineLibrary* _pipelineLibrary = nullptr;
+    Array<byte> _pipelineLibraryData;
+    bool _pipelineLibraryDirty = false;
+#endif
 
     // Heaps
     DescriptorHeapWithSlotsDX12::Slot _nullSrv[D3D12_SRV_DIMENSION_TEXTURECUBEARRAY + 1];
@@ -141,6 +148,14 @@ public:
         return _mainContext;
     }
 
+    /// <summary>
+    /// Creates the graphics pipeline state object. Uses the pipelines library (persisted on disk between runs) to reuse the driver blob instead of compiling the state from scratch (if supported).
+    /// </summary>
+    /// <param name="desc">The graphics pipeline state description.</param>
+    /// <param name="hash">The hash of the pipeline state (must be stable across runs to hit the cache).</param>
+    /// <returns>The created pipeline state, or null on failure.</returns>
+    ID3D12PipelineState* CreateCachedPipelineState(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc, uint32 hash);
+
 public:
 
     DescriptorHeapPoolDX12 Heap_CBV_SRV_UAV;
@@ -149,6 +164,7 @@ public:
     DescriptorHeapPoolDX12 Heap_Sampler;
     DescriptorHeapRingBufferDX12 RingHeap_CBV_SRV_UAV;
     DescriptorHeapRingBufferDX12 RingHeap_Sampler;
+    TransientHeapManagerDX12 TransientHeaps;
 
 public:
 
@@ -173,6 +189,10 @@ private:
     void updateFrameEvents();
 #endif
     void updateRes2Dispose();
+#if PLATFORM_WINDOWS
+    void loadPipelineLibrary();
+    void savePipelineLibrary();
+#endif
 
 public:
 
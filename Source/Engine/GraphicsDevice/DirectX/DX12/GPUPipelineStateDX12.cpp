@@ -8,6 +8,7 @@
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/GraphicsDevice/DirectX/RenderToolsDX.h"
 #include "Engine/Graphics/PixelFormatExtensions.h"
+#include "Engine/Utilities/Crc.h"
 
 GPUPipelineStateDX12::GPUPipelineStateDX12(GPUDeviceDX12* device)
     : GPUResourceDX12(device, StringView::Empty)
@@ -59,10 +60,9 @@ ID3D12PipelineState* GPUPipelineStateDX12::GetState(GPUTextureViewDX12* depth, i
     _desc.SampleMask = D3D12_DEFAULT_SAMPLE_MASK;
     _desc.DSVFormat = RenderToolsDX::ToDxgiFormat(PixelFormatExtensions::FindDepthStencilFormat(key.DepthFormat));
 
-    // Create object
-    const HRESULT result = _device->GetDevice()->CreateGraphicsPipelineState(&_desc, IID_PPV_ARGS(&state));
-    LOG_DIRECTX_RESULT(result);
-    if (FAILED(result))
+    // Create object (reuses the driver blob from the pipelines library persisted in the previous runs)
+    state = _device->CreateCachedPipelineState(_desc, Crc::MemCrc32(&key, sizeof(key), _descHash));
+    if (state == nullptr)
         return nullptr;
 #if GPU_ENABLE_RESOURCE_NAMING && BUILD_DEBUG
     char name[200];
@@ -227,6 +227,20 @@ bool GPUPipelineStateDX12::Init(const Description& desc)
     // Cache description
     _desc = psDesc;
 
+    // Compute a stable hash of the state description for the pipelines library (uses shader bytecodes contents, not runtime pointers, so it matches across runs)
+    uint32 hash = Crc::MemCrc32(&psDesc.DepthStencilState, sizeof(psDesc.DepthStencilState));
+    hash = Crc::MemCrc32(&psDesc.RasterizerState, sizeof(psDesc.RasterizerState), hash);
+    hash = Crc::MemCrc32(&psDesc.BlendState, sizeof(psDesc.BlendState), hash);
+    hash = Crc::MemCrc32(&psDesc.PrimitiveTopologyType, sizeof(psDesc.PrimitiveTopologyType), hash);
+#define HASH_SHADER_STAGE(stage) if (desc.stage) hash = Crc::MemCrc32(desc.stage->GetBufferHandle(), (int32)desc.stage->GetBufferSize(), hash)
+    HASH_SHADER_STAGE(VS);
+    HASH_SHADER_STAGE(HS);
+    HASH_SHADER_STAGE(DS);
+    HASH_SHADER_STAGE(GS);
+    HASH_SHADER_STAGE(PS);
+#undef HASH_SHADER_STAGE
+    _descHash = hash;
+
     // Set non-zero memory usage
     _memoryUsage = sizeof(D3D12_GRAPHICS_PIPELINE_STATE_DESC);
 
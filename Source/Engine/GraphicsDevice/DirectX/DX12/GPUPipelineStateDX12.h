@@ -48,6 +48,7 @@ private:
 
     Dictionary<GPUPipelineStateKeyDX12, ID3D12PipelineState*> _states;
     D3D12_GRAPHICS_PIPELINE_STATE_DESC _desc;
+    uint32 _descHash = 0;
 
 public:
 
@@ -182,9 +182,32 @@ bool GPUTextureDX12::OnInit()
     if (IsRegularTexture())
         initialState = D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE;
 
-    // Create texture
-    auto result = device->CreateCommittedResource(&heapProperties, D3D12_HEAP_FLAG_NONE, &resourceDesc, initialState, clearValuePtr, IID_PPV_ARGS(&resource));
-    LOG_DIRECTX_RESULT_WITH_RETURN(result);
+    // Create texture (transient render targets get placed into the shared heap memory so they can alias targets with disjoint lifetimes)
+    resource = nullptr;
+    if (EnumHasAnyFlags(_desc.Flags, GPUTextureFlags::Aliasing) && (useRTV || useDSV))
+    {
+        const D3D12_RESOURCE_ALLOCATION_INFO allocationInfo = device->GetResourceAllocationInfo(0, 1, &resourceDesc);
+        if (!_device->TransientHeaps.Allocate(allocationInfo, _heapAllocation))
+        {
+            const auto placedResult = device->CreatePlacedResource(_heapAllocation.Heap, _heapAllocation.Offset, &resourceDesc, initialState, clearValuePtr, IID_PPV_ARGS(&resource));
+            if (FAILED(placedResult))
+            {
+                LOG_DIRECTX_RESULT(placedResult);
+                _device->TransientHeaps.Free(_heapAllocation);
+                resource = nullptr;
+            }
+            else
+            {
+                // Heap memory can be aliased by the previously placed resources so inject the aliasing barrier before the first use
+                _device->GetMainContextDX12()->AddAliasingBarrier(resource);
+            }
+        }
+    }
+    if (resource == nullptr)
+    {
+        const auto result = device->CreateCommittedResource(&heapProperties, D3D12_HEAP_FLAG_NONE, &resourceDesc, initialState, clearValuePtr, IID_PPV_ARGS(&resource));
+        LOG_DIRECTX_RESULT_WITH_RETURN(result);
+    }
 
     // Set state
     bool isRead = useSRV || useUAV;
@@ -253,6 +276,7 @@ void GPUTextureDX12::OnReleaseGPU()
     _srv.Release();
     _uav.Release();
     releaseResource();
+    _device->TransientHeaps.Free(_heapAllocation);
 
     // Base
     GPUTexture::OnReleaseGPU();
@@ -139,6 +139,7 @@ private:
 
     DescriptorHeapWithSlotsDX12::Slot _srv;
     DescriptorHeapWithSlotsDX12::Slot _uav;
+    TransientAllocationDX12 _heapAllocation;
 
     DXGI_FORMAT _dxgiFormatDSV;
     DXGI_FORMAT _dxgiFormatSRV;
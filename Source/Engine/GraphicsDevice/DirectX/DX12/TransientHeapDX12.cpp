@@ -0,0 +1,168 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#if GRAPHICS_API_DIRECTX12
+
+#include "TransientHeapDX12.h"
+#include "GPUDeviceDX12.h"
+#include "ResourceOwnerDX12.h"
+#include "../RenderToolsDX.h"
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Engine/Engine.h"
+#include "Engine/Threading/Threading.h"
+
+void TransientHeapManagerDX12::Init(GPUDeviceDX12* device)
+{
+    _device = device;
+}
+
+bool TransientHeapManagerDX12::Allocate(const D3D12_RESOURCE_ALLOCATION_INFO& allocationInfo, TransientAllocationDX12& result)
+{
+    const uint64 size = allocationInfo.SizeInBytes;
+    const uint64 alignment = allocationInfo.Alignment;
+    if (size == 0 || size > (uint64)HeapSize || alignment > D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT)
+        return true;
+    ScopeLock lock(_locker);
+    updateDeferredFrees();
+
+    // Try to place the resource inside one of the existing heaps (first-fit with alignment)
+    for (int32 heapIndex = 0; heapIndex < _heaps.Count(); heapIndex++)
+    {
+        const auto heap = _heaps[heapIndex];
+        for (int32 i = 0; i < heap->FreeList.Count(); i++)
+        {
+            auto& range = heap->FreeList[i];
+            const uint64 alignedOffset = Math::AlignUp<uint64>(range.Offset, alignment);
+            const uint64 padding = alignedOffset - range.Offset;
+            if (range.Size < padding + size)
+                continue;
+
+            // Place at the aligned offset, keeping the alignment padding and the tail on the free-list
+            const uint64 tailSize = range.Size - padding - size;
+            if (padding != 0)
+            {
+                range.Size = padding;
+                if (tailSize != 0)
+                    heap->FreeList.Insert(i + 1, { alignedOffset + size, tailSize });
+            }
+            else if (tailSize != 0)
+            {
+                range.Offset = alignedOffset + size;
+                range.Size = tailSize;
+            }
+            else
+            {
+                heap->FreeList.RemoveAtKeepOrder(i);
+            }
+            heap->UsedSize += size;
+            _usedMemory += size;
+            result.Heap = heap->Resource;
+            result.Offset = alignedOffset;
+            result.Size = size;
+            result.Page = heap;
+            return false;
+        }
+    }
+
+    // Create a new heap if none has enough free space
+    D3D12_HEAP_DESC heapDesc;
+    heapDesc.SizeInBytes = HeapSize;
+    heapDesc.Properties.Type = D3D12_HEAP_TYPE_DEFAULT;
+    heapDesc.Properties.CPUPageProperty = D3D12_CPU_PAGE_PROPERTY_UNKNOWN;
+    heapDesc.Properties.MemoryPoolPreference = D3D12_MEMORY_POOL_UNKNOWN;
+    heapDesc.Properties.CreationNodeMask = 1;
+    heapDesc.Properties.VisibleNodeMask = 1;
+    heapDesc.Alignment = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+    heapDesc.Flags = D3D12_HEAP_FLAG_ALLOW_ONLY_RT_DS_TEXTURES;
+    ID3D12Heap* heapResource;
+    const HRESULT hr = _device->GetDevice()->CreateHeap(&heapDesc, IID_PPV_ARGS(&heapResource));
+    if (FAILED(hr))
+    {
+        LOG_DIRECTX_RESULT(hr);
+        return true;
+    }
+    DX_SET_DEBUG_NAME(heapResource, TEXT("TransientHeap"));
+    const auto heap = ::New<Heap>();
+    heap->Resource = heapResource;
+    heap->Size = HeapSize;
+    heap->UsedSize = size;
+    heap->FreeList.Add({ size, HeapSize - size });
+    _heaps.Add(heap);
+    _usedMemory += size;
+    result.Heap = heapResource;
+    result.Offset = 0;
+    result.Size = size;
+    result.Page = heap;
+    return false;
+}
+
+void TransientHeapManagerDX12::Free(TransientAllocationDX12& allocation)
+{
+    if (!allocation.IsValid())
+        return;
+    ScopeLock lock(_locker);
+
+    // Defer the actual free so in-flight GPU work using the old resource can finish before the memory gets aliased
+    _deferredFrees.Add({ allocation, Engine::FrameCount + DX12_RESOURCE_DELETE_SAFE_FRAMES_COUNT });
+    allocation = TransientAllocationDX12();
+}
+
+void TransientHeapManagerDX12::ReleaseGPU()
+{
+    ScopeLock lock(_locker);
+    _deferredFrees.Clear();
+    for (const auto heap : _heaps)
+    {
+        heap->Resource->Release();
+        ::Delete(heap);
+    }
+    _heaps.Clear();
+    _usedMemory = 0;
+}
+
+void TransientHeapManagerDX12::freeRange(const TransientAllocationDX12& allocation)
+{
+    const auto heap = (Heap*)allocation.Page;
+    ASSERT(heap && heap->UsedSize >= allocation.Size);
+    heap->UsedSize -= allocation.Size;
+    _usedMemory -= allocation.Size;
+
+    // Release the whole heap when the last allocation gets freed
+    if (heap->UsedSize == 0)
+    {
+        _device->AddResourceToLateRelease(heap->Resource);
+        _heaps.Remove(heap);
+        ::Delete(heap);
+        return;
+    }
+
+    // Insert the range into the sorted free-list and merge it with the adjacent ranges
+    int32 index = 0;
+    while (index < heap->FreeList.Count() && heap->FreeList[index].Offset < allocation.Offset)
+        index++;
+    heap->FreeList.Insert(index, { allocation.Offset, allocation.Size });
+    if (index + 1 < heap->FreeList.Count() && heap->FreeList[index].Offset + heap->FreeList[index].Size >= heap->FreeList[index + 1].Offset)
+    {
+        heap->FreeList[index].Size = heap->FreeList[index + 1].Offset + heap->FreeList[index + 1].Size - heap->FreeList[index].Offset;
+        heap->FreeList.RemoveAtKeepOrder(index + 1);
+    }
+    if (index > 0 && heap->FreeList[index - 1].Offset + heap->FreeList[index - 1].Size >= heap->FreeList[index].Offset)
+    {
+        heap->FreeList[index - 1].Size = heap->FreeList[index].Offset + heap->FreeList[index].Size - heap->FreeList[index - 1].Offset;
+        heap->FreeList.RemoveAtKeepOrder(index);
+    }
+}
+
+void TransientHeapManagerDX12::updateDeferredFrees()
+{
+    const uint64 currentFrame = Engine::FrameCount;
+    for (int32 i = _deferredFrees.Count() - 1; i >= 0; i--)
+    {
+        if (_deferredFrees[i].TargetFrame <= currentFrame)
+        {
+            freeRange(_deferredFrees[i].Allocation);
+            _deferredFrees.RemoveAt(i);
+        }
+    }
+}
+
+#endif
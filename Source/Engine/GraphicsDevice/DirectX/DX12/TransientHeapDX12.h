@@ -0,0 +1,101 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#if GRAPHICS_API_DIRECTX12
+
+#include "../IncludeDirectXHeaders.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Platform/CriticalSection.h"
+
+class GPUDeviceDX12;
+
+/// <summary>
+/// The single range of the heap memory allocated for a transient resource.
+/// </summary>
+struct TransientAllocationDX12
+{
+    ID3D12Heap* Heap = nullptr;
+    uint64 Offset = 0;
+    uint64 Size = 0;
+    void* Page = nullptr;
+
+    FORCE_INLINE bool IsValid() const
+    {
+        return Heap != nullptr;
+    }
+};
+
+/// <summary>
+/// Transient memory heaps manager for DirectX 12 backend. Places transient render targets (frame-graph-style pass
+/// resources with disjoint lifetimes) into shared heap memory via placed resources so aliased targets reuse the
+/// same physical memory instead of each getting a dedicated committed allocation.
+/// </summary>
+class TransientHeapManagerDX12
+{
+private:
+
+    struct FreeRange
+    {
+        uint64 Offset;
+        uint64 Size;
+    };
+
+    struct Heap
+    {
+        ID3D12Heap* Resource;
+        uint64 Size;
+        uint64 UsedSize;
+        Array<FreeRange> FreeList; // Sorted by offset so adjacent ranges can be merged on free
+    };
+
+    struct DeferredFree
+    {
+        TransientAllocationDX12 Allocation;
+        uint64 TargetFrame;
+    };
+
+    GPUDeviceDX12* _device = nullptr;
+    CriticalSection _locker;
+    Array<Heap*> _heaps;
+    Array<DeferredFree> _deferredFrees;
+    uint64 _usedMemory = 0;
+
+public:
+
+    /// <summary>
+    /// The size of a single transient memory heap (in bytes).
+    /// </summary>
+    enum : uint64 { HeapSize = 64 * 1024 * 1024 };
+
+    /// <summary>
+    /// Initializes the manager for the given device.
+    /// </summary>
+    void Init(GPUDeviceDX12* device);
+
+    /// <summary>
+    /// Allocates a memory range for a placed resource inside one of the transient heaps (creates a new heap if none has enough free space).
+    /// </summary>
+    /// <param name="allocationInfo">The resource allocation info (size and alignment).</param>
+    /// <param name="result">The output allocation.</param>
+    /// <returns>True if failed (caller should fall back to a committed resource), otherwise false.</returns>
+    bool Allocate(const D3D12_RESOURCE_ALLOCATION_INFO& allocationInfo, TransientAllocationDX12& result);
+
+    /// <summary>
+    /// Frees the allocated memory range (deferred by a few frames so in-flight GPU work can finish). Releases the heap when it becomes empty.
+    /// </summary>
+    /// <param name="allocation">The allocation to free (cleared on return).</param>
+    void Free(TransientAllocationDX12& allocation);
+
+    /// <summary>
+    /// Releases all of the heaps (call on device disposal after GPU work sync).
+    /// </summary>
+    void ReleaseGPU();
+
+private:
+
+    void freeRange(const TransientAllocationDX12& allocation);
+    void updateDeferredFrees();
+};
+
+#endif
@@ -62,6 +62,7 @@ bool GPUDeviceNull::Init()
         limits.HasReadOnlyDepth = false;
         limits.HasMultisampleDepthAsSRV = false;
         limits.HasTypedUAVLoad = false;
+        limits.HasPersistentConstantBuffers = true;
         limits.MaximumMipLevelsCount = 14;
         limits.MaximumTexture1DSize = 8192;
         limits.MaximumTexture1DArraySize = 512;
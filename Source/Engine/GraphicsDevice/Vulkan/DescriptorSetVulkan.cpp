@@ -268,6 +268,7 @@ void TypedDescriptorPoolSetVulkan::Reset()
 DescriptorPoolSetContainerVulkan::DescriptorPoolSetContainerVulkan(GPUDeviceVulkan* device)
     : _device(device)
     , _lastFrameUsed(Engine::FrameCount)
+    , _resetsCount(0)
     , _used(true)
 {
 }
@@ -296,6 +297,7 @@ void DescriptorPoolSetContainerVulkan::Reset()
         TypedDescriptorPoolSetVulkan* typedPool = i->Value;
         typedPool->Reset();
     }
+    _resetsCount++;
 }
 
 void DescriptorPoolSetContainerVulkan::SetUsed(bool used)
@@ -309,6 +309,7 @@ private:
     GPUDeviceVulkan* _device;
     Dictionary<uint32, TypedDescriptorPoolSetVulkan*> _typedDescriptorPools;
     uint64 _lastFrameUsed;
+    uint32 _resetsCount;
     bool _used;
 
 public:
@@ -332,6 +333,12 @@ public:
     {
         return _lastFrameUsed;
     }
+
+    // Gets the amount of times the pools got reset. Used to detect stale descriptor sets cached by the pipeline states when the container gets recycled.
+    uint32 GetResetsCount() const
+    {
+        return _resetsCount;
+    }
 };
 
 class DescriptorPoolsManagerVulkan
@@ -474,8 +481,7 @@ public:
         ASSERT(descriptorIndex < WritesCount);
         ASSERT(WriteDescriptors[descriptorIndex].descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER);
         auto* bufferInfo = const_cast<VkBufferView*>(WriteDescriptors[descriptorIndex].pTexelBufferView + index);
-        *bufferInfo = bufferView;
-        return true;
+        return DescriptorSet::CopyAndReturnNotEqual(*bufferInfo, bufferView);
     }
 
     bool WriteStorageBuffer(uint32 descriptorIndex, VkBuffer buffer, VkDeviceSize offset, VkDeviceSize range, uint32 index = 0) const
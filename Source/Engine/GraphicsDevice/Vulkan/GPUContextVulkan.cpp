@@ -589,8 +589,8 @@ void GPUContextVulkan::UpdateDescriptorSets(GPUPipelineStateVulkan* pipelineStat
         remainingHasDescriptorsPerStageMask >>= 1;
     }
 
-    // Allocate sets if need to
-    //if (needsWrite) // TODO: write on change only?
+    // Allocate and write new sets only if any binding changed, otherwise reuse the last sets from the same pool (dynamic constant buffer offsets are passed at bind time)
+    if (needsWrite)
     {
         if (!pipelineState->AllocateDescriptorSets())
         {
@@ -629,8 +629,8 @@ void GPUContextVulkan::UpdateDescriptorSets(ComputePipelineStateVulkan* pipeline
     // Update descriptors
     UpdateDescriptorSets(*pipelineState->DescriptorInfo, pipelineState->DSWriter, needsWrite);
 
-    // Allocate sets if need to
-    //if (needsWrite) // TODO: write on change only?f
+    // Allocate and write new sets only if any binding changed, otherwise reuse the last sets from the same pool (dynamic constant buffer offsets are passed at bind time)
+    if (needsWrite)
     {
         if (!pipelineState->AllocateDescriptorSets())
         {
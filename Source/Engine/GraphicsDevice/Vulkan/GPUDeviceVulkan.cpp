@@ -357,12 +357,19 @@ DeferredDeletionQueueVulkan::~DeferredDeletionQueueVulkan()
 void DeferredDeletionQueueVulkan::ReleaseResources(bool deleteImmediately)
 {
     ScopeLock lock(_locker);
-    const uint64 checkFrame = Engine::FrameCount - VULKAN_RESOURCE_DELETE_SAFE_FRAMES_COUNT;
     for (int32 i = 0; i < _entries.Count(); i++)
     {
         Entry* e = &_entries[i];
 
-        if (deleteImmediately || (checkFrame > e->FrameNumber && (e->CmdBuffer == nullptr || e->FenceCounter < e->CmdBuffer->GetFenceSignaledCounter()))
+        if (!e->FenceStamped && Engine::FrameCount > e->FrameNumber)
+        {
+            // All the command buffers that could reference the resource have been submitted by now (the enqueue frame has ended)
+            // so re-capture the last submitted one to get the precise fence to wait for instead of a conservative frames count timeout
+            _device->GraphicsQueue->GetLastSubmittedInfo(e->CmdBuffer, e->FenceCounter);
+            e->FenceStamped = true;
+        }
+
+        if (deleteImmediately || (e->FenceStamped && (e->CmdBuffer == nullptr || e->FenceCounter < e->CmdBuffer->GetFenceSignaledCounter()))
         )
         {
             if (e->AllocationHandle == VK_NULL_HANDLE)
@@ -427,6 +434,7 @@ void DeferredDeletionQueueVulkan::EnqueueGenericResource(Type type, uint64 handl
     entry.AllocationHandle = allocation;
     entry.StructureType = type;
     entry.FrameNumber = Engine::FrameCount;
+    entry.FenceStamped = false;
 
     ScopeLock lock(_locker);
 
@@ -1688,6 +1696,7 @@ bool GPUDeviceVulkan::Init()
         limits.HasReadOnlyDepth = true;
         limits.HasMultisampleDepthAsSRV = !!PhysicalDeviceFeatures.sampleRateShading;
         limits.HasTypedUAVLoad = true;
+        limits.HasPersistentConstantBuffers = false; // UpdateCB allocates from the per-frame uniform buffer uploader
         limits.MaximumMipLevelsCount = Math::Min(static_cast<int32>(log2(PhysicalDeviceLimits.maxImageDimension2D)), GPU_MAX_TEXTURE_MIP_LEVELS);
         limits.MaximumTexture1DSize = PhysicalDeviceLimits.maxImageDimension1D;
         limits.MaximumTexture1DArraySize = PhysicalDeviceLimits.maxImageArrayLayers;
@@ -2015,6 +2024,19 @@ void GPUDeviceVulkan::WaitForGPU()
     }
 }
 
+uint64 GPUDeviceVulkan::DefragMemory()
+{
+    // Base
+    const uint64 result = GPUDevice::DefragMemory();
+
+    // Flush the deferred deletions right away so the freed allocations return to the heaps (the allocator destroys the emptied memory blocks)
+    WaitForGPU();
+    DeferredDeletionQueue.ReleaseResources(true);
+    StagingManager.ProcessPendingFree();
+
+    return result;
+}
+
 GPUTexture* GPUDeviceVulkan::CreateTexture(const StringView& name)
 {
     return New<GPUTextureVulkan>(this, name);
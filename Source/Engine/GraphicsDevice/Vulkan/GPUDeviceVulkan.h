@@ -185,6 +185,7 @@ private:
         VmaAllocation AllocationHandle;
         Type StructureType;
         CmdBufferVulkan* CmdBuffer;
+        bool FenceStamped; // True once FenceCounter covers all the command buffers submitted up to the end of the enqueue frame
     };
 
     GPUDeviceVulkan* _device;
@@ -702,6 +703,7 @@ public:
     void DrawBegin() override;
     void Dispose() override;
     void WaitForGPU() override;
+    uint64 DefragMemory() override;
     GPUTexture* CreateTexture(const StringView& name) override;
     GPUShader* CreateShader(const StringView& name) override;
     GPUPipelineState* CreatePipelineState() override;
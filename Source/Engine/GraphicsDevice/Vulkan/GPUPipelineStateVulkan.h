@@ -46,16 +46,18 @@ public:
 
     const DescriptorSetLayoutVulkan* DescriptorSetsLayout = nullptr;
     TypedDescriptorPoolSetVulkan* CurrentTypedDescriptorPoolSet = nullptr;
+    uint32 CurrentPoolSetResetsCount = 0;
     Array<VkDescriptorSet> DescriptorSetHandles;
 
     inline bool AcquirePoolSet(CmdBufferVulkan* cmdBuffer)
     {
-        // Pipeline state has no current descriptor pools set or set owner is not current - acquire a new pool set
+        // Pipeline state has no current descriptor pools set, set owner is not current or the pools got reset (recycled for a new command buffer) - acquire a new pool set
         DescriptorPoolSetContainerVulkan* cmdBufferPoolSet = cmdBuffer->GetDescriptorPoolSet();
-        if (CurrentTypedDescriptorPoolSet == nullptr || CurrentTypedDescriptorPoolSet->GetOwner() != cmdBufferPoolSet)
+        if (CurrentTypedDescriptorPoolSet == nullptr || CurrentTypedDescriptorPoolSet->GetOwner() != cmdBufferPoolSet || CurrentPoolSetResetsCount != cmdBufferPoolSet->GetResetsCount())
         {
             ASSERT(cmdBufferPoolSet);
             CurrentTypedDescriptorPoolSet = cmdBufferPoolSet->AcquireTypedPoolSet(*DescriptorSetsLayout);
+            CurrentPoolSetResetsCount = cmdBufferPoolSet->GetResetsCount();
             return true;
         }
 
@@ -162,16 +164,18 @@ public:
 
     const DescriptorSetLayoutVulkan* DescriptorSetsLayout = nullptr;
     TypedDescriptorPoolSetVulkan* CurrentTypedDescriptorPoolSet = nullptr;
+    uint32 CurrentPoolSetResetsCount = 0;
     Array<VkDescriptorSet> DescriptorSetHandles;
 
     inline bool AcquirePoolSet(CmdBufferVulkan* cmdBuffer)
     {
-        // Pipeline state has no current descriptor pools set or set owner is not current - acquire a new pool set
+        // Pipeline state has no current descriptor pools set, set owner is not current or the pools got reset (recycled for a new command buffer) - acquire a new pool set
         DescriptorPoolSetContainerVulkan* cmdBufferPoolSet = cmdBuffer->GetDescriptorPoolSet();
-        if (CurrentTypedDescriptorPoolSet == nullptr || CurrentTypedDescriptorPoolSet->GetOwner() != cmdBufferPoolSet)
+        if (CurrentTypedDescriptorPoolSet == nullptr || CurrentTypedDescriptorPoolSet->GetOwner() != cmdBufferPoolSet || CurrentPoolSetResetsCount != cmdBufferPoolSet->GetResetsCount())
         {
             ASSERT(cmdBufferPoolSet);
             CurrentTypedDescriptorPoolSet = cmdBufferPoolSet->AcquireTypedPoolSet(*DescriptorSetsLayout);
+            CurrentPoolSetResetsCount = cmdBufferPoolSet->GetResetsCount();
             return true;
         }
 
@@ -46,8 +46,8 @@ bool Gamepad::Update(EventQueue& queue)
     Platform::MemoryCopy(&_mappedPrevState, &_mappedState, sizeof(State));
     _mappedState.Clear();
 
-    // Gather current state
-    if (UpdateState())
+    // Gather current state (skipped when the dedicated input thread polls this device at a higher rate)
+    if (Platform::AtomicRead(&AsyncPolling) == 0 && UpdateState())
         return true;
 
     // Map state
@@ -11,7 +11,11 @@
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Engine/Screen.h"
 #include "Engine/Engine/Time.h"
+#include "Engine/Engine/Replay.h"
 #include "Engine/Platform/WindowsManager.h"
+#include "Engine/Platform/Thread.h"
+#include "Engine/Threading/Threading.h"
+#include "Engine/Threading/IRunnable.h"
 #include "Engine/Scripting/ScriptingType.h"
 #include "Engine/Scripting/BinaryModule.h"
 #include "Engine/Profiler/ProfilerCPU.h"
@@ -60,10 +64,67 @@ namespace InputImpl
     bool GamepadsChanged = true;
     Array<AxisEvaluation> AxesValues;
     InputDevice::EventQueue InputEvents;
+    CriticalSection DevicesLocker;
+    int32 DevicePollingRate = 0;
+    Thread* DevicePollingThread = nullptr;
+    volatile int64 DevicePollingActive = 0;
+    double LastEventTime = 0.0;
 }
 
 using namespace InputImpl;
 
+/// <summary>
+/// Dedicated input thread that polls the devices state at a fixed rate so high-frequency hardware (eg. 8kHz mice, gamepads) gets sampled between frames. Captured events land in the per-device queues and are delivered to the main thread in a single per-frame batch.
+/// </summary>
+class InputPollingThread : public IRunnable
+{
+public:
+    // [IRunnable]
+    String ToString() const override
+    {
+        return TEXT("Input Polling");
+    }
+
+    int32 Run() override
+    {
+        while (Platform::AtomicRead(&DevicePollingActive) != 0)
+        {
+            const double start = Platform::GetTimeSeconds();
+            DevicesLocker.Lock();
+            PollDevice(Input::Mouse);
+            PollDevice(Input::Keyboard);
+            for (int32 i = 0; i < Input::Gamepads.Count(); i++)
+                PollDevice(Input::Gamepads[i]);
+            for (int32 i = 0; i < Input::CustomDevices.Count(); i++)
+                PollDevice(Input::CustomDevices[i]);
+            DevicesLocker.Unlock();
+
+            // Sleep the remainder of the polling interval
+            const double interval = 1.0 / (double)Math::Max(DevicePollingRate, 1);
+            const double busy = Platform::GetTimeSeconds() - start;
+            Platform::Sleep(Math::Max((int32)((interval - busy) * 1000.0), 1));
+        }
+        return 0;
+    }
+
+    void AfterWork(bool wasKilled) override
+    {
+        Delete(this);
+    }
+
+private:
+    static void PollDevice(InputDevice* device)
+    {
+        if (device == nullptr || Platform::AtomicRead(&device->AsyncPolling) == 0)
+            return;
+        if (device->UpdateState())
+        {
+            // Hand the device back to the main thread so it can detect the disconnection and remove it
+            Platform::AtomicStore(&device->AsyncPolling, 0);
+        }
+    }
+};
+
 class InputService : public EngineService
 {
 public:
@@ -176,7 +237,9 @@ void Mouse::OnMouseMoved(const Float2& newPosition)
 
 void Mouse::OnMouseDown(const Float2& position, const MouseButton button, Window* target)
 {
+    ScopeLock lock(Locker);
     Event& e = _queue.AddOne();
+    e.Timestamp = Platform::GetTimeSeconds();
     e.Type = EventType::MouseDown;
     e.Target = target;
     e.MouseData.Button = button;
@@ -194,7 +257,9 @@ bool Mouse::IsAnyButtonDown() const
 
 void Mouse::OnMouseUp(const Float2& position, const MouseButton button, Window* target)
 {
+    ScopeLock lock(Locker);
     Event& e = _queue.AddOne();
+    e.Timestamp = Platform::GetTimeSeconds();
     e.Type = EventType::MouseUp;
     e.Target = target;
     e.MouseData.Button = button;
@@ -203,7 +268,9 @@ void Mouse::OnMouseUp(const Float2& position, const MouseButton button, Window*
 
 void Mouse::OnMouseDoubleClick(const Float2& position, const MouseButton button, Window* target)
 {
+    ScopeLock lock(Locker);
     Event& e = _queue.AddOne();
+    e.Timestamp = Platform::GetTimeSeconds();
     e.Type = EventType::MouseDoubleClick;
     e.Target = target;
     e.MouseData.Button = button;
@@ -212,7 +279,9 @@ void Mouse::OnMouseDoubleClick(const Float2& position, const MouseButton button,
 
 void Mouse::OnMouseMove(const Float2& position, Window* target)
 {
+    ScopeLock lock(Locker);
     Event& e = _queue.AddOne();
+    e.Timestamp = Platform::GetTimeSeconds();
     e.Type = EventType::MouseMove;
     e.Target = target;
     e.MouseData.Position = position;
@@ -220,14 +289,18 @@ void Mouse::OnMouseMove(const Float2& position, Window* target)
 
 void Mouse::OnMouseLeave(Window* target)
 {
+    ScopeLock lock(Locker);
     Event& e = _queue.AddOne();
+    e.Timestamp = Platform::GetTimeSeconds();
     e.Type = EventType::MouseLeave;
     e.Target = target;
 }
 
 void Mouse::OnMouseWheel(const Float2& position, float delta, Window* target)
 {
+    ScopeLock lock(Locker);
     Event& e = _queue.AddOne();
+    e.Timestamp = Platform::GetTimeSeconds();
     e.Type = EventType::MouseWheel;
     e.Target = target;
     e.MouseWheelData.WheelDelta = delta;
@@ -248,10 +321,11 @@ bool Mouse::Update(EventQueue& queue)
     Platform::MemoryCopy(&_prevState, &_state, sizeof(State));
 
     // Gather new events
-    if (UpdateState())
+    if (Platform::AtomicRead(&AsyncPolling) == 0 && UpdateState())
         return true;
 
     // Handle events
+    ScopeLock lock(Locker);
     _state.MouseWheelDelta = 0;
     for (int32 i = 0; i < _queue.Count(); i++)
     {
@@ -323,7 +397,9 @@ void Keyboard::OnCharInput(Char c, Window* target)
     if (c < 32)
         return;
 
+    ScopeLock lock(Locker);
     Event& e = _queue.AddOne();
+    e.Timestamp = Platform::GetTimeSeconds();
     e.Type = EventType::Char;
     e.Target = target;
     e.CharData.Char = c;
@@ -331,7 +407,9 @@ void Keyboard::OnCharInput(Char c, Window* target)
 
 void Keyboard::OnKeyUp(KeyboardKeys key, Window* target)
 {
+    ScopeLock lock(Locker);
     Event& e = _queue.AddOne();
+    e.Timestamp = Platform::GetTimeSeconds();
     e.Type = EventType::KeyUp;
     e.Target = target;
     e.KeyData.Key = key;
@@ -339,7 +417,9 @@ void Keyboard::OnKeyUp(KeyboardKeys key, Window* target)
 
 void Keyboard::OnKeyDown(KeyboardKeys key, Window* target)
 {
+    ScopeLock lock(Locker);
     Event& e = _queue.AddOne();
+    e.Timestamp = Platform::GetTimeSeconds();
     e.Type = EventType::KeyDown;
     e.Target = target;
     e.KeyData.Key = key;
@@ -359,10 +439,11 @@ bool Keyboard::Update(EventQueue& queue)
     Platform::MemoryCopy(&_prevState, &_state, sizeof(State));
 
     // Gather new events
-    if (UpdateState())
+    if (Platform::AtomicRead(&AsyncPolling) == 0 && UpdateState())
         return true;
 
     // Handle events
+    ScopeLock lock(Locker);
     _state.InputTextLength = 0;
     for (int32 i = 0; i < _queue.Count(); i++)
     {
@@ -411,6 +492,58 @@ void Input::OnGamepadsChanged()
     ::GamepadsChanged = true;
 }
 
+void Input::LockDevices()
+{
+    DevicesLocker.Lock();
+}
+
+void Input::UnlockDevices()
+{
+    DevicesLocker.Unlock();
+}
+
+int32 Input::GetDevicePollingRate()
+{
+    return DevicePollingRate;
+}
+
+void Input::SetDevicePollingRate(int32 rate)
+{
+    rate = Math::Clamp(rate, 0, 8000);
+    if (rate == DevicePollingRate)
+        return;
+    DevicePollingRate = rate;
+    if (rate > 0 && DevicePollingThread == nullptr)
+    {
+        // Spawn the dedicated polling thread
+        Platform::AtomicStore(&DevicePollingActive, 1);
+        DevicePollingThread = Thread::Create(New<InputPollingThread>(), TEXT("Input Polling"));
+    }
+    else if (rate == 0 && DevicePollingThread)
+    {
+        // Stop the polling thread and return the devices back to the main thread polling
+        Platform::AtomicStore(&DevicePollingActive, 0);
+        DevicePollingThread->Join();
+        Delete(DevicePollingThread);
+        DevicePollingThread = nullptr;
+        DevicesLocker.Lock();
+        if (Input::Mouse)
+            Platform::AtomicStore(&Input::Mouse->AsyncPolling, 0);
+        if (Input::Keyboard)
+            Platform::AtomicStore(&Input::Keyboard->AsyncPolling, 0);
+        for (int32 i = 0; i < Gamepads.Count(); i++)
+            Platform::AtomicStore(&Gamepads[i]->AsyncPolling, 0);
+        for (int32 i = 0; i < CustomDevices.Count(); i++)
+            Platform::AtomicStore(&CustomDevices[i]->AsyncPolling, 0);
+        DevicesLocker.Unlock();
+    }
+}
+
+double Input::GetLastEventTime()
+{
+    return LastEventTime;
+}
+
 StringView Input::GetInputText()
 {
     return Keyboard ? Keyboard->GetInputText() : StringView::Empty;
@@ -615,22 +748,34 @@ void InputService::Update()
     const auto frame = Time::Update.TicksCount;
     const auto dt = Time::Update.UnscaledDeltaTime.GetTotalSeconds();
     InputEvents.Clear();
+    LastEventTime = Platform::GetTimeSeconds();
+
+    // Feed the captured input back through the devices so the replayed session gets identical events and polled states
+    const bool replayPlayback = Replay::IsPlayback();
+    if (replayPlayback)
+        Replay::OnInputPlayback();
 
     // If application has no user focus then simply clear the state
-    if (!Engine::HasFocus)
+    if (!Engine::HasFocus && !replayPlayback)
     {
+        DevicesLocker.Lock();
         if (Input::Mouse)
             Input::Mouse->ResetState();
         if (Input::Keyboard)
             Input::Keyboard->ResetState();
         for (int32 i = 0; i < Input::Gamepads.Count(); i++)
             Input::Gamepads[i]->ResetState();
+        DevicesLocker.Unlock();
         Axes.Clear();
         Actions.Clear();
+
+        // Keep the capture stream in sync when running without focus (no events this frame)
+        Replay::OnInputRecord(InputEvents);
         return;
     }
 
-    // Update input devices state
+    // Update input devices state (locked so the dedicated polling thread won't touch devices during the frame batch hand-off or removal)
+    DevicesLocker.Lock();
     if (Input::Mouse)
     {
         if (Input::Mouse->Update(InputEvents))
@@ -671,6 +816,23 @@ void InputService::Update()
         }
     }
 
+    // Keep the devices enrolled into the dedicated polling thread (devices connected later get picked up here)
+    if (DevicePollingRate > 0)
+    {
+        if (Input::Mouse)
+            Platform::AtomicStore(&Input::Mouse->AsyncPolling, 1);
+        if (Input::Keyboard)
+            Platform::AtomicStore(&Input::Keyboard->AsyncPolling, 1);
+        for (int32 i = 0; i < Input::Gamepads.Count(); i++)
+            Platform::AtomicStore(&Input::Gamepads[i]->AsyncPolling, 1);
+        for (int32 i = 0; i < Input::CustomDevices.Count(); i++)
+            Platform::AtomicStore(&Input::CustomDevices[i]->AsyncPolling, 1);
+    }
+    DevicesLocker.Unlock();
+
+    // Capture this frame input for the replay
+    Replay::OnInputRecord(InputEvents);
+
     // Send gamepads change events
     if (GamepadsChanged)
     {
@@ -698,6 +860,7 @@ void InputService::Update()
         auto window = e.Target ? e.Target : defaultWindow;
         if (!window || !WindowsManager::Windows.Contains(window))
             continue;
+        LastEventTime = e.Timestamp;
         switch (e.Type)
         {
         // Keyboard events
@@ -754,6 +917,7 @@ void InputService::Update()
     // Send input events
     for (const auto& e : InputEvents)
     {
+        LastEventTime = e.Timestamp;
         switch (e.Type)
         {
         // Keyboard events
@@ -1002,6 +1166,9 @@ void InputService::Update()
 
 void InputService::Dispose()
 {
+    // Stop the dedicated polling thread
+    Input::SetDevicePollingRate(0);
+
     // Dispose input devices
     if (Input::Mouse)
     {
@@ -65,6 +65,32 @@ API_CLASS(Static) class FLAXENGINE_API Input
     /// </summary>
     static Array<InputDevice*, InlinedAllocation<16>> CustomDevices;
 
+    /// <summary>
+    /// Locks the input devices collections (Gamepads, CustomDevices). Platform layers must hold this lock when adding or removing devices (eg. gamepad hot-plug) so the dedicated input polling thread never observes the collections mid-mutation.
+    /// </summary>
+    static void LockDevices();
+
+    /// <summary>
+    /// Unlocks the input devices collections locked via LockDevices.
+    /// </summary>
+    static void UnlockDevices();
+
+public:
+    /// <summary>
+    /// Gets the input devices polling rate (in Hz) used by the dedicated input thread. Zero means the devices are polled on the main thread once per frame (default).
+    /// </summary>
+    API_PROPERTY() static int32 GetDevicePollingRate();
+
+    /// <summary>
+    /// Sets the input devices polling rate (in Hz) for the dedicated input thread. When non-zero, the device state polling runs off the main thread at the given frequency and the timestamped events are delivered to the main thread in per-frame batches, keeping the main thread cost constant regardless of the device rate. Use 0 to poll on the main thread once per frame (default).
+    /// </summary>
+    API_PROPERTY() static void SetDevicePollingRate(int32 rate);
+
+    /// <summary>
+    /// Gets the timestamp of the most recently dispatched input event (in seconds, via Platform::GetTimeSeconds clock). Can be called inside the input events (eg. KeyDown) to get the sub-frame accurate hardware input time (eg. for rhythm games). Returns the input update begin time if no event has been dispatched during the current frame.
+    /// </summary>
+    API_PROPERTY() static double GetLastEventTime();
+
 public:
     typedef Delegate<Char> CharDelegate;
     typedef Delegate<KeyboardKeys> KeyboardDelegate;
@@ -4,6 +4,7 @@
 
 #include "Engine/Core/Math/Vector2.h"
 #include "Engine/Core/Collections/Array.h"
+#include "Engine/Platform/CriticalSection.h"
 #include "Engine/Scripting/ScriptingObject.h"
 #include "Enums.h"
 #include "KeyboardKeys.h"
@@ -36,6 +37,9 @@ public:
         EventType Type;
         Window* Target;
 
+        // The event capture time (in seconds, via Platform::GetTimeSeconds clock). Allows sub-frame input timing as events are timestamped when the hardware input occurs, not when the frame consumes the batch.
+        double Timestamp;
+
         union
         {
             struct
@@ -90,6 +94,16 @@ protected:
     }
 
 public:
+    /// <summary>
+    /// The events queue locker. Guards the pending events so the hardware input can be enqueued from the dedicated device polling thread while the main thread consumes the per-frame batch.
+    /// </summary>
+    CriticalSection Locker;
+
+    /// <summary>
+    /// Non-zero when the device state polling runs on the dedicated input thread (see Input::DevicePollingRate). The main thread skips polling then and only drains the events batch.
+    /// </summary>
+    volatile int64 AsyncPolling = 0;
+
     /// <summary>
     /// Gets the name.
     /// </summary>
@@ -103,7 +117,19 @@ public:
     /// </summary>
     virtual void ResetState()
     {
+        Locker.Lock();
+        _queue.Clear();
+        Locker.Unlock();
+    }
+
+    /// <summary>
+    /// Removes all the pending events from the queue (preserves the device state). Used to drop the local hardware input when feeding the captured events back during the replay playback.
+    /// </summary>
+    void ClearQueue()
+    {
+        Locker.Lock();
         _queue.Clear();
+        Locker.Unlock();
     }
 
     /// <summary>
@@ -113,10 +139,12 @@ public:
     /// <returns>True if device has been disconnected, otherwise false.</returns>
     virtual bool Update(EventQueue& queue)
     {
-        if (UpdateState())
+        if (Platform::AtomicRead(&AsyncPolling) == 0 && UpdateState())
             return true;
+        Locker.Lock();
         queue.Add(_queue);
         _queue.Clear();
+        Locker.Unlock();
         return false;
     }
 
@@ -473,7 +473,20 @@ bool Actor::HasTag(const StringView& tag) const
 
 void Actor::AddTag(const Tag& tag)
 {
-    Tags.AddUnique(tag);
+    if (!Tags.Contains(tag))
+    {
+        Tags.Add(tag);
+        if (IsDuringPlay())
+            Level::onActorTagAdded(this, tag);
+    }
+}
+
+void Actor::RemoveTag(const Tag& tag)
+{
+    if (Tags.Remove(tag))
+        return;
+    if (IsDuringPlay())
+        Level::onActorTagRemoved(this, tag);
 }
 
 PRAGMA_DISABLE_DEPRECATION_WARNINGS
@@ -486,7 +499,18 @@ const String& Actor::GetTag() const
 void Actor::SetTag(const StringView& value)
 {
     const Tag tag = Tags::Get(value);
-    Tags.Set(&tag, 1);
+    if (IsDuringPlay())
+    {
+        // Keep the actors index valid
+        for (const Tag& e : Tags)
+            Level::onActorTagRemoved(this, e);
+        Tags.Set(&tag, 1);
+        Level::onActorTagAdded(this, tag);
+    }
+    else
+    {
+        Tags.Set(&tag, 1);
+    }
 }
 
 PRAGMA_ENABLE_DEPRECATION_WARNINGS
@@ -496,7 +520,10 @@ void Actor::SetLayer(int32 layerIndex)
     layerIndex = Math::Clamp(layerIndex, 0, 31);
     if (layerIndex == _layer)
         return;
+    const int32 previousLayer = _layer;
     _layer = layerIndex;
+    if (IsDuringPlay())
+        Level::onActorLayerChanged(this, previousLayer);
     OnLayerChanged();
 }
 
@@ -801,12 +828,29 @@ void Actor::Initialize()
 }
 
 void Actor::BeginPlay(SceneBeginData* data)
+{
+    BeginPlaySelf(data);
+
+    // Update children
+    for (int32 i = 0; i < Children.Count(); i++)
+    {
+        if (!Children[i]->IsDuringPlay())
+            Children[i]->BeginPlay(data);
+    }
+
+    BeginPlayEnable();
+}
+
+void Actor::BeginPlaySelf(SceneBeginData* data)
 {
     ASSERT(!IsDuringPlay());
 
     // Set flag
     Flags |= ObjectFlags::IsDuringPlay;
 
+    // Register in the actors index (tag/layer queries)
+    Level::onActorAdded(this);
+
     OnBeginPlay();
 
     // Update scripts
@@ -815,14 +859,10 @@ void Actor::BeginPlay(SceneBeginData* data)
         if (!Scripts[i]->IsDuringPlay())
             Scripts[i]->BeginPlay(data);
     }
+}
 
-    // Update children
-    for (int32 i = 0; i < Children.Count(); i++)
-    {
-        if (!Children[i]->IsDuringPlay())
-            Children[i]->BeginPlay(data);
-    }
-
+void Actor::BeginPlayEnable()
+{
     // Fire events for scripting
     if (IsActiveInHierarchy() && GetScene() && !_isEnabled)
     {
@@ -846,6 +886,9 @@ void Actor::EndPlay()
     // Clear flag
     Flags &= ~ObjectFlags::IsDuringPlay;
 
+    // Unregister from the actors index (tag/layer queries)
+    Level::onActorRemoved(this);
+
     // Call event deeper
     for (int32 i = 0; i < Children.Count(); i++)
     {
@@ -977,11 +1020,14 @@ void Actor::Deserialize(DeserializeStream& stream, ISerializeModifier* modifier)
                 }
                 else
                 {
+                    // Scene objects can deserialize on multiple threads at once during loading so guard the hierarchy changes
+                    Level::ScenesLock.Lock();
                     if (_parent)
                         _parent->Children.RemoveKeepOrder(this);
                     _parent = parent;
                     if (_parent)
                         _parent->Children.Add(this);
+                    Level::ScenesLock.Unlock();
                     OnParentChanged();
                 }
             }
@@ -1098,6 +1144,7 @@ void Actor::OnTransformChanged()
 {
     ASSERT_LOW_LAYER(!_localTransform.IsNanOrInfinity());
 
+    const Transform prevTransform = _transform;
     if (_parent)
     {
         _parent->_transform.LocalToWorld(_localTransform, _transform);
@@ -1107,6 +1154,14 @@ void Actor::OnTransformChanged()
         _transform = _localTransform;
     }
 
+    // Prune the cascade when the world transform stays bit-identical (eg. reparenting with world position preserved or a redundant move) - children depend only on it and their unchanged local transforms so their results cannot change either
+    if (Platform::MemoryCompare(&prevTransform, &_transform, sizeof(Transform)) == 0)
+        return;
+
+    // Defer the children update to the once-per-frame batched pass (own transform stays up-to-date for read backs)
+    if (Level::DeferTransformPropagation && IsDuringPlay() && Level::deferTransformPropagation(this))
+        return;
+
     for (auto child : Children)
     {
         child->OnTransformChanged();
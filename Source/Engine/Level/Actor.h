@@ -136,6 +136,12 @@ public:
     /// <param name="tag">The tag to add.</param>
     API_FUNCTION() void AddTag(const Tag& tag);
 
+    /// <summary>
+    /// Removes a tag from the actor
+    /// </summary>
+    /// <param name="tag">The tag to remove.</param>
+    API_FUNCTION() void RemoveTag(const Tag& tag);
+
     /// <summary>
     /// Gets the name of the tag.
     /// [Deprecated in v1.5]
@@ -973,6 +979,17 @@ public:
     /// <returns>The scene rendering interface.</returns>
     SceneRendering* GetSceneRendering() const;
 
+    /// <summary>
+    /// Performs the BeginPlay for this actor and its scripts only (without the children). Used by the time-sliced scene activation which walks the hierarchy manually (paired with BeginPlayEnable).
+    /// </summary>
+    /// <param name="data">The initialization data (e.g. used to collect joints to link after begin).</param>
+    void BeginPlaySelf(SceneBeginData* data);
+
+    /// <summary>
+    /// Fires the OnEnable events once the actor and all of its children got the begin play called. Used by the time-sliced scene activation.
+    /// </summary>
+    void BeginPlayEnable();
+
 public:
     /// <summary>
     /// Set the physics world the controller is part of.
@@ -103,14 +103,17 @@ void AnimatedModel::PreInitSkinningData()
     GraphInstance.Invalidate();
     GraphInstance.RootTransform = skeleton.Nodes[0].LocalTransform;
 
-    // Setup bones transformations including bone offset matrix
+    // Setup bones transformations including bone offset matrix (gather the palette inputs into contiguous arrays for the batched multiply)
     Array<Matrix> identityMatrices; // TODO: use shared memory?
     identityMatrices.Resize(bonesCount, false);
+    _bonesScratch.Resize(bonesCount, false);
     for (int32 boneIndex = 0; boneIndex < bonesCount; boneIndex++)
     {
         auto& bone = skeleton.Bones[boneIndex];
-        identityMatrices[boneIndex] = bone.OffsetMatrix * GraphInstance.NodesPose[bone.NodeIndex];
+        _bonesScratch[boneIndex] = bone.OffsetMatrix;
+        identityMatrices[boneIndex] = GraphInstance.NodesPose[bone.NodeIndex];
     }
+    Matrix::MultiplyArray(_bonesScratch.Get(), identityMatrices.Get(), identityMatrices.Get(), bonesCount);
     _skinningData.SetData(identityMatrices.Get(), true);
 
     UpdateBounds();
@@ -126,8 +129,7 @@ void AnimatedModel::GetCurrentPose(Array<Matrix>& nodesTransformation, bool worl
     {
         Matrix world;
         _transform.GetWorld(world);
-        for (auto& m : nodesTransformation)
-            m = m * world;
+        Matrix::MultiplyArray(nodesTransformation.Get(), world, nodesTransformation.Get(), nodesTransformation.Count());
     }
 }
 
@@ -511,9 +513,24 @@ void AnimatedModel::OnActiveInTreeChanged()
     ModelInstanceActor::OnActiveInTreeChanged();
 }
 
+bool AnimatedModel::CalculateBoneBounds(BoundingBox& box) const
+{
+    if (GraphInstance.NodesPose.Count() == 0)
+        return false;
+
+    // Per-bone bounds estimated from positions
+    auto& skeleton = SkinnedModel->Skeleton;
+    const int32 bonesCount = skeleton.Bones.Count();
+    box = BoundingBox(GraphInstance.NodesPose[skeleton.Bones[0].NodeIndex].GetTranslation());
+    for (int32 boneIndex = 1; boneIndex < bonesCount; boneIndex++)
+        box.Merge(GraphInstance.NodesPose[skeleton.Bones[boneIndex].NodeIndex].GetTranslation());
+    return true;
+}
+
 void AnimatedModel::UpdateLocalBounds()
 {
     BoundingBox box;
+    _boundsRefitValid = false;
     if (CustomBounds.GetSize().LengthSquared() > 0.01f)
     {
         box = CustomBounds;
@@ -523,16 +540,7 @@ void AnimatedModel::UpdateLocalBounds()
         //box = SkinnedModel->GetBox(GraphInstance.RootTransform.GetWorld());
         //box = SkinnedModel->GetBox();
 
-        if (GraphInstance.NodesPose.Count() != 0)
-        {
-            // Per-bone bounds estimated from positions
-            auto& skeleton = SkinnedModel->Skeleton;
-            const int32 bonesCount = skeleton.Bones.Count();
-            box = BoundingBox(GraphInstance.NodesPose[skeleton.Bones[0].NodeIndex].GetTranslation());
-            for (int32 boneIndex = 1; boneIndex < bonesCount; boneIndex++)
-                box.Merge(GraphInstance.NodesPose[skeleton.Bones[boneIndex].NodeIndex].GetTranslation());
-        }
-        else
+        if (!CalculateBoneBounds(box))
         {
             box = SkinnedModel->GetBox();
         }
@@ -542,6 +550,12 @@ void AnimatedModel::UpdateLocalBounds()
         const Vector3 center = box.GetCenter();
         const Vector3 sizeHalf = Vector3::Max(box.GetSize() + modelBoxSize * 0.2f, modelBoxSize) * 0.5f;
         box = BoundingBox(center - sizeHalf, center + sizeHalf);
+
+        // The margin makes the bounds conservative so the pose can wander within a part of it before a refit is needed
+        const Vector3 refitSizeHalf = sizeHalf - modelBoxSize * 0.05f;
+        const BoundingBox refitBox(center - refitSizeHalf, center + refitSizeHalf);
+        _boundsRefitBox = refitBox;
+        _boundsRefitValid = true;
     }
     else
     {
@@ -560,6 +574,16 @@ void AnimatedModel::UpdateBounds()
         GetSceneRendering()->UpdateActor(this, _sceneRenderingKey);
 }
 
+void AnimatedModel::RefitBounds()
+{
+    // Skip the full bounds update (and the scene rendering actor update) while the pose stays inside the conservative
+    // part of the current local bounds - the world box keeps following the actor transform via OnTransformChanged
+    BoundingBox box;
+    if (_boundsRefitValid && SkinnedModel && SkinnedModel->IsLoaded() && CustomBounds.GetSize().LengthSquared() <= 0.01f && CalculateBoneBounds(box) && _boundsRefitBox.Contains(box) == ContainmentType::Contains)
+        return;
+    UpdateBounds();
+}
+
 void AnimatedModel::UpdateSockets()
 {
     for (int32 i = 0; i < Children.Count(); i++)
@@ -591,16 +615,24 @@ void AnimatedModel::OnAnimationUpdated_Async()
         const int32 bonesCount = skeleton.Bones.Count();
         Matrix3x4* output = (Matrix3x4*)_skinningData.Data.Get();
         ASSERT(_skinningData.Data.Count() == bonesCount * sizeof(Matrix3x4));
+
+        // Gather the palette inputs into a contiguous scratch (bone offsets first, gathered node poses second), then batch the multiply
+        _bonesScratch.Resize(bonesCount * 2, false);
+        Matrix* offsets = _bonesScratch.Get();
+        Matrix* matrices = offsets + bonesCount;
         for (int32 boneIndex = 0; boneIndex < bonesCount; boneIndex++)
         {
             auto& bone = skeleton.Bones[boneIndex];
-            Matrix matrix = bone.OffsetMatrix * GraphInstance.NodesPose[bone.NodeIndex];
-            output[boneIndex].SetMatrixTranspose(matrix);
+            offsets[boneIndex] = bone.OffsetMatrix;
+            matrices[boneIndex] = GraphInstance.NodesPose[bone.NodeIndex];
         }
+        Matrix::MultiplyArray(offsets, matrices, matrices, bonesCount);
+        for (int32 boneIndex = 0; boneIndex < bonesCount; boneIndex++)
+            output[boneIndex].SetMatrixTranspose(matrices[boneIndex]);
         _skinningData.OnDataChanged(!PerBoneMotionBlur);
     }
 
-    UpdateBounds();
+    RefitBounds();
     _blendShapes.Update(SkinnedModel.Get());
 }
 
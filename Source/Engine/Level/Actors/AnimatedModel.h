@@ -56,6 +56,8 @@ public:
 
 private:
     BoundingBox _boxLocal;
+    BoundingBox _boundsRefitBox;
+    bool _boundsRefitValid = false;
     GeometryDrawStateData _drawState;
     SkinnedMeshDrawData _skinningData;
     AnimationUpdateMode _actualMode;
@@ -64,6 +66,7 @@ private:
     uint64 _lastUpdateFrame;
     BlendShapesInstance _blendShapes;
     ScriptingObjectReference<AnimatedModel> _masterPose;
+    Array<Matrix> _bonesScratch; // Gathered bones palette inputs for the batched multiply (anim update thread only)
 
 public:
     /// <summary>
@@ -349,8 +352,10 @@ private:
     void SyncParameters();
 
     void Update();
+    bool CalculateBoneBounds(BoundingBox& box) const;
     void UpdateLocalBounds();
     void UpdateBounds();
+    void RefitBounds();
     void UpdateSockets();
     void OnAnimationUpdated_Async();
     void OnAnimationUpdated_Sync();
@@ -0,0 +1,211 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "HLODGroup.h"
+#include "Engine/Graphics/RenderTask.h"
+#include "Engine/Graphics/RenderTools.h"
+#include "Engine/Serialization/Serialization.h"
+#if USE_EDITOR
+#include "Engine/Core/Log.h"
+#include "Engine/Content/Content.h"
+#include "Engine/Content/Assets/MaterialBase.h"
+#include "Engine/ContentImporters/AssetsImportingManager.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Graphics/Models/ModelData.h"
+#include "Engine/Level/Scene/Scene.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+#endif
+
+HLODGroup::HLODGroup(const SpawnParams& params)
+    : StaticModel(params)
+{
+}
+
+void HLODGroup::UpdateSourceActors()
+{
+    const float groupRadius = (float)_sphere.Radius;
+    if (groupRadius <= ZeroTolerance)
+        return;
+    Array<Actor*> queue;
+    queue.Add(Children);
+    for (int32 i = 0; i < queue.Count(); i++)
+    {
+        Actor* child = queue[i];
+        if (dynamic_cast<HLODGroup*>(child))
+            continue; // Nested groups manage their own source models
+        if (auto* source = dynamic_cast<StaticModel*>(child))
+        {
+            // Hide the source model at the same screen size the group proxy shows up at (scaled by the relative bounds size)
+            source->SetDrawMinScreenSize(SwitchScreenSize * (float)source->GetSphere().Radius / groupRadius);
+        }
+        queue.Add(child->Children);
+    }
+}
+
+bool HLODGroup::IsProxyVisible(const RenderContext& renderContext) const
+{
+    const RenderView* lodView = renderContext.LodProxyView ? renderContext.LodProxyView : &renderContext.View;
+    const float screenRadiusSquared = RenderTools::ComputeBoundsScreenRadiusSquared(_sphere.Center - renderContext.View.Origin, (float)_sphere.Radius, *lodView) * renderContext.View.ModelLODDistanceFactorSqrt;
+    return Math::Square(SwitchScreenSize * 0.5f) >= screenRadiusSquared;
+}
+
+void HLODGroup::Draw(RenderContext& renderContext)
+{
+    // Skip Global SDF and Global Surface Atlas passes - the source models feed those at full quality
+    if (renderContext.View.Pass == DrawPass::GlobalSDF || renderContext.View.Pass == DrawPass::GlobalSurfaceAtlas)
+        return;
+    if (IsProxyVisible(renderContext))
+        StaticModel::Draw(renderContext);
+}
+
+void HLODGroup::Draw(RenderContextBatch& renderContextBatch)
+{
+    if (IsProxyVisible(renderContextBatch.GetMainContext()))
+        StaticModel::Draw(renderContextBatch);
+}
+
+void HLODGroup::Serialize(SerializeStream& stream, const void* otherObj)
+{
+    // Base
+    StaticModel::Serialize(stream, otherObj);
+
+    SERIALIZE_GET_OTHER_OBJ(HLODGroup);
+
+    SERIALIZE(SwitchScreenSize);
+}
+
+void HLODGroup::Deserialize(DeserializeStream& stream, ISerializeModifier* modifier)
+{
+    // Base
+    StaticModel::Deserialize(stream, modifier);
+
+    DESERIALIZE(SwitchScreenSize);
+}
+
+void HLODGroup::OnEnable()
+{
+    // Base
+    StaticModel::OnEnable();
+
+    UpdateSourceActors();
+}
+
+#if USE_EDITOR
+
+bool HLODGroup::BuildProxy()
+{
+    PROFILE_CPU();
+    auto* scene = GetScene();
+    if (!scene)
+    {
+        LOG(Warning, "Cannot build HLOD proxy for a group that is not added to a scene.");
+        return true;
+    }
+
+    // Collect the source models (nested groups build their own proxies)
+    Array<StaticModel*> sources;
+    Array<Actor*> queue;
+    queue.Add(Children);
+    for (int32 i = 0; i < queue.Count(); i++)
+    {
+        Actor* child = queue[i];
+        if (dynamic_cast<HLODGroup*>(child))
+            continue;
+        if (auto* source = dynamic_cast<StaticModel*>(child))
+        {
+            if (source->Model && !source->Model->WaitForLoaded() && source->Model->GetLODsCount() > 0)
+                sources.Add(source);
+        }
+        queue.Add(child->Children);
+    }
+    if (sources.IsEmpty())
+    {
+        LOG(Warning, "Cannot build HLOD proxy for a group without any static model children.");
+        return true;
+    }
+
+    // Merge the lowest LODs of the source models into a single mesh per unique material
+    ModelData modelData;
+    modelData.LODs.Resize(1);
+    auto& meshes = modelData.LODs[0].Meshes;
+    Dictionary<Guid, int32> materialToSlot;
+    Matrix groupToLocal, sourceToWorld, sourceToGroup;
+    GetWorldToLocalMatrix(groupToLocal);
+    for (StaticModel* source : sources)
+    {
+        auto model = source->Model.Get();
+        const int32 lodIndex = model->GetLODsCount() - 1;
+        auto& lod = model->LODs[lodIndex];
+        source->GetLocalToWorldMatrix(sourceToWorld);
+        Matrix::Multiply(sourceToWorld, groupToLocal, sourceToGroup);
+        for (int32 meshIndex = 0; meshIndex < lod.Meshes.Count(); meshIndex++)
+        {
+            auto& mesh = lod.Meshes[meshIndex];
+            MaterialBase* material = source->GetMaterial(meshIndex, lodIndex);
+            const Guid materialId = material ? material->GetID() : Guid::Empty;
+
+            // Download the mesh geometry
+            BytesContainer vb0Data, vb1Data, ibData;
+            int32 vertexCount, vb1Count, indexCount;
+            if (mesh.DownloadDataCPU(MeshBufferType::Vertex0, vb0Data, vertexCount) ||
+                mesh.DownloadDataCPU(MeshBufferType::Vertex1, vb1Data, vb1Count) ||
+                mesh.DownloadDataCPU(MeshBufferType::Index, ibData, indexCount) ||
+                vertexCount != vb1Count)
+            {
+                LOG(Warning, "Failed to download mesh data from model {0} used by {1}.", model->ToString(), source->ToString());
+                return true;
+            }
+
+            // Find or add the proxy mesh for that material
+            int32 proxySlot;
+            if (!materialToSlot.TryGet(materialId, proxySlot))
+            {
+                proxySlot = modelData.Materials.Count();
+                auto& slot = modelData.Materials.AddOne();
+                slot.Name = String::Format(TEXT("Material {0}"), proxySlot);
+                slot.AssetID = materialId;
+                auto* proxyMesh = New<MeshData>();
+                proxyMesh->MaterialSlotIndex = proxySlot;
+                meshes.Add(proxyMesh);
+                materialToSlot.Add(materialId, proxySlot);
+            }
+
+            // Decode and append the mesh geometry (transformed into the group local space)
+            MeshData part;
+            part.InitFromModelVertices((VB0ElementType18*)vb0Data.Get(), (VB1ElementType18*)vb1Data.Get(), (uint32)vertexCount);
+            part.Indices.Resize(indexCount, false);
+            if (ibData.Length() / indexCount == sizeof(uint16))
+            {
+                auto ib16 = (const uint16*)ibData.Get();
+                for (int32 a = 0; a < indexCount; a++)
+                    part.Indices[a] = ib16[a];
+            }
+            else
+            {
+                Platform::MemoryCopy(part.Indices.Get(), ibData.Get(), indexCount * sizeof(uint32));
+            }
+            part.TransformBuffer(sourceToGroup);
+            meshes[proxySlot]->Merge(part);
+        }
+    }
+    modelData.CalculateLODsScreenSizes();
+
+    // Import the proxy model into the scene data folder (reuse the existing asset id to update it in-place)
+#if COMPILE_WITH_ASSETS_IMPORTER
+    Guid assetId = Model.GetID();
+    if (!assetId.IsValid())
+        assetId = Guid::New();
+    const String assetPath = scene->GetDataFolderPath() / String::Format(TEXT("HLOD_{0}"), GetID()) + ASSET_FILES_EXTENSION_WITH_DOT;
+    if (AssetsImportingManager::Create(AssetsImportingManager::CreateModelTag, assetPath, assetId, &modelData))
+    {
+        LOG(Warning, "Failed to import HLOD proxy model data.");
+        return true;
+    }
+    Model = Content::LoadAsync<::Model>(assetId);
+    UpdateSourceActors();
+    return false;
+#else
+    return true;
+#endif
+}
+
+#endif
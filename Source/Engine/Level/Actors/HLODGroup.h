@@ -0,0 +1,47 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "StaticModel.h"
+
+/// <summary>
+/// Renders a single merged proxy model instead of the child static models when viewed from far away (Hierarchical LOD). Reduces the draw calls count for distant scenery such as city blocks made of many small actors.
+/// </summary>
+API_CLASS(Attributes="ActorContextMenu(\"New/Other/HLOD Group\"), ActorToolbox(\"Other\")")
+class FLAXENGINE_API HLODGroup : public StaticModel
+{
+    DECLARE_SCENE_OBJECT(HLODGroup);
+public:
+    /// <summary>
+    /// The screen size to switch between the source models and the merged proxy model. When the group bounds take less space on the screen than this limit the proxy model is rendered instead of the source models.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(5), DefaultValue(0.1f), Limit(0, 10, 0.01f), EditorDisplay(\"HLOD\")")
+    float SwitchScreenSize = 0.1f;
+
+    /// <summary>
+    /// Updates the minimum draw screen size on the source models (all child static models) so they hide at the same distance the proxy model shows up. Called automatically when the group gets enabled.
+    /// </summary>
+    API_FUNCTION() void UpdateSourceActors();
+
+#if USE_EDITOR
+    /// <summary>
+    /// Builds the merged proxy model from the lowest LODs of the child static models (one mesh per unique material) and assigns it to this actor. The proxy model asset is saved into the scene data folder.
+    /// </summary>
+    /// <returns>True if failed, otherwise false.</returns>
+    API_FUNCTION() bool BuildProxy();
+#endif
+
+private:
+    bool IsProxyVisible(const RenderContext& renderContext) const;
+
+public:
+    // [StaticModel]
+    void Draw(RenderContext& renderContext) override;
+    void Draw(RenderContextBatch& renderContextBatch) override;
+    void Serialize(SerializeStream& stream, const void* otherObj) override;
+    void Deserialize(DeserializeStream& stream, ISerializeModifier* modifier) override;
+
+protected:
+    // [StaticModel]
+    void OnEnable() override;
+};
@@ -0,0 +1,34 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "OcclusionVolume.h"
+#include "Engine/Renderer/SoftwareOcclusionCulling.h"
+
+OcclusionVolume::OcclusionVolume(const SpawnParams& params)
+    : BoxVolume(params)
+{
+}
+
+void OcclusionVolume::OnEnable()
+{
+    SoftwareOcclusionCulling::AddOccluder(this);
+
+    // Base
+    Actor::OnEnable();
+}
+
+void OcclusionVolume::OnDisable()
+{
+    SoftwareOcclusionCulling::RemoveOccluder(this);
+
+    // Base
+    Actor::OnDisable();
+}
+
+#if USE_EDITOR
+
+Color OcclusionVolume::GetWiresColor()
+{
+    return Color::Gray;
+}
+
+#endif
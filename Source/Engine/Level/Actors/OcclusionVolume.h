@@ -0,0 +1,23 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "BoxVolume.h"
+
+/// <summary>
+/// A special type of volume that acts as an occluder proxy for the CPU occlusion culling. Place it inside large opaque geometry (eg. buildings or terrain walls) to skip drawing objects fully hidden behind it.
+/// </summary>
+API_CLASS(Attributes="ActorContextMenu(\"New/Other/Occlusion Volume\"), ActorToolbox(\"Other\")") class FLAXENGINE_API OcclusionVolume : public BoxVolume
+{
+    DECLARE_SCENE_OBJECT(OcclusionVolume);
+public:
+    // [Actor]
+    void OnEnable() override;
+    void OnDisable() override;
+
+protected:
+    // [BoxVolume]
+#if USE_EDITOR
+    Color GetWiresColor() override;
+#endif
+};
@@ -251,6 +251,28 @@ void Spline::GetSplineLocalPoints(Array<Transform>& points) const
         points.Add(e.Value);
 }
 
+void Spline::GetSplinePoints(const Span<float>& times, Array<Vector3>& points) const
+{
+    const int32 count = times.Length();
+    Array<Transform> transforms;
+    transforms.Resize(count, false);
+    Curve.EvaluateBatch(times, transforms.Get(), _loop);
+    points.Resize(count, false);
+    for (int32 i = 0; i < count; i++)
+        points.Get()[i] = _transform.LocalToWorld(transforms.Get()[i].Translation);
+}
+
+void Spline::GetSplineLocalPoints(const Span<float>& times, Array<Vector3>& points) const
+{
+    const int32 count = times.Length();
+    Array<Transform> transforms;
+    transforms.Resize(count, false);
+    Curve.EvaluateBatch(times, transforms.Get(), _loop);
+    points.Resize(count, false);
+    for (int32 i = 0; i < count; i++)
+        points.Get()[i] = transforms.Get()[i].Translation;
+}
+
 void Spline::ClearSpline()
 {
     if (Curve.IsEmpty())
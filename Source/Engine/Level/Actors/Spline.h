@@ -212,6 +212,20 @@ public:
     /// <param name="points">The result points collection.</param>
     API_FUNCTION() void GetSplineLocalPoints(API_PARAM(Out) Array<Transform>& points) const;
 
+    /// <summary>
+    /// Evaluates the spline curve at the given batch of times and calculates the point locations in 3D (world-space). Faster than sampling the points one at a time as the curve keyframes lookup is amortized over the whole batch (eg. when generating road or river geometry along the spline).
+    /// </summary>
+    /// <param name="times">The times to evaluate the spline at.</param>
+    /// <param name="points">The result points collection (world-space).</param>
+    API_FUNCTION() void GetSplinePoints(const Span<float>& times, API_PARAM(Out) Array<Vector3>& points) const;
+
+    /// <summary>
+    /// Evaluates the spline curve at the given batch of times and calculates the point locations in 3D (local-space). Faster than sampling the points one at a time as the curve keyframes lookup is amortized over the whole batch.
+    /// </summary>
+    /// <param name="times">The times to evaluate the spline at.</param>
+    /// <param name="points">The result points collection (local-space).</param>
+    API_FUNCTION() void GetSplineLocalPoints(const Span<float>& times, API_PARAM(Out) Array<Vector3>& points) const;
+
 public:
     /// <summary>
     /// Clears the spline to be empty.
@@ -7,6 +7,7 @@
 #include "Engine/Graphics/GPUContext.h"
 #include "Engine/Graphics/GPUDevice.h"
 #include "Engine/Graphics/RenderTask.h"
+#include "Engine/Graphics/RenderTools.h"
 #include "Engine/Serialization/Serialization.h"
 #include "Engine/Level/Prefabs/PrefabManager.h"
 #include "Engine/Level/Scene/Scene.h"
@@ -21,6 +22,7 @@ StaticModel::StaticModel(const SpawnParams& params)
     : ModelInstanceActor(params)
     , _scaleInLightmap(1.0f)
     , _boundsScale(1.0f)
+    , _drawMinScreenSize(0.0f)
     , _lodBias(0)
     , _forcedLod(-1)
     , _vertexColorsDirty(false)
@@ -62,6 +64,16 @@ void StaticModel::SetBoundsScale(float value)
     UpdateBounds();
 }
 
+float StaticModel::GetDrawMinScreenSize() const
+{
+    return _drawMinScreenSize;
+}
+
+void StaticModel::SetDrawMinScreenSize(float value)
+{
+    _drawMinScreenSize = Math::Max(value, 0.0f);
+}
+
 int32 StaticModel::GetLODBias() const
 {
     return _lodBias;
@@ -328,6 +340,14 @@ void StaticModel::Draw(RenderContext& renderContext)
             GlobalSurfaceAtlasPass::Instance()->RasterizeActor(this, this, _sphere, _transform, Model->LODs.Last().GetBox());
         return;
     }
+    if (_drawMinScreenSize > ZeroTolerance)
+    {
+        // Cull the model if it takes too little space on the screen (eg. source model hidden by the HLOD group proxy)
+        const RenderView* lodView = renderContext.LodProxyView ? renderContext.LodProxyView : &renderContext.View;
+        const float screenRadiusSquared = RenderTools::ComputeBoundsScreenRadiusSquared(_sphere.Center - renderContext.View.Origin, (float)_sphere.Radius, *lodView) * renderContext.View.ModelLODDistanceFactorSqrt;
+        if (Math::Square(_drawMinScreenSize * 0.5f) > screenRadiusSquared)
+            return;
+    }
     Matrix world;
     const Float3 translation = _transform.Translation - renderContext.View.Origin;
     Matrix::Transformation(_transform.Scale, _transform.Orientation, translation, world);
@@ -361,6 +381,14 @@ void StaticModel::Draw(RenderContextBatch& renderContextBatch)
     if (!Model || !Model->IsLoaded())
         return;
     const RenderContext& renderContext = renderContextBatch.GetMainContext();
+    if (_drawMinScreenSize > ZeroTolerance)
+    {
+        // Cull the model if it takes too little space on the screen (eg. source model hidden by the HLOD group proxy)
+        const RenderView* lodView = renderContext.LodProxyView ? renderContext.LodProxyView : &renderContext.View;
+        const float screenRadiusSquared = RenderTools::ComputeBoundsScreenRadiusSquared(_sphere.Center - renderContext.View.Origin, (float)_sphere.Radius, *lodView) * renderContext.View.ModelLODDistanceFactorSqrt;
+        if (Math::Square(_drawMinScreenSize * 0.5f) > screenRadiusSquared)
+            return;
+    }
     Matrix world;
     const Float3 translation = _transform.Translation - renderContext.View.Origin;
     Matrix::Transformation(_transform.Scale, _transform.Orientation, translation, world);
@@ -411,6 +439,7 @@ void StaticModel::Serialize(SerializeStream& stream, const void* otherObj)
 
     SERIALIZE_MEMBER(ScaleInLightmap, _scaleInLightmap);
     SERIALIZE_MEMBER(BoundsScale, _boundsScale);
+    SERIALIZE_MEMBER(DrawMinScreenSize, _drawMinScreenSize);
     SERIALIZE(Model);
     SERIALIZE_MEMBER(LODBias, _lodBias);
     SERIALIZE_MEMBER(ForcedLOD, _forcedLod);
@@ -463,6 +492,7 @@ void StaticModel::Deserialize(DeserializeStream& stream, ISerializeModifier* mod
 
     DESERIALIZE_MEMBER(ScaleInLightmap, _scaleInLightmap);
     DESERIALIZE_MEMBER(BoundsScale, _boundsScale);
+    DESERIALIZE_MEMBER(DrawMinScreenSize, _drawMinScreenSize);
     DESERIALIZE(Model);
     DESERIALIZE_MEMBER(LODBias, _lodBias);
     DESERIALIZE_MEMBER(ForcedLOD, _forcedLod);
@@ -17,6 +17,7 @@ private:
     GeometryDrawStateData _drawState;
     float _scaleInLightmap;
     float _boundsScale;
+    float _drawMinScreenSize;
     char _lodBias;
     char _forcedLod;
     bool _vertexColorsDirty;
@@ -83,6 +84,17 @@ public:
     /// </summary>
     API_PROPERTY() void SetLODBias(int32 value);
 
+    /// <summary>
+    /// Gets the minimum screen size to draw this model (the bottom limit). Used to cull small objects at far distances (eg. set by the HLOD group to hide the source models when the merged proxy shows up). Set to 0 to disable.
+    /// </summary>
+    API_PROPERTY(Attributes="EditorOrder(45), DefaultValue(0.0f), Limit(0, 10, 0.01f), EditorDisplay(\"Model\", \"Draw Min Screen Size\")")
+    float GetDrawMinScreenSize() const;
+
+    /// <summary>
+    /// Sets the minimum screen size to draw this model (the bottom limit). Used to cull small objects at far distances (eg. set by the HLOD group to hide the source models when the merged proxy shows up). Set to 0 to disable.
+    /// </summary>
+    API_PROPERTY() void SetDrawMinScreenSize(float value);
+
     /// <summary>
     /// Gets the model forced Level Of Detail index. Allows to bind the given model LOD to show. Value -1 disables this feature.
     /// </summary>
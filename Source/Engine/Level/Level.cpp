@@ -10,6 +10,7 @@
 #include "Engine/Core/Cache.h"
 #include "Engine/Core/Collections/CollectionPoolCache.h"
 #include "Engine/Core/ObjectsRemovalService.h"
+#include "Engine/Core/Collections/HashSet.h"
 #include "Engine/Core/Config/LayersTagsSettings.h"
 #include "Engine/Core/Types/LayersMask.h"
 #include "Engine/Debug/Exceptions/ArgumentException.h"
@@ -18,6 +19,7 @@
 #include "Engine/Debug/Exceptions/JsonParseException.h"
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Threading/Threading.h"
+#include "Engine/Threading/JobSystem.h"
 #include "Engine/Platform/File.h"
 #include "Engine/Platform/FileSystem.h"
 #include "Engine/Profiler/ProfilerCPU.h"
@@ -33,6 +35,7 @@
 #include "Engine/Serialization/Serialization.h"
 #include "Engine/Serialization/JsonWriters.h"
 #include "Prefabs/Prefab.h"
+#include <ThirdParty/LZ4/lz4.h>
 #if USE_EDITOR
 #include "Editor/Editor.h"
 #include "Engine/Platform/MessageBox.h"
@@ -108,12 +111,43 @@ namespace LevelImpl
     Array<SceneAction*> _sceneActions;
     CriticalSection _sceneActionsLocker;
     DateTime _lastSceneLoadTime(0);
+
+    // Compressed state blob of an unloaded scene that is likely to come back soon (see Level::HibernateScene)
+    struct HibernatedScene
+    {
+        Guid ID;
+        String Name;
+        int32 OriginalSize;
+        Array<byte> Data;
+    };
+
+    Array<HibernatedScene> _hibernatedScenes;
 #if USE_EDITOR
     Array<ScriptsReloadObject> ScriptsReloadObjects;
 #endif
 
     void CallSceneEvent(SceneEventType eventType, Scene* scene, Guid sceneId);
 
+    // Time-sliced scene activation state (walks the actors hierarchy parents-first with a per-frame time budget)
+    struct SceneActivation
+    {
+        struct StackFrame
+        {
+            Actor* Node;
+            int32 ChildIndex; // -1 when the actor itself hasn't begun play yet
+        };
+
+        Scene* TargetScene;
+        Guid SceneId;
+        SceneBeginData BeginData;
+        Array<StackFrame> Stack;
+    };
+
+    Array<SceneActivation*> _sceneActivations;
+
+    void updateSceneActivations();
+    void flushSceneActivations(Scene* scene);
+
     void flushActions();
     bool unloadScene(Scene* scene);
     bool unloadScenes();
@@ -146,6 +180,8 @@ LevelService LevelServiceInstanceService;
 CriticalSection Level::ScenesLock;
 Array<Scene*> Level::Scenes;
 bool Level::TickEnabled = true;
+float Level::SceneActivationTimeBudget = 0.0f;
+bool Level::DeferTransformPropagation = false;
 Delegate<Actor*> Level::ActorSpawned;
 Delegate<Actor*> Level::ActorDeleted;
 Delegate<Actor*, Actor*> Level::ActorParentChanged;
@@ -246,6 +282,9 @@ void LevelService::Update()
 {
     PROFILE_CPU_NAMED("Level::Update");
 
+    // Continue the pending time-sliced scene activations
+    updateSceneActivations();
+
     ScopeLock lock(Level::ScenesLock);
     auto& scenes = Level::Scenes;
 
@@ -269,6 +308,9 @@ void LevelService::Update()
         }
     }
 #endif
+
+    // Batched transform propagation for the actors moved during the update ticks
+    Level::FlushTransformPropagation();
 }
 
 void LevelService::LateUpdate()
@@ -299,6 +341,9 @@ void LevelService::LateUpdate()
     }
 #endif
 
+    // Batched transform propagation for the actors moved during the late update ticks (before rendering uses the transforms)
+    Level::FlushTransformPropagation();
+
     // Flush actions
     flushActions();
 }
@@ -330,6 +375,9 @@ void LevelService::FixedUpdate()
         }
     }
 #endif
+
+    // Batched transform propagation for the actors moved during the fixed update ticks (before the physics simulation uses the transforms)
+    Level::FlushTransformPropagation();
 }
 
 void LevelService::Dispose()
@@ -338,6 +386,7 @@ void LevelService::Dispose()
 
     // Unload scenes
     unloadScenes();
+    _hibernatedScenes.Resize(0);
 
     // Ensure that all scenes and actors has been destroyed (we don't leak!)
     ASSERT(Level::Scenes.IsEmpty());
@@ -822,6 +871,122 @@ Array<Actor*> Level::FindActors(const Tag& tag, Actor* root)
     return result;
 }
 
+namespace LevelImpl
+{
+    // Actors index used by the tag/layer queries (maintained on actors add/remove so lookups don't walk the scene hierarchy)
+    CriticalSection _actorsIndexLocker;
+    Dictionary<Tag, Array<Actor*>> _actorsByTag;
+    Array<Actor*> _actorsByLayer[32];
+
+    // Actors with pending transform propagation to the children (see Level::DeferTransformPropagation)
+    Array<Actor*> _pendingTransforms;
+    bool _flushingTransforms = false;
+}
+
+Array<Actor*> Level::GetActorsByTag(const Tag& tag, int32 layerIndex)
+{
+    Array<Actor*> result;
+    ScopeLock lock(_actorsIndexLocker);
+    if (const Array<Actor*>* bucket = _actorsByTag.TryGet(tag))
+    {
+        if (layerIndex < 0)
+        {
+            result = *bucket;
+        }
+        else
+        {
+            // Intersect with the layer set (membership test via the actor layer is O(1) so iterate the tag bucket only)
+            for (Actor* actor : *bucket)
+            {
+                if (actor->GetLayer() == layerIndex)
+                    result.Add(actor);
+            }
+        }
+    }
+    return result;
+}
+
+Array<Actor*> Level::GetActorsByLayer(int32 layerIndex)
+{
+    Array<Actor*> result;
+    if (layerIndex >= 0 && layerIndex < 32)
+    {
+        ScopeLock lock(_actorsIndexLocker);
+        result = _actorsByLayer[layerIndex];
+    }
+    return result;
+}
+
+bool Level::deferTransformPropagation(Actor* actor)
+{
+    if (_flushingTransforms)
+        return false;
+
+    // Queue the actor for the batched children update (skip if it's already the most recently queued one - covers scripts moving the same actor multiple times per frame)
+    if (_pendingTransforms.IsEmpty() || _pendingTransforms.Last() != actor)
+        _pendingTransforms.Add(actor);
+    return true;
+}
+
+void Level::FlushTransformPropagation()
+{
+    if (_pendingTransforms.IsEmpty())
+        return;
+    PROFILE_CPU_NAMED("Level.FlushTransformPropagation");
+
+    // Cascade the pending changes through the children (repeated entries and already-propagated subtrees early-out via the unchanged-transform check)
+    _flushingTransforms = true;
+    for (int32 i = 0; i < _pendingTransforms.Count(); i++)
+    {
+        Actor* actor = _pendingTransforms[i];
+        for (int32 j = 0; j < actor->Children.Count(); j++)
+            actor->Children[j]->OnTransformChanged();
+    }
+    _pendingTransforms.Clear();
+    _flushingTransforms = false;
+}
+
+void Level::onActorAdded(Actor* actor)
+{
+    ScopeLock lock(_actorsIndexLocker);
+    for (const Tag& tag : actor->Tags)
+        _actorsByTag[tag].Add(actor);
+    _actorsByLayer[actor->GetLayer()].Add(actor);
+}
+
+void Level::onActorRemoved(Actor* actor)
+{
+    if (_pendingTransforms.HasItems())
+        _pendingTransforms.RemoveAll(actor);
+    ScopeLock lock(_actorsIndexLocker);
+    for (const Tag& tag : actor->Tags)
+    {
+        if (Array<Actor*>* bucket = _actorsByTag.TryGet(tag))
+            bucket->Remove(actor);
+    }
+    _actorsByLayer[actor->GetLayer()].Remove(actor);
+}
+
+void Level::onActorLayerChanged(Actor* actor, int32 previousLayer)
+{
+    ScopeLock lock(_actorsIndexLocker);
+    _actorsByLayer[previousLayer].Remove(actor);
+    _actorsByLayer[actor->GetLayer()].Add(actor);
+}
+
+void Level::onActorTagAdded(Actor* actor, const Tag& tag)
+{
+    ScopeLock lock(_actorsIndexLocker);
+    _actorsByTag[tag].Add(actor);
+}
+
+void Level::onActorTagRemoved(Actor* actor, const Tag& tag)
+{
+    ScopeLock lock(_actorsIndexLocker);
+    if (Array<Actor*>* bucket = _actorsByTag.TryGet(tag))
+        bucket->Remove(actor);
+}
+
 void Level::callActorEvent(ActorEventType eventType, Actor* a, Actor* b)
 {
     PROFILE_CPU();
@@ -855,6 +1020,95 @@ void Level::callActorEvent(ActorEventType eventType, Actor* a, Actor* b)
     }
 }
 
+namespace LevelImpl
+{
+    // Performs a single step of the time-sliced scene activation. Returns true when the whole scene is active.
+    bool stepSceneActivation(SceneActivation* activation)
+    {
+        if (activation->Stack.IsEmpty())
+            return true;
+        auto& frame = activation->Stack.Last();
+        if (frame.ChildIndex == -1)
+        {
+            // Begin play of the actor and its scripts (before any children)
+            frame.ChildIndex = 0;
+            if (!frame.Node->IsDuringPlay())
+                frame.Node->BeginPlaySelf(&activation->BeginData);
+        }
+        else if (frame.ChildIndex < frame.Node->Children.Count())
+        {
+            // Queue the next child subtree
+            Actor* child = frame.Node->Children[frame.ChildIndex++];
+            if (!child->IsDuringPlay())
+            {
+                SceneActivation::StackFrame childFrame;
+                childFrame.Node = child;
+                childFrame.ChildIndex = -1;
+                activation->Stack.Add(childFrame);
+            }
+        }
+        else
+        {
+            // Enable the actor once its whole subtree has begun play
+            frame.Node->BeginPlayEnable();
+            activation->Stack.RemoveLast();
+        }
+        return activation->Stack.IsEmpty();
+    }
+}
+
+void LevelImpl::updateSceneActivations()
+{
+    if (_sceneActivations.IsEmpty())
+        return;
+    PROFILE_CPU_NAMED("Level.SceneActivation");
+    Scene* finishedScene = nullptr;
+    Guid finishedSceneId;
+    {
+        ScopeLock lock(Level::ScenesLock);
+        SceneActivation* activation = _sceneActivations.First();
+        const double timeBudget = (double)Math::Max(Level::SceneActivationTimeBudget, 0.1f) * 0.001;
+        const double endTime = Platform::GetTimeSeconds() + timeBudget;
+        while (!stepSceneActivation(activation))
+        {
+            if (Platform::GetTimeSeconds() >= endTime)
+                return;
+        }
+
+        // Link the collected joints and finish the activation
+        activation->BeginData.OnDone();
+        finishedScene = activation->TargetScene;
+        finishedSceneId = activation->SceneId;
+        _sceneActivations.RemoveAtKeepOrder(0);
+        Delete(activation);
+    }
+
+    // Fire event
+    CallSceneEvent(SceneEventType::OnSceneLoaded, finishedScene, finishedSceneId);
+}
+
+void LevelImpl::flushSceneActivations(Scene* scene)
+{
+    ScopeLock lock(Level::ScenesLock);
+    for (int32 i = 0; i < _sceneActivations.Count(); i++)
+    {
+        SceneActivation* activation = _sceneActivations[i];
+        if (scene && activation->TargetScene != scene)
+            continue;
+
+        // Finish the activation in a single burst (eg. the scene gets unloaded while still activating)
+        while (!stepSceneActivation(activation))
+        {
+        }
+        activation->BeginData.OnDone();
+        Scene* finishedScene = activation->TargetScene;
+        const Guid finishedSceneId = activation->SceneId;
+        _sceneActivations.RemoveAtKeepOrder(i--);
+        Delete(activation);
+        CallSceneEvent(SceneEventType::OnSceneLoaded, finishedScene, finishedSceneId);
+    }
+}
+
 void LevelImpl::flushActions()
 {
     ScopeLock lock(_sceneActionsLocker);
@@ -878,6 +1132,9 @@ bool LevelImpl::unloadScene(Scene* scene)
 
     PROFILE_CPU_NAMED("Level.UnloadScene");
 
+    // Make sure the scene is fully active before unloading (time-sliced activation could be still pending)
+    flushSceneActivations(scene);
+
     // Fire event
     CallSceneEvent(SceneEventType::OnSceneUnloading, scene, sceneId);
 
@@ -954,6 +1211,159 @@ bool Level::loadScene(JsonAsset* sceneAsset)
     return loadScene(*sceneAsset->Data, sceneAsset->DataEngineBuild);
 }
 
+namespace
+{
+    struct SceneJsonRange
+    {
+        int32 Start;
+        int32 End;
+    };
+
+    FORCE_INLINE void SkipJsonWhitespace(const char* text, int32 length, int32& i)
+    {
+        while (i < length && (text[i] == ' ' || text[i] == '\t' || text[i] == '\r' || text[i] == '\n'))
+            i++;
+    }
+
+    // Skips a single json value (object, array, string or scalar). Assumes a valid json input, returns false on a broken structure.
+    bool SkipJsonValue(const char* text, int32 length, int32& i)
+    {
+        int32 depth = 0;
+        bool inString = false;
+        for (; i < length; i++)
+        {
+            const char c = text[i];
+            if (inString)
+            {
+                if (c == '\\')
+                    i++;
+                else if (c == '\"')
+                {
+                    inString = false;
+                    if (depth == 0)
+                    {
+                        i++;
+                        return true;
+                    }
+                }
+            }
+            else if (c == '\"')
+                inString = true;
+            else if (c == '{' || c == '[')
+                depth++;
+            else if (c == '}' || c == ']')
+            {
+                if (depth == 0)
+                    return true; // End of the enclosing scope (scalar value ended before)
+                depth--;
+                if (depth == 0)
+                {
+                    i++;
+                    return true;
+                }
+            }
+            else if (depth == 0 && (c == ',' || c == ' ' || c == '\t' || c == '\r' || c == '\n'))
+                return true; // End of a scalar value
+        }
+        return depth == 0 && !inString;
+    }
+
+    // Scans the scene json text to index the byte ranges of the objects in the Data array (and peek the saved engine build) without building a DOM. Returns false if the text layout doesn't match the scene file format.
+    bool ScanSceneDataChunks(const char* text, int32 length, Array<SceneJsonRange>& objectRanges, int32& engineBuild)
+    {
+        int32 i = 0;
+        bool hasData = false;
+        SkipJsonWhitespace(text, length, i);
+        if (i >= length || text[i] != '{')
+            return false;
+        i++;
+        while (i < length)
+        {
+            SkipJsonWhitespace(text, length, i);
+            if (i >= length)
+                return false;
+            if (text[i] == '}')
+                return hasData;
+            if (text[i] == ',')
+            {
+                i++;
+                continue;
+            }
+            if (text[i] != '\"')
+                return false;
+
+            // Read member key
+            const int32 keyStart = ++i;
+            while (i < length && text[i] != '\"')
+            {
+                if (text[i] == '\\')
+                    i++;
+                i++;
+            }
+            if (i >= length)
+                return false;
+            const int32 keyLength = i - keyStart;
+            i++;
+            SkipJsonWhitespace(text, length, i);
+            if (i >= length || text[i] != ':')
+                return false;
+            i++;
+            SkipJsonWhitespace(text, length, i);
+            if (i >= length)
+                return false;
+
+            if (keyLength == 4 && Platform::MemoryCompare(text + keyStart, "Data", 4) == 0)
+            {
+                // Index the ranges of the top-level array elements
+                if (text[i] != '[')
+                    return false;
+                i++;
+                while (i < length && !hasData)
+                {
+                    SkipJsonWhitespace(text, length, i);
+                    if (i >= length)
+                        return false;
+                    if (text[i] == ']')
+                    {
+                        i++;
+                        hasData = true;
+                        break;
+                    }
+                    if (text[i] == ',')
+                    {
+                        i++;
+                        continue;
+                    }
+                    const int32 start = i;
+                    if (!SkipJsonValue(text, length, i))
+                        return false;
+                    objectRanges.Add({ start, i });
+                }
+                if (!hasData)
+                    return false;
+            }
+            else
+            {
+                const bool isEngineBuild = keyLength == 11 && Platform::MemoryCompare(text + keyStart, "EngineBuild", 11) == 0;
+                const int32 valueStart = i;
+                if (!SkipJsonValue(text, length, i))
+                    return false;
+                if (isEngineBuild)
+                {
+                    engineBuild = 0;
+                    for (int32 k = valueStart; k < i; k++)
+                    {
+                        const char c = text[k];
+                        if (c >= '0' && c <= '9')
+                            engineBuild = engineBuild * 10 + (c - '0');
+                    }
+                }
+            }
+        }
+        return false;
+    }
+}
+
 bool Level::loadScene(const BytesContainer& sceneData, Scene** outScene)
 {
     if (sceneData.IsInvalid())
@@ -961,12 +1371,61 @@ bool Level::loadScene(const BytesContainer& sceneData, Scene** outScene)
         LOG(Error, "Missing scene data.");
         return true;
     }
+    const char* text = sceneData.Get<char>();
+    const int32 length = sceneData.Length();
+
+    // Large scene files are parsed in chunks spread over the Job System workers (json parsing takes the majority of the scene loading time)
+    const int32 MinObjectsForChunkedParse = 512;
+    Array<SceneJsonRange> objectRanges;
+    int32 engineBuild = 0;
+    if (ScanSceneDataChunks(text, length, objectRanges, engineBuild) && objectRanges.Count() >= MinObjectsForChunkedParse)
+    {
+        PROFILE_CPU_NAMED("Json.ParseChunked");
+        const int32 objectsCount = objectRanges.Count();
+        const int32 chunkSize = 256;
+        const int32 chunkCount = (objectsCount + chunkSize - 1) / chunkSize;
+        Array<rapidjson_flax::Document> chunks;
+        chunks.Resize(chunkCount);
+        Array<rapidjson_flax::Value*> objectsData;
+        objectsData.Resize(objectsCount);
+        volatile int64 errors = 0;
+        Function<void(int32)> job = [&](int32 chunkIndex)
+        {
+            PROFILE_CPU_NAMED("Json.Parse");
+            const int32 first = chunkIndex * chunkSize;
+            const int32 count = Math::Min(chunkSize, objectsCount - first);
+
+            // Wrap the consecutive source array elements back into a standalone json array for this chunk
+            const int32 rangeStart = objectRanges[first].Start;
+            const int32 rangeEnd = objectRanges[first + count - 1].End;
+            Array<char> chunkText;
+            chunkText.Resize(rangeEnd - rangeStart + 2);
+            chunkText[0] = '[';
+            Platform::MemoryCopy(chunkText.Get() + 1, text + rangeStart, rangeEnd - rangeStart);
+            chunkText[chunkText.Count() - 1] = ']';
+
+            // Parse this chunk into own DOM (strings are copied into the document so the chunk text is temporary)
+            auto& document = chunks[chunkIndex];
+            document.Parse(chunkText.Get(), chunkText.Count());
+            if (document.HasParseError() || !document.IsArray() || (int32)document.Size() != count)
+            {
+                Platform::InterlockedIncrement(&errors);
+                return;
+            }
+            for (int32 k = 0; k < count; k++)
+                objectsData[first + k] = &document[k];
+        };
+        JobSystem::Execute(job, chunkCount);
+        if (Platform::AtomicRead(&errors) == 0)
+            return loadScene(objectsData, engineBuild, outScene);
+        // On any chunk mismatch fall back to the single-threaded parse below for the proper error reporting
+    }
 
     // Parse scene JSON file
     rapidjson_flax::Document document;
     {
         PROFILE_CPU_NAMED("Json.Parse");
-        document.Parse(sceneData.Get<char>(), sceneData.Length());
+        document.Parse(text, length);
     }
     if (document.HasParseError())
     {
@@ -990,6 +1449,23 @@ bool Level::loadScene(rapidjson_flax::Document& document, Scene** outScene)
 }
 
 bool Level::loadScene(rapidjson_flax::Value& data, int32 engineBuild, Scene** outScene)
+{
+    if (!data.IsArray())
+    {
+        LOG(Error, "Invalid Data member.");
+        return true;
+    }
+
+    // Wrap the objects data into a list view (the chunked parsing path feeds objects from multiple documents)
+    Array<rapidjson_flax::Value*> objectsData;
+    objectsData.Resize((int32)data.Size());
+    for (int32 i = 0; i < objectsData.Count(); i++)
+        objectsData[i] = &data[i];
+
+    return loadScene(objectsData, engineBuild, outScene);
+}
+
+bool Level::loadScene(const Array<rapidjson_flax::Value*>& objectsData, int32 engineBuild, Scene** outScene)
 {
     PROFILE_CPU_NAMED("Level.LoadScene");
 
@@ -1023,15 +1499,15 @@ bool Level::loadScene(rapidjson_flax::Value& data, int32 engineBuild, Scene** ou
         LOG(Error, "Invalid serialized engine build.");
         return true;
     }
-    if (!data.IsArray())
+    if (objectsData.IsEmpty())
     {
         LOG(Error, "Invalid Data member.");
         return true;
     }
-    int32 objectsCount = data.Size();
+    int32 objectsCount = objectsData.Count();
 
     // Peek scene node value (it's the first actor serialized)
-    auto& sceneValue = data[0];
+    auto& sceneValue = *objectsData[0];
     auto sceneId = JsonTools::GetGuid(sceneValue, "ID");
     if (!sceneId.IsValid())
     {
@@ -1064,13 +1540,18 @@ bool Level::loadScene(rapidjson_flax::Value& data, int32 engineBuild, Scene** ou
     sceneObjects->At(0) = scene;
 
     SceneObjectsFactory::Context context(modifier.Value);
+    const DateTime spawnStart = DateTime::NowUTC();
+
+    // Preallocate the IDs mapping storage upfront to avoid rehash cycles while spawning objects (prefab instances map every object ID)
+    modifier->IdsMapping.EnsureCapacity(objectsCount);
+
     {
         PROFILE_CPU_NAMED("Spawn");
 
         // Spawn all scene objects
         for (int32 i = 1; i < objectsCount; i++) // start from 1. at index [0] was scene
         {
-            auto& stream = data[i];
+            auto& stream = *objectsData[i];
             auto obj = SceneObjectsFactory::Spawn(context, stream);
             sceneObjects->At(i) = obj;
             if (obj)
@@ -1080,8 +1561,9 @@ bool Level::loadScene(rapidjson_flax::Value& data, int32 engineBuild, Scene** ou
         }
     }
 
-    SceneObjectsFactory::PrefabSyncData prefabSyncData(*sceneObjects.Value, data, modifier.Value);
+    SceneObjectsFactory::PrefabSyncData prefabSyncData(*sceneObjects.Value, objectsData, modifier.Value);
 
+    const DateTime prefabsSyncStart = DateTime::NowUTC();
     SceneObjectsFactory::SetupPrefabInstances(context, prefabSyncData);
 
     // TODO: resave and force sync scenes during game cooking so this step could be skipped in game
@@ -1090,22 +1572,74 @@ bool Level::loadScene(rapidjson_flax::Value& data, int32 engineBuild, Scene** ou
     // /\ all above this has to be done on an any thread
     // \/ all below this has to be done on multiple threads at once
 
+    const DateTime deserializeStart = DateTime::NowUTC();
+    // Use the Job System for large scenes only (for small data sets the fork/join overhead exceeds the gain)
+    const bool async = objectsCount > 64;
     {
         PROFILE_CPU_NAMED("Deserialize");
 
-        // TODO: at this point we would probably spawn a few thread pool tasks which will load deserialize scene object but only if scene is big enough
-
         // Load all scene objects
         Scripting::ObjectsLookupIdMapping.Set(&modifier.Value->IdsMapping);
-        for (int32 i = 1; i < objectsCount; i++) // start from 1. at index [0] was scene
+        if (async)
         {
-            auto& objData = data[i];
-            auto obj = sceneObjects->At(i);
-            if (obj)
+            // Spread objects deserialization over the Job System workers (scene graph is relinked in a deterministic order below)
+            context.Async = true;
+            Function<void(int32)> job = [&objectsData, &context, &sceneObjects](int32 index)
+            {
+                auto& objData = *objectsData[index + 1]; // at index [0] was scene
+                SceneObject* obj = sceneObjects->At(index + 1);
+                if (!obj)
+                    return;
+                ISerializeModifier* modifier = context.GetModifier();
+                Scripting::ObjectsLookupIdMapping.Set(&modifier->IdsMapping);
                 SceneObjectsFactory::Deserialize(context, obj, objData);
+                Scripting::ObjectsLookupIdMapping.Set(nullptr);
+            };
+            JobSystem::Execute(job, objectsCount - 1);
+            context.Async = false;
+        }
+        else
+        {
+            for (int32 i = 1; i < objectsCount; i++) // start from 1. at index [0] was scene
+            {
+                auto& objData = *objectsData[i];
+                auto obj = sceneObjects->At(i);
+                if (obj)
+                    SceneObjectsFactory::Deserialize(context, obj, objData);
+            }
         }
         Scripting::ObjectsLookupIdMapping.Set(nullptr);
     }
+    if (async)
+    {
+        PROFILE_CPU_NAMED("Link");
+
+        // Relink children and scripts in the file order so the hierarchy matches the single-threaded loading (jobs can finish in any order)
+        HashSet<Actor*> sceneActors;
+        for (int32 i = 0; i < objectsCount; i++)
+        {
+            auto* actor = dynamic_cast<Actor*>(sceneObjects->At(i));
+            if (actor)
+            {
+                sceneActors.Add(actor);
+                actor->Children.Clear();
+                actor->Scripts.Clear();
+            }
+        }
+        for (int32 i = 1; i < objectsCount; i++)
+        {
+            SceneObject* obj = sceneObjects->At(i);
+            if (!obj)
+                continue;
+            Actor* parent = obj->GetParent();
+            if (!parent || !sceneActors.Contains(parent))
+                continue; // objects parented outside of this scene file got linked during deserialization
+            if (auto* actor = dynamic_cast<Actor*>(obj))
+                parent->Children.Add(actor);
+            else if (auto* script = dynamic_cast<Script*>(obj))
+                parent->Scripts.Add(script);
+        }
+    }
 
     // /\ all above this has to be done on multiple threads at once
     // \/ all below this has to be done on an any thread
@@ -1115,6 +1649,7 @@ bool Level::loadScene(rapidjson_flax::Value& data, int32 engineBuild, Scene** ou
     SceneObjectsFactory::SynchronizePrefabInstances(context, prefabSyncData);
 
     // Initialize scene objects
+    const DateTime initializeStart = DateTime::NowUTC();
     {
         PROFILE_CPU_NAMED("Initialize");
 
@@ -1146,20 +1681,44 @@ bool Level::loadScene(rapidjson_flax::Value& data, int32 engineBuild, Scene** ou
     // \/ all below this has to be done on a main thread
 
     // Link scene and call init
+    const DateTime beginPlayStart = DateTime::NowUTC();
     {
         PROFILE_CPU_NAMED("BeginPlay");
 
         ScopeLock lock(ScenesLock);
         Scenes.Add(scene);
-        SceneBeginData beginData;
-        scene->BeginPlay(&beginData);
-        beginData.OnDone();
+        if (Level::SceneActivationTimeBudget > 0.0f)
+        {
+            // Spread the actors activation over the next frames under the per-frame time budget (SceneLoaded event fires once the whole scene is active)
+            auto activation = New<SceneActivation>();
+            activation->TargetScene = scene;
+            activation->SceneId = sceneId;
+            SceneActivation::StackFrame rootFrame;
+            rootFrame.Node = scene;
+            rootFrame.ChildIndex = -1;
+            activation->Stack.Add(rootFrame);
+            _sceneActivations.Add(activation);
+        }
+        else
+        {
+            SceneBeginData beginData;
+            scene->BeginPlay(&beginData);
+            beginData.OnDone();
+        }
     }
 
-    // Fire event
-    CallSceneEvent(SceneEventType::OnSceneLoaded, scene, sceneId);
+    // Fire event (postponed until the activation end when using the time-sliced activation)
+    if (Level::SceneActivationTimeBudget <= 0.0f)
+        CallSceneEvent(SceneEventType::OnSceneLoaded, scene, sceneId);
 
-    LOG(Info, "Scene loaded in {0} ms", (int32)(DateTime::NowUTC() - startTime).GetTotalMilliseconds());
+    const DateTime endTime = DateTime::NowUTC();
+    LOG(Info, "Scene loaded in {0} ms (spawn: {1} ms, prefabs sync: {2} ms, deserialize: {3} ms, initialize: {4} ms, begin play: {5} ms)",
+        (int32)(endTime - startTime).GetTotalMilliseconds(),
+        (int32)(prefabsSyncStart - spawnStart).GetTotalMilliseconds(),
+        (int32)(deserializeStart - prefabsSyncStart).GetTotalMilliseconds(),
+        (int32)(initializeStart - deserializeStart).GetTotalMilliseconds(),
+        (int32)(beginPlayStart - initializeStart).GetTotalMilliseconds(),
+        (int32)(endTime - beginPlayStart).GetTotalMilliseconds());
     if (outScene)
         *outScene = scene;
     return false;
@@ -1447,6 +2006,134 @@ void Level::UnloadAllScenesAsync()
     _sceneActions.Enqueue(New<UnloadScenesAction>());
 }
 
+bool Level::HibernateScene(Scene* scene)
+{
+    CHECK_RETURN(scene, true);
+    ScopeLock lock(_sceneActionsLocker);
+    PROFILE_CPU_NAMED("Level.HibernateScene");
+    const DateTime startTime = DateTime::NowUTC();
+    const Guid sceneId = scene->GetID();
+    const String sceneName = scene->GetName();
+
+    // Serialize the scene state to compact json (in memory only, the scene asset file stays untouched)
+    rapidjson_flax::StringBuffer buffer;
+    if (saveScene(scene, buffer, false))
+    {
+        LOG(Error, "Failed to save scene \'{0}\' for hibernation.", sceneName);
+        CallSceneEvent(SceneEventType::OnSceneSaveError, scene, sceneId);
+        return true;
+    }
+
+    // Compress the state into the blob
+    const int32 srcSize = (int32)buffer.GetSize();
+    const int32 maxSize = LZ4_compressBound(srcSize);
+    HibernatedScene blob;
+    blob.ID = sceneId;
+    blob.Name = sceneName;
+    blob.OriginalSize = srcSize;
+    blob.Data.Resize(maxSize);
+    const int32 dstSize = LZ4_compress_default(buffer.GetString(), (char*)blob.Data.Get(), srcSize, maxSize);
+    if (dstSize <= 0)
+    {
+        LOG(Error, "Failed to compress scene \'{0}\' data for hibernation.", sceneName);
+        return true;
+    }
+    blob.Data.Resize(dstSize);
+
+    // Unload the scene (releases the scene objects and the GPU residency of its content)
+    if (unloadScene(scene))
+        return true;
+
+    // Keep a single blob per scene (replace the stale state if the scene was hibernated before)
+    for (int32 i = 0; i < _hibernatedScenes.Count(); i++)
+    {
+        if (_hibernatedScenes[i].ID == sceneId)
+        {
+            _hibernatedScenes.RemoveAt(i);
+            break;
+        }
+    }
+    _hibernatedScenes.Add(MoveTemp(blob));
+
+    LOG(Info, "Scene \'{0}\' hibernated ({1} kB compressed to {2} kB). Time {3} ms", sceneName, srcSize / 1024, dstSize / 1024, Math::CeilToInt(static_cast<float>((DateTime::NowUTC() - startTime).GetTotalMilliseconds())));
+    return false;
+}
+
+bool Level::IsSceneHibernated(const Guid& sceneId)
+{
+    ScopeLock lock(_sceneActionsLocker);
+    for (const HibernatedScene& e : _hibernatedScenes)
+    {
+        if (e.ID == sceneId)
+            return true;
+    }
+    return false;
+}
+
+Scene* Level::RestoreHibernatedScene(const Guid& sceneId)
+{
+    ScopeLock lock(_sceneActionsLocker);
+    PROFILE_CPU_NAMED("Level.RestoreHibernatedScene");
+    int32 index = -1;
+    for (int32 i = 0; i < _hibernatedScenes.Count(); i++)
+    {
+        if (_hibernatedScenes[i].ID == sceneId)
+        {
+            index = i;
+            break;
+        }
+    }
+    if (index == -1)
+    {
+        LOG(Error, "Missing hibernated scene {0}.", sceneId);
+        return nullptr;
+    }
+    const DateTime startTime = DateTime::NowUTC();
+    const HibernatedScene& blob = _hibernatedScenes[index];
+
+    // Decompress the state blob
+    Array<byte> data;
+    data.Resize(blob.OriginalSize);
+    const int32 size = LZ4_decompress_safe((const char*)blob.Data.Get(), (char*)data.Get(), blob.Data.Count(), blob.OriginalSize);
+    if (size != blob.OriginalSize)
+    {
+        LOG(Error, "Failed to decompress hibernated scene \'{0}\' data.", blob.Name);
+        _hibernatedScenes.RemoveAt(index);
+        return nullptr;
+    }
+
+    // Load the scene back
+    Scene* scene = nullptr;
+    BytesContainer bytes;
+    bytes.Link(data.Get(), data.Count());
+    if (loadScene(bytes, &scene))
+    {
+        LOG(Error, "Failed to deserialize hibernated scene \'{0}\'.", blob.Name);
+        CallSceneEvent(SceneEventType::OnSceneLoadError, nullptr, sceneId);
+        _hibernatedScenes.RemoveAt(index);
+        return nullptr;
+    }
+
+    LOG(Info, "Scene \'{0}\' restored from hibernation. Time {1} ms", blob.Name, Math::CeilToInt(static_cast<float>((DateTime::NowUTC() - startTime).GetTotalMilliseconds())));
+    _hibernatedScenes.RemoveAt(index);
+    return scene;
+}
+
+uint64 Level::GetHibernatedScenesMemoryUsage()
+{
+    ScopeLock lock(_sceneActionsLocker);
+    uint64 result = 0;
+    for (const HibernatedScene& e : _hibernatedScenes)
+        result += e.Data.Count();
+    return result;
+}
+
+void Level::ClearHibernatedScenes()
+{
+    ScopeLock lock(_sceneActionsLocker);
+    _hibernatedScenes.Resize(0);
+}
+
 #if USE_EDITOR
 
 void Level::ReloadScriptsAsync()
@@ -50,6 +50,21 @@ public:
     /// </summary>
     API_FIELD() static bool TickEnabled;
 
+    /// <summary>
+    /// The per-frame time budget (in milliseconds) used to spread the loaded scene activation (OnBeginPlay/OnEnable events) over multiple frames. Keeps the parents-before-children activation order and fires SceneLoaded once the whole scene is active. Use 0 to activate scenes in a single burst (default).
+    /// </summary>
+    API_FIELD() static float SceneActivationTimeBudget;
+
+    /// <summary>
+    /// If true, the transform changes of the playing actors propagate to the children in a single batched pass per frame (after the game ticks, before physics and rendering use them) instead of cascading through the whole subtree on every setter call. The moved actor own transform is always updated immediately; use FlushTransformPropagation to read back the descendants transforms within the same frame. Disabled by default (synchronous propagation).
+    /// </summary>
+    API_FIELD() static bool DeferTransformPropagation;
+
+    /// <summary>
+    /// Flushes the pending transform changes to the children of the moved actors (used with DeferTransformPropagation to read back up-to-date descendants transforms immediately).
+    /// </summary>
+    API_FUNCTION() static void FlushTransformPropagation();
+
 public:
     /// <summary>
     /// Occurs when new actor gets spawned to the game.
@@ -332,6 +347,38 @@ public:
     /// </summary>
     API_FUNCTION() static void UnloadAllScenesAsync();
 
+public:
+    /// <summary>
+    /// Hibernates the scene: serializes its state into a compressed in-memory blob and unloads it, releasing the live objects and the GPU residency. Use RestoreHibernatedScene to bring it back much faster than reloading from disk. Useful for the scenes that are likely to return soon (eg. a hub world). The original scene asset stays untouched.
+    /// </summary>
+    /// <param name="scene">The scene to hibernate.</param>
+    /// <returns>True if action cannot be done, otherwise false.</returns>
+    API_FUNCTION() static bool HibernateScene(Scene* scene);
+
+    /// <summary>
+    /// Checks if the scene with the given ID has a hibernated state blob (see HibernateScene).
+    /// </summary>
+    /// <param name="sceneId">The scene ID.</param>
+    /// <returns>True if the scene is hibernated, otherwise false.</returns>
+    API_FUNCTION() static bool IsSceneHibernated(const Guid& sceneId);
+
+    /// <summary>
+    /// Restores the hibernated scene: decompresses the cached state blob, loads the scene back and drops the blob.
+    /// </summary>
+    /// <param name="sceneId">The scene ID.</param>
+    /// <returns>The restored scene object, otherwise null if cannot load data (then see log for more information).</returns>
+    API_FUNCTION() static Scene* RestoreHibernatedScene(const Guid& sceneId);
+
+    /// <summary>
+    /// Gets the total amount of memory used by the hibernated scenes state blobs (in bytes).
+    /// </summary>
+    API_FUNCTION() static uint64 GetHibernatedScenesMemoryUsage();
+
+    /// <summary>
+    /// Drops all the hibernated scenes state blobs (without restoring the scenes).
+    /// </summary>
+    API_FUNCTION() static void ClearHibernatedScenes();
+
 #if USE_EDITOR
 
     /// <summary>
@@ -479,6 +526,33 @@ public:
     /// <returns>Found actors or empty if none.</returns>
     API_FUNCTION() static Array<Actor*> FindActors(const Tag& tag, Actor* root = nullptr);
 
+    /// <summary>
+    /// Gets all the actors with the given tag (exact match) from the loaded scenes. Uses the actors index maintained on actors add/remove so it's fast enough for frequent gameplay queries (unlike FindActors which walks the whole hierarchy). Use AddTag/RemoveTag to modify actor tags so the index stays valid.
+    /// </summary>
+    /// <param name="tag">The tag of the actors to get.</param>
+    /// <param name="layerIndex">The layer to filter the actors with (intersection of the tag and the layer sets), or -1 to return the actors from all layers.</param>
+    /// <returns>Found actors or empty if none.</returns>
+    API_FUNCTION() static Array<Actor*> GetActorsByTag(const Tag& tag, int32 layerIndex = -1);
+
+    /// <summary>
+    /// Gets all the actors placed on the given layer from the loaded scenes. Uses the actors index maintained on actors add/remove so it's fast enough for frequent gameplay queries.
+    /// </summary>
+    /// <param name="layerIndex">The layer index (0-31).</param>
+    /// <returns>Found actors or empty if none.</returns>
+    API_FUNCTION() static Array<Actor*> GetActorsByLayer(int32 layerIndex);
+
+private:
+    // Deferred transform propagation
+    static bool deferTransformPropagation(Actor* actor);
+
+private:
+    // Actors index (tag/layer lookup)
+    static void onActorAdded(Actor* actor);
+    static void onActorRemoved(Actor* actor);
+    static void onActorLayerChanged(Actor* actor, int32 previousLayer);
+    static void onActorTagAdded(Actor* actor, const Tag& tag);
+    static void onActorTagRemoved(Actor* actor, const Tag& tag);
+
 private:
     // Actor API
     enum class ActorEventType
@@ -498,4 +572,5 @@ private:
     static bool loadScene(const BytesContainer& sceneData, Scene** outScene = nullptr);
     static bool loadScene(rapidjson_flax::Document& document, Scene** outScene = nullptr);
     static bool loadScene(rapidjson_flax::Value& data, int32 engineBuild, Scene** outScene = nullptr);
+    static bool loadScene(const Array<rapidjson_flax::Value*>& objectsData, int32 engineBuild, Scene** outScene = nullptr);
 };
@@ -660,7 +660,7 @@ bool Prefab::ApplyAll(Actor* targetActor)
 
         // Assign references to the prefabs
         allPrefabs.EnsureCapacity(Math::RoundUpToPowerOf2(Math::Max(30, nestedPrefabIds.Count())));
-        const Dictionary<Guid, Asset*, HeapAllocation>& assetsRaw = Content::GetAssetsRaw();
+        const FlatDictionary<Guid, Asset*>& assetsRaw = Content::GetAssetsRaw();
         for (auto& e : assetsRaw)
         {
             if (e.Value->GetTypeHandle() == Prefab::TypeInitializer)
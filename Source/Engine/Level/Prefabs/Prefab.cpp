@@ -2,14 +2,14 @@
 
 #include "Prefab.h"
 #include "Engine/Serialization/JsonTools.h"
+#include "Engine/Content/Content.h"
 #include "Engine/Content/Factories/JsonAssetFactory.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Level/Prefabs/PrefabManager.h"
 #include "Engine/Level/Actor.h"
-#include "Engine/Threading/Threading.h"
-#if USE_EDITOR
+#include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Scripting/Scripting.h"
-#endif
+#include "Engine/Threading/Threading.h"
 
 REGISTER_JSON_ASSET(Prefab, "FlaxEngine.Prefab", true);
 
@@ -70,6 +70,157 @@ SceneObject* Prefab::GetDefaultInstance(const Guid& objectId)
     return result;
 }
 
+void Prefab::BuildSpawnTable()
+{
+    ScopeLock lock(Locker);
+    if (SpawnTable.HasItems() || !IsLoaded())
+        return;
+    PROFILE_CPU();
+    const auto& data = *Data;
+    SpawnTable.Resize(ObjectsCount);
+    for (int32 i = 0; i < ObjectsCount; i++)
+    {
+        SpawnEntry& e = SpawnTable[i];
+        e.Id = ObjectsIds[i];
+
+        // Walk down the nested prefabs chain to the object type data
+        const ISerializable::DeserializeStream* stream = &data[i];
+        bool valid = true;
+        Guid prefabObjectId;
+        while (true)
+        {
+            e.Streams.Insert(0, stream);
+            if (!JsonTools::GetGuidIfValid(prefabObjectId, *stream, "PrefabObjectID"))
+                break;
+            const Guid prefabId = JsonTools::GetGuid(*stream, "PrefabID");
+            auto prefab = Content::LoadAsync<Prefab>(prefabId);
+            if (prefab == nullptr || prefab->WaitForLoaded())
+            {
+                LOG(Warning, "Missing prefab with id={0}.", prefabId);
+                valid = false;
+                break;
+            }
+            if (!_spawnTablePrefabs.Contains(prefab))
+            {
+                // Keep the nested prefab loaded while the table holds pointers into its data
+                _spawnTablePrefabs.Add(prefab);
+                prefab->AddReference();
+                prefab->OnUnloaded.Bind<Prefab, &Prefab::OnSpawnTablePrefabUnloaded>(this);
+            }
+            e.NestedIds.Add(prefabObjectId);
+            const ISerializable::DeserializeStream* prefabData;
+            if (!prefab->ObjectsDataCache.TryGet(prefabObjectId, prefabData))
+            {
+                LOG(Warning, "Missing object {1} data in prefab {0}.", prefab->ToString(), prefabObjectId);
+                valid = false;
+                break;
+            }
+            stream = prefabData;
+        }
+        if (!valid)
+        {
+            e.Streams.Clear();
+            continue;
+        }
+
+        // Resolve the object type from the deepest data (deprecated data formats use the generic spawn path)
+        const auto typeNameMember = stream->FindMember("TypeName");
+        if (typeNameMember != stream->MemberEnd() && typeNameMember->value.IsString())
+        {
+            const StringAnsiView typeName(typeNameMember->value.GetStringAnsiView());
+            const ScriptingTypeHandle type = Scripting::FindScriptingType(typeName);
+            if (type && SceneObject::TypeInitializer.IsAssignableFrom(type))
+                e.Type = type;
+        }
+    }
+}
+
+void Prefab::ClearSpawnTable()
+{
+    ScopeLock lock(Locker);
+    SpawnTable.Resize(0);
+    for (Prefab* prefab : _spawnTablePrefabs)
+    {
+        prefab->OnUnloaded.Unbind<Prefab, &Prefab::OnSpawnTablePrefabUnloaded>(this);
+        prefab->RemoveReference();
+    }
+    _spawnTablePrefabs.Resize(0);
+}
+
+void Prefab::OnSpawnTablePrefabUnloaded(Asset* obj)
+{
+    // Nested prefab data gets unloaded so drop the cached pointers into it
+    ClearSpawnTable();
+}
+
+#if USE_EDITOR
+
+bool Prefab::BakeNestedPrefabs(ISerializable::SerializeDocument& result)
+{
+    ScopeLock lock(Locker);
+    if (!IsLoaded() || NestedPrefabs.IsEmpty())
+        return true;
+    PROFILE_CPU();
+    BuildSpawnTable();
+    if (SpawnTable.Count() != ObjectsCount)
+        return true;
+
+    // Build the nested prefab object ids to this prefab object ids mapping used to remap the references inside the nested data
+    Dictionary<Guid, Guid> idsMapping;
+    for (const SpawnEntry& e : SpawnTable)
+    {
+        if (e.Streams.IsEmpty())
+            return true; // Failed to resolve the object data (eg. missing nested prefab)
+        for (const Guid& nestedId : e.NestedIds)
+        {
+            Guid mapped;
+            if (idsMapping.TryGet(nestedId, mapped) && mapped != e.Id)
+                return true; // Nested prefab is instanced more than once so the references cannot be remapped statically (runtime resolves them per-instance)
+            idsMapping[nestedId] = e.Id;
+        }
+    }
+
+    // Merge every object data through the nesting chain (the deepest data first, outer levels override member-wise)
+    auto& allocator = result.GetAllocator();
+    result.SetArray();
+    result.Reserve(ObjectsCount, allocator);
+    for (const SpawnEntry& e : SpawnTable)
+    {
+        rapidjson_flax::Value obj(rapidjson::kObjectType);
+        for (const ISerializable::DeserializeStream* stream : e.Streams)
+        {
+            for (auto i = stream->MemberBegin(); i != stream->MemberEnd(); ++i)
+            {
+                const auto member = obj.FindMember(i->name);
+                if (member != obj.MemberEnd())
+                {
+                    member->value.CopyFrom(i->value, allocator);
+                }
+                else
+                {
+                    rapidjson_flax::Value name, value;
+                    name.CopyFrom(i->name, allocator);
+                    value.CopyFrom(i->value, allocator);
+                    obj.AddMember(name, value, allocator);
+                }
+            }
+        }
+
+        // Drop the nesting linkage (the object data is fully self-contained now)
+        obj.RemoveMember("PrefabID");
+        obj.RemoveMember("PrefabObjectID");
+
+        result.PushBack(obj, allocator);
+    }
+
+    // Remap the references to the nested prefab objects into this prefab objects space
+    JsonTools::ChangeIds(result, idsMapping);
+
+    return false;
+}
+
+#endif
+
 void Prefab::DeleteDefaultInstance()
 {
     ScopeLock lock(Locker);
@@ -143,6 +294,10 @@ Asset::LoadResult Prefab::loadAsset()
     // Register for scripts reload and unload (need to cleanup all user objects including scripts that may be attached to the default instance - it can be always restored)
     Scripting::ScriptsReloading.Bind<Prefab, &Prefab::DeleteDefaultInstance>(this);
     Scripting::ScriptsUnload.Bind<Prefab, &Prefab::DeleteDefaultInstance>(this);
+
+    // Spawn table caches scripting type handles so drop it when types get changed
+    Scripting::ScriptsReloading.Bind<Prefab, &Prefab::ClearSpawnTable>(this);
+    Scripting::ScriptsUnload.Bind<Prefab, &Prefab::ClearSpawnTable>(this);
 #endif
 
     return LoadResult::Ok;
@@ -154,11 +309,21 @@ void Prefab::unload(bool isReloading)
     // Unlink
     Scripting::ScriptsReloading.Unbind<Prefab, &Prefab::DeleteDefaultInstance>(this);
     Scripting::ScriptsUnload.Unbind<Prefab, &Prefab::DeleteDefaultInstance>(this);
+    Scripting::ScriptsReloading.Unbind<Prefab, &Prefab::ClearSpawnTable>(this);
+    Scripting::ScriptsUnload.Unbind<Prefab, &Prefab::ClearSpawnTable>(this);
 #endif
 
     // Base
     JsonAssetBase::unload(isReloading);
 
+    SpawnTable.Resize(0);
+    for (Prefab* prefab : _spawnTablePrefabs)
+    {
+        prefab->OnUnloaded.Unbind<Prefab, &Prefab::OnSpawnTablePrefabUnloaded>(this);
+        prefab->RemoveReference();
+    }
+    _spawnTablePrefabs.Resize(0);
+
     ObjectsCount = 0;
     ObjectsIds.Resize(0);
     NestedPrefabs.Resize(0);
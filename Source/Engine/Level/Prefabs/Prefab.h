@@ -5,6 +5,7 @@
 #include "Engine/Content/JsonAsset.h"
 #include "Engine/Core/Collections/Array.h"
 #include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Scripting/ScriptingType.h"
 
 class Actor;
 class SceneObject;
@@ -46,6 +47,26 @@ public:
     /// </summary>
     Dictionary<Guid, const void*> ObjectsCache;
 
+    /// <summary>
+    /// Pre-resolved spawn data of a single prefab object: the object type and the chain of data streams through the nested prefabs. Cached so repeated spawning skips the per-object json probing and nested prefabs traversal.
+    /// </summary>
+    struct SpawnEntry
+    {
+        // The object id within the prefab data.
+        Guid Id;
+        // The prefab object ids throughout the nested prefabs chain (outermost first). Mapped to the spawned object id when resolving references.
+        Array<Guid, InlinedAllocation<4>> NestedIds;
+        // The type of the object to spawn. Invalid if the object data failed to resolve (the object uses the generic spawn path then).
+        ScriptingTypeHandle Type;
+        // The object data streams to apply in order (the deepest nested prefab data first).
+        Array<const ISerializable::DeserializeStream*, InlinedAllocation<4>> Streams;
+    };
+
+    /// <summary>
+    /// The pre-resolved objects spawn table used by the PrefabManager spawning fast path. Empty until the first spawn (see BuildSpawnTable).
+    /// </summary>
+    Array<SpawnEntry> SpawnTable;
+
 public:
     /// <summary>
     /// Gets the root object identifier (prefab object ID). Asset must be loaded.
@@ -69,7 +90,24 @@ public:
     /// <returns>The object of the prefab loaded from the prefab. Contains the default values. It's not added to gameplay but deserialized with postLoad and init event fired.</returns>
     API_FUNCTION() SceneObject* GetDefaultInstance(API_PARAM(Ref) const Guid& objectId);
 
+    /// <summary>
+    /// Builds the pre-resolved objects spawn table (see SpawnTable). Skips if already built. Asset must be loaded.
+    /// </summary>
+    void BuildSpawnTable();
+
+    /// <summary>
+    /// Clears the pre-resolved objects spawn table (eg. after nested prefab data or scripting types change).
+    /// </summary>
+    void ClearSpawnTable();
+
 #if USE_EDITOR
+    /// <summary>
+    /// Bakes the nested prefabs data into a flattened objects list: every object json contains the fully-resolved data merged through the nesting chain (with per-level overrides applied) and the references remapped into this prefab objects space. Used by the game cooker so the runtime spawning never walks the nesting chain.
+    /// </summary>
+    /// <param name="result">The result document with the flattened objects array (valid only when no failure).</param>
+    /// <returns>True if failed (eg. prefab has no nesting, a nested prefab is instanced multiple times or data is missing) and the prefab should be cooked with the original data, otherwise false.</returns>
+    bool BakeNestedPrefabs(ISerializable::SerializeDocument& result);
+
     /// <summary>
     /// Applies the difference from the prefab object instance, saves the changes and synchronizes them with the active instances of the prefab asset.
     /// </summary>
@@ -90,6 +128,10 @@ private:
     void SyncNestedPrefabs(const NestedPrefabsList& allPrefabs, Array<PrefabInstancesData>& allPrefabsInstancesData) const;
 #endif
     void DeleteDefaultInstance();
+    void OnSpawnTablePrefabUnloaded(Asset* obj);
+
+    // Nested prefabs referenced by the SpawnTable streams (kept loaded while the table exists)
+    Array<Prefab*> _spawnTablePrefabs;
 
 protected:
     // [JsonAssetBase]
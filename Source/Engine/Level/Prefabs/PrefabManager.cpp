@@ -37,6 +37,40 @@ public:
 
 PrefabManagerService PrefabManagerServiceInstance;
 
+namespace
+{
+    SceneObject* SpawnObjectFromEntry(SceneObjectsFactory::Context& context, const Prefab::SpawnEntry& entry, ISerializable::DeserializeStream& stream)
+    {
+        if (!entry.Type)
+            return SceneObjectsFactory::Spawn(context, stream); // Eg. deprecated data format or missing nested prefab
+        Guid id = entry.Id;
+        context.Modifier->IdsMapping.TryGet(id, id);
+        for (const Guid& nestedId : entry.NestedIds)
+        {
+            // Map prefab object ID to the deserialized instance ID
+            context.Modifier->IdsMapping[nestedId] = id;
+        }
+        const ScriptingObjectSpawnParams params(id, entry.Type);
+        const auto obj = (SceneObject*)entry.Type.GetType().Script.Spawn(params);
+        if (obj == nullptr)
+            LOG(Warning, "Failed to spawn object of type {0}.", entry.Type.ToString(true));
+        return obj;
+    }
+
+    void DeserializeObjectFromEntry(SceneObjectsFactory::Context& context, SceneObject* obj, const Prefab::SpawnEntry& entry, ISerializable::DeserializeStream& stream)
+    {
+        if (!entry.Type || entry.Streams.IsEmpty())
+        {
+            SceneObjectsFactory::Deserialize(context, obj, stream);
+            return;
+        }
+        context.SetupIdsMapping(obj);
+        ISerializeModifier* modifier = context.GetModifier();
+        for (const ISerializable::DeserializeStream* dataStream : entry.Streams)
+            obj->Deserialize(*(ISerializable::DeserializeStream*)dataStream, modifier);
+    }
+}
+
 Actor* PrefabManager::SpawnPrefab(Prefab* prefab)
 {
     Actor* parent = Level::Scenes.Count() != 0 ? Level::Scenes[0] : nullptr;
@@ -134,13 +168,17 @@ Actor* PrefabManager::SpawnPrefab(Prefab* prefab, Actor* parent, Dictionary<Guid
     auto& data = *prefab->Data;
     SceneObjectsFactory::Context context(modifier.Value);
 
+    // Build the pre-resolved objects spawn table on the first spawn (cached in the asset to make respawning cheap)
+    prefab->BuildSpawnTable();
+    const Prefab::SpawnEntry* spawnTable = prefab->SpawnTable.Count() == objectsCount ? prefab->SpawnTable.Get() : nullptr;
+
     // Deserialize prefab objects
     auto prevIdMapping = Scripting::ObjectsLookupIdMapping.Get();
     Scripting::ObjectsLookupIdMapping.Set(&modifier.Value->IdsMapping);
     for (int32 i = 0; i < objectsCount; i++)
     {
         auto& stream = data[i];
-        auto obj = SceneObjectsFactory::Spawn(context, stream);
+        auto obj = spawnTable ? SpawnObjectFromEntry(context, spawnTable[i], stream) : SceneObjectsFactory::Spawn(context, stream);
         sceneObjects->At(i) = obj;
         if (obj)
             obj->RegisterObject();
@@ -161,7 +199,12 @@ Actor* PrefabManager::SpawnPrefab(Prefab* prefab, Actor* parent, Dictionary<Guid
         auto& stream = data[i];
         SceneObject* obj = sceneObjects->At(i);
         if (obj)
-            SceneObjectsFactory::Deserialize(context, obj, stream);
+        {
+            if (spawnTable)
+                DeserializeObjectFromEntry(context, obj, spawnTable[i], stream);
+            else
+                SceneObjectsFactory::Deserialize(context, obj, stream);
+        }
     }
     Scripting::ObjectsLookupIdMapping.Set(prevIdMapping);
 
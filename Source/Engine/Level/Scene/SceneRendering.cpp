@@ -2,10 +2,16 @@
 
 #define SCENE_RENDERING_USE_PROFILER_PER_ACTOR 0
 
+// Minimum amount of actors in the category list to reorder the drawing buffer in near-spatial order (Morton codes) for a better cache locality of the culling loop
+#define SCENE_RENDERING_MORTON_SORT_MIN_COUNT (4 * 1024)
+
 #include "SceneRendering.h"
+#include "Engine/Core/Collections/Sorting.h"
+#include "Engine/Core/Math/CollisionsHelper.h"
 #include "Engine/Graphics/RenderTask.h"
 #include "Engine/Graphics/RenderView.h"
 #include "Engine/Renderer/RenderList.h"
+#include "Engine/Renderer/SoftwareOcclusionCulling.h"
 #include "Engine/Threading/JobSystem.h"
 #include "Engine/Threading/Threading.h"
 #include "Engine/Profiler/ProfilerCPU.h"
@@ -41,23 +47,28 @@ FORCE_INLINE bool FrustumsListCull(const BoundingSphere& bounds, const Array<Bou
 
 void SceneRendering::Draw(RenderContextBatch& renderContextBatch, DrawCategory category)
 {
-    ScopeLock lock(Locker);
-    if (category == PreRender)
+    auto& list = _drawActors[(int32)category];
     {
-        // Register scene
-        for (const auto& renderContext : renderContextBatch.Contexts)
-            renderContext.List->Scenes.Add(this);
+        ScopeLock lock(Locker);
+        if (category == PreRender)
+        {
+            // Register scene
+            for (const auto& renderContext : renderContextBatch.Contexts)
+                renderContext.List->Scenes.Add(this);
+        }
 
-        // Add additional lock during scene rendering (prevents any Actors cache modifications on content streaming threads - eg. when model residency changes)
-        Locker.Lock();
-    }
-    else if (category == PostRender)
-    {
-        // Release additional lock
-        Locker.Unlock();
+        // Swap in any pending actors changes (lists are double-buffered so the game and content streaming threads modify actors without blocking the rendering)
+        if (_actorsDirty[(int32)category])
+        {
+            _actorsDirty[(int32)category] = false;
+            list = Actors[(int32)category];
+            if (list.Count() >= SCENE_RENDERING_MORTON_SORT_MIN_COUNT && (category == SceneDraw || category == SceneDrawAsync))
+                SortActorsByMorton((int32)category);
+            else
+                _drawActorsMapping[(int32)category].Clear();
+        }
     }
     auto& view = renderContextBatch.GetMainContext().View;
-    auto& list = Actors[(int32)category];
     _drawListData = list.Get();
     _drawListSize = list.Count();
     _drawBatch = &renderContextBatch;
@@ -68,6 +79,9 @@ void SceneRendering::Draw(RenderContextBatch& renderContextBatch, DrawCategory c
     for (int32 i = 0; i < frustumsCount; i++)
         _drawFrustumsData.Get()[i] = renderContextBatch.Contexts.Get()[i].View.CullingFrustum;
 
+    // Build the occlusion buffer from the CPU-rasterized occluder proxies (additional cull stage after frustum tests)
+    _drawUseOcclusion = (category == SceneDraw || category == SceneDrawAsync) && frustumsCount == 1 && SoftwareOcclusionCulling::Build(view);
+
     // Draw all visual components
     _drawListIndex = -1;
     if (_drawListSize >= 64 && category == SceneDrawAsync && renderContextBatch.EnableAsync)
@@ -90,6 +104,7 @@ void SceneRendering::Draw(RenderContextBatch& renderContextBatch, DrawCategory c
         // Draw physics shapes
         if (EnumHasAnyFlags(view.Flags, ViewFlags::PhysicsDebug) || view.Mode == ViewMode::PhysicsColliders)
         {
+            ScopeLock lock(Locker);
             const PhysicsDebugCallback* physicsDebugData = PhysicsDebug.Get();
             for (int32 i = 0; i < PhysicsDebug.Count(); i++)
             {
@@ -105,12 +120,78 @@ void SceneRendering::CollectPostFxVolumes(RenderContext& renderContext)
 #if SCENE_RENDERING_USE_PROFILER
     PROFILE_CPU();
 #endif
+    ScopeLock lock(Locker);
     for (int32 i = 0; i < PostFxProviders.Count(); i++)
     {
         PostFxProviders.Get()[i]->Collect(renderContext);
     }
 }
 
+FORCE_INLINE uint32 MortonCodeSpread(uint32 x)
+{
+    // Spreads the lower 10 bits apart so the three axes can be interleaved
+    x &= 0x000003ff;
+    x = (x | (x << 16)) & 0x030000ff;
+    x = (x | (x << 8)) & 0x0300f00f;
+    x = (x | (x << 4)) & 0x030c30c3;
+    x = (x | (x << 2)) & 0x09249249;
+    return x;
+}
+
+void SceneRendering::SortActorsByMorton(int32 category)
+{
+    PROFILE_CPU();
+    auto& list = _drawActors[category];
+    const int32 count = list.Count();
+    DrawActor* listData = list.Get();
+
+    // Find the whole scene bounds to quantize the actors bounds centers into a 10-bit grid per axis
+    Vector3 boundsMin = Vector3::Maximum, boundsMax = Vector3::Minimum;
+    for (int32 i = 0; i < count; i++)
+    {
+        Vector3::Min(boundsMin, listData[i].Bounds.Center, boundsMin);
+        Vector3::Max(boundsMax, listData[i].Bounds.Center, boundsMax);
+    }
+    const Vector3 boundsSize = boundsMax - boundsMin;
+    const Vector3 scale(
+        boundsSize.X > ZeroTolerance ? (Real)1023 / boundsSize.X : (Real)0,
+        boundsSize.Y > ZeroTolerance ? (Real)1023 / boundsSize.Y : (Real)0,
+        boundsSize.Z > ZeroTolerance ? (Real)1023 / boundsSize.Z : (Real)0);
+
+    // Build the Morton code sorting keys from the quantized centers (scratch lives in the per-thread frame arena, it dies with this call)
+    Array<uint32, FrameAllocation> keys, keysTmp;
+    Array<int32, FrameAllocation> indices, indicesTmp;
+    keys.Resize(count);
+    keysTmp.Resize(count);
+    indices.Resize(count);
+    indicesTmp.Resize(count);
+    for (int32 i = 0; i < count; i++)
+    {
+        const Vector3 p = listData[i].Bounds.Center - boundsMin;
+        const uint32 x = (uint32)Math::Clamp<Real>(p.X * scale.X, 0, 1023);
+        const uint32 y = (uint32)Math::Clamp<Real>(p.Y * scale.Y, 0, 1023);
+        const uint32 z = (uint32)Math::Clamp<Real>(p.Z * scale.Z, 0, 1023);
+        keys.Get()[i] = (MortonCodeSpread(z) << 2) | (MortonCodeSpread(y) << 1) | MortonCodeSpread(x);
+        indices.Get()[i] = i;
+    }
+    uint32* sortedKeys = keys.Get();
+    int32* sortedIndices = indices.Get();
+    Sorting::RadixSort(sortedKeys, sortedIndices, keysTmp.Get(), indicesTmp.Get(), count);
+
+    // Rebuild the drawing buffer in near-spatial order so the culling loop touches the bounds memory coherently for spatially close actors
+    Array<DrawActor> sorted;
+    sorted.Resize(count);
+    auto& mapping = _drawActorsMapping[category];
+    mapping.Resize(count);
+    for (int32 i = 0; i < count; i++)
+    {
+        const int32 src = sortedIndices[i];
+        sorted.Get()[i] = listData[src];
+        mapping.Get()[src] = i;
+    }
+    list.Swap(sorted);
+}
+
 void SceneRendering::Clear()
 {
     ScopeLock lock(Locker);
@@ -122,6 +203,12 @@ void SceneRendering::Clear()
     _listeners.Clear();
     for (auto& e : Actors)
         e.Clear();
+    for (auto& e : _drawActors)
+        e.Clear();
+    for (auto& e : _drawActorsMapping)
+        e.Clear();
+    for (auto& e : _actorsDirty)
+        e = false;
 #if USE_EDITOR
     PhysicsDebug.Clear();
 #endif
@@ -148,6 +235,7 @@ void SceneRendering::AddActor(Actor* a, int32& key)
     e.LayerMask = a->GetLayerMask();
     e.Bounds = a->GetSphere();
     e.NoCulling = a->_drawNoCulling;
+    _actorsDirty[category] = true;
     for (auto* listener : _listeners)
         listener->OnSceneRenderingAddActor(a);
 }
@@ -165,6 +253,7 @@ void SceneRendering::UpdateActor(Actor* a, int32& key)
         listener->OnSceneRenderingUpdateActor(a, e.Bounds);
     e.LayerMask = a->GetLayerMask();
     e.Bounds = a->GetSphere();
+    _actorsDirty[category] = true;
 }
 
 void SceneRendering::RemoveActor(Actor* a, int32& key)
@@ -180,13 +269,26 @@ void SceneRendering::RemoveActor(Actor* a, int32& key)
             listener->OnSceneRenderingRemoveActor(a);
         e.Actor = nullptr;
         e.LayerMask = 0;
+        _actorsDirty[category] = true;
+
+        // Also patch the drawing buffer so the removed actor won't be drawn before the next buffers swap (LayerMask=0 fails the culling test)
+        auto& drawList = _drawActors[category];
+        const auto& mapping = _drawActorsMapping[category];
+        const int32 drawKey = key < mapping.Count() ? mapping.Get()[key] : key;
+        if (drawKey < drawList.Count() && drawList.Get()[drawKey].Actor == a)
+        {
+            drawList.Get()[drawKey].Actor = nullptr;
+            drawList.Get()[drawKey].LayerMask = 0;
+        }
     }
     key = -1;
 }
 
 #define FOR_EACH_BATCH_ACTOR const int64 count = _drawListSize; while (true) { const int64 index = Platform::InterlockedIncrement(&_drawListIndex); if (index >= count) break; auto e = _drawListData[index];
-#define CHECK_ACTOR ((view.RenderLayersMask.Mask & e.LayerMask) && (e.NoCulling || FrustumsListCull(e.Bounds, _drawFrustumsData)))
-#define CHECK_ACTOR_SINGLE_FRUSTUM ((view.RenderLayersMask.Mask & e.LayerMask) && (e.NoCulling || view.CullingFrustum.Intersects(e.Bounds)))
+#define CHECK_OCCLUSION (!_drawUseOcclusion || !SoftwareOcclusionCulling::IsOccluded(e.Bounds))
+// Null-check the actor first: RemoveActor patches the drawing buffer entry without the drawing lock so a copy taken mid-removal can have a null actor with a stale layer mask
+#define CHECK_ACTOR (e.Actor && (view.RenderLayersMask.Mask & e.LayerMask) && (e.NoCulling || (FrustumsListCull(e.Bounds, _drawFrustumsData) && CHECK_OCCLUSION)))
+#define CHECK_ACTOR_SINGLE_FRUSTUM (e.Actor && (view.RenderLayersMask.Mask & e.LayerMask) && (e.NoCulling || (view.CullingFrustum.Intersects(e.Bounds) && CHECK_OCCLUSION)))
 #if SCENE_RENDERING_USE_PROFILER_PER_ACTOR
 #define DRAW_ACTOR(mode) PROFILE_CPU_ACTOR(e.Actor); e.Actor->Draw(mode)
 #else
@@ -211,11 +313,26 @@ void SceneRendering::DrawActorsJob(int32)
     }
     else if (view.Origin.IsZero() && _drawFrustumsData.Count() == 1)
     {
-        // Fast path for no origin shifting with a single context
-        FOR_EACH_BATCH_ACTOR
-            if (CHECK_ACTOR_SINGLE_FRUSTUM)
+        // Fast path for no origin shifting with a single context (SIMD kernel culls 4 actor bounds per step)
+        const BoundingFrustum frustum = view.CullingFrustum;
+        const int64 count = _drawListSize;
+        while (true)
+        {
+            const int64 index = Platform::InterlockedAdd(&_drawListIndex, 4) + 1; // InterlockedAdd returns the pre-add value
+            if (index >= count)
+                break;
+            const int32 batchCount = (int32)Math::Min<int64>(4, count - index);
+            BoundingSphere batchBounds[4];
+            for (int32 j = 0; j < batchCount; j++)
+                batchBounds[j] = _drawListData[index + j].Bounds;
+            const uint32 batchMask = CollisionsHelper::FrustumIntersectsSpheres(frustum, batchBounds, batchCount);
+            for (int32 j = 0; j < batchCount; j++)
             {
-                DRAW_ACTOR(mainContext);
+                auto e = _drawListData[index + j];
+                if (e.Actor && (view.RenderLayersMask.Mask & e.LayerMask) && (e.NoCulling || ((batchMask & 1u << j) && CHECK_OCCLUSION)))
+                {
+                    DRAW_ACTOR(mainContext);
+                }
             }
         }
     }
@@ -243,5 +360,6 @@ void SceneRendering::DrawActorsJob(int32)
 }
 
 #undef FOR_EACH_BATCH_ACTOR
+#undef CHECK_OCCLUSION
 #undef CHECK_ACTOR
 #undef DRAW_ACTOR
@@ -93,6 +93,12 @@ public:
     CriticalSection Locker;
 
 private:
+    // Second buffer with the actors lists snapshot used by the drawing (double-buffered so actors modifications during a spawn burst don't contend with the rendering threads)
+    Array<DrawActor> _drawActors[MAX];
+    // Maps the actor slot key into the drawing buffer index when the buffer got reordered for culling locality (empty when both buffers share the same order)
+    Array<int32> _drawActorsMapping[MAX];
+    bool _actorsDirty[MAX] = {};
+
 #if USE_EDITOR
     Array<PhysicsDebugCallback> PhysicsDebug;
     Array<Actor*> ViewportIcons;
@@ -128,12 +134,16 @@ public:
 
     FORCE_INLINE void AddPostFxProvider(IPostFxSettingsProvider* obj)
     {
+        Locker.Lock();
         PostFxProviders.Add(obj);
+        Locker.Unlock();
     }
 
     FORCE_INLINE void RemovePostFxProvider(IPostFxSettingsProvider* obj)
     {
+        Locker.Lock();
         PostFxProviders.Remove(obj);
+        Locker.Unlock();
     }
 
 #if USE_EDITOR
@@ -167,9 +177,11 @@ public:
 private:
     Array<BoundingFrustum> _drawFrustumsData;
     DrawActor* _drawListData;
+    bool _drawUseOcclusion;
     int64 _drawListSize;
     volatile int64 _drawListIndex;
     RenderContextBatch* _drawBatch;
 
+    void SortActorsByMorton(int32 category);
     void DrawActorsJob(int32);
 };
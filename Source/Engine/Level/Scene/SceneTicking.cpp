@@ -2,26 +2,74 @@
 
 #include "SceneTicking.h"
 #include "Scene.h"
+#include "Engine/Engine/Engine.h"
+#include "Engine/Engine/Time.h"
 #include "Engine/Scripting/Script.h"
+#if USE_MONO
+#include "Engine/Debug/DebugLog.h"
+#include "Engine/Scripting/Scripting.h"
+#include "Engine/Scripting/ManagedCLR/MDomain.h"
+#include "Engine/Scripting/ManagedCLR/MClass.h"
+#include "Engine/Scripting/ManagedCLR/MMethod.h"
+#include <ThirdParty/mono-2.0/mono/metadata/appdomain.h>
+#endif
+
+bool SceneTicking::CanTickScript(Script* script)
+{
+    switch (script->TickFrequency)
+    {
+    case ScriptTickFrequency::EveryFrame:
+        return true;
+    case ScriptTickFrequency::OnDemand:
+        return false;
+    default:
+        break;
+    }
+    const uint32 frame = (uint32)Engine::FrameCount;
+    if (script->_tickFrame == frame)
+        return true; // Already approved this frame (eg. script ticking in both Update and LateUpdate)
+    const float interval = script->TickFrequency == ScriptTickFrequency::Hz15 ? 1.0f / 15.0f : 0.5f;
+    const float time = Time::Update.Time.GetTotalSeconds();
+    if (time < script->_nextTickTime)
+        return false;
+    if (script->_nextTickTime <= 0.0f)
+    {
+        // First tick runs now but the follow-up gets a phase from the object identity so low-frequency scripts spread evenly across frames instead of bursting together
+        script->_nextTickTime = time + interval * (float)(script->GetID().A & 0xff) / 255.0f;
+    }
+    else
+    {
+        script->_nextTickTime = time + interval;
+    }
+    script->_tickFrame = frame;
+    return true;
+}
 
-SceneTicking::TickData::TickData(int32 capacity)
+SceneTicking::TickData::TickData(int32 capacity, int32 batchTick)
     : Scripts(capacity)
     , Ticks(capacity)
+    , _batchTick(batchTick)
 {
 }
 
-void SceneTicking::TickData::AddScript(Script* script)
+void SceneTicking::TickData::AddScript(Script* script, bool isManaged)
 {
-    Scripts.Add(script);
+    if (isManaged)
+        ManagedScripts.Add(script);
+    else
+        Scripts.Add(script);
 #if USE_EDITOR
     if (script->_executeInEditor)
         ScriptsExecuteInEditor.Add(script);
 #endif
 }
 
-void SceneTicking::TickData::RemoveScript(Script* script)
+void SceneTicking::TickData::RemoveScript(Script* script, bool isManaged)
 {
-    Scripts.Remove(script);
+    if (isManaged)
+        ManagedScripts.Remove(script);
+    else
+        Scripts.Remove(script);
 #if USE_EDITOR
     if (script->_executeInEditor)
         ScriptsExecuteInEditor.Remove(script);
@@ -43,11 +91,49 @@ void SceneTicking::TickData::RemoveTick(void* callee)
 void SceneTicking::TickData::Tick()
 {
     TickScripts(Scripts);
+    if (ManagedScripts.HasItems())
+        TickManagedScripts();
 
     for (int32 i = 0; i < Ticks.Count(); i++)
         Ticks[i].Call();
 }
 
+void SceneTicking::TickData::TickManagedScripts()
+{
+#if USE_MONO
+    // Cross the native/managed boundary once and tick all the scripts implemented in C# within the managed runtime (instead of per-object wrapper invocations)
+    MClass* mclass = Script::GetStaticClass();
+    MMethod* method = mclass ? mclass->GetMethod("Internal_BatchTick", 3) : nullptr;
+    if (method)
+    {
+        if (mono_domain_get() == nullptr)
+            Scripting::GetScriptsDomain()->Dispatch();
+        MonoArray* scripts = mono_array_new(mono_domain_get(), mclass->GetNative(), ManagedScripts.Count());
+        int32 count = 0;
+        for (int32 i = 0; i < ManagedScripts.Count(); i++)
+        {
+            // Frequency groups gate the Update/LateUpdate batches only (FixedUpdate always runs at the physics rate)
+            Script* script = ManagedScripts[i];
+            if (_batchTick != 0 && !CanTickScript(script))
+                continue;
+            mono_array_setref(scripts, count++, script->GetOrCreateManagedInstance());
+        }
+        if (count == 0)
+            return;
+        int32 tick = _batchTick;
+        void* params[3];
+        params[0] = scripts;
+        params[1] = &count;
+        params[2] = &tick;
+        MObject* exception = nullptr;
+        method->Invoke(nullptr, params, &exception);
+        DebugLog::LogException(exception);
+        return;
+    }
+#endif
+    TickScripts(ManagedScripts);
+}
+
 #if USE_EDITOR
 
 void SceneTicking::TickData::RemoveTickExecuteInEditor(void* callee)
@@ -75,6 +161,7 @@ void SceneTicking::TickData::TickExecuteInEditor()
 void SceneTicking::TickData::Clear()
 {
     Scripts.Clear();
+    ManagedScripts.Clear();
     Ticks.Clear();
 #if USE_EDITOR
     ScriptsExecuteInEditor.Clear();
@@ -83,7 +170,7 @@ void SceneTicking::TickData::Clear()
 }
 
 SceneTicking::FixedUpdateTickData::FixedUpdateTickData()
-    : TickData(512)
+    : TickData(512, 0)
 {
 }
 
@@ -96,7 +183,7 @@ void SceneTicking::FixedUpdateTickData::TickScripts(const Array<Script*>& script
 }
 
 SceneTicking::UpdateTickData::UpdateTickData()
-    : TickData(1024)
+    : TickData(1024, 1)
 {
 }
 
@@ -104,12 +191,13 @@ void SceneTicking::UpdateTickData::TickScripts(const Array<Script*>& scripts)
 {
     for (auto* script : scripts)
     {
-        script->OnUpdate();
+        if (CanTickScript(script))
+            script->OnUpdate();
     }
 }
 
 SceneTicking::LateUpdateTickData::LateUpdateTickData()
-    : TickData(64)
+    : TickData(64, 2)
 {
 }
 
@@ -117,7 +205,8 @@ void SceneTicking::LateUpdateTickData::TickScripts(const Array<Script*>& scripts
 {
     for (auto* script : scripts)
     {
-        script->OnLateUpdate();
+        if (CanTickScript(script))
+            script->OnLateUpdate();
     }
 }
 
@@ -125,22 +214,22 @@ void SceneTicking::AddScript(Script* obj)
 {
     ASSERT_LOW_LAYER(obj && obj->GetParent() && obj->GetParent()->GetScene());
     if (obj->_tickFixedUpdate)
-        FixedUpdate.AddScript(obj);
+        FixedUpdate.AddScript(obj, obj->_tickFixedUpdateManaged != 0);
     if (obj->_tickUpdate)
-        Update.AddScript(obj);
+        Update.AddScript(obj, obj->_tickUpdateManaged != 0);
     if (obj->_tickLateUpdate)
-        LateUpdate.AddScript(obj);
+        LateUpdate.AddScript(obj, obj->_tickLateUpdateManaged != 0);
 }
 
 void SceneTicking::RemoveScript(Script* obj)
 {
     ASSERT_LOW_LAYER(obj && obj->GetParent() && obj->GetParent()->GetScene());
     if (obj->_tickFixedUpdate)
-        FixedUpdate.RemoveScript(obj);
+        FixedUpdate.RemoveScript(obj, obj->_tickFixedUpdateManaged != 0);
     if (obj->_tickUpdate)
-        Update.RemoveScript(obj);
+        Update.RemoveScript(obj, obj->_tickUpdateManaged != 0);
     if (obj->_tickLateUpdate)
-        LateUpdate.RemoveScript(obj);
+        LateUpdate.RemoveScript(obj, obj->_tickLateUpdateManaged != 0);
 }
 
 void SceneTicking::Clear()
@@ -48,18 +48,19 @@ public:
     {
     public:
         Array<Script*> Scripts;
+        Array<Script*> ManagedScripts;
         Array<Tick> Ticks;
 #if USE_EDITOR
         Array<Script*> ScriptsExecuteInEditor;
         Array<Tick> TicksExecuteInEditor;
 #endif
 
-        TickData(int32 capacity);
+        TickData(int32 capacity, int32 batchTick);
 
         virtual void TickScripts(const Array<Script*>& scripts) = 0;
 
-        void AddScript(Script* script);
-        void RemoveScript(Script* script);
+        void AddScript(Script* script, bool isManaged);
+        void RemoveScript(Script* script, bool isManaged);
 
         template<class T, void(T::*Method)()>
         void AddTick(T* callee)
@@ -86,6 +87,11 @@ public:
 #endif
 
         void Clear();
+
+    private:
+        void TickManagedScripts();
+
+        int32 _batchTick;
     };
 
     class FLAXENGINE_API FixedUpdateTickData : public TickData
@@ -127,6 +133,13 @@ public:
     /// </summary>
     void Clear();
 
+    /// <summary>
+    /// Checks if the script ticking frequency group allows it to run on the current frame (and schedules its next tick if so). Always true for scripts ticking every frame.
+    /// </summary>
+    /// <param name="script">The script.</param>
+    /// <returns>True if the script should be updated during the current frame, otherwise false.</returns>
+    static bool CanTickScript(Script* script);
+
 public:
     /// <summary>
     /// The fixed update tick function.
@@ -11,6 +11,7 @@
 #include "Engine/Serialization/SerializationFwd.h"
 #include "Engine/Serialization/JsonWriters.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Threading/Threading.h"
 #include "Engine/Threading/ThreadLocal.h"
 
 SceneObjectsFactory::Context::Context(ISerializeModifier* modifier)
@@ -18,17 +19,59 @@ SceneObjectsFactory::Context::Context(ISerializeModifier* modifier)
 {
 }
 
+SceneObjectsFactory::Context::~Context()
+{
+    for (auto& e : _threads)
+    {
+        Delete(e.Value->Modifier);
+        Delete(e.Value);
+    }
+}
+
+ISerializeModifier* SceneObjectsFactory::Context::GetModifier()
+{
+    return Async ? GetThreadContext().Modifier : Modifier;
+}
+
 void SceneObjectsFactory::Context::SetupIdsMapping(const SceneObject* obj)
 {
     int32 instanceIndex;
-    if (ObjectToInstance.TryGet(obj->GetID(), instanceIndex) && instanceIndex != CurrentInstance)
+    if (!ObjectToInstance.TryGet(obj->GetID(), instanceIndex))
+        return;
+    int32* currentInstance = &CurrentInstance;
+    ISerializeModifier* modifier = Modifier;
+    if (Async)
     {
-        // Apply the current prefab instance objects ids table to resolve references inside a prefab properly
-        CurrentInstance = instanceIndex;
-        auto& instance = Instances[instanceIndex];
-        for (auto& e : instance.IdsMapping)
-            Modifier->IdsMapping[e.Key] = e.Value;
+        ThreadContext& thread = GetThreadContext();
+        currentInstance = &thread.CurrentInstance;
+        modifier = thread.Modifier;
     }
+    if (instanceIndex == *currentInstance)
+        return;
+
+    // Apply the current prefab instance objects ids table to resolve references inside a prefab properly
+    *currentInstance = instanceIndex;
+    auto& instance = Instances[instanceIndex];
+    for (auto& e : instance.IdsMapping)
+        modifier->IdsMapping[e.Key] = e.Value;
+}
+
+SceneObjectsFactory::Context::ThreadContext& SceneObjectsFactory::Context::GetThreadContext()
+{
+    const uint64 threadId = Platform::GetCurrentThreadID();
+    ScopeLock lock(_locker);
+    ThreadContext* thread;
+    if (!_threads.TryGet(threadId, thread))
+    {
+        // Lazy-init per-thread copy of the modifier state
+        thread = New<ThreadContext>();
+        thread->Modifier = New<ISerializeModifier>();
+        thread->Modifier->EngineBuild = Modifier->EngineBuild;
+        thread->Modifier->IdsMapping = Modifier->IdsMapping;
+        thread->CurrentInstance = CurrentInstance;
+        _threads.Add(threadId, thread);
+    }
+    return *thread;
 }
 
 SceneObject* SceneObjectsFactory::Spawn(Context& context, ISerializable::DeserializeStream& stream)
@@ -207,18 +250,10 @@ void SceneObjectsFactory::Deserialize(Context& context, SceneObject* obj, ISeria
         Deserialize(context, obj, *(ISerializable::DeserializeStream*)prefabData);
     }
 
-    int32 instanceIndex;
-    if (context.ObjectToInstance.TryGet(obj->GetID(), instanceIndex) && instanceIndex != context.CurrentInstance)
-    {
-        // Apply the current prefab instance objects ids table to resolve references inside a prefab properly
-        context.CurrentInstance = instanceIndex;
-        auto& instance = context.Instances[instanceIndex];
-        for (auto& e : instance.IdsMapping)
-            context.Modifier->IdsMapping[e.Key] = e.Value;
-    }
+    context.SetupIdsMapping(obj);
 
     // Load data
-    obj->Deserialize(stream, context.Modifier);
+    obj->Deserialize(stream, context.GetModifier());
 }
 
 void SceneObjectsFactory::HandleObjectDeserializationError(const ISerializable::DeserializeStream& value)
@@ -313,7 +348,7 @@ Actor* SceneObjectsFactory::CreateActor(int32 typeId, const Guid& id)
     return nullptr;
 }
 
-SceneObjectsFactory::PrefabSyncData::PrefabSyncData(Array<SceneObject*>& sceneObjects, const ISerializable::DeserializeStream& data, ISerializeModifier* modifier)
+SceneObjectsFactory::PrefabSyncData::PrefabSyncData(Array<SceneObject*>& sceneObjects, const Array<ISerializable::DeserializeStream*>& data, ISerializeModifier* modifier)
     : SceneObjects(sceneObjects)
     , Data(data)
     , Modifier(modifier)
@@ -324,14 +359,15 @@ SceneObjectsFactory::PrefabSyncData::PrefabSyncData(Array<SceneObject*>& sceneOb
 void SceneObjectsFactory::SetupPrefabInstances(Context& context, PrefabSyncData& data)
 {
     PROFILE_CPU_NAMED("SetupPrefabInstances");
-    const int32 count = data.Data.Size();
+    const int32 count = data.Data.Count();
     ASSERT(count <= data.SceneObjects.Count());
+    context.ObjectToInstance.EnsureCapacity(count);
     for (int32 i = 0; i < count; i++)
     {
         SceneObject* obj = data.SceneObjects[i];
         if (!obj)
             continue;
-        const auto& stream = data.Data[i];
+        const auto& stream = *data.Data[i];
         Guid prefabObjectId, prefabId;
         if (!JsonTools::GetGuidIfValid(prefabObjectId, stream, "PrefabObjectID"))
             continue;
@@ -341,7 +377,7 @@ void SceneObjectsFactory::SetupPrefabInstances(Context& context, PrefabSyncData&
         for (int32 j = i - 1; j >= 0; j--)
         {
             // Find instance ID of the parent to this object (use data in json for relationship)
-            if (parentId == JsonTools::GetGuid(data.Data[j], "ID") && data.SceneObjects[j])
+            if (parentId == JsonTools::GetGuid(*data.Data[j], "ID") && data.SceneObjects[j])
             {
                 parentId = data.SceneObjects[j]->GetID();
                 break;
@@ -385,7 +421,7 @@ void SceneObjectsFactory::SynchronizeNewPrefabInstances(Context& context, Prefab
         Actor* actor = dynamic_cast<Actor*>(data.SceneObjects[i]);
         if (!actor)
             continue;
-        const auto& stream = data.Data[i];
+        const auto& stream = *data.Data[i];
         Guid actorId, actorPrefabObjectId, prefabId;
         if (!JsonTools::GetGuidIfValid(actorPrefabObjectId, stream, "PrefabObjectID"))
             continue;
@@ -446,7 +482,7 @@ void SceneObjectsFactory::SynchronizeNewPrefabInstances(Context& context, Prefab
             bool spawned = false;
             for (int32 j = i + 1; j < data.InitialCount; j++)
             {
-                const auto& jData = data.Data[j];
+                const auto& jData = *data.Data[j];
                 const Guid jParentId = JsonTools::GetGuid(jData, "ParentID");
                 //if (jParentId == actorParentId)
                 //    break;
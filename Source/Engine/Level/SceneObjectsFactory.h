@@ -4,6 +4,7 @@
 
 #include "SceneObject.h"
 #include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Platform/CriticalSection.h"
 
 /// <summary>
 /// Helper class for scene objects creation and deserialization utilities.
@@ -24,10 +25,29 @@ public:
         int32 CurrentInstance = -1;
         Array<PrefabInstance> Instances;
         Dictionary<Guid, int32> ObjectToInstance;
+        // True if objects deserialization runs on multiple threads at once (eg. via Job System during scene loading)
+        bool Async = false;
 
         Context(ISerializeModifier* modifier);
+        ~Context();
+
+        // Gets the objects deserialization modifier for the calling thread. In async mode each thread uses its own copy of the modifier so prefab object ids remapping doesn't race.
+        ISerializeModifier* GetModifier();
 
         void SetupIdsMapping(const SceneObject* obj);
+
+    private:
+        struct ThreadContext
+        {
+            ISerializeModifier* Modifier;
+            int32 CurrentInstance = -1;
+        };
+
+        CriticalSection _locker;
+        // Heap-allocated contexts so the references handed out stay valid when another thread's first call grows the map
+        Dictionary<uint64, ThreadContext*> _threads;
+
+        ThreadContext& GetThreadContext();
     };
 
     /// <summary>
@@ -66,12 +86,12 @@ public:
         friend SceneObjectsFactory;
         // The created scene objects. Collection can be modified (eg. for spawning missing objects).
         Array<SceneObject*>& SceneObjects;
-        // The scene objects data.
-        const ISerializable::DeserializeStream& Data;
+        // The scene objects data (one entry per object; may point into multiple json documents when the scene file got parsed in chunks).
+        const Array<ISerializable::DeserializeStream*>& Data;
         // The objects deserialization modifier. Collection will be modified (eg. for spawned objects mapping).
         ISerializeModifier* Modifier;
 
-        PrefabSyncData(Array<SceneObject*>& sceneObjects, const ISerializable::DeserializeStream& data, ISerializeModifier* modifier);
+        PrefabSyncData(Array<SceneObject*>& sceneObjects, const Array<ISerializable::DeserializeStream*>& data, ISerializeModifier* modifier);
 
     private:
         struct NewObj
@@ -1,9 +1,533 @@
 // Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
 
 #include "SceneQuery.h"
+#include "Scene/SceneRendering.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Engine/EngineService.h"
 #include "Engine/Scripting/Script.h"
 #include "Engine/Profiler/Profiler.h"
 
+// Margin added to the leaf bounds so small actor movements don't cause tree updates every frame
+#define SCENE_QUERIES_BVH_MARGIN 10.0f
+
+/// <summary>
+/// Incrementally-maintained bounding volume hierarchy (dynamic AABB tree) over the actors registered for scene rendering. Kept in sync via scene rendering events so queries skip the scene tree walk entirely.
+/// </summary>
+class ActorsBVH : public ISceneRenderingListener
+{
+private:
+    struct Node
+    {
+        BoundingBox Bounds;
+        Actor* Leaf;
+        int32 Parent;
+        int32 Children[2];
+        int32 Height; // -1 for free nodes, 0 for leaves
+    };
+
+    CriticalSection _locker;
+    Array<Node> _nodes;
+    Dictionary<Actor*, int32> _leafs;
+    Array<SceneQuery::MovingRadiusQuery*> _radiusQueries;
+    int32 _root = -1;
+    int32 _freeList = -1;
+
+public:
+    void AddScene(SceneRendering* scene)
+    {
+        ListenSceneRendering(scene);
+
+        // Insert actors that were registered before this listener got attached (lock order: scene before tree, same as the events path)
+        ScopeLock lock(scene->Locker);
+        for (auto& list : scene->Actors)
+        {
+            for (auto& e : list)
+            {
+                if (e.Actor)
+                    AddActor(e.Actor);
+            }
+        }
+    }
+
+    void RayCastAll(const Ray& ray, Array<Actor*>& results)
+    {
+        ScopeLock lock(_locker);
+        if (_root == -1)
+            return;
+        Real distance;
+        Vector3 normal;
+        Array<int32, InlinedAllocation<64>> stack;
+        stack.Push(_root);
+        while (stack.HasItems())
+        {
+            const Node& node = _nodes.Get()[stack.Pop()];
+            if (!node.Bounds.Intersects(ray))
+                continue;
+            if (node.Height == 0)
+            {
+                if (node.Leaf->IntersectsItself(ray, distance, normal))
+                    results.Add(node.Leaf);
+            }
+            else
+            {
+                stack.Push(node.Children[0]);
+                stack.Push(node.Children[1]);
+            }
+        }
+    }
+
+    template<typename T>
+    void Overlap(const T& bounds, Array<Actor*>& results)
+    {
+        ScopeLock lock(_locker);
+        OverlapTree(bounds, results);
+    }
+
+    void RegisterQuery(SceneQuery::MovingRadiusQuery* query)
+    {
+        ScopeLock lock(_locker);
+        _radiusQueries.Add(query);
+    }
+
+    void UnregisterQuery(SceneQuery::MovingRadiusQuery* query)
+    {
+        ScopeLock lock(_locker);
+        _radiusQueries.Remove(query);
+    }
+
+    void ResetQuery(SceneQuery::MovingRadiusQuery* query)
+    {
+        ScopeLock lock(_locker);
+        query->_inside.Clear();
+    }
+
+    void UpdateQuery(SceneQuery::MovingRadiusQuery* query, const Vector3& center, Real radius)
+    {
+        ScopeLock lock(_locker);
+        const BoundingSphere sphere(center, radius);
+        Array<Actor*> current;
+        OverlapTree(sphere, current);
+
+        // Actors tracked as inside but not intersecting anymore have left the radius (same bounds predicate as the tree walk)
+        for (auto it = query->_inside.Begin(); it.IsNotEnd(); ++it)
+        {
+            Actor* a = it->Item;
+            if (!a->GetBox().Intersects(sphere))
+                query->Left.Add(a);
+        }
+        for (Actor* a : query->Left)
+            query->_inside.Remove(a);
+
+        // Actors in range that were not tracked yet have entered the radius
+        for (Actor* a : current)
+        {
+            if (query->_inside.Add(a))
+                query->Entered.Add(a);
+        }
+    }
+
+    // [ISceneRenderingListener]
+    void OnSceneRenderingAddActor(Actor* a) override
+    {
+        AddActor(a);
+    }
+
+    void OnSceneRenderingUpdateActor(Actor* a, const BoundingSphere& prevBounds) override
+    {
+        ScopeLock lock(_locker);
+        int32 leaf;
+        if (!_leafs.TryGet(a, leaf))
+            return;
+
+        // Skip the tree update if the fat leaf bounds still contain the new actor bounds
+        if (_nodes.Get()[leaf].Bounds.Contains(a->GetBox()) == ContainmentType::Contains)
+            return;
+
+        RemoveLeaf(leaf);
+        SetLeafBounds(leaf, a);
+        InsertLeaf(leaf);
+    }
+
+    void OnSceneRenderingRemoveActor(Actor* a) override
+    {
+        ScopeLock lock(_locker);
+        int32 leaf;
+        if (_leafs.TryGet(a, leaf))
+        {
+            RemoveLeaf(leaf);
+            FreeNode(leaf);
+            _leafs.Remove(a);
+            for (auto* query : _radiusQueries)
+                query->_inside.Remove(a);
+        }
+    }
+
+    void OnSceneRenderingClear(SceneRendering* scene) override
+    {
+        ScopeLock lock(_locker);
+        Array<Actor*> toRemove;
+        for (auto& e : _leafs)
+        {
+            if (&e.Key->GetScene()->Rendering == scene)
+                toRemove.Add(e.Key);
+        }
+        for (Actor* a : toRemove)
+        {
+            int32 leaf;
+            _leafs.TryGet(a, leaf);
+            RemoveLeaf(leaf);
+            FreeNode(leaf);
+            _leafs.Remove(a);
+            for (auto* query : _radiusQueries)
+                query->_inside.Remove(a);
+        }
+    }
+
+private:
+    template<typename T>
+    void OverlapTree(const T& bounds, Array<Actor*>& results)
+    {
+        if (_root == -1)
+            return;
+        Array<int32, InlinedAllocation<64>> stack;
+        stack.Push(_root);
+        while (stack.HasItems())
+        {
+            const Node& node = _nodes.Get()[stack.Pop()];
+            if (!node.Bounds.Intersects(bounds))
+                continue;
+            if (node.Height == 0)
+            {
+                if (node.Leaf->GetBox().Intersects(bounds))
+                    results.Add(node.Leaf);
+            }
+            else
+            {
+                stack.Push(node.Children[0]);
+                stack.Push(node.Children[1]);
+            }
+        }
+    }
+
+    static Real GetArea(const BoundingBox& bounds)
+    {
+        const Vector3 size = bounds.GetSize();
+        return 2 * (size.X * size.Y + size.Y * size.Z + size.Z * size.X);
+    }
+
+    void AddActor(Actor* a)
+    {
+        ScopeLock lock(_locker);
+        if (_leafs.ContainsKey(a))
+            return;
+        const int32 leaf = AllocateNode();
+        SetLeafBounds(leaf, a);
+        _nodes.Get()[leaf].Leaf = a;
+        InsertLeaf(leaf);
+        _leafs.Add(a, leaf);
+    }
+
+    void SetLeafBounds(int32 leaf, Actor* a)
+    {
+        const Vector3 margin(SCENE_QUERIES_BVH_MARGIN);
+        BoundingBox bounds = a->GetBox();
+        bounds.Minimum -= margin;
+        bounds.Maximum += margin;
+        _nodes.Get()[leaf].Bounds = bounds;
+    }
+
+    int32 AllocateNode()
+    {
+        int32 index;
+        if (_freeList != -1)
+        {
+            index = _freeList;
+            _freeList = _nodes.Get()[index].Parent;
+        }
+        else
+        {
+            index = _nodes.Count();
+            _nodes.AddOne();
+        }
+        Node& node = _nodes.Get()[index];
+        node.Leaf = nullptr;
+        node.Parent = -1;
+        node.Children[0] = -1;
+        node.Children[1] = -1;
+        node.Height = 0;
+        return index;
+    }
+
+    void FreeNode(int32 index)
+    {
+        Node& node = _nodes.Get()[index];
+        node.Parent = _freeList;
+        node.Height = -1;
+        _freeList = index;
+    }
+
+    void InsertLeaf(int32 leaf)
+    {
+        if (_root == -1)
+        {
+            _root = leaf;
+            _nodes.Get()[leaf].Parent = -1;
+            return;
+        }
+
+        // Descend to the best sibling for the new leaf (surface area heuristic)
+        const BoundingBox leafBounds = _nodes.Get()[leaf].Bounds;
+        int32 index = _root;
+        while (_nodes.Get()[index].Height != 0)
+        {
+            const Node& node = _nodes.Get()[index];
+            BoundingBox merged;
+            BoundingBox::Merge(node.Bounds, leafBounds, merged);
+            const Real costParent = 2 * GetArea(merged);
+            const Real costInherited = costParent - 2 * GetArea(node.Bounds);
+            Real costChildren[2];
+            for (int32 i = 0; i < 2; i++)
+            {
+                const Node& child = _nodes.Get()[node.Children[i]];
+                BoundingBox::Merge(child.Bounds, leafBounds, merged);
+                costChildren[i] = GetArea(merged) + costInherited;
+                if (child.Height != 0)
+                    costChildren[i] -= GetArea(child.Bounds);
+            }
+            if (costParent < costChildren[0] && costParent < costChildren[1])
+                break;
+            index = node.Children[costChildren[0] < costChildren[1] ? 0 : 1];
+        }
+
+        // Create a new parent for the sibling and the leaf
+        const int32 sibling = index;
+        const int32 oldParent = _nodes.Get()[sibling].Parent;
+        const int32 newParent = AllocateNode();
+        {
+            Node& parentNode = _nodes.Get()[newParent];
+            parentNode.Parent = oldParent;
+            parentNode.Height = _nodes.Get()[sibling].Height + 1;
+            parentNode.Children[0] = sibling;
+            parentNode.Children[1] = leaf;
+            BoundingBox::Merge(leafBounds, _nodes.Get()[sibling].Bounds, parentNode.Bounds);
+        }
+        if (oldParent != -1)
+        {
+            Node& oldParentNode = _nodes.Get()[oldParent];
+            oldParentNode.Children[oldParentNode.Children[0] == sibling ? 0 : 1] = newParent;
+        }
+        else
+        {
+            _root = newParent;
+        }
+        _nodes.Get()[sibling].Parent = newParent;
+        _nodes.Get()[leaf].Parent = newParent;
+
+        Refit(newParent);
+    }
+
+    void RemoveLeaf(int32 leaf)
+    {
+        if (leaf == _root)
+        {
+            _root = -1;
+            return;
+        }
+        const int32 parent = _nodes.Get()[leaf].Parent;
+        const int32 grandParent = _nodes.Get()[parent].Parent;
+        const Node& parentNode = _nodes.Get()[parent];
+        const int32 sibling = parentNode.Children[parentNode.Children[0] == leaf ? 1 : 0];
+        if (grandParent != -1)
+        {
+            Node& grandParentNode = _nodes.Get()[grandParent];
+            grandParentNode.Children[grandParentNode.Children[0] == parent ? 0 : 1] = sibling;
+            _nodes.Get()[sibling].Parent = grandParent;
+            FreeNode(parent);
+            Refit(grandParent);
+        }
+        else
+        {
+            _root = sibling;
+            _nodes.Get()[sibling].Parent = -1;
+            FreeNode(parent);
+        }
+    }
+
+    void Refit(int32 index)
+    {
+        while (index != -1)
+        {
+            index = Balance(index);
+            Node& node = _nodes.Get()[index];
+            const Node& child0 = _nodes.Get()[node.Children[0]];
+            const Node& child1 = _nodes.Get()[node.Children[1]];
+            node.Height = 1 + Math::Max(child0.Height, child1.Height);
+            BoundingBox::Merge(child0.Bounds, child1.Bounds, node.Bounds);
+            index = node.Parent;
+        }
+    }
+
+    // Performs a left or right rotation if the subtree at the given index is unbalanced (AVL-style). Returns the new subtree root.
+    int32 Balance(int32 iA)
+    {
+        Node& a = _nodes.Get()[iA];
+        if (a.Height < 2)
+            return iA;
+        const int32 iB = a.Children[0];
+        const int32 iC = a.Children[1];
+        Node& b = _nodes.Get()[iB];
+        Node& c = _nodes.Get()[iC];
+        const int32 balance = c.Height - b.Height;
+        if (balance > 1)
+        {
+            // Rotate C up
+            const int32 iF = c.Children[0];
+            const int32 iG = c.Children[1];
+            Node& f = _nodes.Get()[iF];
+            Node& g = _nodes.Get()[iG];
+            c.Children[0] = iA;
+            c.Parent = a.Parent;
+            a.Parent = iC;
+            if (c.Parent != -1)
+            {
+                Node& parentNode = _nodes.Get()[c.Parent];
+                parentNode.Children[parentNode.Children[0] == iA ? 0 : 1] = iC;
+            }
+            else
+            {
+                _root = iC;
+            }
+            if (f.Height > g.Height)
+            {
+                c.Children[1] = iF;
+                a.Children[1] = iG;
+                g.Parent = iA;
+                BoundingBox::Merge(b.Bounds, g.Bounds, a.Bounds);
+                BoundingBox::Merge(a.Bounds, f.Bounds, c.Bounds);
+                a.Height = 1 + Math::Max(b.Height, g.Height);
+                c.Height = 1 + Math::Max(a.Height, f.Height);
+            }
+            else
+            {
+                c.Children[1] = iG;
+                a.Children[1] = iF;
+                f.Parent = iA;
+                BoundingBox::Merge(b.Bounds, f.Bounds, a.Bounds);
+                BoundingBox::Merge(a.Bounds, g.Bounds, c.Bounds);
+                a.Height = 1 + Math::Max(b.Height, f.Height);
+                c.Height = 1 + Math::Max(a.Height, g.Height);
+            }
+            return iC;
+        }
+        if (balance < -1)
+        {
+            // Rotate B up
+            const int32 iD = b.Children[0];
+            const int32 iE = b.Children[1];
+            Node& d = _nodes.Get()[iD];
+            Node& e = _nodes.Get()[iE];
+            b.Children[0] = iA;
+            b.Parent = a.Parent;
+            a.Parent = iB;
+            if (b.Parent != -1)
+            {
+                Node& parentNode = _nodes.Get()[b.Parent];
+                parentNode.Children[parentNode.Children[0] == iA ? 0 : 1] = iB;
+            }
+            else
+            {
+                _root = iB;
+            }
+            if (d.Height > e.Height)
+            {
+                b.Children[1] = iD;
+                a.Children[0] = iE;
+                e.Parent = iA;
+                BoundingBox::Merge(c.Bounds, e.Bounds, a.Bounds);
+                BoundingBox::Merge(a.Bounds, d.Bounds, b.Bounds);
+                a.Height = 1 + Math::Max(c.Height, e.Height);
+                b.Height = 1 + Math::Max(a.Height, d.Height);
+            }
+            else
+            {
+                b.Children[1] = iE;
+                a.Children[0] = iD;
+                d.Parent = iA;
+                BoundingBox::Merge(c.Bounds, d.Bounds, a.Bounds);
+                BoundingBox::Merge(a.Bounds, e.Bounds, b.Bounds);
+                a.Height = 1 + Math::Max(c.Height, d.Height);
+                b.Height = 1 + Math::Max(a.Height, e.Height);
+            }
+            return iB;
+        }
+        return iA;
+    }
+};
+
+namespace
+{
+    ActorsBVH* Bvh = nullptr;
+}
+
+SceneQuery::MovingRadiusQuery::~MovingRadiusQuery()
+{
+    if (_registered && Bvh)
+        Bvh->UnregisterQuery(this);
+}
+
+void SceneQuery::MovingRadiusQuery::Update(const Vector3& center, Real radius)
+{
+    PROFILE_CPU();
+    Entered.Clear();
+    Left.Clear();
+    if (Bvh == nullptr)
+        return;
+    if (!_registered)
+    {
+        // Register on the first use so scene changes can prune removed actors from the tracked set
+        Bvh->RegisterQuery(this);
+        _registered = true;
+    }
+    Bvh->UpdateQuery(this, center, radius);
+}
+
+void SceneQuery::MovingRadiusQuery::Reset()
+{
+    if (_registered && Bvh)
+        Bvh->ResetQuery(this);
+    else
+        _inside.Clear();
+}
+
+void OnSceneQuerySceneLoaded(Scene* scene, const Guid& sceneId)
+{
+    Bvh->AddScene(&scene->Rendering);
+}
+
+class SceneQueryService : public EngineService
+{
+public:
+    SceneQueryService()
+        : EngineService(TEXT("Scene Queries"), 35)
+    {
+    }
+
+    bool Init() override
+    {
+        Bvh = New<ActorsBVH>();
+        Level::SceneLoaded.Bind(OnSceneQuerySceneLoaded);
+        return false;
+    }
+
+    void Dispose() override
+    {
+        Level::SceneLoaded.Unbind(OnSceneQuerySceneLoaded);
+        SAFE_DELETE(Bvh);
+    }
+};
+
+SceneQueryService SceneQueryServiceInstance;
+
 Actor* SceneQuery::RaycastScene(const Ray& ray)
 {
     PROFILE_CPU();
@@ -30,6 +554,27 @@ Actor* SceneQuery::RaycastScene(const Ray& ray)
     return minTarget;
 }
 
+void SceneQuery::RayCastAll(const Ray& ray, Array<Actor*>& results)
+{
+    PROFILE_CPU();
+    if (Bvh)
+        Bvh->RayCastAll(ray, results);
+}
+
+void SceneQuery::OverlapBox(const BoundingBox& box, Array<Actor*>& results)
+{
+    PROFILE_CPU();
+    if (Bvh)
+        Bvh->Overlap(box, results);
+}
+
+void SceneQuery::OverlapSphere(const BoundingSphere& sphere, Array<Actor*>& results)
+{
+    PROFILE_CPU();
+    if (Bvh)
+        Bvh->Overlap(sphere, results);
+}
+
 bool GetAllSceneObjectsQuery(Actor* actor, Array<SceneObject*>& objects)
 {
     objects.Add(actor);
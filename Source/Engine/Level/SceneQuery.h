@@ -7,6 +7,7 @@
 
 #include "Level.h"
 #include "Scene/Scene.h"
+#include "Engine/Core/Collections/HashSet.h"
 #if SCENE_QUERIES_WITH_LOCK
 #include "Engine/Threading/Threading.h"
 #endif
@@ -24,6 +25,59 @@ public:
     /// <returns>Hit actor or nothing</returns>
     static Actor* RaycastScene(const Ray& ray);
 
+    /// <summary>
+    /// Finds all actors hit by the given ray. Walks a bounding volume hierarchy maintained incrementally over the actors registered for scene rendering so it's much faster than a full scene tree walk (eg. for AI line-of-sight tests).
+    /// </summary>
+    /// <param name="ray">Ray to test</param>
+    /// <param name="results">The output list of hit actors (appended).</param>
+    static void RayCastAll(const Ray& ray, Array<Actor*>& results);
+
+    /// <summary>
+    /// Finds all actors whose bounds intersect with the given box. Walks a bounding volume hierarchy maintained incrementally over the actors registered for scene rendering.
+    /// </summary>
+    /// <param name="box">Box to test</param>
+    /// <param name="results">The output list of overlapping actors (appended).</param>
+    static void OverlapBox(const BoundingBox& box, Array<Actor*>& results);
+
+    /// <summary>
+    /// Finds all actors whose bounds intersect with the given sphere. Walks a bounding volume hierarchy maintained incrementally over the actors registered for scene rendering.
+    /// </summary>
+    /// <param name="sphere">Sphere to test</param>
+    /// <param name="results">The output list of overlapping actors (appended).</param>
+    static void OverlapSphere(const BoundingSphere& sphere, Array<Actor*>& results);
+
+public:
+    /// <summary>
+    /// Persistent query that tracks the set of actors within a radius around a moving point (eg. streaming or replication relevancy around a player). Each Update moves the point and reports only the delta since the previous update. Uses the same incrementally-maintained bounding volume hierarchy as the other scene queries and runs in full world-space precision (64-bit when large worlds are enabled). Actors removed from the scene are dropped from the tracked set automatically.
+    /// </summary>
+    class FLAXENGINE_API MovingRadiusQuery
+    {
+        friend class ActorsBVH;
+    public:
+        // Actors that entered the radius during the last Update call.
+        Array<Actor*> Entered;
+        // Actors that left the radius during the last Update call.
+        Array<Actor*> Left;
+
+        ~MovingRadiusQuery();
+
+        /// <summary>
+        /// Moves the query point and updates the tracked actors set. Fills Entered and Left with the delta since the previous update.
+        /// </summary>
+        /// <param name="center">The current query point location (world-space).</param>
+        /// <param name="radius">The query radius.</param>
+        void Update(const Vector3& center, Real radius);
+
+        /// <summary>
+        /// Resets the tracked actors set so the next update reports all actors in range as entered.
+        /// </summary>
+        void Reset();
+
+    private:
+        HashSet<Actor*> _inside;
+        bool _registered = false;
+    };
+
 public:
     /// <summary>
     /// Gets all scene objects from the actor into linear list. Appends them (without the given actor).
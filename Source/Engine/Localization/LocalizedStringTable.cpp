@@ -8,6 +8,8 @@
 #if USE_EDITOR
 #include "Engine/Threading/Threading.h"
 #include "Engine/Core/Log.h"
+#else
+#include "Engine/Core/Collections/Sorting.h"
 #endif
 
 REGISTER_JSON_ASSET(LocalizedStringTable, "FlaxEngine.LocalizedStringTable", true);
@@ -23,6 +25,9 @@ void LocalizedStringTable::AddString(const StringView& id, const StringView& val
     auto& values = Entries[id];
     values.Resize(1);
     values[0] = value;
+#if !USE_EDITOR
+    clearIndex();
+#endif
 }
 
 void LocalizedStringTable::AddPluralString(const StringView& id, const StringView& value, int32 n)
@@ -31,14 +36,58 @@ void LocalizedStringTable::AddPluralString(const StringView& id, const StringVie
     auto& values = Entries[id];
     values.Resize(Math::Max(values.Count(), n + 1));
     values[n] = value;
+#if !USE_EDITOR
+    clearIndex();
+#endif
+}
+
+bool LocalizedStringTable::TryGetString(const String& id, int32 index, StringView& result) const
+{
+#if !USE_EDITOR
+    if (_index.HasItems())
+    {
+        const uint32 hash = GetHash(id);
+        int32 start = 0, count = _index.Count();
+        while (count > 0)
+        {
+            const int32 step = count / 2;
+            if (_index.Get()[start + step].IdHash < hash)
+            {
+                start += step + 1;
+                count -= step + 1;
+            }
+            else
+            {
+                count = step;
+            }
+        }
+        for (; start < _index.Count() && _index.Get()[start].IdHash == hash; start++)
+        {
+            const IndexEntry& e = _index.Get()[start];
+            if (e.Id == id)
+            {
+                if (index >= e.ValuesCount)
+                    break;
+                result = _indexValues.Get()[e.ValuesStart + index];
+                return true;
+            }
+        }
+        return false;
+    }
+#endif
+    const auto messages = Entries.TryGet(id);
+    if (messages && messages->Count() > index)
+    {
+        result = messages->At(index);
+        return true;
+    }
+    return false;
 }
 
 String LocalizedStringTable::GetString(const String& id) const
 {
     StringView result;
-    const auto messages = Entries.TryGet(id);
-    if (messages && messages->Count() != 0)
-        result = messages->At(0);
+    TryGetString(id, 0, result);
     if (result.IsEmpty() && FallbackTable)
         result = FallbackTable->GetString(id);
     return result;
@@ -47,14 +96,65 @@ String LocalizedStringTable::GetString(const String& id) const
 String LocalizedStringTable::GetPluralString(const String& id, int32 n) const
 {
     StringView result;
-    const auto messages = Entries.TryGet(id);
-    if (messages && messages->Count() > n)
-        result = messages->At(n);
+    TryGetString(id, n, result);
     if (result.IsEmpty() && FallbackTable)
         result = FallbackTable->GetPluralString(id, n);
     return String::Format(result.GetText(), n);
 }
 
+#if !USE_EDITOR
+
+void LocalizedStringTable::buildIndex()
+{
+    // Calculate storage size upfront so the whole table bakes into a single arena allocation
+    int32 valuesCount = 0, charsCount = 0;
+    for (const auto& e : Entries)
+    {
+        valuesCount += e.Value.Count();
+        charsCount += e.Key.Length() + 1;
+        for (const auto& v : e.Value)
+            charsCount += v.Length() + 1;
+    }
+    clearIndex();
+    _index.EnsureCapacity(Entries.Count());
+    _indexValues.EnsureCapacity(valuesCount);
+    _arena.Resize(charsCount);
+
+    // Bake texts into the arena (null-terminated so views can be used as C-strings for formatting)
+    Char* arena = _arena.Get();
+    int32 offset = 0;
+    for (const auto& e : Entries)
+    {
+        IndexEntry entry;
+        entry.IdHash = GetHash(e.Key);
+        Platform::MemoryCopy(arena + offset, e.Key.Get(), e.Key.Length() * sizeof(Char));
+        arena[offset + e.Key.Length()] = 0;
+        entry.Id = StringView(arena + offset, e.Key.Length());
+        offset += e.Key.Length() + 1;
+        entry.ValuesStart = _indexValues.Count();
+        entry.ValuesCount = e.Value.Count();
+        for (const auto& v : e.Value)
+        {
+            Platform::MemoryCopy(arena + offset, v.Get(), v.Length() * sizeof(Char));
+            arena[offset + v.Length()] = 0;
+            _indexValues.Add(StringView(arena + offset, v.Length()));
+            offset += v.Length() + 1;
+        }
+        _index.Add(entry);
+    }
+
+    Sorting::QuickSort(_index.Get(), _index.Count());
+}
+
+void LocalizedStringTable::clearIndex()
+{
+    _index.Resize(0);
+    _indexValues.Resize(0);
+    _arena.Resize(0);
+}
+
+#endif
+
 Asset::LoadResult LocalizedStringTable::loadAsset()
 {
     // Base
@@ -88,6 +188,9 @@ Asset::LoadResult LocalizedStringTable::loadAsset()
             }
         }
     }
+#if !USE_EDITOR
+    buildIndex();
+#endif
 
     return result;
 }
@@ -100,6 +203,9 @@ void LocalizedStringTable::unload(bool isReloading)
     Locale.Clear();
     FallbackTable = nullptr;
     Entries.Clear();
+#if !USE_EDITOR
+    clearIndex();
+#endif
 }
 
 void LocalizedStringTable::OnGetData(rapidjson_flax::StringBuffer& buffer) const
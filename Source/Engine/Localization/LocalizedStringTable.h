@@ -46,6 +46,15 @@ public:
     /// <param name="n">The plural value (0, 1, 2..).</param>
     API_FUNCTION() void AddPluralString(const StringView& id, const StringView& value, int32 n);
 
+    /// <summary>
+    /// Tries to get the localized text for the message id (without using the fallback table).
+    /// </summary>
+    /// <param name="id">The message identifier.</param>
+    /// <param name="index">The message index (for plural messages the value number, 0 otherwise).</param>
+    /// <param name="result">The result localized text (view into the table storage, valid as long as the table is loaded and unmodified).</param>
+    /// <returns>True if the table contains the message, otherwise false.</returns>
+    bool TryGetString(const String& id, int32 index, StringView& result) const;
+
     /// <summary>
     /// Gets the localized string by using string id lookup. Uses fallback table if text is not included in this table.
     /// </summary>
@@ -61,6 +70,31 @@ public:
     /// <returns>The localized text.</returns>
     API_FUNCTION() String GetPluralString(const String& id, int32 n) const;
 
+private:
+#if !USE_EDITOR
+    // Baked lookup built after load (cooked game only; in editor the Entries dictionary stays the source of truth as it can be edited freely).
+    // All texts live in a single arena buffer and lookups binary-search a flat index sorted by the id hash, so resolving a message touches contiguous memory without any allocations.
+    struct IndexEntry
+    {
+        uint32 IdHash;
+        StringView Id;
+        int32 ValuesStart;
+        int32 ValuesCount;
+
+        FORCE_INLINE bool operator<(const IndexEntry& other) const
+        {
+            return IdHash < other.IdHash;
+        }
+    };
+
+    Array<IndexEntry> _index; // Sorted by IdHash
+    Array<StringView> _indexValues;
+    Array<Char> _arena;
+
+    void buildIndex();
+    void clearIndex();
+#endif
+
 protected:
     // [JsonAssetBase]
     LoadResult loadAsset() override;
@@ -4,8 +4,26 @@
 #include "NavMesh.h"
 #include "NavMeshRuntime.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Threading/JobSystem.h"
 #include <ThirdParty/recastnavigation/DetourCrowd.h>
 
+namespace
+{
+    void CrowdParallelFor(const int count, const int workerCount, void* context, void (*body)(const int begin, const int end, const int worker, void* context))
+    {
+        if (count <= 0)
+            return;
+        // Split so the ranges amount never exceeds the workers count given to dtCrowd::setParallelFor (each range needs an unique worker slot)
+        const int32 granularity = Math::Max((count + workerCount - 1) / workerCount, 1);
+        volatile int64 workerCounter = 0;
+        JobSystem::ParallelFor(0, count, granularity, [&workerCounter, body, context](int32 begin, int32 end)
+        {
+            const int32 worker = (int32)Platform::InterlockedIncrement(&workerCounter) - 1;
+            body(begin, end, worker, context);
+        });
+    }
+}
+
 NavCrowd::NavCrowd(const SpawnParams& params)
     : ScriptingObject(params)
 {
@@ -33,7 +51,15 @@ bool NavCrowd::Init(float maxAgentRadius, int32 maxAgents, NavMeshRuntime* navMe
 {
     if (!_crowd || !navMesh)
         return true;
-    return !_crowd->init(maxAgents, maxAgentRadius, navMesh->GetNavMesh());
+    if (!_crowd->init(maxAgents, maxAgentRadius, navMesh->GetNavMesh()))
+        return true;
+
+    // Plan the agents velocities on the Job System workers when simulating larger crowds (the heaviest update step for crowded scenarios)
+    const int32 workers = Math::Min(JobSystem::GetThreadsCount(), maxAgents / 16);
+    if (workers > 1)
+        _crowd->setParallelFor(CrowdParallelFor, workers);
+
+    return false;
 }
 
 int32 NavCrowd::AddAgent(const Vector3& position, const NavAgentProperties& properties)
@@ -2,6 +2,7 @@
 
 #include "NavMesh.h"
 #include "NavMeshRuntime.h"
+#include "NavMeshBuilder.h"
 #include "Engine/Level/Scene/Scene.h"
 #include "Engine/Serialization/Serialization.h"
 #if COMPILE_WITH_ASSETS_IMPORTER
@@ -162,6 +163,9 @@ void NavMesh::OnEnable()
 
 void NavMesh::OnDisable()
 {
+#if COMPILE_WITH_NAV_MESH_BUILDER
+    NavMeshBuilder::ClearCache(this);
+#endif
     RemoveTiles();
     GetScene()->Navigation.Meshes.Remove(this);
 
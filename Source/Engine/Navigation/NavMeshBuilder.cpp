@@ -24,6 +24,8 @@
 #include "Engine/Level/Scene/Scene.h"
 #include "Engine/Level/Level.h"
 #include "Engine/Level/SceneQuery.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Utilities/Crc.h"
 #include <ThirdParty/recastnavigation/Recast.h>
 #include <ThirdParty/recastnavigation/DetourNavMeshBuilder.h>
 #include <ThirdParty/recastnavigation/DetourNavMesh.h>
@@ -68,6 +70,75 @@ struct Modifier
     NavAreaProperties* NavArea;
 };
 
+// Cached intermediate tile data (post-erode compact heightfield) used to skip geometry rasterization when rebuilding a tile with unchanged geometry
+struct NavMeshTileCacheKey
+{
+    NavMesh* Mesh;
+    int32 X;
+    int32 Y;
+
+    bool operator==(const NavMeshTileCacheKey& other) const
+    {
+        return Mesh == other.Mesh && X == other.X && Y == other.Y;
+    }
+
+    friend uint32 GetHash(const NavMeshTileCacheKey& key)
+    {
+        uint32 hash = (uint32)((int64)key.Mesh >> 3);
+        hash = (hash * 397) ^ (uint32)key.X;
+        hash = (hash * 397) ^ (uint32)key.Y;
+        return hash;
+    }
+};
+
+struct NavMeshTileCacheEntry
+{
+    uint32 Hash = 0;
+    rcCompactHeightfield* Data = nullptr;
+};
+
+namespace
+{
+    CriticalSection TileCacheLocker;
+    Dictionary<NavMeshTileCacheKey, NavMeshTileCacheEntry> TileCache;
+}
+
+rcCompactHeightfield* CloneCompactHeightfield(const rcCompactHeightfield& src)
+{
+    rcCompactHeightfield* dst = rcAllocCompactHeightfield();
+    if (!dst)
+        return nullptr;
+    dst->width = src.width;
+    dst->height = src.height;
+    dst->spanCount = src.spanCount;
+    dst->walkableHeight = src.walkableHeight;
+    dst->walkableClimb = src.walkableClimb;
+    dst->borderSize = src.borderSize;
+    dst->maxDistance = src.maxDistance;
+    dst->maxRegions = src.maxRegions;
+    rcVcopy(dst->bmin, src.bmin);
+    rcVcopy(dst->bmax, src.bmax);
+    dst->cs = src.cs;
+    dst->ch = src.ch;
+    const int32 cellsCount = src.width * src.height;
+    dst->cells = (rcCompactCell*)rcAlloc(sizeof(rcCompactCell) * cellsCount, RC_ALLOC_PERM);
+    dst->spans = (rcCompactSpan*)rcAlloc(sizeof(rcCompactSpan) * src.spanCount, RC_ALLOC_PERM);
+    dst->areas = (unsigned char*)rcAlloc(sizeof(unsigned char) * src.spanCount, RC_ALLOC_PERM);
+    if (src.dist)
+        dst->dist = (unsigned short*)rcAlloc(sizeof(unsigned short) * src.spanCount, RC_ALLOC_PERM);
+    if (!dst->cells || !dst->spans || !dst->areas || (src.dist && !dst->dist))
+    {
+        rcFreeCompactHeightfield(dst);
+        return nullptr;
+    }
+    Platform::MemoryCopy(dst->cells, src.cells, sizeof(rcCompactCell) * cellsCount);
+    Platform::MemoryCopy(dst->spans, src.spans, sizeof(rcCompactSpan) * src.spanCount);
+    Platform::MemoryCopy(dst->areas, src.areas, sizeof(unsigned char) * src.spanCount);
+    if (src.dist)
+        Platform::MemoryCopy(dst->dist, src.dist, sizeof(unsigned short) * src.spanCount);
+    return dst;
+}
+
 struct NavigationSceneRasterization
 {
     NavMesh* NavMesh;
@@ -81,6 +152,7 @@ struct NavigationSceneRasterization
     Array<int32> IndexBuffer;
     Array<OffMeshLink>* OffMeshLinks;
     Array<Modifier>* Modifiers;
+    uint32* GeometryHash = nullptr;
     const bool IsWorldToNavMeshIdentity;
 
     NavigationSceneRasterization(::NavMesh* navMesh, const BoundingBox& tileBoundsNavMesh, const Matrix& worldToNavMesh, rcContext* context, rcConfig* config, rcHeightfield* heightfield, Array<OffMeshLink>* offMeshLinks, Array<Modifier>* modifiers)
@@ -97,6 +169,19 @@ struct NavigationSceneRasterization
         Modifiers = modifiers;
     }
 
+    bool HashGeometry(const Actor* actor)
+    {
+        if (!GeometryHash)
+            return false;
+
+        // Fold the actor identity and placement so any geometry change invalidates the cached tile data
+        uint32 hash = ::GetHash(actor->GetID());
+        const Transform transform = actor->GetTransform();
+        hash = Crc::MemCrc32(&transform, sizeof(transform), hash);
+        *GeometryHash ^= hash + 0x9e3779b9 + (*GeometryHash << 6) + (*GeometryHash >> 2);
+        return true;
+    }
+
     void RasterizeTriangles()
     {
         auto& vb = VertexBuffer;
@@ -238,6 +323,9 @@ struct NavigationSceneRasterization
                 return true;
             PROFILE_CPU_NAMED("BoxCollider");
 
+            if (e.HashGeometry(actor))
+                return true;
+
             const OrientedBoundingBox box = boxCollider->GetOrientedBox();
             TriangulateBox(vb, ib, box);
 
@@ -249,6 +337,9 @@ struct NavigationSceneRasterization
                 return true;
             PROFILE_CPU_NAMED("SphereCollider");
 
+            if (e.HashGeometry(actor))
+                return true;
+
             const BoundingSphere sphere = sphereCollider->GetSphere();
             TriangulateSphere(vb, ib, sphere);
 
@@ -260,6 +351,9 @@ struct NavigationSceneRasterization
                 return true;
             PROFILE_CPU_NAMED("CapsuleCollider");
 
+            if (e.HashGeometry(actor))
+                return true;
+
             const BoundingBox box = capsuleCollider->GetBox();
             TriangulateBox(vb, ib, box);
 
@@ -271,6 +365,9 @@ struct NavigationSceneRasterization
                 return true;
             PROFILE_CPU_NAMED("MeshCollider");
 
+            if (e.HashGeometry(actor))
+                return true;
+
             auto collisionData = meshCollider->CollisionData.Get();
             if (!collisionData || collisionData->WaitForLoaded())
                 return true;
@@ -290,6 +387,9 @@ struct NavigationSceneRasterization
                 return true;
             PROFILE_CPU_NAMED("SplineCollider");
 
+            if (e.HashGeometry(actor))
+                return true;
+
             auto collisionData = splineCollider->CollisionData.Get();
             if (!collisionData || collisionData->WaitForLoaded())
                 return true;
@@ -302,6 +402,17 @@ struct NavigationSceneRasterization
         {
             PROFILE_CPU_NAMED("Terrain");
 
+            if (e.HashGeometry(actor))
+            {
+                // Fold the patches bounds to catch terrain height edits
+                for (int32 patchIndex = 0; patchIndex < terrain->GetPatchesCount(); patchIndex++)
+                {
+                    const BoundingBox patchBounds = terrain->GetPatch(patchIndex)->GetBounds();
+                    *e.GeometryHash = Crc::MemCrc32(&patchBounds, sizeof(patchBounds), *e.GeometryHash);
+                }
+                return true;
+            }
+
             for (int32 patchIndex = 0; patchIndex < terrain->GetPatchesCount(); patchIndex++)
             {
                 const auto patch = terrain->GetPatch(patchIndex);
@@ -441,44 +552,83 @@ bool GenerateTile(NavMesh* navMesh, NavMeshRuntime* runtime, int32 x, int32 y, B
     *(Float3*)&config.bmin = tileBoundsNavMesh.Minimum;
     *(Float3*)&config.bmax = tileBoundsNavMesh.Maximum;
 
-    rcHeightfield* heightfield = rcAllocHeightfield();
-    if (!heightfield)
-    {
-        LOG(Warning, "Could not generate navmesh: Out of memory for heightfield.");
-        return true;
-    }
-    if (!rcCreateHeightfield(&context, *heightfield, config.width, config.height, config.bmin, config.bmax, config.cs, config.ch))
-    {
-        LOG(Warning, "Could not generate navmesh: Could not create solid heightfield.");
-        return true;
-    }
-
+    // Gather off-mesh links and modifiers and hash the tile geometry (cheap scene walk without geometry extraction)
     Array<OffMeshLink> offMeshLinks;
     Array<Modifier> modifiers;
-    RasterizeGeometry(navMesh, tileBoundsNavMesh, worldToNavMesh, &context, &config, heightfield, &offMeshLinks, &modifiers);
+    uint32 geometryHash = Crc::MemCrc32(&config, sizeof(config));
+    {
+        PROFILE_CPU_NAMED("HashGeometry");
+        NavigationSceneRasterization rasterization(navMesh, tileBoundsNavMesh, worldToNavMesh, &context, &config, nullptr, &offMeshLinks, &modifiers);
+        rasterization.GeometryHash = &geometryHash;
+        Function<bool(Actor*, NavigationSceneRasterization&)> treeWalkFunction(NavigationSceneRasterization::Walk);
+        SceneQuery::TreeExecute<NavigationSceneRasterization&>(treeWalkFunction, rasterization);
+    }
 
-    rcFilterLowHangingWalkableObstacles(&context, config.walkableClimb, *heightfield);
-    rcFilterLedgeSpans(&context, config.walkableHeight, config.walkableClimb, *heightfield);
-    rcFilterWalkableLowHeightSpans(&context, config.walkableHeight, *heightfield);
+    // Reuse the cached intermediate tile data if the geometry has not changed so only the cheap final stages run (eg. when only modifier volumes changed)
+    rcCompactHeightfield* compactHeightfield = nullptr;
+    const NavMeshTileCacheKey cacheKey = { navMesh, x, y };
+    TileCacheLocker.Lock();
+    NavMeshTileCacheEntry cacheEntry;
+    if (TileCache.TryGet(cacheKey, cacheEntry) && cacheEntry.Hash == geometryHash)
+        compactHeightfield = CloneCompactHeightfield(*cacheEntry.Data);
+    TileCacheLocker.Unlock();
 
-    rcCompactHeightfield* compactHeightfield = rcAllocCompactHeightfield();
     if (!compactHeightfield)
     {
-        LOG(Warning, "Could not generate navmesh: Out of memory compact heightfield.");
-        return true;
-    }
-    if (!rcBuildCompactHeightfield(&context, config.walkableHeight, config.walkableClimb, *heightfield, *compactHeightfield))
-    {
-        LOG(Warning, "Could not generate navmesh: Could not build compact data.");
-        return true;
-    }
+        rcHeightfield* heightfield = rcAllocHeightfield();
+        if (!heightfield)
+        {
+            LOG(Warning, "Could not generate navmesh: Out of memory for heightfield.");
+            return true;
+        }
+        if (!rcCreateHeightfield(&context, *heightfield, config.width, config.height, config.bmin, config.bmax, config.cs, config.ch))
+        {
+            LOG(Warning, "Could not generate navmesh: Could not create solid heightfield.");
+            return true;
+        }
 
-    rcFreeHeightField(heightfield);
+        {
+            // Links and modifiers have been gathered during the hashing walk already
+            Array<OffMeshLink> tmpOffMeshLinks;
+            Array<Modifier> tmpModifiers;
+            RasterizeGeometry(navMesh, tileBoundsNavMesh, worldToNavMesh, &context, &config, heightfield, &tmpOffMeshLinks, &tmpModifiers);
+        }
 
-    if (!rcErodeWalkableArea(&context, config.walkableRadius, *compactHeightfield))
-    {
-        LOG(Warning, "Could not generate navmesh: Could not erode.");
-        return true;
+        rcFilterLowHangingWalkableObstacles(&context, config.walkableClimb, *heightfield);
+        rcFilterLedgeSpans(&context, config.walkableHeight, config.walkableClimb, *heightfield);
+        rcFilterWalkableLowHeightSpans(&context, config.walkableHeight, *heightfield);
+
+        compactHeightfield = rcAllocCompactHeightfield();
+        if (!compactHeightfield)
+        {
+            LOG(Warning, "Could not generate navmesh: Out of memory compact heightfield.");
+            return true;
+        }
+        if (!rcBuildCompactHeightfield(&context, config.walkableHeight, config.walkableClimb, *heightfield, *compactHeightfield))
+        {
+            LOG(Warning, "Could not generate navmesh: Could not build compact data.");
+            return true;
+        }
+
+        rcFreeHeightField(heightfield);
+
+        if (!rcErodeWalkableArea(&context, config.walkableRadius, *compactHeightfield))
+        {
+            LOG(Warning, "Could not generate navmesh: Could not erode.");
+            return true;
+        }
+
+        // Cache a copy of the post-erode data for the next incremental rebuild of this tile
+        if (rcCompactHeightfield* copy = CloneCompactHeightfield(*compactHeightfield))
+        {
+            TileCacheLocker.Lock();
+            NavMeshTileCacheEntry& entry = TileCache[cacheKey];
+            if (entry.Data)
+                rcFreeCompactHeightfield(entry.Data);
+            entry.Hash = geometryHash;
+            entry.Data = copy;
+            TileCacheLocker.Unlock();
+        }
     }
 
     // Mark areas
@@ -792,6 +942,19 @@ void NavMeshBuilder::Init()
     Level::SceneUnloading.Bind<OnSceneUnloading>();
 }
 
+void NavMeshBuilder::ClearCache(NavMesh* navMesh)
+{
+    ScopeLock lock(TileCacheLocker);
+    for (auto it = TileCache.Begin(); it.IsNotEnd(); ++it)
+    {
+        if (it->Key.Mesh == navMesh)
+        {
+            rcFreeCompactHeightfield(it->Value.Data);
+            TileCache.Remove(it);
+        }
+    }
+}
+
 bool NavMeshBuilder::IsBuildingNavMesh()
 {
     NavBuildTasksLocker.Lock();
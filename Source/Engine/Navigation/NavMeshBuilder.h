@@ -7,6 +7,7 @@
 #include "Engine/Core/Types/BaseTypes.h"
 
 class Scene;
+class NavMesh;
 
 /// <summary>
 /// The navigation mesh building utility.
@@ -15,6 +16,7 @@ class FLAXENGINE_API NavMeshBuilder
 {
 public:
     static void Init();
+    static void ClearCache(NavMesh* navMesh);
     static bool IsBuildingNavMesh();
     static float GetNavMeshBuildingProgress();
     static void Update();
@@ -7,6 +7,7 @@
 #include "Engine/Core/Random.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Threading/Threading.h"
+#include "Engine/Threading/JobSystem.h"
 #include <ThirdParty/recastnavigation/DetourNavMesh.h>
 #include <ThirdParty/recastnavigation/DetourNavMeshQuery.h>
 #include <ThirdParty/recastnavigation/RecastAlloc.h>
@@ -22,6 +23,39 @@ namespace
     {
         Platform::MemoryCopy(filter.m_areaCost, NavMeshRuntime::NavAreasCosts, sizeof(NavMeshRuntime::NavAreasCosts));
     }
+
+    bool FindStraightPath(const NavMeshProperties& properties, dtNavMeshQuery* query, const Vector3& startPosition, const Float3& startPositionNavMesh, Float3 endPositionNavMesh, dtPolyRef startPoly, dtPolyRef* path, int32 pathSize, bool partial, Array<Vector3, HeapAllocation>& resultPath)
+    {
+        Quaternion invRotation;
+        Quaternion::Invert(properties.Rotation, invRotation);
+
+        if (pathSize == 1 && partial)
+        {
+            // TODO: skip adding 2nd end point if it's not reachable (use navmesh raycast check? or physics check? or local Z distance check?)
+            resultPath.Resize(2);
+            resultPath[0] = startPosition;
+            query->closestPointOnPolyBoundary(startPoly, &endPositionNavMesh.X, &endPositionNavMesh.X);
+            resultPath[1] = endPositionNavMesh;
+            Vector3::Transform(resultPath[1], invRotation, resultPath[1]);
+        }
+        else
+        {
+            int pathPointsCount = 0;
+            Float3 pathPoints[NAV_MESH_PATH_MAX_SIZE];
+            const auto findStraightPathStatus = query->findStraightPath(&startPositionNavMesh.X, &endPositionNavMesh.X, path, pathSize, (float*)&pathPoints, nullptr, nullptr, &pathPointsCount, NAV_MESH_PATH_MAX_SIZE, DT_STRAIGHTPATH_AREA_CROSSINGS);
+            if (dtStatusFailed(findStraightPathStatus))
+            {
+                return false;
+            }
+            resultPath.Resize(pathPointsCount);
+            for (int32 i = 0; i < pathPointsCount; i++)
+            {
+                Vector3::Transform(pathPoints[i], invRotation, resultPath[i]);
+            }
+        }
+
+        return true;
+    }
 }
 
 NavMeshRuntime::NavMeshRuntime(const NavMeshProperties& properties)
@@ -29,13 +63,19 @@ NavMeshRuntime::NavMeshRuntime(const NavMeshProperties& properties)
 {
     _navMesh = nullptr;
     _navMeshQuery = dtAllocNavMeshQuery();
+    _asyncQuery = dtAllocNavMeshQuery();
+    _asyncFilter = New<dtQueryFilter>();
     _tileSize = 0;
+    _pathQueriesActive = 0;
+    _restartPathQuery = false;
 }
 
 NavMeshRuntime::~NavMeshRuntime()
 {
     dtFreeNavMesh(_navMesh);
     dtFreeNavMeshQuery(_navMeshQuery);
+    dtFreeNavMeshQuery(_asyncQuery);
+    Delete(_asyncFilter);
 }
 
 int32 NavMeshRuntime::GetTilesCapacity() const
@@ -115,35 +155,130 @@ bool NavMeshRuntime::FindPath(const Vector3& startPosition, const Vector3& endPo
         return false;
     }
 
-    Quaternion invRotation;
-    Quaternion::Invert(Properties.Rotation, invRotation);
+    const bool partial = dtStatusDetail(findPathStatus, DT_PARTIAL_RESULT);
+    return FindStraightPath(Properties, query, startPosition, startPositionNavMesh, endPositionNavMesh, startPoly, path, pathSize, partial, resultPath);
+}
 
-    if (pathSize == 1 && dtStatusDetail(findPathStatus, DT_PARTIAL_RESULT))
-    {
-        // TODO: skip adding 2nd end point if it's not reachable (use navmesh raycast check? or physics check? or local Z distance check?)
-        resultPath.Resize(2);
-        resultPath[0] = startPosition;
-        query->closestPointOnPolyBoundary(startPoly, &endPositionNavMesh.X, &endPositionNavMesh.X);
-        resultPath[1] = endPositionNavMesh;
-        Vector3::Transform(resultPath[1], invRotation, resultPath[1]);
-    }
-    else
+NavMeshPathQuery* NavMeshRuntime::FindPathAsync(const Vector3& startPosition, const Vector3& endPosition, const Function<void(NavMeshPathQuery*)>& callback)
+{
+    auto query = New<NavMeshPathQuery>();
+    query->StartPosition = startPosition;
+    query->EndPosition = endPosition;
+    query->Callback = callback;
+    ScopeLock lock(_pathQueriesLocker);
+    _pathQueries.Add(query);
+    return query;
+}
+
+bool NavMeshRuntime::CancelPathQuery(NavMeshPathQuery* query)
+{
+    ScopeLock lock(_pathQueriesLocker);
+    const int32 index = _pathQueries.Find(query);
+    if (index == -1)
+        return false;
+    // If it was the active sliced search then its state gets reset when the next query starts
+    _pathQueries.RemoveAtKeepOrder(index);
+    Delete(query);
+    return true;
+}
+
+void NavMeshRuntime::UpdatePathQueries()
+{
+    if (_pathQueries.IsEmpty())
+        return;
+    if (Platform::InterlockedCompareExchange(&_pathQueriesActive, 1, 0) != 0)
+        return; // The previous slice is still executing
+    JobSystem::Dispatch([this](int32)
     {
-        int pathPointsCount = 0;
-        Float3 pathPoints[NAV_MESH_PATH_MAX_SIZE];
-        const auto findStraightPathStatus = query->findStraightPath(&startPositionNavMesh.X, &endPositionNavMesh.X, path, pathSize, (float*)&pathPoints, nullptr, nullptr, &pathPointsCount, NAV_MESH_PATH_MAX_SIZE, DT_STRAIGHTPATH_AREA_CROSSINGS);
-        if (dtStatusFailed(findStraightPathStatus))
+        PROFILE_CPU_NAMED("NavMeshRuntime.PathQueries");
+        int32 budget = Math::Max(NavigationSettings::Get()->AsyncPathfindingNodesPerFrame, 64);
+        Array<NavMeshPathQuery*, InlinedAllocation<8>> finished;
         {
-            return false;
+            ScopeLock queueLock(_pathQueriesLocker);
+            while (budget > 0 && _pathQueries.HasItems())
+            {
+                const auto request = _pathQueries.First();
+                auto state = NavMeshPathQuery::States::Failed;
+                ScopeLock lock(Locker);
+                if (_asyncQuery && _navMesh)
+                {
+                    // Restart the search if the navmesh has been rebuilt during slicing
+                    if (_restartPathQuery)
+                    {
+                        if ((NavMeshPathQuery::States)request->State == NavMeshPathQuery::States::Processing)
+                            Platform::InterlockedExchange(&request->State, (int64)NavMeshPathQuery::States::Pending);
+                        _restartPathQuery = false;
+                    }
+
+                    state = (NavMeshPathQuery::States)request->State;
+                    if (state == NavMeshPathQuery::States::Pending)
+                    {
+                        // Initialize the sliced search
+                        InitFilter(*_asyncFilter);
+                        Float3 extent = Properties.DefaultQueryExtent;
+                        Float3 startPositionNavMesh, endPositionNavMesh;
+                        Float3::Transform(request->StartPosition, Properties.Rotation, startPositionNavMesh);
+                        Float3::Transform(request->EndPosition, Properties.Rotation, endPositionNavMesh);
+                        dtPolyRef startPoly = 0, endPoly = 0;
+                        _asyncQuery->findNearestPoly(&startPositionNavMesh.X, &extent.X, _asyncFilter, &startPoly, nullptr);
+                        _asyncQuery->findNearestPoly(&endPositionNavMesh.X, &extent.X, _asyncFilter, &endPoly, nullptr);
+                        budget -= 16; // Approximated cost of the nearest polygons lookup
+                        if (startPoly && endPoly && dtStatusSucceed(_asyncQuery->initSlicedFindPath(startPoly, endPoly, &startPositionNavMesh.X, &endPositionNavMesh.X, _asyncFilter)))
+                        {
+                            request->_startPositionNavMesh = startPositionNavMesh;
+                            request->_endPositionNavMesh = endPositionNavMesh;
+                            request->_startPoly = startPoly;
+                            state = NavMeshPathQuery::States::Processing;
+                        }
+                        else
+                        {
+                            state = NavMeshPathQuery::States::Failed;
+                        }
+                    }
+
+                    if (state == NavMeshPathQuery::States::Processing)
+                    {
+                        // Expand the search up to the remaining nodes budget
+                        int doneIters = 0;
+                        const auto updateStatus = _asyncQuery->updateSlicedFindPath(budget, &doneIters);
+                        budget -= Math::Max(doneIters, 1);
+                        if (dtStatusInProgress(updateStatus))
+                        {
+                            // Out of budget, resume during the next update
+                            Platform::InterlockedExchange(&request->State, (int64)state);
+                            break;
+                        }
+
+                        dtPolyRef path[NAV_MESH_PATH_MAX_SIZE];
+                        int pathSize = 0;
+                        const auto finalizeStatus = _asyncQuery->finalizeSlicedFindPath(path, &pathSize, NAV_MESH_PATH_MAX_SIZE);
+                        if (dtStatusFailed(finalizeStatus) || pathSize == 0)
+                        {
+                            state = NavMeshPathQuery::States::Failed;
+                        }
+                        else
+                        {
+                            const bool partial = dtStatusDetail(finalizeStatus, DT_PARTIAL_RESULT);
+                            state = FindStraightPath(Properties, _asyncQuery, request->StartPosition, request->_startPositionNavMesh, request->_endPositionNavMesh, (dtPolyRef)request->_startPoly, path, pathSize, partial, request->Path) ? NavMeshPathQuery::States::Success : NavMeshPathQuery::States::Failed;
+                        }
+                    }
+                }
+
+                // Query done
+                Platform::InterlockedExchange(&request->State, (int64)state);
+                _pathQueries.RemoveAtKeepOrder(0);
+                finished.Add(request);
+            }
         }
-        resultPath.Resize(pathPointsCount);
-        for (int32 i = 0; i < pathPointsCount; i++)
+
+        // Invoke the callbacks without holding the locks (the caller owns the finished queries now)
+        for (const auto request : finished)
         {
-            Vector3::Transform(pathPoints[i], invRotation, resultPath[i]);
+            if (request->Callback.IsBinded())
+                request->Callback(request);
         }
-    }
-
-    return true;
+        Platform::InterlockedExchange(&_pathQueriesActive, 0);
+    });
 }
 
 bool NavMeshRuntime::TestPath(const Vector3& startPosition, const Vector3& endPosition) const
@@ -335,6 +470,7 @@ void NavMeshRuntime::SetTileSize(float tileSize)
         dtFreeNavMesh(_navMesh);
         _navMesh = nullptr;
         _tiles.Clear();
+        _restartPathQuery = true;
     }
 
     _tileSize = tileSize;
@@ -371,6 +507,11 @@ void NavMeshRuntime::EnsureCapacity(int32 tilesToAddCount)
     {
         LOG(Error, "Failed to initialize navmesh {0}.", Properties.Name);
     }
+    if (dtStatusFailed(_asyncQuery->init(_navMesh, MAX_NODES)))
+    {
+        LOG(Error, "Failed to initialize navmesh {0} async query.", Properties.Name);
+    }
+    _restartPathQuery = true;
 
     // Prepare parameters
     dtNavMeshParams params;
@@ -653,10 +794,26 @@ void NavMeshRuntime::DebugDraw()
 
 void NavMeshRuntime::Dispose()
 {
+    // Fail any queued path queries (the callers own the query objects)
+    Array<NavMeshPathQuery*, InlinedAllocation<8>> pathQueries;
+    {
+        ScopeLock lock(_pathQueriesLocker);
+        pathQueries.Add(_pathQueries);
+        _pathQueries.Clear();
+    }
+    for (const auto request : pathQueries)
+    {
+        Platform::InterlockedExchange(&request->State, (int64)NavMeshPathQuery::States::Failed);
+        if (request->Callback.IsBinded())
+            request->Callback(request);
+    }
+
+    ScopeLock lock(Locker);
     if (_navMesh)
     {
         dtFreeNavMesh(_navMesh);
         _navMesh = nullptr;
+        _restartPathQuery = true;
     }
     _tiles.Resize(0);
 }
@@ -3,13 +3,16 @@
 #pragma once
 
 #include "Engine/Core/Types/BaseTypes.h"
+#include "Engine/Core/Delegate.h"
 #include "Engine/Platform/CriticalSection.h"
 #include "NavMeshData.h"
 #include "NavigationTypes.h"
 
 class dtNavMesh;
 class dtNavMeshQuery;
+class dtQueryFilter;
 class NavMesh;
+class NavMeshRuntime;
 
 /// <summary>
 /// The navigation mesh tile data.
@@ -24,6 +27,60 @@ public:
     BytesContainer Data;
 };
 
+/// <summary>
+/// The asynchronous navmesh path finding query. Submitted via NavMeshRuntime::FindPathAsync and executed in slices on the Job System with a per-frame node-expansion budget (see NavigationSettings.AsyncPathfindingNodesPerFrame). Poll State or use the Callback to get the result. The caller owns the query object: delete it once done or cancel it via NavMeshRuntime::CancelPathQuery.
+/// </summary>
+class FLAXENGINE_API NavMeshPathQuery
+{
+    friend NavMeshRuntime;
+public:
+    /// <summary>
+    /// The asynchronous path query execution and result states.
+    /// </summary>
+    enum class States : int64
+    {
+        // The query waits in the requests queue.
+        Pending = 0,
+        // The query is being processed in slices on a background worker.
+        Processing,
+        // The query finished and the Path contains a valid result (it may be partial).
+        Success,
+        // The query failed to find any path.
+        Failed,
+    };
+
+    /// <summary>
+    /// The current query state (of type States). Written by the background worker, safe to poll from any thread.
+    /// </summary>
+    volatile int64 State = (int64)States::Pending;
+
+    /// <summary>
+    /// The path start position (in world-space).
+    /// </summary>
+    Vector3 StartPosition;
+
+    /// <summary>
+    /// The path end position (in world-space).
+    /// </summary>
+    Vector3 EndPosition;
+
+    /// <summary>
+    /// The result path waypoints. Valid only when State is Success.
+    /// </summary>
+    Array<Vector3> Path;
+
+    /// <summary>
+    /// The optional callback invoked when the query finishes (called from a worker thread).
+    /// </summary>
+    Function<void(NavMeshPathQuery*)> Callback;
+
+private:
+    // Sliced search continuation state (used by the worker)
+    Float3 _startPositionNavMesh;
+    Float3 _endPositionNavMesh;
+    uint64 _startPoly = 0;
+};
+
 /// <summary>
 /// The navigation mesh runtime object that builds the navmesh from all loaded scenes.
 /// </summary>
@@ -51,8 +108,14 @@ public:
 private:
     dtNavMesh* _navMesh;
     dtNavMeshQuery* _navMeshQuery;
+    dtNavMeshQuery* _asyncQuery;
+    dtQueryFilter* _asyncFilter;
     float _tileSize;
     Array<NavMeshTile> _tiles;
+    Array<NavMeshPathQuery*> _pathQueries;
+    CriticalSection _pathQueriesLocker;
+    volatile int64 _pathQueriesActive;
+    bool _restartPathQuery;
 
 public:
     NavMeshRuntime(const NavMeshProperties& properties);
@@ -108,6 +171,27 @@ public:
     /// <returns>True if found valid path between given two points (it may be partial), otherwise false if failed.</returns>
     bool FindPath(const Vector3& startPosition, const Vector3& endPosition, Array<Vector3, HeapAllocation>& resultPath) const;
 
+    /// <summary>
+    /// Submits an asynchronous path finding query. The search runs in slices on the Job System with a per-frame node-expansion budget so a burst of repath requests doesn't stall the game update. Poll the returned query State or use the callback to get the result.
+    /// </summary>
+    /// <param name="startPosition">The start position.</param>
+    /// <param name="endPosition">The end position.</param>
+    /// <param name="callback">The optional callback to invoke when the query finishes (called from a worker thread).</param>
+    /// <returns>The path query object, owned by the caller. Delete it once the result has been consumed or cancel it via CancelPathQuery.</returns>
+    NavMeshPathQuery* FindPathAsync(const Vector3& startPosition, const Vector3& endPosition, const Function<void(NavMeshPathQuery*)>& callback = Function<void(NavMeshPathQuery*)>());
+
+    /// <summary>
+    /// Cancels the queued asynchronous path query and deletes it.
+    /// </summary>
+    /// <param name="query">The path query returned by FindPathAsync.</param>
+    /// <returns>True if the query has been removed from the queue and deleted, otherwise false if it already finished (the caller still owns it and has to delete it).</returns>
+    bool CancelPathQuery(NavMeshPathQuery* query);
+
+    /// <summary>
+    /// Processes the queued asynchronous path queries (dispatches a Job System slice limited by the per-frame budget). Called by the navigation service on update.
+    /// </summary>
+    void UpdatePathQueries();
+
     /// <summary>
     /// Tests the path between the two positions (non-partial).
     /// </summary>
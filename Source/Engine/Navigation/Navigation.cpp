@@ -166,9 +166,7 @@ public:
     }
 
     bool Init() override;
-#if COMPILE_WITH_NAV_MESH_BUILDER
     void Update() override;
-#endif
     void Dispose() override;
 };
 
@@ -226,6 +224,7 @@ void NavigationSettings::Deserialize(DeserializeStream& stream, ISerializeModifi
 {
     DESERIALIZE(AutoAddMissingNavMeshes);
     DESERIALIZE(AutoRemoveMissingNavMeshes);
+    DESERIALIZE(AsyncPathfindingNodesPerFrame);
     DESERIALIZE(CellHeight);
     DESERIALIZE(CellSize);
     DESERIALIZE(TileSize);
@@ -270,15 +269,17 @@ bool NavigationService::Init()
     return false;
 }
 
-#if COMPILE_WITH_NAV_MESH_BUILDER
-
 void NavigationService::Update()
 {
+#if COMPILE_WITH_NAV_MESH_BUILDER
     NavMeshBuilder::Update();
-}
-
 #endif
 
+    // Process the asynchronous pathfinding queries
+    for (auto navMesh : NavMeshes)
+        navMesh->UpdatePathQueries();
+}
+
 void NavigationService::Dispose()
 {
     // Release nav meshes
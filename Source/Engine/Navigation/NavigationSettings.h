@@ -25,6 +25,12 @@ public:
     API_FIELD(Attributes="EditorOrder(110), EditorDisplay(\"Navigation\")")
     bool AutoRemoveMissingNavMeshes = true;
 
+    /// <summary>
+    /// The maximum amount of node expansions performed per-frame (per-navmesh) by the asynchronous path finding queries. Limits the pathfinding cost of a single frame, the remaining queries are resumed during the next update. See NavMeshRuntime::FindPathAsync.
+    /// </summary>
+    API_FIELD(Attributes="Limit(64, 100000), EditorOrder(120), EditorDisplay(\"Navigation\")")
+    int32 AsyncPathfindingNodesPerFrame = 2048;
+
 public:
     /// <summary>
     /// The height of a grid cell in the navigation mesh building steps using heightfields. A lower number means higher precision on the vertical axis but longer build times.
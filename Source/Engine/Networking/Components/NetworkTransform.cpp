@@ -125,12 +125,13 @@ void NetworkTransform::OnUpdate()
         const float now = Time::Update.UnscaledTime.GetTotalSeconds();
         const float gameTime = now - lag;
 
-        // Drop older positions
-        while (_buffer.Count() >= 2 && _buffer[1].Timestamp <= gameTime)
+        // Drop older positions but keep the last two snapshots for extrapolation
+        while (_buffer.Count() > 2 && _buffer[1].Timestamp <= gameTime)
             _buffer.RemoveAtKeepOrder(0);
 
         // Interpolate between the two surrounding authoritative positions
-        if (_buffer.Count() >= 2 && _buffer[0].Timestamp <= gameTime && gameTime <= _buffer[1].Timestamp)
+        const int32 count = _buffer.Count();
+        if (count >= 2 && _buffer[0].Timestamp <= gameTime && gameTime <= _buffer[1].Timestamp)
         {
             const auto& b0 = _buffer[0];
             const auto& b1 = _buffer[1];
@@ -139,9 +140,24 @@ void NetworkTransform::OnUpdate()
             Transform::Lerp(b0.Value, b1.Value, alpha, transform);
             Set(transform);
         }
-        else if (_buffer.Count() == 1 && _buffer[0].Timestamp <= gameTime)
+        else if (count >= 1 && _buffer[count - 1].Timestamp <= gameTime)
         {
-            Set(_buffer[0].Value);
+            // Rendering time got ahead of the newest snapshot (eg. packet loss or a low network update rate)
+            const auto& b1 = _buffer[count - 1];
+            const float aheadTime = Math::Min(gameTime - b1.Timestamp, ExtrapolationLimit);
+            const float step = count >= 2 ? b1.Timestamp - _buffer[count - 2].Timestamp : 0.0f;
+            if (Extrapolation == ExtrapolationModes::Linear && aheadTime > 0.0f && step > ZeroTolerance)
+            {
+                // Extrapolate the position ahead at the last known velocity (orientation and scale hold the last snapshot)
+                const auto& b0 = _buffer[count - 2];
+                Transform transform = b1.Value;
+                transform.Translation = b1.Value.Translation + (b1.Value.Translation - b0.Value.Translation) * (aheadTime / step);
+                Set(transform);
+            }
+            else
+            {
+                Set(b1.Value);
+            }
         }
     }
 }
@@ -331,7 +347,7 @@ void NetworkTransform::Deserialize(NetworkStream* stream)
     }
     else
     {
-        // Add to the interpolation buffer
+        // Add to the interpolation buffer (time-indexed, bounded to the recent snapshots only)
         const float now = Time::Update.UnscaledTime.GetTotalSeconds();
         _buffer.Add({ now, 0, transform });
         if (_bufferHasDeltas)
@@ -339,6 +355,9 @@ void NetworkTransform::Deserialize(NetworkStream* stream)
             _buffer.Clear();
             _bufferHasDeltas = false;
         }
+        constexpr int32 MaxSnapshots = 120;
+        if (_buffer.Count() > MaxSnapshots)
+            _buffer.RemoveAtKeepOrder(0);
     }
 }
 
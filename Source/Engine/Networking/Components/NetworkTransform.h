@@ -67,6 +67,17 @@ API_CLASS(Namespace="FlaxEngine.Networking") class FLAXENGINE_API NetworkTransfo
         Prediction,
     };
 
+    /// <summary>
+    /// Transform extrapolation modes used when the interpolation buffer runs out of fresh snapshots (eg. due to packet loss or a low network update rate).
+    /// </summary>
+    API_ENUM() enum class ExtrapolationModes
+    {
+        // Hold the last received transform until a new snapshot arrives.
+        None,
+        // Extrapolate the position ahead at the last known velocity (limited by ExtrapolationLimit) to hide snapshots starvation.
+        Linear,
+    };
+
 private:
     struct BufferedItem
     {
@@ -99,6 +110,18 @@ public:
     API_FIELD(Attributes="EditorOrder(30)")
     ReplicationModes Mode = ReplicationModes::Default;
 
+    /// <summary>
+    /// Transform extrapolation policy used in Interpolation mode when the rendering time gets ahead of the newest received snapshot.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(40)")
+    ExtrapolationModes Extrapolation = ExtrapolationModes::None;
+
+    /// <summary>
+    /// The maximum amount of time (in seconds) to extrapolate the transform ahead of the newest received snapshot. Prevents runaway movement on a longer connection stall.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(50), Limit(0)")
+    float ExtrapolationLimit = 0.25f;
+
 private:
     API_FUNCTION(Hidden, NetworkRpc=Server) void SetSequenceIndex(uint16 value);
     
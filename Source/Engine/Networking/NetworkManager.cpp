@@ -134,6 +134,7 @@ namespace
         NetworkInternal::OnNetworkMessageObjectDespawn,
         NetworkInternal::OnNetworkMessageObjectRole,
         NetworkInternal::OnNetworkMessageObjectRpc,
+        NetworkInternal::OnNetworkMessageObjectRpcBatch,
     };
 }
 
@@ -146,6 +147,7 @@ public:
     }
 
     void Update() override;
+    void Tick();
 
     void Dispose() override
     {
@@ -367,13 +369,40 @@ void NetworkManager::Stop()
 
 void NetworkManagerService::Update()
 {
+    // Run the network ticks at a fixed rate (NetworkFPS) decoupled from the frame rate
     const double currentTime = Time::Update.UnscaledTime.GetTotalSeconds();
-    const float minDeltaTime = NetworkManager::NetworkFPS > 0 ? 1.0f / NetworkManager::NetworkFPS : 0.0f;
-    auto peer = NetworkManager::Peer;
-    if (NetworkManager::Mode == NetworkManagerMode::Offline || (float)(currentTime - LastUpdateTime) < minDeltaTime || !peer)
+    if (NetworkManager::Mode == NetworkManagerMode::Offline || !NetworkManager::Peer)
+    {
+        LastUpdateTime = currentTime;
         return;
+    }
+    if (NetworkManager::NetworkFPS <= 0)
+    {
+        // Unlimited tick rate: update once per frame
+        LastUpdateTime = currentTime;
+        Tick();
+        return;
+    }
+    const double tickStep = 1.0 / (double)NetworkManager::NetworkFPS;
+    const int32 MaxTicksPerUpdate = 4;
+    if (currentTime - LastUpdateTime > tickStep * (MaxTicksPerUpdate + 1))
+    {
+        // Running too far behind (eg. after a loading stall): drop the ticks backlog instead of spiraling
+        LastUpdateTime = currentTime - tickStep * MaxTicksPerUpdate;
+    }
+    int32 ticks = MaxTicksPerUpdate;
+    while (currentTime - LastUpdateTime >= tickStep && ticks-- > 0 && NetworkManager::Peer)
+    {
+        // Advance the clock by the exact tick duration to keep a stable cadence independent from the frame timing
+        LastUpdateTime += tickStep;
+        Tick();
+    }
+}
+
+void NetworkManagerService::Tick()
+{
+    auto peer = NetworkManager::Peer;
     PROFILE_CPU();
-    LastUpdateTime = currentTime;
     NetworkManager::Frame++;
     NetworkInternal::NetworkReplicatorPreUpdate();
     // TODO: convert into TaskGraphSystems and use async jobs
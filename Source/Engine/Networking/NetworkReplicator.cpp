@@ -10,8 +10,10 @@
 #include "NetworkChannelType.h"
 #include "NetworkEvent.h"
 #include "NetworkRpc.h"
+#include "NetworkSettings.h"
 #include "INetworkSerializable.h"
 #include "INetworkObject.h"
+#include "Engine/Utilities/Crc.h"
 #include "Engine/Core/Collections/HashSet.h"
 #include "Engine/Core/Collections/Dictionary.h"
 #include "Engine/Core/Collections/ChunkedArray.h"
@@ -99,6 +101,12 @@ PACK_STRUCT(struct NetworkMessageObjectRpc
     uint16 ArgsSize;
     });
 
+PACK_STRUCT(struct NetworkMessageObjectRpcBatch
+    {
+    NetworkMessageIDs ID = NetworkMessageIDs::ObjectRpcBatch;
+    uint16 Count;
+    });
+
 struct NetworkReplicatedObject
 {
     ScriptingObjectReference<ScriptingObject> Object;
@@ -106,14 +114,18 @@ struct NetworkReplicatedObject
     Guid ParentId;
     uint32 OwnerClientId;
     uint32 LastOwnerFrame = 0;
+    uint32 LastSentFrame = 0;
+    uint32 LastSentCrc = 0;
     NetworkObjectRole Role;
     uint8 Spawned : 1;
+    uint8 Dirty : 1;
     DataContainer<uint32> TargetClientIds;
     INetworkObject* AsNetworkObject;
 
     NetworkReplicatedObject()
     {
         Spawned = 0;
+        Dirty = 1;
     }
 
     bool operator==(const NetworkReplicatedObject& other) const
@@ -188,10 +200,18 @@ struct RpcItem
     DataContainer<uint32> Targets;
 };
 
+struct RelevancyClient
+{
+    uint32 ClientId;
+    Vector3 Position;
+};
+
 namespace
 {
     CriticalSection ObjectsLock;
     HashSet<NetworkReplicatedObject> Objects;
+    Dictionary<uint32, Vector3> ClientViewPositions;
+    Dictionary<int64, Array<RelevancyClient, InlinedAllocation<8>>> RelevancyGrid;
     Array<ReplicateItem> ReplicationParts;
     Array<SpawnItem> SpawnQueue;
     Array<DespawnItem> DespawnQueue;
@@ -201,6 +221,8 @@ namespace
     NetworkStream* CachedReadStream = nullptr;
     Array<NetworkClient*> NewClients;
     Array<NetworkConnection> CachedTargets;
+    Array<NetworkConnection> CachedRpcBatchTargets;
+    NetworkRpcBatchingStats RpcBatchingStats;
     Dictionary<ScriptingTypeHandle, Serializer> SerializersTable;
 #if !COMPILE_WITHOUT_CSHARP
     Dictionary<StringAnsiView, StringAnsi*> CSharpCachedNames;
@@ -377,10 +399,50 @@ void BuildCachedTargets(const Array<NetworkClient*>& clients, const DataContaine
     }
 }
 
-FORCE_INLINE void BuildCachedTargets(const NetworkReplicatedObject& item)
+FORCE_INLINE int64 GetRelevancyCell(const int64 x, const int64 y, const int64 z)
+{
+    // Pack 3D cell coordinate into a single grid key (21 bits per axis)
+    return ((x & 0x1fffff) << 42) | ((y & 0x1fffff) << 21) | (z & 0x1fffff);
+}
+
+void BuildRelevancyGrid(const float cellSize)
 {
-    // By default send object to all connected clients excluding the owner but with optional TargetClientIds list
-    BuildCachedTargets(NetworkManager::Clients, item.TargetClientIds, item.OwnerClientId);
+    // Uniform grid with a cell size matching the relevancy radius so each object checks only the neighboring cells
+    RelevancyGrid.Clear();
+    for (const auto& e : ClientViewPositions)
+    {
+        const int64 x = (int64)Math::Floor(e.Value.X / cellSize);
+        const int64 y = (int64)Math::Floor(e.Value.Y / cellSize);
+        const int64 z = (int64)Math::Floor(e.Value.Z / cellSize);
+        auto& client = RelevancyGrid[GetRelevancyCell(x, y, z)].AddOne();
+        client.ClientId = e.Key;
+        client.Position = e.Value;
+    }
+}
+
+void GetRelevantClients(const Vector3& position, const float radius, Array<uint32, InlinedAllocation<64>>& result)
+{
+    const Real radiusSq = (Real)radius * radius;
+    const int64 x = (int64)Math::Floor(position.X / radius);
+    const int64 y = (int64)Math::Floor(position.Y / radius);
+    const int64 z = (int64)Math::Floor(position.Z / radius);
+    for (int64 dz = -1; dz <= 1; dz++)
+    {
+        for (int64 dy = -1; dy <= 1; dy++)
+        {
+            for (int64 dx = -1; dx <= 1; dx++)
+            {
+                const auto* clients = RelevancyGrid.TryGet(GetRelevancyCell(x + dx, y + dy, z + dz));
+                if (!clients)
+                    continue;
+                for (const RelevancyClient& client : *clients)
+                {
+                    if (Vector3::DistanceSquared(client.Position, position) <= radiusSq)
+                        result.Add(client.ClientId);
+                }
+            }
+        }
+    }
 }
 
 FORCE_INLINE void GetNetworkName(char buffer[128], const StringAnsiView& name)
@@ -563,7 +625,8 @@ void FindObjectsForSpawn(SpawnGroup& group, ChunkedArray<SpawnItem, 256>& spawnI
 
 void DirtyObjectImpl(NetworkReplicatedObject& item, ScriptingObject* obj)
 {
-    // TODO: implement objects state replication frequency and dirtying
+    // Force the replication message send during the next update (skips the unchanged-state culling)
+    item.Dirty = 1;
 }
 
 template<typename MessageType>
@@ -994,6 +1057,18 @@ void NetworkReplicator::DirtyObject(ScriptingObject* obj)
     DirtyObjectImpl(item, obj);
 }
 
+void NetworkReplicator::SetClientViewPosition(uint32 clientId, const Vector3& position)
+{
+    ScopeLock lock(ObjectsLock);
+    ClientViewPositions[clientId] = position;
+}
+
+NetworkRpcBatchingStats NetworkReplicator::GetRpcBatchingStats()
+{
+    ScopeLock lock(ObjectsLock);
+    return RpcBatchingStats;
+}
+
 Dictionary<NetworkRpcName, NetworkRpcInfo> NetworkRpcInfo::RPCsTable;
 
 NetworkStream* NetworkReplicator::BeginInvokeRPC()
@@ -1038,6 +1113,7 @@ void NetworkInternal::NetworkReplicatorClientDisconnected(NetworkClient* client)
 {
     ScopeLock lock(ObjectsLock);
     NewClients.Remove(client);
+    ClientViewPositions.Remove(client->ClientId);
 
     // Remove any objects owned by that client
     const uint32 clientId = client->ClientId;
@@ -1089,6 +1165,10 @@ void NetworkInternal::NetworkReplicatorClear()
     SAFE_DELETE(CachedReadStream);
     NewClients.Clear();
     CachedTargets.Clear();
+    CachedRpcBatchTargets.Clear();
+    RpcBatchingStats = NetworkRpcBatchingStats();
+    ClientViewPositions.Clear();
+    RelevancyGrid.Clear();
     DespawnedObjects.Clear();
 }
 
@@ -1120,7 +1200,12 @@ void NetworkInternal::NetworkReplicatorUpdate()
         {
             auto& item = it->Item;
             ScriptingObject* obj = item.Object.Get();
-            if (!obj || !item.Spawned)
+            if (!obj)
+                continue;
+
+            // Ensure that late-joining clients receive the current objects state even if it didn't change recently
+            item.Dirty = 1;
+            if (!item.Spawned)
                 continue;
 
             // Setup spawn item for this object
@@ -1276,6 +1361,12 @@ void NetworkInternal::NetworkReplicatorUpdate()
         CachedWriteStream = New<NetworkStream>();
     NetworkStream* stream = CachedWriteStream;
     stream->SenderId = NetworkManager::LocalClientId;
+    const uint32 resendFrames = (uint32)Math::Max(NetworkSettings::Get()->ReplicationResendFrames, 1);
+    const float relevancyRadius = NetworkSettings::Get()->ReplicationRelevancyRadius;
+    const bool useRelevancy = !isClient && relevancyRadius > 0.0f && ClientViewPositions.Count() != 0;
+    if (useRelevancy)
+        BuildRelevancyGrid(relevancyRadius);
+    Array<uint32, InlinedAllocation<64>> relevantClientIds;
     // TODO: introduce NetworkReplicationHierarchy to optimize objects replication in large worlds (eg. batched culling networked scene objects that are too far from certain client to be relevant)
     // TODO: per-object sync interval (in frames) - could be scaled by hierarchy (eg. game could slow down sync rate for objects far from player)
     for (auto it = Objects.Begin(); it.IsNotEnd(); ++it)
@@ -1292,21 +1383,56 @@ void NetworkInternal::NetworkReplicatorUpdate()
         if (item.Role != NetworkObjectRole::OwnedAuthoritative && (!isClient && item.OwnerClientId != NetworkManager::LocalClientId))
             continue; // Send replication messages of only owned objects or from other client objects
 
+        // Interest management: replicate scene objects only to the clients nearby (if enabled)
+        Span<uint32> relevantClients;
+        if (useRelevancy)
+        {
+            const Actor* actor = ScriptingObject::Cast<Actor>(obj);
+            if (!actor)
+            {
+                const Script* script = ScriptingObject::Cast<Script>(obj);
+                if (script)
+                    actor = script->GetActor();
+            }
+            if (actor)
+            {
+                relevantClientIds.Clear();
+                GetRelevantClients(actor->GetPosition(), relevancyRadius, relevantClientIds);
+                if (relevantClientIds.Count() == 0)
+                    continue; // Skip serialization when no client is close enough to receive this object
+                relevantClients = Span<uint32>(relevantClientIds.Get(), relevantClientIds.Count());
+            }
+        }
+
         if (item.AsNetworkObject)
             item.AsNetworkObject->OnNetworkSerialize();
 
-        // Serialize object
-        stream->Initialize();
+        // Serialize object directly into the driver-owned message memory with a space reserved for the prepended header (stream switches to its own memory when running out of space)
+        NetworkMessage msg = peer->BeginSendMessage();
+        const uint32 msgMaxData = peer->Config.MessageSize - sizeof(NetworkMessageObjectReplicate);
+        stream->Initialize(msg.Buffer + sizeof(NetworkMessageObjectReplicate), msgMaxData);
         const bool failed = NetworkReplicator::InvokeSerializer(obj->GetTypeHandle(), obj, stream, true);
         if (failed)
         {
             //NETWORK_REPLICATOR_LOG(Error, "[NetworkReplicator] Cannot serialize object {} of type {} (missing serialization logic)", item.ToString(), obj->GetType().ToString());
+            peer->AbortSendMessage(msg);
             continue;
         }
 
+        // Skip sending unchanged object state (periodically resent to cover the unreliable channel packets loss)
+        const uint32 size = stream->GetPosition();
+        const uint32 crc = Crc::MemCrc32(stream->GetBuffer(), (int32)size);
+        if (!item.Dirty && crc == item.LastSentCrc && NetworkManager::Frame - item.LastSentFrame < resendFrames)
+        {
+            peer->AbortSendMessage(msg);
+            continue;
+        }
+        item.Dirty = 0;
+        item.LastSentCrc = crc;
+        item.LastSentFrame = NetworkManager::Frame;
+
         // Send object to clients
         {
-            const uint32 size = stream->GetPosition();
             ASSERT(size <= MAX_uint16)
             NetworkMessageObjectReplicate msgData;
             msgData.OwnerFrame = NetworkManager::Frame;
@@ -1320,7 +1446,6 @@ void NetworkInternal::NetworkReplicatorUpdate()
             }
             GetNetworkName(msgData.ObjectTypeName, obj->GetType().Fullname);
             msgData.DataSize = size;
-            const uint32 msgMaxData = peer->Config.MessageSize - sizeof(NetworkMessageObjectReplicate);
             const uint32 partMaxData = peer->Config.MessageSize - sizeof(NetworkMessageObjectReplicatePart);
             uint32 partsCount = 1;
             uint32 dataStart = 0;
@@ -1338,15 +1463,24 @@ void NetworkInternal::NetworkReplicatorUpdate()
                 dataStart += size;
             ASSERT(partsCount <= MAX_uint8)
             msgData.PartsCount = partsCount;
-            NetworkMessage msg = peer->BeginSendMessage();
-            msg.WriteStructure(msgData);
-            msg.WriteBytes(stream->GetBuffer(), msgDataSize);
+            if (stream->GetBuffer() == msg.Buffer + sizeof(NetworkMessageObjectReplicate))
+            {
+                // Data was serialized in-place after the reserved header space so only the header gets copied into the message
+                ASSERT_LOW_LAYER(partsCount == 1);
+                Platform::MemoryCopy(msg.Buffer, &msgData, sizeof(msgData));
+                msg.Position = msg.Length = sizeof(msgData) + size;
+            }
+            else
+            {
+                // Stream has grown outside of the message memory so copy the first chunk (the rest goes within the part messages)
+                msg.WriteStructure(msgData);
+                msg.WriteBytes(stream->GetBuffer(), msgDataSize);
+            }
             if (isClient)
                 peer->EndSendMessage(NetworkChannelType::Unreliable, msg);
             else
             {
-                // TODO: per-object relevancy for connected clients (eg. skip replicating actor to far players)
-                BuildCachedTargets(item);
+                BuildCachedTargets(NetworkManager::Clients, item.TargetClientIds, relevantClients, item.OwnerClientId);
                 peer->EndSendMessage(NetworkChannelType::Unreliable, msg, CachedTargets);
             }
 
@@ -1375,7 +1509,27 @@ void NetworkInternal::NetworkReplicatorUpdate()
         }
     }
 
-    // Invoke RPCs
+    // Invoke RPCs (coalesced into batched messages per channel and targets set to reduce per-packet overhead)
+    NetworkMessage rpcBatchMsg;
+    NetworkChannelType rpcBatchChannel = NetworkChannelType::None;
+    bool rpcBatchToServer = false;
+    uint16 rpcBatchCount = 0;
+    RpcBatchingStats.RpcsSent = 0;
+    RpcBatchingStats.MessagesSent = 0;
+    auto flushRpcBatch = [peer, &rpcBatchMsg, &rpcBatchChannel, &rpcBatchToServer, &rpcBatchCount]()
+    {
+        if (rpcBatchCount == 0)
+            return;
+        NetworkMessageObjectRpcBatch batchData;
+        batchData.Count = rpcBatchCount;
+        Platform::MemoryCopy(rpcBatchMsg.Buffer, &batchData, sizeof(batchData));
+        if (rpcBatchToServer)
+            peer->EndSendMessage(rpcBatchChannel, rpcBatchMsg);
+        else
+            peer->EndSendMessage(rpcBatchChannel, rpcBatchMsg, CachedRpcBatchTargets);
+        rpcBatchCount = 0;
+        RpcBatchingStats.MessagesSent++;
+    };
     for (auto& e : RpcQueue)
     {
         ScriptingObject* obj = e.Object.Get();
@@ -1386,7 +1540,7 @@ void NetworkInternal::NetworkReplicatorUpdate()
             continue;
         auto& item = it->Item;
 
-        // Send despawn message
+        // Send RPC message
         //NETWORK_REPLICATOR_LOG(Info, "[NetworkReplicator] Rpc {}::{} object ID={}", e.Name.First.ToString(), String(e.Name.Second), item.ToString());
         NetworkMessageObjectRpc msgData;
         msgData.ObjectId = item.ObjectId;
@@ -1398,10 +1552,8 @@ void NetworkInternal::NetworkReplicatorUpdate()
         GetNetworkName(msgData.RpcTypeName, e.Name.First.GetType().Fullname);
         GetNetworkName(msgData.RpcName, e.Name.Second);
         msgData.ArgsSize = (uint16)e.ArgsData.Length();
-        NetworkMessage msg = peer->BeginSendMessage();
-        msg.WriteStructure(msgData);
-        msg.WriteBytes(e.ArgsData.Get(), e.ArgsData.Length());
         NetworkChannelType channel = (NetworkChannelType)e.Info.Channel;
+        bool toServer;
         if (e.Info.Server && isClient)
         {
             // Client -> Server
@@ -1409,15 +1561,38 @@ void NetworkInternal::NetworkReplicatorUpdate()
             if (e.Targets.Length() != 0)
                 NETWORK_REPLICATOR_LOG(Error, "[NetworkReplicator] Server RPC '{}::{}' called with non-empty list of targets is not supported (only server will receive it)", e.Name.First.ToString(), e.Name.Second.ToString());
 #endif
-            peer->EndSendMessage(channel, msg);
+            toServer = true;
         }
         else if (e.Info.Client && (isServer || isHost))
         {
             // Server -> Client(s)
             BuildCachedTargets(NetworkManager::Clients, item.TargetClientIds, e.Targets, NetworkManager::LocalClientId);
-            peer->EndSendMessage(channel, msg, CachedTargets);
+            toServer = false;
+        }
+        else
+            continue;
+
+        // Flush the pending batch when the channel or the targets set differs, or when this RPC would overflow the message capacity
+        const uint32 rpcSize = sizeof(NetworkMessageObjectRpc) + e.ArgsData.Length();
+        if (rpcBatchCount != 0 && (channel != rpcBatchChannel || toServer != rpcBatchToServer || (!toServer && CachedTargets != CachedRpcBatchTargets) || rpcBatchMsg.Position + rpcSize > rpcBatchMsg.BufferSize))
+            flushRpcBatch();
+        if (rpcBatchCount == 0)
+        {
+            // Begin a new batch with a space reserved for the prepended header
+            rpcBatchMsg = peer->BeginSendMessage();
+            rpcBatchMsg.SkipBytes(sizeof(NetworkMessageObjectRpcBatch));
+            rpcBatchMsg.Length = rpcBatchMsg.Position;
+            rpcBatchChannel = channel;
+            rpcBatchToServer = toServer;
+            if (!toServer)
+                CachedRpcBatchTargets = CachedTargets;
         }
+        rpcBatchMsg.WriteStructure(msgData);
+        rpcBatchMsg.WriteBytes(e.ArgsData.Get(), e.ArgsData.Length());
+        rpcBatchCount++;
+        RpcBatchingStats.RpcsSent++;
     }
+    flushRpcBatch();
     RpcQueue.Clear();
 
     // Clear networked objects mapping table
@@ -1810,3 +1985,22 @@ void NetworkInternal::OnNetworkMessageObjectRpc(NetworkEvent& event, NetworkClie
         NETWORK_REPLICATOR_LOG(Error, "[NetworkReplicator] Unknown object {} RPC {}::{}", msgData.ObjectId, String(msgData.RpcTypeName), String(msgData.RpcName));
     }
 }
+
+void NetworkInternal::OnNetworkMessageObjectRpcBatch(NetworkEvent& event, NetworkClient* client, NetworkPeer* peer)
+{
+    NetworkMessageObjectRpcBatch msgData;
+    event.Message.ReadStructure(msgData);
+    for (uint16 i = 0; i < msgData.Count; i++)
+    {
+        // Every entry is a complete rpc message (header followed by args) so peek its size to keep the read position valid even if the handler rejects that rpc
+        if (event.Message.Position + sizeof(NetworkMessageObjectRpc) > event.Message.Length)
+            break;
+        NetworkMessageObjectRpc rpcData;
+        Platform::MemoryCopy(&rpcData, event.Message.Buffer + event.Message.Position, sizeof(rpcData));
+        const uint32 nextPosition = event.Message.Position + sizeof(NetworkMessageObjectRpc) + rpcData.ArgsSize;
+        if (nextPosition > event.Message.Length)
+            break;
+        OnNetworkMessageObjectRpc(event, client, peer);
+        event.Message.Position = nextPosition;
+    }
+}
@@ -3,6 +3,8 @@
 #pragma once
 
 #include "Types.h"
+#include "NetworkStats.h"
+#include "Engine/Core/Math/Vector3.h"
 #include "Engine/Core/Types/Span.h"
 #include "Engine/Scripting/ScriptingObject.h"
 #include "Engine/Scripting/ScriptingType.h"
@@ -162,6 +164,18 @@ public:
     /// <param name="obj">The network object.</param>
     API_FUNCTION() static void DirtyObject(ScriptingObject* obj);
 
+    /// <summary>
+    /// Sets the client view position used by the server to evaluate the replicated objects relevancy (see NetworkSettings.ReplicationRelevancyRadius). Call it for every connected client (eg. with the player pawn location).
+    /// </summary>
+    /// <param name="clientId">The client identifier.</param>
+    /// <param name="position">The client view location in the world.</param>
+    API_FUNCTION() static void SetClientViewPosition(uint32 clientId, const Vector3& position);
+
+    /// <summary>
+    /// Gets the RPC messages coalescing statistics from the last network update.
+    /// </summary>
+    API_FUNCTION() static NetworkRpcBatchingStats GetRpcBatchingStats();
+
 public:
     /// <summary>
     /// Begins invoking the RPC and returns the Network Stream to serialize parameters to.
@@ -31,6 +31,18 @@ public:
     API_FIELD(Attributes="EditorOrder(100), Limit(0, 1000), EditorDisplay(\"General\", \"Network FPS\")")
     float NetworkFPS = 60.0f;
 
+    /// <summary>
+    /// The amount of the network updates after which the unchanged objects are resent. Object replication is skipped when its serialized state didn't change since the last send, this interval forces a periodic resend to cover the potential packets loss on the unreliable transport channel. Use lower values for more redundancy, higher values for less network usage with mostly-static objects.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(110), Limit(1, 10000), EditorDisplay(\"General\")")
+    int32 ReplicationResendFrames = 60;
+
+    /// <summary>
+    /// The radius around each client view position used by the server to evaluate the replicated scene objects relevancy. Objects further away from all clients are not replicated so per-client network usage scales with the nearby objects instead of the whole world population. Clients view positions are fed via NetworkReplicator.SetClientViewPosition (eg. with the player pawn location). Use 0 to disable the interest management and always replicate all objects.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(120), Limit(0), EditorDisplay(\"General\")")
+    float ReplicationRelevancyRadius = 0.0f;
+
     /// <summary>
     /// Address of the server (server/host always runs on localhost). Only IPv4 is supported.
     /// </summary>
@@ -33,3 +33,27 @@ struct TIsPODType<NetworkDriverStats>
 {
     enum { Value = true };
 };
+
+/// <summary>
+/// The network RPC batching statistics container. Contains information about RPC messages coalescing efficiency during the last network update.
+/// </summary>
+API_STRUCT(Namespace="FlaxEngine.Networking") struct FLAXENGINE_API NetworkRpcBatchingStats
+{
+    DECLARE_SCRIPTING_TYPE_MINIMAL(NetworkRpcBatchingStats);
+
+    /// <summary>
+    /// Amount of the RPC invocations sent during the last network update.
+    /// </summary>
+    API_FIELD() uint32 RpcsSent = 0;
+
+    /// <summary>
+    /// Amount of the network messages used to carry the sent RPCs during the last network update. The lower the value relative to RpcsSent, the better the coalescing.
+    /// </summary>
+    API_FIELD() uint32 MessagesSent = 0;
+};
+
+template<>
+struct TIsPODType<NetworkRpcBatchingStats>
+{
+    enum { Value = true };
+};
@@ -43,7 +43,7 @@ public:
     API_FUNCTION() void Initialize(uint32 minCapacity = 1024);
 
     /// <summary>
-    /// Initializes the stream for reading.
+    /// Initializes the stream for reading or writing using the externally-allocated memory (eg. network message buffer owned by the driver). When writing more data than the provided capacity the stream switches to its own growable memory buffer (compare GetBuffer with the provided memory to detect it).
     /// </summary>
     /// <param name="buffer">The allocated memory.</param>
     /// <param name="length">The allocated memory length (bytes count).</param>
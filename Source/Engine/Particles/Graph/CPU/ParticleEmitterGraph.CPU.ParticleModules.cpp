@@ -2,6 +2,7 @@
 
 #include "ParticleEmitterGraph.CPU.h"
 #include "Engine/Core/Random.h"
+#include "Engine/Particles/ParticleEffect.h"
 #include "Engine/Utilities/Noise.h"
 
 // ReSharper disable CppCStyleCast
@@ -54,10 +55,8 @@ int32 ParticleEmitterGraphCPUExecutor::ProcessSpawnModule(int32 index)
     auto& context = Context.Get();
     auto& data = context.Data->SpawnModulesData[index];
 
-    // Accumulate the previous frame fraction
-    float spawnCount = data.SpawnCounter;
-
     // Calculate particles to spawn during this frame
+    float spawnCount = 0.0f;
     switch (node->TypeID)
     {
     // Constant Spawn Rate
@@ -108,6 +107,12 @@ int32 ParticleEmitterGraphCPUExecutor::ProcessSpawnModule(int32 index)
     }
     }
 
+    // Scale the spawning with the effect simulation LOD (effects with a small screen coverage spawn fewer particles)
+    spawnCount *= context.Effect->GetSimulationLODSpawnScale();
+
+    // Accumulate the previous frame fraction
+    spawnCount += data.SpawnCounter;
+
     // Calculate actual spawn amount
     spawnCount = Math::Max(spawnCount, 0.0f);
     const int32 result = Math::FloorToInt(spawnCount);
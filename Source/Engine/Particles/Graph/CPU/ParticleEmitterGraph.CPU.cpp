@@ -133,6 +133,7 @@ void ParticleEmitterGraphCPUExecutor::Init(ParticleEmitter* emitter, ParticleEff
     context.ViewTask = effect->GetRenderTask();
     context.CallStackSize = 0;
     context.Functions.Clear();
+    context.ValueCache.Clear();
 }
 
 bool ParticleEmitterGraphCPUExecutor::ComputeBounds(ParticleEmitter* emitter, ParticleEffect* effect, ParticleEmitterInstance& data, BoundingBox& result)
@@ -439,25 +440,36 @@ void ParticleEmitterGraphCPUExecutor::Update(ParticleEmitter* emitter, ParticleE
         }
     }
 
-    // Dead particles removal
-    if (_graph._attrAge != -1 && _graph._attrLifetime != -1)
+    // Dead particles removal and velocities integration fused into a single buffer sweep (these passes are memory-bandwidth-bound so each particle gets touched once)
+    const auto& layout = *data.Buffer->Layout;
+    const int32 stride = data.Buffer->Stride;
+    const bool ageKill = _graph._attrAge != -1 && _graph._attrLifetime != -1;
+    const bool eulerIntegration = _graph._attrPosition != -1 && _graph._attrVelocity != -1;
+    const bool angularEulerIntegration = _graph._attrRotation != -1 && _graph._attrAngularVelocity != -1;
+    if (ageKill || eulerIntegration || angularEulerIntegration)
     {
-        PROFILE_CPU_NAMED("Age kill");
-        byte* agePtr = cpu.Buffer.Get() + data.Buffer->Layout->Attributes[_graph._attrAge].Offset;
-        byte* lifetimePtr = cpu.Buffer.Get() + data.Buffer->Layout->Attributes[_graph._attrLifetime].Offset;
-        for (int32 particleIndex = 0; particleIndex < cpu.Count; particleIndex++)
+        PROFILE_CPU_NAMED("Age kill and Euler Integration");
+        const int32 ageOffset = ageKill ? layout.Attributes[_graph._attrAge].Offset : 0;
+        const int32 lifetimeOffset = ageKill ? layout.Attributes[_graph._attrLifetime].Offset : 0;
+        const int32 positionOffset = eulerIntegration ? layout.Attributes[_graph._attrPosition].Offset : 0;
+        const int32 velocityOffset = eulerIntegration ? layout.Attributes[_graph._attrVelocity].Offset : 0;
+        const int32 rotationOffset = angularEulerIntegration ? layout.Attributes[_graph._attrRotation].Offset : 0;
+        const int32 angularVelocityOffset = angularEulerIntegration ? layout.Attributes[_graph._attrAngularVelocity].Offset : 0;
+        for (int32 particleIndex = 0; particleIndex < cpu.Count;)
         {
-            if (*(float*)agePtr >= *(float*)lifetimePtr)
+            byte* particle = cpu.Buffer.Get() + particleIndex * stride;
+            if (ageKill && *(float*)(particle + ageOffset) >= *(float*)(particle + lifetimeOffset))
             {
+                // Swap-remove with the last particle and re-process this slot
                 cpu.Count--;
-                Platform::MemoryCopy(data.Buffer->GetParticleCPU(particleIndex), data.Buffer->GetParticleCPU(cpu.Count), data.Buffer->Stride);
-                particleIndex--;
-            }
-            else
-            {
-                agePtr += data.Buffer->Stride;
-                lifetimePtr += data.Buffer->Stride;
+                Platform::MemoryCopy(particle, cpu.Buffer.Get() + cpu.Count * stride, stride);
+                continue;
             }
+            if (eulerIntegration)
+                *(Float3*)(particle + positionOffset) += *(Float3*)(particle + velocityOffset) * dt;
+            if (angularEulerIntegration)
+                *(Float3*)(particle + rotationOffset) += *(Float3*)(particle + angularVelocityOffset) * dt;
+            particleIndex++;
         }
     }
 
@@ -475,34 +487,6 @@ void ParticleEmitterGraphCPUExecutor::Update(ParticleEmitter* emitter, ParticleE
     }
 #endif
 
-    // Euler integration
-    if (_graph._attrPosition != -1 && _graph._attrVelocity != -1)
-    {
-        PROFILE_CPU_NAMED("Euler Integration");
-        byte* positionPtr = cpu.Buffer.Get() + data.Buffer->Layout->Attributes[_graph._attrPosition].Offset;
-        byte* velocityPtr = cpu.Buffer.Get() + data.Buffer->Layout->Attributes[_graph._attrVelocity].Offset;
-        for (int32 particleIndex = 0; particleIndex < cpu.Count; particleIndex++)
-        {
-            *((Float3*)positionPtr) += *((Float3*)velocityPtr) * dt;
-            positionPtr += data.Buffer->Stride;
-            velocityPtr += data.Buffer->Stride;
-        }
-    }
-
-    // Angular Euler Integration
-    if (_graph._attrRotation != -1 && _graph._attrAngularVelocity != -1)
-    {
-        PROFILE_CPU_NAMED("Angular Euler Integration");
-        byte* rotationPtr = cpu.Buffer.Get() + data.Buffer->Layout->Attributes[_graph._attrRotation].Offset;
-        byte* angularVelocityPtr = cpu.Buffer.Get() + data.Buffer->Layout->Attributes[_graph._attrAngularVelocity].Offset;
-        for (int32 particleIndex = 0; particleIndex < cpu.Count; particleIndex++)
-        {
-            *((Float3*)rotationPtr) += *((Float3*)angularVelocityPtr) * dt;
-            rotationPtr += data.Buffer->Stride;
-            angularVelocityPtr += data.Buffer->Stride;
-        }
-    }
-
     // Spawn particles
     int32 spawnCount = 0;
     if (canSpawn)
@@ -599,14 +583,29 @@ VisjectExecutor::Value ParticleEmitterGraphCPUExecutor::eatBox(Node* caller, Box
     }
 #endif
 
+    // Reuse the constant value folded during graph loading (skips the constant subtree execution)
+    if (box->FoldedValue != INVALID_INDEX)
+        return GetCurrentGraph()->FoldedConstants[box->FoldedValue];
+
     // Add to the calling stack
     context.CallStack[context.CallStackSize++] = caller;
 
-    // Call per group custom processing event
+    // Reuse constant subgraph values evaluated earlier during this update (same result for every particle so skip the repeated nodes traversal)
     Value value;
     const auto parentNode = box->GetParent<Node>();
+    const auto parentNodeCPU = (ParticleEmitterGraphCPUNode*)parentNode;
+    const bool isConstant = parentNodeCPU->Used && parentNodeCPU->IsConstant && !parentNodeCPU->UsesParticleData;
+    if (isConstant && context.ValueCache.TryGet(box, value))
+    {
+        context.CallStackSize--;
+        return value;
+    }
+
+    // Call per group custom processing event
     const ProcessBoxHandler func = _perGroupProcessCall[parentNode->GroupID];
     (this->*func)(box, parentNode, value);
+    if (isConstant)
+        context.ValueCache[box] = value;
 
     // Remove from the calling stack
     context.CallStackSize--;
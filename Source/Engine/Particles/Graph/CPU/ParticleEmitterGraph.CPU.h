@@ -119,6 +119,7 @@ struct ParticleEmitterGraphCPUContext
     class SceneRenderTask* ViewTask;
     Array<ParticleEmitterGraphCPU*, FixedAllocation<32>> GraphStack;
     Dictionary<VisjectExecutor::Node*, ParticleEmitterGraphCPU*> Functions;
+    Dictionary<VisjectExecutor::Box*, Variant> ValueCache;
     int32 CallStackSize = 0;
     VisjectExecutor::Node* CallStack[PARTICLE_EMITTER_MAX_CALL_STACK];
 };
@@ -8,6 +8,7 @@
 #include "Engine/Level/Scene/Scene.h"
 #include "Engine/Engine/Time.h"
 #include "Engine/Engine/Engine.h"
+#include "Engine/Graphics/RenderTools.h"
 
 ParticleEffect::ParticleEffect(const SpawnParams& params)
     : Actor(params)
@@ -270,6 +271,7 @@ void ParticleEffect::UpdateSimulation(bool singleFrame)
     // Request update
     _lastUpdateFrame = Engine::FrameCount;
     _lastMinDstSqr = MAX_Real;
+    _lastScreenSize = 0.0f;
     if (singleFrame)
         Instance.LastUpdateTime = (UseTimeScale ? Time::Update.Time : Time::Update.UnscaledTime).GetTotalSeconds();
     Particles::UpdateEffect(this);
@@ -359,7 +361,7 @@ SceneRenderTask* ParticleEffect::GetRenderTask() const
 
     // Editor viewport
 #if USE_EDITOR
-    for (auto task : RenderTask::Tasks)
+    for (auto task : RenderTask::DrawTasks)
     {
         if (task->LastUsedFrame >= minFrame && task->Enabled)
         {
@@ -399,6 +401,10 @@ void ParticleEffect::Update()
     if (!UpdateWhenOffscreen && _lastMinDstSqr >= MAX_Real)
         return;
 
+    // Suspend the simulation of distant effects (particles state is preserved so the effect keeps its last look and resumes once any view gets closer)
+    if (SimulationMaxDistance > 0.0f && _lastMinDstSqr < MAX_Real && _lastMinDstSqr > (Real)SimulationMaxDistance * SimulationMaxDistance)
+        return;
+
     if (UpdateMode == SimulationUpdateMode::FixedTimestep)
     {
         // Check if last simulation update was past enough to kick a new on
@@ -406,6 +412,19 @@ void ParticleEffect::Update()
         if (time - Instance.LastUpdateTime < FixedTimestep)
             return;
     }
+    else if (UseSimulationLOD)
+    {
+        // Scale the update rate and the particles spawning with the screen coverage so distant effects cost less (the skipped time gets accumulated into the next update delta)
+        const float screenSize = _lastScreenSize;
+        _simulationLODSpawnScale = Math::Saturate(screenSize / Math::Max(SimulationLODScreenSize, ZeroTolerance));
+        int32 updateInterval = 1;
+        if (screenSize < SimulationLODScreenSize * 0.25f)
+            updateInterval = 4;
+        else if (screenSize < SimulationLODScreenSize * 0.5f)
+            updateInterval = 2;
+        if ((Engine::FrameCount + GetID().A) % updateInterval != 0)
+            return;
+    }
 
     UpdateSimulation();
 }
@@ -499,6 +518,12 @@ void ParticleEffect::Draw(RenderContext& renderContext)
     if (renderContext.View.Pass == DrawPass::GlobalSDF || renderContext.View.Pass == DrawPass::GlobalSurfaceAtlas)
         return;
     _lastMinDstSqr = Math::Min(_lastMinDstSqr, Vector3::DistanceSquared(GetPosition(), renderContext.View.Position));
+    if (UseSimulationLOD)
+    {
+        const auto lodView = (renderContext.LodProxyView ? renderContext.LodProxyView : &renderContext.View);
+        const float screenRadiusSquared = RenderTools::ComputeBoundsScreenRadiusSquared(_sphere.Center - renderContext.View.Origin, (float)_sphere.Radius, *lodView);
+        _lastScreenSize = Math::Max(_lastScreenSize, Math::Sqrt(screenRadiusSquared) * 2.0f);
+    }
     Particles::DrawParticles(renderContext, this);
 }
 
@@ -577,6 +602,9 @@ void ParticleEffect::Serialize(SerializeStream& stream, const void* otherObj)
     SERIALIZE(UseTimeScale);
     SERIALIZE(IsLooping);
     SERIALIZE(UpdateWhenOffscreen);
+    SERIALIZE(UseSimulationLOD);
+    SERIALIZE(SimulationLODScreenSize);
+    SERIALIZE(SimulationMaxDistance);
     SERIALIZE(DrawModes);
     SERIALIZE(SortOrder);
 }
@@ -676,6 +704,9 @@ void ParticleEffect::Deserialize(DeserializeStream& stream, ISerializeModifier*
     DESERIALIZE(UseTimeScale);
     DESERIALIZE(IsLooping);
     DESERIALIZE(UpdateWhenOffscreen);
+    DESERIALIZE(UseSimulationLOD);
+    DESERIALIZE(SimulationLODScreenSize);
+    DESERIALIZE(SimulationMaxDistance);
     DESERIALIZE(DrawModes);
     DESERIALIZE(SortOrder);
 
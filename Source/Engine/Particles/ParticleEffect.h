@@ -180,6 +180,8 @@ public:
 private:
     uint64 _lastUpdateFrame;
     Real _lastMinDstSqr;
+    float _lastScreenSize = MAX_float;
+    float _simulationLODSpawnScale = 1.0f;
     int32 _sceneRenderingKey = -1;
     uint32 _parametersVersion = 0; // Version number for _parameters to be in sync with Instance.ParametersVersion
     Array<ParticleEffectParameter> _parameters; // Cached for scripting API
@@ -240,6 +242,24 @@ public:
     API_FIELD(Attributes="EditorDisplay(\"Particle Effect\"), DefaultValue(true), EditorOrder(60)")
     bool UpdateWhenOffscreen = true;
 
+    /// <summary>
+    /// If true, the simulation level of detail is driven by the effect screen size: effects covering a small part of the screen are updated at a reduced rate (the skipped time is accumulated into the next update) and spawn proportionally fewer particles. Used only if UpdateMode is set to Realtime.
+    /// </summary>
+    API_FIELD(Attributes="EditorDisplay(\"Particle Effect\"), DefaultValue(false), EditorOrder(61)")
+    bool UseSimulationLOD = false;
+
+    /// <summary>
+    /// The effect screen size (the bounds size relative to the screen) below which the simulation LOD starts to reduce the update rate and the spawn rate. Used only if UseSimulationLOD is enabled.
+    /// </summary>
+    API_FIELD(Attributes="EditorDisplay(\"Particle Effect\"), DefaultValue(0.2f), Limit(0.01f, 1.0f, 0.01f), EditorOrder(62), VisibleIf(nameof(UseSimulationLOD))")
+    float SimulationLODScreenSize = 0.2f;
+
+    /// <summary>
+    /// The distance from the view (in world units) after which the particles simulation gets suspended. The particles state is preserved and the effect keeps rendering its last simulated state, resuming the simulation once any view gets closer. Use 0 to disable.
+    /// </summary>
+    API_FIELD(Attributes="EditorDisplay(\"Particle Effect\"), DefaultValue(0.0f), Limit(0), EditorOrder(63)")
+    float SimulationMaxDistance = 0.0f;
+
     /// <summary>
     /// The draw passes to use for rendering this object.
     /// </summary>
@@ -352,6 +372,14 @@ public:
     /// </summary>
     SceneRenderTask* GetRenderTask() const;
 
+    /// <summary>
+    /// Gets the current particles spawn scale applied by the simulation LOD (1 when the simulation LOD is disabled or the effect covers a large part of the screen).
+    /// </summary>
+    FORCE_INLINE float GetSimulationLODSpawnScale() const
+    {
+        return UseSimulationLOD ? _simulationLODSpawnScale : 1.0f;
+    }
+
 #if USE_EDITOR
 protected:
     // Exposed parameters overrides for Editor Undo.
@@ -21,6 +21,7 @@
 #if COMPILE_WITH_GPU_PARTICLES
 #include "Engine/Threading/Threading.h"
 #include "Engine/Content/Assets/Shader.h"
+#include "Engine/Graphics/GPULimits.h"
 #include "Engine/Profiler/ProfilerGPU.h"
 #include "Engine/Renderer/Utils/BitonicSort.h"
 #endif
@@ -582,12 +583,15 @@ PACK_STRUCT(struct GPUParticlesSortingData {
 AssetReference<Shader> GPUParticlesSorting;
 GPUConstantBuffer* GPUParticlesSortingCB;
 GPUShaderProgramCS* GPUParticlesSortingCS[3];
+GPUShaderProgramCS* GPUParticlesSortingArgsCS;
+GPUBuffer* GPUParticlesSortingArgsBuffer;
 
 #if COMPILE_WITH_DEV_ENV
 
 void OnShaderReloading(Asset* obj)
 {
     GPUParticlesSortingCB = nullptr;
+    GPUParticlesSortingArgsCS = nullptr;
     Platform::MemoryClear(GPUParticlesSortingCS, sizeof(GPUParticlesSortingCS));
 }
 
@@ -596,6 +600,7 @@ void OnShaderReloading(Asset* obj)
 void CleanupGPUParticlesSorting()
 {
     GPUParticlesSorting = nullptr;
+    SAFE_DELETE_GPU_RESOURCE(GPUParticlesSortingArgsBuffer);
 }
 
 void DrawEmitterGPU(RenderContext& renderContext, ParticleBuffer* buffer, DrawCall& drawCall, DrawPass drawModes, StaticFlags staticFlags, ParticleEmitterInstance& emitterData, const RenderModulesIndices& renderModulesIndices, int16 sortOrder)
@@ -626,9 +631,19 @@ void DrawEmitterGPU(RenderContext& renderContext, ParticleBuffer* buffer, DrawCa
             GPUParticlesSortingCS[0] = shader->GetCS(CS_Sort, 0);
             GPUParticlesSortingCS[1] = shader->GetCS(CS_Sort, 1);
             GPUParticlesSortingCS[2] = shader->GetCS(CS_Sort, 2);
+            GPUParticlesSortingArgsCS = shader->GetCS("CS_WriteSortArgs");
             GPUParticlesSortingCB = shader->GetCB(0);
             ASSERT(GPUParticlesSortingCB);
         }
+        if (!GPUParticlesSortingArgsBuffer && GPUDevice::Instance->Limits.HasDrawIndirect)
+        {
+            // Shared indirect dispatch arguments buffer for the sorting keys generation (written from the live particles counter on the GPU)
+            GPUParticlesSortingArgsBuffer = GPUDevice::Instance->CreateBuffer(TEXT("GPUParticlesSortingArgs"));
+            if (GPUParticlesSortingArgsBuffer->Init(GPUBufferDescription::Raw(3 * sizeof(uint32), GPUBufferFlags::Argument | GPUBufferFlags::UnorderedAccess)))
+            {
+                SAFE_DELETE_GPU_RESOURCE(GPUParticlesSortingArgsBuffer);
+            }
+        }
 
         // Prepare sorting data
         if (!buffer->GPU.SortedIndices)
@@ -704,10 +719,24 @@ void DrawEmitterGPU(RenderContext& renderContext, ParticleBuffer* buffer, DrawCa
             context->UpdateCB(GPUParticlesSortingCB, &data);
             context->BindCB(0, GPUParticlesSortingCB);
             context->BindSR(0, buffer->GPU.Buffer->View());
-            context->BindUA(0, buffer->GPU.SortingKeysBuffer->View());
-            // TODO: optimize it by using DispatchIndirect with shared invoke args generated after particles update
-            const int32 threadGroupSize = 1024;
-            context->Dispatch(GPUParticlesSortingCS[permutationIndex], Math::DivideAndRoundUp(buffer->GPU.ParticlesCountMax, threadGroupSize), 1, 1);
+            if (GPUParticlesSortingArgsCS && GPUParticlesSortingArgsBuffer)
+            {
+                // Generate the keys only for the live particles by dispatching indirectly from the particles counter (the counter is fixed during rendering so all sort modules share the arguments)
+                if (moduleIndex == 0)
+                {
+                    context->BindUA(0, GPUParticlesSortingArgsBuffer->View());
+                    context->Dispatch(GPUParticlesSortingArgsCS, 1, 1, 1);
+                    context->ResetUA();
+                }
+                context->BindUA(0, buffer->GPU.SortingKeysBuffer->View());
+                context->DispatchIndirect(GPUParticlesSortingCS[permutationIndex], GPUParticlesSortingArgsBuffer, 0);
+            }
+            else
+            {
+                context->BindUA(0, buffer->GPU.SortingKeysBuffer->View());
+                const int32 threadGroupSize = 1024;
+                context->Dispatch(GPUParticlesSortingCS[permutationIndex], Math::DivideAndRoundUp(buffer->GPU.ParticlesCountMax, threadGroupSize), 1, 1);
+            }
 
             // Perform sorting
             BitonicSort::Instance()->Sort(context, buffer->GPU.SortingKeysBuffer, buffer->GPU.Buffer, data.ParticleCounterOffset, sortAscending, buffer->GPU.SortedIndices);
@@ -5,6 +5,7 @@
 #include "Engine/Physics/Colliders/Collider.h"
 #include "Engine/Physics/PhysicsBackend.h"
 #include "Engine/Physics/PhysicsScene.h"
+#include "Engine/Physics/PhysicsSettings.h"
 #include "Engine/Serialization/Serialization.h"
 
 RigidBody::RigidBody(const SpawnParams& params)
@@ -26,6 +27,7 @@ RigidBody::RigidBody(const SpawnParams& params)
     , _updateMassWhenScaleChanges(false)
     , _overrideMass(false)
     , _isUpdatingTransform(false)
+    , _isInterpolating(false)
 {
 }
 
@@ -404,10 +406,50 @@ void RigidBody::OnActiveTransformChanged()
 {
     // Change actor transform (but with locking)
     ASSERT(!_isUpdatingTransform);
-    _isUpdatingTransform = true;
     Transform transform;
     PhysicsBackend::GetRigidActorPose(_actor, transform.Translation, transform.Orientation);
     transform.Scale = _transform.Scale;
+    if (PhysicsSettings::Get()->EnableInterpolation)
+    {
+        // Buffer the simulation step pose, the interpolated transform gets applied during update (see OnInterpolationUpdate)
+        if (_isInterpolating)
+        {
+            _interpolationPositions[0] = _interpolationPositions[1];
+            _interpolationOrientations[0] = _interpolationOrientations[1];
+        }
+        else
+        {
+            _isInterpolating = true;
+            _interpolationPositions[0] = transform.Translation;
+            _interpolationOrientations[0] = transform.Orientation;
+            GetPhysicsScene()->AddInterpolatingBody(this);
+        }
+        _interpolationPositions[1] = transform.Translation;
+        _interpolationOrientations[1] = transform.Orientation;
+        return;
+    }
+    _isUpdatingTransform = true;
+    if (_parent)
+    {
+        _parent->GetTransform().WorldToLocal(transform, _localTransform);
+    }
+    else
+    {
+        _localTransform = transform;
+    }
+    OnTransformChanged();
+    _isUpdatingTransform = false;
+}
+
+void RigidBody::OnInterpolationUpdate(float alpha)
+{
+    // Present the transform blended between the two most recent simulation step poses
+    ASSERT(!_isUpdatingTransform);
+    _isUpdatingTransform = true;
+    Transform transform;
+    Vector3::Lerp(_interpolationPositions[0], _interpolationPositions[1], alpha, transform.Translation);
+    Quaternion::Slerp(_interpolationOrientations[0], _interpolationOrientations[1], alpha, transform.Orientation);
+    transform.Scale = _transform.Scale;
     if (_parent)
     {
         _parent->GetTransform().WorldToLocal(transform, _localTransform);
@@ -480,6 +522,12 @@ void RigidBody::EndPlay()
     // Base
     Actor::EndPlay();
 
+    if (_isInterpolating)
+    {
+        _isInterpolating = false;
+        GetPhysicsScene()->RemoveInterpolatingBody(this);
+    }
+
     if (_actor)
     {
         // Remove actor
@@ -520,6 +568,12 @@ void RigidBody::OnTransformChanged()
         const bool kinematic = GetIsKinematic() && GetEnableSimulation();
         PhysicsBackend::SetRigidActorPose(_actor, _transform.Translation, _transform.Orientation, kinematic, true);
         UpdateScale();
+        if (_isInterpolating)
+        {
+            // Reset the interpolation buffer on a manual move to prevent blending across the teleport
+            _interpolationPositions[0] = _interpolationPositions[1] = _transform.Translation;
+            _interpolationOrientations[0] = _interpolationOrientations[1] = _transform.Orientation;
+        }
     }
 
     UpdateBounds();
@@ -527,6 +581,11 @@ void RigidBody::OnTransformChanged()
 
 void RigidBody::OnPhysicsSceneChanged(PhysicsScene* previous)
 {
+    if (_isInterpolating)
+    {
+        previous->RemoveInterpolatingBody(this);
+        GetPhysicsScene()->AddInterpolatingBody(this);
+    }
     PhysicsBackend::RemoveSceneActor(previous->GetPhysicsScene(), _actor);
     void* scene = GetPhysicsScene()->GetPhysicsScene();
     PhysicsBackend::AddSceneActor(scene, _actor);
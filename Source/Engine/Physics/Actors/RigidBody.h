@@ -38,6 +38,10 @@ protected:
     int32 _updateMassWhenScaleChanges : 1;
     int32 _overrideMass : 1;
     int32 _isUpdatingTransform : 1;
+    int32 _isInterpolating : 1;
+
+    Vector3 _interpolationPositions[2];
+    Quaternion _interpolationOrientations[2];
 
 public:
     /// <summary>
@@ -519,6 +523,12 @@ public:
     /// </summary>
     void UpdateScale();
 
+    /// <summary>
+    /// Applies the transform interpolated between the two most recent simulation steps (see PhysicsSettings.EnableInterpolation). Called by the physics scene during update.
+    /// </summary>
+    /// <param name="alpha">The normalized blend position between the previous and the current simulation step transforms.</param>
+    void OnInterpolationUpdate(float alpha);
+
 public:
     // [Actor]
     void Serialize(SerializeStream& stream, const void* otherObj) override;
@@ -8,6 +8,12 @@
 #include "Engine/Graphics/Models/MeshBase.h"
 #include "Engine/Threading/Threading.h"
 #include "Engine/Core/Log.h"
+#if USE_EDITOR
+#include "Engine/Engine/Globals.h"
+#include "Engine/Platform/File.h"
+#include "Engine/Platform/FileSystem.h"
+#include "Engine/Utilities/Crc.h"
+#endif
 
 bool CollisionCooking::CookCollision(const Argument& arg, CollisionData::SerializedOptions& outputOptions, BytesContainer& outputData)
 {
@@ -249,6 +255,31 @@ bool CollisionCooking::CookCollision(const Argument& arg, CollisionData::Seriali
     cookingInput.ConvexFlags = arg.ConvexFlags;
     cookingInput.ConvexVertexLimit = convexVertexLimit;
 
+    // Setup options
+    Platform::MemoryClear(&outputOptions, sizeof(outputOptions));
+    outputOptions.Type = arg.Type;
+    outputOptions.Model = arg.Model.GetID();
+    outputOptions.ModelLodIndex = arg.ModelLodIndex;
+    outputOptions.ConvexFlags = arg.ConvexFlags;
+    outputOptions.ConvexVertexLimit = arg.ConvexVertexLimit;
+    outputOptions.MaterialSlotsMask = arg.MaterialSlotsMask;
+
+#if USE_EDITOR
+    // Check the cooked data cache to skip cooking the same geometry again (addressed by the hash of the cooking input)
+    String cacheFilePath;
+    if (Globals::ProjectCacheFolder.HasChars())
+    {
+        uint32 hash = Crc::MemCrc32(cookingInput.VertexData, cookingInput.VertexCount * sizeof(Float3));
+        hash = Crc::MemCrc32(cookingInput.IndexData, cookingInput.IndexCount * sizeof(uint32), hash);
+        const uint32 settings[4] = { (uint32)arg.Type, (uint32)arg.ConvexFlags, (uint32)convexVertexLimit, (uint32)cookingInput.VertexCount };
+        const uint32 settingsHash = Crc::MemCrc32(settings, sizeof(settings), hash);
+        const String cacheFolder = Globals::ProjectCacheFolder / TEXT("CollisionCooking");
+        cacheFilePath = cacheFolder / String::Format(TEXT("{0:x}_{1:x}.bin"), hash, settingsHash);
+        if (FileSystem::FileExists(cacheFilePath) && !File::ReadAllBytes(cacheFilePath, outputData) && outputData.Length() != 0)
+            return false;
+    }
+#endif
+
     // Cook!
     if (arg.Type == CollisionDataType::ConvexMesh)
     {
@@ -266,14 +297,19 @@ bool CollisionCooking::CookCollision(const Argument& arg, CollisionData::Seriali
         return true;
     }
 
-    // Setup options
-    Platform::MemoryClear(&outputOptions, sizeof(outputOptions));
-    outputOptions.Type = arg.Type;
-    outputOptions.Model = arg.Model.GetID();
-    outputOptions.ModelLodIndex = arg.ModelLodIndex;
-    outputOptions.ConvexFlags = arg.ConvexFlags;
-    outputOptions.ConvexVertexLimit = arg.ConvexVertexLimit;
-    outputOptions.MaterialSlotsMask = arg.MaterialSlotsMask;
+#if USE_EDITOR
+    // Store the cooked data in the cache so the next cook of the same geometry is just a file read
+    if (cacheFilePath.HasChars())
+    {
+        const String cacheFolder = Globals::ProjectCacheFolder / TEXT("CollisionCooking");
+        if (!FileSystem::DirectoryExists(cacheFolder))
+            FileSystem::CreateDirectory(cacheFolder);
+        if (File::WriteAllBytes(cacheFilePath, outputData.Get(), outputData.Length()))
+        {
+            LOG(Warning, "Failed to save the cooked collision data to the cache (path: {0})", cacheFilePath);
+        }
+    }
+#endif
 
     return false;
 }
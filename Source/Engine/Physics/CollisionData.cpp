@@ -9,6 +9,8 @@
 #include "Engine/Physics/PhysicsBackend.h"
 #include "Engine/Physics/CollisionCooking.h"
 #include "Engine/Threading/Threading.h"
+#include "Engine/Threading/JobSystem.h"
+#include "Engine/Profiler/ProfilerCPU.h"
 
 REGISTER_BINARY_ASSET(CollisionData, "FlaxEngine.CollisionData", true);
 
@@ -61,6 +63,28 @@ bool CollisionData::CookCollision(CollisionDataType type, ModelBase* modelObj, i
     return false;
 }
 
+void CollisionData::CookCollisionAsync(CollisionDataType type, ModelBase* modelObj, int32 modelLodIndex, uint32 materialSlotsMask, ConvexMeshGenerationFlags convexFlags, int32 convexVertexLimit)
+{
+    // Validate state
+    if (!IsVirtual())
+    {
+        LOG(Warning, "Only virtual assets can be modified at runtime.");
+        return;
+    }
+
+    // Run the cooking on a job system worker (references keep both assets alive until the job is done)
+    AssetReference<CollisionData> self(this);
+    AssetReference<ModelBase> model(modelObj);
+    JobSystem::Dispatch([self, model, type, modelLodIndex, materialSlotsMask, convexFlags, convexVertexLimit](int32)
+    {
+        PROFILE_CPU_NAMED("CollisionData.CookCollisionAsync");
+        if (self->CookCollision(type, model.Get(), modelLodIndex, materialSlotsMask, convexFlags, convexVertexLimit))
+        {
+            LOG(Warning, "Failed to cook collision data (asset: {0}).", self->ToString());
+        }
+    });
+}
+
 bool CollisionData::CookCollision(CollisionDataType type, const Span<Float3>& vertices, const Span<uint32>& triangles, ConvexMeshGenerationFlags convexFlags, int32 convexVertexLimit)
 {
     CHECK_RETURN(vertices.Length() != 0, true);
@@ -203,6 +203,20 @@ public:
     /// <returns>True if failed, otherwise false.</returns>
     API_FUNCTION() bool CookCollision(CollisionDataType type, ModelBase* model, int32 modelLodIndex = 0, uint32 materialSlotsMask = MAX_uint32, ConvexMeshGenerationFlags convexFlags = ConvexMeshGenerationFlags::None, int32 convexVertexLimit = 255);
 
+    /// <summary>
+    /// Cooks the mesh collision data asynchronously on a job system worker thread and updates the virtual asset when done. Use <see cref="Asset.Loaded"/> event to get notified when the cooked data is ready to use.
+    /// </summary>
+    /// <remarks>
+    /// Can be used only for virtual assets (see <see cref="Asset.IsVirtual"/> and <see cref="Content.CreateVirtualAsset{T}"/>).
+    /// </remarks>
+    /// <param name="type">The collision data type.</param>
+    /// <param name="model">The source model.</param>
+    /// <param name="modelLodIndex">The source model LOD index.</param>
+    /// <param name="materialSlotsMask">The source model material slots mask. One bit per-slot. Can be used to exclude particular material slots from collision cooking.</param>
+    /// <param name="convexFlags">The convex mesh generation flags.</param>
+    /// <param name="convexVertexLimit">The convex mesh vertex limit. Use values in range [8;255]</param>
+    API_FUNCTION() void CookCollisionAsync(CollisionDataType type, ModelBase* model, int32 modelLodIndex = 0, uint32 materialSlotsMask = MAX_uint32, ConvexMeshGenerationFlags convexFlags = ConvexMeshGenerationFlags::None, int32 convexVertexLimit = 255);
+
     /// <summary>
     /// Cooks the mesh collision data and updates the virtual asset. action cannot be performed on a main thread.
     /// </summary>
@@ -19,10 +19,10 @@
 #include "Engine/Physics/Joints/SphericalJoint.h"
 #include "Engine/Physics/Joints/D6Joint.h"
 #include "Engine/Physics/Colliders/Collider.h"
-#include "Engine/Platform/CPUInfo.h"
 #include "Engine/Platform/CriticalSection.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Serialization/WriteStream.h"
+#include "Engine/Threading/JobSystem.h"
 #include <ThirdParty/PhysX/PxPhysicsAPI.h>
 #include <ThirdParty/PhysX/PxQueryFiltering.h>
 #include <ThirdParty/PhysX/extensions/PxFixedJoint.h>
@@ -100,6 +100,26 @@ class ErrorPhysX : public PxErrorCallback
     }
 };
 
+class JobsDispatcherPhysX : public PxCpuDispatcher
+{
+    void submitTask(PxBaseTask& task) override
+    {
+        // Run the simulation task via the engine job system (shared threads pool) instead of dedicated physics worker threads
+        PxBaseTask* taskPtr = &task;
+        JobSystem::Dispatch([taskPtr](int32)
+        {
+            PROFILE_CPU_NAMED("Physics.Task");
+            taskPtr->run();
+            taskPtr->release();
+        });
+    }
+
+    uint32_t getWorkerCount() const override
+    {
+        return (uint32_t)JobSystem::GetThreadsCount();
+    }
+};
+
 class QueryFilterPhysX : public PxQueryFilterCallback
 {
     PxQueryHitType::Enum preFilter(const PxFilterData& filterData, const PxShape* shape, const PxRigidActor* actor, PxHitFlags& queryFlags) override
@@ -347,6 +367,7 @@ namespace
     PxMaterial* DefaultMaterial = nullptr;
     AllocatorPhysX AllocatorCallback;
     ErrorPhysX ErrorCallback;
+    JobsDispatcherPhysX JobsDispatcher;
     PxTolerancesScale ToleranceScale;
     QueryFilterPhysX QueryFilter;
     CharacterQueryFilterPhysX CharacterQueryFilter;
@@ -831,8 +852,8 @@ void* PhysicsBackend::CreateScene(const PhysicsSettings& settings)
     sceneDesc.bounceThresholdVelocity = settings.BounceThresholdVelocity;
     if (sceneDesc.cpuDispatcher == nullptr)
     {
-        scenePhysX->CpuDispatcher = PxDefaultCpuDispatcherCreate(Math::Clamp<uint32>(Platform::GetCPUInfo().ProcessorCoreCount - 1, 1, 4));
-        CHECK_INIT(scenePhysX->CpuDispatcher, "PxDefaultCpuDispatcherCreate failed!");
+        // Run the simulation tasks on the engine job system workers (shared by all scenes)
+        scenePhysX->CpuDispatcher = &JobsDispatcher;
         sceneDesc.cpuDispatcher = scenePhysX->CpuDispatcher;
     }
 
@@ -872,7 +893,6 @@ void PhysicsBackend::DestroyScene(void* scene)
     RELEASE_PHYSX(scenePhysX->WheelRaycastBatchQuery);
 #endif
     RELEASE_PHYSX(scenePhysX->ControllerManager);
-    SAFE_DELETE(scenePhysX->CpuDispatcher);
     Allocator::Free(scenePhysX->ScratchMemory);
     scenePhysX->Scene->release();
 
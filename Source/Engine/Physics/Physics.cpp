@@ -5,11 +5,14 @@
 #include "PhysicsBackend.h"
 #include "PhysicalMaterial.h"
 #include "PhysicsSettings.h"
+#include "Actors/RigidBody.h"
 #include "Engine/Engine/Time.h"
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/ProfilerMemory.h"
 #include "Engine/Serialization/Serialization.h"
 #include "Engine/Threading/Threading.h"
+#include "Engine/Threading/JobSystem.h"
 
 PhysicsScene* Physics::DefaultScene = nullptr;
 Array<PhysicsScene*> Physics::Scenes;
@@ -61,6 +64,7 @@ void PhysicsSettings::Deserialize(DeserializeStream& stream, ISerializeModifier*
     DESERIALIZE(EnableSubstepping);
     DESERIALIZE(SubstepDeltaTime);
     DESERIALIZE(MaxSubsteps);
+    DESERIALIZE(EnableInterpolation);
     DESERIALIZE(QueriesHitTriggers);
     DESERIALIZE(SupportCookingAtRuntime);
 
@@ -100,6 +104,8 @@ bool PhysicsService::Init()
 
 void PhysicsService::LateUpdate()
 {
+    for (PhysicsScene* scene : Physics::Scenes)
+        scene->UpdateInterpolation();
     Physics::FlushRequests();
 }
 
@@ -192,6 +198,7 @@ void Physics::SetBounceThresholdVelocity(const float value)
 
 void Physics::Simulate(float dt)
 {
+    PROFILE_MEM_TAG("Physics");
     for (PhysicsScene* scene : Scenes)
     {
         if (scene->GetAutoSimulation())
@@ -233,6 +240,16 @@ bool Physics::RayCastAll(const Vector3& origin, const Vector3& direction, Array<
     return DefaultScene->RayCastAll(origin, direction, results, maxDistance, layerMask, hitTriggers);
 }
 
+void Physics::RayCastBatch(const RayCastQuery* queries, RayCastHit* hitInfos, bool* hits, int32 count)
+{
+    DefaultScene->RayCastBatch(queries, hitInfos, hits, count);
+}
+
+void Physics::SphereCastBatch(const SphereCastQuery* queries, RayCastHit* hitInfos, bool* hits, int32 count)
+{
+    DefaultScene->SphereCastBatch(queries, hitInfos, hits, count);
+}
+
 bool Physics::BoxCast(const Vector3& center, const Vector3& halfExtents, const Vector3& direction, const Quaternion& rotation, const float maxDistance, uint32 layerMask, bool hitTriggers)
 {
     return DefaultScene->BoxCast(center, halfExtents, direction, rotation, maxDistance, layerMask, hitTriggers);
@@ -433,6 +450,7 @@ void PhysicsScene::Simulate(float dt)
 {
     ASSERT(IsInMainThread() && !_isDuringSimulation);
     _isDuringSimulation = true;
+    _interpolationStep = dt;
     PhysicsBackend::StartSimulateScene(_scene, dt);
 }
 
@@ -448,6 +466,28 @@ void PhysicsScene::CollectResults()
     ASSERT(IsInMainThread());
     PhysicsBackend::EndSimulateScene(_scene);
     _isDuringSimulation = false;
+    _interpolationTime = 0.0f;
+}
+
+void PhysicsScene::UpdateInterpolation()
+{
+    if (_interpolatingBodies.IsEmpty() || !PhysicsSettings::Get()->EnableInterpolation)
+        return;
+    PROFILE_CPU_NAMED("Physics.Interpolation");
+    _interpolationTime += (float)Time::Update.UnscaledDeltaTime.GetTotalSeconds();
+    const float alpha = _interpolationStep > ZeroTolerance ? Math::Saturate(_interpolationTime / _interpolationStep) : 1.0f;
+    for (RigidBody* body : _interpolatingBodies)
+        body->OnInterpolationUpdate(alpha);
+}
+
+void PhysicsScene::AddInterpolatingBody(RigidBody* body)
+{
+    _interpolatingBodies.Add(body);
+}
+
+void PhysicsScene::RemoveInterpolatingBody(RigidBody* body)
+{
+    _interpolatingBodies.Remove(body);
 }
 
 bool PhysicsScene::RayCast(const Vector3& origin, const Vector3& direction, const float maxDistance, uint32 layerMask, bool hitTriggers)
@@ -465,6 +505,40 @@ bool PhysicsScene::RayCastAll(const Vector3& origin, const Vector3& direction, A
     return PhysicsBackend::RayCastAll(_scene, origin, direction, results, maxDistance, layerMask, hitTriggers);
 }
 
+void PhysicsScene::RayCastBatch(const RayCastQuery* queries, RayCastHit* hitInfos, bool* hits, int32 count)
+{
+    PROFILE_CPU();
+    CHECK(queries && hitInfos && hits);
+    if (count <= 0)
+        return;
+    void* scene = _scene;
+    JobSystem::ParallelFor(0, count, 32, [=](int32 begin, int32 end)
+    {
+        for (int32 i = begin; i < end; i++)
+        {
+            const RayCastQuery& q = queries[i];
+            hits[i] = PhysicsBackend::RayCast(scene, q.Origin, q.Direction, hitInfos[i], q.MaxDistance, q.LayerMask, q.HitTriggers);
+        }
+    });
+}
+
+void PhysicsScene::SphereCastBatch(const SphereCastQuery* queries, RayCastHit* hitInfos, bool* hits, int32 count)
+{
+    PROFILE_CPU();
+    CHECK(queries && hitInfos && hits);
+    if (count <= 0)
+        return;
+    void* scene = _scene;
+    JobSystem::ParallelFor(0, count, 32, [=](int32 begin, int32 end)
+    {
+        for (int32 i = begin; i < end; i++)
+        {
+            const SphereCastQuery& q = queries[i];
+            hits[i] = PhysicsBackend::SphereCast(scene, q.Center, q.Radius, q.Direction, hitInfos[i], q.MaxDistance, q.LayerMask, q.HitTriggers);
+        }
+    });
+}
+
 bool PhysicsScene::BoxCast(const Vector3& center, const Vector3& halfExtents, const Vector3& direction, const Quaternion& rotation, const float maxDistance, uint32 layerMask, bool hitTriggers)
 {
     return PhysicsBackend::BoxCast(_scene, center, halfExtents, direction, rotation, maxDistance, layerMask, hitTriggers);
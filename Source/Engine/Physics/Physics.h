@@ -130,6 +130,24 @@ public:
     /// <returns>True if ray hits an matching object, otherwise false.</returns>
     API_FUNCTION() static bool RayCastAll(const Vector3& origin, const Vector3& direction, API_PARAM(Out) Array<RayCastHit, HeapAllocation>& results, float maxDistance = MAX_float, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
 
+    /// <summary>
+    /// Performs a batch of raycasts against objects in the scene. Queries are executed in parallel on the job system workers and results are written into the caller-provided arrays without any allocations.
+    /// </summary>
+    /// <param name="queries">The queries to perform. Cannot be null.</param>
+    /// <param name="hitInfos">The result hit information array (one entry per query). Entry is valid only if the matching hits flag is set. Cannot be null.</param>
+    /// <param name="hits">The result hit flags array (one entry per query, true if the ray hit a matching object). Cannot be null.</param>
+    /// <param name="count">The amount of queries to perform.</param>
+    static void RayCastBatch(const RayCastQuery* queries, RayCastHit* hitInfos, bool* hits, int32 count);
+
+    /// <summary>
+    /// Performs a batch of sweep tests against objects in the scene using a sphere geometry. Queries are executed in parallel on the job system workers and results are written into the caller-provided arrays without any allocations.
+    /// </summary>
+    /// <param name="queries">The queries to perform. Cannot be null.</param>
+    /// <param name="hitInfos">The result hit information array (one entry per query). Entry is valid only if the matching hits flag is set. Cannot be null.</param>
+    /// <param name="hits">The result hit flags array (one entry per query, true if the sphere hit a matching object). Cannot be null.</param>
+    /// <param name="count">The amount of queries to perform.</param>
+    static void SphereCastBatch(const SphereCastQuery* queries, RayCastHit* hitInfos, bool* hits, int32 count);
+
     /// <summary>
     /// Performs a sweep test against objects in the scene using a box geometry.
     /// </summary>
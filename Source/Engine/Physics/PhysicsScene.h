@@ -11,6 +11,7 @@ struct ActionData;
 struct RayCastHit;
 class PhysicsSettings;
 class PhysicsColliderActor;
+class RigidBody;
 class Joint;
 class Collider;
 class CollisionData;
@@ -30,6 +31,9 @@ private:
     bool _isDuringSimulation = false;
     Vector3 _origin = Vector3::Zero;
     void* _scene = nullptr;
+    float _interpolationStep = 1.0f / 60.0f;
+    float _interpolationTime = 0.0f;
+    Array<RigidBody*> _interpolatingBodies;
 
 public:
     ~PhysicsScene();
@@ -125,6 +129,17 @@ public:
     /// </summary>
     API_FUNCTION() void CollectResults();
 
+    /// <summary>
+    /// Applies the interpolated transforms to the rigid bodies based on the time since the last simulation step (see PhysicsSettings.EnableInterpolation). Called once per update by the physics service.
+    /// </summary>
+    void UpdateInterpolation();
+
+    // Registers the rigid body for the transforms interpolation during update (see PhysicsSettings.EnableInterpolation).
+    void AddInterpolatingBody(RigidBody* body);
+
+    // Unregisters the rigid body from the transforms interpolation.
+    void RemoveInterpolatingBody(RigidBody* body);
+
 public:
     /// <summary>
     /// Performs a raycast against objects in the scene.
@@ -161,6 +176,24 @@ public:
     /// <returns>True if ray hits an matching object, otherwise false.</returns>
     API_FUNCTION() bool RayCastAll(const Vector3& origin, const Vector3& direction, API_PARAM(Out) Array<RayCastHit, HeapAllocation>& results, float maxDistance = MAX_float, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
 
+    /// <summary>
+    /// Performs a batch of raycasts against objects in the scene. Queries are executed in parallel on the job system workers and results are written into the caller-provided arrays without any allocations.
+    /// </summary>
+    /// <param name="queries">The queries to perform. Cannot be null.</param>
+    /// <param name="hitInfos">The result hit information array (one entry per query). Entry is valid only if the matching hits flag is set. Cannot be null.</param>
+    /// <param name="hits">The result hit flags array (one entry per query, true if the ray hit a matching object). Cannot be null.</param>
+    /// <param name="count">The amount of queries to perform.</param>
+    void RayCastBatch(const RayCastQuery* queries, RayCastHit* hitInfos, bool* hits, int32 count);
+
+    /// <summary>
+    /// Performs a batch of sweep tests against objects in the scene using a sphere geometry. Queries are executed in parallel on the job system workers and results are written into the caller-provided arrays without any allocations.
+    /// </summary>
+    /// <param name="queries">The queries to perform. Cannot be null.</param>
+    /// <param name="hitInfos">The result hit information array (one entry per query). Entry is valid only if the matching hits flag is set. Cannot be null.</param>
+    /// <param name="hits">The result hit flags array (one entry per query, true if the sphere hit a matching object). Cannot be null.</param>
+    /// <param name="count">The amount of queries to perform.</param>
+    void SphereCastBatch(const SphereCastQuery* queries, RayCastHit* hitInfos, bool* hits, int32 count);
+
     /// <summary>
     /// Performs a sweep test against objects in the scene using a box geometry.
     /// </summary>
@@ -73,6 +73,12 @@ public:
     API_FIELD(Attributes="EditorOrder(1020), EditorDisplay(\"Framerate\")")
     int32 MaxSubsteps = 5;
 
+    /// <summary>
+    /// If checked, rigid body transforms are interpolated between the two most recent simulation steps during game update. Removes the visible stutter when the physics update rate is lower than the game update rate.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(1030), EditorDisplay(\"Framerate\")")
+    bool EnableInterpolation = false;
+
     /// <summary>
     /// Enables support for cooking physical collision shapes geometry at runtime. Use it to enable generating runtime terrain collision or convex mesh colliders.
     /// </summary>
@@ -167,6 +167,77 @@ API_STRUCT() struct RayCastHit
     API_FIELD() Float2 UV;
 };
 
+/// <summary>
+/// Raycast query description used by the batched scene queries (see PhysicsScene.RayCastBatch).
+/// </summary>
+API_STRUCT() struct RayCastQuery
+{
+    DECLARE_SCRIPTING_TYPE_NO_SPAWN(RayCastQuery);
+
+    /// <summary>
+    /// The origin of the ray.
+    /// </summary>
+    API_FIELD() Vector3 Origin;
+
+    /// <summary>
+    /// The normalized direction of the ray.
+    /// </summary>
+    API_FIELD() Vector3 Direction;
+
+    /// <summary>
+    /// The maximum distance the ray should check for collisions.
+    /// </summary>
+    API_FIELD() float MaxDistance = MAX_float;
+
+    /// <summary>
+    /// The layer mask used to filter the results.
+    /// </summary>
+    API_FIELD() uint32 LayerMask = MAX_uint32;
+
+    /// <summary>
+    /// If set to true triggers will be hit, otherwise will skip them.
+    /// </summary>
+    API_FIELD() bool HitTriggers = true;
+};
+
+/// <summary>
+/// Sphere sweep query description used by the batched scene queries (see PhysicsScene.SphereCastBatch).
+/// </summary>
+API_STRUCT() struct SphereCastQuery
+{
+    DECLARE_SCRIPTING_TYPE_NO_SPAWN(SphereCastQuery);
+
+    /// <summary>
+    /// The sphere center.
+    /// </summary>
+    API_FIELD() Vector3 Center;
+
+    /// <summary>
+    /// The radius of the sphere.
+    /// </summary>
+    API_FIELD() float Radius = 0.0f;
+
+    /// <summary>
+    /// The normalized direction in which cast a sphere.
+    /// </summary>
+    API_FIELD() Vector3 Direction;
+
+    /// <summary>
+    /// The maximum distance the sphere should check for collisions.
+    /// </summary>
+    API_FIELD() float MaxDistance = MAX_float;
+
+    /// <summary>
+    /// The layer mask used to filter the results.
+    /// </summary>
+    API_FIELD() uint32 LayerMask = MAX_uint32;
+
+    /// <summary>
+    /// If set to true triggers will be hit, otherwise will skip them.
+    /// </summary>
+    API_FIELD() bool HitTriggers = true;
+};
+
 /// <summary>
 /// Physics collision shape variant for different shapes such as box, sphere, capsule.
 /// </summary>
@@ -236,8 +236,10 @@ public:
 
     void OnTouch(EventType type, float x, float y, int32 pointerId)
     {
+        ScopeLock lock(Locker);
         Event& e = _queue.AddOne();
         e.Type = type;
+        e.Timestamp = Platform::GetTimeSeconds();
         e.Target = nullptr;
         e.TouchData.Position.X = x;
         e.TouchData.Position.Y = y;
@@ -847,9 +849,11 @@ bool AndroidPlatform::Init()
 
     // Setup native platform input devices
     Input::Keyboard = KeyboardImpl = New<AndroidKeyboard>();
+    Input::LockDevices();
     Input::Gamepads.Add(GamepadImpl = New<AndroidDeviceGamepad>());
-    Input::OnGamepadsChanged();
     Input::CustomDevices.Add(TouchScreenImpl = New<AndroidTouchScreen>());
+    Input::UnlockDevices();
+    Input::OnGamepadsChanged();
 
     // Perform initial app messages pump
     Tick();
@@ -53,6 +53,23 @@ public:
     /// <returns>True if cannot read data, otherwise false.</returns>
     virtual bool Read(void* buffer, uint32 bytesToRead, uint32* bytesRead = nullptr) = 0;
 
+    /// <summary>
+    /// Maps the whole file contents into the process memory for read-only access.
+    /// </summary>
+    /// <returns>The pointer to the mapped view, or null if mapping failed or is not supported on this platform.</returns>
+    virtual void* Map()
+    {
+        return nullptr;
+    }
+
+    /// <summary>
+    /// Unmaps the file view created with Map.
+    /// </summary>
+    /// <param name="view">The mapped view pointer.</param>
+    virtual void Unmap(void* view)
+    {
+    }
+
     /// <summary>
     /// Writes data to a file.
     /// </summary>
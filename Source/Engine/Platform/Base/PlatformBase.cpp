@@ -16,6 +16,7 @@
 #include "Engine/Core/Utilities.h"
 #if COMPILE_WITH_PROFILER
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/ProfilerMemory.h"
 #endif
 #include "Engine/Threading/Threading.h"
 #include "Engine/Engine/CommandLine.h"
@@ -210,6 +211,9 @@ void PlatformBase::OnMemoryAlloc(void* ptr, uint64 size)
             activeEvent.NativeMemoryAllocation += (int32)size;
         }
     }
+
+    // Attribute the allocation to the active subsystem memory tag
+    ProfilerMemory::OnAlloc(ptr, size);
 }
 
 void PlatformBase::OnMemoryFree(void* ptr)
@@ -221,6 +225,8 @@ void PlatformBase::OnMemoryFree(void* ptr)
     // Track memory allocation in Tracy
     tracy::Profiler::MemFree(ptr, false);
 #endif
+
+    ProfilerMemory::OnFree(ptr);
 }
 
 #endif
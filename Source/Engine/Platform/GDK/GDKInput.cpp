@@ -78,13 +78,18 @@ bool IsSameDevice(IGameInputDevice* first, IGameInputDevice* second)
 
 void TryAddGamepad(IGameInputDevice* device)
 {
+    // GameInput can invoke the device callbacks on a background thread so keep the whole check-and-add under the devices lock
+    Input::LockDevices();
     for (auto& gamepad : Input::Gamepads)
     {
         if (IsSameDevice(((GDKGamepad*)gamepad)->Device, device))
+        {
+            Input::UnlockDevices();
             return;
+        }
     }
-
     Input::Gamepads.Add(New<GDKGamepad>(device));
+    Input::UnlockDevices();
     Input::OnGamepadsChanged();
 }
 
@@ -135,7 +135,9 @@ void LinuxInput::UpdateState()
             auto linuxGamepad = New<LinuxGamepad>(inputDevice.uid, String(inputDevice.name.c_str()));
             linuxGamepad->dev = StringAnsi(inputDevice.handler.c_str());
             linuxGamepad->fd = -1;
+            Input::LockDevices();
             Input::Gamepads.Add(linuxGamepad);
+            Input::UnlockDevices();
             Input::OnGamepadsChanged();
             LOG(Info, "Added gamepad '{}'", linuxGamepad->GetName());
         }
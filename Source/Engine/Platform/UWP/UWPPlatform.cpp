@@ -83,6 +83,8 @@ void UWPPlatform::Tick()
         int32 count = win->GetImpl()->GetGamepadsCount();
         bool modified = false;
 
+        Input::LockDevices();
+
         // Remove old ones
         for (int32 i = count; i < Input::Gamepads.Count(); i++)
         {
@@ -98,6 +100,8 @@ void UWPPlatform::Tick()
             modified = true;
         }
 
+        Input::UnlockDevices();
+
         if (modified)
             Input::OnGamepadsChanged();
     }
@@ -14,6 +14,7 @@
 #include <climits>
 #endif
 #include <sys/file.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <fcntl.h>
 #include <unistd.h>
@@ -99,6 +100,30 @@ bool UnixFile::Read(void* buffer, uint32 bytesToRead, uint32* bytesRead)
     return true;
 }
 
+void* UnixFile::Map()
+{
+    const uint32 size = GetSize();
+    if (size == 0)
+        return nullptr;
+    void* view = mmap(nullptr, size, PROT_READ, MAP_SHARED, _handle, 0);
+    if (view == MAP_FAILED)
+    {
+        LOG_UNIX_LAST_ERROR;
+        return nullptr;
+    }
+    _mappedSize = size;
+    return view;
+}
+
+void UnixFile::Unmap(void* view)
+{
+    if (view)
+    {
+        munmap(view, _mappedSize);
+        _mappedSize = 0;
+    }
+}
+
 bool UnixFile::Write(const void* buffer, uint32 bytesToWrite, uint32* bytesWritten)
 {
     const ssize_t tmp = write(_handle, buffer, bytesToWrite);
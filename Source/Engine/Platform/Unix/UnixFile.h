@@ -14,6 +14,7 @@ class FLAXENGINE_API UnixFile : public FileBase
 protected:
 
     int32 _handle;
+    uint32 _mappedSize = 0;
 
 public:
 
@@ -44,6 +45,8 @@ public:
 
     // [FileBase]
     bool Read(void* buffer, uint32 bytesToRead, uint32* bytesRead = nullptr) override;
+    void* Map() override;
+    void Unmap(void* view) override;
     bool Write(const void* buffer, uint32 bytesToWrite, uint32* bytesWritten = nullptr) override;
     void Close() override;
     uint32 GetSize() const override;
@@ -50,6 +50,30 @@ bool Win32File::Read(void* buffer, uint32 bytesToRead, uint32* bytesRead)
     return true;
 }
 
+void* Win32File::Map()
+{
+    auto mapping = CreateFileMappingW(_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr)
+    {
+        LOG_WIN32_LAST_ERROR;
+        return nullptr;
+    }
+    auto view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (view == nullptr)
+        LOG_WIN32_LAST_ERROR;
+
+    // Mapped views hold an internal reference to the mapping object so the handle can be released now
+    CloseHandle(mapping);
+
+    return view;
+}
+
+void Win32File::Unmap(void* view)
+{
+    if (view)
+        UnmapViewOfFile(view);
+}
+
 bool Win32File::Write(const void* buffer, uint32 bytesToWrite, uint32* bytesWritten)
 {
     // Try to write data
@@ -47,6 +47,8 @@ public:
 
     // [FileBase]
     bool Read(void* buffer, uint32 bytesToRead, uint32* bytesRead = nullptr) override;
+    void* Map() override;
+    void Unmap(void* view) override;
     bool Write(const void* buffer, uint32 bytesToWrite, uint32* bytesWritten = nullptr) override;
     void Close() final override;
     uint32 GetSize() const override;
@@ -133,7 +133,9 @@ void WindowsInput::Update()
             const DWORD result = XInputGetState(i, &state);
             if (result == ERROR_SUCCESS)
             {
+                Input::LockDevices();
                 Input::Gamepads.Add(New<WindowsGamepad>(i));
+                Input::UnlockDevices();
                 Input::OnGamepadsChanged();
             }
         }
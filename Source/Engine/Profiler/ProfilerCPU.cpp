@@ -3,13 +3,235 @@
 #if COMPILE_WITH_PROFILER
 
 #include "ProfilerCPU.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Collections/Dictionary.h"
 #include "Engine/Engine/Globals.h"
+#include "Engine/Platform/Thread.h"
+#include "Engine/Platform/CriticalSection.h"
+#include "Engine/Platform/ConditionVariable.h"
+#include "Engine/Serialization/FileWriteStream.h"
+#include "Engine/Threading/IRunnable.h"
 #include "Engine/Threading/ThreadRegistry.h"
 
 THREADLOCAL ProfilerCPU::Thread* ProfilerCPU::Thread::Current = nullptr;
 Array<ProfilerCPU::Thread*, InlinedAllocation<64>> ProfilerCPU::Threads;
 bool ProfilerCPU::Enabled = false;
 
+// Lossless high-frequency events capture: profiled threads append compact begin/end records into exclusively owned
+// arena pages; full pages get pushed to a background serializer thread that writes them to the output file and
+// recycles them back into the shared pool, so the capture performs no allocations once the pool is warm.
+// File format: [magic:int32][version:int32] followed by records:
+//  'L' - interned label: [id:int32][length:int32][chars]
+//  'P' - events page: [threadLabel:int32][count:int32][count * CaptureRecord]
+#define PROFILER_CAPTURE_MAGIC 1886547280
+#define PROFILER_CAPTURE_VERSION 1
+#define PROFILER_CAPTURE_PAGE_EVENTS 4096
+#define PROFILER_CAPTURE_INITIAL_PAGES 64
+
+struct CaptureRecord
+{
+    double Time;
+    int32 Label;
+    int32 Type; // 0 - begin, 1 - end
+};
+
+struct CapturePage
+{
+    int32 ThreadLabel;
+    int32 Count;
+    CaptureRecord Records[PROFILER_CAPTURE_PAGE_EVENTS];
+};
+
+struct CaptureThreadState
+{
+    CapturePage* Page = nullptr;
+    int32 ThreadLabel = -1;
+    Dictionary<uint32, int32> LabelCache; // Local cache of the interned labels to skip the global table locking on the hot path
+};
+
+namespace
+{
+    volatile int64 CaptureActive = 0;
+    volatile int64 CaptureExitFlag = 0;
+    FileWriteStream* CaptureStream = nullptr;
+    ::Thread* CaptureThread = nullptr;
+    CriticalSection CaptureLocker; // Guards the pages pool, the flush queue and the labels table
+    Array<CapturePage*> CaptureFreePages;
+    Array<CapturePage*> CaptureFlushQueue;
+    Array<String> CaptureLabels;
+    Dictionary<uint32, int32> CaptureLabelIds;
+    int32 CaptureLabelsWritten = 0;
+    uint64 CaptureEventsWritten = 0;
+    CriticalSection CaptureSignalLocker;
+    ConditionVariable CaptureSignal;
+
+    template<typename StringType>
+    int32 CaptureInternLabel(CaptureThreadState* state, const StringType& name)
+    {
+        const uint32 hash = GetHash(name);
+        int32 id;
+        if (state && state->LabelCache.TryGet(hash, id))
+            return id;
+        CaptureLocker.Lock();
+        if (!CaptureLabelIds.TryGet(hash, id))
+        {
+            id = CaptureLabels.Count();
+            CaptureLabels.Add(String(name));
+            CaptureLabelIds.Add(hash, id);
+        }
+        CaptureLocker.Unlock();
+        if (state)
+            state->LabelCache.Add(hash, id);
+        return id;
+    }
+
+    CapturePage* CaptureAcquirePage()
+    {
+        CapturePage* page = nullptr;
+        CaptureLocker.Lock();
+        if (CaptureFreePages.HasItems())
+        {
+            page = CaptureFreePages.Last();
+            CaptureFreePages.RemoveLast();
+        }
+        CaptureLocker.Unlock();
+        if (page == nullptr)
+        {
+            // The pool underestimated the event rate (pages get recycled once the serializer thread catches up)
+            page = New<CapturePage>();
+        }
+        page->Count = 0;
+        return page;
+    }
+
+    void CaptureFlushPage(CapturePage* page)
+    {
+        CaptureLocker.Lock();
+        CaptureFlushQueue.Add(page);
+        CaptureLocker.Unlock();
+        CaptureSignal.NotifyOne();
+    }
+
+    CaptureThreadState* CaptureGetThreadState(ProfilerCPU::Thread* thread)
+    {
+        auto state = (CaptureThreadState*)thread->Capture;
+        if (state == nullptr)
+        {
+            // Lazy-init for threads that started profiling after the capture begin (single allocation per thread)
+            state = New<CaptureThreadState>();
+            state->ThreadLabel = CaptureInternLabel(state, StringView(thread->GetName()));
+            state->Page = CaptureAcquirePage();
+            state->Page->ThreadLabel = state->ThreadLabel;
+            thread->Capture = state;
+        }
+        return state;
+    }
+
+    void CaptureAppend(ProfilerCPU::Thread* thread, double time, int32 type)
+    {
+        const auto state = CaptureGetThreadState(thread);
+        CapturePage* page = state->Page;
+        if (page->Count == PROFILER_CAPTURE_PAGE_EVENTS)
+        {
+            CaptureFlushPage(page);
+            page = CaptureAcquirePage();
+            page->ThreadLabel = state->ThreadLabel;
+            state->Page = page;
+        }
+        CaptureRecord& record = page->Records[page->Count++];
+        record.Time = time;
+        record.Label = -1;
+        record.Type = type;
+    }
+
+    template<typename StringType>
+    void CapturePatchLabel(ProfilerCPU::Thread* thread, const StringType& name)
+    {
+        // Assign the label to the begin record appended by this thread just before (the page is still exclusively owned)
+        const auto state = (CaptureThreadState*)thread->Capture;
+        if (state == nullptr || state->Page->Count == 0)
+            return;
+        CaptureRecord& record = state->Page->Records[state->Page->Count - 1];
+        if (record.Type == 0)
+            record.Label = CaptureInternLabel(state, name);
+    }
+}
+
+class CaptureSerializerThread : public IRunnable
+{
+public:
+    // [IRunnable]
+    String ToString() const override
+    {
+        return TEXT("CaptureSerializerThread");
+    }
+
+    int32 Run() override
+    {
+        Array<CapturePage*> pages;
+        Array<String> labels;
+        while (true)
+        {
+            const bool exit = Platform::AtomicRead(&CaptureExitFlag) != 0;
+
+            // Grab the pending pages and any labels interned since the last write
+            pages.Clear();
+            labels.Clear();
+            CaptureLocker.Lock();
+            pages.Add(CaptureFlushQueue);
+            CaptureFlushQueue.Clear();
+            const int32 labelsBase = CaptureLabelsWritten;
+            for (int32 i = labelsBase; i < CaptureLabels.Count(); i++)
+                labels.Add(CaptureLabels[i]);
+            CaptureLabelsWritten = CaptureLabels.Count();
+            CaptureLocker.Unlock();
+
+            // Serialize labels before the pages that reference them
+            for (int32 i = 0; i < labels.Count(); i++)
+            {
+                const String& label = labels[i];
+                CaptureStream->WriteByte('L');
+                CaptureStream->WriteInt32(labelsBase + i);
+                CaptureStream->WriteInt32(label.Length());
+                CaptureStream->WriteBytes(label.Get(), label.Length() * sizeof(Char));
+            }
+
+            // Serialize the pages and recycle them back into the pool
+            for (CapturePage* page : pages)
+            {
+                CaptureStream->WriteByte('P');
+                CaptureStream->WriteInt32(page->ThreadLabel);
+                CaptureStream->WriteInt32(page->Count);
+                CaptureStream->WriteBytes(page->Records, page->Count * sizeof(CaptureRecord));
+                CaptureEventsWritten += page->Count;
+                CaptureLocker.Lock();
+                CaptureFreePages.Add(page);
+                CaptureLocker.Unlock();
+            }
+
+            if (exit)
+            {
+                if (pages.IsEmpty() && labels.IsEmpty())
+                    break;
+                continue;
+            }
+            if (pages.IsEmpty())
+            {
+                CaptureSignalLocker.Lock();
+                CaptureSignal.Wait(CaptureSignalLocker, 10);
+                CaptureSignalLocker.Unlock();
+            }
+        }
+        CaptureStream->Flush();
+        return 0;
+    }
+
+    void AfterWork(bool wasKilled) override
+    {
+        Delete(this);
+    }
+};
+
 ProfilerCPU::EventBuffer::EventBuffer()
 {
     _capacity = 8192;
@@ -114,6 +336,8 @@ int32 ProfilerCPU::Thread::BeginEvent()
     e.Depth = _depth++;
     e.NativeMemoryAllocation = 0;
     e.ManagedMemoryAllocation = 0;
+    if (Platform::AtomicRead(&CaptureActive))
+        CaptureAppend(this, time, 0);
     return index;
 }
 
@@ -123,6 +347,8 @@ void ProfilerCPU::Thread::EndEvent(int32 index)
     _depth--;
     Event& e = Buffer.Get(index);
     e.End = time;
+    if (Platform::AtomicRead(&CaptureActive))
+        CaptureAppend(this, time, 1);
 }
 
 void ProfilerCPU::Thread::EndEvent()
@@ -131,6 +357,8 @@ void ProfilerCPU::Thread::EndEvent()
     _depth--;
     Event& e = (Buffer.Last()--).Event();
     e.End = time;
+    if (Platform::AtomicRead(&CaptureActive))
+        CaptureAppend(this, time, 1);
 }
 
 bool ProfilerCPU::IsProfilingCurrentThread()
@@ -181,6 +409,8 @@ int32 ProfilerCPU::BeginEvent(const Char* name)
             *dst++ = *src++;
     }
     *dst = 0;
+    if (Platform::AtomicRead(&CaptureActive))
+        CapturePatchLabel(thread, StringView(name));
     return index;
 }
 
@@ -200,6 +430,8 @@ int32 ProfilerCPU::BeginEvent(const char* name)
             *dst++ = *src++;
     }
     *dst = 0;
+    if (Platform::AtomicRead(&CaptureActive))
+        CapturePatchLabel(thread, StringAnsiView(name));
     return index;
 }
 
@@ -215,8 +447,96 @@ void ProfilerCPU::EndEvent()
         Thread::Current->EndEvent();
 }
 
+bool ProfilerCPU::StartCapture(const StringView& outputPath)
+{
+    if (Platform::AtomicRead(&CaptureActive) != 0)
+        return true;
+    const auto stream = FileWriteStream::Open(outputPath);
+    if (stream == nullptr)
+        return true;
+    stream->WriteInt32(PROFILER_CAPTURE_MAGIC);
+    stream->WriteInt32(PROFILER_CAPTURE_VERSION);
+    CaptureStream = stream;
+    CaptureEventsWritten = 0;
+    Platform::AtomicStore(&CaptureExitFlag, 0);
+
+    // Warm up the pages pool so the profiled threads never allocate mid-capture
+    CaptureLocker.Lock();
+    while (CaptureFreePages.Count() < PROFILER_CAPTURE_INITIAL_PAGES)
+        CaptureFreePages.Add(New<CapturePage>());
+    CaptureLocker.Unlock();
+
+    // Spawn the serializer thread and let the profiled threads see the active capture
+    CaptureThread = ::Thread::Create(New<CaptureSerializerThread>(), TEXT("Profiler Capture"));
+    if (CaptureThread == nullptr)
+    {
+        CaptureStream = nullptr;
+        Delete(stream);
+        return true;
+    }
+    Platform::AtomicStore(&CaptureActive, 1);
+    return false;
+}
+
+void ProfilerCPU::StopCapture()
+{
+    if (Platform::AtomicRead(&CaptureActive) == 0)
+        return;
+
+    // Stop accepting new records and give the in-flight appends a moment to complete
+    Platform::AtomicStore(&CaptureActive, 0);
+    Platform::Sleep(10);
+
+    // Flush the partially filled pages and release the per-thread states
+    for (int32 i = 0; i < Threads.Count(); i++)
+    {
+        const auto state = (CaptureThreadState*)Threads[i]->Capture;
+        if (state == nullptr)
+            continue;
+        Threads[i]->Capture = nullptr;
+        if (state->Page->Count != 0)
+        {
+            CaptureFlushPage(state->Page);
+        }
+        else
+        {
+            CaptureLocker.Lock();
+            CaptureFreePages.Add(state->Page);
+            CaptureLocker.Unlock();
+        }
+        Delete(state);
+    }
+
+    // Wait for the serializer thread to drain the queue and close the file
+    Platform::AtomicStore(&CaptureExitFlag, 1);
+    CaptureSignal.NotifyAll();
+    CaptureThread->Join();
+    Delete(CaptureThread);
+    CaptureThread = nullptr;
+    Delete(CaptureStream);
+    CaptureStream = nullptr;
+
+    // Release the capture memory
+    CaptureLocker.Lock();
+    const int32 labelsCount = CaptureLabelsWritten;
+    CaptureFreePages.ClearDelete();
+    CaptureFlushQueue.Clear();
+    CaptureLabels.Clear();
+    CaptureLabelIds.Clear();
+    CaptureLabelsWritten = 0;
+    CaptureLocker.Unlock();
+
+    LOG(Info, "Profiler capture saved ({0} events, {1} labels)", CaptureEventsWritten, labelsCount);
+}
+
+bool ProfilerCPU::IsCapturing()
+{
+    return Platform::AtomicRead(&CaptureActive) != 0;
+}
+
 void ProfilerCPU::Dispose()
 {
+    StopCapture();
     Enabled = false;
     Threads.ClearDelete();
 
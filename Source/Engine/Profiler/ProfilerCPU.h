@@ -253,6 +253,11 @@ public:
         /// </summary>
         EventBuffer Buffer;
 
+        /// <summary>
+        /// The per-thread state of the high-frequency events capture (owned by the active capture, null if unused). See ProfilerCPU::StartCapture.
+        /// </summary>
+        void* Capture = nullptr;
+
     public:
         /// <summary>
         /// Begins the event running on a this thread. Call EndEvent with index parameter equal to the returned value by BeginEvent function.
@@ -325,6 +330,23 @@ public:
     /// </summary>
     static void EndEvent();
 
+    /// <summary>
+    /// Starts the lossless high-frequency events capture into the given file. Events are appended to per-thread arena pages (preallocated so the steady-state capture performs no allocations) that get flushed to a background serializer thread, with string-interned event labels, so the worst frames never drop or wrap any data (unlike the default events ring buffer).
+    /// </summary>
+    /// <param name="outputPath">The output capture file path.</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    API_FUNCTION() static bool StartCapture(const StringView& outputPath);
+
+    /// <summary>
+    /// Stops the active high-frequency events capture (flushes the remaining pages and closes the file).
+    /// </summary>
+    API_FUNCTION() static void StopCapture();
+
+    /// <summary>
+    /// Returns true if the high-frequency events capture is active.
+    /// </summary>
+    API_FUNCTION() static bool IsCapturing();
+
     /// <summary>
     /// Releases resources. Calls to the profiling API after Dispose are not valid.
     /// </summary>
@@ -192,6 +192,15 @@ bool ProfilerGPU::GetLastFrameData(float& drawTimeMs, RenderStatsData& statsData
     return false;
 }
 
+ProfilerGPU::EventBuffer* ProfilerGPU::GetEventsHistory(int32 frameOffset)
+{
+    if (frameOffset < 1 || frameOffset >= PROFILER_GPU_EVENTS_FRAMES)
+        return nullptr;
+    const int32 index = (CurrentBuffer - frameOffset + PROFILER_GPU_EVENTS_FRAMES) % PROFILER_GPU_EVENTS_FRAMES;
+    auto& buffer = Buffers[index];
+    return buffer.HasData() ? &buffer : nullptr;
+}
+
 void ProfilerGPU::Dispose()
 {
     _timerQueriesPool.ClearDelete();
@@ -94,6 +94,14 @@ public:
             return &_data[index];
         }
 
+        /// <summary>
+        /// Gets the amount of the events in the buffer.
+        /// </summary>
+        int32 Count() const
+        {
+            return _data.Count();
+        }
+
         /// <summary>
         /// Adds new event to the buffer.
         /// </summary>
@@ -174,6 +182,13 @@ public:
     /// <returns>True if got the data, otherwise false.</returns>
     static bool GetLastFrameData(float& drawTimeMs, RenderStatsData& statsData);
 
+    /// <summary>
+    /// Tries to get the events buffer recorded the given amount of frames ago without introducing any GPU sync point. Useful for in-game performance HUDs that can use a few frames old timings.
+    /// </summary>
+    /// <param name="frameOffset">The amount of frames back from the current one (eg. 3 reads events recorded 3 frames ago). Must be in range [1;PROFILER_GPU_EVENTS_FRAMES-1].</param>
+    /// <returns>The events buffer with resolved timings from that frame, or null if it's not resolved yet or has no events.</returns>
+    static EventBuffer* GetEventsHistory(int32 frameOffset);
+
     /// <summary>
     /// Releases resources. Calls to the profiling API after Dispose are not valid
     /// </summary>
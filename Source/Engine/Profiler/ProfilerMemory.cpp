@@ -0,0 +1,159 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "ProfilerMemory.h"
+
+#if COMPILE_WITH_PROFILER
+
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Platform/CriticalSection.h"
+#include "Engine/Platform/StringUtils.h"
+
+namespace
+{
+    // The depth of the per-thread tags stack (deeper scopes get attributed to the deepest stored tag)
+    constexpr int32 TagStackSize = 16;
+
+    struct AllocationInfo
+    {
+        uint64 Size;
+        int32 Tag;
+    };
+
+    CriticalSection Locker;
+    bool TrackingEnabled = false;
+    int32 TagsCount = 0;
+    ProfilerMemory::TagData Tags[ProfilerMemory::MaxTags];
+    Dictionary<void*, AllocationInfo> Allocations;
+    THREADLOCAL int32 TagStack[TagStackSize];
+    THREADLOCAL int32 TagStackCount = 0;
+    THREADLOCAL bool InsideTracker = false;
+}
+
+bool ProfilerMemory::GetEnabled()
+{
+    return TrackingEnabled;
+}
+
+void ProfilerMemory::SetEnabled(bool value)
+{
+    // Guard against tracking the tracker own allocations (Dictionary resize/free would deadlock on the locker)
+    InsideTracker = true;
+    Locker.Lock();
+    if (TrackingEnabled != value)
+    {
+        TrackingEnabled = value;
+
+        // Reset the state (allocations made while the tracking was off cannot be attributed so frees of the stale entries are skipped)
+        Allocations.Clear();
+        for (int32 i = 0; i < TagsCount; i++)
+        {
+            Tags[i].LiveBytes = 0;
+            Tags[i].PeakBytes = 0;
+            Tags[i].Allocations = 0;
+        }
+    }
+    Locker.Unlock();
+    InsideTracker = false;
+}
+
+int32 ProfilerMemory::RegisterTag(const Char* name)
+{
+    Locker.Lock();
+    int32 result = -1;
+    for (int32 i = 0; i < TagsCount; i++)
+    {
+        if (StringUtils::Compare(Tags[i].Name, name) == 0)
+        {
+            result = i;
+            break;
+        }
+    }
+    if (result == -1 && TagsCount < MaxTags)
+    {
+        result = TagsCount++;
+        Tags[result].Name = name;
+        Tags[result].LiveBytes = 0;
+        Tags[result].PeakBytes = 0;
+        Tags[result].Allocations = 0;
+    }
+    Locker.Unlock();
+    return result;
+}
+
+void ProfilerMemory::PushTag(int32 tag)
+{
+    if (TagStackCount < TagStackSize)
+        TagStack[TagStackCount] = tag;
+    TagStackCount++;
+}
+
+void ProfilerMemory::PopTag()
+{
+    TagStackCount--;
+}
+
+void ProfilerMemory::OnAlloc(void* ptr, uint64 size)
+{
+    if (!TrackingEnabled || TagStackCount == 0 || InsideTracker)
+        return;
+    const int32 tag = TagStack[Math::Min(TagStackCount, (int32)TagStackSize) - 1];
+    if (tag == -1)
+        return;
+    InsideTracker = true;
+    Locker.Lock();
+    if (TrackingEnabled)
+    {
+        AllocationInfo info;
+        info.Size = size;
+        info.Tag = tag;
+        Allocations[ptr] = info;
+        TagData& data = Tags[tag];
+        data.LiveBytes += (int64)size;
+        data.PeakBytes = Math::Max(data.PeakBytes, data.LiveBytes);
+        data.Allocations++;
+    }
+    Locker.Unlock();
+    InsideTracker = false;
+}
+
+void ProfilerMemory::OnFree(void* ptr)
+{
+    if (!TrackingEnabled || InsideTracker)
+        return;
+    InsideTracker = true;
+    Locker.Lock();
+    AllocationInfo info;
+    if (Allocations.TryGet(ptr, info))
+    {
+        Allocations.Remove(ptr);
+        TagData& data = Tags[info.Tag];
+        data.LiveBytes -= (int64)info.Size;
+        data.Allocations--;
+    }
+    Locker.Unlock();
+    InsideTracker = false;
+}
+
+int32 ProfilerMemory::GetTags(TagData* buffer, int32 maxCount)
+{
+    Locker.Lock();
+    const int32 count = Math::Min(TagsCount, maxCount);
+    for (int32 i = 0; i < count; i++)
+        buffer[i] = Tags[i];
+    Locker.Unlock();
+    return count;
+}
+
+void ProfilerMemory::Dispose()
+{
+    InsideTracker = true;
+    Locker.Lock();
+    TrackingEnabled = false;
+    Allocations.Clear();
+    Allocations.SetCapacity(0);
+    Locker.Unlock();
+    InsideTracker = false;
+}
+
+#endif
@@ -0,0 +1,122 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Types/BaseTypes.h"
+
+#if COMPILE_WITH_PROFILER
+
+/// <summary>
+/// Provides native memory allocations tracking with per-subsystem attribution. Code pushes a subsystem tag scope (thread-local) and all the allocations made within it are counted into that tag (live bytes, peak bytes, allocations count). Disabled by default due to the tracking overhead (see SetEnabled).
+/// </summary>
+class FLAXENGINE_API ProfilerMemory
+{
+public:
+    enum
+    {
+        // Maximum amount of the registered subsystem tags.
+        MaxTags = 64,
+    };
+
+    /// <summary>
+    /// The single subsystem tag counters.
+    /// </summary>
+    struct TagData
+    {
+        // The tag name.
+        const Char* Name;
+
+        // The amount of memory currently allocated under this tag (in bytes).
+        int64 LiveBytes;
+
+        // The maximum amount of memory allocated under this tag since the tracking got enabled (in bytes).
+        int64 PeakBytes;
+
+        // The amount of the currently live allocations made under this tag.
+        int64 Allocations;
+    };
+
+public:
+    /// <summary>
+    /// Determines whether the allocations tracking is active.
+    /// </summary>
+    static bool GetEnabled();
+
+    /// <summary>
+    /// Enables or disables the allocations tracking. Enabling resets all the tags counters (allocations made while the tracking was off cannot be attributed).
+    /// </summary>
+    /// <param name="value">True if track the tagged allocations, otherwise false.</param>
+    static void SetEnabled(bool value);
+
+    /// <summary>
+    /// Registers the subsystem tag (or returns the existing one with the same name).
+    /// </summary>
+    /// <param name="name">The tag name. Has to be a static string (eg. literal) as only the pointer is stored.</param>
+    /// <returns>The tag index to use with PushTag.</returns>
+    static int32 RegisterTag(const Char* name);
+
+    /// <summary>
+    /// Pushes the tag onto the calling thread tags stack. All the following allocations on this thread get attributed to it (until PopTag).
+    /// </summary>
+    /// <param name="tag">The tag index returned by RegisterTag.</param>
+    static void PushTag(int32 tag);
+
+    /// <summary>
+    /// Pops the last tag pushed onto the calling thread tags stack.
+    /// </summary>
+    static void PopTag();
+
+    /// <summary>
+    /// Called on memory allocation to track it (invoked by the platform allocator).
+    /// </summary>
+    /// <param name="ptr">The allocated memory pointer.</param>
+    /// <param name="size">The size of the allocation (in bytes).</param>
+    static void OnAlloc(void* ptr, uint64 size);
+
+    /// <summary>
+    /// Called on memory freeing to track it (invoked by the platform allocator).
+    /// </summary>
+    /// <param name="ptr">The freed memory pointer.</param>
+    static void OnFree(void* ptr);
+
+    /// <summary>
+    /// Gets the registered tags counters.
+    /// </summary>
+    /// <param name="buffer">The output tags buffer.</param>
+    /// <param name="maxCount">The output buffer capacity.</param>
+    /// <returns>The amount of the tags written to the buffer.</returns>
+    static int32 GetTags(TagData* buffer, int32 maxCount);
+
+    /// <summary>
+    /// Releases resources. Calls to the tracking API after Dispose are not valid.
+    /// </summary>
+    static void Dispose();
+};
+
+/// <summary>
+/// Helper structure used to push/pop the memory tag within a single code block.
+/// </summary>
+struct ScopeProfileBlockMemory
+{
+    FORCE_INLINE ScopeProfileBlockMemory(int32 tag)
+    {
+        ProfilerMemory::PushTag(tag);
+    }
+
+    FORCE_INLINE ~ScopeProfileBlockMemory()
+    {
+        ProfilerMemory::PopTag();
+    }
+};
+
+// Shortcut macro for attributing all the memory allocations within a single code block to the given subsystem tag
+#define PROFILE_MEM_TAG(name) \
+    static const int32 __profilerMemoryTag = ProfilerMemory::RegisterTag(TEXT(name)); \
+    ScopeProfileBlockMemory ProfileBlockMemory(__profilerMemoryTag)
+
+#else
+
+// Empty macros for disabled profiler
+#define PROFILE_MEM_TAG(name)
+
+#endif
@@ -3,14 +3,54 @@
 #if COMPILE_WITH_PROFILER
 
 #include "ProfilingTools.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Collections/Sorting.h"
+#include "Engine/Core/Types/StringBuilder.h"
+#include "Engine/Core/Utilities.h"
 #include "Engine/Engine/Engine.h"
 #include "Engine/Engine/Time.h"
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Level/Level.h"
+#include "Engine/Level/Actor.h"
+#include "Engine/Level/Scene/Scene.h"
+#include "Engine/Platform/File.h"
+#include "Engine/Scripting/Script.h"
+#include "Engine/Threading/Threading.h"
 
 ProfilingTools::MainStats ProfilingTools::Stats;
 Array<ProfilingTools::ThreadStats, InlinedAllocation<64>> ProfilingTools::EventsCPU;
 Array<ProfilerGPU::Event> ProfilingTools::EventsGPU;
+float ProfilingTools::HitchThreshold = 0.0f;
+
+namespace
+{
+    struct CaptureThread
+    {
+        String Name;
+        Array<ProfilerCPU::Event> Events;
+    };
+
+    bool CaptureActive = false;
+    int32 CaptureFramesLeft = 0;
+    String CaptureOutputPath;
+    Array<CaptureThread> CaptureThreads;
+    float TriggerTimeMs = 0.0f;
+    int32 TriggerFrameCount = 0;
+    String TriggerOutputPath;
+    double LastHitchTime = 0.0;
+
+    void AppendJsonString(StringBuilder& sb, const Char* str)
+    {
+        for (; *str; str++)
+        {
+            const Char c = *str;
+            if (c == '\"' || c == '\\')
+                sb.Append('\\');
+            sb.Append(c);
+        }
+    }
+}
 
 class ProfilingToolsService : public EngineService
 {
@@ -78,6 +118,73 @@ void ProfilingToolsService::Update()
         thread->Buffer.Extract(pt->Events, true);
     }
 
+    // Timeline capture
+    {
+        auto& stats = ProfilingTools::Stats;
+        if (!CaptureActive && TriggerFrameCount > 0 && Math::Max(stats.UpdateTimeMs, stats.DrawCPUTimeMs) > TriggerTimeMs)
+        {
+            // The last frame exceeded the threshold - capture it (its events were just extracted) and the following frames
+            LOG(Info, "Profiler capture triggered by frame time {0} ms (threshold: {1} ms)", Math::Max(stats.UpdateTimeMs, stats.DrawCPUTimeMs), TriggerTimeMs);
+            ProfilingTools::StartCapture(TriggerFrameCount, TriggerOutputPath);
+            TriggerFrameCount = 0;
+        }
+        if (CaptureActive)
+        {
+            // Record this frame events
+            for (const auto& pt : ProfilingTools::EventsCPU)
+            {
+                CaptureThread* ct = nullptr;
+                for (auto& e : CaptureThreads)
+                {
+                    if (e.Name == pt.Name)
+                    {
+                        ct = &e;
+                        break;
+                    }
+                }
+                if (!ct)
+                {
+                    ct = &CaptureThreads.AddOne();
+                    ct->Name = pt.Name;
+                }
+                ct->Events.Add(pt.Events);
+            }
+            if (--CaptureFramesLeft <= 0)
+                ProfilingTools::EndCapture();
+        }
+    }
+
+    // Hitch detection
+    if (ProfilingTools::HitchThreshold > 0.0f)
+    {
+        auto& stats = ProfilingTools::Stats;
+        const float frameTime = Math::Max(stats.UpdateTimeMs, stats.DrawCPUTimeMs);
+        const double now = Platform::GetTimeSeconds();
+        if (frameTime > ProfilingTools::HitchThreshold && now - LastHitchTime > 1.0)
+        {
+            // Log the top inclusive scopes of the offending frame per thread (throttled to prevent log spam when hitching repeatedly)
+            LastHitchTime = now;
+            LOG(Warning, "Hitch detected: frame took {0} ms (threshold: {1} ms)", frameTime, ProfilingTools::HitchThreshold);
+            for (const auto& pt : ProfilingTools::EventsCPU)
+            {
+                if (pt.Events.IsEmpty())
+                    continue;
+                Array<ProfilerCPU::Event> sorted(pt.Events);
+                Sorting::QuickSort(sorted.Get(), sorted.Count(), +[](const ProfilerCPU::Event& a, const ProfilerCPU::Event& b)
+                {
+                    return a.End - a.Start > b.End - b.Start;
+                });
+                LOG(Warning, "Thread \'{0}\' top scopes:", pt.Name);
+                const int32 topCount = Math::Min(5, sorted.Count());
+                for (int32 i = 0; i < topCount; i++)
+                {
+                    const auto& e = sorted[i];
+                    LOG(Warning, "  {0}: {1} ms (depth {2})", e.Name, (float)(e.End - e.Start), e.Depth);
+                }
+            }
+        }
+    }
+
 #if 0
     // Print CPU threads events to the log
     for (auto& pt : ProfilingTools::EventsCPU)
@@ -168,8 +275,214 @@ void ProfilingToolsService::Update()
 #endif
 }
 
+void ProfilingTools::StartCapture(int32 frameCount, const StringView& outputPath)
+{
+    CaptureThreads.Clear();
+    CaptureFramesLeft = Math::Max(frameCount, 1);
+    CaptureOutputPath = outputPath;
+    CaptureActive = true;
+    LOG(Info, "Profiler capture started ({0} frames)", CaptureFramesLeft);
+}
+
+bool ProfilingTools::EndCapture()
+{
+    if (!CaptureActive)
+        return true;
+    CaptureActive = false;
+    CaptureFramesLeft = 0;
+
+    // Build the Chrome Trace Event format JSON (openable in chrome://tracing or Perfetto, times in microseconds)
+    StringBuilder sb;
+    sb.Append(TEXT("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n"));
+    bool first = true;
+    for (int32 tid = 0; tid < CaptureThreads.Count(); tid++)
+    {
+        const auto& thread = CaptureThreads[tid];
+        if (!first)
+            sb.Append(TEXT(",\n"));
+        first = false;
+        sb.Append(TEXT("{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":")).Append(tid).Append(TEXT(",\"args\":{\"name\":\""));
+        AppendJsonString(sb, *thread.Name);
+        sb.Append(TEXT("\"}}"));
+        for (const auto& e : thread.Events)
+        {
+            sb.Append(TEXT(",\n{\"ph\":\"X\",\"cat\":\"cpu\",\"pid\":1,\"tid\":")).Append(tid).Append(TEXT(",\"name\":\""));
+            AppendJsonString(sb, e.Name);
+            sb.AppendFormat(TEXT("\",\"ts\":{0},\"dur\":{1}}}"), e.Start * 1000.0, (e.End - e.Start) * 1000.0);
+        }
+    }
+    sb.Append(TEXT("\n]}"));
+    CaptureThreads.Clear();
+
+    // Save to the output file
+    if (File::WriteAllText(CaptureOutputPath, sb, Encoding::ANSI))
+    {
+        LOG(Error, "Failed to save the profiler capture to \'{0}\'", CaptureOutputPath);
+        return true;
+    }
+    LOG(Info, "Profiler capture saved to \'{0}\'", CaptureOutputPath);
+    return false;
+}
+
+void ProfilingTools::SetCaptureTrigger(float frameTimeMs, int32 frameCount, const StringView& outputPath)
+{
+    TriggerTimeMs = frameTimeMs;
+    TriggerFrameCount = Math::Max(frameCount, 1);
+    TriggerOutputPath = outputPath;
+}
+
+bool ProfilingTools::GetMemoryTrackingEnabled()
+{
+    return ProfilerMemory::GetEnabled();
+}
+
+void ProfilingTools::SetMemoryTrackingEnabled(bool value)
+{
+    ProfilerMemory::SetEnabled(value);
+}
+
+Array<ProfilingTools::MemoryTagStats> ProfilingTools::GetMemoryTags()
+{
+    ProfilerMemory::TagData tags[ProfilerMemory::MaxTags];
+    const int32 count = ProfilerMemory::GetTags(tags, ProfilerMemory::MaxTags);
+    Array<MemoryTagStats> result;
+    result.Resize(count);
+    for (int32 i = 0; i < count; i++)
+    {
+        MemoryTagStats& stats = result[i];
+        stats.Name = tags[i].Name;
+        stats.LiveBytes = tags[i].LiveBytes;
+        stats.PeakBytes = tags[i].PeakBytes;
+        stats.Allocations = tags[i].Allocations;
+    }
+    return result;
+}
+
+ProfilingTools::MemorySnapshot ProfilingTools::CaptureMemorySnapshot()
+{
+    PROFILE_CPU();
+    MemorySnapshot result;
+    result.Time = Platform::GetTimeSeconds();
+    result.ProcessMemory = Platform::GetProcessMemoryStats().UsedPhysicalMemory;
+    result.TotalActors = 0;
+    result.TotalScripts = 0;
+
+    // Census of all the scene objects grouped by type (bytes are estimated from the native type instance size)
+    Dictionary<const ScriptingType*, int32> typeToIndex;
+    const auto census = [&result, &typeToIndex](ScriptingObject* obj)
+    {
+        const ScriptingType& type = obj->GetType();
+        int32 index;
+        if (!typeToIndex.TryGet(&type, index))
+        {
+            index = result.SceneObjects.Count();
+            typeToIndex.Add(&type, index);
+            ObjectTypeStats& e = result.SceneObjects.AddOne();
+            e.TypeName = String(type.Fullname);
+            e.Count = 0;
+            e.Bytes = 0;
+        }
+        ObjectTypeStats& e = result.SceneObjects[index];
+        e.Count++;
+        e.Bytes += type.Size;
+    };
+    {
+        ScopeLock lock(Level::ScenesLock);
+        Array<Actor*> stack;
+        for (Scene* scene : Level::Scenes)
+            stack.Add(scene);
+        while (stack.HasItems())
+        {
+            Actor* actor = stack.Pop();
+            census(actor);
+            result.TotalActors++;
+            for (Script* script : actor->Scripts)
+            {
+                census(script);
+                result.TotalScripts++;
+            }
+            stack.Add(actor->Children);
+        }
+    }
+
+    // Embed the memory tags counters so a single snapshot covers both the object graph and the tagged allocations
+    result.MemoryTags = GetMemoryTags();
+
+    return result;
+}
+
+ProfilingTools::MemorySnapshotDiff ProfilingTools::DiffMemorySnapshots(const MemorySnapshot& begin, const MemorySnapshot& end)
+{
+    PROFILE_CPU();
+    MemorySnapshotDiff diff;
+    diff.Time = end.Time - begin.Time;
+    diff.ProcessMemoryDelta = (int64)end.ProcessMemory - (int64)begin.ProcessMemory;
+
+    // Objects growth per type (includes negative entries for the types that got removed)
+    Dictionary<String, const ObjectTypeStats*> beginObjects;
+    for (const ObjectTypeStats& e : begin.SceneObjects)
+        beginObjects.Add(e.TypeName, &e);
+    for (const ObjectTypeStats& e : end.SceneObjects)
+    {
+        ObjectTypeStats delta = e;
+        const ObjectTypeStats* other;
+        if (beginObjects.TryGet(e.TypeName, other))
+        {
+            delta.Count -= other->Count;
+            delta.Bytes -= other->Bytes;
+            beginObjects.Remove(e.TypeName);
+        }
+        if (delta.Count != 0 || delta.Bytes != 0)
+            diff.ObjectsGrowth.Add(delta);
+    }
+    for (const auto& i : beginObjects)
+    {
+        ObjectTypeStats& delta = diff.ObjectsGrowth.AddOne();
+        delta.TypeName = i.Key;
+        delta.Count = -i.Value->Count;
+        delta.Bytes = -i.Value->Bytes;
+    }
+    Sorting::QuickSort(diff.ObjectsGrowth.Get(), diff.ObjectsGrowth.Count(), +[](const ObjectTypeStats& a, const ObjectTypeStats& b)
+    {
+        return a.Bytes > b.Bytes;
+    });
+
+    // Memory tags growth (PeakBytes holds the end snapshot peak as-is)
+    Dictionary<String, const MemoryTagStats*> beginTags;
+    for (const MemoryTagStats& e : begin.MemoryTags)
+        beginTags.Add(e.Name, &e);
+    for (const MemoryTagStats& e : end.MemoryTags)
+    {
+        MemoryTagStats delta = e;
+        const MemoryTagStats* other;
+        if (beginTags.TryGet(e.Name, other))
+        {
+            delta.LiveBytes -= other->LiveBytes;
+            delta.Allocations -= other->Allocations;
+        }
+        if (delta.LiveBytes != 0 || delta.Allocations != 0)
+            diff.TagsGrowth.Add(delta);
+    }
+    Sorting::QuickSort(diff.TagsGrowth.Get(), diff.TagsGrowth.Count(), +[](const MemoryTagStats& a, const MemoryTagStats& b)
+    {
+        return a.LiveBytes > b.LiveBytes;
+    });
+
+    // Log the summary so automated soak tests can scrape it without any extra tooling
+    LOG(Info, "Memory snapshot diff over {0}s: process memory {1}{2} kB, {3} object types changed, {4} memory tags changed", Utilities::RoundTo2DecimalPlaces(diff.Time), diff.ProcessMemoryDelta >= 0 ? TEXT("+") : TEXT(""), diff.ProcessMemoryDelta / 1024, diff.ObjectsGrowth.Count(), diff.TagsGrowth.Count());
+    for (const ObjectTypeStats& e : diff.ObjectsGrowth)
+        LOG(Info, "  {0}: {1}{2} objects, {3}{4} bytes", e.TypeName, e.Count >= 0 ? TEXT("+") : TEXT(""), e.Count, e.Bytes >= 0 ? TEXT("+") : TEXT(""), e.Bytes);
+    for (const MemoryTagStats& e : diff.TagsGrowth)
+        LOG(Info, "  [{0}]: {1}{2} bytes, {3}{4} allocations", e.Name, e.LiveBytes >= 0 ? TEXT("+") : TEXT(""), e.LiveBytes, e.Allocations >= 0 ? TEXT("+") : TEXT(""), e.Allocations);
+
+    return diff;
+}
+
 void ProfilingToolsService::Dispose()
 {
+    CaptureActive = false;
+    CaptureThreads.Clear();
+    CaptureThreads.SetCapacity(0);
     ProfilingTools::EventsCPU.Clear();
     ProfilingTools::EventsCPU.SetCapacity(0);
     ProfilingTools::EventsGPU.SetCapacity(0);
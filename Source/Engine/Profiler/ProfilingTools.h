@@ -105,6 +105,123 @@ public:
         API_FIELD() Array<ProfilerCPU::Event> Events;
     };
 
+    /// <summary>
+    /// The memory allocations stats of a single subsystem tag (see ProfilerMemory).
+    /// </summary>
+    API_STRUCT(NoDefault) struct MemoryTagStats
+    {
+        DECLARE_SCRIPTING_TYPE_MINIMAL(MemoryTagStats);
+
+        /// <summary>
+        /// The subsystem tag name.
+        /// </summary>
+        API_FIELD() String Name;
+
+        /// <summary>
+        /// The amount of memory currently allocated under this tag (in bytes).
+        /// </summary>
+        API_FIELD() int64 LiveBytes;
+
+        /// <summary>
+        /// The maximum amount of memory allocated under this tag since the tracking got enabled (in bytes).
+        /// </summary>
+        API_FIELD() int64 PeakBytes;
+
+        /// <summary>
+        /// The amount of the currently live allocations made under this tag.
+        /// </summary>
+        API_FIELD() int64 Allocations;
+    };
+
+    /// <summary>
+    /// The census of the scene objects of a single type (see CaptureMemorySnapshot). In a snapshot diff it holds the deltas (can be negative when objects were removed).
+    /// </summary>
+    API_STRUCT(NoDefault) struct ObjectTypeStats
+    {
+        DECLARE_SCRIPTING_TYPE_MINIMAL(ObjectTypeStats);
+
+        /// <summary>
+        /// The object type full name.
+        /// </summary>
+        API_FIELD() String TypeName;
+
+        /// <summary>
+        /// The amount of the objects of this type.
+        /// </summary>
+        API_FIELD() int32 Count;
+
+        /// <summary>
+        /// The native memory used by those objects (in bytes, estimated from the type instance size).
+        /// </summary>
+        API_FIELD() int64 Bytes;
+    };
+
+    /// <summary>
+    /// The scene objects and memory census captured at a single point in time (see CaptureMemorySnapshot).
+    /// </summary>
+    API_STRUCT(NoDefault) struct MemorySnapshot
+    {
+        DECLARE_SCRIPTING_TYPE_MINIMAL(MemorySnapshot);
+
+        /// <summary>
+        /// The capture time (in seconds, via Platform::GetTimeSeconds clock).
+        /// </summary>
+        API_FIELD() double Time;
+
+        /// <summary>
+        /// The process physical memory usage at the capture time (in bytes).
+        /// </summary>
+        API_FIELD() uint64 ProcessMemory;
+
+        /// <summary>
+        /// The total amount of the actors in the loaded scenes.
+        /// </summary>
+        API_FIELD() int32 TotalActors;
+
+        /// <summary>
+        /// The total amount of the scripts in the loaded scenes.
+        /// </summary>
+        API_FIELD() int32 TotalScripts;
+
+        /// <summary>
+        /// The per-type census of all the scene objects (actors and scripts).
+        /// </summary>
+        API_FIELD() Array<ObjectTypeStats> SceneObjects;
+
+        /// <summary>
+        /// The per-subsystem memory tags counters at the capture time (empty if the memory tracking is disabled, see SetMemoryTrackingEnabled).
+        /// </summary>
+        API_FIELD() Array<MemoryTagStats> MemoryTags;
+    };
+
+    /// <summary>
+    /// The difference between two memory snapshots: the growth per object type and per memory tag (see DiffMemorySnapshots).
+    /// </summary>
+    API_STRUCT(NoDefault) struct MemorySnapshotDiff
+    {
+        DECLARE_SCRIPTING_TYPE_MINIMAL(MemorySnapshotDiff);
+
+        /// <summary>
+        /// The time between the two snapshots (in seconds).
+        /// </summary>
+        API_FIELD() double Time;
+
+        /// <summary>
+        /// The process physical memory usage change (in bytes).
+        /// </summary>
+        API_FIELD() int64 ProcessMemoryDelta;
+
+        /// <summary>
+        /// The scene objects count and bytes deltas per type (non-zero entries only, sorted by the bytes growth).
+        /// </summary>
+        API_FIELD() Array<ObjectTypeStats> ObjectsGrowth;
+
+        /// <summary>
+        /// The memory tags live bytes and allocations deltas (non-zero entries only, PeakBytes holds the end snapshot peak).
+        /// </summary>
+        API_FIELD() Array<MemoryTagStats> TagsGrowth;
+    };
+
 public:
     /// <summary>
     /// The current collected main stats by the profiler from the local session. Updated every frame.
@@ -120,6 +237,64 @@ public:
     /// The GPU rendering profiler events.
     /// </summary>
     API_FIELD(ReadOnly) static Array<ProfilerGPU::Event> EventsGPU;
+
+    /// <summary>
+    /// The hitch detection frame time threshold (in milliseconds). When a frame CPU time exceeds it, the top inclusive profiler scopes of the offending frame get logged (per thread) to correlate stutters with their causes. Use 0 to disable (default).
+    /// </summary>
+    API_FIELD() static float HitchThreshold;
+
+public:
+    /// <summary>
+    /// Starts capturing the CPU profiler events timeline for the given amount of the following frames. The capture is saved to the output file (Chrome trace JSON, openable in chrome://tracing or Perfetto) when the frames limit is reached or EndCapture gets called.
+    /// </summary>
+    /// <param name="frameCount">The amount of the frames to capture.</param>
+    /// <param name="outputPath">The output file path (.json).</param>
+    API_FUNCTION() static void StartCapture(int32 frameCount, const StringView& outputPath);
+
+    /// <summary>
+    /// Stops the active timeline capture and saves the collected events to the output file.
+    /// </summary>
+    /// <returns>True if failed to save the capture file, otherwise false.</returns>
+    API_FUNCTION() static bool EndCapture();
+
+    /// <summary>
+    /// Arms the automatic capture trigger: when a frame CPU time exceeds the given threshold, that frame (plus the following ones) gets captured and saved to the output file. Useful to diagnose hitches in cooked games and servers without attaching any tools.
+    /// </summary>
+    /// <param name="frameTimeMs">The frame time threshold (in milliseconds).</param>
+    /// <param name="frameCount">The amount of the frames to capture when triggered.</param>
+    /// <param name="outputPath">The output file path (.json).</param>
+    API_FUNCTION() static void SetCaptureTrigger(float frameTimeMs, int32 frameCount, const StringView& outputPath);
+
+public:
+    /// <summary>
+    /// Determines whether the per-subsystem memory allocations tracking is active.
+    /// </summary>
+    API_PROPERTY() static bool GetMemoryTrackingEnabled();
+
+    /// <summary>
+    /// Enables or disables the per-subsystem memory allocations tracking (see ProfilerMemory). Enabling resets all the tags counters. Disabled by default due to the tracking overhead.
+    /// </summary>
+    API_PROPERTY() static void SetMemoryTrackingEnabled(bool value);
+
+    /// <summary>
+    /// Gets the current memory allocations stats per subsystem tag. Empty if the memory tracking is disabled.
+    /// </summary>
+    /// <returns>The registered tags stats list.</returns>
+    API_FUNCTION() static Array<MemoryTagStats> GetMemoryTags();
+
+    /// <summary>
+    /// Captures the scene objects and memory census: per-type counts and estimated bytes of all the objects in the loaded scenes, plus the per-subsystem memory tags counters. Use DiffMemorySnapshots to compare two snapshots taken over time (eg. for leak hunting during soak tests).
+    /// </summary>
+    /// <returns>The captured snapshot.</returns>
+    API_FUNCTION() static MemorySnapshot CaptureMemorySnapshot();
+
+    /// <summary>
+    /// Compares the two memory snapshots and reports the growth by object type and by memory tag (sorted by the bytes growth). The summary is also printed to the log for automation.
+    /// </summary>
+    /// <param name="begin">The earlier snapshot.</param>
+    /// <param name="end">The later snapshot.</param>
+    /// <returns>The snapshots difference.</returns>
+    API_FUNCTION() static MemorySnapshotDiff DiffMemorySnapshots(API_PARAM(Ref) const MemorySnapshot& begin, API_PARAM(Ref) const MemorySnapshot& end);
 };
 
 #endif
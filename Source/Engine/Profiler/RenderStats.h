@@ -38,6 +38,11 @@ API_STRUCT() struct RenderStatsData
     /// </summary>
     API_FIELD() int64 PipelineStateChanges;
 
+    /// <summary>
+    /// The objects skipped from drawing by the occlusion culling count.
+    /// </summary>
+    API_FIELD() int64 Occluded;
+
     /// <summary>
     /// Initializes a new instance of the <see cref="RenderStatsData"/> struct.
     /// </summary>
@@ -47,6 +52,7 @@ API_STRUCT() struct RenderStatsData
         , Vertices(0)
         , Triangles(0)
         , PipelineStateChanges(0)
+        , Occluded(0)
     {
     }
 
@@ -67,11 +73,13 @@ API_STRUCT() struct RenderStatsData
         MIX(Vertices);
         MIX(Triangles);
         MIX(PipelineStateChanges);
+        MIX(Occluded);
 #undef MIX
     }
 };
 
 #define RENDER_STAT_DISPATCH_CALL() Platform::InterlockedIncrement(&RenderStatsData::Counter.DispatchCalls)
+#define RENDER_STAT_OCCLUDED() Platform::InterlockedIncrement(&RenderStatsData::Counter.Occluded)
 #define RENDER_STAT_PS_STATE_CHANGE() Platform::InterlockedIncrement(&RenderStatsData::Counter.PipelineStateChanges)
 #define RENDER_STAT_DRAW_CALL(vertices, triangles) \
 	Platform::InterlockedIncrement(&RenderStatsData::Counter.DrawCalls); \
@@ -81,6 +89,7 @@ API_STRUCT() struct RenderStatsData
 #else
 
 #define RENDER_STAT_DISPATCH_CALL()
+#define RENDER_STAT_OCCLUDED()
 #define RENDER_STAT_PS_STATE_CHANGE()
 #define RENDER_STAT_DRAW_CALL(vertices, primitives)
 
@@ -5,6 +5,7 @@
 #include "FontManager.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Threading/Threading.h"
+#include "Engine/Threading/JobSystem.h"
 #include "IncludeFreeType.h"
 
 Font::Font(FontAsset* parentAsset, int32 size)
@@ -91,13 +92,46 @@ void Font::CacheText(const StringView& text)
     }
 }
 
+void Font::CacheTextAsync(const StringView& text)
+{
+    // Collect the characters missing from the cache (deduplicated)
+    Array<Char> missing;
+    for (int32 i = 0; i < text.Length(); i++)
+    {
+        const Char c = text[i];
+        if (!_characters.ContainsKey(c) && !missing.Contains(c))
+            missing.Add(c);
+    }
+    if (missing.IsEmpty())
+        return;
+
+    // Rasterize the glyphs on the worker threads (glyphs caching is thread-safe; the new entries get uploaded to the atlases with the next frame flush)
+    const int32 count = missing.Count();
+    Font* font = this;
+    Array<Char> chars = MoveTemp(missing);
+    Function<void(int32)> job = [font, chars](int32 i)
+    {
+        FontCharacterEntry entry;
+        font->GetCharacter(chars[i], entry);
+    };
+    JobSystem::Dispatch(job, count);
+}
+
 void Font::Invalidate()
 {
     ScopeLock lock(_asset->Locker);
 
-    for (auto i = _characters.Begin(); i.IsNotEnd(); ++i)
+    if (EnumHasAnyFlags(_asset->GetOptions().Flags, FontFlags::SignedDistanceField))
+    {
+        // The glyphs are shared by all sizes of the asset so release them once at the asset level
+        FontManager::InvalidateSdf(_asset);
+    }
+    else
     {
-        FontManager::Invalidate(i->Value);
+        for (auto i = _characters.Begin(); i.IsNotEnd(); ++i)
+        {
+            FontManager::Invalidate(i->Value);
+        }
     }
     _characters.Clear();
 }
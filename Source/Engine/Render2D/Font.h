@@ -204,6 +204,11 @@ DECLARE_SCRIPTING_TYPE_MINIMAL(FontCharacterEntry);
     /// The size the character in the texture (in texture coordinates space).
     /// </summary>
     API_FIELD() Float2 UVSize;
+
+    /// <summary>
+    /// The scale to apply to the glyph bitmap when rendering. Used by the signed distance field fonts that share a single glyph set baked at a fixed base size across all font sizes.
+    /// </summary>
+    API_FIELD() float Scale = 1.0f;
 };
 
 template<>
@@ -318,6 +323,12 @@ public:
     /// <param name="text">The text witch characters to cache.</param>
     API_FUNCTION() void CacheText(const StringView& text);
 
+    /// <summary>
+    /// Caches the given text characters asynchronously using the worker threads. Use it to pre-warm the glyphs cache with the expected characters (eg. chat messages alphabet) so the following draw calls don't stall rasterizing them on demand. The font has to stay alive until the caching job completes.
+    /// </summary>
+    /// <param name="text">The text witch characters to cache.</param>
+    API_FUNCTION() void CacheTextAsync(const StringView& text);
+
     /// <summary>
     /// Invalidates all cached dynamic font atlases using this font. Can be used to reload font characters after changing font asset options.
     /// </summary>
@@ -58,6 +58,10 @@ void FontAsset::unload(bool isReloading)
         _fonts.Clear();
     }
 
+    // Release the shared signed distance field glyphs
+    if (EnumHasAnyFlags(_options.Flags, FontFlags::SignedDistanceField))
+        FontManager::InvalidateSdf(this);
+
     // Unload face
     if (_face)
     {
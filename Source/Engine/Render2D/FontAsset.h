@@ -64,6 +64,11 @@ API_ENUM(Attributes="Flags") enum class FontFlags : byte
     /// Enables slant effect, emulating italic style.
     /// </summary>
     Italic = 4,
+
+    /// <summary>
+    /// Enables baking glyphs as signed distance fields at a fixed base size. All font sizes created from this asset share a single set of glyph bitmaps which reduces atlas memory usage and keeps characters sharp when scaled.
+    /// </summary>
+    SignedDistanceField = 8,
 };
 
 DECLARE_ENUM_OPERATORS(FontFlags);
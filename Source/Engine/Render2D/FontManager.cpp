@@ -6,6 +6,7 @@
 #include "Font.h"
 #include "Engine/Platform/Platform.h"
 #include "Engine/Core/Log.h"
+#include "Engine/Core/Math/Math.h"
 #include "Engine/Content/Content.h"
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Threading/Threading.h"
@@ -14,12 +15,19 @@
 #include <ThirdParty/freetype/ftbitmap.h>
 #include <ThirdParty/freetype/internal/ftdrv.h>
 
+// The characters size used to bake the signed distance field glyphs (shared across all font sizes)
+#define FONT_SDF_BASE_SIZE 48
+
+// The distance field spread (in pixels) around the glyph outline at the base size
+#define FONT_SDF_SPREAD 6
+
 namespace FontManagerImpl
 {
     FT_Library Library;
     CriticalSection Locker;
     Array<AssetReference<FontTextureAtlas>> Atlases;
     Array<byte> GlyphImageData;
+    Dictionary<FontAsset*, Dictionary<Char, FontCharacterEntry>> SdfGlyphs;
 }
 
 using namespace FontManagerImpl;
@@ -95,6 +103,7 @@ void FontManagerService::Dispose()
 {
     // Release font atlases
     Atlases.Resize(0);
+    SdfGlyphs.Clear();
 
     // Clean library
     if (Library)
@@ -113,6 +122,173 @@ FontTextureAtlas* FontManager::GetAtlas(int32 index)
     return index >= 0 && index < Atlases.Count() ? Atlases.Get()[index].Get() : nullptr;
 }
 
+static const FontTextureAtlas::Slot* AddGlyphToAtlas(int32 glyphWidth, int32 glyphHeight, int32& atlasIndex)
+{
+    // Find atlas for the character texture
+    const FontTextureAtlas::Slot* slot = nullptr;
+    for (atlasIndex = 0; atlasIndex < Atlases.Count(); atlasIndex++)
+    {
+        // Add the character to the texture
+        slot = Atlases[atlasIndex]->AddEntry(glyphWidth, glyphHeight, GlyphImageData);
+
+        // Check result, if not null char has been added
+        if (slot)
+        {
+            break;
+        }
+    }
+
+    // Check if there is no atlas for this character
+    if (!slot)
+    {
+        // Create new atlas
+        auto atlas = Content::CreateVirtualAsset<FontTextureAtlas>();
+        atlas->Setup(PixelFormat::R8_UNorm, FontTextureAtlas::PaddingStyle::PadWithZero);
+        Atlases.Add(atlas);
+
+        // Init atlas
+        const int32 fontAtlasSize = 512; // TODO: make it a configuration variable
+        atlas->Init(fontAtlasSize, fontAtlasSize);
+
+        // Add the character to the texture
+        slot = atlas->AddEntry(glyphWidth, glyphHeight, GlyphImageData);
+    }
+
+    return slot;
+}
+
+static bool AddNewSdfEntry(Font* font, Char c, FontCharacterEntry& entry)
+{
+    FontAsset* asset = font->GetAsset();
+    Dictionary<Char, FontCharacterEntry>& glyphs = SdfGlyphs[asset];
+    FontCharacterEntry base;
+    if (!glyphs.TryGet(c, base))
+    {
+        // Bake the glyph distance field at the fixed base size (all font sizes created from the asset share it)
+        const FT_Face face = asset->GetFTFace();
+        ASSERT(face != nullptr);
+        FT_Error error = FT_Set_Char_Size(face, 0, ConvertPixelTo26Dot6<FT_F26Dot6>((float)FONT_SDF_BASE_SIZE), DefaultDPI, DefaultDPI);
+        if (error)
+        {
+            LOG_FT_ERROR(error);
+            return true;
+        }
+        FT_Set_Transform(face, nullptr, nullptr);
+
+        // Load the glyph (hinting is pointless for distance fields that get rescaled anyway)
+        const FT_UInt glyphIndex = FT_Get_Char_Index(face, c);
+        error = FT_Load_Glyph(face, glyphIndex, FT_LOAD_NO_BITMAP | FT_LOAD_NO_AUTOHINT | FT_LOAD_NO_HINTING);
+        if (error)
+        {
+            LOG_FT_ERROR(error);
+            return true;
+        }
+
+        // Handle special effects
+        const FontOptions& options = asset->GetOptions();
+        if (EnumHasAnyFlags(options.Flags, FontFlags::Bold))
+        {
+            FT_GlyphSlot_Embolden(face->glyph);
+        }
+        if (EnumHasAnyFlags(options.Flags, FontFlags::Italic))
+        {
+            FT_GlyphSlot_Oblique(face->glyph);
+        }
+
+        // Render glyph coverage to the bitmap
+        FT_GlyphSlot glyph = face->glyph;
+        FT_Render_Glyph(glyph, FT_RENDER_MODE_NORMAL);
+        const FT_Bitmap* bitmap = &glyph->bitmap;
+        ASSERT(bitmap->pixel_mode == FT_PIXEL_MODE_GRAY);
+
+        // Fill the character data (at the base size)
+        Platform::MemoryClear(&base, sizeof(base));
+        base.Character = c;
+        base.IsValid = true;
+        base.Scale = 1.0f;
+        base.AdvanceX = Convert26Dot6ToRoundedPixel<int16>(glyph->advance.x);
+        base.OffsetX = glyph->bitmap_left - FONT_SDF_SPREAD;
+        base.OffsetY = glyph->bitmap_top + FONT_SDF_SPREAD;
+        base.BearingY = Convert26Dot6ToRoundedPixel<int16>(glyph->metrics.horiBearingY);
+        base.Height = Convert26Dot6ToRoundedPixel<int16>(glyph->metrics.height);
+
+        const int32 srcWidth = (int32)bitmap->width;
+        const int32 srcHeight = (int32)bitmap->rows;
+        if (srcWidth == 0 || srcHeight == 0)
+        {
+            // Empty glyph
+            base.TextureIndex = MAX_uint8;
+        }
+        else
+        {
+            // Compute the distance field over the coverage bitmap expanded by the spread margin (0.5 maps to the glyph outline)
+            const int32 glyphWidth = srcWidth + 2 * FONT_SDF_SPREAD;
+            const int32 glyphHeight = srcHeight + 2 * FONT_SDF_SPREAD;
+            GlyphImageData.Clear();
+            GlyphImageData.Resize(glyphWidth * glyphHeight);
+            const byte* coverage = bitmap->buffer;
+            const int32 pitch = bitmap->pitch;
+#define FONT_SDF_INSIDE(x, y) ((x) >= 0 && (y) >= 0 && (x) < srcWidth && (y) < srcHeight && coverage[(y) * pitch + (x)] >= 128)
+            for (int32 y = 0; y < glyphHeight; y++)
+            {
+                for (int32 x = 0; x < glyphWidth; x++)
+                {
+                    const int32 srcX = x - FONT_SDF_SPREAD;
+                    const int32 srcY = y - FONT_SDF_SPREAD;
+                    const bool inside = FONT_SDF_INSIDE(srcX, srcY);
+
+                    // Find the nearest pixel on the other side of the outline (within the spread radius)
+                    float distanceSq = (float)(FONT_SDF_SPREAD * FONT_SDF_SPREAD);
+                    for (int32 dy = -FONT_SDF_SPREAD; dy <= FONT_SDF_SPREAD; dy++)
+                    {
+                        for (int32 dx = -FONT_SDF_SPREAD; dx <= FONT_SDF_SPREAD; dx++)
+                        {
+                            if (FONT_SDF_INSIDE(srcX + dx, srcY + dy) != inside)
+                                distanceSq = Math::Min(distanceSq, (float)(dx * dx + dy * dy));
+                        }
+                    }
+
+                    const float distance = Math::Sqrt(distanceSq) / (float)FONT_SDF_SPREAD;
+                    const float signedDistance = inside ? distance : -distance;
+                    GlyphImageData[y * glyphWidth + x] = (byte)(Math::Saturate(0.5f + 0.5f * signedDistance) * 255.0f);
+                }
+            }
+#undef FONT_SDF_INSIDE
+
+            // Add the glyph to the atlas
+            int32 atlasIndex;
+            const FontTextureAtlas::Slot* slot = AddGlyphToAtlas(glyphWidth, glyphHeight, atlasIndex);
+            if (slot == nullptr)
+            {
+                LOG(Error, "Cannot find free space in texture atlases for character '{0}' from font {1} {2}. Size: {3}x{4}", c, String(face->family_name), String(face->style_name), glyphWidth, glyphHeight);
+                return true;
+            }
+
+            // Fill with atlas dependant data
+            const uint32 padding = Atlases[atlasIndex]->GetPaddingAmount();
+            base.TextureIndex = atlasIndex;
+            base.UV.X = static_cast<float>(slot->X + padding);
+            base.UV.Y = static_cast<float>(slot->Y + padding);
+            base.UVSize.X = static_cast<float>(slot->Width - 2 * padding);
+            base.UVSize.Y = static_cast<float>(slot->Height - 2 * padding);
+        }
+
+        glyphs.Add(c, base);
+    }
+
+    // Share the baked glyph across font sizes by scaling the metrics only (the atlas slot stays the same)
+    const float ratio = (float)font->GetSize() * FontManager::FontScale / (float)FONT_SDF_BASE_SIZE;
+    entry = base;
+    entry.OffsetX = (int16)Math::RoundToInt((float)base.OffsetX * ratio);
+    entry.OffsetY = (int16)Math::RoundToInt((float)base.OffsetY * ratio);
+    entry.AdvanceX = (int16)Math::RoundToInt((float)base.AdvanceX * ratio);
+    entry.BearingY = (int16)Math::RoundToInt((float)base.BearingY * ratio);
+    entry.Height = (int16)Math::RoundToInt((float)base.Height * ratio);
+    entry.Scale = ratio;
+
+    return false;
+}
+
 bool FontManager::AddNewEntry(Font* font, Char c, FontCharacterEntry& entry)
 {
     ScopeLock lock(Locker);
@@ -121,6 +297,11 @@ bool FontManager::AddNewEntry(Font* font, Char c, FontCharacterEntry& entry)
     const FontOptions& options = asset->GetOptions();
     const FT_Face face = asset->GetFTFace();
     ASSERT(face != nullptr);
+
+    // Signed distance field fonts share a single glyph set baked at the fixed base size
+    if (EnumHasAnyFlags(options.Flags, FontFlags::SignedDistanceField))
+        return AddNewSdfEntry(font, c, entry);
+
     font->FlushFaceSize();
 
     // Set load flags
@@ -198,6 +379,7 @@ bool FontManager::AddNewEntry(Font* font, Char c, FontCharacterEntry& entry)
     entry.IsValid = true;
     entry.BearingY = Convert26Dot6ToRoundedPixel<int16>(glyph->metrics.horiBearingY);
     entry.Height = Convert26Dot6ToRoundedPixel<int16>(glyph->metrics.height);
+    entry.Scale = 1.0f;
 
     // Allocate memory
     const int32 glyphWidth = bitmap->width;
@@ -241,35 +423,8 @@ bool FontManager::AddNewEntry(Font* font, Char c, FontCharacterEntry& entry)
     }
 
     // Find atlas for the character texture
-    int32 atlasIndex = 0;
-    const FontTextureAtlas::Slot* slot = nullptr;
-    for (; atlasIndex < Atlases.Count(); atlasIndex++)
-    {
-        // Add the character to the texture
-        slot = Atlases[atlasIndex]->AddEntry(glyphWidth, glyphHeight, GlyphImageData);
-
-        // Check result, if not null char has been added
-        if (slot)
-        {
-            break;
-        }
-    }
-
-    // Check if there is no atlas for this character
-    if (!slot)
-    {
-        // Create new atlas
-        auto atlas = Content::CreateVirtualAsset<FontTextureAtlas>();
-        atlas->Setup(PixelFormat::R8_UNorm, FontTextureAtlas::PaddingStyle::PadWithZero);
-        Atlases.Add(atlas);
-
-        // Init atlas
-        const int32 fontAtlasSize = 512; // TODO: make it a configuration variable
-        atlas->Init(fontAtlasSize, fontAtlasSize);
-
-        // Add the character to the texture
-        slot = atlas->AddEntry(glyphWidth, glyphHeight, GlyphImageData);
-    }
+    int32 atlasIndex;
+    const FontTextureAtlas::Slot* slot = AddGlyphToAtlas(glyphWidth, glyphHeight, atlasIndex);
     if (slot == nullptr)
     {
         LOG(Error, "Cannot find free space in texture atlases for character '{0}' from font {1} {2}. Size: {3}x{4}", c, String(face->family_name), String(face->style_name), glyphWidth, glyphHeight);
@@ -300,6 +455,20 @@ void FontManager::Invalidate(FontCharacterEntry& entry)
     atlas->Invalidate(slotX, slotY, slotSizeX, slotSizeY);
 }
 
+void FontManager::InvalidateSdf(FontAsset* asset)
+{
+    ScopeLock lock(Locker);
+
+    Dictionary<Char, FontCharacterEntry>* glyphs = SdfGlyphs.TryGet(asset);
+    if (!glyphs)
+        return;
+    for (auto i = glyphs->Begin(); i.IsNotEnd(); ++i)
+    {
+        Invalidate(i->Value);
+    }
+    SdfGlyphs.Remove(asset);
+}
+
 void FontManager::Flush()
 {
     for (const auto& atlas : Atlases)
@@ -50,6 +50,12 @@ public:
     /// <param name="entry">The font character entry.</param>
     static void Invalidate(FontCharacterEntry& entry);
 
+    /// <summary>
+    /// Invalidates the cached signed distance field glyphs of the given font asset (shared by all font sizes). Used when the asset gets invalidated or unloaded.
+    /// </summary>
+    /// <param name="asset">The font asset.</param>
+    static void InvalidateSdf(FontAsset* asset);
+
     /// <summary>
     /// Flushes all font atlases.
     /// </summary>
@@ -2,6 +2,7 @@
 
 #include "Render2D.h"
 #include "Font.h"
+#include "FontAsset.h"
 #include "FontManager.h"
 #include "FontTextureAtlas.h"
 #include "RotatedRectangle.h"
@@ -44,6 +45,9 @@
 #define RENDER2D_INITIAL_IB_CAPACITY (1024)
 #define RENDER2D_INITIAL_DRAW_CALL_CAPACITY (512)
 
+// The number of frames a cached text layout can go unused before getting evicted
+#define RENDER2D_TEXT_LAYOUT_CACHE_LIFETIME 60
+
 #define RENDER2D_BLUR_MAX_SAMPLES 64
 
 // The format for the blur effect temporary buffer
@@ -73,6 +77,7 @@ enum class DrawCallType : byte
     FillTexturePoint,
     DrawChar,
     DrawCharMaterial,
+    DrawCharSDF,
     Custom,
     Material,
     Blur,
@@ -162,6 +167,7 @@ struct CachedPSO
     GPUPipelineState* PS_Color_NoAlpha;
 
     GPUPipelineState* PS_Font;
+    GPUPipelineState* PS_FontSDF;
 
     GPUPipelineState* PS_BlurH;
     GPUPipelineState* PS_BlurV;
@@ -180,6 +186,17 @@ struct ClipMask
     Rectangle Bounds;
 };
 
+// The cached text layout (processed lines reused for the static texts drawn every frame)
+struct TextLayoutCacheEntry
+{
+    String Text;
+    Font* TextFont = nullptr;
+    int32 FontHeight = 0;
+    TextLayoutOptions Options;
+    Array<FontLineCache> Lines;
+    uint64 LastUsedFrame = 0;
+};
+
 Render2D::RenderingFeatures Render2D::Features = RenderingFeatures::VertexSnapping;
 
 namespace
@@ -193,8 +210,11 @@ namespace
 
     // Drawing
     Array<Render2DDrawCall> DrawCalls;
-    Array<FontLineCache> Lines;
     Array<Float2> Lines2;
+
+    // Text layouts caching
+    Dictionary<uint32, TextLayoutCacheEntry> TextLayoutCache(256);
+    uint64 TextLayoutFrame = 0;
     bool IsScissorsRectEmpty;
     bool IsScissorsRectEnabled;
 
@@ -220,6 +240,14 @@ namespace
     DynamicIndexBuffer IB(RENDER2D_INITIAL_IB_CAPACITY, sizeof(uint32), TEXT("Render2D.IB"));
     uint32 VBIndex = 0;
     uint32 IBIndex = 0;
+
+    // Draw calls sequence recording (see Render2DDrawCache)
+    Render2DDrawCache* RecordingCache = nullptr;
+    uint32 RecordStartVB = 0;
+    uint32 RecordStartIB = 0;
+    int32 RecordStartVBData = 0;
+    int32 RecordStartIBData = 0;
+    int32 RecordStartDrawCalls = 0;
 }
 
 #define RENDER2D_WRITE_IB_QUAD(indices) \
@@ -454,6 +482,7 @@ CanDrawCallCallback CanDrawCallBatch[] =
     CanDrawCallCallbackTexture, // FillTexturePoint,
     CanDrawCallCallbackChar, // DrawChar,
     CanDrawCallCallbackCharMaterial, // DrawCharMaterial,
+    CanDrawCallCallbackChar, // DrawCharSDF,
     CanDrawCallCallbackFalse, // Custom,
     CanDrawCallCallbackMaterial, // Material,
     CanDrawCallCallbackFalse, // Blur,
@@ -515,6 +544,11 @@ bool CachedPSO::Init(GPUShader* shader, bool useDepth)
     if (PS_Font->Init(desc))
         return true;
     //
+    desc.PS = shader->GetPS("PS_FontSDF");
+    PS_FontSDF = GPUDevice::Instance->CreatePipelineState();
+    if (PS_FontSDF->Init(desc))
+        return true;
+    //
     desc.PS = shader->GetPS("PS_LineAA");
     PS_LineAA = GPUDevice::Instance->CreatePipelineState();
     if (PS_LineAA->Init(desc))
@@ -552,6 +586,7 @@ void CachedPSO::Dispose()
     SAFE_DELETE_GPU_RESOURCE(PS_Color);
     SAFE_DELETE_GPU_RESOURCE(PS_Color_NoAlpha);
     SAFE_DELETE_GPU_RESOURCE(PS_Font);
+    SAFE_DELETE_GPU_RESOURCE(PS_FontSDF);
     SAFE_DELETE_GPU_RESOURCE(PS_BlurH);
     SAFE_DELETE_GPU_RESOURCE(PS_BlurV);
     SAFE_DELETE_GPU_RESOURCE(PS_Downscale);
@@ -614,8 +649,8 @@ void Render2DService::Dispose()
     TintLayersStack.Resize(0);
     ClipLayersStack.Resize(0);
     DrawCalls.Resize(0);
-    Lines.Resize(0);
     Lines2.Resize(0);
+    TextLayoutCache.Clear();
 
     GUIShader = nullptr;
 
@@ -671,6 +706,7 @@ void Render2D::Begin(GPUContext* context, GPUTextureView* output, GPUTextureView
     View = viewport;
     ViewProjection = viewProjection;
     DrawCalls.Clear();
+    RecordingCache = nullptr;
 
     // Initialize default transform
     const Matrix3x3 defaultTransform = Matrix3x3::Identity;
@@ -793,6 +829,111 @@ void Render2D::EndFrame()
 
     // Synchronize the texture atlases data
     FontManager::Flush();
+
+    // Evict the text layouts that were not used recently
+    TextLayoutFrame++;
+    for (auto i = TextLayoutCache.Begin(); i.IsNotEnd(); ++i)
+    {
+        if (TextLayoutFrame - i->Value.LastUsedFrame > RENDER2D_TEXT_LAYOUT_CACHE_LIFETIME)
+            TextLayoutCache.Remove(i);
+    }
+}
+
+Render2DDrawCache::Render2DDrawCache(const SpawnParams& params)
+    : ScriptingObject(params)
+{
+}
+
+bool Render2DDrawCache::IsValid() const
+{
+    return _valid;
+}
+
+void Render2DDrawCache::Invalidate()
+{
+    _valid = false;
+    _verticesCount = 0;
+    _indicesCount = 0;
+    _vertices.Clear();
+    _indices.Clear();
+    _drawCalls.Clear();
+}
+
+void Render2D::BeginCacheRecording(Render2DDrawCache* cache)
+{
+    RENDER2D_CHECK_RENDERING_STATE;
+    CHECK(cache);
+    ASSERT(RecordingCache == nullptr);
+
+    // Mark the current buffers location to bake everything pushed until EndCacheRecording
+    RecordingCache = cache;
+    RecordStartVB = VBIndex;
+    RecordStartIB = IBIndex;
+    RecordStartVBData = VB.Data.Count();
+    RecordStartIBData = IB.Data.Count();
+    RecordStartDrawCalls = DrawCalls.Count();
+}
+
+void Render2D::EndCacheRecording(Render2DDrawCache* cache)
+{
+    RENDER2D_CHECK_RENDERING_STATE;
+    CHECK(cache && cache == RecordingCache);
+    RecordingCache = nullptr;
+
+    // Bake the recorded vertices (already transformed, clipped and tinted)
+    cache->_vertices.Clear();
+    cache->_vertices.Add(VB.Data.Get() + RecordStartVBData, VB.Data.Count() - RecordStartVBData);
+    cache->_verticesCount = VBIndex - RecordStartVB;
+
+    // Bake the recorded indices rebased to the sequence start (so the replay can append them at any buffer location)
+    const int32 indicesCount = (IB.Data.Count() - RecordStartIBData) / sizeof(uint32);
+    cache->_indices.Resize(indicesCount * sizeof(uint32));
+    uint32* dstIndices = (uint32*)cache->_indices.Get();
+    const uint32* srcIndices = (const uint32*)(IB.Data.Get() + RecordStartIBData);
+    for (int32 i = 0; i < indicesCount; i++)
+        dstIndices[i] = srcIndices[i] - RecordStartVB;
+    cache->_indicesCount = (uint32)indicesCount;
+
+    // Bake the recorded draw calls
+    const int32 drawCallsCount = DrawCalls.Count() - RecordStartDrawCalls;
+    cache->_drawCalls.Resize(drawCallsCount * (int32)sizeof(Render2DDrawCall));
+    Render2DDrawCall* dstCalls = (Render2DDrawCall*)cache->_drawCalls.Get();
+    for (int32 i = 0; i < drawCallsCount; i++)
+    {
+        dstCalls[i] = DrawCalls[RecordStartDrawCalls + i];
+        dstCalls[i].StartIB -= RecordStartIB;
+    }
+
+    cache->_valid = true;
+}
+
+void Render2D::DrawCache(Render2DDrawCache* cache)
+{
+    RENDER2D_CHECK_RENDERING_STATE;
+    CHECK(cache && cache->_valid);
+    ASSERT(RecordingCache == nullptr);
+
+    // Append the baked vertices in bulk (no re-tessellation)
+    VB.Write(cache->_vertices.Get(), cache->_vertices.Count());
+
+    // Append the baked indices rebased to the current buffer location
+    const uint32* srcIndices = (const uint32*)cache->_indices.Get();
+    uint32* dstIndices = IB.WriteReserve<uint32>((int32)cache->_indicesCount);
+    for (uint32 i = 0; i < cache->_indicesCount; i++)
+        dstIndices[i] = srcIndices[i] + VBIndex;
+
+    // Append the baked draw calls (they get batched with the surrounding drawing by the flush)
+    const Render2DDrawCall* srcCalls = (const Render2DDrawCall*)cache->_drawCalls.Get();
+    const int32 drawCallsCount = cache->_drawCalls.Count() / (int32)sizeof(Render2DDrawCall);
+    for (int32 i = 0; i < drawCallsCount; i++)
+    {
+        Render2DDrawCall& drawCall = DrawCalls.AddOne();
+        drawCall = srcCalls[i];
+        drawCall.StartIB += IBIndex;
+    }
+
+    VBIndex += cache->_verticesCount;
+    IBIndex += cache->_indicesCount;
 }
 
 void Render2D::PushTransform(const Matrix3x3& transform)
@@ -981,6 +1122,10 @@ void DrawBatch(int32 startIndex, int32 count)
         Context->BindSR(0, d.AsChar.Tex);
         Context->SetState(CurrentPso->PS_Font);
         break;
+    case DrawCallType::DrawCharSDF:
+        Context->BindSR(0, d.AsChar.Tex);
+        Context->SetState(CurrentPso->PS_FontSDF);
+        break;
     case DrawCallType::DrawCharMaterial:
     {
         // Apply and bind material
@@ -1168,6 +1313,11 @@ void Render2D::DrawText(Font* font, const StringView& text, const Color& color,
         drawCall.Type = DrawCallType::DrawCharMaterial;
         drawCall.AsChar.Mat = customMaterial;
     }
+    else if (EnumHasAnyFlags(font->GetAsset()->GetOptions().Flags, FontFlags::SignedDistanceField))
+    {
+        drawCall.Type = DrawCallType::DrawCharSDF;
+        drawCall.AsChar.Mat = nullptr;
+    }
     else
     {
         drawCall.Type = DrawCallType::DrawChar;
@@ -1226,7 +1376,7 @@ void Render2D::DrawText(Font* font, const StringView& text, const Color& color,
                 const float x = pointer.X + entry.OffsetX * scale;
                 const float y = pointer.Y + (font->GetHeight() + font->GetDescender() - entry.OffsetY) * scale;
 
-                Rectangle charRect(x, y, entry.UVSize.X * scale, entry.UVSize.Y * scale);
+                Rectangle charRect(x, y, entry.UVSize.X * entry.Scale * scale, entry.UVSize.Y * entry.Scale * scale);
 
                 Float2 upperLeftUV = entry.UV * invAtlasSize;
                 Float2 rightBottomUV = (entry.UV + entry.UVSize) * invAtlasSize;
@@ -1255,6 +1405,43 @@ void Render2D::DrawText(Font* font, const StringView& text, const TextRange& tex
     DrawText(font, textRange.Substring(text), color, location, customMaterial);
 }
 
+const Array<FontLineCache>& GetTextLayout(Font* font, const StringView& text, const TextLayoutOptions& layout)
+{
+    // Hash the text with the font and the layout properties (bounds location is ignored as the lines get placed relative to it)
+    uint32 hash = GetHash(text);
+    CombineHash(hash, GetHash((const void*)font));
+    CombineHash(hash, GetHash(layout.Bounds.Size.X));
+    CombineHash(hash, GetHash(layout.Bounds.Size.Y));
+    CombineHash(hash, (uint32)layout.HorizontalAlignment);
+    CombineHash(hash, (uint32)layout.VerticalAlignment);
+    CombineHash(hash, (uint32)layout.TextWrapping);
+    CombineHash(hash, GetHash(layout.Scale));
+    CombineHash(hash, GetHash(layout.BaseLinesGapScale));
+
+    // Reuse the cached layout if it matches (verified to handle hash collisions and font changes)
+    TextLayoutCacheEntry& entry = TextLayoutCache[hash];
+    entry.LastUsedFrame = TextLayoutFrame;
+    if (entry.TextFont == font
+        && entry.FontHeight == font->GetHeight()
+        && entry.Options.Bounds.Size == layout.Bounds.Size
+        && entry.Options.HorizontalAlignment == layout.HorizontalAlignment
+        && entry.Options.VerticalAlignment == layout.VerticalAlignment
+        && entry.Options.TextWrapping == layout.TextWrapping
+        && Math::NearEqual(entry.Options.Scale, layout.Scale)
+        && Math::NearEqual(entry.Options.BaseLinesGapScale, layout.BaseLinesGapScale)
+        && entry.Text == text)
+        return entry.Lines;
+
+    // Process the text and cache the result
+    entry.Text = text;
+    entry.TextFont = font;
+    entry.FontHeight = font->GetHeight();
+    entry.Options = layout;
+    entry.Lines.Clear();
+    font->ProcessText(text, entry.Lines, layout);
+    return entry.Lines;
+}
+
 void Render2D::DrawText(Font* font, const StringView& text, const Color& color, const TextLayoutOptions& layout, MaterialBase* customMaterial)
 {
     RENDER2D_CHECK_RENDERING_STATE;
@@ -1274,9 +1461,8 @@ void Render2D::DrawText(Font* font, const StringView& text, const Color& color,
     int32 kerning;
     float scale = layout.Scale / FontManager::FontScale;
 
-    // Process text to get lines
-    Lines.Clear();
-    font->ProcessText(text, Lines, layout);
+    // Process text to get lines (or reuse the cached layout for the static texts drawn every frame)
+    const Array<FontLineCache>& lines = GetTextLayout(font, text, layout);
 
     // Render all lines
     FontCharacterEntry entry;
@@ -1286,14 +1472,19 @@ void Render2D::DrawText(Font* font, const StringView& text, const Color& color,
         drawCall.Type = DrawCallType::DrawCharMaterial;
         drawCall.AsChar.Mat = customMaterial;
     }
+    else if (EnumHasAnyFlags(font->GetAsset()->GetOptions().Flags, FontFlags::SignedDistanceField))
+    {
+        drawCall.Type = DrawCallType::DrawCharSDF;
+        drawCall.AsChar.Mat = nullptr;
+    }
     else
     {
         drawCall.Type = DrawCallType::DrawChar;
         drawCall.AsChar.Mat = nullptr;
     }
-    for (int32 lineIndex = 0; lineIndex < Lines.Count(); lineIndex++)
+    for (int32 lineIndex = 0; lineIndex < lines.Count(); lineIndex++)
     {
-        const FontLineCache& line = Lines[lineIndex];
+        const FontLineCache& line = lines[lineIndex];
         Float2 pointer = line.Location;
 
         // Render all characters from the line
@@ -1343,7 +1534,7 @@ void Render2D::DrawText(Font* font, const StringView& text, const Color& color,
                     const float x = pointer.X + entry.OffsetX * scale;
                     const float y = pointer.Y - entry.OffsetY * scale + Math::Ceil((font->GetHeight() + font->GetDescender()) * scale);
 
-                    Rectangle charRect(x, y, entry.UVSize.X * scale, entry.UVSize.Y * scale);
+                    Rectangle charRect(x, y, entry.UVSize.X * entry.Scale * scale, entry.UVSize.Y * entry.Scale * scale);
                     charRect.Offset(layout.Bounds.Location);
 
                     Float2 upperLeftUV = entry.UV * invAtlasSize;
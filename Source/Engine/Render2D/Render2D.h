@@ -3,7 +3,8 @@
 #pragma once
 
 #include "Engine/Core/Math/Color.h"
-#include "Engine/Scripting/ScriptingType.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Scripting/ScriptingObject.h"
 #include "Engine/Core/Types/Span.h"
 #include "Engine/Core/Math/Vector2.h"
 #include "Engine/Core/Math/Matrix.h"
@@ -23,6 +24,35 @@ class RenderTask;
 class MaterialBase;
 class TextureBase;
 
+/// <summary>
+/// Retained sequence of baked 2D draw calls that can be replayed in the following frames without re-tessellating the geometry (see Render2D::BeginCacheRecording). The geometry is baked in the output space (with the transform, clip and tint applied at the record time) so invalidate the cache whenever any of the cached widgets changes (layout, contents or styling).
+/// </summary>
+/// <remarks>Resources referenced by the baked draw calls (textures, fonts, materials) have to stay alive as long as the cache is drawn.</remarks>
+API_CLASS() class FLAXENGINE_API Render2DDrawCache : public ScriptingObject
+{
+    DECLARE_SCRIPTING_TYPE(Render2DDrawCache);
+    friend class Render2D;
+
+private:
+    bool _valid = false;
+    uint32 _verticesCount = 0;
+    uint32 _indicesCount = 0;
+    Array<byte> _vertices;
+    Array<byte> _indices;
+    Array<byte> _drawCalls;
+
+public:
+    /// <summary>
+    /// Checks if the cache holds a baked draw calls sequence that can be drawn (see Render2D::DrawCache).
+    /// </summary>
+    API_PROPERTY() bool IsValid() const;
+
+    /// <summary>
+    /// Discards the baked draw calls sequence. Call whenever any of the cached widgets changes so the sequence gets re-recorded.
+    /// </summary>
+    API_FUNCTION() void Invalidate();
+};
+
 /// <summary>
 /// Rendering 2D shapes and text using Graphics Device.
 /// </summary>
@@ -172,6 +202,25 @@ public:
     /// </summary>
     API_FUNCTION() static void PopTint();
 
+public:
+    /// <summary>
+    /// Begins recording the following draw calls into the cache (until EndCacheRecording). The recorded draws still render normally during this frame; the following frames can replay them via DrawCache without re-tessellating the geometry.
+    /// </summary>
+    /// <param name="cache">The cache to record into.</param>
+    API_FUNCTION() static void BeginCacheRecording(Render2DDrawCache* cache);
+
+    /// <summary>
+    /// Ends recording the draw calls sequence and bakes it into the cache.
+    /// </summary>
+    /// <param name="cache">The cache to record into (the same as passed to BeginCacheRecording).</param>
+    API_FUNCTION() static void EndCacheRecording(Render2DDrawCache* cache);
+
+    /// <summary>
+    /// Submits the baked draw calls sequence. The geometry is appended in bulk (no per-widget tessellation) and gets batched with the surrounding drawing automatically.
+    /// </summary>
+    /// <param name="cache">The cache to draw (has to be valid).</param>
+    API_FUNCTION() static void DrawCache(Render2DDrawCache* cache);
+
 public:
     /// <summary>
     /// Draws a text.
@@ -200,18 +200,21 @@ GPUTexture* DepthOfFieldPass::getDofBokehShape(DepthOfFieldSettings& dofSettings
     return result ? result->GetTexture() : nullptr;
 }
 
+bool DepthOfFieldPass::CanRender(const RenderContext& renderContext) const
+{
+    const DepthOfFieldSettings& dofSettings = renderContext.List->Settings.DepthOfField;
+    return _platformSupportsDoF && EnumHasAnyFlags(renderContext.View.Flags, ViewFlags::DepthOfField) && dofSettings.Enabled;
+}
+
 void DepthOfFieldPass::Render(RenderContext& renderContext, GPUTexture*& frame, GPUTexture*& tmp)
 {
-    if (!_platformSupportsDoF || checkIfSkipPass())
+    if (!renderContext.List->Setup.UseDepthOfField || checkIfSkipPass())
         return;
     auto device = GPUDevice::Instance;
     auto context = device->GetMainContext();
     const auto depthBuffer = renderContext.Buffers->DepthBuffer;
     const auto shader = _shader->GetShader();
     DepthOfFieldSettings& dofSettings = renderContext.List->Settings.DepthOfField;
-    const bool useDoF = _platformSupportsDoF && EnumHasAnyFlags(renderContext.View.Flags, ViewFlags::DepthOfField) && dofSettings.Enabled;
-    if (!useDoF)
-        return;
     PROFILE_GPU_CPU("Depth Of Field");
 
     context->ResetSR();
@@ -38,6 +38,13 @@ public:
     DepthOfFieldPass();
 
 public:
+    /// <summary>
+    /// Determines whether the pass will draw anything for the given frame (used to schedule the pass in the render setup before rendering).
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <returns>True if pass will render, otherwise false.</returns>
+    bool CanRender(const RenderContext& renderContext) const;
+
     /// <summary>
     /// Perform Depth Of Field rendering for the input task
     /// </summary>
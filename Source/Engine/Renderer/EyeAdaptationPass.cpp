@@ -34,6 +34,34 @@ PACK_STRUCT(struct EyeAdaptationData {
     });
 
 void EyeAdaptationPass::Render(RenderContext& renderContext, GPUTexture* colorBuffer)
+{
+    GPUTexture* luminanceMap = RenderLuminance(renderContext, colorBuffer);
+    const auto context = GPUDevice::Instance->GetMainContext();
+    if (luminanceMap)
+    {
+        // Apply the luminance
+        context->BindSR(0, *luminanceMap);
+        context->SetRenderTarget(*colorBuffer);
+        context->SetViewportAndScissors((float)colorBuffer->Width(), (float)colorBuffer->Height());
+        context->SetState(_psApplyLuminance);
+        context->DrawFullscreenTriangle();
+        context->UnBindSR(0);
+    }
+    else
+    {
+        // Apply fixed manual exposure (constant buffer gets updated by RenderLuminance)
+        auto& settings = renderContext.List->Settings.EyeAdaptation;
+        if (settings.Mode == EyeAdaptationMode::Manual && (renderContext.View.Flags & ViewFlags::EyeAdaptation) != ViewFlags::None && !Math::IsZero(settings.PreExposure) && !checkIfSkipPass())
+        {
+            context->SetRenderTarget(*colorBuffer);
+            context->SetViewportAndScissors((float)colorBuffer->Width(), (float)colorBuffer->Height());
+            context->SetState(_psManual);
+            context->DrawFullscreenTriangle();
+        }
+    }
+}
+
+GPUTexture* EyeAdaptationPass::RenderLuminance(RenderContext& renderContext, GPUTexture* colorBuffer)
 {
     // Cache data
     auto device = GPUDevice::Instance;
@@ -49,7 +77,7 @@ void EyeAdaptationPass::Render(RenderContext& renderContext, GPUTexture* colorBu
     // Optionally skip the rendering
     if (checkIfSkipPass() || (view.Flags & ViewFlags::EyeAdaptation) == ViewFlags::None || settings.Mode == EyeAdaptationMode::None)
     {
-        return;
+        return nullptr;
     }
 
     PROFILE_GPU_CPU("Eye Adaptation");
@@ -66,7 +94,7 @@ void EyeAdaptationPass::Render(RenderContext& renderContext, GPUTexture* colorBu
     case EyeAdaptationMode::Manual:
     {
         if (Math::IsZero(settings.PreExposure))
-            return;
+            return nullptr;
         break;
     }
     case EyeAdaptationMode::AutomaticHistogram:
@@ -75,11 +103,13 @@ void EyeAdaptationPass::Render(RenderContext& renderContext, GPUTexture* colorBu
         data.HistogramLowPercent = Math::Clamp(settings.HistogramLowPercent * 0.01f, 0.01f, 0.99f);
         data.HistogramHighPercent = Math::Clamp(settings.HistogramHighPercent * 0.01f, data.HistogramLowPercent, 1.0f);
         HistogramPass::Instance()->GetHistogramMad(data.HistogramMul, data.HistogramAdd);
+        const GPUTexture* lastLuminanceMap = renderContext.Buffers->LuminanceMap;
+        dropHistory |= lastLuminanceMap == nullptr || !EnumHasAnyFlags(lastLuminanceMap->Flags(), GPUTextureFlags::UnorderedAccess);
 
         // Render histogram
         histogramBuffer = HistogramPass::Instance()->Render(renderContext, colorBuffer);
         if (!histogramBuffer)
-            return;
+            return nullptr;
 
         break;
     }
@@ -103,12 +133,8 @@ void EyeAdaptationPass::Render(RenderContext& renderContext, GPUTexture* colorBu
 
     if (mode == EyeAdaptationMode::Manual)
     {
-        // Apply fixed manual exposure
-        context->SetRenderTarget(*colorBuffer);
-        context->SetViewportAndScissors((float)colorBuffer->Width(), (float)colorBuffer->Height());
-        context->SetState(_psManual);
-        context->DrawFullscreenTriangle();
-        return;
+        // Fixed manual exposure has no luminance map - the caller applies the exposure scale from the constant buffer
+        return nullptr;
     }
 
     GPUTexture* previousLuminanceMap = renderContext.Buffers->LuminanceMap;
@@ -117,27 +143,34 @@ void EyeAdaptationPass::Render(RenderContext& renderContext, GPUTexture* colorBu
         RenderTargetPool::Release(previousLuminanceMap);
         previousLuminanceMap = nullptr;
     }
-    GPUTexture* currentLuminanceMap = RenderTargetPool::Get(GPUTextureDescription::New2D(1, 1, PixelFormat::R16_Float));
-    RENDER_TARGET_POOL_SET_NAME(currentLuminanceMap, "EyeAdaptation.LuminanceMap");
+    GPUTexture* currentLuminanceMap = nullptr;
 
     switch (mode)
     {
     case EyeAdaptationMode::AutomaticHistogram:
     {
-        // Blend luminance with the histogram-based luminance
+        // Reuse the persistent luminance state texture (the adaptation state stays GPU-resident across frames)
+        currentLuminanceMap = previousLuminanceMap;
+        previousLuminanceMap = nullptr;
+        if (!currentLuminanceMap)
+        {
+            currentLuminanceMap = RenderTargetPool::Get(GPUTextureDescription::New2D(1, 1, PixelFormat::R32_Float, GPUTextureFlags::ShaderResource | GPUTextureFlags::UnorderedAccess));
+            RENDER_TARGET_POOL_SET_NAME(currentLuminanceMap, "EyeAdaptation.LuminanceMap");
+        }
+
+        // Resolve the histogram and adapt the luminance state in-place with a single compute dispatch (no readbacks nor render target switches)
         context->BindSR(0, histogramBuffer->View());
-        context->BindSR(1, previousLuminanceMap);
-        context->SetRenderTarget(*currentLuminanceMap);
-        context->SetViewportAndScissors(1, 1);
-        context->SetState(_psHistogram);
-        context->DrawFullscreenTriangle();
-        context->UnBindSR(1);
-        context->ResetRenderTarget();
+        context->BindUA(0, currentLuminanceMap->View());
+        context->Dispatch(_csResolveHistogram, 1, 1, 1);
+        context->ResetUA();
+        context->ResetSR();
 
         break;
     }
     case EyeAdaptationMode::AutomaticAverageLuminance:
     {
+        currentLuminanceMap = RenderTargetPool::Get(GPUTextureDescription::New2D(1, 1, PixelFormat::R16_Float));
+        RENDER_TARGET_POOL_SET_NAME(currentLuminanceMap, "EyeAdaptation.LuminanceMap");
         const Int2 luminanceMapSize(colorBuffer->Width() / 2, colorBuffer->Height() / 2);
         GPUTexture* luminanceMap = RenderTargetPool::Get(GPUTextureDescription::New2D(luminanceMapSize.X, luminanceMapSize.Y, 0, PixelFormat::R16_Float, GPUTextureFlags::ShaderResource | GPUTextureFlags::RenderTarget | GPUTextureFlags::PerMipViews));
         RENDER_TARGET_POOL_SET_NAME(luminanceMap, "EyeAdaptation.LuminanceMap");
@@ -198,14 +231,6 @@ void EyeAdaptationPass::Render(RenderContext& renderContext, GPUTexture* colorBu
     default: ;
     }
 
-    // Apply the luminance
-    context->BindSR(0, *currentLuminanceMap);
-    context->SetRenderTarget(*colorBuffer);
-    context->SetViewportAndScissors((float)colorBuffer->Width(), (float)colorBuffer->Height());
-    context->SetState(_psApplyLuminance);
-    context->DrawFullscreenTriangle();
-    context->UnBindSR(0);
-
     // Update the luminance map buffer
     renderContext.Buffers->LastEyeAdaptationTime = time;
     renderContext.Buffers->LastFrameLuminanceMap = Engine::FrameCount;
@@ -214,6 +239,8 @@ void EyeAdaptationPass::Render(RenderContext& renderContext, GPUTexture* colorBu
     // Cleanup
     if (previousLuminanceMap)
         RenderTargetPool::Release(previousLuminanceMap);
+
+    return currentLuminanceMap;
 }
 
 String EyeAdaptationPass::ToString() const
@@ -230,7 +257,6 @@ bool EyeAdaptationPass::Init()
     _psLuminanceMap = GPUDevice::Instance->CreatePipelineState();
     _psBlendLuminance = GPUDevice::Instance->CreatePipelineState();
     _psApplyLuminance = GPUDevice::Instance->CreatePipelineState();
-    _psHistogram = GPUDevice::Instance->CreatePipelineState();
 
     // Load shaders
     _shader = Content::LoadAsyncInternal<Shader>(TEXT("Shaders/EyeAdaptation"));
@@ -253,7 +279,6 @@ void EyeAdaptationPass::Dispose()
     SAFE_DELETE_GPU_RESOURCE(_psLuminanceMap);
     SAFE_DELETE_GPU_RESOURCE(_psBlendLuminance);
     SAFE_DELETE_GPU_RESOURCE(_psApplyLuminance);
-    SAFE_DELETE_GPU_RESOURCE(_psHistogram);
     _shader = nullptr;
 }
 
@@ -285,11 +310,9 @@ bool EyeAdaptationPass::setupResources()
         if (_psBlendLuminance->Init(psDesc))
             return true;
     }
-    if (!_psHistogram->IsValid())
+    if (_canUseHistogram)
     {
-        psDesc.PS = shader->GetPS("PS_Histogram");
-        if (_psHistogram->Init(psDesc))
-            return true;
+        _csResolveHistogram = shader->GetCS("CS_ResolveHistogram");
     }
     psDesc.BlendMode = BlendingMode::Multiply;
     if (!_psManual->IsValid())
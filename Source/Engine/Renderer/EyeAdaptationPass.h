@@ -16,7 +16,7 @@ private:
     GPUPipelineState* _psLuminanceMap = nullptr;
     GPUPipelineState* _psBlendLuminance = nullptr;
     GPUPipelineState* _psApplyLuminance = nullptr;
-    GPUPipelineState* _psHistogram = nullptr;
+    GPUShaderProgramCS* _csResolveHistogram = nullptr;
     bool _canUseHistogram;
 
 public:
@@ -28,6 +28,14 @@ public:
     /// <param name="colorBuffer">The input and output color buffer to apply eye adaptation effect to it.</param>
     void Render(RenderContext& renderContext, GPUTexture* colorBuffer);
 
+    /// <summary>
+    /// Computes the adapted scene luminance without applying it to the color buffer (so the exposure can be applied during the further post-processing).
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <param name="colorBuffer">The input color buffer to compute the luminance for.</param>
+    /// <returns>The 1x1 texture with the adapted scene luminance, or null if the effect is disabled or uses fixed manual exposure.</returns>
+    GPUTexture* RenderLuminance(RenderContext& renderContext, GPUTexture* colorBuffer);
+
 private:
 
 #if COMPILE_WITH_DEV_ENV
@@ -37,7 +45,7 @@ private:
         _psLuminanceMap->ReleaseGPU();
         _psBlendLuminance->ReleaseGPU();
         _psApplyLuminance->ReleaseGPU();
-        _psHistogram->ReleaseGPU();
+        _csResolveHistogram = nullptr;
         invalidateResources();
     }
 #endif
@@ -13,9 +13,16 @@
 #include "Engine/Graphics/RenderTask.h"
 #include "Engine/Graphics/Shaders/GPUShader.h"
 
+PACK_STRUCT(struct Data {
+    Float4 ViewInfo;
+    Float2 HalfResTexelSize;
+    Float2 Dummy0;
+    });
+
 ForwardPass::ForwardPass()
     : _shader(nullptr)
     , _psApplyDistortion(nullptr)
+    , _psCompositeHalfRes(nullptr)
 {
 }
 
@@ -28,6 +35,7 @@ bool ForwardPass::Init()
 {
     // Prepare resources
     _psApplyDistortion = GPUDevice::Instance->CreatePipelineState();
+    _psCompositeHalfRes = GPUDevice::Instance->CreatePipelineState();
     _shader = Content::LoadAsyncInternal<Shader>(TEXT("Shaders/Forward"));
     if (_shader == nullptr)
     {
@@ -49,6 +57,13 @@ bool ForwardPass::setupResources()
     }
     const auto shader = _shader->GetShader();
 
+    // Validate shader constant buffer size
+    if (shader->GetCB(0)->GetSize() != sizeof(Data))
+    {
+        REPORT_INVALID_SHADER_PASS_CB_SIZE(shader, 0, Data);
+        return true;
+    }
+
     // Create pipeline stages
     GPUPipelineState::Description psDesc;
     if (!_psApplyDistortion->IsValid())
@@ -58,6 +73,16 @@ bool ForwardPass::setupResources()
         if (_psApplyDistortion->Init(psDesc))
             return true;
     }
+    if (!_psCompositeHalfRes->IsValid())
+    {
+        psDesc = GPUPipelineState::Description::DefaultFullscreenTriangle;
+        psDesc.PS = shader->GetPS("PS_CompositeHalfRes");
+        // Half-res buffer holds coverage-premultiplied color so blend with One/InvSrcAlpha
+        psDesc.BlendMode = BlendingMode::AlphaBlend;
+        psDesc.BlendMode.SrcBlend = BlendingMode::Blend::One;
+        if (_psCompositeHalfRes->Init(psDesc))
+            return true;
+    }
 
     return false;
 }
@@ -69,6 +94,7 @@ void ForwardPass::Dispose()
 
     // Cleanup
     SAFE_DELETE_GPU_RESOURCE(_psApplyDistortion);
+    SAFE_DELETE_GPU_RESOURCE(_psCompositeHalfRes);
     _shader = nullptr;
 }
 
@@ -140,4 +166,57 @@ void ForwardPass::Render(RenderContext& renderContext, GPUTexture* input, GPUTex
         context->SetRenderTarget(depthBufferHandle, output->View());
         mainCache->ExecuteDrawCalls(renderContext, forwardList, input->View());
     }
+
+    auto& forwardHalfResList = mainCache->DrawCallsLists[(int32)DrawCallsListType::ForwardHalfRes];
+    if (!forwardHalfResList.IsEmpty())
+    {
+        view.Pass = DrawPass::Forward;
+        if (checkIfSkipPass())
+        {
+            // Fallback to the full-resolution rendering if the compositing shader is not ready
+            context->SetRenderTarget(depthBufferHandle, output->View());
+            mainCache->ExecuteDrawCalls(renderContext, forwardHalfResList, input->View());
+        }
+        else
+        {
+            PROFILE_GPU_CPU("Half-Res Transparency");
+            const int32 width = renderContext.Buffers->GetWidth();
+            const int32 height = renderContext.Buffers->GetHeight();
+
+            // Downscale the depth buffer for depth-testing and peek a temporary half-res color target
+            context->ResetRenderTarget();
+            GPUTexture* halfResDepth = renderContext.Buffers->RequestHalfResDepth(context);
+            const int32 halfWidth = halfResDepth->Width();
+            const int32 halfHeight = halfResDepth->Height();
+            const auto tempDesc = GPUTextureDescription::New2D(halfWidth, halfHeight, PixelFormat::R16G16B16A16_Float);
+            auto halfResColor = RenderTargetPool::Get(tempDesc);
+            RENDER_TARGET_POOL_SET_NAME(halfResColor, "Forward.HalfResColor");
+
+            // Render transparency at half-res (alpha channel accumulates the coverage on the cleared target)
+            context->Clear(halfResColor->View(), Color::Transparent);
+            context->SetViewportAndScissors((float)halfWidth, (float)halfHeight);
+            context->SetRenderTarget(halfResDepth->View(), halfResColor->View());
+            mainCache->ExecuteDrawCalls(renderContext, forwardHalfResList, input->View());
+
+            // Composite onto the output with a depth-aware bilateral upsample
+            Data data;
+            data.ViewInfo = view.ViewInfo;
+            data.HalfResTexelSize = Float2(1.0f / (float)halfWidth, 1.0f / (float)halfHeight);
+            const auto cb0 = _shader->GetShader()->GetCB(0);
+            context->UpdateCB(cb0, &data);
+            context->BindCB(0, cb0);
+            context->ResetRenderTarget();
+            context->ResetSR();
+            context->SetViewportAndScissors((float)width, (float)height);
+            context->BindSR(0, halfResColor);
+            context->BindSR(1, halfResDepth);
+            context->BindSR(2, depthBuffer);
+            context->SetRenderTarget(output->View());
+            context->SetState(_psCompositeHalfRes);
+            context->DrawFullscreenTriangle();
+            context->ResetSR();
+
+            RenderTargetPool::Release(halfResColor);
+        }
+    }
 }
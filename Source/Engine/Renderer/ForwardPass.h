@@ -15,6 +15,7 @@ private:
 
     AssetReference<Shader> _shader;
     GPUPipelineState* _psApplyDistortion;
+    GPUPipelineState* _psCompositeHalfRes;
 
 public:
 
@@ -39,6 +40,7 @@ private:
     void OnShaderReloading(Asset* obj)
     {
         _psApplyDistortion->ReleaseGPU();
+        _psCompositeHalfRes->ReleaseGPU();
         invalidateResources();
     }
 #endif
@@ -84,6 +84,8 @@ public:
 
     int32 CascadesCount = 0;
     int32 ProbeRaysCount = 0;
+    Float3 LastViewPos = Float3::Zero;
+    uint64 CascadesLastUpdateFrame[4] = {};
     int32 ProbesCountTotal = 0;
     Int3 ProbeCounts = Int3::Zero;
     GPUTexture* ProbesTrace = nullptr; // Probes ray tracing: (RGB: hit radiance, A: hit distance)
@@ -399,14 +401,33 @@ bool DynamicDiffuseGlobalIlluminationPass::RenderInner(RenderContext& renderCont
     }
     ddgiData.LastFrameUsed = Engine::FrameCount;
 
-    // Calculate which cascades should be updated this frame
-    const uint64 cascadeFrequencies[] = { 2, 3, 5, 7 };
-    //const uint64 cascadeFrequencies[] = { 1, 2, 3, 5 };
-    //const uint64 cascadeFrequencies[] = { 1, 1, 1, 1 };
+    // Calculate which cascades should be updated this frame (importance-driven scheduling)
+    // The closest cascade updates the most frequently, further cascades throttle down (up to 1/8 rate when the view is stable) and postpone when over the rays budget
+    const uint64 currentFrame = Engine::FrameCount;
+    const float viewMovement = Float3::Distance(ddgiData.LastViewPos, renderContext.View.Position) / probesSpacing;
+    ddgiData.LastViewPos = renderContext.View.Position;
+    const int32 raysBudget = graphicsSettings->GIProbeRaysBudget * 1000;
+    int32 raysLeft = raysBudget > 0 ? raysBudget : MAX_int32;
     bool cascadeSkipUpdate[4];
     for (int32 cascadeIndex = 0; cascadeIndex < cascadesCount; cascadeIndex++)
     {
-        cascadeSkipUpdate[cascadeIndex] = !clear && (ddgiData.LastFrameUsed % cascadeFrequencies[cascadeIndex]) != 0;
+        // Base update interval doubles with each cascade; static view lets the cascade age out further
+        uint64 interval = (uint64)1 << cascadeIndex;
+        if (viewMovement <= ZeroTolerance)
+            interval = Math::Min<uint64>(interval * 2, 8);
+        bool update = clear || currentFrame - ddgiData.CascadesLastUpdateFrame[cascadeIndex] >= interval;
+
+        // Postpone the update if the cascade doesn't fit into the remaining rays budget for this frame (except the closest cascade which has the highest importance)
+        const int32 cascadeRays = probesCountCascade * probeRaysCount;
+        if (update && !clear && cascadeIndex != 0 && cascadeRays > raysLeft)
+            update = false;
+
+        if (update)
+        {
+            raysLeft -= cascadeRays;
+            ddgiData.CascadesLastUpdateFrame[cascadeIndex] = currentFrame;
+        }
+        cascadeSkipUpdate[cascadeIndex] = !update;
     }
 
     // Compute scrolling (probes are placed around camera but are scrolling to increase stability during movement)
@@ -628,7 +649,7 @@ bool DynamicDiffuseGlobalIlluminationPass::Render(RenderContext& renderContext,
     {
         // During offline pass (eg. probes rendering) we can try reuse main game viewport or editor viewport DDGI probes
         // TODO: apply it for transparency too (in DynamicDiffuseGlobalIlluminationPass::Get)
-        for (auto* task : RenderTask::Tasks)
+        for (auto* task : RenderTask::DrawTasks)
         {
             if (auto* sceneTask = ScriptingObject::Cast<SceneRenderTask>(task))
             {
@@ -21,7 +21,6 @@
 #include "Engine/Level/Actors/StaticModel.h"
 #include "Engine/Level/Scene/SceneRendering.h"
 #include "Engine/Renderer/ColorGradingPass.h"
-#include "Engine/Renderer/EyeAdaptationPass.h"
 #include "Engine/Renderer/PostProcessingPass.h"
 #include "Engine/Utilities/RectPack.h"
 
@@ -1149,7 +1148,6 @@ void GlobalSurfaceAtlasPass::RenderDebug(RenderContext& renderContext, GPUContex
         // Color Grading and Post-Processing to improve readability in bright/dark scenes
         context->ResetRenderTarget();
         auto colorGradingLUT = ColorGradingPass::Instance()->RenderLUT(renderContext);
-        EyeAdaptationPass::Instance()->Render(renderContext, tempBuffer);
         PostProcessingPass::Instance()->Render(renderContext, tempBuffer, output, colorGradingLUT);
         RenderTargetPool::Release(colorGradingLUT);
         RenderTargetPool::Release(tempBuffer);
@@ -0,0 +1,171 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "GPUCullingPass.h"
+#include "RenderList.h"
+#include "Engine/Content/Assets/Shader.h"
+#include "Engine/Content/Content.h"
+#include "Engine/Engine/Engine.h"
+#include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/GPULimits.h"
+#include "Engine/Graphics/RenderBuffers.h"
+#include "Engine/Graphics/RenderTargetPool.h"
+#include "Engine/Graphics/RenderTask.h"
+#include "Engine/Graphics/Shaders/GPUShader.h"
+
+// Those defines must match the HLSL
+#define THREADGROUP_SIZE 64
+
+PACK_STRUCT(struct InstanceCullingData {
+    Float4 FrustumPlanes[6];
+    Matrix PrevViewProjection;
+    Float2 HiZSize;
+    uint32 InstanceCount;
+    uint32 HiZMipCount;
+    });
+
+GPUTexture* GPUCullingPass::tryBuildHiZ(GPUContext* context, RenderContext& renderContext)
+{
+    // At culling time the depth buffer still contains the previous frame's depth (skip on the first frames when it's empty)
+    auto buffers = renderContext.Buffers;
+    if (!buffers || !buffers->DepthBuffer || !buffers->DepthBuffer->IsAllocated() || renderContext.Task->FrameCount <= 1)
+        return nullptr;
+    const uint64 currentFrame = Engine::FrameCount;
+    if (buffers->LastFrameHiZDepth == currentFrame)
+        return buffers->HiZDepth;
+
+    // Allocate the pyramid (half-res with a full mip chain)
+    const int32 hiZWidth = Math::Max(buffers->GetWidth() / 2, 1);
+    const int32 hiZHeight = Math::Max(buffers->GetHeight() / 2, 1);
+    if (buffers->HiZDepth == nullptr || buffers->HiZDepth->Width() != hiZWidth || buffers->HiZDepth->Height() != hiZHeight)
+    {
+        RenderTargetPool::Release(buffers->HiZDepth);
+        auto tempDesc = GPUTextureDescription::New2D(hiZWidth, hiZHeight, 0, PixelFormat::R32_Float, GPUTextureFlags::ShaderResource | GPUTextureFlags::UnorderedAccess | GPUTextureFlags::PerMipViews);
+        buffers->HiZDepth = RenderTargetPool::Get(tempDesc);
+        RENDER_TARGET_POOL_SET_NAME(buffers->HiZDepth, "HiZDepth");
+    }
+    buffers->LastFrameHiZDepth = currentFrame;
+
+    // Build the pyramid mips via max-downsampling (first mip reads the depth buffer)
+    PROFILE_GPU_CPU("Hi-Z Build");
+    auto hiZ = buffers->HiZDepth;
+    int32 mipWidth = hiZWidth, mipHeight = hiZHeight;
+    for (int32 mip = 0; mip < hiZ->MipLevels(); mip++)
+    {
+        context->BindSR(2, mip == 0 ? buffers->DepthBuffer->View() : hiZ->View(0, mip - 1));
+        context->BindUA(2, hiZ->View(0, mip));
+        context->Dispatch(_csBuildHiZ, (mipWidth + 7) / 8, (mipHeight + 7) / 8, 1);
+        mipWidth = Math::Max(mipWidth / 2, 1);
+        mipHeight = Math::Max(mipHeight / 2, 1);
+    }
+    context->ResetUA();
+    context->ResetSR();
+
+    return hiZ;
+}
+
+GPUTexture* GPUCullingPass::GetHiZ(GPUContext* context, RenderContext& renderContext)
+{
+    if (checkIfSkipPass() || !_isSupported)
+        return nullptr;
+    return tryBuildHiZ(context, renderContext);
+}
+
+bool GPUCullingPass::Render(GPUContext* context, RenderContext& renderContext, GPUBuffer* instanceBounds, int32 instanceCount, GPUBuffer* visibleInstances, GPUBuffer* indirectArgs)
+{
+    if (checkIfSkipPass() || !_isSupported || instanceCount <= 0)
+        return true;
+
+    PROFILE_GPU_CPU("Instance Culling");
+
+    // Build the Hi-Z pyramid from the previous frame's depth for the occlusion tests
+    GPUTexture* hiZ = tryBuildHiZ(context, renderContext);
+
+    // Setup constants with the view frustum planes
+    InstanceCullingData data;
+    for (int32 i = 0; i < 6; i++)
+    {
+        const Plane plane = renderContext.View.CullingFrustum.GetPlane(i);
+        data.FrustumPlanes[i] = Float4((Float3)plane.Normal, (float)plane.D);
+    }
+    Matrix::Transpose(renderContext.View.PrevViewProjection, data.PrevViewProjection);
+    data.HiZSize = hiZ ? Float2((float)hiZ->Width(), (float)hiZ->Height()) : Float2::One;
+    data.InstanceCount = (uint32)instanceCount;
+    data.HiZMipCount = hiZ ? (uint32)hiZ->MipLevels() : 1;
+
+    // Update constants
+    const auto shader = _shader->GetShader();
+    const auto cb0 = shader->GetCB(0);
+    context->UpdateCB(cb0, &data);
+    context->BindCB(0, cb0);
+
+    // Reset the visible instances counter in the indirect args
+    context->BindUA(1, indirectArgs->View());
+    context->Dispatch(_csResetArgs, 1, 1, 1);
+
+    // Cull instances and compact the visible indices
+    context->BindSR(0, instanceBounds->View());
+    context->BindUA(0, visibleInstances->View());
+    if (hiZ)
+        context->BindSR(1, hiZ->View());
+    context->Dispatch(hiZ ? _csCullInstancesHiZ : _csCullInstances, (instanceCount + THREADGROUP_SIZE - 1) / THREADGROUP_SIZE, 1, 1);
+
+    // Cleanup
+    context->ResetUA();
+    context->ResetSR();
+
+    return false;
+}
+
+String GPUCullingPass::ToString() const
+{
+    return TEXT("GPUCullingPass");
+}
+
+bool GPUCullingPass::Init()
+{
+    _isSupported = GPUDevice::Instance->Limits.HasCompute;
+    if (!_isSupported)
+        return false;
+
+    // Load shaders
+    _shader = Content::LoadAsyncInternal<Shader>(TEXT("Shaders/InstanceCulling"));
+    if (_shader == nullptr)
+        return true;
+#if COMPILE_WITH_DEV_ENV
+    _shader.Get()->OnReloading.Bind<GPUCullingPass, &GPUCullingPass::OnShaderReloading>(this);
+#endif
+
+    return false;
+}
+
+void GPUCullingPass::Dispose()
+{
+    // Base
+    RendererPass::Dispose();
+
+    // Cleanup
+    _shader = nullptr;
+}
+
+bool GPUCullingPass::setupResources()
+{
+    // Wait for shader
+    if (!_shader->IsLoaded())
+        return true;
+    const auto shader = _shader->GetShader();
+
+    // Validate shader constant buffer size
+    if (shader->GetCB(0)->GetSize() != sizeof(InstanceCullingData))
+    {
+        REPORT_INVALID_SHADER_PASS_CB_SIZE(shader, 0, InstanceCullingData);
+        return true;
+    }
+
+    _csResetArgs = shader->GetCS("CS_ResetArgs");
+    _csCullInstances = shader->GetCS("CS_CullInstances", 0);
+    _csCullInstancesHiZ = shader->GetCS("CS_CullInstances", 1);
+    _csBuildHiZ = shader->GetCS("CS_BuildHiZ");
+
+    return false;
+}
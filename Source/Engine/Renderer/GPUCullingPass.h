@@ -0,0 +1,77 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "RendererPass.h"
+
+/// <summary>
+/// GPU-driven frustum and occlusion culling pass for instanced geometry. Uses a compute shader to cull instance
+/// bounding spheres against the view frustum and a hierarchical depth pyramid built from the previous frame's depth
+/// (with one-frame reprojection), producing a compacted visible-instance index buffer and patching the instance count
+/// of an indirect draw arguments buffer, so large static instance sets (foliage, scattered props) can be drawn
+/// via DrawIndexedInstancedIndirect without any per-instance CPU work.
+/// </summary>
+class GPUCullingPass : public RendererPass<GPUCullingPass>
+{
+private:
+    AssetReference<Shader> _shader;
+    GPUShaderProgramCS* _csResetArgs = nullptr;
+    GPUShaderProgramCS* _csCullInstances = nullptr;
+    GPUShaderProgramCS* _csCullInstancesHiZ = nullptr;
+    GPUShaderProgramCS* _csBuildHiZ = nullptr;
+    bool _isSupported = false;
+
+public:
+    /// <summary>
+    /// Returns true if GPU culling is supported on the current graphics device.
+    /// </summary>
+    FORCE_INLINE bool IsSupported() const
+    {
+        return _isSupported;
+    }
+
+    /// <summary>
+    /// Performs the GPU frustum and Hi-Z occlusion culling of the instance bounds. The occlusion test uses the depth
+    /// pyramid built from the previous frame's depth buffer (reprojected) and is skipped if it's not available.
+    /// </summary>
+    /// <param name="context">The GPU commands context.</param>
+    /// <param name="renderContext">The rendering context (view frustum source).</param>
+    /// <param name="instanceBounds">The buffer with instance bounding spheres (float4 per instance: xyz=center, w=radius).</param>
+    /// <param name="instanceCount">The amount of the instances to cull.</param>
+    /// <param name="visibleInstances">The output buffer for the compacted visible instance indices (uint per instance, capacity at least instanceCount).</param>
+    /// <param name="indirectArgs">The indirect draw arguments buffer (GPUDrawIndexedIndirectArgs) whose InstanceCount gets overwritten with the visible count.</param>
+    /// <returns>True if failed or not supported, otherwise false.</returns>
+    bool Render(GPUContext* context, RenderContext& renderContext, GPUBuffer* instanceBounds, int32 instanceCount, GPUBuffer* visibleInstances, GPUBuffer* indirectArgs);
+
+    /// <summary>
+    /// Gets the hierarchical depth pyramid for the current frame, building it from the depth buffer if it was not built yet (eg. by the occlusion culling). Can be used by other passes for screen-space depth ray-marching at reduced bandwidth.
+    /// </summary>
+    /// <param name="context">The GPU commands context.</param>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <returns>The depth pyramid texture (half-res with a full mip chain), or null if not available.</returns>
+    GPUTexture* GetHiZ(GPUContext* context, RenderContext& renderContext);
+
+private:
+    GPUTexture* tryBuildHiZ(GPUContext* context, RenderContext& renderContext);
+
+#if COMPILE_WITH_DEV_ENV
+    void OnShaderReloading(Asset* obj)
+    {
+        _csResetArgs = nullptr;
+        _csCullInstances = nullptr;
+        _csCullInstancesHiZ = nullptr;
+        _csBuildHiZ = nullptr;
+        invalidateResources();
+    }
+#endif
+
+public:
+    // [RendererPass]
+    String ToString() const override;
+    bool Init() override;
+    void Dispose() override;
+
+protected:
+    // [RendererPass]
+    bool setupResources() override;
+};
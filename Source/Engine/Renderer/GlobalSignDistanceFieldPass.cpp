@@ -136,12 +136,11 @@ struct CascadeData
     BoundingBox Bounds;
     HashSet<RasterizeChunkKey> NonEmptyChunks;
     HashSet<RasterizeChunkKey> StaticChunks;
+    HashSet<RasterizeChunkKey> DirtyChunks;
+    HashSet<RasterizeChunkKey> DynamicChunks;
 
-    FORCE_INLINE void OnSceneRenderingDirty(const BoundingBox& objectBounds)
+    FORCE_INLINE void GetObjectChunkRange(const BoundingBox& objectBounds, Int3& objectChunkMin, Int3& objectChunkMax) const
     {
-        if (StaticChunks.IsEmpty() || !Bounds.Intersects(objectBounds))
-            return;
-
         BoundingBox objectBoundsCascade;
         const float objectMargin = VoxelSize * GLOBAL_SDF_RASTERIZE_CHUNK_MARGIN;
         Vector3::Clamp(objectBounds.Minimum - objectMargin, Bounds.Minimum, Bounds.Maximum, objectBoundsCascade.Minimum);
@@ -149,8 +148,16 @@ struct CascadeData
         Vector3::Clamp(objectBounds.Maximum + objectMargin, Bounds.Minimum, Bounds.Maximum, objectBoundsCascade.Maximum);
         Vector3::Subtract(objectBoundsCascade.Maximum, Bounds.Minimum, objectBoundsCascade.Maximum);
         const float chunkSize = VoxelSize * GLOBAL_SDF_RASTERIZE_CHUNK_SIZE;
-        const Int3 objectChunkMin(objectBoundsCascade.Minimum / chunkSize);
-        const Int3 objectChunkMax(objectBoundsCascade.Maximum / chunkSize);
+        objectChunkMin = Int3(objectBoundsCascade.Minimum / chunkSize);
+        objectChunkMax = Int3(objectBoundsCascade.Maximum / chunkSize);
+    }
+
+    FORCE_INLINE void OnSceneRenderingDirty(const BoundingBox& objectBounds)
+    {
+        if (StaticChunks.IsEmpty() || !Bounds.Intersects(objectBounds))
+            return;
+        Int3 objectChunkMin, objectChunkMax;
+        GetObjectChunkRange(objectBounds, objectChunkMin, objectChunkMax);
 
         // Invalidate static chunks intersecting with dirty bounds
         RasterizeChunkKey key;
@@ -163,10 +170,33 @@ struct CascadeData
                 {
                     key.Hash = key.Coord.Z * (RasterizeChunkKeyHashResolution * RasterizeChunkKeyHashResolution) + key.Coord.Y * RasterizeChunkKeyHashResolution + key.Coord.X;
                     StaticChunks.Remove(key);
+                    DirtyChunks.Add(key);
                 }
             }
         }
     }
+
+    // Checks if the given object bounds intersect any chunk that needs to be re-rasterized during the next cascade update
+    bool IntersectsDirtyChunk(const BoundingBox& objectBounds) const
+    {
+        Int3 objectChunkMin, objectChunkMax;
+        GetObjectChunkRange(objectBounds, objectChunkMin, objectChunkMax);
+        RasterizeChunkKey key;
+        key.Layer = 0;
+        for (key.Coord.Z = objectChunkMin.Z; key.Coord.Z <= objectChunkMax.Z; key.Coord.Z++)
+        {
+            for (key.Coord.Y = objectChunkMin.Y; key.Coord.Y <= objectChunkMax.Y; key.Coord.Y++)
+            {
+                for (key.Coord.X = objectChunkMin.X; key.Coord.X <= objectChunkMax.X; key.Coord.X++)
+                {
+                    key.Hash = key.Coord.Z * (RasterizeChunkKeyHashResolution * RasterizeChunkKeyHashResolution) + key.Coord.Y * RasterizeChunkKeyHashResolution + key.Coord.X;
+                    if (DirtyChunks.Contains(key) || DynamicChunks.Contains(key))
+                        return true;
+                }
+            }
+        }
+        return false;
+    }
 };
 
 class GlobalSignDistanceFieldCustomBuffer : public RenderBuffers::CustomBuffer, public ISceneRenderingListener
@@ -225,7 +255,8 @@ public:
     // [ISceneRenderingListener]
     void OnSceneRenderingAddActor(Actor* a) override
     {
-        if (GLOBAL_SDF_ACTOR_IS_STATIC(a) && ObjectTypes.Contains(a->GetTypeHandle()))
+        // Dynamic actors dirty chunks too so partial cascade updates re-rasterize the regions they enter or leave
+        if (ObjectTypes.Contains(a->GetTypeHandle()))
         {
             OnSceneRenderingDirty(a->GetBox());
         }
@@ -233,7 +264,7 @@ public:
 
     void OnSceneRenderingUpdateActor(Actor* a, const BoundingSphere& prevBounds) override
     {
-        if (GLOBAL_SDF_ACTOR_IS_STATIC(a) && ObjectTypes.Contains(a->GetTypeHandle()))
+        if (ObjectTypes.Contains(a->GetTypeHandle()))
         {
             OnSceneRenderingDirty(BoundingBox::FromSphere(prevBounds));
             OnSceneRenderingDirty(a->GetBox());
@@ -242,7 +273,7 @@ public:
 
     void OnSceneRenderingRemoveActor(Actor* a) override
     {
-        if (GLOBAL_SDF_ACTOR_IS_STATIC(a) && ObjectTypes.Contains(a->GetTypeHandle()))
+        if (ObjectTypes.Contains(a->GetTypeHandle()))
         {
             OnSceneRenderingDirty(a->GetBox());
         }
@@ -471,6 +502,8 @@ bool GlobalSignDistanceFieldPass::Render(RenderContext& renderContext, GPUContex
         {
             cascade.NonEmptyChunks.Clear();
             cascade.StaticChunks.Clear();
+            cascade.DirtyChunks.Clear();
+            cascade.DynamicChunks.Clear();
         }
         context->ClearUA(sdfData.Texture, Float4::One);
         context->ClearUA(sdfData.TextureMip, Float4::One);
@@ -539,6 +572,9 @@ bool GlobalSignDistanceFieldPass::Render(RenderContext& renderContext, GPUContex
         cascade.VoxelSize = cascadeVoxelSize;
         cascade.Bounds = cascadeBounds;
 
+        // When the static chunks cache is valid, limit the update to the chunks dirtied since the last update (plus the chunks with dynamic objects)
+        const bool useDirtyChunks = useCache && cascade.StaticChunks.Count() != 0;
+
         // Draw all objects from all scenes into the cascade
         _objectsBufferCount = 0;
         _voxelSize = cascadeVoxelSize;
@@ -566,6 +602,9 @@ bool GlobalSignDistanceFieldPass::Render(RenderContext& renderContext, GPUContex
                     {
                         if (e.Bounds.Radius >= minObjectRadius && viewMask & e.LayerMask && CollisionsHelper::BoxIntersectsSphere(cascadeBoundsWorld, e.Bounds))
                         {
+                            // Skip static actors that don't touch any dirty chunk (cached chunks will be reused)
+                            if (useDirtyChunks && GLOBAL_SDF_ACTOR_IS_STATIC(e.Actor) && !cascade.IntersectsDirtyChunk(BoundingBox::FromSphere(e.Bounds)))
+                                continue;
                             //PROFILE_CPU_ACTOR(e.Actor);
                             e.Actor->Draw(renderContext);
                             actorsDrawn++;
@@ -599,6 +638,8 @@ bool GlobalSignDistanceFieldPass::Render(RenderContext& renderContext, GPUContex
                 auto& key = it->Item;
                 if (chunks.ContainsKey(key))
                     continue;
+                if (useDirtyChunks && !cascade.DirtyChunks.Contains(key) && !cascade.DynamicChunks.Contains(key))
+                    continue; // Objects from this chunk were not drawn during the partial update so it cannot be assumed to be empty
 
                 // Clear empty chunk
                 cascade.NonEmptyChunks.Remove(it);
@@ -613,6 +654,7 @@ bool GlobalSignDistanceFieldPass::Render(RenderContext& renderContext, GPUContex
             PROFILE_GPU_CPU_NAMED("Rasterize Chunks");
 
             // Update static chunks
+            cascade.DynamicChunks.Clear();
             for (auto it = chunks.Begin(); it.IsNotEnd(); ++it)
             {
                 auto& e = *it;
@@ -622,6 +664,7 @@ bool GlobalSignDistanceFieldPass::Render(RenderContext& renderContext, GPUContex
                 {
                     // Remove static chunk with dynamic objects
                     cascade.StaticChunks.Remove(e.Key);
+                    cascade.DynamicChunks.Add(e.Key);
                 }
                 else if (cascade.StaticChunks.Contains(e.Key))
                 {
@@ -636,6 +679,7 @@ bool GlobalSignDistanceFieldPass::Render(RenderContext& renderContext, GPUContex
                     cascade.StaticChunks.Add(e.Key);
                 }
             }
+            cascade.DirtyChunks.Clear();
 
             // Send models data to the GPU
             const auto& objectIndexToDataIndex = ObjectIndexToDataIndexCache;
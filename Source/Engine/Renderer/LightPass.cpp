@@ -11,6 +11,12 @@
 #include "Engine/Content/Content.h"
 #include "Engine/Graphics/GPUContext.h"
 #include "Engine/Graphics/RenderTask.h"
+#include "Engine/Graphics/DynamicBuffer.h"
+
+// Tiled point lights rendering (must match Lights.shader)
+#define TILED_LIGHTS_TILE_SIZE 16
+#define TILED_LIGHTS_MAX_PER_TILE 63
+#define TILED_LIGHTS_MIN_COUNT 16
 
 PACK_STRUCT(struct PerLight{
     LightData Light;
@@ -21,6 +27,12 @@ PACK_STRUCT(struct PerFrame{
     GBufferData GBuffer;
     });
 
+PACK_STRUCT(struct TiledData{
+    uint32 LightsCount;
+    uint32 TilesX;
+    Float2 Dummy0;
+    });
+
 String LightPass::ToString() const
 {
     return TEXT("LightPass");
@@ -77,6 +89,11 @@ bool LightPass::setupResources()
         REPORT_INVALID_SHADER_PASS_CB_SIZE(shader, 1, PerFrame);
         return true;
     }
+    if (shader->GetCB(2)->GetSize() != sizeof(TiledData))
+    {
+        REPORT_INVALID_SHADER_PASS_CB_SIZE(shader, 2, TiledData);
+        return true;
+    }
 
     // Create pipeline stages
     GPUPipelineState::Description psDesc;
@@ -130,6 +147,18 @@ bool LightPass::setupResources()
         if (_psLightSkyInverted->Init(psDesc))
             return true;
     }
+    if (GPUDevice::Instance->Limits.HasCompute)
+    {
+        _csCullLights = shader->GetCS("CS_CullLights");
+        if (!_psLightTiled.IsValid())
+        {
+            psDesc = GPUPipelineState::Description::DefaultFullscreenTriangle;
+            psDesc.BlendMode = BlendingMode::Add;
+            psDesc.BlendMode.RenderTargetWriteMask = BlendingMode::ColorWrite::RGB;
+            if (_psLightTiled.Create(psDesc, shader, "PS_TiledPointLights"))
+                return true;
+        }
+    }
 
     return false;
 }
@@ -145,9 +174,12 @@ void LightPass::Dispose()
     _psLightPointInverted.Delete();
     _psLightSpotNormal.Delete();
     _psLightSpotInverted.Delete();
+    _psLightTiled.Delete();
     SAFE_DELETE_GPU_RESOURCE(_psLightSkyNormal);
     SAFE_DELETE_GPU_RESOURCE(_psLightSkyInverted);
     SAFE_DELETE_GPU_RESOURCE(_psClearDiffuse);
+    SAFE_DELETE_GPU_RESOURCE(_tiledListsBuffer);
+    SAFE_DELETE(_tiledLightsBuffer);
     _sphereModel = nullptr;
 }
 
@@ -238,6 +270,76 @@ void LightPass::RenderLight(RenderContextBatch& renderContextBatch, GPUTextureVi
     } \
     auto shadowMaskView = shadowMask->View()
 
+    // Check if render the unshadowed point lights via tiled binning (a single fullscreen pass reduces the overdraw of many overlapping light volumes)
+    bool useTiledPointLights = false;
+    if (_csCullLights)
+    {
+        int32 tiledLightsCount = 0;
+        for (const auto& light : mainCache->PointLights)
+        {
+            if (!(useShadows && light.ShadowDataIndex != -1) && light.IESTexture == nullptr)
+                tiledLightsCount++;
+        }
+        if (tiledLightsCount >= TILED_LIGHTS_MIN_COUNT)
+        {
+            PROFILE_GPU_CPU_NAMED("Tiled Point Lights");
+
+            // Allocate buffer for the per-tile light lists
+            const int32 tilesX = Math::DivideAndRoundUp(renderContext.Buffers->GetWidth(), TILED_LIGHTS_TILE_SIZE);
+            const int32 tilesY = Math::DivideAndRoundUp(renderContext.Buffers->GetHeight(), TILED_LIGHTS_TILE_SIZE);
+            const int32 tiledListsCapacity = tilesX * tilesY * (TILED_LIGHTS_MAX_PER_TILE + 1);
+            if (!_tiledListsBuffer)
+                _tiledListsBuffer = GPUDevice::Instance->CreateBuffer(TEXT("TiledLightsLists"));
+            if ((int32)(_tiledListsBuffer->GetSize() / sizeof(uint32)) != tiledListsCapacity && _tiledListsBuffer->Init(GPUBufferDescription::Typed(tiledListsCapacity, PixelFormat::R32_UInt, true)))
+            {
+                LOG(Warning, "Failed to create buffer for the tiled lights lists.");
+            }
+            else
+            {
+                useTiledPointLights = true;
+
+                // Upload data of the lights to bin
+                if (!_tiledLightsBuffer)
+                    _tiledLightsBuffer = New<DynamicStructuredBuffer>(TILED_LIGHTS_MIN_COUNT * (uint32)sizeof(LightData), (uint32)sizeof(LightData), false, TEXT("TiledLights"));
+                _tiledLightsBuffer->Clear();
+                for (auto& light : mainCache->PointLights)
+                {
+                    if (!(useShadows && light.ShadowDataIndex != -1) && light.IESTexture == nullptr)
+                    {
+                        LightData lightData;
+                        light.SetupLightData(&lightData, false);
+                        _tiledLightsBuffer->Write(lightData);
+                    }
+                }
+                _tiledLightsBuffer->Flush(context);
+
+                // Set tiled data
+                TiledData tiledData;
+                tiledData.LightsCount = (uint32)tiledLightsCount;
+                tiledData.TilesX = (uint32)tilesX;
+                auto cb2 = lightShader->GetCB(2);
+                context->UpdateCB(cb2, &tiledData);
+                context->BindCB(2, cb2);
+
+                // Cull the lights into the per-tile lists
+                context->ResetRenderTarget();
+                context->BindSR(8, _tiledLightsBuffer->GetBuffer()->View());
+                context->BindUA(0, _tiledListsBuffer->View());
+                context->Dispatch(_csCullLights, tilesX, tilesY, 1);
+                context->ResetUA();
+
+                // Shade the binned lights in a single fullscreen pass
+                context->SetRenderTarget(depthBufferRTV, lightBuffer);
+                context->BindSR(9, _tiledListsBuffer->View());
+                context->BindCB(1, cb1);
+                context->SetState(_psLightTiled.Get(disableSpecular ? 1 : 0));
+                context->DrawFullscreenTriangle();
+                context->UnBindSR(8);
+                context->UnBindSR(9);
+            }
+        }
+    }
+
     // Render all point lights
     for (int32 lightIndex = 0; lightIndex < mainCache->PointLights.Count(); lightIndex++)
     {
@@ -250,6 +352,10 @@ void LightPass::RenderLight(RenderContextBatch& renderContextBatch, GPUTextureVi
         const bool renderShadow = useShadows && light.ShadowDataIndex != -1;
         bool useIES = light.IESTexture != nullptr;
 
+        // Skip the lights already drawn by the tiled pass
+        if (useTiledPointLights && !renderShadow && !useIES)
+            continue;
+
         // Get distance from view center to light center less radius (check if view is inside a sphere)
         float distance = ViewToCenterLessRadius(view, lightPosition, lightRadius * sphereModelScale);
         bool isViewInside = distance < 0;
@@ -23,6 +23,10 @@ private:
     GPUPipelineState* _psLightSkyNormal = nullptr;
     GPUPipelineState* _psLightSkyInverted = nullptr;
     GPUPipelineState* _psClearDiffuse = nullptr;
+    GPUPipelineStatePermutationsPs<2> _psLightTiled;
+    GPUShaderProgramCS* _csCullLights = nullptr;
+    class DynamicStructuredBuffer* _tiledLightsBuffer = nullptr;
+    GPUBuffer* _tiledListsBuffer = nullptr;
     AssetReference<Model> _sphereModel;
     PixelFormat _shadowMaskFormat;
 
@@ -46,6 +50,8 @@ private:
         _psLightSpotInverted.Release();
         _psLightSkyNormal->ReleaseGPU();
         _psLightSkyInverted->ReleaseGPU();
+        _psLightTiled.Release();
+        _csCullLights = nullptr;
         invalidateResources();
     }
 #endif
@@ -258,9 +258,14 @@ void MotionBlurPass::RenderDebug(RenderContext& renderContext, GPUTextureView* f
     context->ResetSR();
 }
 
+bool MotionBlurPass::CanRender(const RenderContext& renderContext) const
+{
+    const MotionBlurSettings& settings = renderContext.List->Settings.MotionBlur;
+    return EnumHasAnyFlags(renderContext.View.Flags, ViewFlags::MotionBlur) && settings.Enabled && settings.Scale > ZeroTolerance;
+}
+
 void MotionBlurPass::Render(RenderContext& renderContext, GPUTexture*& frame, GPUTexture*& tmp)
 {
-    const bool isCameraCut = renderContext.Task->IsCameraCut;
     const auto motionVectors = renderContext.Buffers->MotionVectors;
     ASSERT(motionVectors);
     auto context = GPUDevice::Instance->GetMainContext();
@@ -269,13 +274,7 @@ void MotionBlurPass::Render(RenderContext& renderContext, GPUTexture*& frame, GP
     const int32 screenHeight = frame->Height();
     const int32 motionVectorsWidth = screenWidth / static_cast<int32>(settings.MotionVectorsResolution);
     const int32 motionVectorsHeight = screenHeight / static_cast<int32>(settings.MotionVectorsResolution);
-    if ((renderContext.View.Flags & ViewFlags::MotionBlur) == ViewFlags::None ||
-        !_hasValidResources ||
-        isCameraCut ||
-        screenWidth < 16 ||
-        screenHeight < 16 ||
-        !settings.Enabled ||
-        settings.Scale <= 0.0f)
+    if (!renderContext.List->Setup.UseMotionBlur || !_hasValidResources)
     {
         // Skip pass
         return;
@@ -29,6 +29,13 @@ public:
 
 public:
 
+    /// <summary>
+    /// Determines whether the pass will draw anything for the given frame (used to schedule the pass in the render setup before rendering).
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <returns>True if pass will render, otherwise false.</returns>
+    bool CanRender(const RenderContext& renderContext) const;
+
     /// <summary>
     /// Renders the motion vectors texture for the current task. Skips if motion blur is disabled or no need to render motion vectors.
     /// </summary>
@@ -1,6 +1,7 @@
 // Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
 
 #include "PostProcessingPass.h"
+#include "EyeAdaptationPass.h"
 #include "RenderList.h"
 #include "Engine/Content/Assets/Shader.h"
 #include "Engine/Content/Content.h"
@@ -197,13 +198,17 @@ void PostProcessingPass::Render(RenderContext& renderContext, GPUTexture* input,
     // Ensure to have valid data and if at least one effect should be applied
     if (checkIfSkipPass() || !(useBloom || useToneMapping || useCameraArtifacts))
     {
-        // Resources are missing. Do not perform rendering. Just copy raw frame
+        // Resources are missing. Do not perform rendering. Just apply the eye adaptation and copy raw frame
+        EyeAdaptationPass::Instance()->Render(renderContext, input);
         context->SetViewportAndScissors((float)output->Width(), (float)output->Height());
         context->SetRenderTarget(*output);
         context->Draw(input);
         return;
     }
 
+    // Compute the scene luminance for the eye adaptation (the exposure scale is applied during the bloom threshold and the final composite passes to save a full-screen multiply pass over the scene color)
+    GPUTexture* eyeAdaptationLuminance = EyeAdaptationPass::Instance()->RenderLuminance(renderContext, input);
+
     // Cache data
     auto shader = _shader->GetShader();
     auto cb0 = shader->GetCB(0);
@@ -289,11 +294,19 @@ void PostProcessingPass::Render(RenderContext& renderContext, GPUTexture* input,
         data.LensDirtIntensity = 0;
     }
     data.PostExposure = Math::Exp2(settings.EyeAdaptation.PostExposure);
+    data.EyeAdaptationExposure = 1.0f;
+    data.EyeAdaptationUseLuminance = 0.0f;
+    if (EnumHasAnyFlags(view.Flags, ViewFlags::EyeAdaptation) && settings.EyeAdaptation.Mode != EyeAdaptationMode::None)
+    {
+        data.EyeAdaptationExposure = Math::Exp2(settings.EyeAdaptation.PreExposure);
+        data.EyeAdaptationUseLuminance = eyeAdaptationLuminance != nullptr ? 1.0f : 0.0f;
+    }
     data.InputSize = Float2(static_cast<float>(w1), static_cast<float>(h1));
     data.InvInputSize = Float2(1.0f / static_cast<float>(w1), 1.0f / static_cast<float>(h1));
     data.InputAspect = static_cast<float>(w1) / h1;
     context->UpdateCB(cb0, &data);
     context->BindCB(0, cb0);
+    context->BindSR(1, eyeAdaptationLuminance ? eyeAdaptationLuminance->View() : nullptr);
 
     ////////////////////////////////////////////////////////////////////////////////////
     // Bloom
@@ -461,7 +474,7 @@ void PostProcessingPass::Render(RenderContext& renderContext, GPUTexture* input,
 
     // Composite pass inputs mapping:
     // - 0 - Input0   - scene color
-    // - 1 - Input1   - <unused>
+    // - 1 - Input1   - eye adaptation luminance (1x1)
     // - 2 - Input2   - bloom
     // - 3 - Input3   - lens flare color
     // - 4 - LensDirt - lens dirt texture
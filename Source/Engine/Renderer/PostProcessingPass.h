@@ -46,11 +46,16 @@ private:
         float ChromaticDistortion;
         float Time;
 
-        float Dummy1;
+        float EyeAdaptationExposure;
         float PostExposure;
         float VignetteIntensity;
         float LensDirtIntensity;
 
+        float EyeAdaptationUseLuminance;
+        float Dummy1;
+        float Dummy2;
+        float Dummy3;
+
         Color ScreenFadeColor;
 
         Matrix LensFlareStarMat;
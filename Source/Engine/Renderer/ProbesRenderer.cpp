@@ -23,6 +23,7 @@
 #include "Engine/Graphics/Textures/TextureData.h"
 #include "Engine/Graphics/RenderTask.h"
 #include "Engine/Engine/Engine.h"
+#include "Engine/Platform/Platform.h"
 
 /// <summary>
 /// Custom task called after downloading probe texture data to save it.
@@ -92,6 +93,7 @@ namespace ProbesRendererImpl
     GPUTexture* _tmpFace = nullptr;
     GPUTexture* _skySHIrradianceMap = nullptr;
     uint64 _updateFrameNumber = 0;
+    int32 _currentFace = 0;
 
     FORCE_INLINE bool isUpdateSynced()
     {
@@ -115,8 +117,23 @@ public:
 
 ProbesRendererService ProbesRendererServiceInstance;
 
+// Estimates the screen-space contribution of the probe to prioritize updating probes that affect the current view the most
+float GetProbeScreenScore(const ProbesRenderer::Entry& e)
+{
+    if (e.Type == ProbesRenderer::EntryType::SkyLight)
+        return MAX_float;
+    auto envProbe = e.Actor ? e.Actor.As<EnvironmentProbe>() : nullptr;
+    if (!envProbe || !MainRenderTask::Instance)
+        return 0.0f;
+    const RenderView& view = MainRenderTask::Instance->View;
+    const float distance = (float)Vector3::Distance(view.Origin + view.Position, envProbe->GetPosition());
+    const float radius = envProbe->GetScaledRadius();
+    return radius / Math::Max(distance, radius); // 1 when the view is inside the probe
+}
+
 TimeSpan ProbesRenderer::ProbesUpdatedBreak(0, 0, 0, 0, 500);
 TimeSpan ProbesRenderer::ProbesReleaseDataTime(0, 0, 0, 60);
+int32 ProbesRenderer::FrameBudgetUs = 4000;
 Delegate<const ProbesRenderer::Entry&> ProbesRenderer::OnRegisterBake;
 Delegate<const ProbesRenderer::Entry&> ProbesRenderer::OnFinishBake;
 
@@ -348,20 +365,26 @@ void ProbesRendererService::Update()
     }
     else if (_current.Type == ProbesRenderer::EntryType::Invalid)
     {
-        int32 firstValidEntryIndex = -1;
+        int32 bestEntryIndex = -1;
+        float bestEntryScore = -1.0f;
         auto dt = (float)Time::Update.UnscaledDeltaTime.GetTotalSeconds();
         for (int32 i = 0; i < _probesToBake.Count(); i++)
         {
             _probesToBake[i].Timeout -= dt;
             if (_probesToBake[i].Timeout <= 0)
             {
-                firstValidEntryIndex = i;
-                break;
+                // Prefer the probe with the highest screen-space contribution
+                const float score = GetProbeScreenScore(_probesToBake[i]);
+                if (score > bestEntryScore)
+                {
+                    bestEntryScore = score;
+                    bestEntryIndex = i;
+                }
             }
         }
 
         // Check if need to update probe
-        if (firstValidEntryIndex >= 0 && timeSinceUpdate > ProbesRenderer::ProbesUpdatedBreak)
+        if (bestEntryIndex >= 0 && timeSinceUpdate > ProbesRenderer::ProbesUpdatedBreak)
         {
             // Init service
             if (ProbesRenderer::Init())
@@ -372,10 +395,11 @@ void ProbesRendererService::Update()
                 return;
 
             // Mark probe to update
-            _current = _probesToBake[firstValidEntryIndex];
-            _probesToBake.RemoveAtKeepOrder(firstValidEntryIndex);
+            _current = _probesToBake[bestEntryIndex];
+            _probesToBake.RemoveAtKeepOrder(bestEntryIndex);
             _task->Enabled = true;
             _updateFrameNumber = 0;
+            _currentFace = 0;
 
             // Store time of the last probe update
             _lastProbeUpdate = timeNow;
@@ -418,12 +442,17 @@ void ProbesRenderer::OnRender(RenderTask* task, GPUContext* context)
         if (_current.Actor == nullptr)
         {
             // Probe has been unlinked (or deleted)
+            _current.Type = EntryType::Invalid;
+            _task->Enabled = false;
+            _currentFace = 0;
             return;
         }
         break;
     }
     default:
         // Canceled
+        _task->Enabled = false;
+        _currentFace = 0;
         return;
     }
 
@@ -477,9 +506,12 @@ void ProbesRenderer::OnRender(RenderTask* task, GPUContext* context)
     const bool isActorActive = _current.Actor->GetIsActive();
     _current.Actor->SetIsActive(false);
 
-    // Render scene for all faces
-    for (int32 faceIndex = 0; faceIndex < 6; faceIndex++)
+    // Render scene for the remaining faces (spread across frames to fit the per-frame budget)
+    const double timeBudget = (double)FrameBudgetUs / 1000000.0;
+    const double timeStart = Platform::GetTimeSeconds();
+    while (_currentFace < 6)
     {
+        const int32 faceIndex = _currentFace;
         _task->View.SetFace(faceIndex);
 
         // Handle custom frustum for the culling (used to skip objects near the camera)
@@ -502,11 +534,20 @@ void ProbesRenderer::OnRender(RenderTask* task, GPUContext* context)
             context->Draw(_output->View());
             context->ResetRenderTarget();
         }
+
+        _currentFace++;
+        if (FrameBudgetUs > 0 && _currentFace < 6 && Platform::GetTimeSeconds() - timeStart >= timeBudget)
+            break;
     }
 
     // Enable actor back
     _current.Actor->SetIsActive(isActorActive);
 
+    // Wait for the next frame to render the remaining faces
+    if (_currentFace < 6)
+        return;
+    _currentFace = 0;
+
     // Filter all lower mip levels
     {
         PROFILE_GPU("Filtering");
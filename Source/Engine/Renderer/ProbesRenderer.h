@@ -60,6 +60,11 @@ public:
     /// </summary>
     static TimeSpan ProbesReleaseDataTime;
 
+    /// <summary>
+    /// Per-frame time budget (in microseconds) for probes rendering. Probe cubemap faces are spread across the frames so a single bake doesn't block the frame. Set to 0 to render all faces in a single frame.
+    /// </summary>
+    static int32 FrameBudgetUs;
+
     int32 GetBakeQueueSize();
 
     static Delegate<const Entry&> OnRegisterBake;
@@ -15,6 +15,8 @@
 #include "Engine/Content/Assets/CubeTexture.h"
 #include "Engine/Level/Scene/Lightmap.h"
 #include "Engine/Level/Actors/PostFxVolume.h"
+#include "Engine/Threading/Threading.h"
+#include "Engine/Engine/Engine.h"
 
 static_assert(sizeof(DrawCall) <= 288, "Too big draw call data size.");
 static_assert(sizeof(DrawCall::Surface) >= sizeof(DrawCall::Terrain), "Wrong draw call data size.");
@@ -23,19 +25,20 @@ static_assert(sizeof(DrawCall::Surface) >= sizeof(DrawCall::Custom), "Wrong draw
 
 namespace
 {
-    // Cached data for the draw calls sorting
-    Array<uint64> SortingKeys[2];
-    Array<int32> SortingIndices;
     Array<RenderList*> FreeRenderList;
 
     struct MemPoolEntry
     {
         void* Ptr;
         uintptr Size;
+        uint64 LastFrameUsed;
     };
 
     Array<MemPoolEntry> MemPool;
     CriticalSection MemPoolLocker;
+
+    // Renderer memory pool allocates in page multiples so lists of similar sizes share blocks instead of re-growing
+    constexpr uintptr MemPoolPageSize = 4096;
 }
 
 void RendererDirectionalLightData::SetupLightData(LightData* data, bool useShadow) const
@@ -108,6 +111,7 @@ void RendererSkyLightData::SetupLightData(LightData* data, bool useShadow) const
 
 void* RendererAllocation::Allocate(uintptr size)
 {
+    size = Math::AlignUp<uintptr>(size, MemPoolPageSize);
     void* result = nullptr;
     MemPoolLocker.Lock();
     for (int32 i = 0; i < MemPool.Count(); i++)
@@ -129,11 +133,37 @@ void* RendererAllocation::Allocate(uintptr size)
 
 void RendererAllocation::Free(void* ptr, uintptr size)
 {
+    size = Math::AlignUp<uintptr>(size, MemPoolPageSize);
     MemPoolLocker.Lock();
-    MemPool.Add({ ptr, size });
+    MemPool.Add({ ptr, size, Engine::FrameCount });
     MemPoolLocker.Unlock();
 }
 
+void* RenderList::AllocateScratchMemory(uintptr size, uintptr alignment)
+{
+    ScopeLock lock(_scratchLocker);
+
+    // Try to sub-allocate from one of the existing blocks
+    for (int32 i = 0; i < _scratchBlocks.Count(); i++)
+    {
+        ScratchBlock& block = _scratchBlocks[i];
+        const uintptr offset = Math::AlignUp<uintptr>(block.Used, alignment);
+        if (offset + size <= block.Size)
+        {
+            block.Used = offset + size;
+            return block.Ptr + offset;
+        }
+    }
+
+    // Allocate a new block (block memory comes from the pooled renderer allocator so it gets recycled across frames)
+    ScratchBlock block;
+    block.Size = Math::Max<uintptr>(size, 64 * 1024);
+    block.Ptr = (byte*)RendererAllocation::Allocate(block.Size);
+    block.Used = size;
+    _scratchBlocks.Add(block);
+    return block.Ptr;
+}
+
 RenderList* RenderList::GetFromPool()
 {
     if (FreeRenderList.HasItems())
@@ -156,14 +186,29 @@ void RenderList::ReturnToPool(RenderList* cache)
     cache->Clear();
 }
 
+void RenderList::TrimCache()
+{
+    // Retain the high-water-mark of renderer memory and release only blocks that were not reused for a while
+    // (keeps warmed-up capacity across level transitions to avoid re-grow stutter when a big scene streams in)
+    constexpr uint64 maxUnusedFrames = 60 * 5;
+    const uint64 frame = Engine::FrameCount;
+    MemPoolLocker.Lock();
+    for (int32 i = MemPool.Count() - 1; i >= 0; i--)
+    {
+        if (frame - MemPool[i].LastFrameUsed > maxUnusedFrames)
+        {
+            Platform::Free(MemPool[i].Ptr);
+            MemPool.RemoveAt(i);
+        }
+    }
+    MemPoolLocker.Unlock();
+}
+
 void RenderList::CleanupCache()
 {
     // Don't call it during rendering (data may be already in use)
     ASSERT(GPUDevice::Instance == nullptr || GPUDevice::Instance->CurrentTask == nullptr);
 
-    SortingKeys[0].Resize(0);
-    SortingKeys[1].Resize(0);
-    SortingIndices.Resize(0);
     FreeRenderList.ClearDelete();
     for (auto& e : MemPool)
         Platform::Free(e.Ptr);
@@ -381,6 +426,12 @@ RenderList::RenderList(const SpawnParams& params)
 {
 }
 
+RenderList::~RenderList()
+{
+    for (int32 i = 0; i < _scratchBlocks.Count(); i++)
+        RendererAllocation::Free(_scratchBlocks[i].Ptr, _scratchBlocks[i].Size);
+}
+
 void RenderList::Init(RenderContext& renderContext)
 {
     renderContext.View.Frustum.GetCorners(FrustumCornersWs);
@@ -408,8 +459,29 @@ void RenderList::Clear()
     Fog = nullptr;
     PostFx.Clear();
     Settings = PostProcessSettings();
+    Setup = RenderSetup();
     Blendable.Clear();
     _instanceBuffer.Clear();
+
+    // Reset the per-frame scratch arena (keep a single largest block warm for the next frame)
+    if (_scratchBlocks.HasItems())
+    {
+        int32 largest = 0;
+        for (int32 i = 1; i < _scratchBlocks.Count(); i++)
+        {
+            if (_scratchBlocks[i].Size > _scratchBlocks[largest].Size)
+                largest = i;
+        }
+        for (int32 i = 0; i < _scratchBlocks.Count(); i++)
+        {
+            if (i != largest)
+                RendererAllocation::Free(_scratchBlocks[i].Ptr, _scratchBlocks[i].Size);
+        }
+        ScratchBlock block = _scratchBlocks[largest];
+        block.Used = 0;
+        _scratchBlocks.Clear();
+        _scratchBlocks.Add(block);
+    }
 }
 
 struct PackedSortKey
@@ -438,7 +510,7 @@ FORCE_INLINE void CalculateSortKey(const RenderContext& renderContext, DrawCall&
     batchKey = (batchKey * 397) ^ GetHash(drawCall.Geometry.VertexBuffers[0]);
     batchKey = (batchKey * 397) ^ GetHash(drawCall.Geometry.VertexBuffers[1]);
     batchKey = (batchKey * 397) ^ GetHash(drawCall.Geometry.VertexBuffers[2]);
-    batchKey = (batchKey * 397) ^ GetHash(drawCall.Material);
+    batchKey = (batchKey * 397) ^ GetHash(drawCall.Material->GetBatchingRoot());
     IMaterial::InstancingHandler handler;
     if (drawCall.Material->CanUseInstancing(handler))
         handler.GetHash(drawCall, batchKey);
@@ -474,7 +546,10 @@ void RenderList::AddDrawCall(const RenderContext& renderContext, DrawPass drawMo
     }
     if ((drawModes & DrawPass::Forward) != DrawPass::None)
     {
-        DrawCallsLists[(int32)DrawCallsListType::Forward].Indices.Add(index);
+        if (Graphics::HalfResTransparency && EnumHasNoneFlags(drawCall.Material->GetInfo().FeaturesFlags, MaterialFeaturesFlags::FullResolutionTransparency))
+            DrawCallsLists[(int32)DrawCallsListType::ForwardHalfRes].Indices.Add(index);
+        else
+            DrawCallsLists[(int32)DrawCallsListType::Forward].Indices.Add(index);
     }
     if ((drawModes & DrawPass::Distortion) != DrawPass::None)
     {
@@ -517,7 +592,10 @@ void RenderList::AddDrawCall(const RenderContextBatch& renderContextBatch, DrawP
         }
         if ((drawModes & DrawPass::Forward) != DrawPass::None)
         {
-            DrawCallsLists[(int32)DrawCallsListType::Forward].Indices.Add(index);
+            if (Graphics::HalfResTransparency && EnumHasNoneFlags(drawCall.Material->GetInfo().FeaturesFlags, MaterialFeaturesFlags::FullResolutionTransparency))
+                DrawCallsLists[(int32)DrawCallsListType::ForwardHalfRes].Indices.Add(index);
+            else
+                DrawCallsLists[(int32)DrawCallsListType::Forward].Indices.Add(index);
         }
         if ((drawModes & DrawPass::Distortion) != DrawPass::None)
         {
@@ -551,7 +629,7 @@ namespace
     FORCE_INLINE bool CanBatchWith(const DrawCall& a, const DrawCall& b)
     {
         IMaterial::InstancingHandler handler;
-        return a.Material == b.Material &&
+        return a.Material->GetBatchingRoot() == b.Material->GetBatchingRoot() &&
                 a.Material->CanUseInstancing(handler) &&
                 Platform::MemoryCompare(&a.Geometry, &b.Geometry, sizeof(a.Geometry)) == 0 &&
                 a.InstanceCount != 0 &&
@@ -561,23 +639,44 @@ namespace
     }
 }
 
-void RenderList::SortDrawCalls(const RenderContext& renderContext, bool reverseDistance, DrawCallsList& list, const RenderListBuffer<DrawCall>& drawCalls)
+void RenderList::SortDrawCalls(const RenderContext& renderContext, bool reverseDistance, DrawCallsList& list, const RenderListBuffer<DrawCall>& drawCalls, bool approximate)
 {
     PROFILE_CPU();
     const auto* drawCallsData = drawCalls.Get();
     const auto* listData = list.Indices.Get();
     const int32 listSize = list.Indices.Count();
 
-    // Peek shared memory
-#define PREPARE_CACHE(list) (list).Clear(); (list).Resize(listSize)
-    PREPARE_CACHE(SortingKeys[0]);
-    PREPARE_CACHE(SortingKeys[1]);
-    PREPARE_CACHE(SortingIndices);
-#undef PREPARE_CACHE
-    uint64* sortedKeys = SortingKeys[0].Get();
+    // Peek scratch memory from the per-frame arena (thread-safe so multiple lists can be sorted concurrently)
+    Span<uint64> sortingKeys0 = AllocateScratch<uint64>(listSize);
+    Span<uint64> sortingKeys1 = AllocateScratch<uint64>(listSize);
+    Span<int32> sortingIndices = AllocateScratch<int32>(listSize);
+    uint64* sortedKeys = sortingKeys0.Get();
+
+    // The key bits that break the draw calls batching when they differ (see the batching loop below)
+    uint64 batchBreakMask = 0x0000ffff00000000ull; // BatchKey bits of PackedSortKey
 
     // Setup sort keys
-    if (reverseDistance)
+    if (approximate)
+    {
+        // Approximate mode: the distance is quantized into 16 depth buckets packed into a 32-bit key (sort order, then batch key, then bucket).
+        // The radix sort early-outs once the remaining high bits are zero so this halves the sorting passes; draws within a bucket keep a stable order.
+        for (int32 i = 0; i < listSize; i++)
+        {
+            const DrawCall& drawCall = drawCallsData[listData[i]];
+            PackedSortKey key;
+            key.Data = drawCall.SortKey;
+            uint32 bucket = key.DistanceKey >> 28;
+            uint16 sortKey = key.SortKey;
+            if (reverseDistance)
+            {
+                bucket ^= 0xf; // Reverse depth
+                sortKey ^= MAX_uint16; // Reverse sort order
+            }
+            sortedKeys[i] = ((uint64)sortKey << 16) | (uint64)(key.BatchKey & 0xfff0) | (uint64)bucket;
+        }
+        batchBreakMask = 0x00000000fffffff0ull; // Everything but the depth bucket
+    }
+    else if (reverseDistance)
     {
         for (int32 i = 0; i < listSize; i++)
         {
@@ -598,9 +697,12 @@ void RenderList::SortDrawCalls(const RenderContext& renderContext, bool reverseD
         }
     }
 
-    // Sort draw calls indices
+    // Sort draw calls indices (use the parallel sort only when not already inside a Job System worker to prevent nested waits)
     int32* resultIndices = list.Indices.Get();
-    Sorting::RadixSort(sortedKeys, resultIndices, SortingKeys[1].Get(), SortingIndices.Get(), listSize);
+    if (IsInMainThread())
+        Sorting::RadixSortParallel(sortedKeys, resultIndices, sortingKeys1.Get(), sortingIndices.Get(), listSize);
+    else
+        Sorting::RadixSort(sortedKeys, resultIndices, sortingKeys1.Get(), sortingIndices.Get(), listSize);
     if (resultIndices != list.Indices.Get())
         Platform::MemoryCopy(list.Indices.Get(), resultIndices, sizeof(int32) * listSize);
 
@@ -611,10 +713,14 @@ void RenderList::SortDrawCalls(const RenderContext& renderContext, bool reverseD
         const DrawCall& drawCall = drawCallsData[listData[i]];
         int32 batchSize = 1;
         int32 instanceCount = drawCall.InstanceCount;
+        const uint64 batchKey = sortedKeys[i];
 
         // Check the following draw calls to merge them (using instancing)
         for (int32 j = i + 1; j < listSize; j++)
         {
+            // Cheap material+mesh batch key check first (filters out the vast majority of non-batchable pairs without touching the draw call data)
+            if (((sortedKeys[j] ^ batchKey) & batchBreakMask) != 0)
+                break;
             const DrawCall& other = drawCallsData[listData[j]];
             if (!CanBatchWith(drawCall, other))
                 break;
@@ -909,9 +1015,7 @@ void SurfaceDrawCallHandler::GetHash(const DrawCall& drawCall, uint32& batchKey)
 
 bool SurfaceDrawCallHandler::CanBatch(const DrawCall& a, const DrawCall& b)
 {
-    // TODO: find reason why batching static meshes with lightmap causes problems with sampling in shader (flickering when meshes in batch order gets changes due to async draw calls collection)
-    return a.Surface.Lightmap == nullptr && b.Surface.Lightmap == nullptr &&
-            //return a.Surface.Lightmap == b.Surface.Lightmap &&
+    return a.Surface.Lightmap == b.Surface.Lightmap &&
             a.Surface.Skinning == nullptr &&
             b.Surface.Skinning == nullptr;
 }
@@ -4,6 +4,7 @@
 
 #include "Engine/Core/Collections/Array.h"
 #include "Engine/Core/Math/Half.h"
+#include "Engine/Core/Types/Span.h"
 #include "Engine/Graphics/PostProcessSettings.h"
 #include "Engine/Graphics/DynamicBuffer.h"
 #include "Engine/Scripting/ScriptingObject.h"
@@ -180,6 +181,11 @@ API_ENUM() enum class DrawCallsListType
     /// </summary>
     Forward,
 
+    /// <summary>
+    /// Transparency rendering into a half-resolution buffer (see Graphics.HalfResTransparency).
+    /// </summary>
+    ForwardHalfRes,
+
     /// <summary>
     /// Distortion accumulation rendering.
     /// </summary>
@@ -265,6 +271,7 @@ struct DrawCallsList
 API_CLASS(Sealed) class FLAXENGINE_API RenderList : public ScriptingObject
 {
     DECLARE_SCRIPTING_TYPE(RenderList);
+    ~RenderList();
 
     /// <summary>
     /// Allocates the new renderer list object or reuses already allocated one.
@@ -281,6 +288,11 @@ API_CLASS(Sealed) class FLAXENGINE_API RenderList : public ScriptingObject
     /// <summary>
     /// Cleanups the static data cache used to accelerate draw calls sorting. Use it to reduce memory pressure.
     /// </summary>
+    /// <summary>
+    /// Releases pooled renderer memory that was not reused recently (called once per frame; keeps the high-water-mark capacity warm).
+    /// </summary>
+    static void TrimCache();
+
     static void CleanupCache();
 
 public:
@@ -404,6 +416,30 @@ public:
 private:
     DynamicVertexBuffer _instanceBuffer;
 
+    // Per-frame scratch memory arena for render passes temporary data (reset in Clear)
+    struct ScratchBlock
+    {
+        byte* Ptr;
+        uintptr Size;
+        uintptr Used;
+    };
+    Array<ScratchBlock, InlinedAllocation<8>> _scratchBlocks;
+    CriticalSection _scratchLocker;
+
+    void* AllocateScratchMemory(uintptr size, uintptr alignment);
+
+public:
+    /// <summary>
+    /// Allocates a temporary typed memory block for the render passes data (eg. visibility or light lists). The memory comes from a per-frame arena that gets reset in Clear so it's valid only during the current frame rendering. Contents are uninitialized and no constructors nor destructors are invoked (use for plain data only). Thread-safe.
+    /// </summary>
+    /// <param name="count">The amount of the elements to allocate.</param>
+    /// <returns>The span of the allocated elements.</returns>
+    template<typename T>
+    FORCE_INLINE Span<T> AllocateScratch(int32 count)
+    {
+        return Span<T>((T*)AllocateScratchMemory(count * sizeof(T), alignof(T)), count);
+    }
+
 public:
     /// <summary>
     /// Blends the postprocessing settings into the final options.
@@ -511,9 +547,10 @@ public:
     /// <param name="renderContext">The rendering context.</param>
     /// <param name="reverseDistance">If set to <c>true</c> reverse draw call distance to the view. Results in back to front sorting.</param>
     /// <param name="listType">The collected draw calls list type.</param>
-    API_FUNCTION() FORCE_INLINE void SortDrawCalls(API_PARAM(Ref) const RenderContext& renderContext, bool reverseDistance, DrawCallsListType listType)
+    /// <param name="approximate">If set to <c>true</c> distance is quantized into 16 depth buckets (stable order within a bucket) which cuts the sorting cost for lists where the exact order is not perceptible (eg. lots of small particles).</param>
+    API_FUNCTION() FORCE_INLINE void SortDrawCalls(API_PARAM(Ref) const RenderContext& renderContext, bool reverseDistance, DrawCallsListType listType, bool approximate = false)
     {
-        SortDrawCalls(renderContext, reverseDistance, DrawCallsLists[(int32)listType], DrawCalls);
+        SortDrawCalls(renderContext, reverseDistance, DrawCallsLists[(int32)listType], DrawCalls, approximate);
     }
 
     /// <summary>
@@ -523,7 +560,8 @@ public:
     /// <param name="reverseDistance">If set to <c>true</c> reverse draw call distance to the view. Results in back to front sorting.</param>
     /// <param name="list">The collected draw calls indices list.</param>
     /// <param name="drawCalls">The collected draw calls list.</param>
-    void SortDrawCalls(const RenderContext& renderContext, bool reverseDistance, DrawCallsList& list, const RenderListBuffer<DrawCall>& drawCalls);
+    /// <param name="approximate">If set to <c>true</c> distance is quantized into 16 depth buckets (stable order within a bucket) which cuts the sorting cost for lists where the exact order is not perceptible (eg. lots of small particles).</param>
+    void SortDrawCalls(const RenderContext& renderContext, bool reverseDistance, DrawCallsList& list, const RenderListBuffer<DrawCall>& drawCalls, bool approximate = false);
 
     /// <summary>
     /// Executes the collected draw calls.
@@ -12,4 +12,8 @@ struct FLAXENGINE_API RenderSetup
     RenderingUpscaleLocation UpscaleLocation = RenderingUpscaleLocation::AfterAntiAliasingPass;
     bool UseMotionVectors = false;
     bool UseTemporalAAJitter = false;
+
+    // Full-screen passes scheduled for this frame (resolved once before rendering so the disabled passes are culled up-front instead of re-checking settings inside every pass)
+    bool UseMotionBlur = false;
+    bool UseDepthOfField = false;
 };
@@ -21,6 +21,7 @@
 #include "MotionBlurPass.h"
 #include "VolumetricFogPass.h"
 #include "HistogramPass.h"
+#include "SkinningCachePass.h"
 #include "AtmospherePreCompute.h"
 #include "GlobalSignDistanceFieldPass.h"
 #include "GI/GlobalSurfaceAtlasPass.h"
@@ -34,6 +35,7 @@
 #include "Engine/Level/Level.h"
 #include "Engine/Level/Scene/SceneRendering.h"
 #include "Engine/Core/Config/GraphicsSettings.h"
+#include "Engine/Graphics/Graphics.h"
 #include "Engine/Threading/JobSystem.h"
 #if USE_EDITOR
 #include "Editor/Editor.h"
@@ -87,6 +89,7 @@ bool RendererService::Init()
     PassList.Add(TAA::Instance());
     PassList.Add(SMAA::Instance());
     PassList.Add(HistogramPass::Instance());
+    PassList.Add(SkinningCachePass::Instance());
     PassList.Add(GlobalSignDistanceFieldPass::Instance());
     PassList.Add(GlobalSurfaceAtlasPass::Instance());
     PassList.Add(DynamicDiffuseGlobalIlluminationPass::Instance());
@@ -237,6 +240,7 @@ void Renderer::DrawSceneDepth(GPUContext* context, SceneRenderTask* task, GPUTex
 
     // Call drawing (will collect draw calls)
     DrawActors(renderContext, customActors);
+    SkinningCachePass::Instance()->Flush(context);
 
     // Sort draw calls
     renderContext.List->SortDrawCalls(renderContext, false, DrawCallsListType::Depth);
@@ -324,14 +328,15 @@ void RenderInner(SceneRenderTask* task, RenderContext& renderContext, RenderCont
             setup.UseMotionVectors = false;
         else
         {
-            const MotionBlurSettings& motionBlurSettings = renderContext.List->Settings.MotionBlur;
             const ScreenSpaceReflectionsSettings ssrSettings = renderContext.List->Settings.ScreenSpaceReflections;
+            setup.UseMotionBlur = MotionBlurPass::Instance()->CanRender(renderContext);
             setup.UseMotionVectors =
-                    (EnumHasAnyFlags(renderContext.View.Flags, ViewFlags::MotionBlur) && motionBlurSettings.Enabled && motionBlurSettings.Scale > ZeroTolerance) ||
+                    setup.UseMotionBlur ||
                     renderContext.View.Mode == ViewMode::MotionVectors ||
                     (ssrSettings.TemporalEffect && EnumHasAnyFlags(renderContext.View.Flags, ViewFlags::SSR)) ||
                     renderContext.List->Settings.AntiAliasing.Mode == AntialiasingMode::TemporalAntialiasing;
         }
+        setup.UseDepthOfField = DepthOfFieldPass::Instance()->CanRender(renderContext);
         setup.UseTemporalAAJitter = aaMode == AntialiasingMode::TemporalAntialiasing;
 
         // Customize setup (by postfx or custom gameplay effects)
@@ -387,21 +392,33 @@ void RenderInner(SceneRenderTask* task, RenderContext& renderContext, RenderCont
 #endif
     }
 
+    // Pre-skin the animated meshes scheduled in the skin cache (the results are shared by all of the passes this frame)
+    SkinningCachePass::Instance()->Flush(context);
+
     // Sort draw calls
     {
         PROFILE_CPU_NAMED("Sort Draw Calls");
+
+        // Sort the shadow projections on Job System workers while the main view lists are sorted on this thread (each context owns its sorting memory)
+        int64 shadowSortLabel = 0;
+        if (renderContextBatch.Contexts.Count() > 1)
+        {
+            shadowSortLabel = JobSystem::Dispatch([&renderContextBatch, &renderContext](int32 i)
+            {
+                auto& shadowContext = renderContextBatch.Contexts[i + 1];
+                shadowContext.List->SortDrawCalls(shadowContext, false, DrawCallsListType::Depth);
+                shadowContext.List->SortDrawCalls(shadowContext, false, shadowContext.List->ShadowDepthDrawCallsList, renderContext.List->DrawCalls);
+            }, renderContextBatch.Contexts.Count() - 1);
+        }
         renderContext.List->SortDrawCalls(renderContext, false, DrawCallsListType::GBuffer);
         renderContext.List->SortDrawCalls(renderContext, false, DrawCallsListType::GBufferNoDecals);
-        renderContext.List->SortDrawCalls(renderContext, true, DrawCallsListType::Forward);
+        renderContext.List->SortDrawCalls(renderContext, true, DrawCallsListType::Forward, Graphics::ApproximateTransparentSort);
+        renderContext.List->SortDrawCalls(renderContext, true, DrawCallsListType::ForwardHalfRes, Graphics::ApproximateTransparentSort);
         renderContext.List->SortDrawCalls(renderContext, false, DrawCallsListType::Distortion);
         if (setup.UseMotionVectors)
             renderContext.List->SortDrawCalls(renderContext, false, DrawCallsListType::MotionVectors);
-        for (int32 i = 1; i < renderContextBatch.Contexts.Count(); i++)
-        {
-            auto& shadowContext = renderContextBatch.Contexts[i];
-            shadowContext.List->SortDrawCalls(shadowContext, false, DrawCallsListType::Depth);
-            shadowContext.List->SortDrawCalls(shadowContext, false, shadowContext.List->ShadowDepthDrawCallsList, renderContext.List->DrawCalls);
-        }
+        if (shadowSortLabel)
+            JobSystem::Wait(shadowSortLabel);
     }
 
     // Get the light accumulation buffer
@@ -462,6 +479,11 @@ void RenderInner(SceneRenderTask* task, RenderContext& renderContext, RenderCont
     }
 #endif
 
+    // Begin transitioning GBuffer targets into shader resources early (sampled by the following passes; GBuffer0 is skipped since ambient occlusion renders into it)
+    context->PreTransitionSR(renderContext.Buffers->GBuffer1);
+    context->PreTransitionSR(renderContext.Buffers->GBuffer2);
+    context->PreTransitionSR(renderContext.Buffers->GBuffer3);
+
     // Render motion vectors
     MotionBlurPass::Instance()->RenderMotionVectors(renderContext);
 
@@ -496,7 +518,6 @@ void RenderInner(SceneRenderTask* task, RenderContext& renderContext, RenderCont
         auto colorGradingLUT = ColorGradingPass::Instance()->RenderLUT(renderContext);
         auto tempBuffer = RenderTargetPool::Get(tempDesc);
         RENDER_TARGET_POOL_SET_NAME(tempBuffer, "TempBuffer");
-        EyeAdaptationPass::Instance()->Render(renderContext, lightBuffer);
         PostProcessingPass::Instance()->Render(renderContext, lightBuffer, tempBuffer, colorGradingLUT);
         RenderTargetPool::Release(colorGradingLUT);
         RenderTargetPool::Release(lightBuffer);
@@ -508,6 +529,10 @@ void RenderInner(SceneRenderTask* task, RenderContext& renderContext, RenderCont
         return;
     }
 
+    // Build volumetric fog volume right after lighting so its compute work can overlap with the following raster passes (it's consumed later by the fog draw)
+    if (renderContext.List->Fog)
+        VolumetricFogPass::Instance()->Render(renderContext);
+
     // Material and Custom PostFx
     renderContext.List->RunPostFxPass(context, renderContext, MaterialPostFxLocation::BeforeReflectionsPass, PostProcessEffectLocation::BeforeReflectionsPass, lightBuffer);
 
@@ -536,8 +561,6 @@ void RenderInner(SceneRenderTask* task, RenderContext& renderContext, RenderCont
     }
     if (renderContext.List->Fog)
     {
-        VolumetricFogPass::Instance()->Render(renderContext);
-
         PROFILE_GPU_CPU("Fog");
         renderContext.List->Fog->DrawFog(context, renderContext, *lightBuffer);
         context->ResetSR();
@@ -603,16 +626,17 @@ void RenderInner(SceneRenderTask* task, RenderContext& renderContext, RenderCont
     }
 
     // Depth of Field
-    DepthOfFieldPass::Instance()->Render(renderContext, frameBuffer, tempBuffer);
+    if (setup.UseDepthOfField)
+        DepthOfFieldPass::Instance()->Render(renderContext, frameBuffer, tempBuffer);
 
     // Motion Blur
-    MotionBlurPass::Instance()->Render(renderContext, frameBuffer, tempBuffer);
+    if (setup.UseMotionBlur)
+        MotionBlurPass::Instance()->Render(renderContext, frameBuffer, tempBuffer);
 
     // Color Grading LUT generation
     auto colorGradingLUT = ColorGradingPass::Instance()->RenderLUT(renderContext);
 
-    // Post processing
-    EyeAdaptationPass::Instance()->Render(renderContext, frameBuffer);
+    // Post processing (with the eye adaptation exposure fused into it)
     PostProcessingPass::Instance()->Render(renderContext, frameBuffer, tempBuffer, colorGradingLUT);
     RenderTargetPool::Release(colorGradingLUT);
     Swap(frameBuffer, tempBuffer);
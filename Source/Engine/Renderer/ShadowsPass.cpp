@@ -2,6 +2,7 @@
 
 #include "ShadowsPass.h"
 #include "GBufferPass.h"
+#include "GPUCullingPass.h"
 #include "VolumetricFogPass.h"
 #include "Engine/Graphics/Graphics.h"
 #include "Engine/Graphics/RenderTask.h"
@@ -9,6 +10,11 @@
 #include "Engine/Graphics/PixelFormatExtensions.h"
 #include "Engine/Content/Content.h"
 #include "Engine/Graphics/GPUContext.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Engine/Engine.h"
+#include "Engine/Level/Actor.h"
+#include "Engine/Level/Scene/SceneRendering.h"
+#include "Engine/Threading/Threading.h"
 #if USE_EDITOR
 #include "Engine/Renderer/Lightmaps.h"
 #endif
@@ -17,17 +23,204 @@
 #define SpotLight_NearPlane 10.0f
 #define PointLight_NearPlane 10.0f
 
+// Maximum amount of the local lights with cached shadow maps (memory budget)
+#define SHADOWS_CACHE_MAX_LIGHTS 32
+
+// Amount of frames for an unused cached shadow map to be released
+#define SHADOWS_CACHE_UNUSED_FRAMES (60 * 5)
+
 PACK_STRUCT(struct Data{
     GBufferData GBuffer;
     LightData Light;
     LightShadowData LightShadow;
     Matrix WVP;
     Matrix ViewProjectionMatrix;
-    Float2 Dummy0;
+    float Dummy0;
+    float ContactShadowsHiZ;
     float ContactShadowsDistance;
     float ContactShadowsLength;
     });
 
+/// <summary>
+/// Cache of the shadow maps rendered for the static local lights. Fully static lights keep their depth maps across frames
+/// and skip both the shadow draw calls collection and the depth rendering until any object intersecting the light bounds
+/// gets added, removed or moved (tracked via Scene Rendering events).
+/// </summary>
+class ShadowMapsCache : public ISceneRenderingListener
+{
+private:
+    struct Entry
+    {
+        GPUTexture* Texture = nullptr;
+        BoundingSphere Bounds;
+        uint64 LastFrameUsed = 0;
+        uint64 DirtyFrame = 0;
+        bool Valid = false;
+        bool IsCube = false;
+        int32 Size = 0;
+        Float3 Position;
+        Float3 Direction;
+        float Radius = 0.0f;
+        float OuterConeAngle = 0.0f;
+    };
+
+    CriticalSection _locker;
+    Dictionary<Guid, Entry> _entries;
+
+public:
+    ~ShadowMapsCache()
+    {
+        Release();
+    }
+
+    uint64 GetMemoryUsage() const
+    {
+        uint64 result = 0;
+        _locker.Lock();
+        for (const auto& e : _entries)
+        {
+            if (e.Value.Texture)
+                result += e.Value.Texture->GetMemoryUsage();
+        }
+        _locker.Unlock();
+        return result;
+    }
+
+    GPUTexture* GetShadowMap(const RendererPointLightData& light, int32 size, bool& reuseValid)
+    {
+        return GetShadowMap(light.ID, true, size, light.Position, Float3::Zero, light.Radius, 0.0f, reuseValid);
+    }
+
+    GPUTexture* GetShadowMap(const RendererSpotLightData& light, int32 size, bool& reuseValid)
+    {
+        return GetShadowMap(light.ID, false, size, light.Position, light.Direction, light.Radius, light.OuterConeAngle, reuseValid);
+    }
+
+    void OnShadowMapRendered(const Guid& id)
+    {
+        ScopeLock lock(_locker);
+        Entry* e = _entries.TryGet(id);
+        if (e && e->DirtyFrame != Engine::FrameCount)
+            e->Valid = true;
+    }
+
+    void Update()
+    {
+        // Release shadow maps of the lights that were not drawn for a significant amount of time
+        if (Engine::FrameCount < SHADOWS_CACHE_UNUSED_FRAMES)
+            return;
+        const uint64 minFrame = Engine::FrameCount - SHADOWS_CACHE_UNUSED_FRAMES;
+        ScopeLock lock(_locker);
+        Array<Guid, InlinedAllocation<8>> toRemove;
+        for (const auto& e : _entries)
+        {
+            if (e.Value.LastFrameUsed < minFrame)
+                toRemove.Add(e.Key);
+        }
+        for (const Guid& id : toRemove)
+        {
+            SAFE_DELETE_GPU_RESOURCE(_entries[id].Texture);
+            _entries.Remove(id);
+        }
+    }
+
+    void Release()
+    {
+        ScopeLock lock(_locker);
+        for (auto& e : _entries)
+            SAFE_DELETE_GPU_RESOURCE(e.Value.Texture);
+        _entries.Clear();
+    }
+
+    // [ISceneRenderingListener]
+    void OnSceneRenderingAddActor(Actor* a) override
+    {
+        Dirty(a->GetSphere());
+    }
+
+    void OnSceneRenderingUpdateActor(Actor* a, const BoundingSphere& prevBounds) override
+    {
+        Dirty(prevBounds);
+        Dirty(a->GetSphere());
+    }
+
+    void OnSceneRenderingRemoveActor(Actor* a) override
+    {
+        Dirty(a->GetSphere());
+    }
+
+    void OnSceneRenderingClear(SceneRendering* scene) override
+    {
+        ScopeLock lock(_locker);
+        for (auto& e : _entries)
+        {
+            e.Value.Valid = false;
+            e.Value.DirtyFrame = Engine::FrameCount;
+        }
+    }
+
+private:
+    GPUTexture* GetShadowMap(const Guid& id, bool isCube, int32 size, const Float3& position, const Float3& direction, float radius, float outerConeAngle, bool& reuseValid)
+    {
+        reuseValid = false;
+        ScopeLock lock(_locker);
+        Entry* e = _entries.TryGet(id);
+        if (!e)
+        {
+            // Don't evict other lights mid-frame, stale entries get released in Update
+            if (_entries.Count() >= SHADOWS_CACHE_MAX_LIGHTS)
+                return nullptr;
+            e = &_entries[id];
+        }
+        if (!e->Texture)
+            e->Texture = GPUDevice::Instance->CreateTexture(TEXT("CachedShadowMap"));
+        if (e->Size != size || e->IsCube != isCube)
+        {
+            const GPUTextureDescription desc = isCube
+                    ? GPUTextureDescription::NewCube(size, SHADOW_MAPS_FORMAT, GPUTextureFlags::ShaderResource | GPUTextureFlags::DepthStencil)
+                    : GPUTextureDescription::New2D(size, size, SHADOW_MAPS_FORMAT, GPUTextureFlags::ShaderResource | GPUTextureFlags::DepthStencil);
+            if (e->Texture->Init(desc))
+            {
+                SAFE_DELETE_GPU_RESOURCE(e->Texture);
+                _entries.Remove(id);
+                return nullptr;
+            }
+            e->Size = size;
+            e->IsCube = isCube;
+            e->Valid = false;
+        }
+        reuseValid = e->Valid
+                && Float3::NearEqual(e->Position, position)
+                && Float3::NearEqual(e->Direction, direction)
+                && Math::NearEqual(e->Radius, radius)
+                && Math::NearEqual(e->OuterConeAngle, outerConeAngle);
+        if (!reuseValid)
+        {
+            e->Valid = false;
+            e->Position = position;
+            e->Direction = direction;
+            e->Radius = radius;
+            e->OuterConeAngle = outerConeAngle;
+            e->Bounds = BoundingSphere(position, radius);
+        }
+        e->LastFrameUsed = Engine::FrameCount;
+        return e->Texture;
+    }
+
+    void Dirty(const BoundingSphere& bounds)
+    {
+        ScopeLock lock(_locker);
+        for (auto& e : _entries)
+        {
+            if (e.Value.Bounds.Intersects(bounds))
+            {
+                e.Value.Valid = false;
+                e.Value.DirtyFrame = Engine::FrameCount;
+            }
+        }
+    }
+};
+
 ShadowsPass::ShadowsPass()
     : _shader(nullptr)
     , _shadowMapsSizeCSM(0)
@@ -48,6 +241,8 @@ uint64 ShadowsPass::GetShadowMapsMemoryUsage() const
         result += _shadowMapCSM->GetMemoryUsage();
     if (_shadowMapCube)
         result += _shadowMapCube->GetMemoryUsage();
+    if (_shadowMapsCache)
+        result += _shadowMapsCache->GetMemoryUsage();
 
     return result;
 }
@@ -75,6 +270,7 @@ bool ShadowsPass::Init()
     // Create shadow maps
     _shadowMapCSM = GPUDevice::Instance->CreateTexture(TEXT("Shadow Map CSM"));
     _shadowMapCube = GPUDevice::Instance->CreateTexture(TEXT("Shadow Map Cube"));
+    _shadowMapsCache = New<ShadowMapsCache>();
 
 #if COMPILE_WITH_DEV_ENV
     _shader.Get()->OnReloading.Bind<ShadowsPass, &ShadowsPass::OnShaderReloading>(this);
@@ -452,31 +648,52 @@ void ShadowsPass::SetupLight(RenderContext& renderContext, RenderContextBatch& r
 
 void ShadowsPass::SetupLight(RenderContext& renderContext, RenderContextBatch& renderContextBatch, RendererPointLightData& light)
 {
+    const auto& view = renderContext.View;
+    const auto shadowMapsSizeCube = (float)_shadowMapsSizeCube;
+
+    // Try to reuse the cached shadow map for the fully static light (skips both the draw calls collection and the depth rendering)
+    bool reuseCachedShadowMap = false;
+    GPUTexture* cachedShadowMap = nullptr;
+    if (!view.IsOfflinePass && EnumHasAllFlags(light.StaticFlags, StaticFlags::Transform))
+        cachedShadowMap = _shadowMapsCache->GetShadowMap(light, _shadowMapsSizeCube, reuseCachedShadowMap);
+
     // Init shadow data
     light.ShadowDataIndex = _shadowData.Count();
     auto& shadowData = _shadowData.AddOne();
     shadowData.ContextIndex = renderContextBatch.Contexts.Count();
-    shadowData.ContextCount = 6;
+    shadowData.ContextCount = reuseCachedShadowMap ? 0 : 6;
+    shadowData.CachedShadowMap = cachedShadowMap;
     renderContextBatch.Contexts.AddDefault(shadowData.ContextCount);
 
-    const auto& view = renderContext.View;
-    const auto shadowMapsSizeCube = (float)_shadowMapsSizeCube;
-
     // Fade shadow on distance
     const float fadeDistance = Math::Max(light.ShadowsFadeDistance, 0.1f);
     const float dstLightToView = Float3::Distance(light.Position, view.Position);
     const float fade = 1 - Math::Saturate((dstLightToView - light.Radius - light.ShadowsDistance + fadeDistance) / fadeDistance);
 
-    // Render depth to all 6 faces of the cube map
-    for (int32 faceIndex = 0; faceIndex < 6; faceIndex++)
+    if (reuseCachedShadowMap)
     {
-        auto& shadowContext = renderContextBatch.Contexts[shadowData.ContextIndex + faceIndex];
-        SetupRenderContext(renderContext, shadowContext);
-        shadowContext.List->Clear();
-        shadowContext.View.SetUpCube(PointLight_NearPlane, light.Radius, light.Position);
-        shadowContext.View.SetFace(faceIndex);
-        shadowContext.View.PrepareCache(shadowContext, shadowMapsSizeCube, shadowMapsSizeCube, Float2::Zero, &view);
-        Matrix::Transpose(shadowContext.View.ViewProjection(), shadowData.Constants.ShadowVP[faceIndex]);
+        // Compute the shadow projection matrices only (cached depth is still valid)
+        RenderView faceView;
+        faceView.SetUpCube(PointLight_NearPlane, light.Radius, light.Position);
+        for (int32 faceIndex = 0; faceIndex < 6; faceIndex++)
+        {
+            faceView.SetFace(faceIndex);
+            Matrix::Transpose(faceView.ViewProjection(), shadowData.Constants.ShadowVP[faceIndex]);
+        }
+    }
+    else
+    {
+        // Render depth to all 6 faces of the cube map
+        for (int32 faceIndex = 0; faceIndex < 6; faceIndex++)
+        {
+            auto& shadowContext = renderContextBatch.Contexts[shadowData.ContextIndex + faceIndex];
+            SetupRenderContext(renderContext, shadowContext);
+            shadowContext.List->Clear();
+            shadowContext.View.SetUpCube(PointLight_NearPlane, light.Radius, light.Position);
+            shadowContext.View.SetFace(faceIndex);
+            shadowContext.View.PrepareCache(shadowContext, shadowMapsSizeCube, shadowMapsSizeCube, Float2::Zero, &view);
+            Matrix::Transpose(shadowContext.View.ViewProjection(), shadowData.Constants.ShadowVP[faceIndex]);
+        }
     }
 
     // Setup constant buffer data
@@ -492,16 +709,23 @@ void ShadowsPass::SetupLight(RenderContext& renderContext, RenderContextBatch& r
 
 void ShadowsPass::SetupLight(RenderContext& renderContext, RenderContextBatch& renderContextBatch, RendererSpotLightData& light)
 {
+    const auto& view = renderContext.View;
+    const auto shadowMapsSizeCube = (float)_shadowMapsSizeCube;
+
+    // Try to reuse the cached shadow map for the fully static light (skips both the draw calls collection and the depth rendering)
+    bool reuseCachedShadowMap = false;
+    GPUTexture* cachedShadowMap = nullptr;
+    if (!view.IsOfflinePass && EnumHasAllFlags(light.StaticFlags, StaticFlags::Transform))
+        cachedShadowMap = _shadowMapsCache->GetShadowMap(light, _shadowMapsSizeCube, reuseCachedShadowMap);
+
     // Init shadow data
     light.ShadowDataIndex = _shadowData.Count();
     auto& shadowData = _shadowData.AddOne();
     shadowData.ContextIndex = renderContextBatch.Contexts.Count();
-    shadowData.ContextCount = 1;
+    shadowData.ContextCount = reuseCachedShadowMap ? 0 : 1;
+    shadowData.CachedShadowMap = cachedShadowMap;
     renderContextBatch.Contexts.AddDefault(shadowData.ContextCount);
 
-    const auto& view = renderContext.View;
-    const auto shadowMapsSizeCube = (float)_shadowMapsSizeCube;
-
     // Fade shadow on distance
     const float fadeDistance = Math::Max(light.ShadowsFadeDistance, 0.1f);
     const float dstLightToView = Float3::Distance(light.Position, view.Position);
@@ -509,6 +733,14 @@ void ShadowsPass::SetupLight(RenderContext& renderContext, RenderContextBatch& r
 
     // Render depth to all 1 face of the cube map
     constexpr int32 faceIndex = 0;
+    if (reuseCachedShadowMap)
+    {
+        // Compute the shadow projection matrix only (cached depth is still valid)
+        RenderView projectorView;
+        projectorView.SetProjector(SpotLight_NearPlane, light.Radius, light.Position, light.Direction, light.UpVector, light.OuterConeAngle * 2.0f);
+        Matrix::Transpose(projectorView.ViewProjection(), shadowData.Constants.ShadowVP[faceIndex]);
+    }
+    else
     {
         auto& shadowContext = renderContextBatch.Contexts[shadowData.ContextIndex + faceIndex];
         SetupRenderContext(renderContext, shadowContext);
@@ -542,6 +774,7 @@ void ShadowsPass::Dispose()
     _sphereModel = nullptr;
     SAFE_DELETE_GPU_RESOURCE(_shadowMapCSM);
     SAFE_DELETE_GPU_RESOURCE(_shadowMapCube);
+    SAFE_DELETE(_shadowMapsCache);
 }
 
 void ShadowsPass::SetupShadows(RenderContext& renderContext, RenderContextBatch& renderContextBatch)
@@ -554,6 +787,7 @@ void ShadowsPass::SetupShadows(RenderContext& renderContext, RenderContextBatch&
     const auto shadowMapsQuality = Graphics::ShadowMapsQuality;
     if (shadowMapsQuality != _currentShadowMapsQuality)
         updateShadowMapSize();
+    _shadowMapsCache->Update();
     auto shadowsQuality = Graphics::ShadowsQuality;
     maxShadowsQuality = Math::Clamp(Math::Min<int32>(static_cast<int32>(shadowsQuality), static_cast<int32>(view.MaxShadowsQuality)), 0, static_cast<int32>(Quality::MAX) - 1);
 
@@ -621,18 +855,30 @@ void ShadowsPass::RenderShadow(RenderContextBatch& renderContextBatch, RendererP
 
     // Set up GPU context and render view
     const auto shadowMapsSizeCube = (float)_shadowMapsSizeCube;
-    context->SetViewportAndScissors(shadowMapsSizeCube, shadowMapsSizeCube);
-
-    // Render depth to all 6 faces of the cube map
-    for (int32 faceIndex = 0; faceIndex < 6; faceIndex++)
+    GPUTexture* shadowMap = shadowData.CachedShadowMap ? shadowData.CachedShadowMap : _shadowMapCube;
+    if (shadowData.ContextCount != 0)
     {
-        auto rt = _shadowMapCube->View(faceIndex);
-        context->ResetSR();
-        context->SetRenderTarget(rt, static_cast<GPUTextureView*>(nullptr));
-        context->ClearDepth(rt);
-        auto& shadowContext = renderContextBatch.Contexts[shadowData.ContextIndex + faceIndex];
-        shadowContext.List->ExecuteDrawCalls(shadowContext, DrawCallsListType::Depth);
-        shadowContext.List->ExecuteDrawCalls(shadowContext, shadowContext.List->ShadowDepthDrawCallsList, renderContext.List->DrawCalls, nullptr);
+        context->SetViewportAndScissors(shadowMapsSizeCube, shadowMapsSizeCube);
+
+        // Render depth to all 6 faces of the cube map
+        for (int32 faceIndex = 0; faceIndex < 6; faceIndex++)
+        {
+            auto rt = shadowMap->View(faceIndex);
+            context->ResetSR();
+            context->SetRenderTarget(rt, static_cast<GPUTextureView*>(nullptr));
+            context->ClearDepth(rt);
+            auto& shadowContext = renderContextBatch.Contexts[shadowData.ContextIndex + faceIndex];
+            shadowContext.List->ExecuteDrawCalls(shadowContext, DrawCallsListType::Depth);
+            shadowContext.List->ExecuteDrawCalls(shadowContext, shadowContext.List->ShadowDepthDrawCallsList, renderContext.List->DrawCalls, nullptr);
+        }
+
+        // Mark the cached shadow map as valid for the next frames
+        if (shadowData.CachedShadowMap)
+        {
+            for (SceneRendering* scene : renderContext.List->Scenes)
+                _shadowMapsCache->ListenSceneRendering(scene);
+            _shadowMapsCache->OnShadowMapRendered(light.ID);
+        }
     }
 
     // Restore GPU context
@@ -656,6 +902,17 @@ void ShadowsPass::RenderShadow(RenderContextBatch& renderContextBatch, RendererP
     Matrix::Transpose(view.ViewProjection(), sperLight.ViewProjectionMatrix);
     sperLight.ContactShadowsDistance = light.ShadowsDistance;
     sperLight.ContactShadowsLength = EnumHasAnyFlags(view.Flags, ViewFlags::ContactShadows) ? light.ContactShadowsLength : 0.0f;
+    sperLight.ContactShadowsHiZ = 0.0f;
+    if (sperLight.ContactShadowsLength > ZeroTolerance)
+    {
+        // Ray-march the contact shadows through the Hi-Z depth pyramid shared with the occlusion culling (coarser mips cost less bandwidth than full-res depth taps)
+        GPUTexture* hiZ = GPUCullingPass::Instance()->GetHiZ(context, renderContext);
+        if (hiZ)
+        {
+            context->BindSR(6, hiZ->View());
+            sperLight.ContactShadowsHiZ = 1.0f;
+        }
+    }
 
     // Calculate world view projection matrix for the light sphere
     Matrix world, wvp, matrix;
@@ -669,7 +926,7 @@ void ShadowsPass::RenderShadow(RenderContextBatch& renderContextBatch, RendererP
     context->UpdateCB(shader->GetCB(0), &sperLight);
     context->BindCB(0, shader->GetCB(0));
     context->BindCB(1, shader->GetCB(1));
-    context->BindSR(5, _shadowMapCube->ViewArray());
+    context->BindSR(5, shadowMap->ViewArray());
     context->SetRenderTarget(shadowMask);
     context->SetState(_psShadowPoint.Get(shadowQuality + (sperLight.ContactShadowsLength > ZeroTolerance ? 4 : 0)));
     _sphereModel->Render(context);
@@ -677,9 +934,10 @@ void ShadowsPass::RenderShadow(RenderContextBatch& renderContextBatch, RendererP
     // Cleanup
     context->ResetRenderTarget();
     context->UnBindSR(5);
+    context->UnBindSR(6);
 
     // Render volumetric light with shadow
-    VolumetricFogPass::Instance()->RenderLight(renderContext, context, light, _shadowMapCube->ViewArray(), sperLight.LightShadow);
+    VolumetricFogPass::Instance()->RenderLight(renderContext, context, light, shadowMap->ViewArray(), sperLight.LightShadow);
 }
 
 void ShadowsPass::RenderShadow(RenderContextBatch& renderContextBatch, RendererSpotLightData& light, GPUTextureView* shadowMask)
@@ -699,18 +957,30 @@ void ShadowsPass::RenderShadow(RenderContextBatch& renderContextBatch, RendererS
 
     // Set up GPU context and render view
     const auto shadowMapsSizeCube = (float)_shadowMapsSizeCube;
-    context->SetViewportAndScissors(shadowMapsSizeCube, shadowMapsSizeCube);
-
-    // Render depth to all 1 face of the cube map
+    GPUTexture* shadowMap = shadowData.CachedShadowMap ? shadowData.CachedShadowMap : _shadowMapCube;
     constexpr int32 faceIndex = 0;
+    if (shadowData.ContextCount != 0)
     {
-        auto rt = _shadowMapCube->View(faceIndex);
-        context->ResetSR();
-        context->SetRenderTarget(rt, static_cast<GPUTextureView*>(nullptr));
-        context->ClearDepth(rt);
-        auto& shadowContext = renderContextBatch.Contexts[shadowData.ContextIndex + faceIndex];
-        shadowContext.List->ExecuteDrawCalls(shadowContext, DrawCallsListType::Depth);
-        shadowContext.List->ExecuteDrawCalls(shadowContext, shadowContext.List->ShadowDepthDrawCallsList, renderContext.List->DrawCalls, nullptr);
+        context->SetViewportAndScissors(shadowMapsSizeCube, shadowMapsSizeCube);
+
+        // Render depth to all 1 face of the cube map
+        {
+            auto rt = shadowMap->View(faceIndex);
+            context->ResetSR();
+            context->SetRenderTarget(rt, static_cast<GPUTextureView*>(nullptr));
+            context->ClearDepth(rt);
+            auto& shadowContext = renderContextBatch.Contexts[shadowData.ContextIndex + faceIndex];
+            shadowContext.List->ExecuteDrawCalls(shadowContext, DrawCallsListType::Depth);
+            shadowContext.List->ExecuteDrawCalls(shadowContext, shadowContext.List->ShadowDepthDrawCallsList, renderContext.List->DrawCalls, nullptr);
+        }
+
+        // Mark the cached shadow map as valid for the next frames
+        if (shadowData.CachedShadowMap)
+        {
+            for (SceneRendering* scene : renderContext.List->Scenes)
+                _shadowMapsCache->ListenSceneRendering(scene);
+            _shadowMapsCache->OnShadowMapRendered(light.ID);
+        }
     }
 
     // Restore GPU context
@@ -734,6 +1004,17 @@ void ShadowsPass::RenderShadow(RenderContextBatch& renderContextBatch, RendererS
     Matrix::Transpose(view.ViewProjection(), sperLight.ViewProjectionMatrix);
     sperLight.ContactShadowsDistance = light.ShadowsDistance;
     sperLight.ContactShadowsLength = EnumHasAnyFlags(view.Flags, ViewFlags::ContactShadows) ? light.ContactShadowsLength : 0.0f;
+    sperLight.ContactShadowsHiZ = 0.0f;
+    if (sperLight.ContactShadowsLength > ZeroTolerance)
+    {
+        // Ray-march the contact shadows through the Hi-Z depth pyramid shared with the occlusion culling (coarser mips cost less bandwidth than full-res depth taps)
+        GPUTexture* hiZ = GPUCullingPass::Instance()->GetHiZ(context, renderContext);
+        if (hiZ)
+        {
+            context->BindSR(6, hiZ->View());
+            sperLight.ContactShadowsHiZ = 1.0f;
+        }
+    }
 
     // Calculate world view projection matrix for the light sphere
     Matrix world, wvp, matrix;
@@ -747,7 +1028,7 @@ void ShadowsPass::RenderShadow(RenderContextBatch& renderContextBatch, RendererS
     context->UpdateCB(shader->GetCB(0), &sperLight);
     context->BindCB(0, shader->GetCB(0));
     context->BindCB(1, shader->GetCB(1));
-    context->BindSR(5, _shadowMapCube->View(faceIndex));
+    context->BindSR(5, shadowMap->View(faceIndex));
     context->SetRenderTarget(shadowMask);
     context->SetState(_psShadowSpot.Get(shadowQuality + (sperLight.ContactShadowsLength > ZeroTolerance ? 4 : 0)));
     _sphereModel->Render(context);
@@ -755,9 +1036,10 @@ void ShadowsPass::RenderShadow(RenderContextBatch& renderContextBatch, RendererS
     // Cleanup
     context->ResetRenderTarget();
     context->UnBindSR(5);
+    context->UnBindSR(6);
 
     // Render volumetric light with shadow
-    VolumetricFogPass::Instance()->RenderLight(renderContext, context, light, _shadowMapCube->View(faceIndex), sperLight.LightShadow);
+    VolumetricFogPass::Instance()->RenderLight(renderContext, context, light, shadowMap->View(faceIndex), sperLight.LightShadow);
 }
 
 void ShadowsPass::RenderShadow(RenderContextBatch& renderContextBatch, RendererDirectionalLightData& light, int32 index, GPUTextureView* shadowMask)
@@ -804,6 +1086,17 @@ void ShadowsPass::RenderShadow(RenderContextBatch& renderContextBatch, RendererD
     Matrix::Transpose(view.ViewProjection(), sperLight.ViewProjectionMatrix);
     sperLight.ContactShadowsDistance = light.ShadowsDistance;
     sperLight.ContactShadowsLength = EnumHasAnyFlags(view.Flags, ViewFlags::ContactShadows) ? light.ContactShadowsLength : 0.0f;
+    sperLight.ContactShadowsHiZ = 0.0f;
+    if (sperLight.ContactShadowsLength > ZeroTolerance)
+    {
+        // Ray-march the contact shadows through the Hi-Z depth pyramid shared with the occlusion culling (coarser mips cost less bandwidth than full-res depth taps)
+        GPUTexture* hiZ = GPUCullingPass::Instance()->GetHiZ(context, renderContext);
+        if (hiZ)
+        {
+            context->BindSR(6, hiZ->View());
+            sperLight.ContactShadowsHiZ = 1.0f;
+        }
+    }
 
     // Render shadow in screen space
     auto shader = _shader->GetShader();
@@ -818,6 +1111,7 @@ void ShadowsPass::RenderShadow(RenderContextBatch& renderContextBatch, RendererD
     // Cleanup
     context->ResetRenderTarget();
     context->UnBindSR(5);
+    context->UnBindSR(6);
 
     // Cache params for the volumetric fog or other effects that use dir light shadow sampling
     LastDirLightIndex = index;
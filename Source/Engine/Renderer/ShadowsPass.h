@@ -14,6 +14,8 @@
 /// </summary>
 #define SHADOWS_PASS_SS_RR_FORMAT PixelFormat::R11G11B10_Float
 
+class ShadowMapsCache;
+
 template<typename T>
 bool CanRenderShadow(const RenderView& view, const T& light)
 {
@@ -47,6 +49,7 @@ private:
         int32 ContextIndex;
         int32 ContextCount;
         bool BlendCSM;
+        GPUTexture* CachedShadowMap = nullptr;
         LightShadowData Constants;
     };
 
@@ -67,6 +70,7 @@ private:
     // Shadow map rendering stuff
     AssetReference<Model> _sphereModel;
     Array<ShadowData> _shadowData;
+    ShadowMapsCache* _shadowMapsCache = nullptr;
 
     // Cached state for the current frame rendering (setup via Prepare)
     int32 maxShadowsQuality;
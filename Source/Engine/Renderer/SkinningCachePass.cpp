@@ -0,0 +1,347 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "SkinningCachePass.h"
+#include "RenderList.h"
+#include "Engine/Content/Assets/Shader.h"
+#include "Engine/Content/Content.h"
+#include "Engine/Core/Math/Matrix.h"
+#include "Engine/Engine/Engine.h"
+#include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/GPULimits.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/Models/Types.h"
+#include "Engine/Graphics/Shaders/GPUShader.h"
+#include "Engine/Threading/Threading.h"
+
+// This define must match the HLSL
+#define THREADGROUP_SIZE 64
+
+// The memory budget for the cached pre-skinned vertex buffers (in bytes)
+#define SKIN_CACHE_MEMORY_BUDGET (64 * 1024 * 1024)
+
+// The amount of frames without any use after which the cache entry gets released (even when under the memory budget)
+#define SKIN_CACHE_UNUSED_FRAMES 60
+
+PACK_STRUCT(struct SkinCacheData {
+    uint32 VerticesCount;
+    uint32 StartVertexIndex;
+    float BlendShapeWeight;
+    uint32 Dummy0;
+    });
+
+GPUBuffer* SkinningCachePass::GetSkinnedVertexBuffer(const SkinnedMesh* mesh, const SkinnedMeshDrawData* skinning, GPUBuffer* vertexBuffer, uint32 verticesCount)
+{
+    if (!_isSupported || _csSkinVertices == nullptr || !_identityReady)
+        return nullptr;
+    if (EnumHasNoneFlags(vertexBuffer->GetDescription().Flags, GPUBufferFlags::ShaderResource))
+        return nullptr;
+    const uint32 size = verticesCount * sizeof(VB0SkinnedElementType);
+    const Pair<const SkinnedMesh*, const void*> key(mesh, skinning);
+    ScopeLock lock(_locker);
+
+    // Get the cached buffer (mesh data could get reloaded so ensure that the size matches)
+    CacheEntry& entry = _cache[key];
+    if (entry.VertexBuffer == nullptr || entry.VertexBuffer->GetSize() != size)
+    {
+        if (entry.VertexBuffer == nullptr)
+            entry.VertexBuffer = GPUDevice::Instance->CreateBuffer(TEXT("SkinCache"));
+        const auto desc = GPUBufferDescription::Buffer(size, GPUBufferFlags::VertexBuffer | GPUBufferFlags::UnorderedAccess | GPUBufferFlags::RawBuffer, PixelFormat::R32_Typeless, nullptr, sizeof(VB0SkinnedElementType));
+        if (entry.VertexBuffer->Init(desc))
+        {
+            SAFE_DELETE_GPU_RESOURCE(entry.VertexBuffer);
+            _cache.Remove(key);
+            return nullptr;
+        }
+        entry.LastFrameUsed = 0;
+    }
+
+    // Schedule the compute update once per frame (all of the passes reuse the result)
+    const uint64 currentFrame = Engine::FrameCount;
+    if (entry.LastFrameUsed != currentFrame)
+    {
+        entry.LastFrameUsed = currentFrame;
+        UpdateEntry update;
+        update.Input = vertexBuffer;
+        update.Bones = skinning->BoneMatrices;
+        update.Output = entry.VertexBuffer;
+        update.VerticesCount = verticesCount;
+        _updates.Add(update);
+    }
+
+    return entry.VertexBuffer;
+}
+
+GPUBuffer* SkinningCachePass::GetBlendedVertexBuffer(const SkinnedMesh* mesh, BlendShapesInstance::MeshInstance* instance, GPUBuffer* vertexBuffer, uint32 verticesCount)
+{
+    if (!SupportsBlendShapes() || _csCopyVertices == nullptr || _csBlendShapeNormalize == nullptr)
+        return nullptr;
+    if (EnumHasNoneFlags(vertexBuffer->GetDescription().Flags, GPUBufferFlags::ShaderResource))
+        return nullptr;
+    const uint32 size = verticesCount * sizeof(VB0SkinnedElementType);
+    const Pair<const SkinnedMesh*, const void*> key(mesh, instance);
+    ScopeLock lock(_locker);
+
+    // Get the cached buffer (mesh data could get reloaded so ensure that the size matches)
+    CacheEntry& entry = _cache[key];
+    bool isNew = false;
+    if (entry.VertexBuffer == nullptr || entry.VertexBuffer->GetSize() != size)
+    {
+        if (entry.VertexBuffer == nullptr)
+            entry.VertexBuffer = GPUDevice::Instance->CreateBuffer(TEXT("SkinCache.BlendShapes"));
+        const auto desc = GPUBufferDescription::Buffer(size, GPUBufferFlags::VertexBuffer | GPUBufferFlags::UnorderedAccess | GPUBufferFlags::RawBuffer, PixelFormat::R32_Typeless, nullptr, sizeof(VB0SkinnedElementType));
+        if (entry.VertexBuffer->Init(desc))
+        {
+            SAFE_DELETE_GPU_RESOURCE(entry.VertexBuffer);
+            _cache.Remove(key);
+            return nullptr;
+        }
+        isNew = true;
+    }
+    entry.LastFrameUsed = Engine::FrameCount;
+
+    // Schedule the compute update when the blend shape weights were modified (or the buffer contents were lost)
+    if (instance->IsDirty || isNew)
+    {
+        instance->IsDirty = false;
+        BlendUpdateEntry update;
+        update.Input = vertexBuffer;
+        update.Output = entry.VertexBuffer;
+        update.VerticesCount = verticesCount;
+        update.MinVertexIndex = Math::Min(instance->BlendMinVertexIndex, verticesCount - 1);
+        update.MaxVertexIndex = Math::Min(instance->BlendMaxVertexIndex, verticesCount - 1);
+        update.UseNormals = instance->UseNormals;
+        for (const auto& e : instance->GPUBlendShapes)
+        {
+            GPUBuffer* deltas = getDeltaBuffer(*e.First);
+            if (!deltas)
+                continue;
+            BlendShapeJob job;
+            job.Deltas = deltas;
+            job.Weight = e.Second;
+            job.DeltasCount = (uint32)e.First->Vertices.Count();
+            update.Shapes.Add(job);
+        }
+        _blendUpdates.Add(MoveTemp(update));
+    }
+
+    return entry.VertexBuffer;
+}
+
+GPUBuffer* SkinningCachePass::getDeltaBuffer(const BlendShape& blendShape)
+{
+    // Get the cached deltas buffer (uploaded once, reused until the blend shape goes unused)
+    CacheEntry& entry = _deltaBuffers[&blendShape];
+    if (entry.VertexBuffer == nullptr)
+    {
+        entry.VertexBuffer = GPUDevice::Instance->CreateBuffer(TEXT("SkinCache.BlendShapeDeltas"));
+        const auto desc = GPUBufferDescription::Buffer(blendShape.Vertices.Count() * sizeof(BlendShapeVertex), GPUBufferFlags::ShaderResource | GPUBufferFlags::Structured, PixelFormat::Unknown, blendShape.Vertices.Get(), sizeof(BlendShapeVertex));
+        if (entry.VertexBuffer->Init(desc))
+        {
+            SAFE_DELETE_GPU_RESOURCE(entry.VertexBuffer);
+            _deltaBuffers.Remove(&blendShape);
+            return nullptr;
+        }
+    }
+    entry.LastFrameUsed = Engine::FrameCount;
+    return entry.VertexBuffer;
+}
+
+void SkinningCachePass::Flush(GPUContext* context)
+{
+    if (!_isSupported)
+        return;
+    ScopeLock lock(_locker);
+    if (checkIfSkipPass())
+    {
+        _updates.Clear();
+        _blendUpdates.Clear();
+        return;
+    }
+
+    // Initialize the shared identity bone used by the draw calls with the pre-skinned vertices
+    if (!_identityReady)
+    {
+        _identitySkinning.Setup(1);
+        if (!_identitySkinning.IsReady())
+            return;
+        _identitySkinning.SetData(&Matrix::Identity, true);
+        context->UpdateBuffer(_identitySkinning.BoneMatrices, _identitySkinning.Data.Get(), _identitySkinning.Data.Count());
+        _identitySkinning.OnFlush();
+        _identityReady = true;
+        return;
+    }
+
+    // Dispatch the scheduled pre-skinning and blend shapes jobs
+    if (_updates.HasItems() || _blendUpdates.HasItems())
+    {
+        PROFILE_GPU_CPU("Skin Cache");
+        const auto shader = _shader->GetShader();
+        const auto cb0 = shader->GetCB(0);
+        SkinCacheData data;
+        data.StartVertexIndex = 0;
+        data.BlendShapeWeight = 0.0f;
+        for (const UpdateEntry& update : _updates)
+        {
+            data.VerticesCount = update.VerticesCount;
+            context->UpdateCB(cb0, &data);
+            context->BindCB(0, cb0);
+            context->BindSR(0, update.Input->View());
+            context->BindSR(1, update.Bones->View());
+            context->BindUA(0, update.Output->View());
+            context->Dispatch(_csSkinVertices, (update.VerticesCount + THREADGROUP_SIZE - 1) / THREADGROUP_SIZE, 1, 1);
+        }
+        for (const BlendUpdateEntry& update : _blendUpdates)
+        {
+            // Initialize with the source mesh vertices
+            data.VerticesCount = update.VerticesCount;
+            data.StartVertexIndex = 0;
+            context->UpdateCB(cb0, &data);
+            context->BindCB(0, cb0);
+            context->BindSR(0, update.Input->View());
+            context->BindUA(0, update.Output->View());
+            context->Dispatch(_csCopyVertices, (update.VerticesCount + THREADGROUP_SIZE - 1) / THREADGROUP_SIZE, 1, 1);
+
+            // Add the weighted deltas of every active blend shape
+            for (const BlendShapeJob& job : update.Shapes)
+            {
+                data.VerticesCount = job.DeltasCount;
+                data.BlendShapeWeight = job.Weight;
+                context->UpdateCB(cb0, &data);
+                context->BindCB(0, cb0);
+                context->BindSR(0, job.Deltas->View());
+                context->Dispatch(_csBlendShapeDeltas, (job.DeltasCount + THREADGROUP_SIZE - 1) / THREADGROUP_SIZE, 1, 1);
+            }
+            data.BlendShapeWeight = 0.0f;
+
+            // Normalize the modified tangent frames
+            if (update.UseNormals && update.MaxVertexIndex >= update.MinVertexIndex)
+            {
+                data.VerticesCount = update.MaxVertexIndex - update.MinVertexIndex + 1;
+                data.StartVertexIndex = update.MinVertexIndex;
+                context->UpdateCB(cb0, &data);
+                context->BindCB(0, cb0);
+                context->Dispatch(_csBlendShapeNormalize, (data.VerticesCount + THREADGROUP_SIZE - 1) / THREADGROUP_SIZE, 1, 1);
+                data.StartVertexIndex = 0;
+            }
+        }
+        context->ResetUA();
+        context->ResetSR();
+        _updates.Clear();
+        _blendUpdates.Clear();
+    }
+
+    // Evict the least-recently used entries when the cache is over the memory budget (once per frame)
+    const uint64 currentFrame = Engine::FrameCount;
+    if (_lastEvictionFrame != currentFrame)
+    {
+        _lastEvictionFrame = currentFrame;
+        uint64 memoryUsage = 0;
+        for (auto i = _cache.Begin(); i.IsNotEnd(); ++i)
+        {
+            if (i->Value.LastFrameUsed + SKIN_CACHE_UNUSED_FRAMES < currentFrame)
+            {
+                SAFE_DELETE_GPU_RESOURCE(i->Value.VertexBuffer);
+                _cache.Remove(i);
+            }
+            else
+            {
+                memoryUsage += i->Value.VertexBuffer->GetSize();
+            }
+        }
+        for (auto i = _deltaBuffers.Begin(); i.IsNotEnd(); ++i)
+        {
+            if (i->Value.LastFrameUsed + SKIN_CACHE_UNUSED_FRAMES < currentFrame)
+            {
+                SAFE_DELETE_GPU_RESOURCE(i->Value.VertexBuffer);
+                _deltaBuffers.Remove(i);
+            }
+        }
+        while (memoryUsage > SKIN_CACHE_MEMORY_BUDGET)
+        {
+            // Skip the entries used this frame (their buffers are referenced by the pending draw calls)
+            Pair<const SkinnedMesh*, const void*> oldestKey(nullptr, nullptr);
+            uint64 oldestFrame = currentFrame;
+            for (auto i = _cache.Begin(); i.IsNotEnd(); ++i)
+            {
+                if (i->Value.LastFrameUsed < oldestFrame)
+                {
+                    oldestFrame = i->Value.LastFrameUsed;
+                    oldestKey = i->Key;
+                }
+            }
+            if (oldestKey.First == nullptr)
+                break;
+            CacheEntry& oldest = _cache[oldestKey];
+            memoryUsage -= oldest.VertexBuffer->GetSize();
+            SAFE_DELETE_GPU_RESOURCE(oldest.VertexBuffer);
+            _cache.Remove(oldestKey);
+        }
+    }
+}
+
+String SkinningCachePass::ToString() const
+{
+    return TEXT("SkinningCachePass");
+}
+
+bool SkinningCachePass::Init()
+{
+    _isSupported = GPUDevice::Instance->Limits.HasCompute;
+    if (!_isSupported)
+        return false;
+
+    // Load shader
+    _shader = Content::LoadAsyncInternal<Shader>(TEXT("Shaders/SkinCache"));
+    if (_shader == nullptr)
+        return true;
+#if COMPILE_WITH_DEV_ENV
+    _shader.Get()->OnReloading.Bind<SkinningCachePass, &SkinningCachePass::OnShaderReloading>(this);
+#endif
+
+    return false;
+}
+
+void SkinningCachePass::Dispose()
+{
+    // Base
+    RendererPass::Dispose();
+
+    // Cleanup
+    for (auto i = _cache.Begin(); i.IsNotEnd(); ++i)
+        SAFE_DELETE_GPU_RESOURCE(i->Value.VertexBuffer);
+    _cache.Clear();
+    for (auto i = _deltaBuffers.Begin(); i.IsNotEnd(); ++i)
+        SAFE_DELETE_GPU_RESOURCE(i->Value.VertexBuffer);
+    _deltaBuffers.Clear();
+    _updates.Clear();
+    _blendUpdates.Clear();
+    SAFE_DELETE_GPU_RESOURCE(_identitySkinning.BoneMatrices);
+    _identityReady = false;
+    _csSkinVertices = nullptr;
+    _csCopyVertices = nullptr;
+    _csBlendShapeDeltas = nullptr;
+    _csBlendShapeNormalize = nullptr;
+    _shader = nullptr;
+}
+
+bool SkinningCachePass::setupResources()
+{
+    // Wait for shader
+    if (!_shader->IsLoaded())
+        return true;
+    const auto shader = _shader->GetShader();
+
+    // Validate shader constant buffer size
+    if (shader->GetCB(0)->GetSize() != sizeof(SkinCacheData))
+    {
+        REPORT_INVALID_SHADER_PASS_CB_SIZE(shader, 0, SkinCacheData);
+        return true;
+    }
+
+    _csSkinVertices = shader->GetCS("CS_SkinVertices");
+    _csCopyVertices = shader->GetCS("CS_CopyVertices");
+    _csBlendShapeDeltas = shader->GetCS("CS_BlendShapeDeltas");
+    _csBlendShapeNormalize = shader->GetCS("CS_BlendShapeNormalize");
+
+    return false;
+}
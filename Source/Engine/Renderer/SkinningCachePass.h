@@ -0,0 +1,133 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "RendererPass.h"
+#include "Engine/Core/Types/Pair.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Graphics/Models/BlendShape.h"
+#include "Engine/Graphics/Models/SkinnedMeshDrawData.h"
+#include "Engine/Platform/CriticalSection.h"
+
+class SkinnedMesh;
+
+/// <summary>
+/// Skinned meshes pre-skinning pass. Skins the animated vertices with a compute shader into a cached vertex buffer that is shared by all of the passes during the frame (depth, shadow projections, materials) instead of re-skinning in the vertex shader for every pass. Handles the blend shapes evaluation on the GPU too. Uses compute shaders.
+/// </summary>
+class SkinningCachePass : public RendererPass<SkinningCachePass>
+{
+private:
+    struct CacheEntry
+    {
+        GPUBuffer* VertexBuffer = nullptr;
+        uint64 LastFrameUsed = 0;
+    };
+
+    struct UpdateEntry
+    {
+        GPUBuffer* Input;
+        GPUBuffer* Bones;
+        GPUBuffer* Output;
+        uint32 VerticesCount;
+    };
+
+    struct BlendShapeJob
+    {
+        GPUBuffer* Deltas;
+        float Weight;
+        uint32 DeltasCount;
+    };
+
+    struct BlendUpdateEntry
+    {
+        GPUBuffer* Input;
+        GPUBuffer* Output;
+        uint32 VerticesCount;
+        uint32 MinVertexIndex;
+        uint32 MaxVertexIndex;
+        bool UseNormals;
+        Array<BlendShapeJob, InlinedAllocation<8>> Shapes;
+    };
+
+    AssetReference<Shader> _shader;
+    GPUShaderProgramCS* _csSkinVertices = nullptr;
+    GPUShaderProgramCS* _csCopyVertices = nullptr;
+    GPUShaderProgramCS* _csBlendShapeDeltas = nullptr;
+    GPUShaderProgramCS* _csBlendShapeNormalize = nullptr;
+    bool _isSupported;
+    bool _identityReady = false;
+    uint64 _lastEvictionFrame = 0;
+    CriticalSection _locker;
+    Dictionary<Pair<const SkinnedMesh*, const void*>, CacheEntry> _cache;
+    Dictionary<const BlendShape*, CacheEntry> _deltaBuffers;
+    Array<UpdateEntry> _updates;
+    Array<BlendUpdateEntry> _blendUpdates;
+    SkinnedMeshDrawData _identitySkinning;
+
+public:
+    /// <summary>
+    /// Gets the cached vertex buffer with the pre-skinned vertices for the given mesh instance and schedules the compute skinning update during the next Flush (once per frame). Returns null if the skin cache cannot be used (the caller should keep the vertex shader skinning).
+    /// </summary>
+    /// <param name="mesh">The skinned mesh.</param>
+    /// <param name="skinning">The skinning data of the drawn mesh instance.</param>
+    /// <param name="vertexBuffer">The source vertex buffer of the mesh.</param>
+    /// <param name="verticesCount">The amount of the mesh vertices.</param>
+    /// <returns>The buffer with the pre-skinned vertices, or null if failed or not supported.</returns>
+    GPUBuffer* GetSkinnedVertexBuffer(const SkinnedMesh* mesh, const SkinnedMeshDrawData* skinning, GPUBuffer* vertexBuffer, uint32 verticesCount);
+
+    /// <summary>
+    /// Gets the shared skinning data with a single identity bone used by the draw calls with the pre-skinned vertices.
+    /// </summary>
+    FORCE_INLINE SkinnedMeshDrawData* GetIdentitySkinning()
+    {
+        return &_identitySkinning;
+    }
+
+    /// <summary>
+    /// Checks if the blend shapes can be evaluated on the GPU (compute shaders are supported and the skin cache shader is ready).
+    /// </summary>
+    FORCE_INLINE bool SupportsBlendShapes() const
+    {
+        return _isSupported && _csBlendShapeDeltas != nullptr;
+    }
+
+    /// <summary>
+    /// Gets the cached vertex buffer with the blend shapes applied to the given mesh instance and schedules the compute update during the next Flush (when the weights were modified). Returns null if the blend shapes cannot be evaluated on the GPU.
+    /// </summary>
+    /// <param name="mesh">The skinned mesh.</param>
+    /// <param name="instance">The blend shapes data of the drawn mesh instance.</param>
+    /// <param name="vertexBuffer">The source vertex buffer of the mesh.</param>
+    /// <param name="verticesCount">The amount of the mesh vertices.</param>
+    /// <returns>The buffer with the blended vertices, or null if failed or not supported.</returns>
+    GPUBuffer* GetBlendedVertexBuffer(const SkinnedMesh* mesh, BlendShapesInstance::MeshInstance* instance, GPUBuffer* vertexBuffer, uint32 verticesCount);
+
+    /// <summary>
+    /// Dispatches the scheduled pre-skinning compute jobs and evicts the least-recently used cache entries over the memory budget.
+    /// </summary>
+    /// <param name="context">The GPU context.</param>
+    void Flush(GPUContext* context);
+
+private:
+    GPUBuffer* getDeltaBuffer(const BlendShape& blendShape);
+
+#if COMPILE_WITH_DEV_ENV
+    void OnShaderReloading(Asset* obj)
+    {
+        _csSkinVertices = nullptr;
+        _csCopyVertices = nullptr;
+        _csBlendShapeDeltas = nullptr;
+        _csBlendShapeNormalize = nullptr;
+        invalidateResources();
+    }
+#endif
+
+public:
+    // [RendererPass]
+    String ToString() const override;
+    bool Init() override;
+    void Dispose() override;
+
+protected:
+    // [RendererPass]
+    bool setupResources() override;
+};
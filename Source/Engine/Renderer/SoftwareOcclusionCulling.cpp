@@ -0,0 +1,346 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "SoftwareOcclusionCulling.h"
+#include "Engine/Core/SIMD.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Core/Math/Matrix.h"
+#include "Engine/Core/Math/Vector4.h"
+#include "Engine/Core/Math/OrientedBoundingBox.h"
+#include "Engine/Engine/Engine.h"
+#include "Engine/Graphics/RenderView.h"
+#include "Engine/Level/Actors/BoxVolume.h"
+#include "Engine/Platform/CriticalSection.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/RenderStats.h"
+#include "Engine/Threading/Threading.h"
+#if SIMD_HAS_AVX_KERNELS
+#include <immintrin.h>
+#endif
+
+namespace
+{
+    CriticalSection OccludersLocker;
+    Array<BoxVolume*> Occluders;
+
+    // Software depth buffer (cleared to the far plane, occluders write their nearest depth)
+    float DepthBuffer[SoftwareOcclusionCulling::BufferWidth * SoftwareOcclusionCulling::BufferHeight];
+
+    // Hierarchical depth (max depth per tile) used by the bounds tests
+    float DepthTiles[SoftwareOcclusionCulling::TilesX * SoftwareOcclusionCulling::TilesY];
+
+    // Single-frame build cache so all scenes drawn with the same view share the buffer
+    uint64 CacheFrame = MAX_uint64;
+    Matrix CacheViewProjection;
+    bool CacheValid = false;
+
+    // View data cached for the bounds tests
+    Matrix CacheView;
+    float CacheNear, CacheProjM11, CacheProjM22, CacheProjM33, CacheProjM43;
+
+    // Rasterizes a single triangle (screen-space positions with depth in Z) into the depth buffer.
+    void RasterizeTriangle(const Float3& v0, const Float3& v1, const Float3& v2)
+    {
+        // Clip the triangle bounds to the buffer area
+        const int32 minX = Math::Max(Math::FloorToInt(Math::Min(v0.X, v1.X, v2.X)), 0);
+        const int32 minY = Math::Max(Math::FloorToInt(Math::Min(v0.Y, v1.Y, v2.Y)), 0);
+        const int32 maxX = Math::Min(Math::CeilToInt(Math::Max(v0.X, v1.X, v2.X)), (int32)SoftwareOcclusionCulling::BufferWidth - 1);
+        const int32 maxY = Math::Min(Math::CeilToInt(Math::Max(v0.Y, v1.Y, v2.Y)), (int32)SoftwareOcclusionCulling::BufferHeight - 1);
+        if (minX > maxX || minY > maxY)
+            return;
+
+        // Setup edge functions (both windings are rasterized as the box is closed and min-depth writes keep the front surface)
+        float area = (v1.X - v0.X) * (v2.Y - v0.Y) - (v1.Y - v0.Y) * (v2.X - v0.X);
+        float sign = 1.0f;
+        if (area < 0.0f)
+        {
+            area = -area;
+            sign = -1.0f;
+        }
+        if (area < ZeroTolerance)
+            return;
+        const float invArea = 1.0f / area;
+
+        for (int32 y = minY; y <= maxY; y++)
+        {
+            float* row = DepthBuffer + y * SoftwareOcclusionCulling::BufferWidth;
+            const float py = (float)y + 0.5f;
+            for (int32 x = minX; x <= maxX; x++)
+            {
+                const float px = (float)x + 0.5f;
+                const float w0 = sign * ((v1.X - px) * (v2.Y - py) - (v1.Y - py) * (v2.X - px));
+                const float w1 = sign * ((v2.X - px) * (v0.Y - py) - (v2.Y - py) * (v0.X - px));
+                const float w2 = sign * ((v0.X - px) * (v1.Y - py) - (v0.Y - py) * (v1.X - px));
+                if (w0 < 0.0f || w1 < 0.0f || w2 < 0.0f)
+                    continue;
+
+                // Depth (z/w) is linear in screen-space so barycentric interpolation is perspective-correct
+                const float depth = (w0 * v0.Z + w1 * v1.Z + w2 * v2.Z) * invArea;
+                if (depth < row[x])
+                    row[x] = Math::Max(depth, 0.0f);
+            }
+        }
+    }
+
+    // Clips the occluder face polygon against the w=epsilon plane and rasterizes it as a triangle fan. Returns the amount of triangles drawn.
+    int32 RasterizeFace(const Float4* corners, const int32 i0, const int32 i1, const int32 i2, const int32 i3)
+    {
+        // Clip against w > 0 (vertices behind the camera are interpolated onto the plane)
+        const float wClip = 1e-4f;
+        const int32 indices[4] = { i0, i1, i2, i3 };
+        Float4 clipped[8];
+        int32 clippedCount = 0;
+        for (int32 i = 0; i < 4; i++)
+        {
+            const Float4& a = corners[indices[i]];
+            const Float4& b = corners[indices[(i + 1) % 4]];
+            if (a.W >= wClip)
+                clipped[clippedCount++] = a;
+            if ((a.W >= wClip) != (b.W >= wClip))
+            {
+                const float t = (wClip - a.W) / (b.W - a.W);
+                clipped[clippedCount++] = a + (b - a) * t;
+            }
+        }
+        if (clippedCount < 3)
+            return 0;
+
+        // Project onto the screen (depth in Z, clamped in the rasterizer for geometry crossing the near plane)
+        Float3 screen[8];
+        for (int32 i = 0; i < clippedCount; i++)
+        {
+            const float invW = 1.0f / clipped[i].W;
+            screen[i] = Float3(
+                (clipped[i].X * invW * 0.5f + 0.5f) * SoftwareOcclusionCulling::BufferWidth,
+                (0.5f - clipped[i].Y * invW * 0.5f) * SoftwareOcclusionCulling::BufferHeight,
+                clipped[i].Z * invW);
+        }
+
+        // Triangulate as a fan
+        for (int32 i = 2; i < clippedCount; i++)
+            RasterizeTriangle(screen[0], screen[i - 1], screen[i]);
+        return clippedCount - 2;
+    }
+
+    // Kernels dispatched at runtime to the widest instruction set the CPU supports (see SIMD::SelectKernel)
+    typedef void (*DepthBufferKernel)();
+
+    // Clears the depth buffer to the far plane
+    void ClearDepthBuffer()
+    {
+        const SimdVector4 farPlane = SIMD::Splat(1.0f);
+        for (int32 i = 0; i < SoftwareOcclusionCulling::BufferWidth * SoftwareOcclusionCulling::BufferHeight; i += 4)
+            SIMD::StoreUnaligned(DepthBuffer + i, farPlane);
+    }
+
+    // Builds the per-tile max depth from the rasterized depth buffer
+    void BuildDepthTiles()
+    {
+        for (int32 ty = 0; ty < SoftwareOcclusionCulling::TilesY; ty++)
+        {
+            for (int32 tx = 0; tx < SoftwareOcclusionCulling::TilesX; tx++)
+            {
+                SimdVector4 tileMax = SIMD::Splat(0.0f);
+                const float* tile = DepthBuffer + ty * SoftwareOcclusionCulling::TileSize * SoftwareOcclusionCulling::BufferWidth + tx * SoftwareOcclusionCulling::TileSize;
+                for (int32 y = 0; y < SoftwareOcclusionCulling::TileSize; y++)
+                {
+                    const float* row = tile + y * SoftwareOcclusionCulling::BufferWidth;
+                    tileMax = SIMD::Max(tileMax, SIMD::LoadUnaligned(row));
+                    tileMax = SIMD::Max(tileMax, SIMD::LoadUnaligned(row + 4));
+                }
+                float lanes[4];
+                SIMD::StoreUnaligned(lanes, tileMax);
+                DepthTiles[ty * SoftwareOcclusionCulling::TilesX + tx] = Math::Max(Math::Max(lanes[0], lanes[1]), Math::Max(lanes[2], lanes[3]));
+            }
+        }
+    }
+
+#if SIMD_HAS_AVX_KERNELS
+
+    SIMD_KERNEL_AVX2 void ClearDepthBufferAVX2()
+    {
+        const __m256 farPlane = _mm256_set1_ps(1.0f);
+        for (int32 i = 0; i < SoftwareOcclusionCulling::BufferWidth * SoftwareOcclusionCulling::BufferHeight; i += 8)
+            _mm256_storeu_ps(DepthBuffer + i, farPlane);
+    }
+
+    SIMD_KERNEL_AVX512 void ClearDepthBufferAVX512()
+    {
+        const __m512 farPlane = _mm512_set1_ps(1.0f);
+        for (int32 i = 0; i < SoftwareOcclusionCulling::BufferWidth * SoftwareOcclusionCulling::BufferHeight; i += 16)
+            _mm512_storeu_ps(DepthBuffer + i, farPlane);
+    }
+
+    SIMD_KERNEL_AVX2 void BuildDepthTilesAVX2()
+    {
+        // A single 8-wide register covers the full tile row
+        for (int32 ty = 0; ty < SoftwareOcclusionCulling::TilesY; ty++)
+        {
+            for (int32 tx = 0; tx < SoftwareOcclusionCulling::TilesX; tx++)
+            {
+                __m256 tileMax = _mm256_setzero_ps();
+                const float* tile = DepthBuffer + ty * SoftwareOcclusionCulling::TileSize * SoftwareOcclusionCulling::BufferWidth + tx * SoftwareOcclusionCulling::TileSize;
+                for (int32 y = 0; y < SoftwareOcclusionCulling::TileSize; y++)
+                    tileMax = _mm256_max_ps(tileMax, _mm256_loadu_ps(tile + y * SoftwareOcclusionCulling::BufferWidth));
+                __m128 m = _mm_max_ps(_mm256_castps256_ps128(tileMax), _mm256_extractf128_ps(tileMax, 1));
+                m = _mm_max_ps(m, _mm_movehl_ps(m, m));
+                m = _mm_max_ss(m, _mm_shuffle_ps(m, m, 1));
+                DepthTiles[ty * SoftwareOcclusionCulling::TilesX + tx] = _mm_cvtss_f32(m);
+            }
+        }
+    }
+
+    SIMD_KERNEL_AVX512 void BuildDepthTilesAVX512()
+    {
+        // A single 16-wide register covers the rows of two adjacent tiles at once
+        for (int32 ty = 0; ty < SoftwareOcclusionCulling::TilesY; ty++)
+        {
+            for (int32 tx = 0; tx < SoftwareOcclusionCulling::TilesX; tx += 2)
+            {
+                __m512 tilesMax = _mm512_setzero_ps();
+                const float* tiles = DepthBuffer + ty * SoftwareOcclusionCulling::TileSize * SoftwareOcclusionCulling::BufferWidth + tx * SoftwareOcclusionCulling::TileSize;
+                for (int32 y = 0; y < SoftwareOcclusionCulling::TileSize; y++)
+                    tilesMax = _mm512_max_ps(tilesMax, _mm512_loadu_ps(tiles + y * SoftwareOcclusionCulling::BufferWidth));
+                const __m256 tile0 = _mm512_castps512_ps256(tilesMax);
+                const __m256 tile1 = _mm512_extractf32x8_ps(tilesMax, 1);
+                __m128 m0 = _mm_max_ps(_mm256_castps256_ps128(tile0), _mm256_extractf128_ps(tile0, 1));
+                m0 = _mm_max_ps(m0, _mm_movehl_ps(m0, m0));
+                m0 = _mm_max_ss(m0, _mm_shuffle_ps(m0, m0, 1));
+                __m128 m1 = _mm_max_ps(_mm256_castps256_ps128(tile1), _mm256_extractf128_ps(tile1, 1));
+                m1 = _mm_max_ps(m1, _mm_movehl_ps(m1, m1));
+                m1 = _mm_max_ss(m1, _mm_shuffle_ps(m1, m1, 1));
+                DepthTiles[ty * SoftwareOcclusionCulling::TilesX + tx] = _mm_cvtss_f32(m0);
+                DepthTiles[ty * SoftwareOcclusionCulling::TilesX + tx + 1] = _mm_cvtss_f32(m1);
+            }
+        }
+    }
+
+#endif
+}
+
+void SoftwareOcclusionCulling::AddOccluder(BoxVolume* volume)
+{
+    ScopeLock lock(OccludersLocker);
+    Occluders.Add(volume);
+}
+
+void SoftwareOcclusionCulling::RemoveOccluder(BoxVolume* volume)
+{
+    ScopeLock lock(OccludersLocker);
+    Occluders.Remove(volume);
+}
+
+bool SoftwareOcclusionCulling::Build(const RenderView& view)
+{
+    // Occlusion culling runs for the main perspective view only (shadow and probe passes use frustum culling)
+    if (!EnumHasAnyFlags(view.Pass, DrawPass::GBuffer) || !view.IsPerspectiveProjection() || view.IsOfflinePass)
+        return false;
+
+    // Reuse the buffer built for this view within the current frame
+    const Matrix viewProjection = view.ViewProjection();
+    if (CacheFrame == Engine::FrameCount && CacheViewProjection == viewProjection)
+        return CacheValid;
+    CacheFrame = Engine::FrameCount;
+    CacheViewProjection = viewProjection;
+    CacheValid = false;
+
+    ScopeLock lock(OccludersLocker);
+    if (Occluders.IsEmpty())
+        return false;
+    PROFILE_CPU();
+
+    // Clear depth to the far plane
+    {
+#if SIMD_HAS_AVX_KERNELS
+        SIMD_KERNEL_DISPATCH(clearDepth, DepthBufferKernel, ClearDepthBuffer, ClearDepthBufferAVX2, ClearDepthBufferAVX512);
+        clearDepth();
+#else
+        ClearDepthBuffer();
+#endif
+    }
+
+    // Rasterize the occluder proxy boxes
+    int32 trianglesDrawn = 0;
+    for (BoxVolume* volume : Occluders)
+    {
+        Float3 cornersWorld[8];
+        volume->GetOrientedBox().GetCorners(cornersWorld);
+        Float4 corners[8];
+        for (int32 i = 0; i < 8; i++)
+            Float3::Transform(Float3(cornersWorld[i] - view.Origin), viewProjection, corners[i]);
+        trianglesDrawn += RasterizeFace(corners, 0, 1, 2, 3);
+        trianglesDrawn += RasterizeFace(corners, 4, 5, 6, 7);
+        trianglesDrawn += RasterizeFace(corners, 0, 1, 5, 4);
+        trianglesDrawn += RasterizeFace(corners, 3, 2, 6, 7);
+        trianglesDrawn += RasterizeFace(corners, 0, 3, 7, 4);
+        trianglesDrawn += RasterizeFace(corners, 1, 2, 6, 5);
+    }
+    if (trianglesDrawn == 0)
+        return false;
+#if SIMD_HAS_AVX_KERNELS
+    SIMD_KERNEL_DISPATCH(buildDepthTiles, DepthBufferKernel, BuildDepthTiles, BuildDepthTilesAVX2, BuildDepthTilesAVX512);
+    buildDepthTiles();
+#else
+    BuildDepthTiles();
+#endif
+
+    // Cache the view data for the bounds tests
+    CacheView = view.View;
+    CacheNear = view.Near;
+    CacheProjM11 = view.Projection.M11;
+    CacheProjM22 = view.Projection.M22;
+    CacheProjM33 = view.Projection.M33;
+    CacheProjM43 = view.Projection.M43;
+    CacheValid = true;
+    return true;
+}
+
+bool SoftwareOcclusionCulling::IsOccluded(const BoundingSphere& bounds)
+{
+    // View-space sphere center
+    const Float3 center((float)bounds.Center.X, (float)bounds.Center.Y, (float)bounds.Center.Z);
+    const float radius = (float)bounds.Radius;
+    Float3 centerView;
+    Float3::Transform(center, CacheView, centerView);
+    const float zNear = centerView.Z - radius;
+    if (zNear <= CacheNear)
+        return false; // Crosses the near plane - always visible
+
+    // Conservative depth of the nearest sphere point
+    const float depth = CacheProjM33 + CacheProjM43 / zNear;
+    if (depth >= 1.0f)
+        return false;
+
+    // Conservative screen-space rect of the sphere (evaluate the view-space extents over both depth bounds)
+    const float zFar = centerView.Z + radius;
+    const float xMinNdc = Math::Min((centerView.X - radius) * CacheProjM11 / zNear, (centerView.X - radius) * CacheProjM11 / zFar);
+    const float xMaxNdc = Math::Max((centerView.X + radius) * CacheProjM11 / zNear, (centerView.X + radius) * CacheProjM11 / zFar);
+    const float yMinNdc = Math::Min((centerView.Y - radius) * CacheProjM22 / zNear, (centerView.Y - radius) * CacheProjM22 / zFar);
+    const float yMaxNdc = Math::Max((centerView.Y + radius) * CacheProjM22 / zNear, (centerView.Y + radius) * CacheProjM22 / zFar);
+    const int32 tileX0 = Math::Clamp(Math::FloorToInt((xMinNdc * 0.5f + 0.5f) * TilesX), 0, (int32)TilesX - 1);
+    const int32 tileX1 = Math::Clamp(Math::CeilToInt((xMaxNdc * 0.5f + 0.5f) * TilesX), 0, (int32)TilesX - 1);
+    const int32 tileY0 = Math::Clamp(Math::FloorToInt((0.5f - yMaxNdc * 0.5f) * TilesY), 0, (int32)TilesY - 1);
+    const int32 tileY1 = Math::Clamp(Math::CeilToInt((0.5f - yMinNdc * 0.5f) * TilesY), 0, (int32)TilesY - 1);
+
+    // The object is occluded if every covered tile has an occluder in front of it
+    SimdVector4 tilesMax = SIMD::Splat(0.0f);
+    float maxTileDepth = 0.0f;
+    for (int32 ty = tileY0; ty <= tileY1; ty++)
+    {
+        const float* row = DepthTiles + ty * TilesX;
+        int32 tx = tileX0;
+        for (; tx + 4 <= tileX1 + 1; tx += 4)
+            tilesMax = SIMD::Max(tilesMax, SIMD::LoadUnaligned(row + tx));
+        for (; tx <= tileX1; tx++)
+            maxTileDepth = Math::Max(maxTileDepth, row[tx]);
+    }
+    float lanes[4];
+    SIMD::StoreUnaligned(lanes, tilesMax);
+    maxTileDepth = Math::Max(maxTileDepth, Math::Max(Math::Max(lanes[0], lanes[1]), Math::Max(lanes[2], lanes[3])));
+    if (depth > maxTileDepth)
+    {
+        RENDER_STAT_OCCLUDED();
+        return true;
+    }
+    return false;
+}
@@ -0,0 +1,57 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Math/BoundingSphere.h"
+
+class BoxVolume;
+struct RenderView;
+
+/// <summary>
+/// CPU occlusion culling system that rasterizes occluder proxy volumes into a small software depth buffer
+/// with a hierarchical per-tile depth, then tests objects bounds against it to skip drawing fully-occluded geometry.
+/// Occluder proxies are registered by OcclusionVolume actors placed inside large opaque geometry (buildings, terrain walls).
+/// </summary>
+class SoftwareOcclusionCulling
+{
+public:
+    enum
+    {
+        // Software depth buffer dimensions (small on purpose - rasterization and tests are conservative)
+        BufferWidth = 256,
+        BufferHeight = 144,
+
+        // Hierarchical depth tile size (tiles store the max depth of the covered pixels)
+        TileSize = 8,
+        TilesX = BufferWidth / TileSize,
+        TilesY = BufferHeight / TileSize,
+    };
+
+public:
+    /// <summary>
+    /// Registers the occluder proxy volume.
+    /// </summary>
+    /// <param name="volume">The occluder volume actor.</param>
+    static void AddOccluder(BoxVolume* volume);
+
+    /// <summary>
+    /// Unregisters the occluder proxy volume.
+    /// </summary>
+    /// <param name="volume">The occluder volume actor.</param>
+    static void RemoveOccluder(BoxVolume* volume);
+
+    /// <summary>
+    /// Builds the occlusion depth buffer for the given view by rasterizing the registered occluder proxies.
+    /// Results are cached within a single frame so multiple scenes rendered with the same view share the buffer.
+    /// </summary>
+    /// <param name="view">The rendering view (perspective GBuffer pass views only).</param>
+    /// <returns>True if the buffer is valid and objects can be tested for occlusion, otherwise false.</returns>
+    static bool Build(const RenderView& view);
+
+    /// <summary>
+    /// Tests the object bounds against the occlusion depth buffer built by the last Build call.
+    /// </summary>
+    /// <param name="bounds">The object bounding sphere (relative to the view origin).</param>
+    /// <returns>True if the object is fully occluded and can be skipped from drawing, otherwise false.</returns>
+    static bool IsOccluded(const BoundingSphere& bounds);
+};
@@ -148,6 +148,7 @@ bool VolumetricFogPass::Init(RenderContext& renderContext, GPUContext* context,
         _cache.GridSizeZ = 64;
         _cache.FogJitter = false;
         _cache.MissedHistorySamplesCount = 1;
+        _cache.TemporalUpdate = false;
         break;
     }
     case Quality::Medium:
@@ -156,6 +157,7 @@ bool VolumetricFogPass::Init(RenderContext& renderContext, GPUContext* context,
         _cache.GridSizeZ = 64;
         _cache.FogJitter = true;
         _cache.MissedHistorySamplesCount = 4;
+        _cache.TemporalUpdate = false;
         break;
     }
     case Quality::High:
@@ -164,6 +166,7 @@ bool VolumetricFogPass::Init(RenderContext& renderContext, GPUContext* context,
         _cache.GridSizeZ = 128;
         _cache.FogJitter = true;
         _cache.MissedHistorySamplesCount = 4;
+        _cache.TemporalUpdate = true;
         break;
     }
     case Quality::Ultra:
@@ -172,6 +175,7 @@ bool VolumetricFogPass::Init(RenderContext& renderContext, GPUContext* context,
         _cache.GridSizeZ = 256;
         _cache.FogJitter = true;
         _cache.MissedHistorySamplesCount = 8;
+        _cache.TemporalUpdate = true;
         break;
     }
     }
@@ -201,6 +205,8 @@ bool VolumetricFogPass::Init(RenderContext& renderContext, GPUContext* context,
     _cache.Data.PhaseG = options.ScatteringDistribution;
     _cache.Data.VolumetricFogMaxDistance = options.Distance;
     _cache.Data.MissedHistorySamplesCount = Math::Clamp(_cache.MissedHistorySamplesCount, 1, (int32)ARRAY_COUNT(_cache.Data.FrameJitterOffsets));
+    const bool temporalHistoryIsValid = renderContext.Buffers->VolumetricFogHistory && !renderContext.Task->IsCameraCut && Float3::NearEqual(renderContext.Buffers->VolumetricFogHistory->Size3(), _cache.GridSize);
+    _cache.Data.TemporalUpdatePhase = _cache.TemporalUpdate && temporalHistoryIsValid ? (uint32)(Engine::FrameCount & 3) : 4; // Phase 4 updates all froxels (no valid history to reuse)
     Matrix::Transpose(view.PrevViewProjection, _cache.Data.PrevWorldToClip);
     _cache.Data.DirectionalLightShadow.NumCascades = 0;
     _cache.Data.SkyLight.VolumetricScatteringIntensity = 0;
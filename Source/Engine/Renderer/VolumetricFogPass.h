@@ -52,7 +52,8 @@ private:
         uint32 GridSizeIntZ;
         float PhaseG;
 
-        Float2 Dummy0;
+        uint32 TemporalUpdatePhase;
+        float Dummy0;
         float VolumetricFogMaxDistance;
         float InverseSquaredLightDistanceBiasScale;
 
@@ -120,6 +121,11 @@ private:
         /// </summary>
         int32 MissedHistorySamplesCount;
 
+        /// <summary>
+        /// Whether to use the temporal interleaved update that refreshes only a quarter of the froxels per frame (in a 2x2 checkerboard pattern) and reuses the reprojected history for the rest. Cuts the light scattering cost to allow denser grids.
+        /// </summary>
+        bool TemporalUpdate;
+
         /// <summary>
         /// Scales the amount added to the inverse squared falloff denominator. This effectively removes the spike from inverse squared falloff that causes extreme aliasing.
         /// </summary>
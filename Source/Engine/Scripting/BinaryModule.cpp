@@ -3,6 +3,12 @@
 #include "BinaryModule.h"
 #include "ScriptingObject.h"
 #include "Engine/Core/Log.h"
+#include "Engine/Core/Types/DateTime.h"
+#include "Engine/Engine/Globals.h"
+#include "Engine/Platform/File.h"
+#include "Engine/Platform/FileSystem.h"
+#include "Engine/Serialization/MemoryReadStream.h"
+#include "Engine/Serialization/MemoryWriteStream.h"
 #include "Engine/Threading/Threading.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "ManagedCLR/MAssembly.h"
@@ -897,6 +903,89 @@ void ManagedBinaryModule::OnLoading(MAssembly* assembly)
     }
 }
 
+#if !COMPILE_WITHOUT_CSHARP
+
+namespace
+{
+    // Version of the assembly reflection scan cache data format
+    constexpr int32 ScriptsScanCacheVersion = 1;
+
+    String GetScriptsScanCachePath(MAssembly* assembly)
+    {
+#if USE_EDITOR
+        const String cacheRoot = Globals::ProjectCacheFolder / TEXT("Scripting");
+#else
+        const String cacheRoot = Globals::ProductLocalFolder / TEXT("Scripting");
+#endif
+        return cacheRoot / String(assembly->GetName()) + TEXT(".scan");
+    }
+
+    bool LoadScriptsScanCache(MAssembly* assembly, Array<MString>& scriptTypes, Array<MString>& moduleInitializers)
+    {
+        const String& assemblyPath = assembly->GetAssemblyPath();
+        if (assemblyPath.IsEmpty())
+            return true;
+        const String cachePath = GetScriptsScanCachePath(assembly);
+        Array<byte> data;
+        if (File::ReadAllBytes(cachePath, data) || data.IsEmpty())
+            return true;
+        MemoryReadStream stream(data.Get(), data.Count());
+
+        // Validate the cached data against the current assembly file
+        int32 version;
+        stream.ReadInt32(&version);
+        if (version != ScriptsScanCacheVersion)
+            return true;
+        int64 fileSize, fileEditTime;
+        stream.ReadInt64(&fileSize);
+        stream.ReadInt64(&fileEditTime);
+        if (fileSize != (int64)FileSystem::GetFileSize(assemblyPath) || fileEditTime != FileSystem::GetFileLastEditTime(assemblyPath).Ticks)
+            return true;
+
+        int32 count;
+        stream.ReadInt32(&count);
+        if (count < 0 || count > 1000000)
+            return true;
+        scriptTypes.Resize(count);
+        for (int32 i = 0; i < count; i++)
+            stream.ReadStringAnsi(&scriptTypes[i], 71);
+        stream.ReadInt32(&count);
+        if (count < 0 || count > 1000000)
+            return true;
+        moduleInitializers.Resize(count);
+        for (int32 i = 0; i < count; i++)
+            stream.ReadStringAnsi(&moduleInitializers[i], 71);
+        return false;
+    }
+
+    void SaveScriptsScanCache(MAssembly* assembly, const Array<MString>& scriptTypes, const Array<MString>& moduleInitializers)
+    {
+        const String& assemblyPath = assembly->GetAssemblyPath();
+        if (assemblyPath.IsEmpty())
+            return;
+        MemoryWriteStream stream(1024);
+        stream.WriteInt32(ScriptsScanCacheVersion);
+        stream.WriteInt64((int64)FileSystem::GetFileSize(assemblyPath));
+        stream.WriteInt64(FileSystem::GetFileLastEditTime(assemblyPath).Ticks);
+        stream.WriteInt32(scriptTypes.Count());
+        for (const MString& e : scriptTypes)
+            stream.WriteStringAnsi(e, 71);
+        stream.WriteInt32(moduleInitializers.Count());
+        for (const MString& e : moduleInitializers)
+            stream.WriteStringAnsi(e, 71);
+        const String cachePath = GetScriptsScanCachePath(assembly);
+        const String cacheFolder = String(StringUtils::GetDirectoryName(cachePath));
+        if (!FileSystem::DirectoryExists(cacheFolder))
+            FileSystem::CreateDirectory(cacheFolder);
+        if (stream.SaveToFile(cachePath))
+        {
+            LOG(Warning, "Failed to save the assembly scan cache to \'{0}\'", cachePath);
+        }
+    }
+}
+
+#endif
+
 void ManagedBinaryModule::OnLoaded(MAssembly* assembly)
 {
 #if !COMPILE_WITHOUT_CSHARP
@@ -938,34 +1027,46 @@ void ManagedBinaryModule::OnLoaded(MAssembly* assembly)
     NativeBinaryModule* flaxEngine = (NativeBinaryModule*)GetBinaryModuleFlaxEngine();
     if (flaxEngine->Assembly->IsLoaded())
     {
-        // TODO: check only assemblies that references FlaxEngine.CSharp.dll
-        MClass* scriptingObjectType = this == flaxEngine ? classes["FlaxEngine.Object"] : ScriptingObject::GetStaticClass();
-        for (auto i = classes.Begin(); i.IsNotEnd(); ++i)
-        {
-            MClass* mclass = i->Value;
+        // Try to reuse the reflection scan results from the previous run so startup can skip walking over every class in the assembly.
+        // The cache stores class names only (runtime handles cannot be persisted) and is invalidated by the assembly file size and timestamp.
+        Array<MString> cachedScriptTypes, cachedModuleInitializers;
+        const bool hasScanCache = !LoadScriptsScanCache(assembly, cachedScriptTypes, cachedModuleInitializers);
 
-            // Check if C# class inherits from C++ object class it has no C++ representation
-            if (mclass->IsStatic() ||
-                mclass->IsInterface() ||
-                !mclass->IsSubClassOf(scriptingObjectType)
-            )
+        if (hasScanCache)
+        {
+            for (const MString& name : cachedScriptTypes)
             {
-                continue;
+                MClass* mclass;
+                if (classes.TryGet(name, mclass))
+                    InitType(mclass);
             }
+        }
+        else
+        {
+            // TODO: check only assemblies that references FlaxEngine.CSharp.dll
+            MClass* scriptingObjectType = this == flaxEngine ? classes["FlaxEngine.Object"] : ScriptingObject::GetStaticClass();
+            for (auto i = classes.Begin(); i.IsNotEnd(); ++i)
+            {
+                MClass* mclass = i->Value;
 
-            InitType(mclass);
+                // Check if C# class inherits from C++ object class it has no C++ representation
+                if (mclass->IsStatic() ||
+                    mclass->IsInterface() ||
+                    !mclass->IsSubClassOf(scriptingObjectType)
+                )
+                {
+                    continue;
+                }
+
+                cachedScriptTypes.Add(mclass->GetFullName());
+                InitType(mclass);
+            }
         }
-    }
 
-    // Invoke module initializers
-    if (flaxEngine->Assembly->IsLoaded() && this != flaxEngine)
-    {
-        const MClass* attribute = flaxEngine->Assembly->GetClass("FlaxEngine.ModuleInitializerAttribute");
-        ASSERT_LOW_LAYER(attribute);
-        for (auto i = classes.Begin(); i.IsNotEnd(); ++i)
+        // Invoke module initializers
+        if (this != flaxEngine)
         {
-            MClass* mclass = i->Value;
-            if (mclass->IsStatic() && !mclass->IsInterface() && mclass->HasAttribute(attribute))
+            const auto invokeInitializers = [](MClass* mclass)
             {
                 const auto& methods = mclass->GetMethods();
                 for (const MMethod* method : methods)
@@ -975,8 +1076,34 @@ void ManagedBinaryModule::OnLoaded(MAssembly* assembly)
                         method->Invoke(nullptr, nullptr, nullptr);
                     }
                 }
+            };
+            if (hasScanCache)
+            {
+                for (const MString& name : cachedModuleInitializers)
+                {
+                    MClass* mclass;
+                    if (classes.TryGet(name, mclass))
+                        invokeInitializers(mclass);
+                }
+            }
+            else
+            {
+                const MClass* attribute = flaxEngine->Assembly->GetClass("FlaxEngine.ModuleInitializerAttribute");
+                ASSERT_LOW_LAYER(attribute);
+                for (auto i = classes.Begin(); i.IsNotEnd(); ++i)
+                {
+                    MClass* mclass = i->Value;
+                    if (mclass->IsStatic() && !mclass->IsInterface() && mclass->HasAttribute(attribute))
+                    {
+                        cachedModuleInitializers.Add(mclass->GetFullName());
+                        invokeInitializers(mclass);
+                    }
+                }
             }
         }
+
+        if (!hasScanCache)
+            SaveScriptsScanCache(assembly, cachedScriptTypes, cachedModuleInitializers);
     }
 #endif
 }
@@ -1,6 +1,7 @@
 // Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
 
 #include "Script.h"
+#include "BinaryModule.h"
 #include "Engine/Core/Log.h"
 #if USE_EDITOR
 #include "StdTypesContainer.h"
@@ -26,6 +27,9 @@ Script::Script(const SpawnParams& params)
     , _tickFixedUpdate(false)
     , _tickUpdate(false)
     , _tickLateUpdate(false)
+    , _tickFixedUpdateManaged(false)
+    , _tickUpdateManaged(false)
+    , _tickLateUpdateManaged(false)
     , _wasStartCalled(false)
     , _wasEnableCalled(false)
 {
@@ -178,9 +182,23 @@ void Script::SetupType()
         auto& type = typeHandle.GetType();
         if (type.Script.ScriptVTable)
         {
-            _tickUpdate |= type.Script.ScriptVTable[8] != nullptr;
-            _tickLateUpdate |= type.Script.ScriptVTable[9] != nullptr;
-            _tickFixedUpdate |= type.Script.ScriptVTable[10] != nullptr;
+            // Methods overriden in C# are invoked in a single batch within the managed runtime (see SceneTicking)
+            const int32 isManaged = type.Script.Spawn == &ManagedBinaryModule::ManagedObjectSpawn ? 1 : 0;
+            if (!_tickUpdate && type.Script.ScriptVTable[8] != nullptr)
+            {
+                _tickUpdate = 1;
+                _tickUpdateManaged = isManaged;
+            }
+            if (!_tickLateUpdate && type.Script.ScriptVTable[9] != nullptr)
+            {
+                _tickLateUpdate = 1;
+                _tickLateUpdateManaged = isManaged;
+            }
+            if (!_tickFixedUpdate && type.Script.ScriptVTable[10] != nullptr)
+            {
+                _tickFixedUpdate = 1;
+                _tickFixedUpdateManaged = isManaged;
+            }
         }
         typeHandle = type.GetBaseType();
     }
@@ -306,6 +324,7 @@ void Script::Serialize(SerializeStream& stream, const void* otherObj)
     SERIALIZE_GET_OTHER_OBJ(Script);
 
     SERIALIZE_BIT_MEMBER(Enabled, _enabled);
+    SERIALIZE(TickFrequency);
 }
 
 void Script::Deserialize(DeserializeStream& stream, ISerializeModifier* modifier)
@@ -314,6 +333,7 @@ void Script::Deserialize(DeserializeStream& stream, ISerializeModifier* modifier
     SceneObject::Deserialize(stream, modifier);
 
     DESERIALIZE_BIT_MEMBER(Enabled, _enabled);
+    DESERIALIZE(TickFrequency);
     DESERIALIZE_MEMBER(PrefabID, _prefabID);
 
     {
@@ -331,11 +351,14 @@ void Script::Deserialize(DeserializeStream& stream, ISerializeModifier* modifier
                 }
                 else
                 {
+                    // Scene objects can deserialize on multiple threads at once during loading so guard the hierarchy changes
+                    Level::ScenesLock.Lock();
                     if (_parent)
                         _parent->Scripts.RemoveKeepOrder(this);
                     _parent = parent;
                     if (_parent)
                         _parent->Scripts.Add(this);
+                    Level::ScenesLock.Unlock();
                 }
             }
             else if (!parent && parentId.IsValid())
@@ -1,5 +1,7 @@
 // Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
 
+using System;
+
 namespace FlaxEngine
 {
     partial class Script
@@ -36,5 +38,57 @@ namespace FlaxEngine
             get => Actor.LocalTransform;
             set => Actor.LocalTransform = value;
         }
+
+        /// <summary>
+        /// Called every frame if object is enabled.
+        /// </summary>
+        [NoAnimate]
+        public virtual void OnUpdate()
+        {
+        }
+
+        /// <summary>
+        /// Called every frame (after gameplay Update) if object is enabled.
+        /// </summary>
+        [NoAnimate]
+        public virtual void OnLateUpdate()
+        {
+        }
+
+        /// <summary>
+        /// Called every fixed framerate frame if object is enabled.
+        /// </summary>
+        [NoAnimate]
+        public virtual void OnFixedUpdate()
+        {
+        }
+
+        // Invokes the tick methods overriden in C# for a batch of scripts within a single native call (tick values match SceneTicking)
+        internal static void Internal_BatchTick(Script[] scripts, int count, int tick)
+        {
+            for (int i = 0; i < count; i++)
+            {
+                var script = scripts[i];
+                try
+                {
+                    switch (tick)
+                    {
+                    case 0:
+                        script.OnFixedUpdate();
+                        break;
+                    case 1:
+                        script.OnUpdate();
+                        break;
+                    case 2:
+                        script.OnLateUpdate();
+                        break;
+                    }
+                }
+                catch (Exception ex)
+                {
+                    Debug.LogException(ex, script);
+                }
+            }
+        }
     }
 }
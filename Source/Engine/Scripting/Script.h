@@ -5,6 +5,32 @@
 #include "Engine/Level/SceneObject.h"
 #include "ScriptingObject.h"
 
+/// <summary>
+/// The script ticking frequency groups. Low-frequency groups reduce the per-frame cost of logic that doesn't need to run every frame; their ticks are staggered across frames so they don't burst on the same frame.
+/// </summary>
+API_ENUM() enum class ScriptTickFrequency
+{
+    /// <summary>
+    /// Ticks every frame (default).
+    /// </summary>
+    EveryFrame = 0,
+
+    /// <summary>
+    /// Ticks around 15 times per second.
+    /// </summary>
+    Hz15 = 1,
+
+    /// <summary>
+    /// Ticks around 2 times per second.
+    /// </summary>
+    Hz2 = 2,
+
+    /// <summary>
+    /// Never ticks automatically. Call the update methods manually when needed.
+    /// </summary>
+    OnDemand = 3,
+};
+
 /// <summary>
 /// Base class for all scripts.
 /// </summary>
@@ -19,13 +45,24 @@ protected:
     int32 _tickFixedUpdate : 1;
     int32 _tickUpdate : 1;
     int32 _tickLateUpdate : 1;
+    int32 _tickFixedUpdateManaged : 1;
+    int32 _tickUpdateManaged : 1;
+    int32 _tickLateUpdateManaged : 1;
     int32 _wasStartCalled : 1;
     int32 _wasEnableCalled : 1;
 #if USE_EDITOR
     int32 _executeInEditor : 1;
 #endif
+    float _nextTickTime = 0.0f;
+    uint32 _tickFrame = MAX_uint32;
 
 public:
+    /// <summary>
+    /// The ticking frequency group for OnUpdate and OnLateUpdate. Scripts in the low-frequency groups are updated at a reduced rate with the ticks spread evenly across frames; OnFixedUpdate always runs at the physics rate. Changing the value takes effect on the next update.
+    /// </summary>
+    API_FIELD(Attributes="EditorDisplay(\"Script\"), DefaultValue(ScriptTickFrequency.EveryFrame), EditorOrder(-90)")
+    ScriptTickFrequency TickFrequency = ScriptTickFrequency::EveryFrame;
+
     /// <summary>
     /// Gets value indicating if script is active.
     /// </summary>
@@ -90,21 +127,21 @@ public:
     /// <summary>
     /// Called every frame if object is enabled.
     /// </summary>
-    API_FUNCTION(Attributes="NoAnimate") virtual void OnUpdate()
+    API_FUNCTION(NoProxy, Attributes="NoAnimate") virtual void OnUpdate()
     {
     }
 
     /// <summary>
     /// Called every frame (after gameplay Update) if object is enabled.
     /// </summary>
-    API_FUNCTION(Attributes="NoAnimate") virtual void OnLateUpdate()
+    API_FUNCTION(NoProxy, Attributes="NoAnimate") virtual void OnLateUpdate()
     {
     }
 
     /// <summary>
     /// Called every fixed framerate frame if object is enabled.
     /// </summary>
-    API_FUNCTION(Attributes="NoAnimate") virtual void OnFixedUpdate()
+    API_FUNCTION(NoProxy, Attributes="NoAnimate") virtual void OnFixedUpdate()
     {
     }
 
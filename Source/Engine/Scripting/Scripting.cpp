@@ -24,6 +24,7 @@
 #include "Engine/Core/ObjectsRemovalService.h"
 #include "Engine/Core/Types/TimeSpan.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/ProfilerMemory.h"
 #include "Engine/Content/Asset.h"
 #include "Engine/Content/Content.h"
 #include "Engine/Engine/EngineService.h"
@@ -58,7 +59,6 @@ namespace
 {
     MDomain* _rootDomain = nullptr;
     MDomain* _scriptsDomain = nullptr;
-    CriticalSection _objectsLocker;
 #define USE_OBJECTS_DISPOSE_CRASHES_DEBUGGING 0
 #if USE_OBJECTS_DISPOSE_CRASHES_DEBUGGING
     struct ScriptingObjectData
@@ -94,10 +94,30 @@ namespace
         }
     };
 
-    Dictionary<Guid, ScriptingObjectData> _objectsDictionary(1024 * 16);
+    typedef Dictionary<Guid, ScriptingObjectData> ObjectsDictionary;
 #else
-    Dictionary<Guid, ScriptingObject*> _objectsDictionary(1024 * 16);
+    typedef Dictionary<Guid, ScriptingObject*> ObjectsDictionary;
 #endif
+
+    // Objects registry sharded by the ID hash so cross-thread lookups contend only within a shard (job-parallel gameplay code resolves thousands of object references per frame)
+#define OBJECTS_REGISTRY_SHARDS 64
+    struct ObjectsRegistryShard
+    {
+        CriticalSection Locker;
+        ObjectsDictionary Objects;
+
+        ObjectsRegistryShard()
+            : Objects(1024 * 16 / OBJECTS_REGISTRY_SHARDS)
+        {
+        }
+    };
+
+    ObjectsRegistryShard _objectsRegistry[OBJECTS_REGISTRY_SHARDS];
+
+    FORCE_INLINE ObjectsRegistryShard& GetObjectsShard(const Guid& id)
+    {
+        return _objectsRegistry[GetHash(id) & (OBJECTS_REGISTRY_SHARDS - 1)];
+    }
     bool _isEngineAssemblyLoaded = false;
     bool _hasGameModulesLoaded = false;
     MMethod* _method_Update = nullptr;
@@ -198,6 +218,7 @@ bool ScriptingService::Init()
 void ScriptingService::Update()
 {
     PROFILE_CPU_NAMED("Scripting::Update");
+    PROFILE_MEM_TAG("Scripting");
 
     INVOKE_EVENT(Update);
 }
@@ -205,6 +226,7 @@ void ScriptingService::Update()
 void ScriptingService::LateUpdate()
 {
     PROFILE_CPU_NAMED("Scripting::LateUpdate");
+    PROFILE_MEM_TAG("Scripting");
 
     INVOKE_EVENT(LateUpdate);
 }
@@ -212,6 +234,7 @@ void ScriptingService::LateUpdate()
 void ScriptingService::FixedUpdate()
 {
     PROFILE_CPU_NAMED("Scripting::FixedUpdate");
+    PROFILE_MEM_TAG("Scripting");
 
     INVOKE_EVENT(FixedUpdate);
 }
@@ -505,9 +528,10 @@ void Scripting::Release()
     MCore::GC::WaitForPendingFinalizers();
 
     // Release managed objects instances for persistent objects (assets etc.)
-    _objectsLocker.Lock();
+    for (auto& shard : _objectsRegistry)
     {
-        for (auto i = _objectsDictionary.Begin(); i.IsNotEnd(); ++i)
+        ScopeLock lock(shard.Locker);
+        for (auto i = shard.Objects.Begin(); i.IsNotEnd(); ++i)
         {
             auto obj = i->Value;
 #if USE_OBJECTS_DISPOSE_CRASHES_DEBUGGING
@@ -516,7 +540,6 @@ void Scripting::Release()
             obj->OnScriptingDispose();
         }
     }
-    _objectsLocker.Unlock();
 
     // Unload assemblies (from back to front)
     {
@@ -599,22 +622,24 @@ void Scripting::Reload(bool canTriggerSceneReload)
     MCore::GC::WaitForPendingFinalizers();
 
     // Destroy objects from game assemblies (eg. not released objects that might crash if persist in memory after reload)
-    _objectsLocker.Lock();
     {
         const auto flaxModule = GetBinaryModuleFlaxEngine();
-        for (auto i = _objectsDictionary.Begin(); i.IsNotEnd(); ++i)
+        for (auto& shard : _objectsRegistry)
         {
-            auto obj = i->Value;
-            if (obj->GetTypeHandle().Module == flaxModule)
-                continue;
+            ScopeLock lock(shard.Locker);
+            for (auto i = shard.Objects.Begin(); i.IsNotEnd(); ++i)
+            {
+                auto obj = i->Value;
+                if (obj->GetTypeHandle().Module == flaxModule)
+                    continue;
 
 #if USE_OBJECTS_DISPOSE_CRASHES_DEBUGGING
-            LOG(Info, "[OnScriptingDispose] obj = 0x{0:x}, {1}", (uint64)obj.Ptr, String(obj.TypeName));
+                LOG(Info, "[OnScriptingDispose] obj = 0x{0:x}, {1}", (uint64)obj.Ptr, String(obj.TypeName));
 #endif
-            obj->OnScriptingDispose();
+                obj->OnScriptingDispose();
+            }
         }
     }
-    _objectsLocker.Unlock();
 
     // Unload all game modules
     LOG(Info, "Unloading game binary modules");
@@ -799,17 +824,18 @@ ScriptingObject* Scripting::FindObject(Guid id, MClass* type)
     }
 
     // Try to find it
+    auto& shard = GetObjectsShard(id);
 #if USE_OBJECTS_DISPOSE_CRASHES_DEBUGGING
     ScriptingObjectData data;
-    _objectsLocker.Lock();
-    _objectsDictionary.TryGet(id, data);
-    _objectsLocker.Unlock();
+    shard.Locker.Lock();
+    shard.Objects.TryGet(id, data);
+    shard.Locker.Unlock();
     auto result = data.Ptr;
 #else
     ScriptingObject* result = nullptr;
-    _objectsLocker.Lock();
-    _objectsDictionary.TryGet(id, result);
-    _objectsLocker.Unlock();
+    shard.Locker.Lock();
+    shard.Objects.TryGet(id, result);
+    shard.Locker.Unlock();
 #endif
     if (result)
     {
@@ -853,17 +879,18 @@ ScriptingObject* Scripting::TryFindObject(Guid id, MClass* type)
     }
 
     // Try to find it
+    auto& shard = GetObjectsShard(id);
 #if USE_OBJECTS_DISPOSE_CRASHES_DEBUGGING
     ScriptingObjectData data;
-    _objectsLocker.Lock();
-    _objectsDictionary.TryGet(id, data);
-    _objectsLocker.Unlock();
+    shard.Locker.Lock();
+    shard.Objects.TryGet(id, data);
+    shard.Locker.Unlock();
     auto result = data.Ptr;
 #else
     ScriptingObject* result = nullptr;
-    _objectsLocker.Lock();
-    _objectsDictionary.TryGet(id, result);
-    _objectsLocker.Unlock();
+    shard.Locker.Lock();
+    shard.Objects.TryGet(id, result);
+    shard.Locker.Unlock();
 #endif
 
     // Check type
@@ -879,12 +906,15 @@ ScriptingObject* Scripting::TryFindObject(MClass* mclass)
 {
     if (mclass == nullptr)
         return nullptr;
-    ScopeLock lock(_objectsLocker);
-    for (auto i = _objectsDictionary.Begin(); i.IsNotEnd(); ++i)
+    for (auto& shard : _objectsRegistry)
     {
-        const auto obj = i->Value;
-        if (obj->GetClass() == mclass)
-            return obj;
+        ScopeLock lock(shard.Locker);
+        for (auto i = shard.Objects.Begin(); i.IsNotEnd(); ++i)
+        {
+            const auto obj = i->Value;
+            if (obj->GetClass() == mclass)
+                return obj;
+        }
     }
     return nullptr;
 }
@@ -897,13 +927,15 @@ ScriptingObject* Scripting::FindObject(const MObject* managedInstance)
 
     // TODO: optimize it by reading the unmanagedPtr or _internalId from managed Object property
 
-    ScopeLock lock(_objectsLocker);
-
-    for (auto i = _objectsDictionary.Begin(); i.IsNotEnd(); ++i)
+    for (auto& shard : _objectsRegistry)
     {
-        const auto obj = i->Value;
-        if (obj->GetManagedInstance() == managedInstance)
-            return obj;
+        ScopeLock lock(shard.Locker);
+        for (auto i = shard.Objects.Begin(); i.IsNotEnd(); ++i)
+        {
+            const auto obj = i->Value;
+            if (obj->GetManagedInstance() == managedInstance)
+                return obj;
+        }
     }
     return nullptr;
 }
@@ -913,9 +945,10 @@ void Scripting::OnManagedInstanceDeleted(ScriptingObject* obj)
     PROFILE_CPU();
     ASSERT(obj);
 
-    // Validate if object still exists
-    _objectsLocker.Lock();
-    if (_objectsDictionary.ContainsValue(obj))
+    // Validate if object still exists (registry keys objects by the current ID so a pointer match within its shard is equivalent to the old whole-registry value scan)
+    auto& shard = GetObjectsShard(obj->GetID());
+    shard.Locker.Lock();
+    if (shard.Objects.ContainsValue(obj))
     {
 #if USE_OBJECTS_DISPOSE_CRASHES_DEBUGGING
         LOG(Info, "[OnManagedInstanceDeleted] obj = 0x{0:x}, {1}", (uint64)obj, String(ScriptingObjectData(obj).TypeName));
@@ -926,7 +959,7 @@ void Scripting::OnManagedInstanceDeleted(ScriptingObject* obj)
     {
         //LOG(Warning, "Object finalization called for already removed object (address={0:x})", (uint64)obj);
     }
-    _objectsLocker.Unlock();
+    shard.Locker.Unlock();
 }
 
 bool Scripting::HasGameModulesLoaded()
@@ -953,56 +986,71 @@ bool Scripting::IsTypeFromGameScripts(MClass* type)
 
 void Scripting::RegisterObject(ScriptingObject* obj)
 {
-    ScopeLock lock(_objectsLocker);
+    auto& shard = GetObjectsShard(obj->GetID());
+    ScopeLock lock(shard.Locker);
 
-    //ASSERT(!_objectsDictionary.ContainsValue(obj));
+    //ASSERT(!shard.Objects.ContainsValue(obj));
 #if ENABLE_ASSERTION
 #if USE_OBJECTS_DISPOSE_CRASHES_DEBUGGING
     ScriptingObjectData other;
-    if (_objectsDictionary.TryGet(obj->GetID(), other))
+    if (shard.Objects.TryGet(obj->GetID(), other))
 #else
     ScriptingObject* other;
-    if (_objectsDictionary.TryGet(obj->GetID(), other))
+    if (shard.Objects.TryGet(obj->GetID(), other))
 #endif
     {
         // Something went wrong...
         LOG(Error, "Objects registry already contains object with ID={0} (type '{3}')! Trying to register object {1} (type '{2}').", obj->GetID(), obj->ToString(), String(obj->GetClass()->GetFullName()), String(other->GetClass()->GetFullName()));
-        _objectsDictionary.Remove(obj->GetID());
+        shard.Objects.Remove(obj->GetID());
     }
 #else
-	ASSERT(!_objectsDictionary.ContainsKey(obj->_id));
+	ASSERT(!shard.Objects.ContainsKey(obj->_id));
 #endif
 
 #if USE_OBJECTS_DISPOSE_CRASHES_DEBUGGING
     LOG(Info, "[RegisterObject] obj = 0x{0:x}, {1}", (uint64)obj, String(ScriptingObjectData(obj).TypeName));
 #endif
-    _objectsDictionary.Add(obj->GetID(), obj);
+    shard.Objects.Add(obj->GetID(), obj);
 }
 
 void Scripting::UnregisterObject(ScriptingObject* obj)
 {
-    ScopeLock lock(_objectsLocker);
+    auto& shard = GetObjectsShard(obj->GetID());
+    ScopeLock lock(shard.Locker);
 
-    //ASSERT(!obj->_id.IsValid() || _objectsDictionary.ContainsValue(obj));
+    //ASSERT(!obj->_id.IsValid() || shard.Objects.ContainsValue(obj));
 
 #if USE_OBJECTS_DISPOSE_CRASHES_DEBUGGING
     LOG(Info, "[UnregisterObject] obj = 0x{0:x}, {1}", (uint64)obj, String(ScriptingObjectData(obj).TypeName));
 #endif
-    _objectsDictionary.Remove(obj->GetID());
+    shard.Objects.Remove(obj->GetID());
 }
 
 void Scripting::OnObjectIdChanged(ScriptingObject* obj, const Guid& oldId)
 {
-    ScopeLock lock(_objectsLocker);
-
     ASSERT(obj && oldId.IsValid());
     ASSERT(obj->GetID() != oldId);
-    ASSERT(_objectsDictionary.ContainsKey(oldId));
-    //ASSERT(_objectsDictionary.ContainsValue(obj));
-    ASSERT(!_objectsDictionary.ContainsKey(obj->GetID()));
 
-    _objectsDictionary.Remove(oldId);
-    _objectsDictionary.Add(obj->GetID(), obj);
+    // Move the object between the shards (lock in a fixed order to avoid deadlock with a concurrent move the other way)
+    auto& oldShard = GetObjectsShard(oldId);
+    auto& newShard = GetObjectsShard(obj->GetID());
+    if (&oldShard == &newShard)
+    {
+        ScopeLock lock(oldShard.Locker);
+        ASSERT(oldShard.Objects.ContainsKey(oldId));
+        ASSERT(!newShard.Objects.ContainsKey(obj->GetID()));
+        oldShard.Objects.Remove(oldId);
+        newShard.Objects.Add(obj->GetID(), obj);
+    }
+    else
+    {
+        ScopeLock lock0(&oldShard < &newShard ? oldShard.Locker : newShard.Locker);
+        ScopeLock lock1(&oldShard < &newShard ? newShard.Locker : oldShard.Locker);
+        ASSERT(oldShard.Objects.ContainsKey(oldId));
+        ASSERT(!newShard.Objects.ContainsKey(obj->GetID()));
+        oldShard.Objects.Remove(oldId);
+        newShard.Objects.Add(obj->GetID(), obj);
+    }
 }
 
 bool initFlaxEngine()
@@ -0,0 +1,291 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "BinaryJson.h"
+#include "Json.h"
+#include "ReadStream.h"
+#include "WriteStream.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Collections/Dictionary.h"
+
+// Document layout: [magic: uint32][version: int32][strings count: int32][strings: int32 length + utf8 chars][values tree]
+#define BINARY_JSON_MAGIC 0x4E534A42 // 'BJSN'
+#define BINARY_JSON_VERSION 1
+
+namespace
+{
+    enum class ValueToken : byte
+    {
+        Null = 0,
+        False = 1,
+        True = 2,
+        Int = 3,
+        Uint = 4,
+        Int64 = 5,
+        Uint64 = 6,
+        Double = 7,
+        String = 8,
+        Array = 9,
+        Object = 10,
+    };
+
+    void CollectStrings(const rapidjson_flax::Value& value, Dictionary<StringAnsiView, int32>& table)
+    {
+        switch (value.GetType())
+        {
+        case rapidjson::kObjectType:
+            for (auto i = value.MemberBegin(); i != value.MemberEnd(); ++i)
+            {
+                const StringAnsiView name(i->name.GetString(), (int32)i->name.GetStringLength());
+                if (!table.ContainsKey(name))
+                    table.Add(name, table.Count());
+                CollectStrings(i->value, table);
+            }
+            break;
+        case rapidjson::kArrayType:
+            for (rapidjson::SizeType i = 0; i < value.Size(); i++)
+                CollectStrings(value[i], table);
+            break;
+        case rapidjson::kStringType:
+        {
+            const StringAnsiView str(value.GetString(), (int32)value.GetStringLength());
+            if (!table.ContainsKey(str))
+                table.Add(str, table.Count());
+            break;
+        }
+        default:
+            break;
+        }
+    }
+
+    void WriteValue(WriteStream& stream, const rapidjson_flax::Value& value, const Dictionary<StringAnsiView, int32>& table)
+    {
+        switch (value.GetType())
+        {
+        case rapidjson::kNullType:
+            stream.WriteByte((byte)ValueToken::Null);
+            break;
+        case rapidjson::kFalseType:
+            stream.WriteByte((byte)ValueToken::False);
+            break;
+        case rapidjson::kTrueType:
+            stream.WriteByte((byte)ValueToken::True);
+            break;
+        case rapidjson::kNumberType:
+            if (value.IsInt())
+            {
+                stream.WriteByte((byte)ValueToken::Int);
+                stream.WriteInt32(value.GetInt());
+            }
+            else if (value.IsUint())
+            {
+                stream.WriteByte((byte)ValueToken::Uint);
+                stream.WriteUint32(value.GetUint());
+            }
+            else if (value.IsInt64())
+            {
+                stream.WriteByte((byte)ValueToken::Int64);
+                stream.WriteInt64(value.GetInt64());
+            }
+            else if (value.IsUint64())
+            {
+                stream.WriteByte((byte)ValueToken::Uint64);
+                stream.WriteUint64(value.GetUint64());
+            }
+            else
+            {
+                stream.WriteByte((byte)ValueToken::Double);
+                stream.WriteDouble(value.GetDouble());
+            }
+            break;
+        case rapidjson::kStringType:
+            stream.WriteByte((byte)ValueToken::String);
+            stream.WriteInt32(table[StringAnsiView(value.GetString(), (int32)value.GetStringLength())]);
+            break;
+        case rapidjson::kArrayType:
+            stream.WriteByte((byte)ValueToken::Array);
+            stream.WriteInt32((int32)value.Size());
+            for (rapidjson::SizeType i = 0; i < value.Size(); i++)
+                WriteValue(stream, value[i], table);
+            break;
+        case rapidjson::kObjectType:
+            stream.WriteByte((byte)ValueToken::Object);
+            stream.WriteInt32((int32)value.MemberCount());
+            for (auto i = value.MemberBegin(); i != value.MemberEnd(); ++i)
+            {
+                stream.WriteInt32(table[StringAnsiView(i->name.GetString(), (int32)i->name.GetStringLength())]);
+                WriteValue(stream, i->value, table);
+            }
+            break;
+        }
+    }
+
+    bool ReadValue(ReadStream& stream, rapidjson_flax::Value& value, rapidjson_flax::Document::AllocatorType& allocator, const Array<StringAnsiView>& strings)
+    {
+        byte token;
+        stream.ReadByte(&token);
+        switch ((ValueToken)token)
+        {
+        case ValueToken::Null:
+            value.SetNull();
+            break;
+        case ValueToken::False:
+            value.SetBool(false);
+            break;
+        case ValueToken::True:
+            value.SetBool(true);
+            break;
+        case ValueToken::Int:
+        {
+            int32 v;
+            stream.ReadInt32(&v);
+            value.SetInt(v);
+            break;
+        }
+        case ValueToken::Uint:
+        {
+            uint32 v;
+            stream.ReadUint32(&v);
+            value.SetUint(v);
+            break;
+        }
+        case ValueToken::Int64:
+        {
+            int64 v;
+            stream.ReadInt64(&v);
+            value.SetInt64(v);
+            break;
+        }
+        case ValueToken::Uint64:
+        {
+            uint64 v;
+            stream.ReadUint64(&v);
+            value.SetUint64(v);
+            break;
+        }
+        case ValueToken::Double:
+        {
+            double v;
+            stream.ReadDouble(&v);
+            value.SetDouble(v);
+            break;
+        }
+        case ValueToken::String:
+        {
+            int32 index;
+            stream.ReadInt32(&index);
+            if (index < 0 || index >= strings.Count())
+                return true;
+            const StringAnsiView& str = strings[index];
+            value.SetString(rapidjson::StringRef(str.Get(), str.Length()));
+            break;
+        }
+        case ValueToken::Array:
+        {
+            int32 count;
+            stream.ReadInt32(&count);
+            if (count < 0 || (uint32)count > stream.GetLength() - stream.GetPosition())
+                return true;
+            value.SetArray();
+            value.Reserve((rapidjson::SizeType)count, allocator);
+            for (int32 i = 0; i < count; i++)
+            {
+                rapidjson_flax::Value child;
+                if (ReadValue(stream, child, allocator, strings))
+                    return true;
+                value.PushBack(child, allocator);
+            }
+            break;
+        }
+        case ValueToken::Object:
+        {
+            int32 count;
+            stream.ReadInt32(&count);
+            if (count < 0 || (uint32)count > stream.GetLength() - stream.GetPosition())
+                return true;
+            value.SetObject();
+            for (int32 i = 0; i < count; i++)
+            {
+                int32 nameIndex;
+                stream.ReadInt32(&nameIndex);
+                if (nameIndex < 0 || nameIndex >= strings.Count())
+                    return true;
+                const StringAnsiView& name = strings[nameIndex];
+                rapidjson_flax::Value key(rapidjson::StringRef(name.Get(), name.Length()));
+                rapidjson_flax::Value child;
+                if (ReadValue(stream, child, allocator, strings))
+                    return true;
+                value.AddMember(key, child, allocator);
+            }
+            break;
+        }
+        default:
+            return true;
+        }
+        return false;
+    }
+}
+
+bool BinaryJson::IsBinaryJson(const void* data, uint32 length)
+{
+    return data && length >= sizeof(uint32) && *(const uint32*)data == BINARY_JSON_MAGIC;
+}
+
+void BinaryJson::Serialize(WriteStream& stream, const ISerializable::DeserializeStream& value)
+{
+    // Header
+    stream.WriteUint32(BINARY_JSON_MAGIC);
+    stream.WriteInt32(BINARY_JSON_VERSION);
+
+    // String table (all the member names and string values, deduplicated)
+    Dictionary<StringAnsiView, int32> table;
+    CollectStrings(value, table);
+    Array<StringAnsiView> strings;
+    strings.Resize(table.Count());
+    for (auto i = table.Begin(); i.IsNotEnd(); ++i)
+        strings[i->Value] = i->Key;
+    stream.WriteInt32(strings.Count());
+    for (const StringAnsiView& str : strings)
+    {
+        stream.WriteInt32(str.Length());
+        stream.WriteBytes(str.Get(), str.Length());
+    }
+
+    // Values tree
+    WriteValue(stream, value, table);
+}
+
+bool BinaryJson::Deserialize(ReadStream& stream, ISerializable::SerializeDocument& document)
+{
+    // Header
+    uint32 magic;
+    stream.ReadUint32(&magic);
+    if (magic != BINARY_JSON_MAGIC)
+        return true;
+    int32 version;
+    stream.ReadInt32(&version);
+    if (version != BINARY_JSON_VERSION)
+        return true;
+
+    // String table (strings memory is owned by the document so the values can reference it without copies)
+    auto& allocator = document.GetAllocator();
+    int32 stringsCount;
+    stream.ReadInt32(&stringsCount);
+    if (stringsCount < 0 || (uint32)stringsCount > stream.GetLength() - stream.GetPosition())
+        return true;
+    Array<StringAnsiView> strings;
+    strings.Resize(stringsCount);
+    for (int32 i = 0; i < stringsCount; i++)
+    {
+        int32 length;
+        stream.ReadInt32(&length);
+        if (length < 0 || (uint32)length > stream.GetLength() - stream.GetPosition())
+            return true;
+        char* str = (char*)allocator.Malloc(length + 1);
+        stream.ReadBytes(str, length);
+        str[length] = 0;
+        strings[i] = StringAnsiView(str, length);
+    }
+
+    // Values tree
+    return ReadValue(stream, document, allocator, strings);
+}
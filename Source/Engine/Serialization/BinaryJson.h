@@ -0,0 +1,38 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/ISerializable.h"
+
+class ReadStream;
+class WriteStream;
+
+/// <summary>
+/// The cooked binary form of the json documents. Stores the parsed document structure directly (member names tokenized via a string table, numbers as raw little-endian values) so the game can rebuild the document without json text parsing. Used for the cooked game content, while the editor keeps the plain json files.
+/// </summary>
+class FLAXENGINE_API BinaryJson
+{
+public:
+    /// <summary>
+    /// Checks if the given data buffer starts with the binary json document header.
+    /// </summary>
+    /// <param name="data">The data buffer.</param>
+    /// <param name="length">The data buffer length (in bytes).</param>
+    /// <returns>True if data contains the binary json document, otherwise false.</returns>
+    static bool IsBinaryJson(const void* data, uint32 length);
+
+    /// <summary>
+    /// Serializes the json value (including all child members) into the binary document form.
+    /// </summary>
+    /// <param name="stream">The output stream.</param>
+    /// <param name="value">The json value to serialize.</param>
+    static void Serialize(WriteStream& stream, const ISerializable::DeserializeStream& value);
+
+    /// <summary>
+    /// Deserializes the binary document form into the json document (without json text parsing).
+    /// </summary>
+    /// <param name="stream">The input stream.</param>
+    /// <param name="document">The output document. All strings are allocated within the document memory.</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    static bool Deserialize(ReadStream& stream, ISerializable::SerializeDocument& document);
+};
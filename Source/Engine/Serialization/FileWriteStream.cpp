@@ -98,13 +98,13 @@ void FileWriteStream::WriteBytes(const void* data, uint32 bytes)
             _hasError |= _file->Write(_buffer, FILESTREAM_BUFFER_SIZE, &bytesWritten) != 0;
         }
 
-        // Write as much as can using whole buffer
-        while (bytes >= FILESTREAM_BUFFER_SIZE)
+        // Write the bulk of the payload directly to the file as a single large extent (skips buffer-sized copies and write calls)
+        if (bytes >= FILESTREAM_BUFFER_SIZE)
         {
-            Platform::MemoryCopy(_buffer, data, FILESTREAM_BUFFER_SIZE);
-            data = (byte*)data + FILESTREAM_BUFFER_SIZE;
-            bytes -= FILESTREAM_BUFFER_SIZE;
-            _hasError |= _file->Write(_buffer, FILESTREAM_BUFFER_SIZE, &bytesWritten) != 0;
+            const uint32 directBytes = bytes - bytes % FILESTREAM_BUFFER_SIZE;
+            _hasError |= _file->Write(data, directBytes, &bytesWritten) != 0;
+            data = (byte*)data + directBytes;
+            bytes -= directBytes;
         }
 
         // Write the rest of the buffer but without flushing its data
@@ -4,6 +4,7 @@
 
 #include "ShaderCompilerD3D.h"
 #include "Engine/Core/Log.h"
+#include "Engine/Threading/Threading.h"
 #include "Engine/Serialization/MemoryWriteStream.h"
 #include "Engine/Graphics/Config.h"
 #include "Engine/GraphicsDevice/DirectX/IncludeDirectXHeaders.h"
@@ -220,21 +221,10 @@ bool ShaderCompilerD3D::CompileShader(ShaderFunctionMeta& meta, WritePermutation
         }
     }
 
-    // Compile all shader function permutations
-    for (int32 permutationIndex = 0; permutationIndex < meta.Permutations.Count(); permutationIndex++)
+    // Compile all shader function permutations in a batch (source is parsed once per permutation by D3DCompile but the front-end setup is shared and permutations run on the job system workers)
+    CriticalSection reflectLocker; // Guards the shared constant buffers usage cache (and debug info output)
+    return CompileShaderPermutations(meta, customDataWrite, [&](ShaderFunctionMeta& shaderMeta, ShaderPermutationData& permutation) -> bool
     {
-        _macros.Clear();
-
-        // Get function permutation macros
-        meta.GetDefinitionsForPermutation(permutationIndex, _macros);
-
-        // Add additional define for compiled function name
-        GetDefineForFunction(meta, _macros);
-
-        // Add custom and global macros (global last because contain null define to indicate ending)
-        _macros.Add(_context->Options->Macros);
-        _macros.Add(_globalMacros);
-
         // Compile
         ComPtr<ID3DBlob> errors;
         ComPtr<ID3DBlob> shader;
@@ -242,9 +232,9 @@ bool ShaderCompilerD3D::CompileShader(ShaderFunctionMeta& meta, WritePermutation
             options->Source,
             options->SourceLength,
             _context->TargetNameAnsi,
-            reinterpret_cast<const D3D_SHADER_MACRO*>(_macros.Get()),
+            reinterpret_cast<const D3D_SHADER_MACRO*>(permutation.Macros.Get()),
             &include,
-            meta.Name.Get(),
+            shaderMeta.Name.Get(),
             profileName.Get(),
             _flags,
             0,
@@ -280,16 +270,19 @@ bool ShaderCompilerD3D::CompileShader(ShaderFunctionMeta& meta, WritePermutation
 
         // Process shader reflection data
         ShaderBindings bindings = { desc.InstructionCount, 0, 0, 0 };
-        if (ProcessShader(_context, _constantBuffers, reflector.Get(), desc, bindings))
-            return true;
+        {
+            ScopeLock lock(reflectLocker);
+            if (ProcessShader(_context, _constantBuffers, reflector.Get(), desc, bindings))
+                return true;
 
 #ifdef GPU_USE_SHADERS_DEBUG_LAYER
 
-        // Generate debug information
-        if (ProcessDebugInfo(_context, meta, permutationIndex, shaderBuffer, shaderBufferSize))
-            return true;
+            // Generate debug information
+            if (ProcessDebugInfo(_context, shaderMeta, permutation.Index, shaderBuffer, shaderBufferSize))
+                return true;
 
 #endif
+        }
 
         // Strip shader bytecode for an optimization
         ComPtr<ID3DBlob> shaderStripped;
@@ -317,14 +310,10 @@ bool ShaderCompilerD3D::CompileShader(ShaderFunctionMeta& meta, WritePermutation
             //auto strippedBytesPercentage = Math::FloorToInt(strippedBytes * 100.0f / prevShaderBufferSize);
         }
 
-        if (WriteShaderFunctionPermutation(_context, meta, permutationIndex, bindings, shaderBuffer, shaderBufferSize))
-            return true;
-
-        if (customDataWrite && customDataWrite(_context, meta, permutationIndex, _macros))
-            return true;
-    }
-
-    return WriteShaderFunctionEnd(_context, meta);
+        permutation.Bindings = bindings;
+        permutation.Cache.WriteBytes(shaderBuffer, shaderBufferSize);
+        return false;
+    });
 }
 
 bool ShaderCompilerD3D::OnCompileBegin()
@@ -11,6 +11,7 @@
 #include "Engine/Graphics/RenderTools.h"
 #include "Engine/Graphics/Shaders/GPUShader.h"
 #include "Engine/Threading/Threading.h"
+#include "Engine/Threading/JobSystem.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Serialization/MemoryWriteStream.h"
 #include "Engine/Utilities/StringConverter.h"
@@ -337,6 +338,56 @@ bool ShaderCompiler::CompileShaders()
     return false;
 }
 
+bool ShaderCompiler::CompileShaderPermutations(ShaderFunctionMeta& meta, WritePermutationData customDataWrite, const Function<bool(ShaderFunctionMeta&, ShaderPermutationData&)>& compilePermutation)
+{
+    if (WriteShaderFunctionBegin(_context, meta))
+        return true;
+
+    // Shared front-end setup: build the full macros set for every permutation once
+    const int32 count = meta.Permutations.Count();
+    Array<ShaderPermutationData> permutations;
+    permutations.Resize(count);
+    for (int32 i = 0; i < count; i++)
+    {
+        auto& permutation = permutations[i];
+        permutation.Index = i;
+
+        // Get function permutation macros
+        meta.GetDefinitionsForPermutation(i, permutation.Macros);
+
+        // Add additional define for compiled function name
+        GetDefineForFunction(meta, permutation.Macros);
+
+        // Add custom and global macros (global last because contain null define to indicate ending)
+        permutation.Macros.Add(_context->Options->Macros);
+        permutation.Macros.Add(_globalMacros);
+    }
+
+    // Compile the permutations across the job system workers (permutations dominate material-heavy rebuilds)
+    volatile int64 anyFailed = 0;
+    JobSystem::ParallelFor(0, count, 1, [&](int32 begin, int32 end)
+    {
+        for (int32 i = begin; i < end; i++)
+        {
+            if (compilePermutation(meta, permutations[i]))
+                Platform::InterlockedIncrement(&anyFailed);
+        }
+    });
+    if (Platform::AtomicRead(&anyFailed) != 0)
+        return true;
+
+    // Write the results to the output in the permutations order
+    for (int32 i = 0; i < count; i++)
+    {
+        auto& permutation = permutations[i];
+        if (WriteShaderFunctionPermutation(_context, meta, i, permutation.Bindings, permutation.Cache.GetHandle(), permutation.Cache.GetPosition()))
+            return true;
+        if (customDataWrite && customDataWrite(_context, meta, i, permutation.Macros))
+            return true;
+    }
+    return WriteShaderFunctionEnd(_context, meta);
+}
+
 bool ShaderCompiler::OnCompileBegin()
 {
     // Setup global macros
@@ -6,7 +6,9 @@
 
 #include "ShaderCompilationContext.h"
 #include "Parser/ShaderMeta.h"
+#include "Engine/Core/Delegate.h"
 #include "Engine/Graphics/Shaders/GPUShaderProgram.h"
+#include "Engine/Serialization/MemoryWriteStream.h"
 
 /// <summary>
 /// Base class for the objects that can compile shaders source code.
@@ -88,10 +90,30 @@ protected:
 
     typedef bool (*WritePermutationData)(ShaderCompilationContext*, ShaderFunctionMeta&, int32, const Array<ShaderMacro>&);
 
+    /// <summary>
+    /// Data for a single shader function permutation compiled within a batch (see CompileShaderPermutations).
+    /// </summary>
+    struct ShaderPermutationData
+    {
+        int32 Index = 0;
+        Array<ShaderMacro> Macros;
+        ShaderBindings Bindings = {};
+        MemoryWriteStream Cache;
+    };
+
     virtual bool CompileShader(ShaderFunctionMeta& meta, WritePermutationData customDataWrite = nullptr) = 0;
 
     bool CompileShaders();
 
+    /// <summary>
+    /// Compiles all permutations of the given shader function in a batch: the shared front-end setup (full macro sets for every permutation) is done once, then the permutations compile in parallel across the job system workers and the results get written to the output in order. The callback runs on the worker threads so it must not touch shared compiler state without synchronization; the compiled blob (with any backend header) goes into the permutation Cache stream.
+    /// </summary>
+    /// <param name="meta">The shader function metadata.</param>
+    /// <param name="customDataWrite">Optional custom data writer (called serially after the compilation).</param>
+    /// <param name="compilePermutation">The per-permutation compilation callback.</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    bool CompileShaderPermutations(ShaderFunctionMeta& meta, WritePermutationData customDataWrite, const Function<bool(ShaderFunctionMeta&, ShaderPermutationData&)>& compilePermutation);
+
     virtual bool OnCompileBegin();
     virtual bool OnCompileEnd();
 
@@ -502,49 +502,38 @@ bool ShaderCompilerVulkan::CompileShader(ShaderFunctionMeta& meta, WritePermutat
     }
     EShMessages messages = (EShMessages)(EShMsgReadHlsl | EShMsgSpvRules | EShMsgVulkanRules);
 
-    // Compile all shader function permutations
-    for (int32 permutationIndex = 0; permutationIndex < meta.Permutations.Count(); permutationIndex++)
+    // Offset inputs for some pipeline stages to match the descriptors sets layout
+    int32 stageSet;
+    switch (type)
+    {
+    case ShaderStage::Vertex:
+    case ShaderStage::Compute:
+        stageSet = 0;
+        break;
+    case ShaderStage::Pixel:
+        stageSet = 1;
+        break;
+    case ShaderStage::Geometry:
+        stageSet = 2;
+        break;
+    case ShaderStage::Hull:
+        stageSet = 3;
+        break;
+    case ShaderStage::Domain:
+        stageSet = 4;
+        break;
+    default:
+        LOG(Error, "Unknown shader type.");
+        return true;
+    }
+
+    // Compile all shader function permutations in a batch (the front-end setup is shared and permutations run on the job system workers)
+    CriticalSection reflectLocker; // Guards the shared constant buffers usage cache
+    return CompileShaderPermutations(meta, customDataWrite, [&](ShaderFunctionMeta& shaderMeta, ShaderPermutationData& permutation) -> bool
     {
 #if PRINT_DESCRIPTORS
-        LOG(Warning, "VULKAN SHADER {0}: {1}[{2}]", _context->Options->TargetName, String(meta.Name), permutationIndex);
+        LOG(Warning, "VULKAN SHADER {0}: {1}[{2}]", _context->Options->TargetName, String(shaderMeta.Name), permutation.Index);
 #endif
-        _macros.Clear();
-
-        // Get function permutation macros
-        meta.GetDefinitionsForPermutation(permutationIndex, _macros);
-
-        // Add additional define for compiled function name
-        GetDefineForFunction(meta, _macros);
-
-        // Add custom and global macros (global last because contain null define to indicate ending)
-        _macros.Add(_context->Options->Macros);
-        _macros.Add(_globalMacros);
-
-        // Offset inputs for some pipeline stages to match the descriptors sets layout
-        int32 stageSet;
-        switch (type)
-        {
-        case ShaderStage::Vertex:
-        case ShaderStage::Compute:
-            stageSet = 0;
-            break;
-        case ShaderStage::Pixel:
-            stageSet = 1;
-            break;
-        case ShaderStage::Geometry:
-            stageSet = 2;
-            break;
-        case ShaderStage::Hull:
-            stageSet = 3;
-            break;
-        case ShaderStage::Domain:
-            stageSet = 4;
-            break;
-        default:
-            LOG(Error, "Unknown shader type.");
-            return true;
-        }
-
         // Parse HLSL shader using glslang
         glslang::TShader shader(lang);
         glslang::TProgram program;
@@ -555,9 +544,9 @@ bool ShaderCompilerVulkan::CompileShader(ShaderFunctionMeta& meta, WritePermutat
         shader.setStringsWithLengthsAndNames(&options->Source, &lengths, &names, 1);
         const int defaultVersion = 450;
         std::string preamble;
-        for (int32 i = 0; i < _macros.Count() - 1; i++)
+        for (int32 i = 0; i < permutation.Macros.Count() - 1; i++)
         {
-            auto& macro = _macros[i];
+            auto& macro = permutation.Macros[i];
             preamble.append("#define ");
             preamble.append(macro.Name);
             if (macro.Definition)
@@ -725,6 +714,7 @@ bool ShaderCompilerVulkan::CompileShader(ShaderFunctionMeta& meta, WritePermutat
                         continue;
                     }
 
+                    ScopeLock lock(reflectLocker);
                     for (int32 b = 0; b < _constantBuffers.Count(); b++)
                     {
                         auto& cc = _constantBuffers[b];
@@ -797,21 +787,18 @@ bool ShaderCompilerVulkan::CompileShader(ShaderFunctionMeta& meta, WritePermutat
             spvtools::SpirvTools tools(SPV_ENV_VULKAN_1_0);
             std::string spirvText;
             tools.Disassemble(spirv, &spirvText);
-            _context->OnCollectDebugInfo(meta, permutationIndex, spirvText.c_str(), (int32)spirvText.size());
+            _context->OnCollectDebugInfo(shaderMeta, permutation.Index, spirvText.c_str(), (int32)spirvText.size());
         }
 #endif
 
         int32 spirvBytesCount = (int32)spirv.size() * sizeof(unsigned);
         header.Type = SpirvShaderHeader::Types::Raw;
 
-        if (WriteShaderFunctionPermutation(_context, meta, permutationIndex, bindings, &header, sizeof(header), &spirv[0], spirvBytesCount))
-            return true;
-
-        if (customDataWrite && customDataWrite(_context, meta, permutationIndex, _macros))
-            return true;
-    }
-
-    return WriteShaderFunctionEnd(_context, meta);
+        permutation.Bindings = bindings;
+        permutation.Cache.WriteBytes(&header, sizeof(header));
+        permutation.Cache.WriteBytes(&spirv[0], spirvBytesCount);
+        return false;
+    });
 }
 
 bool ShaderCompilerVulkan::OnCompileBegin()
@@ -34,6 +34,9 @@ ShadowsOfMordor::Builder::SceneBuildCache::SceneBuildCache()
     , LightmapsCount(0)
     , HemispheresCount(0)
     , MergedHemispheresCount(0)
+#if LIGHTMAPS_INCREMENTAL_BAKE
+    , PreservedChartsCount(0)
+#endif
     , ImportLightmapIndex(0)
     , ImportLightmapTextureIndex(0)
 {
@@ -190,6 +193,9 @@ void ShadowsOfMordor::Builder::SceneBuildCache::Release()
     Entries.Resize(0);
     Lightmaps.Resize(0);
     Charts.Resize(0);
+#if LIGHTMAPS_INCREMENTAL_BAKE
+    ChartsCache.Resize(0);
+#endif
     Scene = nullptr;
 
     EntriesLocker.Unlock();
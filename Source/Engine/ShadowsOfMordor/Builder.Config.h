@@ -46,6 +46,7 @@ namespace ShadowsOfMordor
 #define HEMISPHERES_IRRADIANCE_FORMAT HEMISPHERES_FORMAT_R16G16B16A16
 #define HEMISPHERES_BAKE_STATE_SAVE 1
 #define HEMISPHERES_BAKE_STATE_SAVE_DELAY 300
+#define LIGHTMAPS_INCREMENTAL_BAKE 1
 #define CACHE_ENTRIES_PER_JOB 10
 #define CACHE_POSITIONS_FORMAT HEMISPHERES_FORMAT_R32G32B32A32
 #define CACHE_NORMALS_FORMAT HEMISPHERES_FORMAT_R16G16B16A16
@@ -59,3 +60,4 @@ namespace ShadowsOfMordor
 // Constants
 #define HEMISPHERES_RESOLUTION 64
 #define NUM_SH_TARGETS 3
+#define BAKE_LIGHTMAP_GROUP_SIZE 8
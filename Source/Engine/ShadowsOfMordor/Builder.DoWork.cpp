@@ -165,6 +165,10 @@ bool ShadowsOfMordor::Builder::doWorkInner(DateTime buildStart)
         RUN_STEP(generateCharts);
         RUN_STEP(packCharts);
         RUN_STEP(updateLightmaps);
+#if LIGHTMAPS_INCREMENTAL_BAKE
+        // Detect charts that can reuse the lightmap data from the previous bake (before entries mapping gets modified)
+        RUN_STEP(applyChartsCache);
+#endif
         RUN_STEP(updateEntries);
     }
 
@@ -216,6 +220,7 @@ bool ShadowsOfMordor::Builder::doWorkInner(DateTime buildStart)
     int32 bounceCount = 0;
     int32 lightmapsCount = 0;
     int32 entriesCount = 0;
+    int32 preservedChartsCount = 0;
     for (int32 sceneIndex = 0; sceneIndex < _scenes.Count(); sceneIndex++)
     {
         auto& scene = *_scenes[sceneIndex];
@@ -224,6 +229,9 @@ bool ShadowsOfMordor::Builder::doWorkInner(DateTime buildStart)
         lightmapsCount += scene.Lightmaps.Count();
         entriesCount += scene.Entries.Count();
         bounceCount = Math::Max(bounceCount, scene.GetSettings().BounceCount);
+#if LIGHTMAPS_INCREMENTAL_BAKE
+        preservedChartsCount += scene.PreservedChartsCount;
+#endif
 
         // Cleanup unused data to reduce memory usage
         scene.Entries.Resize(0);
@@ -232,8 +240,8 @@ bool ShadowsOfMordor::Builder::doWorkInner(DateTime buildStart)
             lightmap.Entries.Resize(0);
     }
     _bounceCount = bounceCount;
-    LOG(Info, "Rendering {0} hemispheres in {1} bounce(s) (merged: {2})", hemispheresCount, bounceCount, mergedHemispheresCount);
-    if (bounceCount <= 0 || hemispheresCount <= 0)
+    LOG(Info, "Rendering {0} hemispheres in {1} bounce(s) (merged: {2}, preserved charts: {3})", hemispheresCount, bounceCount, mergedHemispheresCount, preservedChartsCount);
+    if (bounceCount <= 0 || (hemispheresCount <= 0 && preservedChartsCount <= 0))
     {
         LOG(Warning, "No data to render");
         _wasBuildCalled = false;
@@ -291,6 +299,12 @@ bool ShadowsOfMordor::Builder::doWorkInner(DateTime buildStart)
         }
     }
 
+#if LIGHTMAPS_INCREMENTAL_BAKE
+    // Store the bake outputs to reuse the unchanged charts during the next bake
+    for (_workerActiveSceneIndex = 0; _workerActiveSceneIndex < _scenes.Count(); _workerActiveSceneIndex++)
+        saveChartsCache();
+#endif
+
     reportProgress(BuildProgressStep::RenderHemispheres, 1.0f);
 
 #if DEBUG_EXPORT_HEMISPHERES_PREVIEW
@@ -107,6 +107,24 @@ void ShadowsOfMordor::Builder::generateHemispheres()
         exportCachePreview(scene, cacheData, lightmapEntry);
 #endif
 
+#if LIGHTMAPS_INCREMENTAL_BAKE
+        // Reject texels of the charts preserved from the previous bake (their lightmap data gets restored from the cache instead of hemispheres rendering)
+        for (const auto& chartCache : scene->ChartsCache)
+        {
+            if (!chartCache.Preserved || chartCache.TextureIndex != _workerStagePosition0)
+                continue;
+            const int32 minX = Math::Clamp(Math::FloorToInt(chartCache.UVsArea.GetLeft() * atlasSize), 0, atlasSize);
+            const int32 maxX = Math::Clamp(Math::CeilToInt(chartCache.UVsArea.GetRight() * atlasSize), 0, atlasSize);
+            const int32 minY = Math::Clamp(Math::FloorToInt(chartCache.UVsArea.GetTop() * atlasSize), 0, atlasSize);
+            const int32 maxY = Math::Clamp(Math::CeilToInt(chartCache.UVsArea.GetBottom() * atlasSize), 0, atlasSize);
+            for (int32 y = minY; y < maxY; y++)
+            {
+                for (int32 x = minX; x < maxX; x++)
+                    RejectTexel(cacheData, x, y);
+            }
+        }
+#endif
+
         // For each texel
         for (int32 texelX = 0; texelX < atlasSize; texelX++)
         {
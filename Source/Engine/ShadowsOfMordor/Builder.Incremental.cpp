@@ -0,0 +1,400 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "Builder.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Collections/HashFunctions.h"
+#include "Engine/Engine/Globals.h"
+#include "Engine/Level/Scene/Scene.h"
+#include "Engine/Level/Actors/StaticModel.h"
+#include "Engine/Level/Actors/DirectionalLight.h"
+#include "Engine/Level/Actors/PointLight.h"
+#include "Engine/Level/Actors/SpotLight.h"
+#include "Engine/Level/Actors/SkyLight.h"
+#include "Engine/Level/Actors/Sky.h"
+#include "Engine/Terrain/Terrain.h"
+#include "Engine/Terrain/TerrainPatch.h"
+#include "Engine/Foliage/Foliage.h"
+#include "Engine/Platform/FileSystem.h"
+#include "Engine/Serialization/FileReadStream.h"
+#include "Engine/Serialization/FileWriteStream.h"
+#include "Engine/Graphics/GPUBuffer.h"
+#include "Engine/Graphics/PixelFormatExtensions.h"
+
+#if LIGHTMAPS_INCREMENTAL_BAKE
+
+namespace
+{
+    void HashFloat(uint32& hash, float value)
+    {
+        CombineHash(hash, GetHash(value));
+    }
+
+    void HashTransform(uint32& hash, const Transform& transform)
+    {
+        CombineHash(hash, GetHash(transform.Translation.X));
+        CombineHash(hash, GetHash(transform.Translation.Y));
+        CombineHash(hash, GetHash(transform.Translation.Z));
+        HashFloat(hash, transform.Orientation.X);
+        HashFloat(hash, transform.Orientation.Y);
+        HashFloat(hash, transform.Orientation.Z);
+        HashFloat(hash, transform.Orientation.W);
+        HashFloat(hash, transform.Scale.X);
+        HashFloat(hash, transform.Scale.Y);
+        HashFloat(hash, transform.Scale.Z);
+    }
+
+    void HashAsset(uint32& hash, const Asset* asset)
+    {
+        CombineHash(hash, asset ? GetHash(asset->GetID()) : 0);
+    }
+
+    void HashLight(uint32& hash, const Light* light)
+    {
+        HashTransform(hash, light->GetTransform());
+        CombineHash(hash, GetHash(light->Color));
+        HashFloat(hash, light->Brightness);
+        HashFloat(hash, light->IndirectLightingIntensity);
+        CombineHash(hash, light->HasStaticFlag(StaticFlags::Lightmap) ? 1 : 0);
+    }
+
+    // The set of lights in the scene that affect the baked lighting. Lights covering the whole scene are combined into the global hash, local lights get combined per-chart using their bounds.
+    struct LightsCache
+    {
+        uint32 GlobalHash = 0;
+        Array<BoundingSphere> LocalBounds;
+        Array<uint32> LocalHashes;
+    };
+
+    bool CacheLights(Actor* actor, LightsCache* lights)
+    {
+        if (!actor->GetIsActive())
+            return false;
+        if (const auto pointLight = dynamic_cast<PointLight*>(actor))
+        {
+            uint32 hash = 0;
+            HashLight(hash, pointLight);
+            HashFloat(hash, pointLight->GetRadius());
+            HashFloat(hash, pointLight->SourceRadius);
+            HashFloat(hash, pointLight->SourceLength);
+            HashFloat(hash, pointLight->FallOffExponent);
+            HashAsset(hash, pointLight->IESTexture.Get());
+            lights->LocalBounds.Add(pointLight->GetSphere());
+            lights->LocalHashes.Add(hash);
+        }
+        else if (const auto spotLight = dynamic_cast<SpotLight*>(actor))
+        {
+            uint32 hash = 0;
+            HashLight(hash, spotLight);
+            HashFloat(hash, spotLight->GetRadius());
+            HashFloat(hash, spotLight->SourceRadius);
+            HashFloat(hash, spotLight->FallOffExponent);
+            HashFloat(hash, spotLight->GetOuterConeAngle());
+            HashFloat(hash, spotLight->GetInnerConeAngle());
+            HashAsset(hash, spotLight->IESTexture.Get());
+            lights->LocalBounds.Add(spotLight->GetSphere());
+            lights->LocalHashes.Add(hash);
+        }
+        else if (const auto dirLight = dynamic_cast<DirectionalLight*>(actor))
+        {
+            HashLight(lights->GlobalHash, dirLight);
+        }
+        else if (const auto skyLight = dynamic_cast<SkyLight*>(actor))
+        {
+            HashLight(lights->GlobalHash, skyLight);
+            CombineHash(lights->GlobalHash, GetHash(skyLight->AdditiveColor));
+            CombineHash(lights->GlobalHash, GetHash((int32)skyLight->Mode));
+            HashFloat(lights->GlobalHash, skyLight->GetRadius());
+            HashAsset(lights->GlobalHash, skyLight->CustomTexture.Get());
+        }
+        else if (const auto sky = dynamic_cast<Sky*>(actor))
+        {
+            HashTransform(lights->GlobalHash, sky->GetTransform());
+            HashFloat(lights->GlobalHash, sky->SunDiscScale);
+            HashFloat(lights->GlobalHash, sky->SunPower);
+            CombineHash(lights->GlobalHash, sky->SunLight ? GetHash(sky->SunLight->GetID()) : 0);
+        }
+        return true;
+    }
+
+    uint32 HashSettings(const LightmapSettings& settings)
+    {
+        uint32 hash = 0;
+        HashFloat(hash, settings.IndirectLightingIntensity);
+        HashFloat(hash, settings.GlobalObjectsScale);
+        CombineHash(hash, GetHash(settings.ChartsPadding));
+        CombineHash(hash, GetHash((int32)settings.AtlasSize));
+        CombineHash(hash, GetHash(settings.BounceCount));
+        CombineHash(hash, settings.UseGeometryWithNoMaterials ? 1 : 0);
+        CombineHash(hash, GetHash(settings.Quality));
+        return hash;
+    }
+
+    uint32 HashChartKey(const ShadowsOfMordor::Builder::GeometryEntry& entry)
+    {
+        uint32 hash = GetHash((int32)entry.Type);
+        switch (entry.Type)
+        {
+        case ShadowsOfMordor::Builder::GeometryType::StaticModel:
+            CombineHash(hash, GetHash(entry.AsStaticModel.Actor->GetID()));
+            break;
+        case ShadowsOfMordor::Builder::GeometryType::Terrain:
+            CombineHash(hash, GetHash(entry.AsTerrain.Actor->GetID()));
+            CombineHash(hash, GetHash(entry.AsTerrain.PatchIndex));
+            CombineHash(hash, GetHash(entry.AsTerrain.ChunkIndex));
+            break;
+        case ShadowsOfMordor::Builder::GeometryType::Foliage:
+            CombineHash(hash, GetHash(entry.AsFoliage.Actor->GetID()));
+            CombineHash(hash, GetHash(entry.AsFoliage.InstanceIndex));
+            CombineHash(hash, GetHash(entry.AsFoliage.TypeIndex));
+            CombineHash(hash, GetHash(entry.AsFoliage.MeshIndex));
+            break;
+        }
+        return hash;
+    }
+
+    uint32 HashChartInputs(const ShadowsOfMordor::Builder::GeometryEntry& entry, const ShadowsOfMordor::Builder::LightmapUVsChart& chart, const LightsCache& lights)
+    {
+        uint32 hash = lights.GlobalHash;
+
+        // Chart size in the lightmap
+        CombineHash(hash, GetHash(chart.Width));
+        CombineHash(hash, GetHash(chart.Height));
+        HashFloat(hash, entry.Scale);
+
+        // Geometry placement, source model and materials
+        switch (entry.Type)
+        {
+        case ShadowsOfMordor::Builder::GeometryType::StaticModel:
+        {
+            const auto staticModel = entry.AsStaticModel.Actor;
+            HashTransform(hash, staticModel->GetTransform());
+            HashAsset(hash, staticModel->Model.Get());
+            for (int32 i = 0; i < staticModel->Entries.Count(); i++)
+                HashAsset(hash, staticModel->Entries[i].Material.Get());
+            break;
+        }
+        case ShadowsOfMordor::Builder::GeometryType::Terrain:
+        {
+            const auto terrain = entry.AsTerrain.Actor;
+            const auto patch = terrain->GetPatch(entry.AsTerrain.PatchIndex);
+            HashTransform(hash, terrain->GetTransform());
+            HashAsset(hash, patch->Heightmap.Get());
+            auto& chunk = patch->Chunks[entry.AsTerrain.ChunkIndex];
+            HashAsset(hash, chunk.OverrideMaterial ? chunk.OverrideMaterial.Get() : terrain->Material.Get());
+            break;
+        }
+        case ShadowsOfMordor::Builder::GeometryType::Foliage:
+        {
+            const auto foliage = entry.AsFoliage.Actor;
+            auto& instance = foliage->Instances[entry.AsFoliage.InstanceIndex];
+            auto& type = foliage->FoliageTypes[entry.AsFoliage.TypeIndex];
+            HashTransform(hash, foliage->GetTransform());
+            HashTransform(hash, instance.Transform);
+            HashAsset(hash, type.Model.Get());
+            for (int32 i = 0; i < type.Entries.Count(); i++)
+                HashAsset(hash, type.Entries[i].Material.Get());
+            break;
+        }
+        }
+
+        // Local lights that reach the entry bounds (moved light invalidates the charts it used to affect and the ones it affects now)
+        for (int32 i = 0; i < lights.LocalBounds.Count(); i++)
+        {
+            if (entry.Box.Intersects(lights.LocalBounds[i]))
+                CombineHash(hash, lights.LocalHashes[i]);
+        }
+
+        return hash;
+    }
+
+    String GetChartsCachePath(const ShadowsOfMordor::Builder::SceneBuildCache* scene)
+    {
+        return Globals::ProjectCacheFolder / String::Format(TEXT("ShadowsOfMordor_Scene_{0}.bin"), scene->Scene->GetID());
+    }
+}
+
+void ShadowsOfMordor::Builder::applyChartsCache()
+{
+    auto scene = _scenes[_workerActiveSceneIndex];
+    scene->PreservedChartsCount = 0;
+    scene->ChartsCache.Resize(scene->Charts.Count());
+    if (scene->Charts.IsEmpty())
+        return;
+    const int32 atlasSize = (int32)scene->GetSettings().AtlasSize;
+
+    // Hash the bake inputs of every chart packed into the lightmaps
+    {
+        scene->EntriesLocker.Lock();
+
+        // Collect the lights set affecting the baked lighting
+        LightsCache lights;
+        lights.GlobalHash = HashSettings(scene->GetSettings());
+        Function<bool(Actor*, LightsCache*)> cacheLights = &CacheLights;
+        scene->Scene->TreeExecute(cacheLights, &lights);
+
+        for (int32 chartIndex = 0; chartIndex < scene->Charts.Count(); chartIndex++)
+        {
+            auto& chart = scene->Charts[chartIndex];
+            auto& cache = scene->ChartsCache[chartIndex];
+            cache.Key = HashChartKey(scene->Entries[chart.EntryIndex]);
+            cache.Hash = HashChartInputs(scene->Entries[chart.EntryIndex], chart, lights);
+            cache.TextureIndex = chart.Result.TextureIndex;
+            cache.UVsArea = chart.Result.UVsArea;
+            cache.Preserved = false;
+        }
+
+        scene->EntriesLocker.Unlock();
+    }
+
+    // Skip if there is no cached data from the previous bake
+    const auto path = GetChartsCachePath(scene);
+    if (!FileSystem::FileExists(path))
+        return;
+
+    // Open file
+    auto stream = FileReadStream::Open(path);
+    if (stream == nullptr)
+        return;
+    int32 version, cachedAtlasSize, cachedLightmapsCount, cachedDataSize, cachedChartsCount;
+    stream->ReadInt32(&version);
+    if (version != 1)
+    {
+        LOG(Warning, "Invalid lightmap charts cache version.");
+        Delete(stream);
+        FileSystem::DeleteFile(path);
+        return;
+    }
+    stream->ReadInt32(&cachedAtlasSize);
+    stream->ReadInt32(&cachedLightmapsCount);
+    stream->ReadInt32(&cachedDataSize);
+    stream->ReadInt32(&cachedChartsCount);
+    const int32 lightmapDataSize = scene->Lightmaps.HasItems() ? (int32)scene->Lightmaps[0].LightmapData->GetSize() : 0;
+    if (cachedAtlasSize != atlasSize || cachedDataSize != lightmapDataSize || cachedLightmapsCount < 0 || cachedChartsCount < 0)
+    {
+        // Discard the cache after lightmaps format or settings change
+        Delete(stream);
+        FileSystem::DeleteFile(path);
+        return;
+    }
+
+    // Cached charts records
+    Array<SceneBuildCache::ChartCache> cachedCharts;
+    cachedCharts.Resize(cachedChartsCount);
+    Dictionary<uint32, int32> cachedChartsLookup(cachedChartsCount * 3);
+    for (int32 i = 0; i < cachedChartsCount; i++)
+    {
+        auto& cached = cachedCharts[i];
+        stream->ReadUint32(&cached.Key);
+        stream->ReadUint32(&cached.Hash);
+        stream->ReadInt32(&cached.TextureIndex);
+        stream->ReadFloat(&cached.UVsArea.Location.X);
+        stream->ReadFloat(&cached.UVsArea.Location.Y);
+        stream->ReadFloat(&cached.UVsArea.Size.X);
+        stream->ReadFloat(&cached.UVsArea.Size.Y);
+        cachedChartsLookup[cached.Key] = i;
+    }
+
+    // Cached lightmaps data
+    Array<Array<byte>> cachedData;
+    cachedData.Resize(cachedLightmapsCount);
+    for (int32 i = 0; i < cachedLightmapsCount; i++)
+    {
+        cachedData[i].Resize(cachedDataSize);
+        stream->ReadBytes(cachedData[i].Get(), cachedDataSize);
+    }
+    Delete(stream);
+
+    // Preserve the charts with the same inputs and the same placement in the lightmaps as during the previous bake
+    const int32 texelSize = PixelFormatExtensions::SizeInBytes(HemispheresFormatToPixelFormat[HEMISPHERES_IRRADIANCE_FORMAT]) * NUM_SH_TARGETS;
+    for (int32 chartIndex = 0; chartIndex < scene->ChartsCache.Count(); chartIndex++)
+    {
+        auto& cache = scene->ChartsCache[chartIndex];
+        if (cache.TextureIndex < 0 || cache.TextureIndex >= scene->Lightmaps.Count())
+            continue;
+        int32 cachedIndex;
+        if (!cachedChartsLookup.TryGet(cache.Key, cachedIndex))
+            continue;
+        auto& cached = cachedCharts[cachedIndex];
+        if (cached.Hash != cache.Hash || cached.TextureIndex != cache.TextureIndex || !(cached.UVsArea == cache.UVsArea) || cached.TextureIndex >= cachedData.Count())
+            continue;
+
+        // Copy the chart area from the cached lightmap data (the rest of the lightmap stays black and gets baked)
+        auto& lightmap = scene->Lightmaps[cache.TextureIndex];
+        if (lightmap.RestoreData.IsEmpty())
+        {
+            lightmap.RestoreData.Resize(lightmapDataSize);
+            Platform::MemoryClear(lightmap.RestoreData.Get(), lightmapDataSize);
+        }
+        const auto& src = cachedData[cache.TextureIndex];
+        const int32 minX = Math::Clamp(Math::FloorToInt(cache.UVsArea.GetLeft() * atlasSize), 0, atlasSize);
+        const int32 maxX = Math::Clamp(Math::CeilToInt(cache.UVsArea.GetRight() * atlasSize), 0, atlasSize);
+        const int32 minY = Math::Clamp(Math::FloorToInt(cache.UVsArea.GetTop() * atlasSize), 0, atlasSize);
+        const int32 maxY = Math::Clamp(Math::CeilToInt(cache.UVsArea.GetBottom() * atlasSize), 0, atlasSize);
+        for (int32 y = minY; y < maxY; y++)
+        {
+            const int32 offset = (y * atlasSize + minX) * texelSize;
+            Platform::MemoryCopy(lightmap.RestoreData.Get() + offset, src.Get() + offset, (maxX - minX) * texelSize);
+        }
+
+        cache.Preserved = true;
+        scene->PreservedChartsCount++;
+    }
+
+    if (scene->PreservedChartsCount > 0)
+        LOG(Info, "Reusing {0}/{1} lightmap charts from the previous bake", scene->PreservedChartsCount, scene->ChartsCache.Count());
+}
+
+void ShadowsOfMordor::Builder::saveChartsCache()
+{
+    auto scene = _scenes[_workerActiveSceneIndex];
+    if (scene->ChartsCache.IsEmpty() || scene->Lightmaps.IsEmpty())
+        return;
+
+    // Download the final lightmaps data from the GPU
+    Array<BytesContainer> lightmapsData;
+    lightmapsData.Resize(scene->Lightmaps.Count());
+    for (int32 i = 0; i < scene->Lightmaps.Count(); i++)
+    {
+        if (scene->Lightmaps[i].LightmapData->DownloadData(lightmapsData[i]))
+        {
+            LOG(Warning, "Cannot download LightmapData for the lightmap charts cache.");
+            return;
+        }
+    }
+
+    // Save to file
+    const auto path = GetChartsCachePath(scene);
+    const auto pathTmp = path + TEXT(".tmp");
+    auto stream = FileWriteStream::Open(pathTmp);
+    if (stream == nullptr)
+        return;
+    stream->WriteInt32(1);
+    stream->WriteInt32((int32)scene->GetSettings().AtlasSize);
+    stream->WriteInt32(scene->Lightmaps.Count());
+    stream->WriteInt32(lightmapsData[0].Length());
+    stream->WriteInt32(scene->ChartsCache.Count());
+    for (int32 i = 0; i < scene->ChartsCache.Count(); i++)
+    {
+        auto& cache = scene->ChartsCache[i];
+        stream->WriteUint32(cache.Key);
+        stream->WriteUint32(cache.Hash);
+        stream->WriteInt32(cache.TextureIndex);
+        stream->WriteFloat(cache.UVsArea.Location.X);
+        stream->WriteFloat(cache.UVsArea.Location.Y);
+        stream->WriteFloat(cache.UVsArea.Size.X);
+        stream->WriteFloat(cache.UVsArea.Size.Y);
+    }
+    for (int32 i = 0; i < lightmapsData.Count(); i++)
+        stream->WriteBytes(lightmapsData[i].Get(), lightmapsData[i].Length());
+    Delete(stream);
+
+    // Update the cache file
+    if (FileSystem::FileExists(path))
+        FileSystem::DeleteFile(path);
+    FileSystem::MoveFile(path, pathTmp);
+    FileSystem::DeleteFile(pathTmp);
+}
+
+#endif
@@ -281,6 +281,12 @@ void ShadowsOfMordor::Builder::onJobRender(GPUContext* context)
         // All black everything!
         context->ClearUA(lightmapEntry.LightmapData, Float4::Zero);
 
+#if LIGHTMAPS_INCREMENTAL_BAKE
+        // Restore the data of the charts preserved from the previous bake (kept after every clear so it survives all bounces)
+        if (lightmapEntry.RestoreData.HasItems())
+            context->UpdateBuffer(lightmapEntry.LightmapData, lightmapEntry.RestoreData.Get(), lightmapEntry.RestoreData.Count());
+#endif
+
         _wasStageDone = true;
         break;
     }
@@ -334,6 +340,9 @@ void ShadowsOfMordor::Builder::onJobRender(GPUContext* context)
         Matrix view, projection;
         Matrix::PerspectiveFov(HEMISPHERES_FOV * DegreesToRadians, 1.0f, HEMISPHERES_NEAR_PLANE, HEMISPHERES_FAR_PLANE, projection);
         ShaderData shaderData;
+        auto cb = _shader->GetShader()->GetCB(0);
+        auto csIntegrate = _shader->GetShader()->GetCS("CS_Integrate");
+        auto csReduction = _shader->GetShader()->GetCS("CS_Reduction");
 #if COMPILE_WITH_PROFILER
         auto gpuProfilerEnabled = ProfilerGPU::Enabled;
         ProfilerGPU::Enabled = false;
@@ -397,20 +406,18 @@ void ShadowsOfMordor::Builder::onJobRender(GPUContext* context)
             shaderData.TexelAddress = (hemisphere.TexelY * atlasSize + hemisphere.TexelX) * NUM_SH_TARGETS;
 
             // Calculate per pixel irradiance using compute shaders
-            auto cb = _shader->GetShader()->GetCB(0);
             context->UpdateCB(cb, &shaderData);
             context->BindCB(0, cb);
             context->BindUA(0, _irradianceReduction->View());
             context->BindSR(0, radianceMap);
-            context->Dispatch(_shader->GetShader()->GetCS("CS_Integrate"), 1, HEMISPHERES_RESOLUTION, 1);
+            context->Dispatch(csIntegrate, 1, HEMISPHERES_RESOLUTION, 1);
             context->ResetUA();
             context->ResetSR();
 
             // Downscale H-basis to 1x1 and copy results to lightmap data buffer
             context->BindUA(0, lightmapEntry.LightmapData->View());
             context->BindSR(0, _irradianceReduction->View());
-            // TODO: cache shader handle
-            context->Dispatch(_shader->GetShader()->GetCS("CS_Reduction"), 1, NUM_SH_TARGETS, 1);
+            context->Dispatch(csReduction, 1, NUM_SH_TARGETS, 1);
 
             // Unbind slots now to make rendering backend live easier
             context->ResetSR();
@@ -461,12 +468,13 @@ void ShadowsOfMordor::Builder::onJobRender(GPUContext* context)
         auto cb = _shader->GetShader()->GetCB(0);
         context->UpdateCB(cb, &shaderData);
         context->BindCB(0, cb);
+        const int32 atlasGroupCount = Math::DivideAndRoundUp(atlasSize, BAKE_LIGHTMAP_GROUP_SIZE);
 
         // Blur empty lightmap texel to reduce black artifacts during sampling lightmap on objects
         context->ResetRenderTarget();
         context->BindSR(0, lightmapEntry.LightmapData->View());
         context->BindUA(0, scene->TempLightmapData->View());
-        context->Dispatch(_shader->GetShader()->GetCS("CS_BlurEmpty"), atlasSize, atlasSize, 1);
+        context->Dispatch(_shader->GetShader()->GetCS("CS_BlurEmpty"), atlasGroupCount, atlasGroupCount, 1);
 
         // Swap temporary buffer used as output with lightmap entry data (these buffers are the same)
         // So we can rewrite data from one buffer to another with custom sampling
@@ -476,6 +484,7 @@ void ShadowsOfMordor::Builder::onJobRender(GPUContext* context)
         int32 blurPasses = 24;
         if (context->GetDevice()->GetRendererType() == RendererType::DirectX12)
             blurPasses = 0; // TODO: fix CS_Dilate passes on D3D12 (probably UAV synchronization issue)
+        auto csDilate = _shader->GetShader()->GetCS("CS_Dilate");
         for (int32 blurPassIndex = 0; blurPassIndex < blurPasses; blurPassIndex++)
         {
             context->ResetSR();
@@ -483,7 +492,7 @@ void ShadowsOfMordor::Builder::onJobRender(GPUContext* context)
 
             context->BindSR(0, lightmapEntry.LightmapData->View());
             context->BindUA(0, scene->TempLightmapData->View());
-            context->Dispatch(_shader->GetShader()->GetCS("CS_Dilate"), atlasSize, atlasSize, 1);
+            context->Dispatch(csDilate, atlasGroupCount, atlasGroupCount, 1);
 
             Swap(scene->TempLightmapData, lightmapEntry.LightmapData);
         }
@@ -491,7 +500,7 @@ void ShadowsOfMordor::Builder::onJobRender(GPUContext* context)
         context->BindUA(0, lightmapEntry.LightmapData->View());
 
         // Remove the BACKGROUND_TEXELS_MARK from the unused texels (see shader for more info)
-        context->Dispatch(_shader->GetShader()->GetCS("CS_Finalize"), atlasSize, atlasSize, 1);
+        context->Dispatch(_shader->GetShader()->GetCS("CS_Finalize"), atlasGroupCount, atlasGroupCount, 1);
 
         // Move to another lightmap
         _workerStagePosition0++;
@@ -124,6 +124,10 @@ namespace ShadowsOfMordor
             // Restored data for the lightmap from the loaded state (copied to the LightmapData on first hemispheres render job)
             Array<byte> LightmapDataInit;
 #endif
+#if LIGHTMAPS_INCREMENTAL_BAKE
+            // Lightmap data of the charts preserved from the previous bake (copied to the LightmapData after every clear job, empty if all charts are dirty)
+            Array<byte> RestoreData;
+#endif
 
             ~LightmapBuildCache();
 
@@ -154,6 +158,30 @@ namespace ShadowsOfMordor
             int32 HemispheresCount;
             int32 MergedHemispheresCount;
 
+#if LIGHTMAPS_INCREMENTAL_BAKE
+            /// <summary>
+            /// Cached per chart bake inputs used to detect the charts that can be reused from the previous bake.
+            /// </summary>
+            struct ChartCache
+            {
+                // Stable chart identifier (actor id and geometry sub-indices)
+                uint32 Key;
+
+                // Hash of the bake inputs (geometry placement, materials, affecting lights set and baking settings)
+                uint32 Hash;
+
+                // Chart placement in the lightmaps collection
+                int32 TextureIndex;
+                Rectangle UVsArea;
+
+                // True if the chart lightmap data gets reused from the previous bake (hemispheres rendering is skipped)
+                bool Preserved;
+            };
+
+            Array<ChartCache> ChartsCache;
+            int32 PreservedChartsCount;
+#endif
+
         public:
 
             /// <summary>
@@ -328,6 +356,11 @@ namespace ShadowsOfMordor
         void updateEntries();
         void generateHemispheres();
 
+#if LIGHTMAPS_INCREMENTAL_BAKE
+        void applyChartsCache();
+        void saveChartsCache();
+#endif
+
 #if DEBUG_EXPORT_LIGHTMAPS_PREVIEW
         static void exportLightmapPreview(SceneBuildCache* scene, int32 lightmapIndex);
 #endif
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Engine/Core/Types/BaseTypes.h"
+#include "Engine/Core/Math/Vector3.h"
 
 class StreamingGroup;
 class StreamableResource;
@@ -27,6 +28,19 @@ public:
     /// <returns>Target quality (0-1).</returns>
     virtual float CalculateTargetQuality(StreamableResource* resource, DateTime now, double currentTime) = 0;
 
+    /// <summary>
+    /// Adjusts the target quality level based on the predicted main view motion (see Streaming::PredictionTime). Handlers can vote to raise quality of resources about to come into range so they are streamed in before they pop on screen.
+    /// </summary>
+    /// <param name="resource">The resource.</param>
+    /// <param name="quality">The target quality (0-1) calculated for the current view.</param>
+    /// <param name="viewPosition">The main view position.</param>
+    /// <param name="viewVelocity">The main view velocity (units per second).</param>
+    /// <returns>Adjusted target quality (0-1).</returns>
+    virtual float PredictQuality(StreamableResource* resource, float quality, const Vector3& viewPosition, const Vector3& viewVelocity)
+    {
+        return quality;
+    }
+
     /// <summary>
     /// Calculates the residency level for a given resource and quality level.
     /// </summary>
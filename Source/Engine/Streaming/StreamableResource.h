@@ -106,6 +106,13 @@ public:
     /// </summary>
     virtual void CancelStreamingTasks() = 0;
 
+    /// <summary>
+    /// Trims the resource allocation down to the current residency level to reduce memory usage (if supported). Called when the target residency has been stable for a while.
+    /// </summary>
+    virtual void TrimAllocation()
+    {
+    }
+
 public:
 
     struct StreamingCache
@@ -113,6 +120,7 @@ public:
         int64 LastUpdate = 0;
         int32 TargetResidency = 0;
         int64 TargetResidencyChange = 0;
+        int32 ResidencyBudgetBias = 0; // Residency levels to subtract when the resource group memory budget is exceeded (set by the streaming manager)
         SamplesBuffer<float, 5> QualitySamples;
     };
 
@@ -10,8 +10,13 @@
 #include "Engine/Threading/Threading.h"
 #include "Engine/Threading/TaskGraph.h"
 #include "Engine/Threading/Task.h"
+#include "Engine/Core/Collections/Sorting.h"
 #include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/RenderTask.h"
+#include "Engine/Graphics/RenderTools.h"
 #include "Engine/Graphics/Textures/GPUSampler.h"
+#include "Engine/Graphics/Textures/GPUTexture.h"
+#include "Engine/Graphics/Textures/StreamingTexture.h"
 #include "Engine/Serialization/Serialization.h"
 
 namespace StreamingManagerImpl
@@ -20,7 +25,12 @@ namespace StreamingManagerImpl
     CriticalSection ResourcesLock;
     Array<StreamableResource*> Resources;
     Array<GPUSampler*, InlinedAllocation<32>> TextureGroupSamplers;
+    Array<TextureGroupStats, InlinedAllocation<32>> TextureGroupsStats;
     GPUSampler* FallbackSampler = nullptr;
+    Vector3 ViewPosition = Vector3::Zero;
+    Vector3 ViewVelocity = Vector3::Zero;
+    double ViewUpdateTime = 0;
+    double TextureGroupsBudgetUpdateTime = 0;
 }
 
 using namespace StreamingManagerImpl;
@@ -53,6 +63,8 @@ StreamingService StreamingServiceInstance;
 
 Array<TextureGroup, InlinedAllocation<32>> Streaming::TextureGroups;
 
+float Streaming::PredictionTime = 1.0f;
+
 void StreamingSettings::Apply()
 {
     Streaming::TextureGroups = TextureGroups;
@@ -127,6 +139,11 @@ void UpdateResource(StreamableResource* resource, DateTime now, double currentTi
     if (resource->IsDynamic())
     {
         targetQuality = handler->CalculateTargetQuality(resource, now, currentTime);
+
+        // Let the handler vote on quality for the predicted view motion (pre-streams resources about to come into range)
+        if (Streaming::PredictionTime > 0.0f)
+            targetQuality = handler->PredictQuality(resource, targetQuality, ViewPosition, ViewVelocity);
+
         targetQuality = Math::Saturate(targetQuality);
     }
 
@@ -186,21 +203,130 @@ void UpdateResource(StreamableResource* resource, DateTime now, double currentTi
     }
     else
     {
-        // TODO: Check if target residency is stable (no changes for a while)
+        // Trim the over-allocated memory once the target residency has been stable for a while (eg. after the residency got reduced in-place)
+        const TimeSpan trimTimeout = TimeSpan::FromSeconds(10);
+        if (allocatedResidency > targetResidency && targetResidency > 0 && now - DateTime(resource->Streaming.TargetResidencyChange) >= trimTimeout)
+            resource->TrimAllocation();
+    }
+}
+
+struct TextureBudgetEntry
+{
+    StreamingTexture* Texture;
+    int32 GroupIndex;
+    uint64 MemoryUsage;
+    double LastRenderTime;
+};
+
+bool SortTextureBudgetEntry(const TextureBudgetEntry& a, const TextureBudgetEntry& b)
+{
+    // Per-group ranges with the least recently rendered textures first
+    return a.GroupIndex != b.GroupIndex ? a.GroupIndex < b.GroupIndex : a.LastRenderTime < b.LastRenderTime;
+}
+
+uint64 CalculateResidencyMemoryUsage(const StreamingTexture* texture, int32 residency)
+{
+    if (residency <= 0)
+        return 0;
+    const TextureHeader& header = *texture->GetHeader();
+    const int32 mipOffset = header.MipLevels - residency;
+    const uint64 arraySize = header.IsCubeMap ? 6 : 1;
+    return RenderTools::CalculateTextureMemoryUsage(header.Format, Math::Max(header.Width >> mipOffset, 1), Math::Max(header.Height >> mipOffset, 1), residency) * arraySize;
+}
 
-        // TODO: deallocate or decrease memory usage after timeout? (timeout should be smaller on low mem)
+void UpdateTextureGroupsBudget()
+{
+    PROFILE_CPU_NAMED("Streaming.TextureGroupsBudget");
+
+    // Update per-group stats and collect textures from the groups with a limited memory budget
+    TextureGroupsStats.Resize(Streaming::TextureGroups.Count(), false);
+    for (auto& stats : TextureGroupsStats)
+        stats = TextureGroupStats();
+    Array<TextureBudgetEntry> entries;
+    for (StreamableResource* resource : Resources)
+    {
+        if (resource->GetGroup() != StreamingGroups::Instance()->Textures())
+            continue;
+        const auto texture = (StreamingTexture*)resource;
+        if (!texture->IsInitialized())
+            continue;
+        const int32 groupIndex = texture->GetHeader()->TextureGroup;
+        if (groupIndex < 0 || groupIndex >= TextureGroupsStats.Count())
+            continue;
+        TextureGroupStats& stats = TextureGroupsStats[groupIndex];
+        const uint64 memoryUsage = texture->GetTexture()->GetMemoryUsage();
+        stats.TexturesCount++;
+        stats.CurrentMemoryUsage += memoryUsage;
+        stats.TargetMemoryUsage += CalculateResidencyMemoryUsage(texture, resource->Streaming.TargetResidency);
+        if (Streaming::TextureGroups[groupIndex].MemoryBudget > 0)
+        {
+            entries.Add({ texture, groupIndex, memoryUsage, texture->GetTexture()->LastRenderTime });
+        }
+        else if (resource->Streaming.ResidencyBudgetBias != 0)
+        {
+            // Budget got removed so restore the full quality
+            resource->Streaming.ResidencyBudgetBias = 0;
+            resource->RequestStreamingUpdate();
+        }
     }
+    if (entries.IsEmpty())
+        return;
+    Sorting::QuickSort(entries.Get(), entries.Count(), &SortTextureBudgetEntry);
 
-    // low memory case:
-    // if we are on budget and cannot load everything we have to:
-    // decrease global resources quality scale (per resources group)
-    // decrease asset deallocate timeout
+    // Enforce the budget for each group
+    int32 rangeStart = 0;
+    while (rangeStart < entries.Count())
+    {
+        const int32 groupIndex = entries[rangeStart].GroupIndex;
+        const TextureGroup& group = Streaming::TextureGroups[groupIndex];
+        int32 rangeEnd = rangeStart;
+        uint64 memoryUsage = 0;
+        while (rangeEnd < entries.Count() && entries[rangeEnd].GroupIndex == groupIndex)
+            memoryUsage += entries[rangeEnd++].MemoryUsage;
+        const uint64 budget = (uint64)group.MemoryBudget * 1024 * 1024;
+        if (memoryUsage > budget)
+        {
+            // Over the budget: evict a single mip from the least recently rendered textures until the estimated usage fits
+            for (int32 i = rangeStart; i < rangeEnd && memoryUsage > budget; i++)
+            {
+                StreamingTexture* texture = entries[i].Texture;
+                const int32 residency = texture->GetCurrentResidency();
+                if (residency <= group.MipLevelsMin || texture->Streaming.TargetResidency <= group.MipLevelsMin || texture->Streaming.ResidencyBudgetBias <= -texture->TotalMipLevels())
+                    continue;
+                texture->Streaming.ResidencyBudgetBias--;
+                memoryUsage -= entries[i].MemoryUsage - CalculateResidencyMemoryUsage(texture, residency - 1);
+                texture->RequestStreamingUpdate();
+            }
+        }
+        else
+        {
+            // Below the budget: restore evicted mips on the most recently rendered textures while the estimated usage still fits
+            for (int32 i = rangeEnd - 1; i >= rangeStart; i--)
+            {
+                StreamingTexture* texture = entries[i].Texture;
+                if (texture->Streaming.ResidencyBudgetBias >= 0)
+                    continue;
+                const int32 residency = texture->GetCurrentResidency();
+                if (residency >= texture->TotalMipLevels())
+                    continue;
+                const uint64 restoreCost = CalculateResidencyMemoryUsage(texture, residency + 1) - entries[i].MemoryUsage;
+                if (memoryUsage + restoreCost > budget)
+                    continue;
+                texture->Streaming.ResidencyBudgetBias++;
+                memoryUsage += restoreCost;
+                texture->RequestStreamingUpdate();
+            }
+        }
 
-    // low mem detecting:
-    // for low mem we have to get whole memory budget for a group and then
-    // subtract immutable resources mem usage (like render targets or non dynamic resources)
-    // so we get amount of memory we can distribute and we can detect if we are out of the limit
-    // low mem should be updated once per a few frames
+        // Count the evicted textures for the group stats
+        TextureGroupStats& stats = TextureGroupsStats[groupIndex];
+        for (int32 i = rangeStart; i < rangeEnd; i++)
+        {
+            if (entries[i].Texture->Streaming.ResidencyBudgetBias < 0)
+                stats.EvictedTexturesCount++;
+        }
+        rangeStart = rangeEnd;
+    }
 }
 
 bool StreamingService::Init()
@@ -233,6 +359,20 @@ void StreamingSystem::Job(int32 index)
     int32 resourcesUpdates = Math::Min(MaxResourcesPerUpdate, resourcesCount);
     double currentTime = Platform::GetTimeSeconds();
 
+    // Track the main view motion for the streaming prediction
+    if (MainRenderTask::Instance)
+    {
+        const RenderView& view = MainRenderTask::Instance->View;
+        const Vector3 viewPosition = view.Origin + view.Position;
+        const double dt = currentTime - ViewUpdateTime;
+        if (dt > 0.0 && dt < 1.0)
+            ViewVelocity = (viewPosition - ViewPosition) / dt;
+        else
+            ViewVelocity = Vector3::Zero;
+        ViewPosition = viewPosition;
+        ViewUpdateTime = currentTime;
+    }
+
     // Update high priority queue and then rest of the resources
     // Note: resources in the update queue are updated always, while others only between specified intervals
     int32 resourcesChecks = resourcesCount;
@@ -246,6 +386,12 @@ void StreamingSystem::Job(int32 index)
         // Peek resource
         const auto resource = Resources[LastUpdateResourcesIndex];
 
+#if USE_HEADLESS
+        // Headless server profile never renders so keep textures at the lowest residency
+        if (resource->GetGroup() == StreamingGroups::Instance()->Textures())
+            continue;
+#endif
+
         // Try to update it
         if (now - DateTime(resource->Streaming.LastUpdate) >= ResourceUpdatesInterval && resource->CanBeUpdated())
         {
@@ -254,6 +400,14 @@ void StreamingSystem::Job(int32 index)
         }
     }
 
+    // Update texture groups memory budgets and stats once per a few frames
+    const double TextureGroupsBudgetUpdateInterval = 0.5;
+    if (currentTime - TextureGroupsBudgetUpdateTime >= TextureGroupsBudgetUpdateInterval)
+    {
+        TextureGroupsBudgetUpdateTime = currentTime;
+        UpdateTextureGroupsBudget();
+    }
+
     // TODO: add StreamingManager stats, update time per frame, updates per frame, etc.
 }
 
@@ -291,6 +445,16 @@ void Streaming::RequestStreamingUpdate()
     ResourcesLock.Unlock();
 }
 
+TextureGroupStats Streaming::GetTextureGroupStats(int32 index)
+{
+    TextureGroupStats stats;
+    ResourcesLock.Lock();
+    if (index >= 0 && index < TextureGroupsStats.Count())
+        stats = TextureGroupsStats[index];
+    ResourcesLock.Unlock();
+    return stats;
+}
+
 GPUSampler* Streaming::GetTextureGroupSampler(int32 index)
 {
     GPUSampler* sampler = nullptr;
@@ -18,6 +18,20 @@ DECLARE_SCRIPTING_TYPE_MINIMAL(StreamingStats);
     API_FIELD() int32 StreamingResourcesCount = 0;
 };
 
+// Single texture group residency statistics container.
+API_STRUCT() struct FLAXENGINE_API TextureGroupStats
+{
+DECLARE_SCRIPTING_TYPE_MINIMAL(TextureGroupStats);
+    // Amount of streamable textures that use this group.
+    API_FIELD() int32 TexturesCount = 0;
+    // Amount of textures in this group that had mip levels evicted to fit the group memory budget.
+    API_FIELD() int32 EvictedTexturesCount = 0;
+    // Total GPU memory used by the textures in this group (in bytes).
+    API_FIELD() uint64 CurrentMemoryUsage = 0;
+    // Total GPU memory that the textures in this group will use once streamed to the target residency (in bytes).
+    API_FIELD() uint64 TargetMemoryUsage = 0;
+};
+
 /// <summary>
 /// The content streaming service.
 /// </summary>
@@ -30,6 +44,11 @@ DECLARE_SCRIPTING_TYPE_NO_SPAWN(Streaming);
     /// </summary>
     API_FIELD() static Array<TextureGroup, InlinedAllocation<32>> TextureGroups;
 
+    /// <summary>
+    /// The amount of time (in seconds) to extrapolate the main view position ahead when predicting streaming quality. Resources about to come into range get their residency raised before they pop on screen. Set to 0 to disable the prediction.
+    /// </summary>
+    API_FIELD() static float PredictionTime;
+
     /// <summary>
     /// Gets streaming statistics.
     /// </summary>
@@ -40,6 +59,13 @@ DECLARE_SCRIPTING_TYPE_NO_SPAWN(Streaming);
     /// </summary>
     API_FUNCTION() static void RequestStreamingUpdate();
 
+    /// <summary>
+    /// Gets the residency statistics for a given texture group (memory usage and budget eviction state, see TextureGroup.MemoryBudget). Updated periodically by the streaming service.
+    /// </summary>
+    /// <param name="index">The texture group index.</param>
+    /// <returns>The texture group statistics.</returns>
+    API_FUNCTION() static TextureGroupStats GetTextureGroupStats(int32 index);
+
     /// <summary>
     /// Gets the texture sampler for a given texture group. Sampler objects is managed and cached by streaming service. Returned value is always valid (uses fallback object).
     /// </summary>
@@ -33,6 +33,26 @@ float TexturesStreamingHandler::CalculateTargetQuality(StreamableResource* resou
     return result;
 }
 
+float TexturesStreamingHandler::PredictQuality(StreamableResource* resource, float quality, const Vector3& viewPosition, const Vector3& viewVelocity)
+{
+    ASSERT(resource);
+    auto& texture = *(StreamingTexture*)resource;
+    const TextureHeader& header = *texture.GetHeader();
+    if (header.TextureGroup >= 0 && header.TextureGroup < Streaming::TextureGroups.Count())
+    {
+        const TextureGroup& group = Streaming::TextureGroups[header.TextureGroup];
+        if (quality < group.Quality)
+        {
+            // Fast view motion brings unseen surfaces on screen within the prediction window so blend the invisible-quality drop away to hide the pop-in
+            const float predictedTravel = (float)viewVelocity.Length() * Streaming::PredictionTime;
+            const float MinTravel = 500.0f, MaxTravel = 2000.0f;
+            const float vote = Math::Saturate((predictedTravel - MinTravel) / (MaxTravel - MinTravel));
+            quality = Math::Lerp(quality, group.Quality, vote);
+        }
+    }
+    return quality;
+}
+
 int32 TexturesStreamingHandler::CalculateResidency(StreamableResource* resource, float quality)
 {
     if (quality < ZeroTolerance)
@@ -48,7 +68,8 @@ int32 TexturesStreamingHandler::CalculateResidency(StreamableResource* resource,
     if (header.TextureGroup >= 0 && header.TextureGroup < Streaming::TextureGroups.Count())
     {
         const TextureGroup& group = Streaming::TextureGroups[header.TextureGroup];
-        mipLevels = Math::Clamp(mipLevels + group.MipLevelsBias, group.MipLevelsMin, group.MipLevelsMax);
+        // Apply the group quality bias and the eviction bias from the group memory budget enforcement
+        mipLevels = Math::Clamp(mipLevels + group.MipLevelsBias + resource->Streaming.ResidencyBudgetBias, group.MipLevelsMin, group.MipLevelsMax);
 #if USE_EDITOR
         // Simulate per-platform limit in Editor
         int32 max;
@@ -57,6 +78,9 @@ int32 TexturesStreamingHandler::CalculateResidency(StreamableResource* resource,
 #endif
     }
 
+    // Per-texture limit (eg. set by the terrain for the distant patches)
+    mipLevels = Math::Min(mipLevels, texture.MipLevelsMax);
+
     if (mipLevels > 0 && mipLevels < texture._minMipCountBlockCompressed && texture._isBlockCompressed)
     {
         // Block compressed textures require minimum size of 4
@@ -194,15 +218,19 @@ int32 AudioStreamingHandler::CalculateResidency(StreamableResource* resource, fl
         const auto src = Audio::Sources[sourceIndex];
         if (src->Clip == clip && src->GetState() != AudioSource::States::Stopped)
         {
-            // Stream the current and the next chunk if could be used in a while
+            // Stream the current and the next chunk (double-buffering), plus decode one chunk ahead when playback gets close to the buffers swap
             const int32 chunk = src->_streamingFirstChunk;
             ASSERT(Math::IsInRange(chunk, 0, chunksCount));
             chunksMask[chunk] = true;
-            
+
             const float StreamingDstSec = 2.0f; // TODO: make it configurable via StreamingSettings
-            if (chunk + 1 < chunksCount && src->GetTime() + StreamingDstSec >= clip->GetBufferStartTime(src->_streamingFirstChunk))
+            if (chunk + 1 < chunksCount)
             {
                 chunksMask[chunk + 1] = true;
+                if (chunk + 2 < chunksCount && src->GetTime() + StreamingDstSec >= clip->GetBufferStartTime(chunk + 1))
+                {
+                    chunksMask[chunk + 2] = true;
+                }
             }
         }
     }
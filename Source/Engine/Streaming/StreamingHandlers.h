@@ -12,6 +12,7 @@ class FLAXENGINE_API TexturesStreamingHandler : public IStreamingHandler
 public:
     // [IStreamingHandler]
     float CalculateTargetQuality(StreamableResource* resource, DateTime now, double currentTime) override;
+    float PredictQuality(StreamableResource* resource, float quality, const Vector3& viewPosition, const Vector3& viewVelocity) override;
     int32 CalculateResidency(StreamableResource* resource, float quality) override;
     int32 CalculateRequestedResidency(StreamableResource* resource, int32 targetResidency) override;
 };
@@ -53,6 +53,12 @@ DECLARE_SCRIPTING_TYPE_MINIMAL(TextureGroup);
     API_FIELD(Attributes="EditorOrder(26), Limit(0)")
     float TimeToInvisible = 20.0f;
 
+    /// <summary>
+    /// The maximum amount of GPU memory (in MB) that can be used by the loaded textures in this group. When the budget gets exceeded, the least recently rendered textures lose mip levels first until the group fits. Use 0 for unlimited budget.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(27), Limit(0)")
+    int32 MemoryBudget = 0;
+
     /// <summary>
     /// The minimum amount of loaded mip levels for textures in this group. Defines the amount of the mips that should be always loaded. Higher values decrease streaming usage and keep more mips loaded.
     /// </summary>
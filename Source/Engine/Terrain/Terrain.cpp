@@ -25,6 +25,7 @@ Terrain::Terrain(const SpawnParams& params)
     , _chunkSize(0)
     , _scaleInLightmap(0.1f)
     , _lodDistribution(0.6f)
+    , _adaptiveLodError(0.0f)
     , _boundsExtent(Vector3::Zero)
     , _cachedScale(1.0f)
 {
@@ -261,6 +262,11 @@ void Terrain::SetLODDistribution(float value)
     _lodDistribution = value;
 }
 
+void Terrain::SetAdaptiveLODError(float value)
+{
+    _adaptiveLodError = Math::Clamp(value, 0.0f, 64.0f);
+}
+
 void Terrain::SetScaleInLightmap(float value)
 {
     _scaleInLightmap = value;
@@ -446,7 +452,7 @@ void Terrain::AddPatches(const Int2& numberOfPatches)
         {
             auto patch = _patches[i];
             patch->UpdateTransform();
-            patch->CreateCollision();
+            patch->CreateCollisionAsync();
         }
         UpdateLayerBits();
     }
@@ -474,7 +480,7 @@ void Terrain::AddPatch(const Int2& patchCoord)
     if (IsDuringPlay())
     {
         patch->UpdateTransform();
-        patch->CreateCollision();
+        patch->CreateCollisionAsync();
         UpdateLayerBits();
     }
 
@@ -562,6 +568,10 @@ void Terrain::Draw(RenderContext& renderContext)
     for (int32 patchIndex = 0; patchIndex < _patches.Count(); patchIndex++)
     {
         const auto patch = _patches[patchIndex];
+#if !USE_EDITOR
+        // Limit the streamed texture mips based on the distance to the view (far patches keep only the low-resolution mips resident)
+        patch->UpdateStreamingLOD(renderContext);
+#endif
         BoundingBox bounds(patch->_bounds.Minimum - origin, patch->_bounds.Maximum - origin);
         if (renderContext.View.IsCullingDisabled || frustum.Intersects(bounds))
         {
@@ -664,6 +674,7 @@ void Terrain::Serialize(SerializeStream& stream, const void* otherObj)
     SERIALIZE_MEMBER(LODBias, _lodBias);
     SERIALIZE_MEMBER(ForcedLOD, _forcedLod);
     SERIALIZE_MEMBER(LODDistribution, _lodDistribution);
+    SERIALIZE_MEMBER(AdaptiveLODError, _adaptiveLodError);
     SERIALIZE_MEMBER(ScaleInLightmap, _scaleInLightmap);
     SERIALIZE_MEMBER(BoundsExtent, _boundsExtent);
     SERIALIZE_MEMBER(CollisionLOD, _collisionLod);
@@ -712,6 +723,7 @@ void Terrain::Deserialize(DeserializeStream& stream, ISerializeModifier* modifie
     }
 
     DESERIALIZE_MEMBER(LODDistribution, _lodDistribution);
+    DESERIALIZE_MEMBER(AdaptiveLODError, _adaptiveLodError);
     DESERIALIZE_MEMBER(ScaleInLightmap, _scaleInLightmap);
     DESERIALIZE_MEMBER(BoundsExtent, _boundsExtent);
     DESERIALIZE(Material);
@@ -878,7 +890,7 @@ void Terrain::BeginPlay(SceneBeginData* data)
         const auto patch = _patches[pathIndex];
         if (!patch->HasCollision())
         {
-            patch->CreateCollision();
+            patch->CreateCollisionAsync();
         }
     }
     UpdateLayerBits();
@@ -892,6 +904,7 @@ void Terrain::EndPlay()
     for (int32 pathIndex = 0; pathIndex < _patches.Count(); pathIndex++)
     {
         const auto patch = _patches[pathIndex];
+        patch->WaitForCollisionJob();
         if (patch->HasCollision())
         {
             patch->DestroyCollision();
@@ -56,6 +56,7 @@ private:
     int32 _sceneRenderingKey = -1;
     float _scaleInLightmap;
     float _lodDistribution;
+    float _adaptiveLodError;
     Vector3 _boundsExtent;
     Float3 _cachedScale;
     Array<TerrainPatch*, InlinedAllocation<64>> _patches;
@@ -138,6 +139,20 @@ public:
     /// </summary>
     API_PROPERTY() void SetLODDistribution(float value);
 
+    /// <summary>
+    /// Gets the terrain adaptive LOD target error (in pixels). If set to a value greater than 0, chunk LODs are selected to keep the projected terrain vertex spacing below this screen-space error instead of using the distance-based distribution. Keeps triangle density uniform on screen so distant and flat areas use fewer triangles. Default value is 0 (disabled).
+    /// </summary>
+    API_PROPERTY(Attributes="EditorOrder(75), DefaultValue(0.0f), Limit(0, 64, 0.1f), EditorDisplay(\"Terrain\", \"Adaptive LOD Error\")")
+    FORCE_INLINE float GetAdaptiveLODError() const
+    {
+        return _adaptiveLodError;
+    }
+
+    /// <summary>
+    /// Sets the terrain adaptive LOD target error (in pixels). If set to a value greater than 0, chunk LODs are selected to keep the projected terrain vertex spacing below this screen-space error instead of using the distance-based distribution. Keeps triangle density uniform on screen so distant and flat areas use fewer triangles. Default value is 0 (disabled).
+    /// </summary>
+    API_PROPERTY() void SetAdaptiveLODError(float value);
+
     /// <summary>
     /// Gets the terrain scale in lightmap (applied to all the chunks). Use value higher than 1 to increase baked lighting resolution.
     /// </summary>
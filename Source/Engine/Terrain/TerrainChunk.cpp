@@ -46,7 +46,18 @@ bool TerrainChunk::PrepareDraw(const RenderContext& renderContext)
         // Calculate chunk distance to view
         const auto lodView = (renderContext.LodProxyView ? renderContext.LodProxyView : &renderContext.View);
         const float distance = Float3::Distance(_boundsCenter - lodView->Origin, lodView->Position);
-        lod = (int32)Math::Pow(distance / chunkEdgeSize, lodDistribution);
+        const float adaptiveError = _patch->_terrain->_adaptiveLodError;
+        if (adaptiveError > ZeroTolerance)
+        {
+            // Pick the coarsest LOD that keeps the projected vertex spacing below the target screen-space error (uniform triangle density on screen)
+            const float screenMultiple = 0.5f * Math::Max(lodView->Projection.Values[0][0], lodView->Projection.Values[1][1]);
+            const float spacingPixels = TERRAIN_UNITS_PER_VERTEX * screenMultiple * renderContext.View.ScreenSize.Y / Math::Max(distance, 1.0f);
+            lod = spacingPixels > adaptiveError ? 0 : (int32)Math::FloorLog2((uint32)(adaptiveError / spacingPixels));
+        }
+        else
+        {
+            lod = (int32)Math::Pow(distance / chunkEdgeSize, lodDistribution);
+        }
         lod += lodBias;
 
         //lod = 0;
@@ -14,6 +14,11 @@
 #include "Engine/Level/Level.h"
 #include "Engine/Graphics/Async/GPUTask.h"
 #include "Engine/Threading/Threading.h"
+#include "Engine/Threading/JobSystem.h"
+#if !USE_EDITOR
+#include "Engine/Engine/Engine.h"
+#include "Engine/Graphics/RenderTask.h"
+#endif
 #if TERRAIN_EDITING
 #include "Engine/Core/Math/Packed.h"
 #include "Engine/Graphics/PixelFormatExtensions.h"
@@ -84,8 +89,64 @@ void TerrainPatch::Init(Terrain* terrain, int16 x, int16 z)
     _collisionVertices.Resize(0);
 }
 
+#if !USE_EDITOR
+
+void TerrainPatch::UpdateStreamingLOD(const RenderContext& renderContext)
+{
+    // Cap the amount of the streamed heightmap/splatmap mips for distant patches to reduce the terrain memory usage (chunks clamp the LOD to the resident mips during drawing)
+    const auto heightmap = Heightmap.Get();
+    if (!heightmap || !heightmap->IsLoaded())
+        return;
+    int32 lod = _terrain->_forcedLod;
+    if (lod < 0)
+    {
+        const auto lodView = renderContext.LodProxyView ? renderContext.LodProxyView : &renderContext.View;
+        const float distance = Float3::Distance(_bounds.GetCenter() - lodView->Origin, lodView->Position);
+        const float adaptiveError = _terrain->_adaptiveLodError;
+        if (adaptiveError > ZeroTolerance)
+        {
+            // Match the adaptive screen-space error metric used by the chunks LOD selection
+            const float screenMultiple = 0.5f * Math::Max(lodView->Projection.Values[0][0], lodView->Projection.Values[1][1]);
+            const float spacingPixels = TERRAIN_UNITS_PER_VERTEX * screenMultiple * renderContext.View.ScreenSize.Y / Math::Max(distance, 1.0f);
+            lod = spacingPixels > adaptiveError ? 0 : (int32)Math::FloorLog2((uint32)(adaptiveError / spacingPixels));
+        }
+        else
+        {
+            const float chunkEdgeSize = _terrain->_chunkSize * TERRAIN_UNITS_PER_VERTEX;
+            lod = (int32)Math::Pow(distance / chunkEdgeSize, _terrain->_lodDistribution);
+        }
+        lod += _terrain->_lodBias;
+    }
+    lod = Math::Max(lod, 0);
+
+    // Gather the minimum LOD from all of the views rendered during this frame
+    const uint64 frame = Engine::FrameCount;
+    if (frame == _streamingLODFrame)
+    {
+        _streamingLOD = Math::Min(_streamingLOD, lod);
+        lod = _streamingLOD;
+    }
+    else
+    {
+        _streamingLODFrame = frame;
+        _streamingLOD = lod;
+    }
+
+    // Keep a single mip above the rendered LOD to smooth out the transition when the view gets closer
+    const int32 mipLevelsMax = lod > 1 ? heightmap->StreamingTexture()->TotalMipLevels() - lod + 1 : MAX_int32;
+    heightmap->SetMipLevelsMax(mipLevelsMax);
+    for (auto& splatmap : Splatmap)
+    {
+        if (splatmap)
+            splatmap->SetMipLevelsMax(mipLevelsMax);
+    }
+}
+
+#endif
+
 TerrainPatch::~TerrainPatch()
 {
+    WaitForCollisionJob();
 #if TERRAIN_UPDATING
     SAFE_DELETE(_dataHeightmap);
     for (int32 i = 0; i < TERRAIN_MAX_SPLATMAPS_COUNT; i++)
@@ -2120,6 +2181,34 @@ void TerrainPatch::CreateCollision()
     PhysicsBackend::AddSceneActor(scene, _physicsActor);
 }
 
+void TerrainPatch::CreateCollisionAsync()
+{
+    // Heightfield data loading and deserialization can take a few ms per patch so it's offloaded to a job thread and the collider gets activated when ready
+    _collisionJob = JobSystem::Dispatch([this](int32)
+    {
+        PROFILE_CPU_NAMED("Terrain.CreateCollision");
+        ScopeLock lock(_collisionLocker);
+        if (!HasCollision())
+        {
+            CreateCollision();
+            if (HasCollision())
+            {
+                // Apply the layer bits here as UpdateLayerBits might have run before this job finished
+                PhysicsBackend::SetShapeFilterMask(_physicsShape, _terrain->GetLayerMask(), Physics::LayerMasks[_terrain->GetLayer()]);
+            }
+        }
+    });
+}
+
+void TerrainPatch::WaitForCollisionJob()
+{
+    if (_collisionJob != 0)
+    {
+        JobSystem::Wait(_collisionJob);
+        _collisionJob = 0;
+    }
+}
+
 bool TerrainPatch::CreateHeightField()
 {
     ASSERT(_physicsHeightField == nullptr);
@@ -42,6 +42,7 @@ private:
     void* _physicsHeightField;
     CriticalSection _collisionLocker;
     float _collisionScaleXZ;
+    int64 _collisionJob = 0;
 #if TERRAIN_UPDATING
     Array<float> _cachedHeightMap;
     Array<byte> _cachedHolesMask;
@@ -58,8 +59,15 @@ private:
     Array<Vector3> _collisionTriangles; // TODO: large-worlds
 #endif
     Array<Float3> _collisionVertices; // TODO: large-worlds
+#if !USE_EDITOR
+    uint64 _streamingLODFrame = 0;
+    int32 _streamingLOD = 0;
+#endif
 
     void Init(Terrain* terrain, int16 x, int16 z);
+#if !USE_EDITOR
+    void UpdateStreamingLOD(const RenderContext& renderContext);
+#endif
 
 public:
 
@@ -382,6 +390,16 @@ private:
     /// </summary>
     void CreateCollision();
 
+    /// <summary>
+    /// Creates the collision object for the patch on a job system thread. The collider gets activated when the job finishes. Use WaitForCollisionJob to sync with it.
+    /// </summary>
+    void CreateCollisionAsync();
+
+    /// <summary>
+    /// Waits for the async collision creation job to finish (if any). Call before destroying or recreating the collision.
+    /// </summary>
+    void WaitForCollisionJob();
+
     /// <summary>
     /// Creates the height field from the collision data and caches height field XZ scale parameter.
     /// </summary>
@@ -0,0 +1,203 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "Engine/Animations/AnimationData.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/RandomStream.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Collections/FlatDictionary.h"
+#include "Engine/Core/Collections/Sorting.h"
+#include "Engine/Core/Types/Guid.h"
+#include "Engine/Graphics/RenderTask.h"
+#include "Engine/Renderer/RenderList.h"
+#include "Engine/Threading/JobSystem.h"
+#include <ThirdParty/catch2/catch.hpp>
+
+// Engine hot-paths microbenchmarks for detecting performance regressions between releases.
+// Hidden from the default run, invoke explicitly via the tests filter (eg. '[Benchmark]').
+
+namespace
+{
+    // Sink for the benchmarked results to prevent the compiler from optimizing the measured work out
+    volatile int64 BenchmarkSink = 0;
+
+    // Runs the benchmarked function in timed samples (after a warmup) and reports the median time per operation, so results stay stable between runs.
+    template<typename T>
+    void RunBenchmark(const Char* name, int32 opsPerSample, const T& func)
+    {
+        const int32 WarmupSamples = 3;
+        const int32 SamplesCount = 9;
+        double samples[SamplesCount];
+        for (int32 i = -WarmupSamples; i < SamplesCount; i++)
+        {
+            const double start = Platform::GetTimeSeconds();
+            func();
+            const double elapsed = Platform::GetTimeSeconds() - start;
+            if (i >= 0)
+                samples[i] = elapsed * 1e9 / (double)opsPerSample;
+        }
+        Sorting::QuickSort(samples, SamplesCount);
+        const double median = samples[SamplesCount / 2];
+        LOG(Info, "Benchmark {0}: {1} ns/op (median of {2} samples, min {3}, max {4})", name, (int64)median, SamplesCount, (int64)samples[0], (int64)samples[SamplesCount - 1]);
+    }
+}
+
+TEST_CASE("BenchArray", "[.][Benchmark]")
+{
+    const int32 Count = 100000;
+    Array<int32> array;
+    RunBenchmark(TEXT("Array.Add"), Count, [&array]()
+    {
+        array.Clear();
+        for (int32 i = 0; i < Count; i++)
+            array.Add(i);
+    });
+    RunBenchmark(TEXT("Array.Iterate"), Count, [&array]()
+    {
+        int64 sum = 0;
+        for (int32 i = 0; i < array.Count(); i++)
+            sum += array.Get()[i];
+        BenchmarkSink += sum;
+    });
+}
+
+TEST_CASE("BenchDictionary", "[.][Benchmark]")
+{
+    const int32 Count = 100000;
+    Dictionary<int32, int32> dictionary;
+    RunBenchmark(TEXT("Dictionary.Add"), Count, [&dictionary]()
+    {
+        dictionary.Clear();
+        for (int32 i = 0; i < Count; i++)
+            dictionary.Add(i * 7919, i);
+    });
+    RunBenchmark(TEXT("Dictionary.Find"), Count, [&dictionary]()
+    {
+        int64 sum = 0;
+        for (int32 i = 0; i < Count; i++)
+        {
+            int32 value;
+            if (dictionary.TryGet(i * 7919, value))
+                sum += value;
+        }
+        BenchmarkSink += sum;
+    });
+}
+
+TEST_CASE("BenchFlatDictionary", "[.][Benchmark]")
+{
+    // Asset-registry style workload: 100k GUID keys filled once then queried a lot (the Content assets table), with the same run over Dictionary for comparison
+    const int32 Count = 100000;
+    RandomStream rand(13);
+    Array<Guid> keys;
+    keys.Resize(Count);
+    for (int32 i = 0; i < Count; i++)
+        keys[i] = Guid(rand.GetUnsignedInt(), rand.GetUnsignedInt(), rand.GetUnsignedInt(), rand.GetUnsignedInt());
+    FlatDictionary<Guid, int32> flat;
+    RunBenchmark(TEXT("FlatDictionary.Add(Guid)"), Count, [&flat, &keys]()
+    {
+        flat.Clear();
+        for (int32 i = 0; i < Count; i++)
+            flat.Add(keys[i], i);
+    });
+    RunBenchmark(TEXT("FlatDictionary.Find(Guid)"), Count, [&flat, &keys]()
+    {
+        int64 sum = 0;
+        for (int32 i = 0; i < Count; i++)
+        {
+            int32 value;
+            if (flat.TryGet(keys[i], value))
+                sum += value;
+        }
+        BenchmarkSink += sum;
+    });
+    Dictionary<Guid, int32> dictionary;
+    RunBenchmark(TEXT("Dictionary.Add(Guid)"), Count, [&dictionary, &keys]()
+    {
+        dictionary.Clear();
+        for (int32 i = 0; i < Count; i++)
+            dictionary.Add(keys[i], i);
+    });
+    RunBenchmark(TEXT("Dictionary.Find(Guid)"), Count, [&dictionary, &keys]()
+    {
+        int64 sum = 0;
+        for (int32 i = 0; i < Count; i++)
+        {
+            int32 value;
+            if (dictionary.TryGet(keys[i], value))
+                sum += value;
+        }
+        BenchmarkSink += sum;
+    });
+}
+
+TEST_CASE("BenchJobSystemDispatch", "[.][Benchmark]")
+{
+    // Measures the scheduling overhead of a single job dispatch and wait (the job itself is empty)
+    const int32 Count = 256;
+    Function<void(int32)> job = [](int32)
+    {
+    };
+    RunBenchmark(TEXT("JobSystem.Dispatch"), Count, [&job]()
+    {
+        for (int32 i = 0; i < Count; i++)
+        {
+            const int64 label = JobSystem::Dispatch(job);
+            JobSystem::Wait(label);
+        }
+    });
+}
+
+TEST_CASE("BenchSortDrawCalls", "[.][Benchmark]")
+{
+    // Synthetic draw calls list with randomized sort keys (no GPU resources needed to exercise the sorting and batching)
+    const int32 Count = 20000;
+    RandomStream rand(101);
+    RenderList* list = RenderList::GetFromPool();
+    for (int32 i = 0; i < Count; i++)
+    {
+        DrawCall drawCall;
+        Platform::MemoryClear(&drawCall, sizeof(drawCall));
+        drawCall.SortKey = ((uint64)rand.GetUnsignedInt() << 32) | rand.GetUnsignedInt();
+        drawCall.InstanceCount = 1;
+        list->DrawCalls.Add(drawCall);
+    }
+    RenderContext renderContext;
+    DrawCallsList& drawCallsList = list->DrawCallsLists[(int32)DrawCallsListType::GBuffer];
+    RunBenchmark(TEXT("RenderList.SortDrawCalls"), Count, [&]()
+    {
+        drawCallsList.Indices.Clear();
+        for (int32 i = 0; i < Count; i++)
+            drawCallsList.Indices.Add(i);
+        list->SortDrawCalls(renderContext, false, DrawCallsListType::GBuffer);
+    });
+    RenderList::ReturnToPool(list);
+}
+
+TEST_CASE("BenchAnimationSampling", "[.][Benchmark]")
+{
+    // Node animation channel with dense keyframes evaluated at randomized times (the skeletal animation sampling hot path)
+    const int32 KeyframesCount = 240;
+    NodeAnimationData channel;
+    auto& positionKeys = channel.Position.GetKeyframes();
+    auto& rotationKeys = channel.Rotation.GetKeyframes();
+    auto& scaleKeys = channel.Scale.GetKeyframes();
+    RandomStream rand(101);
+    for (int32 i = 0; i < KeyframesCount; i++)
+    {
+        const float time = (float)i;
+        positionKeys.Add({ time, rand.GetVector3() * 100.0f });
+        rotationKeys.Add({ time, Quaternion::Euler(rand.GetFraction() * 360.0f, rand.GetFraction() * 360.0f, 0.0f) });
+        scaleKeys.Add({ time, Float3::One });
+    }
+    const int32 Count = 100000;
+    RunBenchmark(TEXT("Animation.Sample"), Count, [&]()
+    {
+        Transform transform = Transform::Identity;
+        for (int32 i = 0; i < Count; i++)
+        {
+            channel.EvaluateAll(rand.GetFraction() * (float)KeyframesCount, &transform, true);
+        }
+        BenchmarkSink += (int64)transform.Translation.X;
+    });
+}
@@ -0,0 +1,46 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "Engine/Serialization/BinaryJson.h"
+#include "Engine/Serialization/Json.h"
+#include "Engine/Serialization/JsonWriters.h"
+#include "Engine/Serialization/MemoryReadStream.h"
+#include "Engine/Serialization/MemoryWriteStream.h"
+#include <ThirdParty/catch2/catch.hpp>
+
+TEST_CASE("BinaryJson")
+{
+    SECTION("Test Round Trip")
+    {
+        // Parse the reference document from text
+        const char* json = "{\"Name\":\"Test\",\"Int\":-13,\"Uint64\":18446744073709551615,\"Float\":0.125,\"Flag\":true,\"Nothing\":null,\"List\":[1,2.5,\"Test\",{\"Name\":\"Nested\"}],\"Child\":{\"Empty\":{},\"None\":[]}}";
+        ISerializable::SerializeDocument document;
+        document.Parse(json);
+        REQUIRE(!document.HasParseError());
+
+        // Serialize to the binary form and deserialize it back
+        MemoryWriteStream output;
+        BinaryJson::Serialize(output, document);
+        CHECK(BinaryJson::IsBinaryJson(output.GetHandle(), output.GetPosition()));
+        MemoryReadStream input(output.GetHandle(), output.GetPosition());
+        ISerializable::SerializeDocument result;
+        REQUIRE(!BinaryJson::Deserialize(input, result));
+
+        // Compare both documents via compact text form
+        rapidjson_flax::StringBuffer bufferA;
+        rapidjson_flax::Writer<rapidjson_flax::StringBuffer> writerA(bufferA);
+        document.Accept(writerA);
+        rapidjson_flax::StringBuffer bufferB;
+        rapidjson_flax::Writer<rapidjson_flax::StringBuffer> writerB(bufferB);
+        result.Accept(writerB);
+        CHECK(StringAnsiView(bufferA.GetString(), (int32)bufferA.GetSize()) == StringAnsiView(bufferB.GetString(), (int32)bufferB.GetSize()));
+    }
+
+    SECTION("Test Invalid Data")
+    {
+        byte data[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+        CHECK(!BinaryJson::IsBinaryJson(data, sizeof(data)));
+        MemoryReadStream input(data, sizeof(data));
+        ISerializable::SerializeDocument result;
+        CHECK(BinaryJson::Deserialize(input, result));
+    }
+}
@@ -3,6 +3,9 @@
 #include "Engine/Core/RandomStream.h"
 #include "Engine/Core/Collections/Array.h"
 #include "Engine/Core/Collections/BitArray.h"
+#include "Engine/Core/Collections/ChunkedArray.h"
+#include "Engine/Core/Collections/FlatDictionary.h"
+#include "Engine/Platform/Platform.h"
 #include <ThirdParty/catch2/catch.hpp>
 
 TEST_CASE("Array")
@@ -107,4 +110,173 @@ TEST_CASE("BitArray")
         a1 = testData;
         CHECK(a1 == testData);
     }
+
+    SECTION("Test Bit Operations")
+    {
+        BitArray<> a1, a2;
+        a1.Resize(100);
+        a2.Resize(100);
+        a1.SetAll(false);
+        a2.SetAll(false);
+        for (int32 i = 0; i < 100; i += 2)
+            a1.Set(i, true);
+        for (int32 i = 0; i < 100; i += 3)
+            a2.Set(i, true);
+        CHECK(a1.CountBits() == 50);
+        CHECK(a2.CountBits() == 34);
+
+        BitArray<> a3(a1);
+        a3.And(a2);
+        CHECK(a3.CountBits() == 17);
+        for (int32 i = 0; i < 100; i++)
+            CHECK(a3.Get(i) == (i % 6 == 0));
+
+        BitArray<> a4(a1);
+        a4.Or(a2);
+        for (int32 i = 0; i < 100; i++)
+            CHECK(a4.Get(i) == (i % 2 == 0 || i % 3 == 0));
+
+        BitArray<> a5(a1);
+        a5.AndNot(a2);
+        for (int32 i = 0; i < 100; i++)
+            CHECK(a5.Get(i) == (i % 2 == 0 && i % 3 != 0));
+
+        CHECK(a1.FindFirstZero() == 1);
+        a4.SetAll(true);
+        CHECK(a4.FindFirstZero() == -1);
+        a4.Set(70, false);
+        CHECK(a4.FindFirstZero() == 70);
+
+        int32 expected = 0;
+        for (auto it = a1.SetBitsBegin(); it != a1.SetBitsEnd(); ++it)
+        {
+            CHECK(*it == expected);
+            expected += 2;
+        }
+        CHECK(expected == 100);
+    }
+}
+
+TEST_CASE("ChunkedArray")
+{
+    ChunkedArray<int32, 256> data;
+    int64 sum = 0;
+    for (int32 i = 0; i < 1000; i++)
+    {
+        data.Add(i);
+        sum += i;
+    }
+    CHECK(data.Count() == 1000);
+    CHECK(data.ChunksCount() == 4);
+
+    SECTION("Test Chunks Access")
+    {
+        int32 count = 0;
+        for (int32 chunkIndex = 0; chunkIndex < data.ChunksCount(); chunkIndex++)
+        {
+            const Span<int32> chunk = data.GetChunk(chunkIndex);
+            for (int32 i = 0; i < chunk.Length(); i++)
+                CHECK(chunk.Get()[i] == count + i);
+            count += chunk.Length();
+        }
+        CHECK(count == 1000);
+    }
+
+    SECTION("Test Visit")
+    {
+        int64 visitSum = 0;
+        data.Visit([&visitSum](Span<int32> chunk)
+        {
+            for (int32 i = 0; i < chunk.Length(); i++)
+                visitSum += chunk.Get()[i];
+        });
+        CHECK(visitSum == sum);
+    }
+
+    SECTION("Test Visit Parallel")
+    {
+        volatile int64 visitSum = 0;
+        data.VisitParallel([&visitSum](Span<int32> chunk)
+        {
+            int64 chunkSum = 0;
+            for (int32 i = 0; i < chunk.Length(); i++)
+                chunkSum += chunk.Get()[i];
+            Platform::InterlockedAdd(&visitSum, chunkSum);
+        });
+        CHECK(Platform::AtomicRead(&visitSum) == sum);
+    }
+}
+
+TEST_CASE("FlatDictionary")
+{
+    SECTION("Test Add And Find")
+    {
+        FlatDictionary<int32, int32> d;
+        for (int32 i = 0; i < 1000; i++)
+            d.Add(i, i * 3);
+        CHECK(d.Count() == 1000);
+        for (int32 i = 0; i < 1000; i++)
+        {
+            int32 value;
+            CHECK(d.ContainsKey(i));
+            CHECK(d.TryGet(i, value));
+            CHECK(value == i * 3);
+        }
+        CHECK(!d.ContainsKey(1000));
+        CHECK(!d.ContainsKey(-1));
+    }
+
+    SECTION("Test Remove And Reuse")
+    {
+        FlatDictionary<int32, int32> d;
+        for (int32 i = 0; i < 100; i++)
+            d.Add(i, i);
+        for (int32 i = 0; i < 100; i += 2)
+            CHECK(d.Remove(i));
+        CHECK(d.Count() == 50);
+        for (int32 i = 0; i < 100; i++)
+            CHECK(d.ContainsKey(i) == (i % 2 == 1));
+        for (int32 i = 0; i < 100; i += 2)
+            d.Add(i, i);
+        CHECK(d.Count() == 100);
+        CHECK(!d.Remove(1000));
+    }
+
+    SECTION("Test Iterator")
+    {
+        FlatDictionary<int32, int32> d;
+        int32 sum = 0;
+        for (int32 i = 1; i <= 64; i++)
+        {
+            d[i] = i;
+            sum += i;
+        }
+        int32 itSum = 0, itCount = 0;
+        for (const auto& e : d)
+        {
+            itSum += e.Value;
+            itCount++;
+        }
+        CHECK(itCount == 64);
+        CHECK(itSum == sum);
+    }
+
+    SECTION("Test Copy And Move")
+    {
+        FlatDictionary<int32, int32> d1;
+        for (int32 i = 0; i < 200; i++)
+            d1.Add(i, i + 7);
+        FlatDictionary<int32, int32> d2(d1);
+        CHECK(d2.Count() == 200);
+        FlatDictionary<int32, int32> d3(MoveTemp(d1));
+        CHECK(d3.Count() == 200);
+        for (int32 i = 0; i < 200; i++)
+        {
+            int32 value;
+            CHECK(d2.TryGet(i, value));
+            CHECK(value == i + 7);
+            CHECK(d3.TryGet(i, value));
+            CHECK(value == i + 7);
+        }
+    }
 }
@@ -226,3 +226,53 @@ TEST_CASE("Transform")
         }
     }
 }
+
+TEST_CASE("MatrixBatch")
+{
+    SECTION("Test MultiplyArray")
+    {
+        RandomStream rand(13);
+        Matrix left[8], right[8], results[8];
+        for (int32 i = 0; i < 8; i++)
+        {
+            for (int32 j = 0; j < 16; j++)
+            {
+                left[i].Raw[j] = rand.GetFraction() * 4.0f - 2.0f;
+                right[i].Raw[j] = rand.GetFraction() * 4.0f - 2.0f;
+            }
+        }
+        Matrix::MultiplyArray(left, right, results, 8);
+        for (int32 i = 0; i < 8; i++)
+        {
+            Matrix expected;
+            Matrix::Multiply(left[i], right[i], expected);
+            for (int32 j = 0; j < 16; j++)
+                CHECK(Math::NearEqual(results[i].Raw[j], expected.Raw[j]));
+        }
+        Matrix::MultiplyArray(left, right[0], results, 8);
+        for (int32 i = 0; i < 8; i++)
+        {
+            Matrix expected;
+            Matrix::Multiply(left[i], right[0], expected);
+            for (int32 j = 0; j < 16; j++)
+                CHECK(Math::NearEqual(results[i].Raw[j], expected.Raw[j]));
+        }
+    }
+
+    SECTION("Test TransformPositionArray")
+    {
+        RandomStream rand(17);
+        Matrix m;
+        for (int32 j = 0; j < 16; j++)
+            m.Raw[j] = rand.GetFraction() * 4.0f - 2.0f;
+        Float3 points[16], results[16];
+        for (int32 i = 0; i < 16; i++)
+            points[i] = Float3(rand.GetFraction(), rand.GetFraction(), rand.GetFraction()) * 100.0f;
+        Matrix::TransformPositionArray(points, m, results, 16);
+        for (int32 i = 0; i < 16; i++)
+        {
+            const Float4 expected = Matrix::TransformPosition(m, points[i]);
+            CHECK(Float3::NearEqual(results[i], Float3(expected.X, expected.Y, expected.Z), 0.001f));
+        }
+    }
+}
@@ -0,0 +1,180 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#if COMPILE_WITH_NAV_MESH_BUILDER
+
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Platform/Platform.h"
+#include "Engine/Threading/JobSystem.h"
+#include <ThirdParty/recastnavigation/Recast.h>
+#include <ThirdParty/recastnavigation/DetourNavMeshBuilder.h>
+#include <ThirdParty/recastnavigation/DetourNavMesh.h>
+#include <ThirdParty/catch2/catch.hpp>
+
+namespace
+{
+    void InitTestConfig(rcConfig& config)
+    {
+        Platform::MemoryClear(&config, sizeof(config));
+        config.cs = 30.0f;
+        config.ch = 20.0f;
+        config.walkableSlopeAngle = 60.0f;
+        config.walkableHeight = (int)(144.0f / config.ch + 0.99f);
+        config.walkableClimb = (int)(35.0f / config.ch);
+        config.walkableRadius = (int)(34.0f / config.cs + 0.99f);
+        config.maxEdgeLen = (int)(1200.0f / config.cs);
+        config.maxSimplificationError = 1.3f;
+        config.minRegionArea = rcSqr(0);
+        config.mergeRegionArea = rcSqr(20);
+        config.maxVertsPerPoly = 6;
+        config.detailSampleDist = config.cs * 6.0f;
+        config.detailSampleMaxError = config.ch * 1.0f;
+        config.borderSize = config.walkableRadius + 3;
+        config.tileSize = 64;
+        config.width = config.tileSize + config.borderSize * 2;
+        config.height = config.tileSize + config.borderSize * 2;
+    }
+
+    // Builds a single synthetic navmesh tile through the full Recast pipeline (rasterize, filter, compact, erode, regions, contours, poly mesh, Detour data). Returns true if failed.
+    bool BuildSyntheticTile(const rcConfig& configTemplate, int32 x, int32 y, int32* polyCount = nullptr)
+    {
+        rcConfig config = configTemplate;
+        const float tileWorldSize = (float)config.tileSize * config.cs;
+        const float border = (1.0f + (float)config.borderSize) * config.cs;
+        config.bmin[0] = (float)x * tileWorldSize - border;
+        config.bmin[1] = -200.0f;
+        config.bmin[2] = (float)y * tileWorldSize - border;
+        config.bmax[0] = (float)(x + 1) * tileWorldSize + border;
+        config.bmax[1] = 200.0f;
+        config.bmax[2] = (float)(y + 1) * tileWorldSize + border;
+
+        rcContext context;
+        bool failed = true;
+        rcHeightfield* heightfield = rcAllocHeightfield();
+        rcCompactHeightfield* compactHeightfield = nullptr;
+        rcContourSet* contourSet = nullptr;
+        rcPolyMesh* polyMesh = nullptr;
+        rcPolyMeshDetail* detailMesh = nullptr;
+        if (heightfield && rcCreateHeightfield(&context, *heightfield, config.width, config.height, config.bmin, config.bmax, config.cs, config.ch))
+        {
+            // Rasterize a procedural wavy ground so every tile has non-trivial spans
+            const int32 gridSize = 48;
+            const float stepX = (config.bmax[0] - config.bmin[0]) / gridSize;
+            const float stepZ = (config.bmax[2] - config.bmin[2]) / gridSize;
+            for (int32 gz = 0; gz < gridSize; gz++)
+            {
+                for (int32 gx = 0; gx < gridSize; gx++)
+                {
+                    const float x0 = config.bmin[0] + gx * stepX, x1 = x0 + stepX;
+                    const float z0 = config.bmin[2] + gz * stepZ, z1 = z0 + stepZ;
+                    const float y00 = Math::Sin(x0 * 0.001f) * Math::Cos(z0 * 0.001f) * 50.0f;
+                    const float y01 = Math::Sin(x0 * 0.001f) * Math::Cos(z1 * 0.001f) * 50.0f;
+                    const float y10 = Math::Sin(x1 * 0.001f) * Math::Cos(z0 * 0.001f) * 50.0f;
+                    const float y11 = Math::Sin(x1 * 0.001f) * Math::Cos(z1 * 0.001f) * 50.0f;
+                    const float v00[3] = { x0, y00, z0 };
+                    const float v01[3] = { x0, y01, z1 };
+                    const float v10[3] = { x1, y10, z0 };
+                    const float v11[3] = { x1, y11, z1 };
+                    rcRasterizeTriangle(&context, v00, v01, v11, RC_WALKABLE_AREA, *heightfield);
+                    rcRasterizeTriangle(&context, v00, v11, v10, RC_WALKABLE_AREA, *heightfield);
+                }
+            }
+
+            rcFilterLowHangingWalkableObstacles(&context, config.walkableClimb, *heightfield);
+            rcFilterLedgeSpans(&context, config.walkableHeight, config.walkableClimb, *heightfield);
+            rcFilterWalkableLowHeightSpans(&context, config.walkableHeight, *heightfield);
+
+            compactHeightfield = rcAllocCompactHeightfield();
+            if (compactHeightfield &&
+                rcBuildCompactHeightfield(&context, config.walkableHeight, config.walkableClimb, *heightfield, *compactHeightfield) &&
+                rcErodeWalkableArea(&context, config.walkableRadius, *compactHeightfield) &&
+                rcBuildDistanceField(&context, *compactHeightfield) &&
+                rcBuildRegions(&context, *compactHeightfield, config.borderSize, config.minRegionArea, config.mergeRegionArea))
+            {
+                contourSet = rcAllocContourSet();
+                polyMesh = rcAllocPolyMesh();
+                detailMesh = rcAllocPolyMeshDetail();
+                if (contourSet && polyMesh && detailMesh &&
+                    rcBuildContours(&context, *compactHeightfield, config.maxSimplificationError, config.maxEdgeLen, *contourSet) &&
+                    rcBuildPolyMesh(&context, *contourSet, config.maxVertsPerPoly, *polyMesh) &&
+                    rcBuildPolyMeshDetail(&context, *polyMesh, *compactHeightfield, config.detailSampleDist, config.detailSampleMaxError, *detailMesh))
+                {
+                    for (int32 i = 0; i < polyMesh->npolys; i++)
+                        polyMesh->flags[i] = polyMesh->areas[i] != RC_NULL_AREA ? 1 : 0;
+
+                    dtNavMeshCreateParams params;
+                    Platform::MemoryClear(&params, sizeof(params));
+                    params.verts = polyMesh->verts;
+                    params.vertCount = polyMesh->nverts;
+                    params.polys = polyMesh->polys;
+                    params.polyAreas = polyMesh->areas;
+                    params.polyFlags = polyMesh->flags;
+                    params.polyCount = polyMesh->npolys;
+                    params.nvp = polyMesh->nvp;
+                    params.detailMeshes = detailMesh->meshes;
+                    params.detailVerts = detailMesh->verts;
+                    params.detailVertsCount = detailMesh->nverts;
+                    params.detailTris = detailMesh->tris;
+                    params.detailTriCount = detailMesh->ntris;
+                    params.walkableHeight = (float)config.walkableHeight * config.ch;
+                    params.walkableRadius = (float)config.walkableRadius * config.cs;
+                    params.walkableClimb = (float)config.walkableClimb * config.ch;
+                    params.tileX = x;
+                    params.tileY = y;
+                    rcVcopy(params.bmin, polyMesh->bmin);
+                    rcVcopy(params.bmax, polyMesh->bmax);
+                    params.cs = config.cs;
+                    params.ch = config.ch;
+                    params.buildBvTree = false;
+                    unsigned char* navData = nullptr;
+                    int navDataSize = 0;
+                    if (dtCreateNavMeshData(&params, &navData, &navDataSize))
+                    {
+                        if (polyCount)
+                            *polyCount = polyMesh->npolys;
+                        dtFree(navData);
+                        failed = false;
+                    }
+                }
+            }
+        }
+        rcFreeHeightField(heightfield);
+        rcFreeCompactHeightfield(compactHeightfield);
+        rcFreeContourSet(contourSet);
+        rcFreePolyMesh(polyMesh);
+        rcFreePolyMeshDetail(detailMesh);
+        return failed;
+    }
+}
+
+TEST_CASE("NavMeshTileBuild")
+{
+    rcConfig config;
+    InitTestConfig(config);
+    int32 polyCount = 0;
+    CHECK(!BuildSyntheticTile(config, 0, 0, &polyCount));
+    CHECK(polyCount > 0);
+}
+
+// Navmesh tiles build throughput benchmark. Hidden from the default run, invoke explicitly via the tests filter (eg. 'NavMeshTileBuildThroughput').
+TEST_CASE("NavMeshTileBuildThroughput", "[.][Benchmark]")
+{
+    rcConfig config;
+    InitTestConfig(config);
+    const int32 TilesCount = 64;
+    volatile int64 failedCount = 0;
+    const double start = Platform::GetTimeSeconds();
+    JobSystem::ParallelFor(0, TilesCount, 1, [&config, &failedCount](int32 begin, int32 end)
+    {
+        for (int32 i = begin; i < end; i++)
+        {
+            if (BuildSyntheticTile(config, i & 7, i >> 3))
+                Platform::InterlockedIncrement(&failedCount);
+        }
+    });
+    const double elapsed = Platform::GetTimeSeconds() - start;
+    CHECK(failedCount == 0);
+    LOG(Info, "Built {0} navmesh tiles in {1} ms ({2} tiles/s, {3} job system workers)", TilesCount, (int32)(elapsed * 1000.0), (int32)((double)TilesCount / Math::Max(elapsed, 0.001)), JobSystem::GetThreadsCount());
+}
+
+#endif
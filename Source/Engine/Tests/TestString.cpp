@@ -222,6 +222,69 @@ TEST_CASE("String Starts/EndsWith works")
     }
 }
 
+TEST_CASE("String Small String Optimization works")
+{
+    SECTION("Append across inline capacity")
+    {
+        String str;
+        for (int32 i = 0; i < 40; i++)
+        {
+            str += TEXT('a');
+            CHECK(str.Length() == i + 1);
+            CHECK(str[i] == TEXT('a'));
+            CHECK(str[str.Length()] == 0);
+        }
+    }
+
+    SECTION("Move short and long strings")
+    {
+        String shortStr(TEXT("short"));
+        String movedShort(MoveTemp(shortStr));
+        CHECK(movedShort == TEXT("short"));
+        CHECK(shortStr.IsEmpty());
+
+        String longStr(TEXT("this text is too long to fit into the inline storage"));
+        String movedLong(MoveTemp(longStr));
+        CHECK(movedLong == TEXT("this text is too long to fit into the inline storage"));
+        CHECK(longStr.IsEmpty());
+
+        String assigned(TEXT("old contents"));
+        assigned = MoveTemp(movedShort);
+        CHECK(assigned == TEXT("short"));
+        assigned = MoveTemp(movedLong);
+        CHECK(assigned == TEXT("this text is too long to fit into the inline storage"));
+    }
+
+    SECTION("Insert and Remove around inline capacity")
+    {
+        String str(TEXT("0123456789"));
+        str.Insert(5, String(TEXT("abcdefghij")));
+        CHECK(str == TEXT("01234abcdefghij56789"));
+        str.Remove(5, 10);
+        CHECK(str == TEXT("0123456789"));
+        str.Remove(0, 5);
+        CHECK(str == TEXT("56789"));
+    }
+
+    SECTION("Resize within inline storage")
+    {
+        String str(TEXT("hello world"));
+        str.Resize(5);
+        CHECK(str == TEXT("hello"));
+        str.Resize(40);
+        str.Resize(5);
+        CHECK(str.Length() == 5);
+        CHECK(StringView(str.Get(), 5) == TEXT("hello"));
+    }
+
+    SECTION("Replace growing past inline capacity")
+    {
+        String str(TEXT("a-b-c"));
+        CHECK(str.Replace(TEXT("-"), TEXT("---long separator---"), StringSearchCase::CaseSensitive) == 2);
+        CHECK(str == TEXT("a---long separator---b---long separator---c"));
+    }
+}
+
 TEST_CASE("String Compare works")
 {
     SECTION("String")
@@ -0,0 +1,120 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Platform/Platform.h"
+#include "Engine/Threading/ConcurrentQueue.h"
+#include "Engine/Threading/JobSystem.h"
+#include "Engine/Threading/Task.h"
+#include <ThirdParty/catch2/catch.hpp>
+
+TEST_CASE("Task")
+{
+    SECTION("ContinueWithPooled")
+    {
+        volatile int64 counter = 0;
+        Function<void()> work = [&counter]() { Platform::InterlockedIncrement(&counter); };
+        Task* task = Task::StartNew(work);
+        Task* continuation = task->ContinueWithPooled([&counter]() { Platform::InterlockedIncrement(&counter); });
+        CHECK(!continuation->Wait(10000.0));
+        CHECK(Platform::AtomicRead(&counter) == 2);
+    }
+
+    SECTION("PooledTaskKeepsEndedState")
+    {
+        Function<void()> empty = []() {};
+        Task* task = Task::StartNew(empty);
+        Task* continuation = task->ContinueWithPooled([]() {});
+        CHECK(!continuation->Wait(10000.0));
+
+        // Acquiring and running more pooled continuations must not reset the ended task under a stale reference (ended tasks wait out a reuse grace period)
+        for (int32 i = 0; i < 8; i++)
+        {
+            Task* other = Task::StartNew(empty);
+            Task* otherContinuation = other->ContinueWithPooled([]() {});
+            CHECK(!otherContinuation->Wait(10000.0));
+        }
+        CHECK(continuation->GetState() == TaskState::Finished);
+    }
+
+    SECTION("WhenAll")
+    {
+        volatile int64 counter = 0;
+        Function<void()> work = [&counter]() { Platform::InterlockedIncrement(&counter); };
+        Array<Task*> tasks;
+        for (int32 i = 0; i < 8; i++)
+            tasks.Add(Task::StartNew(work));
+        Task* all = Task::WhenAll(tasks);
+        CHECK(!all->Wait(10000.0));
+        CHECK(Platform::AtomicRead(&counter) == 8);
+        CHECK(all->GetState() == TaskState::Finished);
+    }
+
+    SECTION("WhenAny")
+    {
+        Function<void()> fast = []() {};
+        Function<void()> slow = []() { Platform::Sleep(50); };
+        Array<Task*> tasks;
+        tasks.Add(Task::StartNew(slow));
+        tasks.Add(Task::StartNew(fast));
+        Task* any = Task::WhenAny(tasks);
+        CHECK(!any->Wait(10000.0));
+        CHECK(!Task::WaitAll(tasks, 10000.0));
+
+        // The combinator task has to stay pollable after all the inputs ended (recycling is deferred)
+        CHECK(any->GetState() == TaskState::Finished);
+    }
+}
+
+TEST_CASE("BoundedConcurrentQueue")
+{
+    SECTION("EnqueueDequeue")
+    {
+        BoundedConcurrentQueue<int32> queue(8);
+        CHECK(queue.Capacity() == 8);
+        int32 item;
+        CHECK(!queue.TryDequeue(item));
+        for (int32 i = 0; i < 8; i++)
+            CHECK(queue.TryEnqueue(i));
+        CHECK(!queue.TryEnqueue(8));
+        CHECK(queue.Count() == 8);
+        for (int32 i = 0; i < 8; i++)
+        {
+            CHECK(queue.TryDequeue(item));
+            CHECK(item == i);
+        }
+        CHECK(!queue.TryDequeue(item));
+        CHECK(queue.Count() == 0);
+    }
+
+    SECTION("WrapAround")
+    {
+        BoundedConcurrentQueue<int32> queue(4);
+        int32 item;
+        for (int32 i = 0; i < 100; i++)
+        {
+            CHECK(queue.TryEnqueue(i));
+            CHECK(queue.TryDequeue(item));
+            CHECK(item == i);
+        }
+    }
+
+    SECTION("ParallelEnqueue")
+    {
+        const int32 Workers = 4;
+        const int32 PerWorker = 1000;
+        BoundedConcurrentQueue<int32> queue(Workers * PerWorker);
+        Function<void(int32)> job = [&](int32 worker)
+        {
+            for (int32 i = 0; i < PerWorker; i++)
+                queue.TryEnqueue(worker * PerWorker + i);
+        };
+        JobSystem::Wait(JobSystem::Dispatch(job, Workers));
+        CHECK(queue.Count() == Workers * PerWorker);
+        int64 sum = 0;
+        int32 item;
+        while (queue.TryDequeue(item))
+            sum += item;
+        const int64 count = Workers * PerWorker;
+        CHECK(sum == count * (count - 1) / 2);
+    }
+}
@@ -3,6 +3,8 @@
 #pragma once
 
 #include "Engine/Core/Memory/Memory.h"
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Platform/Platform.h"
 #define MOODYCAMEL_EXCEPTIONS_ENABLED 0
 #include <ThirdParty/concurrentqueue.h>
 
@@ -64,3 +66,162 @@ public:
         enqueue(item);
     }
 };
+
+/// <summary>
+/// Bounded lock-free MPMC (multi-producer multi-consumer) queue implemented as a ring buffer with per-slot sequence numbers (Vyukov-style).
+/// All storage is allocated once in the constructor so enqueue/dequeue never allocate, which avoids the latency jitter of the unbounded queue under load spikes.
+/// Use it where the queue capacity is known up-front; Enqueue fails when the ring is full.
+/// </summary>
+template<typename T>
+class BoundedConcurrentQueue
+{
+private:
+    struct Slot
+    {
+        volatile int64 Sequence;
+        T Item;
+    };
+
+    // Producer and consumer cursors are padded apart to avoid false sharing (64 = common cache line size)
+    Slot* _slots;
+    int64 _capacityMask;
+    char _pad0[64];
+    volatile int64 _enqueuePos = 0;
+    char _pad1[64];
+    volatile int64 _dequeuePos = 0;
+#if COMPILE_WITH_PROFILER
+    char _pad2[64];
+    volatile int64 _contentionCount = 0;
+#endif
+
+public:
+    /// <summary>
+    /// Initializes the queue with a fixed capacity (rounded up to the next power of two).
+    /// </summary>
+    /// <param name="capacity">The maximum amount of the items in the queue.</param>
+    explicit BoundedConcurrentQueue(int32 capacity)
+    {
+        capacity = (int32)Math::RoundUpToPowerOf2((uint32)Math::Max(capacity, 2));
+        _capacityMask = capacity - 1;
+        _slots = (Slot*)Allocator::Allocate(capacity * sizeof(Slot));
+        for (int64 i = 0; i < capacity; i++)
+            _slots[i].Sequence = i;
+    }
+
+    ~BoundedConcurrentQueue()
+    {
+        T item;
+        while (TryDequeue(item))
+        {
+        }
+        Allocator::Free(_slots);
+    }
+
+    BoundedConcurrentQueue(const BoundedConcurrentQueue&) = delete;
+    BoundedConcurrentQueue& operator=(const BoundedConcurrentQueue&) = delete;
+
+public:
+    /// <summary>
+    /// Gets the maximum amount of the items in the queue.
+    /// </summary>
+    FORCE_INLINE int32 Capacity() const
+    {
+        return (int32)(_capacityMask + 1);
+    }
+
+    /// <summary>
+    /// Gets an estimate of the total number of elements currently in the queue.
+    /// </summary>
+    FORCE_INLINE int32 Count() const
+    {
+        const int64 count = Platform::AtomicRead((int64 volatile*)&_enqueuePos) - Platform::AtomicRead((int64 volatile*)&_dequeuePos);
+        return (int32)Math::Clamp<int64>(count, 0, _capacityMask + 1);
+    }
+
+#if COMPILE_WITH_PROFILER
+    /// <summary>
+    /// Gets the amount of enqueue/dequeue attempts that lost a race with another thread (contention measure for profiling).
+    /// </summary>
+    FORCE_INLINE int64 GetContentionCount() const
+    {
+        return Platform::AtomicRead((int64 volatile*)&_contentionCount);
+    }
+#endif
+
+    /// <summary>
+    /// Tries to add the item to the queue.
+    /// </summary>
+    /// <param name="item">The item to add.</param>
+    /// <returns>True if item has been added, false if the queue is full.</returns>
+    bool TryEnqueue(const T& item)
+    {
+        int64 pos = Platform::AtomicRead(&_enqueuePos);
+        for (;;)
+        {
+            Slot& slot = _slots[pos & _capacityMask];
+            const int64 sequence = Platform::AtomicRead(&slot.Sequence);
+            const int64 diff = sequence - pos;
+            if (diff == 0)
+            {
+                if (Platform::InterlockedCompareExchange(&_enqueuePos, pos + 1, pos) == pos)
+                {
+                    Memory::ConstructItems(&slot.Item, &item, 1);
+                    Platform::AtomicStore(&slot.Sequence, pos + 1);
+                    return true;
+                }
+#if COMPILE_WITH_PROFILER
+                Platform::InterlockedIncrement(&_contentionCount);
+#endif
+                pos = Platform::AtomicRead(&_enqueuePos);
+            }
+            else if (diff < 0)
+            {
+                // Full
+                return false;
+            }
+            else
+            {
+                pos = Platform::AtomicRead(&_enqueuePos);
+            }
+        }
+    }
+
+    /// <summary>
+    /// Tries to remove the first item from the queue.
+    /// </summary>
+    /// <param name="item">The result item.</param>
+    /// <returns>True if item has been removed, false if the queue is empty.</returns>
+    bool TryDequeue(T& item)
+    {
+        int64 pos = Platform::AtomicRead(&_dequeuePos);
+        for (;;)
+        {
+            Slot& slot = _slots[pos & _capacityMask];
+            const int64 sequence = Platform::AtomicRead(&slot.Sequence);
+            const int64 diff = sequence - (pos + 1);
+            if (diff == 0)
+            {
+                if (Platform::InterlockedCompareExchange(&_dequeuePos, pos + 1, pos) == pos)
+                {
+                    item = MoveTemp(slot.Item);
+                    Memory::DestructItem(&slot.Item);
+                    Platform::AtomicStore(&slot.Sequence, pos + _capacityMask + 1);
+                    return true;
+                }
+#if COMPILE_WITH_PROFILER
+                Platform::InterlockedIncrement(&_contentionCount);
+#endif
+                pos = Platform::AtomicRead(&_dequeuePos);
+            }
+            else if (diff < 0)
+            {
+                // Empty
+                return false;
+            }
+            else
+            {
+                pos = Platform::AtomicRead(&_dequeuePos);
+            }
+        }
+    }
+};
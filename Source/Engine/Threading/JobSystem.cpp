@@ -5,6 +5,7 @@
 #include "Engine/Platform/CPUInfo.h"
 #include "Engine/Platform/Thread.h"
 #include "Engine/Platform/ConditionVariable.h"
+#include "Engine/Core/Collections/Array.h"
 #include "Engine/Core/Collections/Dictionary.h"
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Profiler/ProfilerCPU.h"
@@ -20,9 +21,12 @@
 // JOB_SYSTEM_USE_MUTEX=1, enqueue=130-280 cycles, dequeue=2-6 cycles
 // JOB_SYSTEM_USE_MUTEX=0, enqueue=300-700 cycles, dequeue=10-16 cycles
 // So using RingBuffer+Mutex+Signals is better than moodycamel::ConcurrentQueue
+// JOB_SYSTEM_USE_STEALING=1 splits the single shared queue into per-worker deques (Chase-Lev style: owner pops back, thieves pop front)
+// which distributes the locking across workers and scales better on 16+ threads under heavy Dispatch bursts
 
 #define JOB_SYSTEM_ENABLED 1
 #define JOB_SYSTEM_USE_MUTEX 1
+#define JOB_SYSTEM_USE_STEALING 1
 #define JOB_SYSTEM_USE_STATS 0
 
 #if JOB_SYSTEM_USE_STATS
@@ -93,6 +97,21 @@ struct TIsPODType<JobContext>
     enum { Value = true };
 };
 
+// Dispatch that waits for other dispatches to finish before its jobs get enqueued
+struct PendingDispatch
+{
+    Function<void(int32)> Job;
+    int32 JobCount;
+    int64 Label;
+    Array<int64, InlinedAllocation<8>> Dependencies;
+};
+
+template<>
+struct TIsPODType<PendingDispatch>
+{
+    enum { Value = false };
+};
+
 namespace
 {
     JobSystemService JobSystemInstance;
@@ -102,12 +121,22 @@ namespace
     volatile int64 ExitFlag = 0;
     volatile int64 JobLabel = 0;
     Dictionary<int64, JobContext> JobContexts;
+    Array<PendingDispatch> PendingDispatches;
     ConditionVariable JobsSignal;
     CriticalSection JobsMutex;
     ConditionVariable WaitSignal;
     CriticalSection WaitMutex;
     CriticalSection JobsLocker;
-#if JOB_SYSTEM_USE_MUTEX
+#if JOB_SYSTEM_USE_STEALING
+    // Per-worker job deque (owner pushes/pops at the back, thieves steal from the front; each deque has own lock so contention spreads across workers)
+    struct WorkerQueue
+    {
+        CriticalSection Locker;
+        RingBuffer<JobData, InlinedAllocation<256>> Jobs;
+    };
+    WorkerQueue WorkerQueues[PLATFORM_THREADS_LIMIT];
+    volatile int64 DispatchCounter = 0;
+#elif JOB_SYSTEM_USE_MUTEX
     RingBuffer<JobData, InlinedAllocation<256>> Jobs;
 #else
     ConcurrentQueue<JobData> Jobs;
@@ -116,6 +145,151 @@ namespace
     int64 DequeueCount = 0;
     int64 DequeueSum = 0;
 #endif
+    // Index of the job system worker on the current thread (-1 on other threads)
+    THREADLOCAL int32 WorkerIndex = -1;
+    // Cores affinity policy for the workers (bit per logical core, workers pinned round-robin to the set bits, 0 leaves the scheduling to the OS)
+    volatile int64 WorkersAffinity = (int64)MAX_uint64;
+    volatile int64 WorkersAffinityVersion = 0;
+}
+
+// Pins the calling worker to its core from the affinity policy mask
+static void ApplyWorkerAffinity(int32 workerIndex)
+{
+    const uint64 mask = (uint64)Platform::AtomicRead(&WorkersAffinity);
+    if (mask == 0)
+        return;
+    int32 setBitsCount = 0;
+    for (int32 bit = 0; bit < 64; bit++)
+        setBitsCount += (int32)((mask >> bit) & 1);
+    int32 target = workerIndex % setBitsCount;
+    for (int32 bit = 0; bit < 64; bit++)
+    {
+        if ((mask >> bit) & 1)
+        {
+            if (target == 0)
+            {
+                Platform::SetThreadAffinityMask(1ull << bit);
+                break;
+            }
+            target--;
+        }
+    }
+}
+
+// Pushes the jobs of an already registered dispatch into the queues and wakes up the workers
+static void EnqueueJobs(const Function<void(int32)>& job, int32 jobCount, int64 label)
+{
+    JobData data;
+    data.Job = job;
+    data.JobKey = label;
+#if JOB_SYSTEM_USE_STEALING
+    const int32 numQueues = Math::Max(ThreadsCount, 1);
+    const int32 base = WorkerIndex >= 0 ? WorkerIndex : (int32)(Platform::InterlockedIncrement(&DispatchCounter) % numQueues);
+    for (int32 i = 0; i < numQueues; i++)
+    {
+        WorkerQueue& queue = WorkerQueues[(base + i) % numQueues];
+        queue.Locker.Lock();
+        for (data.Index = i; data.Index < jobCount; data.Index += numQueues)
+            queue.Jobs.PushBack(data);
+        queue.Locker.Unlock();
+        if (i >= jobCount - 1)
+            break;
+    }
+#elif JOB_SYSTEM_USE_MUTEX
+    JobsLocker.Lock();
+    for (data.Index = 0; data.Index < jobCount; data.Index++)
+        Jobs.PushBack(data);
+    JobsLocker.Unlock();
+#else
+    for (data.Index = 0; data.Index < jobCount; data.Index++)
+        Jobs.enqueue(data);
+#endif
+    if (JobStartingOnDispatch)
+    {
+        if (jobCount == 1)
+            JobsSignal.NotifyOne();
+        else
+            JobsSignal.NotifyAll();
+    }
+}
+
+// Pops a single pending job from the queues (local deque first, then stealing when enabled). Returns true if a job got dequeued into data.
+static bool TryDequeueJob(JobData& data)
+{
+    data.Job.Unbind();
+#if JOB_SYSTEM_USE_STEALING
+    const int32 index = WorkerIndex;
+    if (index >= 0)
+    {
+        // Pop from the back of the local deque (newest job, best cache locality)
+        WorkerQueue& local = WorkerQueues[index];
+        local.Locker.Lock();
+        if (local.Jobs.Count() != 0)
+        {
+            data = local.Jobs.PeekBack();
+            local.Jobs.PopBack();
+        }
+        local.Locker.Unlock();
+        if (data.Job.IsBinded())
+            return true;
+    }
+
+    // Steal from the front of another worker deque (non-worker threads scan all deques)
+    const int32 base = index >= 0 ? index : 0;
+    for (int32 offset = index >= 0 ? 1 : 0; offset < ThreadsCount && !data.Job.IsBinded(); offset++)
+    {
+        WorkerQueue& victim = WorkerQueues[(base + offset) % ThreadsCount];
+        victim.Locker.Lock();
+        if (victim.Jobs.Count() != 0)
+        {
+            data = victim.Jobs.PeekFront();
+            victim.Jobs.PopFront();
+        }
+        victim.Locker.Unlock();
+    }
+    return data.Job.IsBinded();
+#elif JOB_SYSTEM_USE_MUTEX
+    JobsLocker.Lock();
+    if (Jobs.Count() != 0)
+    {
+        data = Jobs.PeekFront();
+        Jobs.PopFront();
+    }
+    JobsLocker.Unlock();
+    return data.Job.IsBinded();
+#else
+    return Jobs.try_dequeue(data);
+#endif
+}
+
+// Updates the dispatch context after running a job and releases any dispatches pending on the finished label
+static void FinishJob(const JobData& data)
+{
+    Array<PendingDispatch, InlinedAllocation<8>> readyDispatches;
+    JobsLocker.Lock();
+    JobContext& context = JobContexts.At(data.JobKey);
+    if (Platform::InterlockedDecrement(&context.JobsLeft) <= 0)
+    {
+        ASSERT_LOW_LAYER(context.JobsLeft <= 0);
+        JobContexts.Remove(data.JobKey);
+
+        // Release any dispatches that were waiting for this label
+        for (int32 i = PendingDispatches.Count() - 1; i >= 0; i--)
+        {
+            PendingDispatch& pending = PendingDispatches[i];
+            pending.Dependencies.Remove(data.JobKey);
+            if (pending.Dependencies.IsEmpty())
+            {
+                readyDispatches.Add(MoveTemp(pending));
+                PendingDispatches.RemoveAt(i);
+            }
+        }
+    }
+    JobsLocker.Unlock();
+    for (PendingDispatch& pending : readyDispatches)
+        EnqueueJobs(pending.Job, pending.JobCount, pending.Label);
+
+    WaitSignal.NotifyAll();
 }
 
 bool JobSystemService::Init()
@@ -158,31 +332,27 @@ void JobSystemService::Dispose()
 
 int32 JobSystemThread::Run()
 {
-    Platform::SetThreadAffinityMask(1ull << Index);
+    ApplyWorkerAffinity((int32)Index);
 
     JobData data;
     bool attachMonoThread = true;
-#if !JOB_SYSTEM_USE_MUTEX
-    moodycamel::ConsumerToken consumerToken(Jobs);
-#endif
+    int64 affinityVersion = Platform::AtomicRead(&WorkersAffinityVersion);
+    WorkerIndex = (int32)Index;
     while (Platform::AtomicRead(&ExitFlag) == 0)
     {
+        // Re-pin the worker when the affinity policy changed
+        const int64 newAffinityVersion = Platform::AtomicRead(&WorkersAffinityVersion);
+        if (newAffinityVersion != affinityVersion)
+        {
+            affinityVersion = newAffinityVersion;
+            ApplyWorkerAffinity((int32)Index);
+        }
+
         // Try to get a job
 #if JOB_SYSTEM_USE_STATS
         const auto start = Platform::GetTimeCycles();
 #endif
-#if JOB_SYSTEM_USE_MUTEX
-        JobsLocker.Lock();
-        if (Jobs.Count() != 0)
-        {
-            data = Jobs.PeekFront();
-            Jobs.PopFront();
-        }
-        JobsLocker.Unlock();
-#else
-        if (!Jobs.try_dequeue(consumerToken, data))
-            data.Job.Unbind();
-#endif
+        TryDequeueJob(data);
 #if JOB_SYSTEM_USE_STATS
         Platform::InterlockedIncrement(&DequeueCount);
         Platform::InterlockedAdd(&DequeueSum, Platform::GetTimeCycles() - start);
@@ -204,16 +374,7 @@ int32 JobSystemThread::Run()
             data.Job(data.Index);
 
             // Move forward with the job queue
-            JobsLocker.Lock();
-            JobContext& context = JobContexts.At(data.JobKey);
-            if (Platform::InterlockedDecrement(&context.JobsLeft) <= 0)
-            {
-                ASSERT_LOW_LAYER(context.JobsLeft <= 0);
-                JobContexts.Remove(data.JobKey);
-            }
-            JobsLocker.Unlock();
-
-            WaitSignal.NotifyAll();
+            FinishJob(data);
 
             data.Job.Unbind();
         }
@@ -232,7 +393,7 @@ int32 JobSystemThread::Run()
 
 void JobSystem::Execute(const Function<void(int32)>& job, int32 jobCount)
 {
-    // TODO: disable async if called on job thread? or maybe Wait should handle waiting in job thread to do the processing?
+    // Safe to call from inside a job - Wait runs other pending jobs instead of blocking the worker
     if (jobCount > 1)
     {
         // Async
@@ -258,38 +419,62 @@ int64 JobSystem::Dispatch(const Function<void(int32)>& job, int32 jobCount)
 #endif
     const auto label = Platform::InterlockedAdd(&JobLabel, (int64)jobCount) + jobCount;
 
-    JobData data;
-    data.Job = job;
-    data.JobKey = label;
-
     JobContext context;
     context.JobsLeft = jobCount;
 
-#if JOB_SYSTEM_USE_MUTEX
-    JobsLocker.Lock();
-    JobContexts.Add(label, context);
-    for (data.Index = 0; data.Index < jobCount; data.Index++)
-        Jobs.PushBack(data);
-    JobsLocker.Unlock();
-#else
     JobsLocker.Lock();
     JobContexts.Add(label, context);
     JobsLocker.Unlock();
-    for (data.Index = 0; data.Index < jobCount; data.Index++)
-        Jobs.enqueue(data);
-#endif
+
+    EnqueueJobs(job, jobCount, label);
 
 #if JOB_SYSTEM_USE_STATS
     LOG(Info, "Job enqueue time: {0} cycles", (int64)(Platform::GetTimeCycles() - start));
 #endif
 
-    if (JobStartingOnDispatch)
+    return label;
+#else
+    for (int32 i = 0; i < jobCount; i++)
+        job(i);
+    return 0;
+#endif
+}
+
+int64 JobSystem::Dispatch(const Function<void(int32)>& job, int32 jobCount, Span<int64> dependencies)
+{
+    PROFILE_CPU();
+    if (jobCount <= 0)
+        return 0;
+#if JOB_SYSTEM_ENABLED
+    const auto label = Platform::InterlockedAdd(&JobLabel, (int64)jobCount) + jobCount;
+
+    JobContext context;
+    context.JobsLeft = jobCount;
+
+    // Register the context up-front so Wait and further dependencies can target this label before any job runs
+    bool ready = true;
+    JobsLocker.Lock();
+    JobContexts.Add(label, context);
+    PendingDispatch pending;
+    for (int32 i = 0; i < dependencies.Length(); i++)
     {
-        if (jobCount == 1)
-            JobsSignal.NotifyOne();
-        else
-            JobsSignal.NotifyAll();
+        const int64 dependency = dependencies[i];
+        if (dependency != 0 && !pending.Dependencies.Contains(dependency) && JobContexts.ContainsKey(dependency))
+            pending.Dependencies.Add(dependency);
+    }
+    if (pending.Dependencies.HasItems())
+    {
+        pending.Job = job;
+        pending.JobCount = jobCount;
+        pending.Label = label;
+        PendingDispatches.Add(MoveTemp(pending));
+        ready = false;
     }
+    JobsLocker.Unlock();
+
+    // All dependencies already finished so start right away
+    if (ready)
+        EnqueueJobs(job, jobCount, label);
 
     return label;
 #else
@@ -299,6 +484,33 @@ int64 JobSystem::Dispatch(const Function<void(int32)>& job, int32 jobCount)
 #endif
 }
 
+void JobSystem::ParallelFor(int32 begin, int32 end, int32 grainSize, const Function<void(int32, int32)>& fn)
+{
+    PROFILE_CPU();
+    const int32 count = end - begin;
+    if (count <= 0)
+        return;
+    if (grainSize <= 0)
+    {
+        // Aim for a few batches per worker so the work-stealing can balance uneven iterations
+        grainSize = Math::Max(count / Math::Max(GetThreadsCount() * 4, 1), 1);
+    }
+    if (count <= grainSize)
+    {
+        // Not worth going wide
+        fn(begin, end);
+        return;
+    }
+    const int32 batchCount = (count + grainSize - 1) / grainSize;
+    Function<void(int32)> job = [begin, end, grainSize, &fn](int32 batch)
+    {
+        const int32 batchBegin = begin + batch * grainSize;
+        const int32 batchEnd = Math::Min(batchBegin + grainSize, end);
+        fn(batchBegin, batchEnd);
+    };
+    Execute(job, batchCount);
+}
+
 void JobSystem::Wait()
 {
 #if JOB_SYSTEM_ENABLED
@@ -308,6 +520,17 @@ void JobSystem::Wait()
 
     while (numJobs > 0)
     {
+        // Run other pending jobs when waiting from inside a job to keep the worker busy
+        if (WorkerIndex >= 0)
+        {
+            JobData data;
+            if (TryDequeueJob(data))
+            {
+                data.Job(data.Index);
+                FinishJob(data);
+            }
+        }
+
         WaitMutex.Lock();
         WaitSignal.Wait(WaitMutex, 1);
         WaitMutex.Unlock();
@@ -334,6 +557,18 @@ void JobSystem::Wait(int64 label)
         if (!context)
             break;
 
+        // When waiting from inside a job, run other pending jobs instead of blocking (nested parallelism would otherwise shrink the effective workers pool or deadlock)
+        if (WorkerIndex >= 0)
+        {
+            JobData data;
+            if (TryDequeueJob(data))
+            {
+                data.Job(data.Index);
+                FinishJob(data);
+                continue;
+            }
+        }
+
         // Wait on signal until input label is not yet done
         WaitMutex.Lock();
         WaitSignal.Wait(WaitMutex, 1);
@@ -357,7 +592,15 @@ void JobSystem::SetJobStartingOnDispatch(bool value)
 
     if (value)
     {
-#if JOB_SYSTEM_USE_MUTEX
+#if JOB_SYSTEM_USE_STEALING
+        int32 count = 0;
+        for (int32 i = 0; i < ThreadsCount; i++)
+        {
+            WorkerQueues[i].Locker.Lock();
+            count += WorkerQueues[i].Jobs.Count();
+            WorkerQueues[i].Locker.Unlock();
+        }
+#elif JOB_SYSTEM_USE_MUTEX
         JobsLocker.Lock();
         const int32 count = Jobs.Count();
         JobsLocker.Unlock();
@@ -372,6 +615,28 @@ void JobSystem::SetJobStartingOnDispatch(bool value)
 #endif
 }
 
+void JobSystem::SetWorkersAffinityMask(uint64 affinityMask)
+{
+#if JOB_SYSTEM_ENABLED
+    Platform::AtomicStore(&WorkersAffinity, (int64)affinityMask);
+    Platform::InterlockedIncrement(&WorkersAffinityVersion);
+
+    // Wake up any idle workers so they re-pin right away
+    JobsSignal.NotifyAll();
+#endif
+}
+
+void JobSystem::SetWorkersPriority(ThreadPriority priority)
+{
+#if JOB_SYSTEM_ENABLED
+    for (int32 i = 0; i < ThreadsCount; i++)
+    {
+        if (Threads[i])
+            Threads[i]->SetPriority(priority);
+    }
+#endif
+}
+
 int32 JobSystem::GetThreadsCount()
 {
 #if JOB_SYSTEM_ENABLED
@@ -3,6 +3,9 @@
 #pragma once
 
 #include "Engine/Core/Delegate.h"
+#include "Engine/Core/Types/Span.h"
+
+enum class ThreadPriority;
 
 /// <summary>
 /// Lightweight multi-threaded jobs execution scheduler. Uses a pool of threads and supports work-stealing concept.
@@ -26,6 +29,24 @@ API_CLASS(Static) class FLAXENGINE_API JobSystem
     /// <returns>The label identifying this dispatch. Can be used to wait for the execution end.</returns>
     API_FUNCTION() static int64 Dispatch(const Function<void(int32)>& job, int32 jobCount = 1);
 
+    /// <summary>
+    /// Dispatches the job that starts execution once all dependency dispatches are done. Allows pipelining chains of jobs without blocking Wait barriers in-between.
+    /// </summary>
+    /// <param name="job">The job. Argument is an index of the job execution.</param>
+    /// <param name="jobCount">The job executions count.</param>
+    /// <param name="dependencies">The labels of the previous dispatches to wait for before starting this job (already finished ones are ignored).</param>
+    /// <returns>The label identifying this dispatch. Can be used to wait for the execution end or as a dependency of a further dispatch.</returns>
+    API_FUNCTION() static int64 Dispatch(const Function<void(int32)>& job, int32 jobCount, Span<int64> dependencies);
+
+    /// <summary>
+    /// Executes the loop iterations in parallel by splitting the index range into contiguous cache-friendly batches. Blocks until the whole range is processed.
+    /// </summary>
+    /// <param name="begin">The first index of the range (inclusive).</param>
+    /// <param name="end">The last index of the range (exclusive).</param>
+    /// <param name="grainSize">The minimum amount of iterations to run in a single job. Use 0 to pick automatically based on the range size and workers count.</param>
+    /// <param name="fn">The range function. Arguments are the begin (inclusive) and end (exclusive) indices of the batch to process.</param>
+    API_FUNCTION() static void ParallelFor(int32 begin, int32 end, int32 grainSize, const Function<void(int32, int32)>& fn);
+
     /// <summary>
     /// Waits for all dispatched jobs to finish.
     /// </summary>
@@ -34,6 +55,7 @@ API_CLASS(Static) class FLAXENGINE_API JobSystem
     /// <summary>
     /// Waits for all dispatched jobs until a given label to finish (i.e. waits for a Dispatch that returned that label).
     /// </summary>
+    /// <remarks>When called from inside a job, the waiting worker executes other pending jobs instead of blocking so nested parallelism composes safely.</remarks>
     /// <param name="label">The label.</param>
     API_FUNCTION() static void Wait(int64 label);
 
@@ -42,6 +64,18 @@ API_CLASS(Static) class FLAXENGINE_API JobSystem
     /// </summary>
     API_FUNCTION() static void SetJobStartingOnDispatch(bool value);
 
+    /// <summary>
+    /// Sets the processor cores affinity mask for the worker threads (bit per logical core). Workers get pinned round-robin to the set bits. On hybrid CPUs this can keep the frame-critical jobs on the performance cores. Use 0 to leave the scheduling to the OS.
+    /// </summary>
+    /// <param name="affinityMask">The allowed cores mask.</param>
+    API_FUNCTION() static void SetWorkersAffinityMask(uint64 affinityMask);
+
+    /// <summary>
+    /// Sets the priority of the worker threads.
+    /// </summary>
+    /// <param name="priority">The threads priority.</param>
+    static void SetWorkersPriority(ThreadPriority priority);
+
     /// <summary>
     /// Gets the amount of job system threads.
     /// </summary>
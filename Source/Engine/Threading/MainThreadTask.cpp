@@ -1,6 +1,7 @@
 // Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
 
 #include "MainThreadTask.h"
+#include "ConcurrentQueue.h"
 #include "Engine/Platform/CriticalSection.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 
@@ -8,7 +9,7 @@ namespace
 {
     CriticalSection Locker;
     Array<MainThreadTask*> Waiting;
-    Array<MainThreadTask*> Queue;
+    BoundedConcurrentQueue<MainThreadTask*> Queue(1024);
 }
 
 void MainThreadTask::RunAll(float dt)
@@ -21,16 +22,21 @@ void MainThreadTask::RunAll(float dt)
         task->InitialDelay -= dt;
         if (task->InitialDelay < ZeroTolerance)
         {
-            Waiting.RemoveAt(i);
-            Queue.Add(task);
+            // If the ring is full keep the task in the delayed list for the next frame
+            if (Queue.TryEnqueue(task))
+                Waiting.RemoveAt(i);
         }
     }
-    for (int32 i = 0; i < Queue.Count(); i++)
-    {
-        Queue[i]->Execute();
-    }
-    Queue.Clear();
     Locker.Unlock();
+
+    // Run the queued tasks lock-free (tasks enqueued during execution run within the same frame)
+    MainThreadTask* task;
+    while (Queue.TryDequeue(task))
+        task->Execute();
+
+#if COMPILE_WITH_PROFILER
+    TracyPlot("MainThreadTasks Queue Contention", Queue.GetContentionCount());
+#endif
 }
 
 String MainThreadTask::ToString() const
@@ -40,11 +46,11 @@ String MainThreadTask::ToString() const
 
 void MainThreadTask::Enqueue()
 {
+    // Tasks without a delay go through the lock-free ring; on overflow fall back to the delayed list to run on the next frame
+    if (InitialDelay <= ZeroTolerance && Queue.TryEnqueue(this))
+        return;
     Locker.Lock();
-    if (InitialDelay <= ZeroTolerance)
-        Queue.Add(this);
-    else
-        Waiting.Add(this);
+    Waiting.Add(this);
     Locker.Unlock();
 }
 
@@ -7,6 +7,261 @@
 #include "Engine/Core/Types/DateTime.h"
 #include "Engine/Core/Collections/Array.h"
 #include "Engine/Core/Math/Math.h"
+#include "Engine/Platform/CriticalSection.h"
+
+class TaskNotifier;
+class TaskAggregate;
+
+namespace
+{
+    // Shared pools with the recycled tasks (tasks return here on end instead of the deferred object deletion)
+    CriticalSection TaskPoolsLocker;
+    const int32 TaskPoolMaxSize = 1024;
+
+    // Ended tasks rest in a quarantine for the same grace period as the deferred task deletion (see Task::OnEnd) before getting reused. Callers can hold a stale Task* to an ended task (eg. Wait() spin-polling the state or a late ContinueWith) and an immediate reuse would reset the state back to Created under them, so a recycled task has to keep its ended state for as long as a deleted task would stay in memory.
+    const double TaskRecycleDelay = 30.0;
+
+    template<typename T>
+    struct TaskPool
+    {
+        struct QuarantineEntry
+        {
+            T* Task;
+            double ReadyTime;
+        };
+
+        Array<QuarantineEntry> Quarantine; // Ended tasks waiting out the reuse grace period (in end-time order)
+        Array<T*> Free; // Tasks past the grace period, ready for reuse
+
+        // Pops a reusable task or returns null if none is ready (call under TaskPoolsLocker)
+        T* TryAcquire()
+        {
+            const double now = Platform::GetTimeSeconds();
+            while (Quarantine.HasItems() && Quarantine.First().ReadyTime <= now)
+            {
+                Free.Add(Quarantine.First().Task);
+                Quarantine.RemoveAtKeepOrder(0);
+            }
+            if (Free.HasItems())
+            {
+                T* task = Free.Last();
+                Free.RemoveLast();
+                return task;
+            }
+            return nullptr;
+        }
+
+        // Places an ended task into the quarantine, returns false if the pool is full (call under TaskPoolsLocker)
+        bool Recycle(T* task)
+        {
+            if (Quarantine.Count() + Free.Count() >= TaskPoolMaxSize)
+                return false;
+            QuarantineEntry e;
+            e.Task = task;
+            e.ReadyTime = Platform::GetTimeSeconds() + TaskRecycleDelay;
+            Quarantine.Add(e);
+            return true;
+        }
+    };
+
+    TaskPool<PooledActionTask> PooledActionTasks;
+    TaskPool<TaskNotifier> PooledNotifiers;
+    TaskPool<TaskAggregate> PooledAggregates;
+}
+
+PooledActionTask* PooledActionTask::Acquire(const Function<void()>& action, Object* target)
+{
+    ASSERT(action.IsBinded());
+    TaskPoolsLocker.Lock();
+    PooledActionTask* task = PooledActionTasks.TryAcquire();
+    TaskPoolsLocker.Unlock();
+    if (!task)
+        task = New<PooledActionTask>();
+    task->_state = TaskState::Created;
+    Platform::AtomicStore(&task->_cancelFlag, 0);
+    task->_action1 = action;
+    task->_target = target;
+    return task;
+}
+
+void PooledActionTask::OnEnd()
+{
+    ASSERT(!IsRunning());
+    _action1.Unbind();
+    _action2.Unbind();
+    _target = nullptr;
+    _continueWith = nullptr;
+    TaskPoolsLocker.Lock();
+    const bool recycled = PooledActionTasks.Recycle(this);
+    TaskPoolsLocker.Unlock();
+    if (!recycled)
+    {
+        // Pool is full so dispose the standard way
+        Task::OnEnd();
+    }
+}
+
+// Pooled signal task used by WhenAll/WhenAny that triggers once the input tasks complete (notified by TaskNotifier continuations attached to the inputs)
+class TaskAggregate : public ThreadPoolTask
+{
+    friend Task;
+
+private:
+    volatile int64 _notifiersLeft;
+    volatile int64 _failed;
+    volatile int64 _triggered;
+    volatile int64 _releaseCounter;
+    bool _waitForAll;
+
+public:
+    static TaskAggregate* Acquire(int32 count, bool waitForAll)
+    {
+        TaskPoolsLocker.Lock();
+        TaskAggregate* task = PooledAggregates.TryAcquire();
+        TaskPoolsLocker.Unlock();
+        if (!task)
+            task = New<TaskAggregate>();
+        task->_state = TaskState::Created;
+        Platform::AtomicStore(&task->_cancelFlag, 0);
+        task->_notifiersLeft = count;
+        task->_failed = 0;
+        task->_triggered = 0;
+        // Both the last notifier and the task end have to pass before recycling (in any order)
+        task->_releaseCounter = 2;
+        task->_waitForAll = waitForAll;
+        return task;
+    }
+
+    // Called by every input task exactly once (on finish, fail or cancel)
+    void Notify(bool failed)
+    {
+        if (failed)
+            Platform::InterlockedIncrement(&_failed);
+        else if (!_waitForAll && Platform::InterlockedIncrement(&_triggered) == 1 && GetState() == TaskState::Created)
+        {
+            // Any: the first completed input triggers the task
+            Start();
+        }
+        const int64 left = Platform::InterlockedDecrement(&_notifiersLeft);
+        if (left == 0)
+        {
+            if (GetState() == TaskState::Created)
+            {
+                if (_waitForAll ? Platform::AtomicRead(&_failed) != 0 : Platform::AtomicRead(&_triggered) == 0)
+                    OnFail();
+                else if (_waitForAll)
+                    Start();
+            }
+            Release();
+        }
+    }
+
+    // [ThreadPoolTask]
+    String ToString() const override
+    {
+        return TEXT("TaskAggregate");
+    }
+
+protected:
+    void Release()
+    {
+        if (Platform::InterlockedDecrement(&_releaseCounter) != 0)
+            return;
+        _continueWith = nullptr;
+        TaskPoolsLocker.Lock();
+        const bool recycled = PooledAggregates.Recycle(this);
+        TaskPoolsLocker.Unlock();
+        if (!recycled)
+            Task::OnEnd();
+    }
+
+    // [ThreadPoolTask]
+    bool Run() override
+    {
+        return false;
+    }
+
+    void OnEnd() override
+    {
+        ASSERT(!IsRunning());
+        Release();
+    }
+};
+
+// Pooled continuation attached to every WhenAll/WhenAny input that forwards its completion to the aggregate (executes inline instead of going through the thread pool)
+class TaskNotifier : public Task
+{
+    friend Task;
+
+private:
+    TaskAggregate* _aggregate = nullptr;
+    volatile int64 _notified = 0;
+
+public:
+    static TaskNotifier* Acquire(TaskAggregate* aggregate)
+    {
+        TaskPoolsLocker.Lock();
+        TaskNotifier* task = PooledNotifiers.TryAcquire();
+        TaskPoolsLocker.Unlock();
+        if (!task)
+            task = New<TaskNotifier>();
+        task->_state = TaskState::Created;
+        Platform::AtomicStore(&task->_cancelFlag, 0);
+        task->_aggregate = aggregate;
+        task->_notified = 0;
+        return task;
+    }
+
+    // [Task]
+    String ToString() const override
+    {
+        return TEXT("TaskNotifier");
+    }
+
+protected:
+    void NotifyOnce(bool failed)
+    {
+        if (Platform::InterlockedIncrement(&_notified) == 1)
+            _aggregate->Notify(failed);
+    }
+
+    // [Task]
+    bool Run() override
+    {
+        NotifyOnce(false);
+        return false;
+    }
+
+    void Enqueue() override
+    {
+        // Only signals the aggregate so execute inline instead of paying the thread pool hop
+        Execute();
+    }
+
+    void OnFail() override
+    {
+        NotifyOnce(true);
+        Task::OnFail();
+    }
+
+    void OnCancel() override
+    {
+        NotifyOnce(true);
+        Task::OnCancel();
+    }
+
+    void OnEnd() override
+    {
+        ASSERT(!IsRunning());
+        _aggregate = nullptr;
+        _continueWith = nullptr;
+        TaskPoolsLocker.Lock();
+        const bool recycled = PooledNotifiers.Recycle(this);
+        TaskPoolsLocker.Unlock();
+        if (!recycled)
+            Task::OnEnd();
+    }
+};
 
 void Task::Start()
 {
@@ -108,6 +363,30 @@ Task* Task::ContinueWith(Function<bool()> action, Object* target)
     return ContinueWith(New<ThreadPoolActionTask>(action, target));
 }
 
+Task* Task::ContinueWithPooled(const Function<void()>& action, Object* target)
+{
+    ASSERT(action.IsBinded());
+    return ContinueWith(PooledActionTask::Acquire(action, target));
+}
+
+Task* Task::WhenAll(Task** tasks, int32 count)
+{
+    ASSERT(tasks && count > 0);
+    TaskAggregate* result = TaskAggregate::Acquire(count, true);
+    for (int32 i = 0; i < count; i++)
+        tasks[i]->ContinueWith(TaskNotifier::Acquire(result));
+    return result;
+}
+
+Task* Task::WhenAny(Task** tasks, int32 count)
+{
+    ASSERT(tasks && count > 0);
+    TaskAggregate* result = TaskAggregate::Acquire(count, false);
+    for (int32 i = 0; i < count; i++)
+        tasks[i]->ContinueWith(TaskNotifier::Acquire(result));
+    return result;
+}
+
 Task* Task::StartNew(Task* task)
 {
     ASSERT(task);
@@ -231,6 +231,57 @@ public:
     /// <returns>Enqueued task.</returns>
     Task* ContinueWith(Function<bool()> action, Object* target = nullptr);
 
+    /// <summary>
+    /// Continues that task execution with a given action using a task recycled via the global pool (zero-allocation chaining for high-frequency continuations).
+    /// </summary>
+    /// <remarks>The continuation task returns to the pool as soon as it ends so don't cache the returned pointer after completion.</remarks>
+    /// <param name="action">Action to run.</param>
+    /// <param name="target">The action target object.</param>
+    /// <returns>Enqueued task.</returns>
+    Task* ContinueWithPooled(const Function<void()>& action, Object* target = nullptr);
+
+public:
+
+    /// <summary>
+    /// Gets a task that completes when all of the given tasks complete (fails if any of them fails or gets canceled). Uses pooled tasks so no allocations happen per-call (beyond the pool warmup).
+    /// </summary>
+    /// <remarks>Attach before the input tasks end. The returned task starts automatically and returns to the pool once it ends so don't cache the pointer after completion.</remarks>
+    /// <param name="tasks">The tasks.</param>
+    /// <param name="count">The amount of tasks.</param>
+    /// <returns>The combined task.</returns>
+    static Task* WhenAll(Task** tasks, int32 count);
+
+    /// <summary>
+    /// Gets a task that completes when any of the given tasks completes (fails only if all of them fail or get canceled). Uses pooled tasks so no allocations happen per-call (beyond the pool warmup).
+    /// </summary>
+    /// <remarks>Attach before the input tasks end. The returned task starts automatically and returns to the pool once it ends so don't cache the pointer after completion.</remarks>
+    /// <param name="tasks">The tasks.</param>
+    /// <param name="count">The amount of tasks.</param>
+    /// <returns>The combined task.</returns>
+    static Task* WhenAny(Task** tasks, int32 count);
+
+    /// <summary>
+    /// Gets a task that completes when all of the tasks from the list complete.
+    /// </summary>
+    /// <param name="tasks">The tasks list.</param>
+    /// <returns>The combined task.</returns>
+    template<class T = Task>
+    static Task* WhenAll(Array<T*>& tasks)
+    {
+        return WhenAll((Task**)tasks.Get(), tasks.Count());
+    }
+
+    /// <summary>
+    /// Gets a task that completes when any of the tasks from the list completes.
+    /// </summary>
+    /// <param name="tasks">The tasks list.</param>
+    /// <returns>The combined task.</returns>
+    template<class T = Task>
+    static Task* WhenAny(Array<T*>& tasks)
+    {
+        return WhenAny((Task**)tasks.Get(), tasks.Count());
+    }
+
 public:
 
     /// <summary>
@@ -2,7 +2,9 @@
 
 #include "TaskGraph.h"
 #include "JobSystem.h"
+#include "Engine/Core/Log.h"
 #include "Engine/Core/Collections/Sorting.h"
+#include "Engine/Core/Types/StringView.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 
 namespace
@@ -43,6 +45,33 @@ void TaskGraphSystem::RemoveDependency(TaskGraphSystem* system)
     _dependencies.Remove(system);
 }
 
+void TaskGraphSystem::AddResourceRead(uint32 resource)
+{
+    if (!_resourceReads.Contains(resource))
+        _resourceReads.Add(resource);
+}
+
+void TaskGraphSystem::AddResourceWrite(uint32 resource)
+{
+    if (!_resourceWrites.Contains(resource))
+        _resourceWrites.Add(resource);
+}
+
+bool TaskGraphSystem::ConflictsWith(const TaskGraphSystem* other) const
+{
+    for (const uint32 resource : _resourceWrites)
+    {
+        if (other->_resourceWrites.Contains(resource) || other->_resourceReads.Contains(resource))
+            return true;
+    }
+    for (const uint32 resource : _resourceReads)
+    {
+        if (other->_resourceWrites.Contains(resource))
+            return true;
+    }
+    return false;
+}
+
 void TaskGraphSystem::PreExecute(TaskGraph* graph)
 {
 }
@@ -86,6 +115,7 @@ void TaskGraph::Execute()
     _remaining.Clear();
     _remaining.Add(_systems);
 
+    int32 waveIndex = 0;
     while (_remaining.HasItems())
     {
         // Find systems without dependencies or with already executed dependencies
@@ -101,6 +131,18 @@ void TaskGraph::Execute()
                     break;
                 }
             }
+            if (hasReadyDependencies && (e->_resourceReads.HasItems() || e->_resourceWrites.HasItems()))
+            {
+                // Implicit ordering derived from the declared resources access: conflicting systems execute in separate waves, earlier Order goes first (ties broken by the registration order)
+                for (auto d : _remaining)
+                {
+                    if (d != e && d->ConflictsWith(e) && (d->Order < e->Order || (d->Order == e->Order && _systems.Find(d) < _systems.Find(e))))
+                    {
+                        hasReadyDependencies = false;
+                        break;
+                    }
+                }
+            }
             if (hasReadyDependencies)
             {
                 _queue.Add(e);
@@ -114,6 +156,19 @@ void TaskGraph::Execute()
 
         // Execute in order
         Sorting::QuickSort(_queue.Get(), _queue.Count(), &SortTaskGraphSystem);
+        if (DumpSchedule)
+        {
+            // Log the systems that overlap within this wave
+            String names;
+            for (int32 i = 0; i < _queue.Count(); i++)
+            {
+                if (i != 0)
+                    names += TEXT(", ");
+                names += String(_queue[i]->GetType().Fullname);
+            }
+            LOG(Info, "Task Graph wave {0}: {1}", waveIndex, names);
+        }
+        waveIndex++;
         JobSystem::SetJobStartingOnDispatch(false);
         _labels.Clear();
         for (int32 i = 0; i < _queue.Count(); i++)
@@ -132,6 +187,12 @@ void TaskGraph::Execute()
 
     for (auto system : _systems)
         system->PostExecute(this);
+    DumpSchedule = false;
+}
+
+uint32 TaskGraph::GetResourceId(const StringView& name)
+{
+    return GetHash(name);
 }
 
 void TaskGraph::DispatchJob(const Function<void(int32)>& job, int32 jobCount)
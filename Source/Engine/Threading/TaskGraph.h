@@ -6,6 +6,7 @@
 #include "Engine/Core/Collections/Array.h"
 
 class TaskGraph;
+class StringView;
 
 /// <summary>
 /// System that can generate work into Task Graph for asynchronous execution.
@@ -17,6 +18,10 @@ DECLARE_SCRIPTING_TYPE(TaskGraphSystem);
 private:
     Array<TaskGraphSystem*, InlinedAllocation<16>> _dependencies;
     Array<TaskGraphSystem*, InlinedAllocation<16>> _reverseDependencies;
+    Array<uint32, InlinedAllocation<8>> _resourceReads;
+    Array<uint32, InlinedAllocation<8>> _resourceWrites;
+
+    bool ConflictsWith(const TaskGraphSystem* other) const;
 
 public:
     /// <summary>
@@ -39,6 +44,18 @@ public:
     /// <param name="system">The system to not depend on anymore.</param>
     API_FUNCTION() void RemoveDependency(TaskGraphSystem* system);
 
+    /// <summary>
+    /// Declares that the system reads the given resource during execution. Systems writing to that resource get executed before this system, while other readers can overlap with it.
+    /// </summary>
+    /// <param name="resource">The resource identifier (eg. from TaskGraph::GetResourceId).</param>
+    API_FUNCTION() void AddResourceRead(uint32 resource);
+
+    /// <summary>
+    /// Declares that the system writes the given resource during execution. No other system that reads or writes that resource can overlap with this system.
+    /// </summary>
+    /// <param name="resource">The resource identifier (eg. from TaskGraph::GetResourceId).</param>
+    API_FUNCTION() void AddResourceWrite(uint32 resource);
+
     /// <summary>
     /// Called before executing any systems of the graph. Can be used to initialize data (synchronous).
     /// </summary>
@@ -72,6 +89,18 @@ private:
     TaskGraphSystem* _currentSystem = nullptr;
 
 public:
+    /// <summary>
+    /// Enables logging of the next executed schedule as systems grouped into overlapping waves. Cleared automatically after the execution.
+    /// </summary>
+    API_FIELD() bool DumpSchedule = false;
+
+    /// <summary>
+    /// Gets the identifier of the named resource used by systems to declare read/write access (hash of the name).
+    /// </summary>
+    /// <param name="name">The resource name (eg. skeleton pose buffers or streaming cache).</param>
+    /// <returns>The resource identifier.</returns>
+    API_FUNCTION() static uint32 GetResourceId(const StringView& name);
+
     /// <summary>
     /// Gets the list of systems.
     /// </summary>
@@ -26,6 +26,24 @@ namespace ThreadPoolImpl
     ConcurrentTaskQueue<ThreadPoolTask> Jobs; // Hello Steve!
     ConditionVariable JobsSignal;
     CriticalSection JobsMutex;
+    // Cores affinity policy shared by all pool workers (0 leaves the scheduling to the OS)
+    volatile int64 WorkersAffinity = 0;
+    volatile int64 WorkersAffinityVersion = 0;
+}
+
+void ThreadPool::SetWorkersAffinityMask(uint64 affinityMask)
+{
+    Platform::AtomicStore(&ThreadPoolImpl::WorkersAffinity, (int64)affinityMask);
+    Platform::InterlockedIncrement(&ThreadPoolImpl::WorkersAffinityVersion);
+
+    // Wake up any idle workers so they re-pin right away
+    ThreadPoolImpl::JobsSignal.NotifyAll();
+}
+
+void ThreadPool::SetWorkersPriority(ThreadPriority priority)
+{
+    for (int32 i = 0; i < ThreadPoolImpl::Threads.Count(); i++)
+        ThreadPoolImpl::Threads[i]->SetPriority(priority);
 }
 
 String ThreadPoolTask::ToString() const
@@ -106,10 +124,21 @@ void ThreadPoolService::Dispose()
 int32 ThreadPool::ThreadProc()
 {
     ThreadPoolTask* task;
+    int64 affinityVersion = 0;
 
     // Work until end
     while (Platform::AtomicRead(&ThreadPoolImpl::ExitFlag) == 0)
     {
+        // Apply the cores affinity policy when it changes
+        const int64 newAffinityVersion = Platform::AtomicRead(&ThreadPoolImpl::WorkersAffinityVersion);
+        if (newAffinityVersion != affinityVersion)
+        {
+            affinityVersion = newAffinityVersion;
+            const uint64 mask = (uint64)Platform::AtomicRead(&ThreadPoolImpl::WorkersAffinity);
+            if (mask != 0)
+                Platform::SetThreadAffinityMask(mask);
+        }
+
         // Try to get a job
         if (ThreadPoolImpl::Jobs.try_dequeue(task))
         {
@@ -4,13 +4,29 @@
 
 #include "Engine/Core/Types/BaseTypes.h"
 
+enum class ThreadPriority;
+
 /// <summary>
 /// Main engine thread pool for threaded tasks system.
 /// </summary>
-class ThreadPool
+class FLAXENGINE_API ThreadPool
 {
     friend class ThreadPoolTask;
     friend class ThreadPoolService;
+public:
+
+    /// <summary>
+    /// Sets the processor cores affinity mask for the pool threads (bit per logical core). All workers share the mask so the OS schedules them within the allowed cores only (eg. efficiency cores for background loading on hybrid CPUs). Use 0 to leave the scheduling to the OS (default).
+    /// </summary>
+    /// <param name="affinityMask">The allowed cores mask.</param>
+    static void SetWorkersAffinityMask(uint64 affinityMask);
+
+    /// <summary>
+    /// Sets the priority of the pool threads.
+    /// </summary>
+    /// <param name="priority">The threads priority.</param>
+    static void SetWorkersPriority(ThreadPriority priority);
+
 private:
 
     static int32 ThreadProc();
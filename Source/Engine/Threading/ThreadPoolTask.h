@@ -48,6 +48,15 @@ protected:
     Function<bool()> _action2;
     Object* _target;
 
+    /// <summary>
+    /// Initializes a new instance of the <see cref="ThreadPoolActionTask"/> class (without any action bound).
+    /// </summary>
+    ThreadPoolActionTask()
+        : ThreadPoolTask()
+        , _target(nullptr)
+    {
+    }
+
 public:
 
     /// <summary>
@@ -125,3 +134,34 @@ protected:
         return false;
     }
 };
+
+/// <summary>
+/// ThreadPoolActionTask variant recycled via a global pool to avoid per-continuation allocations when chaining many short tasks (eg. streaming code continuations).
+/// </summary>
+/// <remarks>The task returns to the pool as soon as it ends so callers must not cache the returned pointer after the task completion.</remarks>
+/// <seealso cref="ThreadPoolActionTask" />
+class FLAXENGINE_API PooledActionTask : public ThreadPoolActionTask
+{
+public:
+
+    /// <summary>
+    /// Initializes a new instance of the <see cref="PooledActionTask"/> class. Use Acquire to get tasks from the pool.
+    /// </summary>
+    PooledActionTask()
+        : ThreadPoolActionTask()
+    {
+    }
+
+    /// <summary>
+    /// Gets a task from the pool (or allocates a new one) bound to the given action. The task is in Created state and not started yet.
+    /// </summary>
+    /// <param name="action">The action.</param>
+    /// <param name="target">The target object.</param>
+    /// <returns>The task.</returns>
+    static PooledActionTask* Acquire(const Function<void()>& action, Object* target = nullptr);
+
+protected:
+
+    // [ThreadPoolActionTask]
+    void OnEnd() override;
+};
@@ -15,17 +15,21 @@ void MaterialGenerator::ProcessGroupParameters(Box* box, Node* node, Value& valu
         const auto param = findParam((Guid)node->Values[0], _treeLayer);
         if (param)
         {
+            // Private parameters are not exposed for editing at runtime (eg. layer parameters) so bake their values into the generated source as constants for better shader optimization
+            const bool isConstant = !param->IsPublic;
             switch (param->Type)
             {
             case MaterialParameterType::Bool:
-                value = Value(VariantType::Bool, param->ShaderName);
+                value = isConstant ? Value(param->AsBool) : Value(VariantType::Bool, param->ShaderName);
                 break;
             case MaterialParameterType::Integer:
+                value = isConstant ? Value(param->AsInteger) : Value(VariantType::Int, param->ShaderName);
+                break;
             case MaterialParameterType::SceneTexture:
                 value = Value(VariantType::Int, param->ShaderName);
                 break;
             case MaterialParameterType::Float:
-                value = Value(VariantType::Float, param->ShaderName);
+                value = isConstant ? Value(param->AsFloat) : Value(VariantType::Float, param->ShaderName);
                 break;
             case MaterialParameterType::Vector2:
             case MaterialParameterType::Vector3:
@@ -33,7 +37,26 @@ void MaterialGenerator::ProcessGroupParameters(Box* box, Node* node, Value& valu
             case MaterialParameterType::Color:
             {
                 // Set result values based on box ID
-                const Value sample(box->Type.Type, param->ShaderName);
+                Value sample(box->Type.Type, param->ShaderName);
+                if (isConstant)
+                {
+                    switch (param->Type)
+                    {
+                    case MaterialParameterType::Vector2:
+                        sample = Value(Variant(param->AsFloat2));
+                        break;
+                    case MaterialParameterType::Vector3:
+                        sample = Value(Variant(param->AsFloat3));
+                        break;
+                    case MaterialParameterType::Vector4:
+                        sample = Value(Variant(*(Float4*)&param->AsData));
+                        break;
+                    case MaterialParameterType::Color:
+                        sample = Value(Variant(param->AsColor));
+                        break;
+                    default: ;
+                    }
+                }
                 switch (box->ID)
                 {
                 case 0:
@@ -65,7 +88,14 @@ void MaterialGenerator::ProcessGroupParameters(Box* box, Node* node, Value& valu
             case MaterialParameterType::ChannelMask:
             {
                 const auto input = tryGetValue(node->GetBox(0), Value::Zero);
-                value = writeLocal(VariantType::Float, String::Format(TEXT("dot({0}, {1})"), input.Value, param->ShaderName), node);
+                if (isConstant)
+                {
+                    static const Char* Masks[4] = { TEXT("float4(1, 0, 0, 0)"), TEXT("float4(0, 1, 0, 0)"), TEXT("float4(0, 0, 1, 0)"), TEXT("float4(0, 0, 0, 1)") };
+                    const int32 channel = Math::Clamp(param->AsInteger, 0, 3);
+                    value = writeLocal(VariantType::Float, String::Format(TEXT("dot({0}, {1})"), input.Value, Masks[channel]), node);
+                }
+                else
+                    value = writeLocal(VariantType::Float, String::Format(TEXT("dot({0}, {1})"), input.Value, param->ShaderName), node);
                 break;
             }
             case MaterialParameterType::CubeTexture:
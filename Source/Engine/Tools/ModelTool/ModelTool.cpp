@@ -570,28 +570,35 @@ void OptimizeCurve(LinearCurve<T>& curve)
     auto& oldKeyframes = curve.GetKeyframes();
     const int32 keyCount = oldKeyframes.Count();
     typename LinearCurve<T>::KeyFrameCollection newKeyframes(keyCount);
-    bool lastWasEqual = false;
+    int32 lastKeptIndex = 0;
 
     for (int32 i = 0; i < keyCount; i++)
     {
-        bool isEqual = false;
         const auto& curKey = oldKeyframes[i];
-        if (i > 0)
+
+        // Remove keys that the runtime linear interpolation reproduces from the surviving neighbors (covers both constant runs and straight-line motion from baked tracks)
+        if (newKeyframes.HasItems() && i + 1 < keyCount && i - lastKeptIndex < 120)
         {
             const auto& prevKey = newKeyframes.Last();
-            isEqual = Math::NearEqual(prevKey.Value, curKey.Value);
-        }
+            const auto& nextKey = oldKeyframes[i + 1];
+            const float span = nextKey.Time - prevKey.Time;
+            bool redundant = true;
 
-        // More than two keys in a row are equal, remove the middle key by replacing it with this one
-        if (lastWasEqual && isEqual)
-        {
-            auto& prevKey = newKeyframes.Last();
-            prevKey = curKey;
-            continue;
+            // Validate all the keys dropped over the (prev, next) range so the error doesn't accumulate over long spans
+            for (int32 j = i; j > lastKeptIndex && redundant; j--)
+            {
+                const auto& key = oldKeyframes[j];
+                const float t = span > ZeroTolerance ? (key.Time - prevKey.Time) / span : 0.0f;
+                T predicted;
+                AnimationUtils::Interpolate(prevKey.Value, nextKey.Value, t, predicted);
+                redundant = Math::NearEqual(key.Value, predicted);
+            }
+            if (redundant)
+                continue;
         }
 
         newKeyframes.Add(curKey);
-        lastWasEqual = isEqual;
+        lastKeptIndex = i;
     }
 
     // Special case if animation has only two the same keyframes after cleaning
@@ -12,6 +12,7 @@
 #include "Engine/Graphics/Textures/TextureUtils.h"
 #include "Engine/Graphics/PixelFormatExtensions.h"
 #include "Engine/Platform/File.h"
+#include "Engine/Threading/JobSystem.h"
 
 #define STBI_ASSERT(x) ASSERT(x)
 #define STBI_MALLOC(sz) Allocator::Allocate(sz)
@@ -578,6 +579,23 @@ bool TextureTool::ConvertStb(TextureData& dst, const TextureData& src, const Pix
         }
         bool isDstSRGB = PixelFormatExtensions::IsSRGB(dstFormat);
 
+        // Validate the block format upfront (the per-block encoder switch below covers exactly these)
+        switch (dstFormat)
+        {
+        case PixelFormat::BC1_UNorm:
+        case PixelFormat::BC1_UNorm_sRGB:
+        case PixelFormat::BC3_UNorm:
+        case PixelFormat::BC3_UNorm_sRGB:
+        case PixelFormat::BC4_UNorm:
+        case PixelFormat::BC5_UNorm:
+        case PixelFormat::BC7_UNorm:
+        case PixelFormat::BC7_UNorm_sRGB:
+            break;
+        default:
+            LOG(Warning, "Cannot compress image. Unsupported format {0}", static_cast<int32>(dstFormat));
+            return true;
+        }
+
         // bc7enc init
         bc7enc16_compress_block_params params;
         if (dstFormat == PixelFormat::BC7_UNorm || dstFormat == PixelFormat::BC7_UNorm_sRGB)
@@ -610,56 +628,58 @@ bool TextureTool::ConvertStb(TextureData& dst, const TextureData& src, const Pix
                 dstMip.Lines = blocksHeight;
                 dstMip.Data.Allocate(dstMip.DepthPitch);
 
-                // Compress texture
-                for (int32 yBlock = 0; yBlock < blocksHeight; yBlock++)
+                // Compress texture (rows of blocks are independent so spread them over the job system workers)
+                JobSystem::ParallelFor(0, blocksHeight, 8, [&](int32 beginY, int32 endY)
                 {
-                    for (int32 xBlock = 0; xBlock < blocksWidth; xBlock++)
+                    for (int32 yBlock = beginY; yBlock < endY; yBlock++)
                     {
-                        // Sample source texture 4x4 block
-                        Color32 srcBlock[16];
-                        for (int32 y = 0; y < 4; y++)
+                        for (int32 xBlock = 0; xBlock < blocksWidth; xBlock++)
                         {
-                            for (int32 x = 0; x < 4; x++)
+                            // Sample source texture 4x4 block
+                            Color32 srcBlock[16];
+                            for (int32 y = 0; y < 4; y++)
                             {
-                                Color color = TextureTool::SamplePoint(sampler, xBlock * 4 + x, yBlock * 4 + y, srcMip.Data.Get(), srcMip.RowPitch);
-                                if (isDstSRGB)
-                                    color = Color::LinearToSrgb(color);
-                                srcBlock[y * 4 + x] = Color32(color);
+                                for (int32 x = 0; x < 4; x++)
+                                {
+                                    Color color = TextureTool::SamplePoint(sampler, xBlock * 4 + x, yBlock * 4 + y, srcMip.Data.Get(), srcMip.RowPitch);
+                                    if (isDstSRGB)
+                                        color = Color::LinearToSrgb(color);
+                                    srcBlock[y * 4 + x] = Color32(color);
+                                }
                             }
-                        }
 
-                        // Compress block
-                        byte* dstBlock = dstMip.Data.Get() + (yBlock * blocksWidth + xBlock) * bytesPerBlock;
-                        switch (dstFormat)
-                        {
-                        case PixelFormat::BC1_UNorm:
-                        case PixelFormat::BC1_UNorm_sRGB:
-                            stb_compress_dxt_block(dstBlock, (byte*)&srcBlock, 0, STB_DXT_HIGHQUAL);
-                            break;
-                        case PixelFormat::BC3_UNorm:
-                        case PixelFormat::BC3_UNorm_sRGB:
-                            stb_compress_dxt_block(dstBlock, (byte*)&srcBlock, 1, STB_DXT_HIGHQUAL);
-                            break;
-                        case PixelFormat::BC4_UNorm:
-                            for (int32 i = 1; i < 16; i++)
-                                ((byte*)&srcBlock)[i] = srcBlock[i].R;
-                            stb_compress_bc4_block(dstBlock, (byte*)&srcBlock);
-                            break;
-                        case PixelFormat::BC5_UNorm:
-                            for (int32 i = 0; i < 16; i++)
-                                ((uint16*)&srcBlock)[i] = srcBlock[i].R << 8 | srcBlock[i].G;
-                            stb_compress_bc5_block(dstBlock, (byte*)&srcBlock);
-                            break;
-                        case PixelFormat::BC7_UNorm:
-                        case PixelFormat::BC7_UNorm_sRGB:
-                            bc7enc16_compress_block(dstBlock, &srcBlock, &params);
-                            break;
-                        default:
-                            LOG(Warning, "Cannot compress image. Unsupported format {0}", static_cast<int32>(dstFormat));
-                            return true;
+                            // Compress block
+                            byte* dstBlock = dstMip.Data.Get() + (yBlock * blocksWidth + xBlock) * bytesPerBlock;
+                            switch (dstFormat)
+                            {
+                            case PixelFormat::BC1_UNorm:
+                            case PixelFormat::BC1_UNorm_sRGB:
+                                stb_compress_dxt_block(dstBlock, (byte*)&srcBlock, 0, STB_DXT_HIGHQUAL);
+                                break;
+                            case PixelFormat::BC3_UNorm:
+                            case PixelFormat::BC3_UNorm_sRGB:
+                                stb_compress_dxt_block(dstBlock, (byte*)&srcBlock, 1, STB_DXT_HIGHQUAL);
+                                break;
+                            case PixelFormat::BC4_UNorm:
+                                for (int32 i = 1; i < 16; i++)
+                                    ((byte*)&srcBlock)[i] = srcBlock[i].R;
+                                stb_compress_bc4_block(dstBlock, (byte*)&srcBlock);
+                                break;
+                            case PixelFormat::BC5_UNorm:
+                                for (int32 i = 0; i < 16; i++)
+                                    ((uint16*)&srcBlock)[i] = srcBlock[i].R << 8 | srcBlock[i].G;
+                                stb_compress_bc5_block(dstBlock, (byte*)&srcBlock);
+                                break;
+                            case PixelFormat::BC7_UNorm:
+                            case PixelFormat::BC7_UNorm_sRGB:
+                                bc7enc16_compress_block(dstBlock, &srcBlock, &params);
+                                break;
+                            default:
+                                break;
+                            }
                         }
                     }
-                }
+                });
             }
         }
     }
@@ -696,18 +716,21 @@ bool TextureTool::ConvertStb(TextureData& dst, const TextureData& src, const Pix
                 dstMip.Lines = mipHeight;
                 dstMip.Data.Allocate(dstMip.DepthPitch);
 
-                // Convert texture
-                for (int32 y = 0; y < mipHeight; y++)
+                // Convert texture (rows are independent so spread them over the job system workers)
+                JobSystem::ParallelFor(0, mipHeight, 32, [&](int32 beginY, int32 endY)
                 {
-                    for (int32 x = 0; x < mipWidth; x++)
+                    for (int32 y = beginY; y < endY; y++)
                     {
-                        // Sample source texture
-                        Color color = TextureTool::SamplePoint(sampler, x, y, srcMip.Data.Get(), srcMip.RowPitch);
+                        for (int32 x = 0; x < mipWidth; x++)
+                        {
+                            // Sample source texture
+                            Color color = TextureTool::SamplePoint(sampler, x, y, srcMip.Data.Get(), srcMip.RowPitch);
 
-                        // Store destination texture
-                        TextureTool::Store(dstSampler, x, y, dstMip.Data.Get(), dstMip.RowPitch, color);
+                            // Store destination texture
+                            TextureTool::Store(dstSampler, x, y, dstMip.Data.Get(), dstMip.RowPitch, color);
+                        }
                     }
-                }
+                });
             }
         }
     }
@@ -448,6 +448,9 @@ public:
                 return true;
         }
 
+        if (onLoaded())
+            return true;
+
         return false;
     }
 
@@ -565,6 +568,11 @@ protected:
         return false;
     }
 
+    virtual bool onLoaded()
+    {
+        return false;
+    }
+
     virtual bool onParamCreated(Parameter* p)
     {
         return false;
@@ -1491,3 +1491,70 @@ void VisjectExecutor::ProcessGroupCollections(Box* box, Node* node, Value& value
         }
     }
 }
+
+VisjectGraphConstantFolder::VisjectGraphConstantFolder(Graph* graph)
+    : _graph(graph)
+{
+}
+
+bool VisjectGraphConstantFolder::CanFold(uint16 groupId)
+{
+    switch (groupId)
+    {
+    case 2: // Constants
+    case 3: // Math
+    case 4: // Packing
+    case 10: // Boolean
+    case 11: // Bitwise
+    case 12: // Comparisons
+        return true;
+    default:
+        return false;
+    }
+}
+
+void VisjectGraphConstantFolder::FoldBox(Box* box)
+{
+    _failed = false;
+    _depth = 0;
+    eatBox(nullptr, box);
+}
+
+void VisjectGraphConstantFolder::OnError(Node* node, Box* box, const StringView& message)
+{
+    // Skip folding and leave the invalid data for the runtime execution to report
+    _failed = true;
+}
+
+VisjectExecutor::Value VisjectGraphConstantFolder::eatBox(Node* caller, Box* box)
+{
+    // Check if already folded (constant subtrees can be shared between boxes)
+    if (box->FoldedValue != INVALID_INDEX)
+        return _graph->FoldedConstants[box->FoldedValue];
+
+    // Reject nodes that cannot be evaluated at load-time (also guard against looped or too deep graphs)
+    const auto parentNode = box->GetParent<Node>();
+    if (!CanFold(parentNode->GroupID) || _depth >= 100)
+    {
+        _failed = true;
+        return Value::Zero;
+    }
+
+    // Evaluate the box value and cache it if the whole subtree is constant
+    _depth++;
+    Value value = Value::Zero;
+    const ProcessBoxHandler func = _perGroupProcessCall[parentNode->GroupID];
+    (this->*func)(box, parentNode, value);
+    _depth--;
+    if (!_failed)
+    {
+        box->FoldedValue = _graph->FoldedConstants.Count();
+        _graph->FoldedConstants.Add(value);
+    }
+    return value;
+}
+
+VisjectExecutor::Graph* VisjectGraphConstantFolder::GetCurrentGraph() const
+{
+    return _graph;
+}
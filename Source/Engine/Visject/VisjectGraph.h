@@ -19,6 +19,11 @@ class VisjectGraphNode;
 class VisjectGraphBox : public GraphBox
 {
 public:
+    /// <summary>
+    /// The index of the value folded for this box during graph loading (INVALID_INDEX if box value is not constant). Used to skip the constant subtrees execution at runtime.
+    /// </summary>
+    int32 FoldedValue = INVALID_INDEX;
+
     VisjectGraphBox()
         : GraphBox()
     {
@@ -151,6 +156,11 @@ public:
     /// </summary>
     Array<BezierCurve<Float4>> Float4Curves;
 
+    /// <summary>
+    /// The values of the constant subtrees folded during graph loading (boxes link to them via FoldedValue index).
+    /// </summary>
+    Array<Variant> FoldedConstants;
+
 public:
     // [Graph]
     bool onNodeLoaded(NodeType* n) override
@@ -198,6 +208,8 @@ public:
         // Base
         return Base::onNodeLoaded(n);
     }
+
+    bool onLoaded() override;
 };
 
 /// <summary>
@@ -269,3 +281,56 @@ protected:
         return box && box->HasConnection() ? eatBox(box->GetParent<Node>(), box->FirstConnection()) : defaultValue;
     }
 };
+
+/// <summary>
+/// Visject graph executor that evaluates the constant subtrees during graph loading. Handles only the deterministic and stateless node groups (constants and pure math) and fails on any node that depends on the runtime state.
+/// </summary>
+class VisjectGraphConstantFolder : public VisjectExecutor
+{
+public:
+    VisjectGraphConstantFolder(Graph* graph);
+
+    // Checks if the nodes from the given group can be evaluated at load-time.
+    static bool CanFold(uint16 groupId);
+
+    // Evaluates the box value and caches it in the graph FoldedConstants storage (if the whole subtree is constant).
+    void FoldBox(Box* box);
+
+private:
+    Graph* _graph;
+    bool _failed = false;
+    int32 _depth = 0;
+
+    void OnError(Node* node, Box* box, const StringView& message) override;
+    Value eatBox(Node* caller, Box* box) override;
+    Graph* GetCurrentGraph() const override;
+};
+
+template<class NodeType, class BoxType, class ParameterType>
+bool VisjectGraph<NodeType, BoxType, ParameterType>::onLoaded()
+{
+    // Precompute the constant parts of the graph once instead of evaluating them on every execution
+    FoldedConstants.Clear();
+    VisjectGraphConstantFolder folder((VisjectExecutor::Graph*)(void*)this);
+    for (int32 i = 0; i < this->Nodes.Count(); i++)
+    {
+        NodeType& node = this->Nodes[i];
+        if (VisjectGraphConstantFolder::CanFold(node.GroupID))
+            continue; // Constant subtrees get folded on-demand when reached from a box of the runtime-evaluated node
+        for (int32 j = 0; j < node.Boxes.Count(); j++)
+        {
+            BoxType& box = node.Boxes[j];
+            if (box.Parent != &node)
+                continue;
+            for (int32 k = 0; k < box.Connections.Count(); k++)
+            {
+                const auto target = (VisjectGraphBox*)box.Connections[k];
+                if (target->FoldedValue == INVALID_INDEX && VisjectGraphConstantFolder::CanFold(target->GetParent<VisjectGraphNode<>>()->GroupID))
+                    folder.FoldBox(target);
+            }
+        }
+    }
+
+    // Base
+    return Base::onLoaded();
+}
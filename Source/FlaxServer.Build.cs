@@ -0,0 +1,18 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+/// <summary>
+/// The Flax Server target that builds a headless standalone application to run cooked game project as a dedicated server (no rendering compiled into the build).
+/// </summary>
+public class FlaxServer : FlaxGame
+{
+    /// <inheritdoc />
+    public override void Init()
+    {
+        base.Init();
+
+        // Initialize
+        OutputName = "FlaxServer";
+        ConfigurationName = "Server";
+        IsHeadless = true;
+    }
+}
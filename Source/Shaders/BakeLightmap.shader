@@ -9,6 +9,7 @@
 // This config must match C++ code
 #define HEMISPHERES_RESOLUTION 64
 #define NUM_SH_TARGETS 3
+#define BAKE_LIGHTMAP_GROUP_SIZE 8
 
 META_CB_BEGIN(0, Data)
 float4 LightmapArea;
@@ -322,12 +323,12 @@ RWBuffer<float4> OutputBuffer : register(u0);
 
 // Blur empty lightmap texels to reduce artifacts (blurs only holes and sets -1 to pixels that are not using lightmap - no data)
 META_CS(true, FEATURE_LEVEL_SM5)
-[numthreads(1, 1, 1)]
-void CS_BlurEmpty(uint3 GroupID : SV_GroupID, uint3 GroupThreadID : SV_GroupThreadID)
+[numthreads(BAKE_LIGHTMAP_GROUP_SIZE, BAKE_LIGHTMAP_GROUP_SIZE, 1)]
+void CS_BlurEmpty(uint3 DispatchThreadID : SV_DispatchThreadID)
 {
-	if (GroupID.x >= AtlasSize || GroupID.y > AtlasSize)
+	if (DispatchThreadID.x >= AtlasSize || DispatchThreadID.y >= AtlasSize)
 		return;
-	const int2 location = int2(GroupID.x, GroupID.y);
+	const int2 location = int2(DispatchThreadID.x, DispatchThreadID.y);
 	const uint texelAdress = (location.y * AtlasSize + location.x) * NUM_SH_TARGETS;
 
 	// TODO: use more threads to sample lightmap and final therad make it blur
@@ -403,12 +404,12 @@ RWBuffer<float4> OutputBuffer : register(u0);
 
 // Fills the empty lightmap texels with blurred data of the surroundings texels (uses only valid ones)
 META_CS(true, FEATURE_LEVEL_SM5)
-[numthreads(1, 1, 1)]
-void CS_Dilate(uint3 GroupID : SV_GroupID, uint3 GroupThreadID : SV_GroupThreadID)
+[numthreads(BAKE_LIGHTMAP_GROUP_SIZE, BAKE_LIGHTMAP_GROUP_SIZE, 1)]
+void CS_Dilate(uint3 DispatchThreadID : SV_DispatchThreadID)
 {
-	if (GroupID.x >= AtlasSize || GroupID.y > AtlasSize)
+	if (DispatchThreadID.x >= AtlasSize || DispatchThreadID.y >= AtlasSize)
 		return;
-	const int2 location = int2(GroupID.x, GroupID.y);
+	const int2 location = int2(DispatchThreadID.x, DispatchThreadID.y);
 	const uint texelAdress = (location.y * AtlasSize + location.x) * NUM_SH_TARGETS;
 
 	// Copy data
@@ -468,12 +469,12 @@ RWBuffer<float4> OutputBuffer : register(u0);
 
 // Cleanups the lightmap data by removing the invalid texels to be just pure black
 META_CS(true, FEATURE_LEVEL_SM5)
-[numthreads(1, 1, 1)]
-void CS_Finalize(uint3 GroupID : SV_GroupID, uint3 GroupThreadID : SV_GroupThreadID)
+[numthreads(BAKE_LIGHTMAP_GROUP_SIZE, BAKE_LIGHTMAP_GROUP_SIZE, 1)]
+void CS_Finalize(uint3 DispatchThreadID : SV_DispatchThreadID)
 {
-	if (GroupID.x >= AtlasSize || GroupID.y > AtlasSize)
+	if (DispatchThreadID.x >= AtlasSize || DispatchThreadID.y >= AtlasSize)
 		return;
-	const int2 location = int2(GroupID.x, GroupID.y);
+	const int2 location = int2(DispatchThreadID.x, DispatchThreadID.y);
 	const uint texelAdress = (location.y * AtlasSize + location.x) * NUM_SH_TARGETS;
 
 	// Check if pixel has valid value
@@ -95,13 +95,13 @@ float4 PS_ApplyLuminance(Quad_VS2PS input) : SV_Target
 
 #endif
 
-#ifdef _PS_Histogram
+#ifdef _CS_ResolveHistogram
 
 // This define must match the C++
 #define HISTOGRAM_SIZE 64
 
 StructuredBuffer<uint> HistogramBuffer : register(t0);
-Texture2D PreviousLuminance : register(t1);
+RWTexture2D<float> AdaptedLuminance : register(u0);
 
 float ComputeLuminanceFromHistogramPosition(float histogramPosition)
 {
@@ -146,12 +146,21 @@ float GetAverageLuminance()
 	return runningSum.x / max(runningSum.y, 0.0001f);
 }
 
-// Samples evaluates the scene color luminance based on the histogram
-META_PS(true, FEATURE_LEVEL_ES2)
-float4 PS_Histogram(Quad_VS2PS input) : SV_Target
+// Resolves the histogram into the average luminance and adapts the persistent luminance state in-place
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(1, 1, 1)]
+void CS_ResolveHistogram()
 {
 	float currentLum = GetAverageLuminance();
-	return AdaptLuminance(currentLum, PreviousLuminance).xxxx;
+	float previousLum = AdaptedLuminance[uint2(0, 0)];
+
+	// Adapt the luminance using Pattanaik's technique
+	float delta = currentLum - previousLum;
+	float adaptionSpeed = delta > 0 ? SpeedUp : SpeedDown;
+	float luminance = previousLum + delta * (1.0f - exp2(-DeltaTime * adaptionSpeed));
+	luminance = lerp(luminance, currentLum, DropHistory);
+
+	AdaptedLuminance[uint2(0, 0)] = clamp(luminance, MinBrightness, MaxBrightness);
 }
 
 #endif
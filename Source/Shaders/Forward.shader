@@ -2,6 +2,14 @@
 
 #include "./Flax/Common.hlsl"
 
+META_CB_BEGIN(0, Data)
+float4 ViewInfo;
+float2 HalfResTexelSize;
+float2 Dummy0;
+META_CB_END
+
+#ifdef _PS_ApplyDistortion
+
 Texture2D Input : register(t0);
 Texture2D Distortion : register(t1);
 
@@ -22,3 +30,46 @@ float4 PS_ApplyDistortion(Quad_VS2PS input) : SV_Target
 
 	return Input.SampleLevel(SamplerPointClamp, newTexCoord, 0);
 }
+
+#endif
+
+#ifdef _PS_CompositeHalfRes
+
+Texture2D HalfResColor : register(t0);
+Texture2D<float> HalfResDepth : register(t1);
+Texture2D<float> FullResDepth : register(t2);
+
+// Pixel shader for compositing the half-resolution transparency buffer with a depth-aware bilateral upsample
+META_PS(true, FEATURE_LEVEL_ES2)
+float4 PS_CompositeHalfRes(Quad_VS2PS input) : SV_Target
+{
+	// Linearize the depth of the shaded full-res pixel
+	float fullResDepth = ViewInfo.w / (FullResDepth.SampleLevel(SamplerPointClamp, input.TexCoord, 0) - ViewInfo.z);
+
+	// Sample the 2x2 half-res neighborhood, weighting the bilinear footprint by the depth similarity to reject samples across silhouette edges
+	float2 pixel = input.TexCoord / HalfResTexelSize - 0.5f;
+	float2 uvBase = (floor(pixel) + 0.5f) * HalfResTexelSize;
+	float2 lerps = frac(pixel);
+	float4 bilinearWeights = float4(
+		(1.0f - lerps.x) * (1.0f - lerps.y),
+		lerps.x * (1.0f - lerps.y),
+		(1.0f - lerps.x) * lerps.y,
+		lerps.x * lerps.y);
+	float4 color = 0;
+	float weightSum = 0;
+	UNROLL
+	for (uint i = 0; i < 4; i++)
+	{
+		float2 uv = uvBase + float2(i & 1, i >> 1) * HalfResTexelSize;
+		float halfResDepth = ViewInfo.w / (HalfResDepth.SampleLevel(SamplerPointClamp, uv, 0) - ViewInfo.z);
+		float weight = bilinearWeights[i] * rcp(0.0001f + abs(fullResDepth - halfResDepth));
+		color += HalfResColor.SampleLevel(SamplerPointClamp, uv, 0) * weight;
+		weightSum += weight;
+	}
+	color /= max(weightSum, 0.0001f);
+
+	// Output coverage-premultiplied color (blended with One/InvSrcAlpha onto the scene)
+	return float4(color.rgb, saturate(color.a));
+}
+
+#endif
@@ -20,14 +20,6 @@ META_CB_END
 // Particles data buffer
 ByteAddressBuffer ParticlesData : register(t0);
 
-// Output sorting keys buffer (index + key)
-struct Item
-{
-	float Key;
-	uint Value;
-};
-RWStructuredBuffer<Item> SortingKeys : register(u0);
-
 float GetParticleFloat(uint particleIndex, int offset)
 {
 	return asfloat(ParticlesData.Load(particleIndex * ParticleStride + offset));
@@ -38,6 +30,16 @@ float3 GetParticleVec3(uint particleIndex, int offset)
 	return asfloat(ParticlesData.Load3(particleIndex * ParticleStride + offset));
 }
 
+#ifndef _CS_WriteSortArgs
+
+// Output sorting keys buffer (index + key)
+struct Item
+{
+	float Key;
+	uint Value;
+};
+RWStructuredBuffer<Item> SortingKeys : register(u0);
+
 // Sorting keys generation shader
 META_CS(true, FEATURE_LEVEL_SM5)
 META_PERMUTATION_1(SORT_MODE=0)
@@ -85,3 +87,19 @@ void CS_Sort(uint3 dispatchThreadId : SV_DispatchThreadID)
 	item.Value = index;
 	SortingKeys[index] = item;
 }
+
+#else
+
+// Indirect dispatch arguments buffer
+RWByteAddressBuffer IndirectArgs : register(u0);
+
+// Writes the sorting keys generation indirect dispatch arguments based on the current particles count
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(1, 1, 1)]
+void CS_WriteSortArgs()
+{
+	uint particlesCount = min(ParticlesData.Load(ParticleCounterOffset), ParticleCapacity);
+	IndirectArgs.Store3(0, uint3((particlesCount + 1023) / 1024, 1, 1));
+}
+
+#endif
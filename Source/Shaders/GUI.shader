@@ -101,6 +101,19 @@ float4 PS_Font(VS2PS input) : SV_Target0
 	return color;
 }
 
+META_PS(true, FEATURE_LEVEL_ES2)
+float4 PS_FontSDF(VS2PS input) : SV_Target0
+{
+	PerformClipping(input);
+
+	// Reconstruct the glyph edge (0.5 in the distance field) with screen-space antialiasing
+	float distance = Image.Sample(SamplerLinearClamp, input.TexCoord).r;
+	float smoothing = max(fwidth(distance) * 0.7071f, 0.0001f);
+	float4 color = input.Color;
+	color.a *= smoothstep(0.5f - smoothing, 0.5f + smoothing, distance);
+	return color;
+}
+
 float4 GetSample(float weight, float offset, float2 uv)
 {
 #if BLUR_V
@@ -0,0 +1,139 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "./Flax/Common.hlsl"
+
+// Those defines must match the C++
+#define THREADGROUP_SIZE 64
+
+META_CB_BEGIN(0, Data)
+
+float4 FrustumPlanes[6];
+float4x4 PrevViewProjection;
+float2 HiZSize;
+uint InstanceCount;
+uint HiZMipCount;
+
+META_CB_END
+
+// Instance bounding spheres: xyz = center (view-relative), w = radius
+StructuredBuffer<float4> InstanceBounds : register(t0);
+
+// Hi-Z depth pyramid (max-downsampled from the previous frame depth)
+Texture2D<float> HiZBuffer : register(t1);
+
+// Compacted indices of the visible instances
+RWStructuredBuffer<uint> VisibleInstances : register(u0);
+
+// Indirect draw arguments (GPUDrawIndexedIndirectArgs layout, InstanceCount at offset 1)
+RWBuffer<uint> IndirectArgs : register(u1);
+
+#ifdef _CS_ResetArgs
+
+// Resets the visible instances counter in the indirect args
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(1, 1, 1)]
+void CS_ResetArgs()
+{
+	IndirectArgs[1] = 0u;
+}
+
+#endif
+
+#ifdef _CS_BuildHiZ
+
+Texture2D<float> HiZSource : register(t2);
+RWTexture2D<float> HiZDest : register(u2);
+
+// Builds a single mip of the Hi-Z pyramid by max-downsampling the source depth (the farthest depth is kept so tests stay conservative)
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(8, 8, 1)]
+void CS_BuildHiZ(uint3 dispatchThreadId : SV_DispatchThreadID)
+{
+	uint2 dstSize;
+	HiZDest.GetDimensions(dstSize.x, dstSize.y);
+	if (any(dispatchThreadId.xy >= dstSize))
+		return;
+	uint2 srcSize;
+	HiZSource.GetDimensions(srcSize.x, srcSize.y);
+
+	// Cover the additional edge texels when the source dimension is odd
+	const uint2 count = uint2(2, 2) + (srcSize & 1);
+	float maxDepth = 0.0f;
+	for (uint y = 0; y < count.y; y++)
+	{
+		for (uint x = 0; x < count.x; x++)
+		{
+			const uint2 src = min(dispatchThreadId.xy * 2 + uint2(x, y), srcSize - 1);
+			maxDepth = max(maxDepth, HiZSource.Load(int3(src, 0)));
+		}
+	}
+	HiZDest[dispatchThreadId.xy] = maxDepth;
+}
+
+#endif
+
+#ifdef _CS_CullInstances
+
+// Tests the sphere against the Hi-Z pyramid built from the previous frame depth (reprojected). Returns false if the sphere is fully occluded.
+bool HiZTest(float4 bounds)
+{
+	// Project the corners of the sphere bounds onto the previous frame screen (the projected box hull is conservative)
+	const float3 boundsMin = bounds.xyz - bounds.w;
+	const float3 boundsMax = bounds.xyz + bounds.w;
+	float2 rectMin = 1, rectMax = -1;
+	float minDepth = 1;
+	UNROLL
+	for (uint i = 0; i < 8; i++)
+	{
+		const float3 corner = float3(i & 1 ? boundsMax.x : boundsMin.x, i & 2 ? boundsMax.y : boundsMin.y, i & 4 ? boundsMax.z : boundsMin.z);
+		float4 clipPos = mul(float4(corner, 1), PrevViewProjection);
+		if (clipPos.w < 0.001f)
+			return true; // Crosses the near plane - always visible
+		clipPos.xyz /= clipPos.w;
+		rectMin = min(rectMin, clipPos.xy);
+		rectMax = max(rectMax, clipPos.xy);
+		minDepth = min(minDepth, clipPos.z);
+	}
+	if (any(rectMin < -1) || any(rectMax > 1) || minDepth >= 1)
+		return true; // Partially off-screen - depth is unknown outside the buffer
+
+	// Pick the pyramid mip where the rect spans at most 2x2 texels and test against the max depth
+	const float2 uvMin = float2(rectMin.x, -rectMax.y) * 0.5f + 0.5f;
+	const float2 uvMax = float2(rectMax.x, -rectMin.y) * 0.5f + 0.5f;
+	const float2 rectPixels = (uvMax - uvMin) * HiZSize;
+	const float mip = min(ceil(log2(max(max(rectPixels.x, rectPixels.y), 1.0f) * 0.5f)), (float)(HiZMipCount - 1));
+	const float maxDepth = max(
+		max(HiZBuffer.SampleLevel(SamplerPointClamp, uvMin, mip), HiZBuffer.SampleLevel(SamplerPointClamp, uvMax, mip)),
+		max(HiZBuffer.SampleLevel(SamplerPointClamp, float2(uvMin.x, uvMax.y), mip), HiZBuffer.SampleLevel(SamplerPointClamp, float2(uvMax.x, uvMin.y), mip)));
+	return minDepth <= maxDepth;
+}
+
+// Culls the instance bounding spheres against the view frustum (and optionally the Hi-Z pyramid) and appends visible instance indices
+META_CS(true, FEATURE_LEVEL_SM5)
+META_PERMUTATION_1(USE_OCCLUSION=0)
+META_PERMUTATION_1(USE_OCCLUSION=1)
+[numthreads(THREADGROUP_SIZE, 1, 1)]
+void CS_CullInstances(uint3 dispatchThreadId : SV_DispatchThreadID)
+{
+	const uint index = dispatchThreadId.x;
+	if (index >= InstanceCount)
+		return;
+	const float4 bounds = InstanceBounds[index];
+	bool visible = true;
+	UNROLL
+	for (uint i = 0; i < 6; i++)
+	{
+		visible = visible && dot(FrustumPlanes[i].xyz, bounds.xyz) + FrustumPlanes[i].w > -bounds.w;
+	}
+#if USE_OCCLUSION
+	visible = visible && HiZTest(bounds);
+#endif
+	if (visible)
+	{
+		uint slot;
+		InterlockedAdd(IndirectArgs[1], 1u, slot);
+		VisibleInstances[slot] = index;
+	}
+}
+
+#endif
@@ -20,6 +20,13 @@ META_CB_BEGIN(1, PerFrame)
 GBufferData GBuffer;
 META_CB_END
 
+// Tiled lights binning data
+META_CB_BEGIN(2, TiledData)
+uint LightsCount;
+uint TilesX;
+float2 Dummy0;
+META_CB_END
+
 DECLARE_GBUFFERDATA_ACCESS(GBuffer)
 
 // Rendered shadow
@@ -175,3 +182,130 @@ float4 PS_Sky(Model_VS2PS input) : SV_Target0
 
 	return output;
 }
+
+// Tiled point lights rendering (must match LightPass)
+#define TILED_LIGHTS_TILE_SIZE 16
+#define TILED_LIGHTS_MAX_PER_TILE 63
+#define TILED_LIGHTS_GROUP_SIZE (TILED_LIGHTS_TILE_SIZE * TILED_LIGHTS_TILE_SIZE)
+
+// Data of the point lights to bin into the screen tiles
+StructuredBuffer<LightData> TiledLights : register(t8);
+// Per-tile light lists: lights count followed by the light indices
+Buffer<uint> TiledLightsLists : register(t9);
+RWBuffer<uint> RWTiledLightsLists : register(u0);
+
+groupshared uint TileMinZ;
+groupshared uint TileMaxZ;
+groupshared uint TileLightsCount;
+groupshared uint TileLights[TILED_LIGHTS_MAX_PER_TILE];
+
+// Compute shader for culling the point lights against the screen tiles (one group per tile)
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(TILED_LIGHTS_TILE_SIZE, TILED_LIGHTS_TILE_SIZE, 1)]
+void CS_CullLights(uint3 dispatchThreadId : SV_DispatchThreadID, uint3 groupId : SV_GroupID, uint groupIndex : SV_GroupIndex)
+{
+	GBufferData gBufferData = GetGBufferData();
+	if (groupIndex == 0)
+	{
+		TileMinZ = asuint(gBufferData.ViewFar);
+		TileMaxZ = 0;
+		TileLightsCount = 0;
+	}
+	GroupMemoryBarrierWithGroupSync();
+
+	// Reduce the depth bounds of the tile surface (skip the sky pixels)
+	float2 uv = ((float2)dispatchThreadId.xy + 0.5f) * gBufferData.ScreenSize.zw;
+	float deviceDepth = SampleZ(uv);
+	if (all(dispatchThreadId.xy < (uint2)gBufferData.ScreenSize.xy) && deviceDepth < 1.0f)
+	{
+		uint linearDepth = asuint(LinearizeZ(gBufferData, deviceDepth) * gBufferData.ViewFar);
+		InterlockedMin(TileMinZ, linearDepth);
+		InterlockedMax(TileMaxZ, linearDepth);
+	}
+	GroupMemoryBarrierWithGroupSync();
+	float tileMinZ = asfloat(TileMinZ);
+	float tileMaxZ = asfloat(TileMaxZ);
+
+	// Build the tile frustum side planes (crossing the camera position and the tile corners at the far plane)
+	float3 cameraPos = gBufferData.ViewPos;
+	float2 tileMinUV = (float2)(groupId.xy * TILED_LIGHTS_TILE_SIZE) * gBufferData.ScreenSize.zw;
+	float2 tileMaxUV = (float2)((groupId.xy + 1) * TILED_LIGHTS_TILE_SIZE) * gBufferData.ScreenSize.zw;
+	float3 corners[4];
+	corners[0] = GetWorldPos(gBufferData, tileMinUV, 1.0f) - cameraPos;
+	corners[1] = GetWorldPos(gBufferData, float2(tileMaxUV.x, tileMinUV.y), 1.0f) - cameraPos;
+	corners[2] = GetWorldPos(gBufferData, tileMaxUV, 1.0f) - cameraPos;
+	corners[3] = GetWorldPos(gBufferData, float2(tileMinUV.x, tileMaxUV.y), 1.0f) - cameraPos;
+	float3 tileCenter = (corners[0] + corners[1] + corners[2] + corners[3]) * 0.25f;
+	float3 planes[4];
+	UNROLL
+	for (uint planeIndex = 0; planeIndex < 4; planeIndex++)
+	{
+		// Normals point into the tile frustum
+		planes[planeIndex] = normalize(cross(corners[planeIndex], corners[(planeIndex + 1) & 3]));
+		if (dot(tileCenter, planes[planeIndex]) < 0)
+			planes[planeIndex] = -planes[planeIndex];
+	}
+	float3 viewForward = normalize(mul(float4(0, 0, 1, 0), gBufferData.InvViewMatrix).xyz);
+
+	// Cull the lights against the tile frustum
+	LOOP
+	for (uint lightIndex = groupIndex; lightIndex < LightsCount; lightIndex += TILED_LIGHTS_GROUP_SIZE)
+	{
+		LightData light = TiledLights[lightIndex];
+		float3 toLight = light.Position - cameraPos;
+		float lightDepth = dot(toLight, viewForward);
+		bool visible = lightDepth + light.Radius >= tileMinZ && lightDepth - light.Radius <= tileMaxZ;
+		UNROLL
+		for (uint planeIndex = 0; planeIndex < 4; planeIndex++)
+			visible = visible && dot(toLight, planes[planeIndex]) > -light.Radius;
+		if (visible)
+		{
+			uint slot;
+			InterlockedAdd(TileLightsCount, 1, slot);
+			if (slot < TILED_LIGHTS_MAX_PER_TILE)
+				TileLights[slot] = lightIndex;
+		}
+	}
+	GroupMemoryBarrierWithGroupSync();
+
+	// Write the tile light list
+	uint listOffset = (groupId.y * TilesX + groupId.x) * (TILED_LIGHTS_MAX_PER_TILE + 1);
+	uint count = min(TileLightsCount, TILED_LIGHTS_MAX_PER_TILE);
+	if (groupIndex == 0)
+		RWTiledLightsLists[listOffset] = count;
+	LOOP
+	for (uint itemIndex = groupIndex; itemIndex < count; itemIndex += TILED_LIGHTS_GROUP_SIZE)
+		RWTiledLightsLists[listOffset + 1 + itemIndex] = TileLights[itemIndex];
+}
+
+// Pixel shader for shading the point lights binned into the screen tiles
+META_PS(true, FEATURE_LEVEL_SM5)
+META_PERMUTATION_1(LIGHTING_NO_SPECULAR=0)
+META_PERMUTATION_1(LIGHTING_NO_SPECULAR=1)
+void PS_TiledPointLights(Quad_VS2PS input, out float4 output : SV_Target0)
+{
+	output = 0;
+
+	// Sample GBuffer
+	GBufferData gBufferData = GetGBufferData();
+	GBufferSample gBuffer = SampleGBuffer(gBufferData, input.TexCoord);
+
+	// Check if cannot shadow pixel
+	BRANCH
+	if (gBuffer.ShadingModel == SHADING_MODEL_UNLIT)
+	{
+		discard;
+		return;
+	}
+
+	// Accumulate the lighting from all lights binned into the tile
+	uint2 tile = (uint2)input.Position.xy / TILED_LIGHTS_TILE_SIZE;
+	uint listOffset = (tile.y * TilesX + tile.x) * (TILED_LIGHTS_MAX_PER_TILE + 1);
+	uint count = TiledLightsLists[listOffset];
+	LOOP
+	for (uint i = 0; i < count; i++)
+	{
+		LightData light = TiledLights[TiledLightsLists[listOffset + 1 + i]];
+		output += GetLighting(gBufferData.ViewPos, light, gBuffer, 1, true, false);
+	}
+}
@@ -66,11 +66,16 @@ float2 InvInputSize;
 float ChromaticDistortion;
 float Time;
 
-float Dummy1;
+float EyeAdaptationExposure;
 float PostExposure;
 float VignetteIntensity;
 float LensDirtIntensity;
 
+float EyeAdaptationUseLuminance;
+float Dummy1;
+float Dummy2;
+float Dummy3;
+
 float4 ScreenFadeColor;
 
 float4x4 LensFlareStarMat;
@@ -252,11 +257,25 @@ float2 coordRot(in float2 tc, in float angle)
 	return float2(rotX, rotY);
 }
 
+// Calculates the eye adaptation exposure scale (fused into the bloom threshold and the composite passes instead of a separate full-screen multiply pass)
+float GetEyeAdaptationExposure()
+{
+	float exposure = EyeAdaptationExposure;
+	BRANCH
+	if (EyeAdaptationUseLuminance > 0)
+	{
+		float averageLuminance = Input1.Load(int3(0, 0, 0)).x;
+		exposure /= averageLuminance;
+	}
+	return exposure;
+}
+
 // Uses a lower exposure to produce a value suitable for a bloom pass
 META_PS(true, FEATURE_LEVEL_ES2)
 float4 PS_Threshold(Quad_VS2PS input) : SV_Target
 {
 	float4 color = Input0.SampleLevel(SamplerLinearClamp, input.TexCoord, 0);
+	color.rgb *= GetEyeAdaptationExposure();
     return clamp(color - BloomThreshold, 0, BloomLimit);
 }
 
@@ -452,6 +471,9 @@ float4 PS_Composite(Quad_VS2PS input) : SV_Target
 		color = Input0.Sample(SamplerLinearClamp, uv);
 	}
 
+	// Eye Adaptation exposure (bloom and lens flares inputs have it already applied by the threshold pass)
+	color.rgb *= GetEyeAdaptationExposure();
+
 	// Lens Flares
 	BRANCH
 	if (LensFlareIntensity > 0)
@@ -13,7 +13,8 @@ LightData Light;
 LightShadowData LightShadow;
 float4x4 WVP;
 float4x4 ViewProjectionMatrix;
-float2 Dummy0;
+float Dummy0;
+float ContactShadowsHiZ;
 float ContactShadowsDistance;
 float ContactShadowsLength;
 META_CB_END
@@ -23,6 +24,9 @@ DECLARE_LIGHTSHADOWDATA_ACCESS(LightShadow);
 
 #if CONTACT_SHADOWS
 
+// Hi-Z depth pyramid shared with the occlusion culling (half-res with a full mip chain, device depth values)
+Texture2D<float> HiZDepth : register(t6);
+
 float RayCastScreenSpaceShadow(GBufferData gBufferData, GBufferSample gBuffer, float3 rayStartWS, float3 rayDirWS, float rayLength)
 {
 #if SHADOWS_QUALITY == 3
@@ -43,7 +47,19 @@ float RayCastScreenSpaceShadow(GBufferData gBufferData, GBufferSample gBuffer, f
 	{
 		float3 rayUV = rayCS.xyz / rayCS.w;
 		rayUV.xy = rayUV.xy * float2(0.5, -0.5) + float2(0.5, 0.5);
-		float sceneDepth = SampleDepth(gBufferData, rayUV.xy) * gBufferData.ViewFar;
+		float sceneDepth;
+		BRANCH
+		if (ContactShadowsHiZ > 0)
+		{
+			// March through the depth pyramid - fine mips near the ray start for contact hardening, coarser mips further along for cheaper taps
+			float mip = min(floor(step * 0.34f), 3.0f);
+			float deviceDepth = HiZDepth.SampleLevel(SamplerPointClamp, rayUV.xy, mip);
+			sceneDepth = (gBufferData.ViewInfo.w / (deviceDepth - gBufferData.ViewInfo.z)) * gBufferData.ViewFar;
+		}
+		else
+		{
+			sceneDepth = SampleDepth(gBufferData, rayUV.xy) * gBufferData.ViewFar;
+		}
 		float rayDepth = (gBufferData.ViewInfo.w / (rayUV.z - gBufferData.ViewInfo.z)) * gBufferData.ViewFar * 0.998;
 		float surfaceThickness = 0.035f + rayDepth * rayLength;
 		float depthTestHardness = 0.005f;
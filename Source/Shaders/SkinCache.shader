@@ -0,0 +1,169 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "./Flax/Common.hlsl"
+
+// Those defines must match the C++
+#define THREADGROUP_SIZE 64
+
+// Must match VB0SkinnedElementType (Float3 Position, Half2 TexCoord, Float1010102 Normal, Float1010102 Tangent, Color32 BlendIndices, Half4 BlendWeights)
+#define VERTEX_STRIDE 36
+
+META_CB_BEGIN(0, Data)
+
+uint VerticesCount;
+uint StartVertexIndex;
+float BlendShapeWeight;
+uint Dummy0;
+
+META_CB_END
+
+// Unpacks the normal vector from the 10-10-10-2 vertex format
+float3 UnpackNormal(uint packed)
+{
+	return float3(packed & 0x3ff, (packed >> 10) & 0x3ff, (packed >> 20) & 0x3ff) * (1.0f / 1023.0f) * 2 - 1;
+}
+
+// Packs the normal vector into the 10-10-10-2 vertex format (the sign bits in w are passed through unchanged)
+uint PackNormal(uint packed, float3 normal)
+{
+	uint3 bits = uint3(saturate(normal * 0.5f + 0.5f) * 1023.0f);
+	return (packed & 0xc0000000) | bits.x | (bits.y << 10) | (bits.z << 20);
+}
+
+#ifdef _CS_SkinVertices
+
+ByteAddressBuffer InputVertices : register(t0);
+Buffer<float4> BoneMatrices : register(t1);
+RWByteAddressBuffer OutputVertices : register(u0);
+
+float3x4 GetBoneMatrix(uint boneIndex)
+{
+	uint baseIndex = boneIndex * 3;
+	return float3x4(BoneMatrices[baseIndex], BoneMatrices[baseIndex + 1], BoneMatrices[baseIndex + 2]);
+}
+
+// Pre-skins the mesh vertices into the skin cache buffer (the same layout as the source vertex buffer but with the identity bone weights)
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(THREADGROUP_SIZE, 1, 1)]
+void CS_SkinVertices(uint dispatchThreadId : SV_DispatchThreadID)
+{
+	if (dispatchThreadId >= VerticesCount)
+		return;
+	uint address = dispatchThreadId * VERTEX_STRIDE;
+
+	// Load the vertex data
+	float3 position = asfloat(InputVertices.Load3(address + 0));
+	uint texCoord = InputVertices.Load(address + 12);
+	uint normalPacked = InputVertices.Load(address + 16);
+	uint tangentPacked = InputVertices.Load(address + 20);
+	uint blendIndicesPacked = InputVertices.Load(address + 24);
+	uint2 blendWeightsPacked = InputVertices.Load2(address + 28);
+
+	// Unpack the skinning data
+	uint4 blendIndices = uint4(blendIndicesPacked & 0xff, (blendIndicesPacked >> 8) & 0xff, (blendIndicesPacked >> 16) & 0xff, (blendIndicesPacked >> 24) & 0xff);
+	float4 blendWeights = float4(f16tof32(blendWeightsPacked.x), f16tof32(blendWeightsPacked.x >> 16), f16tof32(blendWeightsPacked.y), f16tof32(blendWeightsPacked.y >> 16));
+
+	// Compute the blended skinning matrix
+	float3x4 boneMatrix = blendWeights.x * GetBoneMatrix(blendIndices.x);
+	boneMatrix += blendWeights.y * GetBoneMatrix(blendIndices.y);
+	boneMatrix += blendWeights.z * GetBoneMatrix(blendIndices.z);
+	boneMatrix += blendWeights.w * GetBoneMatrix(blendIndices.w);
+
+	// Skin the position
+	position = mul(boneMatrix, float4(position, 1));
+
+	// Skin the tangent frame (normalized to fit the unorm packing range)
+	float3 normal = normalize(mul(boneMatrix, float4(UnpackNormal(normalPacked), 0)));
+	float3 tangent = normalize(mul(boneMatrix, float4(UnpackNormal(tangentPacked), 0)));
+	normalPacked = PackNormal(normalPacked, normal);
+	tangentPacked = PackNormal(tangentPacked, tangent);
+
+	// Write the skinned vertex with the identity bone so the vertex shader skinning becomes a no-op
+	OutputVertices.Store3(address + 0, asuint(position));
+	OutputVertices.Store(address + 12, texCoord);
+	OutputVertices.Store(address + 16, normalPacked);
+	OutputVertices.Store(address + 20, tangentPacked);
+	OutputVertices.Store(address + 24, 0); // BlendIndices=(0,0,0,0)
+	OutputVertices.Store2(address + 28, uint2(0x3c00, 0)); // BlendWeights=(1,0,0,0)
+}
+
+#endif
+
+#ifdef _CS_CopyVertices
+
+ByteAddressBuffer InputVertices : register(t0);
+RWByteAddressBuffer OutputVertices : register(u0);
+
+// Copies the source mesh vertices into the blend shapes buffer (the deltas of the active blend shapes get added on top of it)
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(THREADGROUP_SIZE, 1, 1)]
+void CS_CopyVertices(uint dispatchThreadId : SV_DispatchThreadID)
+{
+	if (dispatchThreadId >= VerticesCount)
+		return;
+	uint address = dispatchThreadId * VERTEX_STRIDE;
+	OutputVertices.Store4(address + 0, InputVertices.Load4(address + 0));
+	OutputVertices.Store4(address + 16, InputVertices.Load4(address + 16));
+	OutputVertices.Store(address + 32, InputVertices.Load(address + 32));
+}
+
+#endif
+
+#ifdef _CS_BlendShapeDeltas
+
+// Must match BlendShapeVertex
+struct BlendShapeVertex
+{
+	float3 PositionDelta;
+	float3 NormalDelta;
+	uint VertexIndex;
+};
+
+StructuredBuffer<BlendShapeVertex> BlendShapeDeltas : register(t0);
+RWByteAddressBuffer OutputVertices : register(u0);
+
+// Adds the weighted deltas of a single blend shape to the vertices (dispatched per active blend shape, one thread per delta)
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(THREADGROUP_SIZE, 1, 1)]
+void CS_BlendShapeDeltas(uint dispatchThreadId : SV_DispatchThreadID)
+{
+	if (dispatchThreadId >= VerticesCount)
+		return;
+	BlendShapeVertex delta = BlendShapeDeltas[dispatchThreadId];
+	uint address = delta.VertexIndex * VERTEX_STRIDE;
+
+	float3 position = asfloat(OutputVertices.Load3(address + 0));
+	position += delta.PositionDelta * BlendShapeWeight;
+	OutputVertices.Store3(address + 0, asuint(position));
+
+	uint normalPacked = OutputVertices.Load(address + 16);
+	float3 normal = UnpackNormal(normalPacked) + delta.NormalDelta;
+	OutputVertices.Store(address + 16, PackNormal(normalPacked, normal));
+}
+
+#endif
+
+#ifdef _CS_BlendShapeNormalize
+
+RWByteAddressBuffer OutputVertices : register(u0);
+
+// Normalizes the normal vectors and rebuilds the tangent frames of the vertices touched by the blend shapes
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(THREADGROUP_SIZE, 1, 1)]
+void CS_BlendShapeNormalize(uint dispatchThreadId : SV_DispatchThreadID)
+{
+	if (dispatchThreadId >= VerticesCount)
+		return;
+	uint address = (StartVertexIndex + dispatchThreadId) * VERTEX_STRIDE;
+
+	uint normalPacked = OutputVertices.Load(address + 16);
+	float3 normal = normalize(UnpackNormal(normalPacked));
+	OutputVertices.Store(address + 16, PackNormal(normalPacked, normal));
+
+	uint tangentPacked = OutputVertices.Load(address + 20);
+	float3 tangent = UnpackNormal(tangentPacked);
+	tangent = normalize(tangent - dot(tangent, normal) * normal);
+	OutputVertices.Store(address + 20, PackNormal(tangentPacked, tangent));
+}
+
+#endif
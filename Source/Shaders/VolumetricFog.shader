@@ -43,7 +43,8 @@ uint MissedHistorySamplesCount;
 uint3 GridSizeInt;
 float PhaseG;
 
-float2 Dummy0;
+uint TemporalUpdatePhase;
+float Dummy0;
 float VolumetricFogMaxDistance;
 float InverseSquaredLightDistanceBiasScale;
 
@@ -310,6 +311,19 @@ void CS_LightScattering(uint3 GroupId : SV_GroupID, uint3 DispatchThreadId : SV_
 		historyAlpha = 0;
 	samplesCount = historyAlpha < 0.001f && all(gridCoordinate < GridSizeInt) ? MissedHistorySamplesCount : 1;
 
+	// Temporal interleaved update: refresh only a quarter of the froxels per frame (2x2 checkerboard), the rest reuses the reprojected history (phase >= 4 updates everything)
+	BRANCH
+	if (TemporalUpdatePhase < 4 && historyAlpha > 0 && ((gridCoordinate.x & 1) | ((gridCoordinate.y & 1) << 1)) != TemporalUpdatePhase)
+	{
+		if (all(gridCoordinate < GridSizeInt))
+		{
+			float4 history = LightScatteringHistory.SampleLevel(SamplerLinearClamp, historyUV, 0);
+			history = isnan(history) || isinf(history) ? 0 : history;
+			RWLightScattering[gridCoordinate] = max(history, 0);
+		}
+		return;
+	}
+
 	for (uint sampleIndex = 0; sampleIndex < samplesCount; sampleIndex++)
 	{
 		float3 cellOffset = FrameJitterOffsets[sampleIndex].xyz;
@@ -335,6 +335,10 @@ dtCrowd::dtCrowd() :
 	m_activeAgents(0),
 	m_agentAnims(0),
 	m_obstacleQuery(0),
+	m_parallelFor(0),
+	m_workerObstacleQueries(0),
+	m_workerVelocitySampleCounts(0),
+	m_workerCount(0),
 	m_grid(0),
 	m_pathResult(0),
 	m_maxPathResult(0),
@@ -371,7 +375,19 @@ void dtCrowd::purge()
 
 	dtFreeObstacleAvoidanceQuery(m_obstacleQuery);
 	m_obstacleQuery = 0;
-	
+
+	if (m_workerObstacleQueries)
+	{
+		for (int i = 0; i < m_workerCount; ++i)
+			dtFreeObstacleAvoidanceQuery(m_workerObstacleQueries[i]);
+		dtFree(m_workerObstacleQueries);
+		m_workerObstacleQueries = 0;
+	}
+	dtFree(m_workerVelocitySampleCounts);
+	m_workerVelocitySampleCounts = 0;
+	m_workerCount = 0;
+	m_parallelFor = 0;
+
 	dtFreeNavMeshQuery(m_navquery);
 	m_navquery = 0;
 }
@@ -462,6 +478,46 @@ bool dtCrowd::init(const int maxAgents, const float maxAgentRadius, dtNavMesh* n
 	return true;
 }
 
+bool dtCrowd::setParallelFor(dtCrowdParallelForFn parallelFor, const int workerCount)
+{
+	// Release the previous workers data
+	if (m_workerObstacleQueries)
+	{
+		for (int i = 0; i < m_workerCount; ++i)
+			dtFreeObstacleAvoidanceQuery(m_workerObstacleQueries[i]);
+		dtFree(m_workerObstacleQueries);
+		m_workerObstacleQueries = 0;
+	}
+	dtFree(m_workerVelocitySampleCounts);
+	m_workerVelocitySampleCounts = 0;
+	m_workerCount = 0;
+	m_parallelFor = 0;
+
+	if (!parallelFor || workerCount < 1)
+		return true;
+
+	// Allocate an obstacle avoidance query per worker
+	m_workerObstacleQueries = (dtObstacleAvoidanceQuery**)dtAlloc(sizeof(dtObstacleAvoidanceQuery*)*workerCount, DT_ALLOC_PERM);
+	if (!m_workerObstacleQueries)
+		return false;
+	memset(m_workerObstacleQueries, 0, sizeof(dtObstacleAvoidanceQuery*)*workerCount);
+	m_workerVelocitySampleCounts = (int*)dtAlloc(sizeof(int)*workerCount, DT_ALLOC_PERM);
+	if (!m_workerVelocitySampleCounts)
+		return false;
+	m_workerCount = workerCount;
+	for (int i = 0; i < workerCount; ++i)
+	{
+		m_workerObstacleQueries[i] = dtAllocObstacleAvoidanceQuery();
+		if (!m_workerObstacleQueries[i])
+			return false;
+		if (!m_workerObstacleQueries[i]->init(6, 8))
+			return false;
+	}
+	m_parallelFor = parallelFor;
+
+	return true;
+}
+
 void dtCrowd::setObstacleAvoidanceParams(const int idx, const dtObstacleAvoidanceParams* params)
 {
 	if (idx >= 0 && idx < DT_CROWD_MAX_OBSTAVOIDANCE_PARAMS)
@@ -1044,6 +1100,72 @@ void dtCrowd::checkPathValidity(dtCrowdAgent** agents, const int nagents, const
 	}
 }
 	
+void dtCrowd::planVelocity(dtCrowdAgent* ag, dtObstacleAvoidanceQuery* obstacleQuery, dtObstacleAvoidanceDebugData* vod, int* velocitySampleCount)
+{
+	if (ag->state != DT_CROWDAGENT_STATE_WALKING)
+		return;
+
+	if (ag->params.updateFlags & DT_CROWD_OBSTACLE_AVOIDANCE)
+	{
+		obstacleQuery->reset();
+
+		// Add neighbours as obstacles.
+		for (int j = 0; j < ag->nneis; ++j)
+		{
+			const dtCrowdAgent* nei = &m_agents[ag->neis[j].idx];
+			obstacleQuery->addCircle(nei->npos, nei->params.radius, nei->vel, nei->dvel);
+		}
+
+		// Append neighbour segments as obstacles.
+		for (int j = 0; j < ag->boundary.getSegmentCount(); ++j)
+		{
+			const float* s = ag->boundary.getSegment(j);
+			if (dtTriArea2D(ag->npos, s, s+3) < 0.0f)
+				continue;
+			obstacleQuery->addSegment(s, s+3);
+		}
+
+		// Sample new safe velocity.
+		bool adaptive = true;
+		int ns = 0;
+
+		const dtObstacleAvoidanceParams* params = &m_obstacleQueryParams[ag->params.obstacleAvoidanceType];
+
+		if (adaptive)
+		{
+			ns = obstacleQuery->sampleVelocityAdaptive(ag->npos, ag->params.radius, ag->desiredSpeed,
+													   ag->vel, ag->dvel, ag->nvel, params, vod);
+		}
+		else
+		{
+			ns = obstacleQuery->sampleVelocityGrid(ag->npos, ag->params.radius, ag->desiredSpeed,
+												   ag->vel, ag->dvel, ag->nvel, params, vod);
+		}
+		*velocitySampleCount += ns;
+	}
+	else
+	{
+		// If not using velocity planning, new velocity is directly the desired velocity.
+		dtVcopy(ag->nvel, ag->dvel);
+	}
+}
+
+struct dtCrowdVelocityPlanningContext
+{
+	dtCrowd* crowd;
+	dtCrowdAgent** agents;
+};
+
+void dtCrowd::planVelocityWorker(const int begin, const int end, const int worker, void* context)
+{
+	dtCrowdVelocityPlanningContext* ctx = (dtCrowdVelocityPlanningContext*)context;
+	dtCrowd* crowd = ctx->crowd;
+	dtObstacleAvoidanceQuery* obstacleQuery = crowd->m_workerObstacleQueries[worker];
+	int* velocitySampleCount = &crowd->m_workerVelocitySampleCounts[worker];
+	for (int i = begin; i < end; ++i)
+		crowd->planVelocity(ctx->agents[i], obstacleQuery, 0, velocitySampleCount);
+}
+
 void dtCrowd::update(const float dt, dtCrowdAgentDebugInfo* debug)
 {
 	m_velocitySampleCount = 0;
@@ -1255,60 +1377,26 @@ void dtCrowd::update(const float dt, dtCrowdAgentDebugInfo* debug)
 		dtVcopy(ag->dvel, dvel);
 	}
 	
-	// Velocity planning.	
-	for (int i = 0; i < nagents; ++i)
+	// Velocity planning.
+	if (m_parallelFor && m_workerCount > 0 && !debug)
 	{
-		dtCrowdAgent* ag = agents[i];
-		
-		if (ag->state != DT_CROWDAGENT_STATE_WALKING)
-			continue;
-		
-		if (ag->params.updateFlags & DT_CROWD_OBSTACLE_AVOIDANCE)
+		// Sample the new safe velocities on multiple workers (each one uses its own obstacle query).
+		dtCrowdVelocityPlanningContext ctx;
+		ctx.crowd = this;
+		ctx.agents = agents;
+		memset(m_workerVelocitySampleCounts, 0, sizeof(int)*m_workerCount);
+		m_parallelFor(nagents, m_workerCount, &ctx, planVelocityWorker);
+		for (int i = 0; i < m_workerCount; ++i)
+			m_velocitySampleCount += m_workerVelocitySampleCounts[i];
+	}
+	else
+	{
+		for (int i = 0; i < nagents; ++i)
 		{
-			m_obstacleQuery->reset();
-			
-			// Add neighbours as obstacles.
-			for (int j = 0; j < ag->nneis; ++j)
-			{
-				const dtCrowdAgent* nei = &m_agents[ag->neis[j].idx];
-				m_obstacleQuery->addCircle(nei->npos, nei->params.radius, nei->vel, nei->dvel);
-			}
-
-			// Append neighbour segments as obstacles.
-			for (int j = 0; j < ag->boundary.getSegmentCount(); ++j)
-			{
-				const float* s = ag->boundary.getSegment(j);
-				if (dtTriArea2D(ag->npos, s, s+3) < 0.0f)
-					continue;
-				m_obstacleQuery->addSegment(s, s+3);
-			}
-
 			dtObstacleAvoidanceDebugData* vod = 0;
-			if (debugIdx == i) 
+			if (debugIdx == i)
 				vod = debug->vod;
-			
-			// Sample new safe velocity.
-			bool adaptive = true;
-			int ns = 0;
-
-			const dtObstacleAvoidanceParams* params = &m_obstacleQueryParams[ag->params.obstacleAvoidanceType];
-				
-			if (adaptive)
-			{
-				ns = m_obstacleQuery->sampleVelocityAdaptive(ag->npos, ag->params.radius, ag->desiredSpeed,
-															 ag->vel, ag->dvel, ag->nvel, params, vod);
-			}
-			else
-			{
-				ns = m_obstacleQuery->sampleVelocityGrid(ag->npos, ag->params.radius, ag->desiredSpeed,
-														 ag->vel, ag->dvel, ag->nvel, params, vod);
-			}
-			m_velocitySampleCount += ns;
-		}
-		else
-		{
-			// If not using velocity planning, new velocity is directly the desired velocity.
-			dtVcopy(ag->nvel, ag->dvel);
+			planVelocity(agents[i], m_obstacleQuery, vod, &m_velocitySampleCount);
 		}
 	}
 
@@ -198,7 +198,14 @@ struct dtCrowdAgentDebugInfo
 	dtObstacleAvoidanceDebugData* vod;
 };
 
-/// Provides local steering behaviors for a group of agents. 
+/// Function prototype used to run a crowd update step on multiple workers. The implementation must
+/// invoke the body over the whole [0, count) range split into at most workerCount sub-ranges, each
+/// executed with a unique worker index, and return once all of them completed.
+/// @ingroup crowd
+typedef void (*dtCrowdParallelForFn)(const int count, const int workerCount, void* context,
+									 void (*body)(const int begin, const int end, const int worker, void* context));
+
+/// Provides local steering behaviors for a group of agents.
 /// @ingroup crowd
 class dtCrowd
 {
@@ -206,12 +213,17 @@ class dtCrowd
 	dtCrowdAgent* m_agents;
 	dtCrowdAgent** m_activeAgents;
 	dtCrowdAgentAnimation* m_agentAnims;
-	
+
 	dtPathQueue m_pathq;
 
 	dtObstacleAvoidanceParams m_obstacleQueryParams[DT_CROWD_MAX_OBSTAVOIDANCE_PARAMS];
 	dtObstacleAvoidanceQuery* m_obstacleQuery;
-	
+
+	dtCrowdParallelForFn m_parallelFor;
+	dtObstacleAvoidanceQuery** m_workerObstacleQueries;
+	int* m_workerVelocitySampleCounts;
+	int m_workerCount;
+
 	dtProximityGrid* m_grid;
 	
 	dtPolyRef* m_pathResult;
@@ -230,6 +242,8 @@ class dtCrowd
 	void updateTopologyOptimization(dtCrowdAgent** agents, const int nagents, const float dt);
 	void updateMoveRequest(const float dt);
 	void checkPathValidity(dtCrowdAgent** agents, const int nagents, const float dt);
+	void planVelocity(dtCrowdAgent* ag, dtObstacleAvoidanceQuery* obstacleQuery, dtObstacleAvoidanceDebugData* vod, int* velocitySampleCount);
+	static void planVelocityWorker(const int begin, const int end, const int worker, void* context);
 
 	inline int getAgentIndex(const dtCrowdAgent* agent) const  { return (int)(agent - m_agents); }
 
@@ -247,7 +261,14 @@ public:
 	///  @param[in]		nav				The navigation mesh to use for planning.
 	/// @return True if the initialization succeeded.
 	bool init(const int maxAgents, const float maxAgentRadius, dtNavMesh* nav);
-	
+
+	/// Sets the parallel-for implementation used to run the velocity planning update step on multiple workers.
+	/// Call it after init() (re-initializing the crowd resets the setup back to single-threaded).
+	///  @param[in]		parallelFor		The parallel-for function (null to run single-threaded).
+	///  @param[in]		workerCount		The maximum number of workers that can execute the update bodies concurrently.
+	/// @return True if the setup succeeded.
+	bool setParallelFor(dtCrowdParallelForFn parallelFor, const int workerCount);
+
 	/// Sets the shared avoidance configuration for the specified index.
 	///  @param[in]		idx		The index. [Limits: 0 <= value < #DT_CROWD_MAX_OBSTAVOIDANCE_PARAMS]
 	///  @param[in]		params	The new configuration.
@@ -28,6 +28,27 @@ namespace Flax.Build.Bindings
         private static readonly Dictionary<string, TypeInfo> CppVariantFromTypes = new Dictionary<string, TypeInfo>();
         private static bool CppNonPodTypesConvertingGeneration = false;
 
+        private static readonly Dictionary<string, int> CppBlittableTypeSizes = new Dictionary<string, int>()
+        {
+            // Basic types with the same size and alignment in both native and managed code (see CSharpNativeToManagedBasicTypes)
+            { "bool", 1 },
+            { "int8", 1 },
+            { "uint8", 1 },
+            { "byte", 1 },
+            { "char", 1 },
+            { "int16", 2 },
+            { "uint16", 2 },
+            { "short", 2 },
+            { "Char", 2 },
+            { "int32", 4 },
+            { "uint32", 4 },
+            { "int", 4 },
+            { "float", 4 },
+            { "int64", 8 },
+            { "uint64", 8 },
+            { "double", 8 },
+        };
+
         public class ScriptingLangInfo
         {
             public bool Enabled;
@@ -2054,6 +2075,87 @@ namespace Flax.Build.Bindings
             }
         }
 
+        private static bool GetCppBlittableTypeLayout(BuildData buildData, TypeInfo typeInfo, ApiTypeInfo caller, out int size, out int alignment)
+        {
+            // Basic type with the same layout in native and managed code (for array types this returns the element layout)
+            alignment = 1;
+            if (typeInfo.IsPtr || typeInfo.IsRef || typeInfo.IsBitField || typeInfo.GenericArgs != null)
+            {
+                size = 0;
+                return false;
+            }
+            if (CppBlittableTypeSizes.TryGetValue(typeInfo.Type, out size))
+            {
+                alignment = size;
+                return true;
+            }
+
+            // Enum uses the underlying integer type layout
+            var apiType = FindApiTypeInfo(buildData, typeInfo, caller);
+            if (apiType is EnumInfo enumInfo)
+            {
+                if (enumInfo.UnderlyingType != null)
+                    return GetCppBlittableTypeLayout(buildData, enumInfo.UnderlyingType, enumInfo, out size, out alignment);
+                size = 4;
+                alignment = 4;
+                return true;
+            }
+
+            // Nested POD structure
+            if (apiType is StructureInfo structureInfo)
+                return GetCppBlittableStructLayout(buildData, structureInfo, null, out size, out alignment);
+            return false;
+        }
+
+        private static bool GetCppBlittableStructLayout(BuildData buildData, StructureInfo structureInfo, List<KeyValuePair<string, int>> fieldOffsets, out int size, out int alignment)
+        {
+            // Compute the sequential memory layout of the structure as used by the managed runtime ([StructLayout(LayoutKind.Sequential)] with the natural fields packing)
+            size = 0;
+            alignment = 1;
+            if (!structureInfo.IsPod || structureInfo.BaseType != null)
+                return false;
+            var anyField = false;
+            foreach (var fieldInfo in structureInfo.Fields)
+            {
+                if (fieldInfo.IsStatic || fieldInfo.IsConstexpr)
+                    continue;
+                if (!GetCppBlittableTypeLayout(buildData, fieldInfo.Type, structureInfo, out var fieldSize, out var fieldAlignment))
+                    return false;
+                var count = 1;
+                if (fieldInfo.Type.IsArray)
+                {
+                    // Fixed-size array inlined into the structure
+                    if (fieldInfo.Type.ArraySize <= 0)
+                        return false;
+                    count = fieldInfo.Type.ArraySize;
+                }
+                size = (size + fieldAlignment - 1) / fieldAlignment * fieldAlignment;
+                if (fieldInfo.Access == AccessLevel.Public)
+                    fieldOffsets?.Add(new KeyValuePair<string, int>(fieldInfo.Name, size));
+                size += fieldSize * count;
+                alignment = Math.Max(alignment, fieldAlignment);
+                anyField = true;
+            }
+            if (!anyField)
+                return false;
+            size = (size + alignment - 1) / alignment * alignment;
+            return true;
+        }
+
+        private static void GenerateCppStructBlittableChecks(BuildData buildData, StringBuilder contents, StructureInfo structureInfo)
+        {
+            // Verify at compile-time that the native structure layout matches the managed one so the bindings can pass it via raw pointers with no conversion (blittable fast path)
+            var fieldOffsets = new List<KeyValuePair<string, int>>();
+            if (!GetCppBlittableStructLayout(buildData, structureInfo, fieldOffsets, out var size, out _))
+                return;
+            CppIncludeFiles.Add("Engine/Core/Compiler.h");
+            var structureTypeNameNative = structureInfo.FullNameNative;
+            contents.AppendLine();
+            contents.AppendLine($"static_assert(sizeof({structureTypeNameNative}) == {size}, \"{structureInfo.Name} size doesn't match the managed structure layout used by the scripting API (not blittable).\");");
+            foreach (var e in fieldOffsets)
+                contents.AppendLine($"static_assert(OFFSET_OF({structureTypeNameNative}, {e.Key}) == {e.Value}, \"{structureInfo.Name}::{e.Key} offset doesn't match the managed structure layout used by the scripting API (not blittable).\");");
+        }
+
         private static void GenerateCppStruct(BuildData buildData, StringBuilder contents, ModuleInfo moduleInfo, StructureInfo structureInfo)
         {
             var structureTypeNameNative = structureInfo.FullNameNative;
@@ -2065,6 +2167,8 @@ namespace Flax.Build.Bindings
 
             if (structureInfo.IsAutoSerialization)
                 GenerateCppAutoSerialization(buildData, contents, moduleInfo, structureInfo, structureTypeNameNative);
+            if (useCSharp && structureInfo.IsPod)
+                GenerateCppStructBlittableChecks(buildData, contents, structureInfo);
             GenerateCppTypeInternalsStatics?.Invoke(buildData, structureInfo, contents);
 
             contents.AppendLine();
@@ -91,6 +91,11 @@ namespace Flax.Build
         /// </summary>
         public bool IsEditor;
 
+        /// <summary>
+        /// True if the build target is a headless server profile that runs without rendering. Compiles only the null graphics backend and strips the frame drawing and textures streaming from the build (defines USE_HEADLESS).
+        /// </summary>
+        public bool IsHeadless;
+
         /// <summary>
         /// True if target is pre built and might not contain full sources (eg. binaries are shipped with pre-build target data without sources).
         /// </summary>
@@ -231,6 +236,8 @@ namespace Flax.Build
         public virtual void SetupTargetEnvironment(BuildOptions options)
         {
             options.CompileEnv.PreprocessorDefinitions.AddRange(GlobalDefinitions);
+            if (IsHeadless)
+                options.CompileEnv.PreprocessorDefinitions.Add("USE_HEADLESS");
             options.LinkEnv.Output = OutputType == TargetOutputType.Executable ? LinkerOutput.Executable : LinkerOutput.SharedLibrary;
 
             if (!options.Platform.HasModularBuildSupport)